@@ -0,0 +1,2482 @@
+#define __S_IFBLK 0060000
+#define BENCH_COBS_BLOCKS 4096
+#define _BITS_SCHED_H 1
+#define _BITS_FLOATN_COMMON_H 
+#define _SC_CHAR_MIN _SC_CHAR_MIN
+#define ECHONL 0000100
+#define COMMPORT_TYPE_TTY 4
+#define SYSEX_SUB_RELAY_FORWARD 0
+#define STATUS_EMERGENCY_STOP 0xF9
+#define __attr_access(x) __attribute__ ((__access__ x))
+#define BENCH_RING_BYTES (16UL * 1024 * 1024)
+#define __DBL_MIN_EXP__ (-1021)
+#define _SC_XOPEN_UNIX _SC_XOPEN_UNIX
+#define STATUS_SIGNAL 0xF3
+#define ____sigset_t_defined 
+#define _CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS
+#define SYSEX_DIGITAL_PIN_DATA 0x02
+#define O_NOCTTY 0400
+#define _POSIX_THREAD_PRIORITY_SCHEDULING 200809L
+#define ERROR_BUTTON_PAST_MAX_COUNT 55
+#define _POSIX_SHARED_MEMORY_OBJECTS 200809L
+#define __CFLOAT32 _Complex _Float32
+#define FIONBIO 0x5421
+#define _IOC_SIZEMASK ((1 << _IOC_SIZEBITS)-1)
+#define __UINT_LEAST16_MAX__ 0xffff
+#define _STDBOOL_H 
+#define __FLT16_HAS_QUIET_NAN__ 1
+#define HAL_BOARD_H 
+#define __ATOMIC_ACQUIRE 2
+#define COMMPORT_ERROR_NO 0
+#define _POSIX2_SW_DEV __POSIX2_THIS_VERSION
+#define __FLT128_MAX_10_EXP__ 4932
+#define _CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS
+#define _SC_PII_OSI_COTS _SC_PII_OSI_COTS
+#define SYSEX_ANALOG_PIN_DATA 0x03
+#define _SC_NGROUPS_MAX _SC_NGROUPS_MAX
+#define __MAX_BAUD B4000000
+#define PRIXFAST64 __PRI64_PREFIX "X"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+#define __GCC_IEC_559_COMPLEX 2
+#define SCNiFAST8 "hhi"
+#define __F_GETSIG 11
+#define VSWTC 7
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define _SC_SPIN_LOCKS _SC_SPIN_LOCKS
+#define _SC_TIMEOUTS _SC_TIMEOUTS
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+#define CRPRNT CREPRINT
+#define _PC_MAX_INPUT _PC_MAX_INPUT
+#define __UINT_LEAST8_TYPE__ unsigned char
+#define __SIZEOF_FLOAT80__ 16
+#define _T_WCHAR_ 
+#define _SC_IPV6 _SC_IPV6
+#define SIOCDELDLCI 0x8981
+#define TIOCSIG _IOW('T', 0x36, int)
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+#define SCNuMAX __PRI64_PREFIX "u"
+#define _ASM_GENERIC_IOCTL_H 
+#define _SC_XOPEN_REALTIME _SC_XOPEN_REALTIME
+#define __CFLOAT64 _Complex _Float64
+#define N_X25 6
+#define __flexarr []
+#define _SC_LINE_MAX _SC_LINE_MAX
+#define PIN_MODE_I2C 8
+#define __S64_TYPE long int
+#define _POSIX_PRIORITIZED_IO 200809L
+#define _MM_MASK_MASK 0x1f80
+#define FLUSHO 0010000
+#define _SC_LONG_BIT _SC_LONG_BIT
+#define __stub_fchflags 
+#define __SQUAD_TYPE long int
+#define __DEFINED_ptrdiff_t 
+#define GPIO_REG(pin) ((pin) >> 4)
+#define __INTMAX_C(c) c ## L
+#define _SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE
+#define SIOCSIFHWADDR 0x8924
+#define ERROR_CHUNK_FAIL 17
+#define PENDIN 0040000
+#define _BSD_SIZE_T_DEFINED_ 
+#define PTHREAD_CANCELED ((void *) -1)
+#define _BITS_TIME_H 1
+#define RELAY_NODE_MAX 127
+#define SYSEX_RCSWITCH_IN 0x48
+#define TIOCM_CAR 0x040
+#define __socklen_t_defined 
+#define O_ACCMODE 0003
+#define TIOCEXCL 0x540C
+#define __CHAR_BIT__ 8
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+#define TIOCPKT_IOCTL 64
+#define _mm_shuffle_ps(A,B,MASK) ((__m128) __builtin_ia32_shufps ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(MASK)))
+#define _IOC_DIRMASK ((1 << _IOC_DIRBITS)-1)
+#define PROTOCOL_ERR_TOTAL 7
+#define CRC16_CLMUL_P 0x8408
+#define _SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS
+#define __CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\0', setsize); while (0)
+#define UTILITY_CBUFFER_H 
+#define IRQ_PRIORITY 0
+#define N_AX25 5
+#define __UINT8_MAX__ 0xff
+#define _POSIX_CLOCK_SELECTION 200809L
+#define _POSIX_TYPED_MEMORY_OBJECTS -1
+#define __SCHAR_WIDTH__ 8
+#define SIOCADDDLCI 0x8980
+#define S_IFSOCK __S_IFSOCK
+#define _SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS
+#define __S_ISUID 04000
+#define ERROR_STEPPER_ACTIVE_CANT_RESET 57
+#define CREAD 0000200
+#define __WINT_MAX__ 0xffffffffU
+#define PIN_MODE_SHIFT 11
+#define _SC_TTY_NAME_MAX _SC_TTY_NAME_MAX
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define BENCH_PULSE_LEAD 20
+#define PARENB 0000400
+#define ERROR_I2C_START_FAIL 37
+#define TIME_UTC 1
+#define __FLT32_MIN_EXP__ (-125)
+#define MSG_MAX 256
+#define _SC_XOPEN_XPG2 _SC_XOPEN_XPG2
+#define FIOASYNC 0x5452
+#define INT8_MAX (127)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+#define SIOCSIFHWBROADCAST 0x8937
+#define STATUS_SYSEX_START 0xFF
+#define stderr stderr
+#define _CS_LFS_LIBS _CS_LFS_LIBS
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+#define PRIXLEAST8 "X"
+#define _CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS
+#define _CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS
+#define STATUS_PROTOCOL_ENCODING 0xF1
+#define SIOCSIFDSTADDR 0x8918
+#define _SC_PII_SOCKET _SC_PII_SOCKET
+#define FD_POLL_MS 100
+#define _MM_ROUND_TOWARD_ZERO 0x6000
+#define _SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32
+#define FD_TYPE_PTY 1
+#define SCNxFAST8 "hhx"
+#define B1200 0000011
+#define __OFF_T_MATCHES_OFF64_T 1
+#define _m_pshufw(A,N) _mm_shuffle_pi16 (A, N)
+#define __ORDER_LITTLE_ENDIAN__ 1234
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+#define TYPE_I2C_WRITE 38
+#define PRIdMAX __PRI64_PREFIX "d"
+#define __WCHAR_MAX__ 0x7fffffff
+#define TIOCSERGETMULTI 0x545A
+#define SIOCGIFADDR 0x8915
+#define SCNx16 "hx"
+#define _SC_2_C_DEV _SC_2_C_DEV
+#define MSG_PAYLOAD_MAX_SIZE (MSG_MAX - MSG_MIN)
+#define _SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE
+#define TX_BUFFER_SIZE 64
+#define INT16_MAX (32767)
+#define TIOCGWINSZ 0x5413
+#define _IOC_TYPE(nr) (((nr) >> _IOC_TYPESHIFT) & _IOC_TYPEMASK)
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+#define __S_IREAD 0400
+#define ERROR_WATCHDOG_EXPIRE 28
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+#define TYPE_GPIO_SET 26
+#define SYSEX_SUB_VERSION_HAL 4
+#define _MM_MALLOC_H_INCLUDED 
+#define __GCC_IEC_559 2
+#define __FLT32X_DECIMAL_DIG__ 17
+#define F_RDLCK 0
+#define _IOFBF 0
+#define __FLT_EVAL_METHOD__ 0
+#define TIOCGPTPEER _IO('T', 0x41)
+#define _SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF
+#define TTYDEF_IFLAG (BRKINT | ISTRIP | ICRNL | IMAXBEL | IXON | IXANY)
+#define _SC_SPORADIC_SERVER _SC_SPORADIC_SERVER
+#define _IO_USER_LOCK 0x8000
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+#define _SC_XOPEN_STREAMS _SC_XOPEN_STREAMS
+#define _SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT
+#define _SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN
+#define MSG_TRAILER_CRC 3
+#define _CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS
+#define __FLT64_DECIMAL_DIG__ 17
+#define _XOPEN_VERSION 700
+#define BENCH_RELAY_WIRE 256
+#define SCHED_RR 2
+#define __HAVE_GENERIC_SELECTION 1
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+#define __HAVE_FLOAT64 1
+#define COMMPORT_ERROR_BUFOVF 4
+#define _MM_FLUSH_ZERO_OFF 0x0000
+#define MSG_MIN (MSG_COBS_OVERHEAD + MSG_OVERHEAD)
+#define FNONBLOCK O_NONBLOCK
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+#define INT8_MIN (-128)
+#define GPIO_MASK(pin) _BV((pin) & 0xf)
+#define be64toh(x) __bswap_64 (x)
+#define __DEFINED_wchar_t 
+#define _SC_2_CHAR_TERM _SC_2_CHAR_TERM
+#define _CS_LFS_CFLAGS _CS_LFS_CFLAGS
+#define _SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX
+#define __CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)
+#define ERROR_PAST_MAX_COUNT 24
+#define PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED
+#define TIMER16 0
+#define TCIOFLUSH 2
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+#define __S_IFIFO 0010000
+#define MSG_RX_RING_SIZE 512
+#define __DEFINED_size_t 
+#define __CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))
+#define __CFLOAT128 _Complex _Float128
+#define _SC_CPUTIME _SC_CPUTIME
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+#define MSG_TRAILER_SIZE 3
+#define __SIG_ATOMIC_TYPE__ int
+#define __COMPAR_FN_T 
+#define __GID_T_TYPE __U32_TYPE
+#define _SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT
+#define __STATFS_MATCHES_STATFS64 1
+#define __DBL_MIN_10_EXP__ (-307)
+#define INT16_MIN (-32767-1)
+#define __FINITE_MATH_ONLY__ 0
+#define __id_t_defined 
+#define _SC_PAGE_SIZE _SC_PAGESIZE
+#define PRIi32 "i"
+#define _SC_SCHAR_MAX _SC_SCHAR_MAX
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+#define __FLT32X_MAX_EXP__ 1024
+#define EPOLLMSG EPOLLMSG
+#define SIOCGIFTXQLEN 0x8942
+#define _SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG
+#define ERROR_TIMER1_NOT_PWM 27
+#define SIOCGIFHWADDR 0x8927
+#define PRIxPTR __PRIPTR_PREFIX "x"
+#define __u_char_defined 
+#define _SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS
+#define WIFEXITED(status) __WIFEXITED (status)
+#define _MM_FLUSH_ZERO_MASK 0x8000
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+#define INLCR 0000100
+#define __pid_t_defined 
+#define __FLT32_HAS_DENORM__ 1
+#define CQUIT 034
+#define SPI_CH 0
+#define S_IFBLK __S_IFBLK
+#define _POSIX_TRACE_EVENT_FILTER -1
+#define EPOLL_CTL_ADD 1
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS
+#define __UINT_FAST8_MAX__ 0xff
+#define __LEAF , __leaf__
+#define _THREAD_MUTEX_INTERNAL_H 1
+#define MSG_OVERHEAD 3
+#define _MM_TRANSPOSE4_PS(row0,row1,row2,row3) do { __v4sf __r0 = (row0), __r1 = (row1), __r2 = (row2), __r3 = (row3); __v4sf __t0 = __builtin_ia32_unpcklps (__r0, __r1); __v4sf __t1 = __builtin_ia32_unpcklps (__r2, __r3); __v4sf __t2 = __builtin_ia32_unpckhps (__r0, __r1); __v4sf __t3 = __builtin_ia32_unpckhps (__r2, __r3); (row0) = __builtin_ia32_movlhps (__t0, __t1); (row1) = __builtin_ia32_movhlps (__t1, __t0); (row2) = __builtin_ia32_movlhps (__t2, __t3); (row3) = __builtin_ia32_movhlps (__t3, __t2); } while (0)
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define _BITS_TYPES_LOCALE_T_H 1
+#define TYPE_BASE_FINALIZE_CONFIG 10
+#define __size_t 
+#define TIOCM_CTS 0x020
+#define _POSIX_SPIN_LOCKS 200809L
+#define SCNdLEAST8 "hhd"
+#define __FLT32_MAX_10_EXP__ 38
+#define BIT_GET(p,m) ((p) & (m))
+#define TIOCGETD 0x5424
+#define INT_FAST8_MAX (127)
+#define __DEC64_MAX_EXP__ 385
+#define _WCHAR_T_DEFINED 
+#define _POSIX_V7_LP64_OFF64 1
+#define _XOPEN_XCU_VERSION 4
+#define __O_NOATIME 01000000
+#define _MM_MASK_DIV_ZERO 0x0200
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __cleanup_fct_attribute 
+#define _SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES
+#define PWM_MAX_RESOLUTION 0
+#define ERROR_OIDS_ALREADY_ALLOC 9
+#define __INT8_C(c) c
+#define WCHAR_MAX __WCHAR_MAX
+#define TCOFLUSH 1
+#define TIOCSISO7816 _IOWR('T', 0x43, struct serial_iso7816)
+#define SIOCSIFNETMASK 0x891c
+#define EPOLLEXCLUSIVE EPOLLEXCLUSIVE
+#define PRIXFAST32 __PRIPTR_PREFIX "X"
+#define __INT_LEAST8_WIDTH__ 8
+#define _CS_PATH _CS_PATH
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+#define IUTF8 0040000
+#define SYSEX_PINSTATE_REP 0x45
+#define CLOCKS_PER_SEC ((__clock_t) 1000000)
+#define htobe16(x) __bswap_16 (x)
+#define _XBS5_LPBIG_OFFBIG -1
+#define _SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION
+#define __always_inline __inline __attribute__ ((__always_inline__))
+#define _SC_PII_OSI_M _SC_PII_OSI_M
+#define NFDBITS __NFDBITS
+#define IOC_IN (_IOC_WRITE << _IOC_DIRSHIFT)
+#define TYPE_ADC_CONFIG 32
+#define __SHRT_MAX__ 0x7fff
+#define SCNd8 "hhd"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define HAL_ARCH_H 
+#define _SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX
+#define __FLT64X_MAX_10_EXP__ 4932
+#define CEIL127(a) ({ __typeof__ (a) _a = (a); _a < 127 ? _a : 127; })
+#define S_IXOTH (S_IXGRP >> 3)
+#define XCASE 0000004
+#define __ILP32_OFFBIG_CFLAGS "-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64"
+#define SYSEX_SUB_SCHED_TASK_REP 8
+#define SYSEX_SUB_SCHED_TASK_REQ 7
+#define _SC_SCHAR_MIN _SC_SCHAR_MIN
+#define PIN_MODE_PWM 4
+#define __daddr_t_defined 
+#define XTABS 0014000
+#define _POSIX_SYNCHRONIZED_IO 200809L
+#define __O_CLOEXEC 02000000
+#define __LDBL_IS_IEC_60559__ 2
+#define VWERASE 14
+#define INT_FAST16_MAX (9223372036854775807L)
+#define SYSEX_SUB_SCHED_ERROR_REP 9
+#define __fortify_function __extern_always_inline __attribute_artificial__
+#define PRIu16 "u"
+#define _MM_EXCEPT_UNDERFLOW 0x0010
+#define ERROR_OID_INVALID 11
+#define __FLT64X_HAS_QUIET_NAN__ 1
+#define SYSEX_SUB_RELAY_ROUTE_ADD 1
+#define SCNd16 "hd"
+#define _CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION
+#define _SC_SHRT_MIN _SC_SHRT_MIN
+#define _POSIX_JOB_CONTROL 1
+#define __UINT_LEAST8_MAX__ 0xff
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+#define _SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64
+#define B0 0000000
+#define SIOCGIFMETRIC 0x891d
+#define _SC_SYMLOOP_MAX _SC_SYMLOOP_MAX
+#define __UINTMAX_TYPE__ long unsigned int
+#define _CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS
+#define _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define TYPE_SPI_SHUTDOWN 44
+#define _SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX
+#define _mm_bsrli_si128(A,N) ((__m128i)__builtin_ia32_psrldqi128 ((__m128i)(A), (int)(N) * 8))
+#define _UNISTD_H 1
+#define BIT_WRITE(c,p,m) (c ? BIT_SET(p,m) : BIT_CLEAR(p,m))
+#define _POSIX_THREAD_CPUTIME 0
+#define __linux 1
+#define MSG_SEQ_MASK 0x0f
+#define __DEC32_EPSILON__ 1E-6DF
+#define WCHAR_MIN __WCHAR_MIN
+#define SIOCSIFBRDADDR 0x891a
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+#define _BITS_TYPES_H 1
+#define _mm_extract_epi16(A,N) ((int) (unsigned short) __builtin_ia32_vec_ext_v8hi ((__v8hi)(__m128i)(A), (int)(N)))
+#define PROTOCOL_ERR_EVENT_UNKNOWN 6
+#define FD_TYPE_SOCKET 3
+#define __unix 1
+#define ____gwchar_t_defined 1
+#define IGNCR 0000200
+#define _BITS_PTHREADTYPES_ARCH_H 1
+#define __UINT32_MAX__ 0xffffffffU
+#define __UID_T_TYPE __U32_TYPE
+#define B2500000 0010014
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+#define _POSIX_READER_WRITER_LOCKS 200809L
+#define PTHREAD_BARRIER_SERIAL_THREAD -1
+#define _SC_MB_LEN_MAX _SC_MB_LEN_MAX
+#define __SIZE_T 
+#define VSTOP 9
+#define WINT_MAX (4294967295u)
+#define SCNd64 __PRI64_PREFIX "d"
+#define __S_ISVTX 01000
+#define _BITS_POSIX_OPT_H 1
+#define _SC_MINSIGSTKSZ _SC_MINSIGSTKSZ
+#define _SC_PII _SC_PII
+#define SCNo32 "o"
+#define _SC_USHRT_MAX _SC_USHRT_MAX
+#define _SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R
+#define _ATFILE_SOURCE 1
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+#define SCNuLEAST16 "hu"
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+#define _SC_NETWORKING _SC_NETWORKING
+#define __FLT128_MIN_EXP__ (-16381)
+#define _STATBUF_ST_BLKSIZE 
+#define __WINT_MIN__ 0U
+#define STATUS_DIGITAL_PIN_REPORT 0xB0
+#define ERROR_I2C_BUS_INVALID 39
+#define O_DIRECTORY __O_DIRECTORY
+#define VEOF 4
+#define VEOL 11
+#define PRIxFAST8 "x"
+#define WUNTRACED 2
+#define _SC_SHELL _SC_SHELL
+#define F_LOCK 1
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define PRIiFAST64 __PRI64_PREFIX "i"
+#define _POSIX_V6_LP64_OFF64 1
+#define TYPE_DEBUG_NOP 19
+#define _STATBUF_ST_RDEV 
+#define UINT16_C(c) c
+#define TYPE_DEBUG_WRITE 22
+#define CRC16_READP(VAR) VAR
+#define SIOCSIFPFLAGS 0x8934
+#define SCNo8 "hho"
+#define TTY_CH 0
+#define __FLT128_MIN_10_EXP__ (-4931)
+#define TYPE_UNKNOWN 0
+#define TCXONC 0x540A
+#define __FLT32X_IS_IEC_60559__ 2
+#define SCNo64 __PRI64_PREFIX "o"
+#define _PC_PRIO_IO _PC_PRIO_IO
+#define EXIT_FAILURE 1
+#define _IOC_NONE 0U
+#define SCNdFAST32 __PRIPTR_PREFIX "d"
+#define __INT_LEAST16_WIDTH__ 16
+#define _SIZE_T_DEFINED_ 
+#define IUCLC 0001000
+#define _IOR_BAD(type,nr,size) _IOC(_IOC_READ,(type),(nr),sizeof(size))
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __SCHAR_MAX__ 0x7f
+#define __FLT128_MANT_DIG__ 113
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+#define IOC_INOUT ((_IOC_WRITE|_IOC_READ) << _IOC_DIRSHIFT)
+#define _mm_shufflehi_epi16(A,N) ((__m128i)__builtin_ia32_pshufhw ((__v8hi)(__m128i)(A), (int)(N)))
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+#define __KERNEL_STRICT_NAMES 
+#define SCNxFAST16 __PRIPTR_PREFIX "x"
+#define PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }
+#define __INT64_C(c) c ## L
+#define PRIxLEAST8 "x"
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define _CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+#define __INT_WCHAR_T_H 
+#define WSTOPPED 2
+#define B3000000 0010015
+#define S_IFLNK __S_IFLNK
+#define _CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS
+#define PROTOCOL_ERR_SIZE 2
+#define SYSEX_MOD_EXTEND 0x7F
+#define _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS
+#define SCNoFAST64 __PRI64_PREFIX "o"
+#define _SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC
+#define _SC_2_C_BIND _SC_2_C_BIND
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+#define TIOCSERGSTRUCT 0x5458
+#define VTIME 5
+#define _CS_V6_ENV _CS_V6_ENV
+#define PRIxFAST32 __PRIPTR_PREFIX "x"
+#define _SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+#define CRC16_PROGMEM 
+#define SYSEX_SUB_VERSION_ALL 127
+#define TIOCLINUX 0x541C
+#define _SC_2_UPE _SC_2_UPE
+#define _POSIX_SOURCE 1
+#define S_IRWXO (S_IRWXG >> 3)
+#define S_IRWXU (__S_IREAD|__S_IWRITE|__S_IEXEC)
+#define _SC_PII_OSI_CLTS _SC_PII_OSI_CLTS
+#define _DEFAULT_SOURCE 1
+#define VDISCARD 13
+#define STATUS_ANALOG_PIN_SET 0xE0
+#define PIN_MODE_OUTPUT 3
+#define _SC_XOPEN_SHM _SC_XOPEN_SHM
+#define __attribute_used__ __attribute__ ((__used__))
+#define SIOCDELRT 0x890C
+#define CSTOP CTRL('s')
+#define INPCK 0000020
+#define S_IFMT __S_IFMT
+#define CLOCK_REALTIME 0
+#define __LOCK_ALIGNMENT 
+#define __FLT32X_MANT_DIG__ 53
+#define _IOW_BAD(type,nr,size) _IOC(_IOC_WRITE,(type),(nr),sizeof(size))
+#define _XOPEN_REALTIME_THREADS 1
+#define VLNEXT 15
+#define TYPE_SPI_SET 41
+#define PRIuFAST16 __PRIPTR_PREFIX "u"
+#define _SC_VERSION _SC_VERSION
+#define SCNx32 "x"
+#define EPOLL_CTL_DEL 2
+#define SCHED_OTHER 0
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+#define CLOCK_REALTIME_ALARM 8
+#define ERROR_NO 60
+#define STATUS_PROTOCOL_VERSION 0xF0
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+#define _SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM
+#define SCNx8 "hhx"
+#define _BITS_ENDIANNESS_H 1
+#define PRIuLEAST32 "u"
+#define __F_SETOWN_EX 15
+#define _SC_BC_SCALE_MAX _SC_BC_SCALE_MAX
+#define __GLIBC__ 2
+#define _SC_POLL _SC_POLL
+#define PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED
+#define __END_DECLS 
+#define _STATBUF_ST_NSEC 
+#define PRIuFAST32 __PRIPTR_PREFIX "u"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+#define _POSIX_V6_LPBIG_OFFBIG -1
+#define __CONCAT(x,y) x ## y
+#define PIN_MODE_IGNORE 14
+#define _SC_RTSIG_MAX _SC_RTSIG_MAX
+#define CREPRINT CTRL('r')
+#define WCONTINUED 8
+#define __STDC_HOSTED__ 1
+#define _SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX
+#define _IOC_TYPECHECK(t) (sizeof(t))
+#define PIN_MODE_TTY 7
+#define GPIO_ATOMIC(pin,expr) do { if (pin < GPIO_ATOMIC_MAX) { expr; } else { uint8_t sreg = SREG; __asm__ __volatile__("cli" ::: "memory"); expr; SREG = sreg; __asm__ __volatile__("" ::: "memory"); } } while (0)
+#define ERROR_PIN_OUT_INVALID 30
+#define __SLONG32_TYPE int
+#define _BITS_UINTN_IDENTITY_H 1
+#define TCSBRKP 0x5425
+#define _SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE
+#define F_GETLK F_GETLK64
+#define _SYS_SELECT_H 1
+#define CTIME 0
+#define PRIuLEAST64 __PRI64_PREFIX "u"
+#define TYPE_ADC_QUERY 33
+#define __DEC64_MIN_EXP__ (-382)
+#define _XOPEN_ENH_I18N 1
+#define B230400 0010003
+#define TIOCM_RTS 0x004
+#define TYPE_BASE_GET_CLOCK 11
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define COMMPORT_ERROR_DATAOVR 2
+#define NCC 8
+#define __jmp_buf_tag_defined 1
+#define TIOCGSID 0x5429
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+#define SIOCSIFMAP 0x8971
+#define __O_NOFOLLOW 0400000
+#define _SC_TZNAME_MAX _SC_TZNAME_MAX
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS
+#define __GNU_LIBRARY__ 6
+#define EPOLLIN EPOLLIN
+#define SCNi32 "i"
+#define __DBL_DIG__ 15
+#define __FLT32_DIG__ 6
+#define STATUS_EVENT_BEGIN 0xFD
+#define CMSPAR 010000000000
+#define _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS
+#define __RLIM_T_MATCHES_RLIM64_T 1
+#define _SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+#define INT32_MIN (-2147483647-1)
+#define STATUS_SYSTEM_RESUME 0xFB
+#define __NCPUBITS (8 * sizeof (__cpu_mask))
+#define _IO_EOF_SEEN 0x0010
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define _IOC_SIZESHIFT (_IOC_TYPESHIFT+_IOC_TYPEBITS)
+#define _SC_TIMER_MAX _SC_TIMER_MAX
+#define _POSIX_SPAWN 200809L
+#define PULSE_SPIN_US 80
+#define __SHRT_WIDTH__ 16
+#define __f64x(x) x ##f64x
+#define PROTOCOL_H 
+#define _INTTYPES_H 1
+#define _STDIO_H 1
+#define TMP_MAX 238328
+#define __FLT32_IS_IEC_60559__ 2
+#define PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define S_IWGRP (S_IWUSR >> 3)
+#define SYSEX_SUB_VERSION_PROTOCOL 3
+#define SIOCGIFPFLAGS 0x8935
+#define _CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS
+#define _mm_prefetch(P,I) __builtin_prefetch ((P), ((I & 0x4) >> 2), (I & 0x3))
+#define EPOLLWRBAND EPOLLWRBAND
+#define TCOON 1
+#define SYSTEM_RESET_TOTAL 3
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+#define __STDC_UTF_16__ 1
+#define _____fpos_t_defined 1
+#define __nonnull(params) __attribute_nonnull__ (params)
+#define __DBL_IS_IEC_60559__ 2
+#define le32toh(x) __uint32_identity (x)
+#define _SIZE_T_DEFINED 
+#define SIOCGIFCOUNT 0x8938
+#define TYPE_SPI_CONFIG 39
+#define __DEC32_MAX__ 9.999999E96DF
+#define PIN_IS_DIGITAL(p) (0)
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+#define TYPE_BASE_RESET 16
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+#define __O_LARGEFILE 0
+#define ERROR_PIN_ADC_INVALID 31
+#define SYSEX_SUB_ANALOG_DATA_ 0
+#define STATUS_INFO 0xF2
+#define __ASM_GENERIC_IOCTLS_H 
+#define TIOCNXCL 0x540D
+#define AT_SYMLINK_FOLLOW 0x400
+#define SIOCSIFFLAGS 0x8914
+#define _SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+#define _WCHAR_T_ 
+#define _POSIX_THREAD_ATTR_STACKSIZE 200809L
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+#define SCNuLEAST64 __PRI64_PREFIX "u"
+#define __F_SETOWN 8
+#define ECHO 0000010
+#define _STDDEF_H 
+#define MSB16(a) ({ __typeof__ (a) _a = (a); _a & 0xF0; })
+#define _SC_MEMLOCK _SC_MEMLOCK
+#define CLOCK_BOOTTIME_ALARM 9
+#define TIOCSLCKTRMIOS 0x5457
+#define B2400 0000013
+#define _VA_LIST_DEFINED 
+#define __FLT32X_HAS_INFINITY__ 1
+#define _SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE
+#define __INT32_MAX__ 0x7fffffff
+#define _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS
+#define __GLIBC_USE_DEPRECATED_GETS 0
+#define __SIZEOF_PTHREAD_COND_T 48
+#define _POSIX_THREAD_SAFE_FUNCTIONS 200809L
+#define __FLT16_DIG__ 3
+#define _POSIX_V7_LPBIG_OFFBIG -1
+#define __unix__ 1
+#define STDOUT_FILENO 1
+#define STATUS_INTERRUPT 0xF4
+#define __INT_WIDTH__ 32
+#define __SIZEOF_LONG__ 8
+#define _IONBF 2
+#define _EMMINTRIN_H_INCLUDED 
+#define O_NDELAY O_NONBLOCK
+#define __S_IFCHR 0020000
+#define O_ASYNC 020000
+#define __STDC_IEC_559__ 1
+#define __STDC_ISO_10646__ 201706L
+#define PRIoFAST16 __PRIPTR_PREFIX "o"
+#define PRIX64 __PRI64_PREFIX "X"
+#define _SC_NL_NMAX _SC_NL_NMAX
+#define __UINT16_C(c) c
+#define SCNu16 "hu"
+#define _SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R
+#define B576000 0010006
+#define OPOST 0000001
+#define UINT_LEAST8_MAX (255)
+#define __DECIMAL_DIG__ 21
+#define CR0 0000000
+#define CR1 0001000
+#define CR2 0002000
+#define CR3 0003000
+#define B1500000 0010012
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+#define __USE_FORTIFY_LEVEL 0
+#define __STDC_IEC_559_COMPLEX__ 1
+#define LOCK_EX 2
+#define TCSETS2 _IOW('T', 0x2B, struct termios2)
+#define TIOCSRS485 0x542F
+#define _HAVE_STRUCT_TERMIOS_C_ISPEED 1
+#define F_DUPFD 0
+#define TCIFLUSH 0
+#define VKILL 3
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+#define __gnu_linux__ 1
+#define _SC_T_IOV_MAX _SC_T_IOV_MAX
+#define CS5 0000000
+#define CS6 0000020
+#define CS7 0000040
+#define TCSAFLUSH 2
+#define _MM_EXCEPT_OVERFLOW 0x0008
+#define _SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX
+#define __FLT128_IS_IEC_60559__ 2
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+#define _SC_2_SW_DEV _SC_2_SW_DEV
+#define _PC_FILESIZEBITS _PC_FILESIZEBITS
+#define TYPE_DEBUG_END_GROUP 18
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+#define SCNdLEAST32 "d"
+#define __bool_true_false_are_defined 1
+#define PROTOCOL_USE_CRC 1
+#define RELAY_HOPS_MAX 8
+#define _SC_CLOCK_SELECTION _SC_CLOCK_SELECTION
+#define RELEASE_PROTOCOL __GIT_REVPARSE__
+#define FNDELAY O_NDELAY
+#define TIOCGPGRP 0x540F
+#define PRIX8 "X"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+#define PRIoLEAST16 "o"
+#define _SC_UINT_MAX _SC_UINT_MAX
+#define F_OK 0
+#define PULSE_SLOTS (1000/PULSE_SLOT_US)
+#define __LDBL_HAS_QUIET_NAN__ 1
+#define INT64_C(c) c ## L
+#define PRIuFAST8 "u"
+#define PRIoFAST64 __PRI64_PREFIX "o"
+#define __USE_ISOC11 1
+#define __HAVE_FLOAT64X 1
+#define ERROR_SPI_NBLOCK_UNAVAIL 47
+#define __FLT16_MIN_EXP__ (-13)
+#define N_STRIP 4
+#define PRIi64 __PRI64_PREFIX "i"
+#define _POSIX_MAPPED_FILES 200809L
+#define __FLT64_MANT_DIG__ 53
+#define __attribute_const__ __attribute__ ((__const__))
+#define _PC_PATH_MAX _PC_PATH_MAX
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define _SC_XOPEN_VERSION _SC_XOPEN_VERSION
+#define _POSIX_NO_TRUNC 1
+#define SCNdLEAST64 __PRI64_PREFIX "d"
+#define SYSEX_DEVICE_REP 0x47
+#define htobe32(x) __bswap_32 (x)
+#define B460800 0010004
+#define __FLT64X_MANT_DIG__ 64
+#define IEXTEN 0100000
+#define SYSEX_PINSTATE_REQ 0x44
+#define _SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG
+#define L_tmpnam 20
+#define ___int_wchar_t_h 
+#define UINT8_C(c) c
+#define BIT_CLEAR(p,m) ((p) &= ~(m))
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+#define SYSEX_SUB_SCHED_CREATE 0
+#define _T_PTRDIFF 
+#define __GNUC__ 12
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+#define TYPE_BASE_EMERGENCY_STOP 13
+#define _IOC_NR(nr) (((nr) >> _IOC_NRSHIFT) & _IOC_NRMASK)
+#define N_SMSBLOCK 12
+#define LSB16(a) ({ __typeof__ (a) _a = (a); _a & 0x0F; })
+#define __MMX__ 1
+#define PROTOCOL_USE_SEQUENCEID 1
+#define TAB1 0004000
+#define TAB2 0010000
+#define TAB3 0014000
+#define L_ctermid 9
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define CRC16_CLMUL_MU 0xc2cd82058e2c0c88ULL
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+#define _MM_ROUND_NEAREST 0x0000
+#define SYSEX_I2C_DATA 0x06
+#define N_MASC 8
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define __FLT_HAS_DENORM__ 1
+#define __SIZEOF_LONG_DOUBLE__ 16
+#define POSIX_FADV_WILLNEED 3
+#define SYSEX_SUB_SCHED_LIST_REQ 5
+#define PRIoLEAST32 "o"
+#define LOCK_NB 4
+#define _SC_ARG_MAX _SC_ARG_MAX
+#define __timeval_defined 1
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define _SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32
+#define S_IWUSR __S_IWRITE
+#define ERROR_ADC_OUT_OF_RANGE 33
+#define N_6PACK 7
+#define ERROR_I2C_MODIFY_BITS 36
+#define ISTRIP 0000040
+#define PRIdLEAST16 "d"
+#define SCNxMAX __PRI64_PREFIX "x"
+#define ERROR_MISSED_PWM_EVENT 20
+#define _SC_USER_GROUPS_R _SC_USER_GROUPS_R
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define SEEK_CUR 1
+#define __BIGGEST_ALIGNMENT__ 16
+#define _SC_BC_STRING_MAX _SC_BC_STRING_MAX
+#define CLOCAL 0004000
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define TIOCSBRK 0x5427
+#define TIOCGISO7816 _IOR('T', 0x42, struct serial_iso7816)
+#define STDERR_FILENO 2
+#define ERROR_SPI_DEV_TOO_MANY 49
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+#define PRIuMAX __PRI64_PREFIX "u"
+#define __ONCE_ALIGNMENT 
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+#define __FLT64_MAX_10_EXP__ 308
+#define TYPE_GPIO_SOFTPWM_SCHEDULE 28
+#define PRIdLEAST32 "d"
+#define _POSIX_CHOWN_RESTRICTED 0
+#define PRIoLEAST64 __PRI64_PREFIX "o"
+#define __GLIBC_USE_LIB_EXT2 0
+#define __USE_ISOC95 1
+#define _TIME_H 1
+#define N_PROFIBUS_FDL 10
+#define __USE_ISOC99 1
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define O_FSYNC O_SYNC
+#define EXTA B19200
+#define TCSETAF 0x5408
+#define __FLT16_MAX_10_EXP__ 4
+#define __CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))
+#define _mm_shuffle_pi16(A,N) ((__m64) __builtin_ia32_pshufw ((__v4hi)(__m64)(A), (int)(N)))
+#define _mm_aeskeygenassist_si128(X,C) ((__m128i) __builtin_ia32_aeskeygenassist128 ((__v2di)(__m128i)(X), (int)(C)))
+#define FIONCLEX 0x5450
+#define _GCC_WCHAR_T 
+#define _SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define _SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE
+#define _SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE
+#define PRIiFAST16 __PRIPTR_PREFIX "i"
+#define _CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS
+#define TYPE_DEBUG_START_GROUP 17
+#define LOCK_SH 1
+#define SCNoLEAST8 "hho"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+#define TIOCCBRK 0x5428
+#define _CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS
+#define __DBL_HAS_INFINITY__ 1
+#define __FIRMWARE_BOARD_HOSTLINUX__ 1
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define _PC_SYMLINK_MAX _PC_SYMLINK_MAX
+#define PRIdLEAST64 __PRI64_PREFIX "d"
+#define TYPE_BASE_ALLOCATE_OIDS 8
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+#define TIOCPKT_FLUSHWRITE 2
+#define _CS_LFS_LDFLAGS _CS_LFS_LDFLAGS
+#define B9600 0000015
+#define _PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED
+#define PRId8 "d"
+#define VMIN 6
+#define __SIZEOF_FLOAT__ 4
+#define PRIiFAST32 __PRIPTR_PREFIX "i"
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define PRIi16 "i"
+#define TIOCMGET 0x5415
+#define _CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS
+#define __USE_XOPEN2K 1
+#define LOCK_UN 8
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+#define SYSEX_SUB_VERSION_BOARD 5
+#define MSG_POS_SEQ 1
+#define _SC_CLK_TCK _SC_CLK_TCK
+#define _SC_2_VERSION _SC_2_VERSION
+#define __lldiv_t_defined 1
+#define __DEC32_MIN_EXP__ (-94)
+#define SCHED_FIFO 1
+#define __DADDR_T_TYPE __S32_TYPE
+#define SYSEX_SUB_FEATURES_PIN_TOTAL 0
+#define SCNxLEAST64 __PRI64_PREFIX "x"
+#define _SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE
+#define _mm_extract_pi16(A,N) ((int) (unsigned short) __builtin_ia32_vec_ext_v4hi ((__v4hi)(__m64)(A), (int)(N)))
+#define TYPE_PWM_SCHEDULE 30
+#define __INTPTR_WIDTH__ 64
+#define __FLT64X_HAS_INFINITY__ 1
+#define _POSIX_THREAD_SPORADIC_SERVER -1
+#define PIN_MODE_PULLUP 1
+#define _SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R
+#define ERROR_SPI_WRITE_UNAVAIL 50
+#define FD_TYPE_FILE 0
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+#define PROTOCOL_VERSION_MINOR 0
+#define _POSIX_ASYNC_IO 1
+#define FIOQSIZE 0x5460
+#define __FD_SETSIZE 1024
+#define be32toh(x) __bswap_32 (x)
+#define ERROR_SPI_SPEED_UNAVAIL 46
+#define _XMMINTRIN_H_INCLUDED 
+#define _PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE
+#define __FLT32X_HAS_DENORM__ 1
+#define __INT_FAST16_TYPE__ long int
+#define __HAVE_FLOAT128X 0
+#define _XBS5_LP64_OFF64 1
+#define _POSIX_PRIORITY_SCHEDULING 200809L
+#define _IOC_TYPEMASK ((1 << _IOC_TYPEBITS)-1)
+#define __MMX_WITH_SSE__ 1
+#define _WCHAR_T_DEFINED_ 
+#define _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS
+#define SIOCGIFBR 0x8940
+#define PRIi8 "i"
+#define __INO_T_MATCHES_INO64_T 1
+#define SCNdFAST8 "hhd"
+#define TCSETXW 0x5435
+#define _POSIX_REGEXP 1
+#define _SC_CHILD_MAX _SC_CHILD_MAX
+#define __USE_POSIX199506 1
+#define _FEATURES_H 1
+#define __LDBL_HAS_DENORM__ 1
+#define PROTOCOL_ERR_CRC 1
+#define __SEG_GS 1
+#define __stub_setlogin 
+#define COMMPORT_TYPE_FD 1
+#define _POSIX_SPORADIC_SERVER -1
+#define __FLT128_HAS_INFINITY__ 1
+#define I2C_CH 0
+#define _GCC_WRAP_STDINT_H 
+#define __O_DSYNC 010000
+#define _IOC_NRSHIFT 0
+#define _POSIX_MEMORY_PROTECTION 200809L
+#define POSIX_FADV_NORMAL 0
+#define __DEC32_MIN__ 1E-95DF
+#define SCNiLEAST16 "hi"
+#define _IOC_SIZE(nr) (((nr) >> _IOC_SIZESHIFT) & _IOC_SIZEMASK)
+#define S_IFCHR __S_IFCHR
+#define true 1
+#define SCNiLEAST32 "i"
+#define __dev_t_defined 
+#define RELAY_PORT_PEERING 1
+#define _SC_XOPEN_CRYPT _SC_XOPEN_CRYPT
+#define _SC_RAW_SOCKETS _SC_RAW_SOCKETS
+#define __S32_TYPE int
+#define _SC_PHYS_PAGES _SC_PHYS_PAGES
+#define _POSIX2_LOCALEDEF __POSIX2_THIS_VERSION
+#define FD_MAX 16
+#define SYSEX_UART_DATA 0x05
+#define __DBL_MAX_EXP__ 1024
+#define IXON 0002000
+#define _SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER
+#define __WCHAR_WIDTH__ 32
+#define __BIT_TYPES_DEFINED__ 1
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define STATUS_DIGITAL_PIN_SET 0xC0
+#define _BITS_WCHAR_H 1
+#define __DEC128_EPSILON__ 1E-33DL
+#define _POSIX_TIMERS 200809L
+#define __FLT16_DECIMAL_DIG__ 5
+#define TAB0 0000000
+#define __SSE2_MATH__ 1
+#define __ATOMIC_HLE_RELEASE 131072
+#define CINTR CTRL('c')
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __HAVE_FLOAT16 0
+#define _SC_OPEN_MAX _SC_OPEN_MAX
+#define PRIo8 "o"
+#define SCNiLEAST64 __PRI64_PREFIX "i"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+#define SYSEX_PINCAPS_REQ 0x40
+#define TX_BUFFER_MASK ( TX_BUFFER_SIZE - 1 )
+#define _SC_STREAM_MAX _SC_STREAM_MAX
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+#define CEOF CTRL('d')
+#define __amd64 1
+#define CEOL _POSIX_VDISABLE
+#define __SYSCALL_WORDSIZE 64
+#define CEOT CEOF
+#define DEFAULT_BAUD 57600
+#define SCNdLEAST16 "hd"
+#define TYPE_BASE_LATENCY 45
+#define TIOCM_DSR 0x100
+#define STATUS_DIGITAL_PORT_SET 0xA0
+#define _SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO
+#define SCNdFAST16 __PRIPTR_PREFIX "d"
+#define TIMER8 0
+#define SIOCDELMULTI 0x8932
+#define _SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define _PTRDIFF_T_DECLARED 
+#define TIOCM_DTR 0x002
+#define TCGETX 0x5432
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __glibc_objsize(__o) __bos (__o)
+#define BIT_FLIP(p,m) ((p) ^= (m))
+#define PARODD 0001000
+#define SYSEX_SUB_VERSION_FIRMWARE_NAME 0
+#define COMMPORT_TYPE_1WIRE 3
+#define EPOLLRDBAND EPOLLRDBAND
+#define __ATOMIC_HLE_ACQUIRE 65536
+#define ERROR_UNKNOWN 0
+#define PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE
+#define _T_WCHAR 
+#define _PC_VDISABLE _PC_VDISABLE
+#define ERROR_TIMER_RESCHED_PAST 26
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+#define __SIZEOF_SIZE_T__ 8
+#define __GIT_REVPARSE__ 0xeb544d5
+#define _SC_BARRIERS _SC_BARRIERS
+#define _SC_XOPEN_LEGACY _SC_XOPEN_LEGACY
+#define TIOCGICOUNT 0x545D
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+#define _WCHAR_T 
+#define O_NONBLOCK 04000
+#define ERROR_BUTTONS_RETR_INVALID 54
+#define SCNiPTR __PRIPTR_PREFIX "i"
+#define st_atime st_atim.tv_sec
+#define PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }
+#define B500000 0010005
+#define VSUSP 10
+#define N_SLIP 1
+#define TCSADRAIN 1
+#define O_APPEND 02000
+#define PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+#define __CRC16_H 
+#define _CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS
+#define PRIu8 "u"
+#define __FLT64X_MIN_EXP__ (-16381)
+#define SIZE_MAX (18446744073709551615UL)
+#define __SIZEOF_WINT_T__ 4
+#define INT_LEAST16_MIN (-32767-1)
+#define PRIiLEAST32 "i"
+#define _SC_BASE _SC_BASE
+#define _SYS_EPOLL_H 1
+#define SCNdFAST64 __PRI64_PREFIX "d"
+#define EPOLL_CLOEXEC EPOLL_CLOEXEC
+#define TIOCSPGRP 0x5410
+#define __f32x(x) x ##f32x
+#define TCSETSW2 _IOW('T', 0x2C, struct termios2)
+#define TYPE_GPIO_SCHEDULE 24
+#define UINT64_C(c) c ## UL
+#define TYPE_DEBUG_READ 21
+#define __LONG_LONG_WIDTH__ 64
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+#define _SC_ADVISORY_INFO _SC_ADVISORY_INFO
+#define __U16_TYPE unsigned short int
+#define _POSIX2_C_VERSION __POSIX2_THIS_VERSION
+#define TIOCPKT_NOSTOP 16
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+#define __FLT32_MAX_EXP__ 128
+#define _SC_FIFO _SC_FIFO
+#define TIOCM_RI TIOCM_RNG
+#define pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_t __cancel_buf; void (*__cancel_routine) (void *) = (routine); void *__cancel_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {
+#define _SC_UIO_MAXIOV _SC_UIO_MAXIOV
+#define PRIiFAST8 "i"
+#define _MM_MASK_DENORM 0x0100
+#define UINTPTR_MAX (18446744073709551615UL)
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+#define PRIx8 "x"
+#define SCNd32 "d"
+#define _PTRDIFF_T 
+#define PRIiLEAST64 __PRI64_PREFIX "i"
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+#define _SC_PIPE _SC_PIPE
+#define _MMINTRIN_H_INCLUDED 
+#define ERROR_SPI_SETUP_INVALID 44
+#define __GXX_ABI_VERSION 1017
+#define __WTERMSIG(status) ((status) & 0x7f)
+#define PROTOCOL_ERR_NEED_CTRL 4
+#define _SC_PAGESIZE _SC_PAGESIZE
+#define _SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION
+#define __isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))
+#define SIOCGARP 0x8954
+#define F_UNLCK 2
+#define ECHOE 0000020
+#define __FLT_MIN_EXP__ (-125)
+#define CIBAUD 002003600000
+#define B1000000 0010010
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+#define _SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+#define __PROTOCOL_H 
+#define WEXITED 4
+#define _SC_2_C_VERSION _SC_2_C_VERSION
+#define _PC_LINK_MAX _PC_LINK_MAX
+#define INT64_MAX (__INT64_C(9223372036854775807))
+#define PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }
+#define _IOC_WRITE 1U
+#define __CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)
+#define OCRNL 0000010
+#define __S_IFREG 0100000
+#define _SC_NL_ARGMAX _SC_NL_ARGMAX
+#define MSG_TRAILER_SYNC 1
+#define B134 0000004
+#define UINT32_MAX (4294967295U)
+#define MSG_POS_COBS_CODE 0
+#define ERROR_PIN_IN_INVALID 29
+#define __uid_t_defined 
+#define _POSIX_SHELL 1
+#define WNOHANG 1
+#define alloca(size) __builtin_alloca (size)
+#define __INT16_MAX__ 0x7fff
+#define _XOPEN_SHM 1
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+#define SYSEX_SUB_I2C_ 0
+#define __x86_64 1
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+#define __PTRDIFF_T 
+#define _PC_SOCK_MAXBUF _PC_SOCK_MAXBUF
+#define _SC_WORD_BIT _SC_WORD_BIT
+#define _SC_ULONG_MAX _SC_ULONG_MAX
+#define EPOLLWAKEUP EPOLLWAKEUP
+#define TICKS_FREQ 1000000UL
+#define _BSD_SIZE_T_ 
+#define FASYNC O_ASYNC
+#define B150 0000005
+#define _SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE
+#define _POSIX_ADVISORY_INFO 200809L
+#define SYSEX_DEVICE_REQ 0x46
+#define F_GETFL 3
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+#define __INT_FAST64_TYPE__ long int
+#define PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED
+#define _SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX
+#define SYSEX_SUB_VERSION_LIBKNP 2
+#define TIOCSSERIAL 0x541F
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+#define SYSEX_MOD_ASYNC 0x7D
+#define SCNuLEAST8 "hhu"
+#define _ANSI_STDDEF_H 
+#define O_RSYNC O_SYNC
+#define IOCSIZE_SHIFT (_IOC_SIZESHIFT)
+#define TABDLY 0014000
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+#define SYSEX_SUB_RELAY_ROUTE_RESET 127
+#define UTILITY_FDTHREAD_LINUX_H 
+#define N_HDLC 13
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+#define PRIx16 "x"
+#define __key_t_defined 
+#define BENCH_VLQ_LOOPS 16
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+#define SIOCGIFFLAGS 0x8913
+#define TTYDEF_CFLAG (CREAD | CS7 | PARENB | HUPCL)
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+#define _XOPEN_XPG2 1
+#define _XOPEN_XPG3 1
+#define _XOPEN_XPG4 1
+#define PIN_MODE_ANALOG 5
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __SIZEOF_POINTER__ 8
+#define IMAXBEL 0020000
+#define _CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS
+#define CLOCK_REALTIME_COARSE 5
+#define SCNi64 __PRI64_PREFIX "i"
+#define __WCOREFLAG 0x80
+#define _XOPEN_LEGACY 1
+#define _CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS
+#define PRIx32 "x"
+#define FD_RING_SIZE 4096
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __O_DIRECTORY 0200000
+#define _SCHED_H 1
+#define STATUS_ANALOG_PIN_REPORT 0xD0
+#define __LP64__ 1
+#define UTIME_NOW ((1l << 30) - 1l)
+#define RELEASE_LIBKNP __GIT_REVPARSE__
+#define RELEASE_HAL __GIT_REVPARSE__
+#define __DBL_HAS_QUIET_NAN__ 1
+#define __HAVE_FLOAT32X 1
+#define _POSIX_IPV6 200809L
+#define __time_t_defined 1
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+#define st_ctime st_ctim.tv_sec
+#define __MODE_T_TYPE __U32_TYPE
+#define F_SETLKW64 7
+#define EOF (-1)
+#define TYPE_START 2
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+#define S_IFREG __S_IFREG
+#define __DECIMAL_BID_FORMAT__ 1
+#define __FLT64_MIN_EXP__ (-1021)
+#define ECHOCTL 0001000
+#define IGNPAR 0000004
+#define PRIx64 __PRI64_PREFIX "x"
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define O_DSYNC __O_DSYNC
+#define PIN_MODE_TOTAL 15
+#define INT_LEAST8_MAX (127)
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define _BITS_SETJMP_H 1
+#define MSG_POS_PAYLOAD 2
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+#define __VLQ_H 
+#define _m_pinsrw(A,D,N) _mm_insert_pi16(A, D, N)
+#define __CFLOAT64X _Complex _Float64x
+#define __FLT64_MIN_10_EXP__ (-307)
+#define B110 0000003
+#define __FDS_BITS(set) ((set)->__fds_bits)
+#define PROTOCOL_ERR_UNKNOWN 0
+#define SIOCSIFMETRIC 0x891e
+#define _IOR(type,nr,size) _IOC(_IOC_READ,(type),(nr),(_IOC_TYPECHECK(size)))
+#define __FLT16_MIN_10_EXP__ (-4)
+#define CS8 0000060
+#define _SC_BC_DIM_MAX _SC_BC_DIM_MAX
+#define _SC_FILE_LOCKING _SC_FILE_LOCKING
+#define __FLT64X_DECIMAL_DIG__ 21
+#define TIOCGRS485 0x542E
+#define __DEC128_MIN__ 1E-6143DL
+#define __REGISTER_PREFIX__ 
+#define __UINT16_MAX__ 0xffff
+#define __DBL_HAS_DENORM__ 1
+#define SYSEX_SUB_ONEWIRE_ 0
+#define INT_LEAST32_MAX (2147483647)
+#define F_WRLCK 1
+#define VTDLY 0040000
+#define SYSEX_SUB_SCHED_ADD 2
+#define _SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX
+#define SCNoFAST8 "hho"
+#define _PC_NAME_MAX _PC_NAME_MAX
+#define _IOC(dir,type,nr,size) (((dir) << _IOC_DIRSHIFT) | ((type) << _IOC_TYPESHIFT) | ((nr) << _IOC_NRSHIFT) | ((size) << _IOC_SIZESHIFT))
+#define ERROR_CMD_PARSE 5
+#define NOFLSH 0000200
+#define _CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS
+#define VT1 0040000
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+#define __LDBL_HAS_INFINITY__ 1
+#define _PC_MAX_CANON _PC_MAX_CANON
+#define CSTATUS _POSIX_VDISABLE
+#define TIOCGSERIAL 0x541E
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+#define EPOLLPRI EPOLLPRI
+#define ONOCR 0000020
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+#define __UINT8_TYPE__ unsigned char
+#define COMMPORT_ERROR_TOTAL 5
+#define TIOCM_RNG 0x080
+#define _SC_BC_BASE_MAX _SC_BC_BASE_MAX
+#define _SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC
+#define TYPE_SPI_TRANSFER 42
+#define __FLT_DIG__ 6
+#define SCNu8 "hhu"
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __NO_INLINE__ 1
+#define ERROR_I2C_OPEN_UNAVAIL 40
+#define PROTOCOL_SYSEX_FRAMING 5
+#define O_EXCL 0200
+#define _SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC
+#define ERROR_TCOUPLE_INVALID 53
+#define __DEC_EVAL_METHOD__ 2
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+#define _SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS
+#define SCNiMAX __PRI64_PREFIX "i"
+#define SIOCSIFMTU 0x8922
+#define __FLT_MANT_DIG__ 24
+#define __LDBL_DECIMAL_DIG__ 21
+#define INT_LEAST8_MIN (-128)
+#define _IOW(type,nr,size) _IOC(_IOC_WRITE,(type),(nr),(_IOC_TYPECHECK(size)))
+#define __VERSION__ "12.2.0"
+#define PIN_MODE_DEBOUNCE 10
+#define _PC_NO_TRUNC _PC_NO_TRUNC
+#define _SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX
+#define GPIO_PIN(port,pin) (((port) << 4) | (pin))
+#define ERROR_CHUNKS_FAIL 16
+#define CTRL(x) (x&037)
+#define PRIuPTR __PRIPTR_PREFIX "u"
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+#define __UINT64_C(c) c ## UL
+#define _SYS_TYPES_H 1
+#define _PTRDIFF_T_ 
+#define PRIXLEAST16 "X"
+#define _SYS_CDEFS_H 1
+#define PIN_MODE_SERVO 13
+#define ERROR_CMD_REQ 6
+#define SCNi16 "hi"
+#define IXOFF 0010000
+#define B115200 0010002
+#define _POSIX_VERSION 200809L
+#define _STDC_PREDEF_H 1
+#define INT_LEAST32_MIN (-2147483647-1)
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+#define SIG_DISCARD 1
+#define __USE_XOPEN2K8 1
+#define CERASE 0177
+#define _SC_NL_MSGMAX _SC_NL_MSGMAX
+#define htobe64(x) __bswap_64 (x)
+#define _SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX
+#define _PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define _SC_TIMERS _SC_TIMERS
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define PIN_IS_ANALOG(p) (0)
+#define _CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS
+#define st_mtime st_mtim.tv_sec
+#define O_RDWR 02
+#define __INT_LEAST32_MAX__ 0x7fffffff
+#define MSG_RX_BUFFER_SIZE (MSG_RX_RING_SIZE+MSG_MAX)
+#define SIOCGIFMAP 0x8970
+#define __STRING(x) #x
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+#define TYPE_BASE_MOVE_POOL 48
+#define _T_PTRDIFF_ 
+#define __F_GETOWN 9
+#define TYPE_GPIO_UPDATE 25
+#define _SC_NL_LANGMAX _SC_NL_LANGMAX
+#define __FLT128_MAX_EXP__ 16384
+#define PRIXLEAST64 __PRI64_PREFIX "X"
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define ERROR_OID_CANT_ASSIGN 10
+#define be16toh(x) __bswap_16 (x)
+#define __EPOLL_PACKED __attribute__ ((__packed__))
+#define BLOCK_SIZE 64
+#define SYSTEM_RESET_ZERO 0
+#define FD_BACKEND_EPOLL 0
+#define EPOLLRDNORM EPOLLRDNORM
+#define F_ULOCK 0
+#define __struct_tm_defined 1
+#define _SC_TRACE _SC_TRACE
+#define _SC_2_PBS_TRACK _SC_2_PBS_TRACK
+#define __ssize_t_defined 
+#define PRIuLEAST8 "u"
+#define TIOCMSET 0x5418
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+#define N_TTY 0
+#define _SC_FSYNC _SC_FSYNC
+#define __FLT32_MANT_DIG__ 24
+#define _SYS_SIZE_T_H 
+#define _HAVE_STRUCT_TERMIOS_C_OSPEED 1
+#define TCSETSF 0x5404
+#define PRIuLEAST16 "u"
+#define STATUS_CUSTOM_F6 0xF6
+#define TIOCPKT_START 8
+#define SYSEX_STRING_DATA 0x08
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define SIOCGIFBRDADDR 0x8919
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+#define _CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS
+#define _POSIX_THREAD_PROCESS_SHARED 200809L
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define _SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING
+#define STATUS_PIN_MODE 0x80
+#define SCNoPTR __PRIPTR_PREFIX "o"
+#define __S_IFDIR 0040000
+#define __SIZE_T__ 
+#define SIOCADDMULTI 0x8931
+#define _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS
+#define __FLT32X_MIN_EXP__ (-1021)
+#define __stub_gtty 
+#define _CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS
+#define _SC_2_LOCALEDEF _SC_2_LOCALEDEF
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define SIG_ATOMIC_MAX (2147483647)
+#define PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS
+#define IOCSIZE_MASK (_IOC_SIZEMASK << _IOC_SIZESHIFT)
+#define PIN_MODE_STEPPER 12
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+#define TYPE_BASE_GET_DYNMEM 49
+#define SYSEX_PREFPINS_DATA 0x00
+#define _MM_ROUND_UP 0x4000
+#define _SC_SHRT_MAX _SC_SHRT_MAX
+#define CMIN 1
+#define _SC_PII_OSI _SC_PII_OSI
+#define ISIG 0000001
+#define BSDLY 0020000
+#define _SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX
+#define INT32_MAX (2147483647)
+#define _SC_DEVICE_IO _SC_DEVICE_IO
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+#define _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS
+#define FFSYNC O_FSYNC
+#define _CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS
+#define ERROR_MISSED_PIN_EVENT 21
+#define _SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __wur 
+#define __S_IFMT 0170000
+#define _SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT
+#define UINT_FAST32_MAX (18446744073709551615UL)
+#define _PC_ASYNC_IO _PC_ASYNC_IO
+#define ERROR_PWM_MISSED_EVENT 35
+#define SIOCGIFSLAVE 0x8929
+#define B1800 0000012
+#define BITLONG(x) ((uint32_t)0x00000001 << (x))
+#define SIOCDEVPRIVATE 0x89F0
+#define __FLT128_HAS_DENORM__ 1
+#define F_SETFL 4
+#define N_SYNC_PPP 14
+#define OLCUC 0000002
+#define _SC_SSIZE_MAX _SC_SSIZE_MAX
+#define __FLT32_DECIMAL_DIG__ 9
+#define ERROR_TCOUPLE_ADC_OOR 52
+#define COMMPORT_ERROR_PARITY 3
+#define SIOCGIFENCAP 0x8925
+#define __FLT128_DIG__ 33
+#define SIOCSIFENCAP 0x8926
+#define __INT32_C(c) c
+#define SCNiLEAST8 "hhi"
+#define __DEC64_EPSILON__ 1E-15DD
+#define __ORDER_PDP_ENDIAN__ 3412
+#define __DEC128_MIN_EXP__ (-6142)
+#define __PDP_ENDIAN 3412
+#define _POSIX_MEMLOCK 200809L
+#define FFDLY 0100000
+#define PARMRK 0000010
+#define INT_FAST8_MIN (-128)
+#define B1152000 0010011
+#define ERROR_TCOUPLE_READ_FAIL 51
+#define _SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG
+#define TTYDEF_OFLAG (OPOST | ONLCR | XTABS)
+#define BYTE_ORDER __BYTE_ORDER
+#define _SC_MESSAGE_PASSING _SC_MESSAGE_PASSING
+#define _IOC_TYPEBITS 8
+#define __INT_FAST32_TYPE__ long int
+#define __have_pthread_attr_t 1
+#define SYSTEM_RESET_HALT 2
+#define CBRK CEOL
+#define _SYS_TTYDEFAULTS_H_ 
+#define _POSIX_CPUTIME 0
+#define bool _Bool
+#define PRIiLEAST8 "i"
+#define _BITS_TYPESIZES_H 1
+#define _SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT
+#define pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)
+#define __FIRMWARE_MCU_X86__ 1
+#define _SC_MULTI_PROCESS _SC_MULTI_PROCESS
+#define htole32(x) __uint32_identity (x)
+#define O_RDONLY 00
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define __UINT_LEAST16_TYPE__ short unsigned int
+#define _POSIX_THREAD_ATTR_STACKADDR 200809L
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+#define B50 0000001
+#define _mm_insert_epi16(A,D,N) ((__m128i) __builtin_ia32_vec_set_v8hi ((__v8hi)(__m128i)(A), (int)(D), (int)(N)))
+#define TICKTIME 1000
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+#define COMMPORT_TYPE_NULL 0
+#define RAND_MAX 2147483647
+#define PIN_MODE_SPI 9
+#define unix 1
+#define PROTOCOL_MAX_EVENT_BYTES 64
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+#define ERROR_PIN_PWM_INVALID 32
+#define TIOCSETD 0x5423
+#define F_SHLCK 8
+#define ROM 8000000UL
+#define _IOC_DIRBITS 2
+#define F_GETOWN __F_GETOWN
+#define F_SETLK F_SETLK64
+#define _SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX
+#define _SC_2_FORT_RUN _SC_2_FORT_RUN
+#define __THROWNL __attribute__ ((__nothrow__))
+#define POINTER_SIZE 64
+#define PULSE_SLOT_US 4
+#define __SIZE_TYPE__ long unsigned int
+#define __S_TYPEISSEM(buf) ((buf)->st_mode - (buf)->st_mode)
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+#define __ULONGWORD_TYPE unsigned long int
+#define _SIZE_T_DECLARED 
+#define UINT_LEAST16_MAX (65535)
+#define __FLT_IS_IEC_60559__ 2
+#define _POSIX_THREADS 200809L
+#define _SC_UCHAR_MAX _SC_UCHAR_MAX
+#define F_SETOWN __F_SETOWN
+#define ERROR_SENTINEL_TIMER 3
+#define PRIdLEAST8 "d"
+#define __O_TMPFILE (020000000 | __O_DIRECTORY)
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+#define __FLT64X_DIG__ 18
+#define _SC_SINGLE_PROCESS _SC_SINGLE_PROCESS
+#define _SC_USER_GROUPS _SC_USER_GROUPS
+#define _CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS
+#define __INT8_TYPE__ signed char
+#define TIOCGPKT _IOR('T', 0x38, int)
+#define _CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS
+#define SIOCDIFADDR 0x8936
+#define _SC_PRIORITIZED_IO _SC_PRIORITIZED_IO
+#define TCOOFF 0
+#define ERROR_NO_NEXT_STEP 23
+#define NLDLY 0000400
+#define __HAVE_DISTINCT_FLOAT128 1
+#define __ELF__ 1
+#define IXANY 0004000
+#define CLOCK_THREAD_CPUTIME_ID 3
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+#define __S_TYPEISSHM(buf) ((buf)->st_mode - (buf)->st_mode)
+#define _SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG
+#define _CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS
+#define __F_GETOWN_EX 16
+#define __UINT32_TYPE__ unsigned int
+#define __ILP32_OFFBIG_LDFLAGS "-m32"
+#define PRIxMAX __PRI64_PREFIX "x"
+#define _BITS_BYTESWAP_H 1
+#define TYPE_GPIO_SOFTPWM_CONFIG 27
+#define __ID_T_TYPE __U32_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define NL0 0000000
+#define CSIZE 0000060
+#define _MM_SHUFFLE(fp3,fp2,fp1,fp0) (((fp3) << 6) | ((fp2) << 4) | ((fp1) << 2) | (fp0))
+#define F_SETLK64 6
+#define NL1 0000400
+#define F_TLOCK 2
+#define _IOC_NRMASK ((1 << _IOC_NRBITS)-1)
+#define TIOCGPTLCK _IOR('T', 0x39, int)
+#define TIOCSERGETLSR 0x5459
+#define _CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define RX_BUFFER_MASK ( RX_BUFFER_SIZE - 1 )
+#define SIOCADDRT 0x890B
+#define __FLT_RADIX__ 2
+#define __INT_LEAST16_TYPE__ short int
+#define B38400 0000017
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+#define INTPTR_MAX (9223372036854775807L)
+#define __UINTMAX_C(c) c ## UL
+#define SYSEX_ONEWIRE_DATA 0x04
+#define O_SYNC 04010000
+#define _SC_RE_DUP_MAX _SC_RE_DUP_MAX
+#define _POSIX_C_SOURCE 200809L
+#define SCNdPTR __PRIPTR_PREFIX "d"
+#define PTHREAD_STACK_MIN 16384
+#define _mm_shufflelo_epi16(A,N) ((__m128i)__builtin_ia32_pshuflw ((__v8hi)(__m128i)(A), (int)(N)))
+#define _IOWR(type,nr,size) _IOC(_IOC_READ|_IOC_WRITE,(type),(nr),(_IOC_TYPECHECK(size)))
+#define _CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS
+#define __SSE_MATH__ 1
+#define _ALLOCA_H 1
+#define _SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC
+#define _PC_PIPE_BUF _PC_PIPE_BUF
+#define SCNxLEAST32 "x"
+#define TYPE_SPI_SEND 43
+#define ERROR_ALREADY_CLEARED 2
+#define __k8 1
+#define MSG_TX_BUFFER_SIZE (MSG_MAX+(MSG_MAX/2))
+#define SIOCSIFBR 0x8941
+#define FD_BACKEND_URING 1
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+#define _SC_XOPEN_XPG3 _SC_XOPEN_XPG3
+#define _SC_XOPEN_XPG4 _SC_XOPEN_XPG4
+#define __LDBL_REDIR(name,proto) name proto
+#define CLOCK_MONOTONIC_RAW 4
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+#define ERROR_NOT_SHUTDOWN 7
+#define _SC_FD_MGMT _SC_FD_MGMT
+#define F_TEST 3
+#define O_CLOEXEC __O_CLOEXEC
+#define __f32(x) x ##f32
+#define SIOCDARP 0x8953
+#define __blksize_t_defined 
+#define COMMPORT_ERROR_FRAME 1
+#define _MM_ROUND_DOWN 0x2000
+#define _SC_SELECT _SC_SELECT
+#define OFDEL 0000200
+#define IOC_OUT (_IOC_READ << _IOC_DIRSHIFT)
+#define _POSIX_TIMEOUTS 200809L
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+#define __USER_LABEL_PREFIX__ 
+#define _LFS64_LARGEFILE 1
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+#define __STDC_IEC_60559_BFP__ 201404L
+#define S_IRUSR __S_IREAD
+#define __WCHAR_MAX __WCHAR_MAX__
+#define _SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT
+#define TIOCGPTN _IOR('T', 0x30, unsigned int)
+#define TYPE_ADC_STATE 34
+#define __SIZEOF_PTRDIFF_T__ 8
+#define _LFS64_ASYNCHRONOUS_IO 1
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define SEEK_SET 0
+#define PRIu32 "u"
+#define _CS_V7_ENV _CS_V7_ENV
+#define _LFS64_STDIO 1
+#define _m_pextrw(A,N) _mm_extract_pi16(A, N)
+#define SCNu64 __PRI64_PREFIX "u"
+#define ERROR_PWM_ALREADY_PROG 34
+#define TCGETS2 _IOR('T', 0x2A, struct termios2)
+#define __f64(x) x ##f64
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+#define _MM_EXCEPT_DENORM 0x0002
+#define _BITS_STRUCT_STAT_H 1
+#define __stub_sigreturn 
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+#define _CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS
+#define CSTART CTRL('q')
+#define SCNx64 __PRI64_PREFIX "x"
+#define CLOCK_TAI 11
+#define TYPE_BASE_PROFILE 46
+#define __restrict_arr __restrict
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define ERROR_STEPPER_TOO_OLD 58
+#define __CFLOAT32X _Complex _Float32x
+#define INT8_C(c) c
+#define SYSEX_SUB_STRING_ 0
+#define _SC_SIGSTKSZ _SC_SIGSTKSZ
+#define _SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX
+#define PRIu64 __PRI64_PREFIX "u"
+#define S_IFDIR __S_IFDIR
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+#define __USE_MISC 1
+#define VT0 0000000
+#define __UWORD_TYPE unsigned long int
+#define __LDBL_DIG__ 18
+#define __S_IEXEC 0100
+#define _SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG
+#define TIOCSTI 0x5412
+#define W_OK 2
+#define _POSIX_ASYNCHRONOUS_IO 200809L
+#define __FLT64_IS_IEC_60559__ 2
+#define __x86_64__ 1
+#define _SIZE_T_ 
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+#define CBAUD 000000010017
+#define __FLT16_IS_IEC_60559__ 2
+#define __FLT16_MAX_EXP__ 16
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+#define HAL_DEFINES_H 
+#define HAL_H 
+#define O_CREAT 0100
+#define __S_IWRITE 0200
+#define _WCHAR_T_H 
+#define _SC_SAVED_IDS _SC_SAVED_IDS
+#define PRIiLEAST16 "i"
+#define SIOCGIFMEM 0x891f
+#define PRIxLEAST16 "x"
+#define SIOCPROTOPRIVATE 0x89E0
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+#define __stub_revoke 
+#define __timer_t_defined 1
+#define __WCLONE 0x80000000
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS
+#define _CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS
+#define _MM_MASK_OVERFLOW 0x0400
+#define TIOCSERCONFIG 0x5453
+#define BENCH_VLQ_INTS (1UL << 20)
+#define _POSIX_MONOTONIC_CLOCK 0
+#define __GCC_CONSTRUCTIVE_SIZE 64
+#define PULSE_RT_PRIO 80
+#define TIMER32 3
+#define EPOLLOUT EPOLLOUT
+#define PRIxLEAST32 "x"
+#define _SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING
+#define __WCHAR_MIN __WCHAR_MIN__
+#define __FLT64_DIG__ 15
+#define S_ISVTX __S_ISVTX
+#define _SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+#define TYPE_SPI_CONFIG_NOCS 40
+#define RELAY_EVENT_MAX ((PROTOCOL_MAX_EVENT_BYTES - PROTOCOL_SYSEX_FRAMING) / 2 - 6)
+#define __CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))
+#define __UINT_LEAST64_TYPE__ long unsigned int
+#define _SC_SEMAPHORES _SC_SEMAPHORES
+#define NULL ((void *)0)
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+#define SIOCSIFSLAVE 0x8930
+#define __U64_TYPE unsigned long int
+#define _MM_EXCEPT_INEXACT 0x0020
+#define __FLT_HAS_QUIET_NAN__ 1
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+#define _SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR
+#define _SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM
+#define INT32_C(c) c
+#define _POSIX_TRACE_INHERIT -1
+#define __FLT_MAX_10_EXP__ 38
+#define ONLCR 0000004
+#define _____fpos64_t_defined 1
+#define TIOCGDEV _IOR('T', 0x32, unsigned int)
+#define POSIX_FADV_NOREUSE __POSIX_FADV_NOREUSE
+#define MSG_SYNC 0x7E
+#define _PTY_H 1
+#define _SC_HOST_NAME_MAX _SC_HOST_NAME_MAX
+#define F_DUPFD_CLOEXEC 1030
+#define __glibc_c99_flexarr_available 1
+#define __LONG_MAX__ 0x7fffffffffffffffL
+#define PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE
+#define __WCHAR_T__ 
+#define __FLT64X_HAS_DENORM__ 1
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+#define _PC_SYNC_IO _PC_SYNC_IO
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define _CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS
+#define _SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX
+#define __FLT_HAS_INFINITY__ 1
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+#define TCSETA 0x5406
+#define SYSEX_SUB_VERSION_FIRMWARE_VER 1
+#define PRIxLEAST64 __PRI64_PREFIX "x"
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+#define TCSETS 0x5402
+#define TCSETX 0x5433
+#define VREPRINT 12
+#define PRIxFAST16 __PRIPTR_PREFIX "x"
+#define L_INCR SEEK_CUR
+#define _BSD_PTRDIFF_T_ 
+#define _BITS_PTHREADTYPES_COMMON_H 1
+#define PRIXPTR __PRIPTR_PREFIX "X"
+#define ERROR_BUTTONS_MAX 56
+#define SCNo16 "ho"
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+#define __UINT_FAST16_TYPE__ long unsigned int
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+#define __DEC64_MAX__ 9.999999999999999E384DD
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+#define __INT_FAST32_WIDTH__ 64
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+#define _POSIX_RAW_SOCKETS 200809L
+#define __CHAR16_TYPE__ short unsigned int
+#define __PRAGMA_REDEFINE_EXTNAME 1
+#define BIG_ENDIAN __BIG_ENDIAN
+#define TCSETAW 0x5407
+#define OFILL 0000100
+#define _STRINGS_H 1
+#define SYSEX_SUB_VERSION_DEFINES 7
+#define PRIX32 "X"
+#define __SIZE_WIDTH__ 64
+#define CFLUSH CDISCARD
+#define ECHOPRT 0002000
+#define __SEG_FS 1
+#define __INT_LEAST16_MAX__ 0x7fff
+#define CKILL CTRL('u')
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define TYPE_I2C_MODBITS 36
+#define __LP64_OFF64_LDFLAGS "-m64"
+#define __DEC64_MANT_DIG__ 16
+#define B200 0000006
+#define __INT64_MAX__ 0x7fffffffffffffffL
+#define _BITS_ENDIAN_H 1
+#define _SC_SS_REPL_MAX _SC_SS_REPL_MAX
+#define PTRDIFF_MAX (9223372036854775807L)
+#define _PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+#define EXTB B38400
+#define __SIG_ATOMIC_WIDTH__ 32
+#define _SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX
+#define PRIxFAST64 __PRI64_PREFIX "x"
+#define _SC_TRACE_LOG _SC_TRACE_LOG
+#define __INT_LEAST64_TYPE__ long int
+#define WATCHDOG 1
+#define htole16(x) __uint16_identity (x)
+#define B57600 0010001
+#define __INT16_TYPE__ short int
+#define __INT_LEAST8_TYPE__ signed char
+#define BENCHES_NO (sizeof(benches)/sizeof(bench_t))
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define IGNBRK 0000001
+#define __STDC_VERSION__ 201710L
+#define __CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension__ ({ cpu_set_t *__dest = (destset); const __cpu_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))
+#define __SIZEOF_INT__ 4
+#define SIOCSIFMEM 0x8920
+#define ICANON 0000002
+#define SYSEX_RCSWITCH_OUT 0x49
+#define __DEC32_MAX_EXP__ 97
+#define TIOCSERSWILD 0x5455
+#define TIMER_ABSTIME 1
+#define GPIO_ATOMIC_MAX GPIO_PIN(0x40,0)
+#define UTILITY_MACROS_H 
+#define __INT_FAST8_MAX__ 0x7f
+#define ADC_CH 0
+#define __PMT(args) args
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+#define TYPE_BASE_GET_UPTIME 12
+#define FF0 0000000
+#define WTERMSIG(status) __WTERMSIG (status)
+#define FF1 0100000
+#define _SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE
+#define SIOCGIFMTU 0x8921
+#define linux 1
+#define _SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX
+#define ERROR_I2C_WRITE_UNAVAIL 41
+#define _SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE
+#define _SC_THREAD_CPUTIME _SC_THREAD_CPUTIME
+#define TIOCPKT_FLUSHREAD 1
+#define CLOCK_MONOTONIC 1
+#define STATUS_SYSTEM_RESET 0xFC
+#define TYPE_BASE_HIST 47
+#define SCNdMAX __PRI64_PREFIX "d"
+#define PIN_TOTAL 0
+#define __FLT64_HAS_QUIET_NAN__ 1
+#define ERROR_INVALID_MOVE_SIZE 14
+#define ____FILE_defined 1
+#define N_HCI 15
+#define _IOLBF 1
+#define PDP_ENDIAN __PDP_ENDIAN
+#define htole64(x) __uint64_identity (x)
+#define _POSIX_THREAD_ROBUST_PRIO_PROTECT -1
+#define F_GETLK64 5
+#define _POSIX_SAVED_IDS 1
+#define SYSEX_SUB_DIGITAL_DATA_ 0
+#define SYSTEM_RESET_REBOOT 1
+#define F_SETLKW F_SETLKW64
+#define SIOCGIFDSTADDR 0x8917
+#define __USE_POSIX2 1
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define TYPE_BASE_CLEAR_SHUTDOWN 14
+#define L_XTND SEEK_END
+#define SCNuFAST32 __PRIPTR_PREFIX "u"
+#define _SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE
+#define __FLT32_MIN_10_EXP__ (-37)
+#define __KEY_T_TYPE __S32_TYPE
+#define FAPPEND O_APPEND
+#define __F_SETSIG 10
+#define __COBS_H 
+#define __FLT32X_DIG__ 15
+#define _CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION
+#define TYPE_SHUTDOWN_LAST 6
+#define SCNuFAST16 __PRIPTR_PREFIX "u"
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+#define __WORDSIZE 64
+#define SCNoMAX __PRI64_PREFIX "o"
+#define TIOCVHANGUP 0x5437
+#define TIOCSSOFTCAR 0x541A
+#define __PTRDIFF_WIDTH__ 64
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+#define __BEGIN_DECLS 
+#define _SC_PII_XTI _SC_PII_XTI
+#define __LDBL_MANT_DIG__ 64
+#define _PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE
+#define SYSEX_SUB_VERSION_ARCH 6
+#define __OPEN_NEEDS_MODE(oflag) (((oflag) & O_CREAT) != 0 || ((oflag) & __O_TMPFILE) == __O_TMPFILE)
+#define _mm_shuffle_pd(A,B,N) ((__m128d)__builtin_ia32_shufpd ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(N)))
+#define CRTSCTS 020000000000
+#define SIOCSRARP 0x8962
+#define SCNuFAST64 __PRI64_PREFIX "u"
+#define __FLT64_HAS_INFINITY__ 1
+#define PWM_CH 0
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __FLT16_HAS_INFINITY__ 1
+#define _SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE
+#define false 0
+#define EXTPROC 0200000
+#define _SC_FILE_SYSTEM _SC_FILE_SYSTEM
+#define _STRING_H 1
+#define __GNUC_VA_LIST 
+#define _GCC_MAX_ALIGN_T 
+#define TYPE_NO 50
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+#define BENCH_FD_MS 500
+#define __code_model_small__ 1
+#define _SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX
+#define AT_SYMLINK_NOFOLLOW 0x100
+#define _SYS_IOCTL_H 1
+#define _XOPEN_REALTIME 1
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+#define COMMPORT_TYPE_I2C 5
+#define __DEC32_MANT_DIG__ 7
+#define le64toh(x) __uint64_identity (x)
+#define EPOLLHUP EPOLLHUP
+#define FILENAME_MAX 4096
+#define _SC_NL_TEXTMAX _SC_NL_TEXTMAX
+#define __FLT16_MANT_DIG__ 11
+#define ERROR_I2C_TIMEOUT 38
+#define __ino_t_defined 
+#define _SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS
+#define __k8__ 1
+#define __INTPTR_TYPE__ long int
+#define __UINT16_TYPE__ short unsigned int
+#define __WCHAR_TYPE__ int
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __SLONGWORD_TYPE long int
+#define NCCS 32
+#define _LINUX_IOCTL_H 
+#define _SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N
+#define __FIRMWARE_ARCH_LINUX__ 1
+#define PRIiPTR __PRIPTR_PREFIX "i"
+#define PRIoMAX __PRI64_PREFIX "o"
+#define _POSIX_MEMLOCK_RANGE 200809L
+#define SYSEX_SPI_DATA 0x07
+#define TYPE_NOOP 1
+#define TYPE_GPIO_CONFIG 23
+#define __pic__ 2
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+#define SCNoLEAST64 __PRI64_PREFIX "o"
+#define SYSEX_PINMAP_REP 0x43
+#define SYSEX_PINMAP_REQ 0x42
+#define SCNoLEAST32 "o"
+#define COMMPORT_TYPE_PIN 2
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+#define __S_IFLNK 0120000
+#define __INT_FAST64_WIDTH__ 64
+#define BRKINT 0000002
+#define __stub_chflags 
+#define SCNxPTR __PRIPTR_PREFIX "x"
+#define CLOCK_BOOTTIME 7
+#define __UQUAD_TYPE unsigned long int
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define TIOCPKT_STOP 4
+#define SIOCGIFINDEX 0x8933
+#define __BYTE_ORDER __LITTLE_ENDIAN
+#define EPOLL_CTL_MOD 3
+#define TCSETSW 0x5403
+#define __O_DIRECT 040000
+#define __USE_POSIX 1
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+#define TYPE_I2C_READ 37
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+#define RELEASE_DEFINES __GIT_REVPARSE__
+#define __LITTLE_ENDIAN 1234
+#define BUFSIZ 8192
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+#define TYPE_BASE_IDENTIFY 7
+#define __FLT32_HAS_INFINITY__ 1
+#define PROTOCOL_ERR_START 5
+#define INT_FAST32_MAX (9223372036854775807L)
+#define COMMPORT_TYPE_SPI 6
+#define _SC_NL_SETMAX _SC_NL_SETMAX
+#define __FLT64X_MAX_EXP__ 16384
+#define _IOC_TYPESHIFT (_IOC_NRSHIFT+_IOC_NRBITS)
+#define _WCHAR_T_DECLARED 
+#define __UINT_FAST64_TYPE__ long unsigned int
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+#define _POSIX2_CHAR_TERM 200809L
+#define WNOWAIT 0x01000000
+#define TIOCSPTLCK _IOW('T', 0x31, int)
+#define PRIXFAST8 "X"
+#define RELAY_ROUTES_MAX 16
+#define EXIT_SUCCESS 0
+#define ERROR_I2C_READ_UNAVAIL 42
+#define __LDBL_REDIR_DECL(name) 
+#define _SC_2_PBS _SC_2_PBS
+#define ERROR_SPI_IOCTL_UNAVAIL 45
+#define __INT_MAX__ 0x7fffffff
+#define S_IXUSR __S_IEXEC
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+#define _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS
+#define F_GETFD 1
+#define SYSEX_SUB_UART_ 0
+#define STATUS_SYSEX_END 0xFE
+#define _FCNTL_H 1
+#define _mm_bslli_si128(A,N) ((__m128i)__builtin_ia32_pslldqi128 ((__m128i)(A), (int)(N) * 8))
+#define __linux__ 1
+#define STDIN_FILENO 0
+#define S_IWOTH (S_IWGRP >> 3)
+#define UINT8_MAX (255)
+#define HUPCL 0002000
+#define ERROR_MOVE_Q_EMPTY 15
+#define __ILP32_OFF32_LDFLAGS "-m32"
+#define __S16_TYPE short int
+#define RELAY_PORT_UPSTREAM 0
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define TCSETXF 0x5434
+#define __itimerspec_defined 1
+#define _T_SIZE_ 
+#define __TIMESIZE __WORDSIZE
+#define SYSEX_PINGROUPS_DATA 0x01
+#define __CPU_SETSIZE 1024
+#define _POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L
+#define UINT_FAST8_MAX (255)
+#define INT16_C(c) c
+#define SCNoFAST32 __PRIPTR_PREFIX "o"
+#define __WNOTHREAD 0x20000000
+#define __INT64_TYPE__ long int
+#define _TERMIOS_H 1
+#define TCIOFF 2
+#define __FLT_MAX_EXP__ 128
+#define SIOCGIFNETMASK 0x891b
+#define CLOCK_PROCESS_CPUTIME_ID 2
+#define __POSIX_FADV_DONTNEED 4
+#define B600 0000010
+#define VERASE 2
+#define _SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __gid_t_defined 
+#define S_IRGRP (S_IRUSR >> 3)
+#define UINT32_C(c) c ## U
+#define TIOCPKT 0x5420
+#define RAM 8000000UL
+#define __ORDER_BIG_ENDIAN__ 4321
+#define TTYDEF_LFLAG (ECHO | ICANON | ISIG | IEXTEN | ECHOE|ECHOKE|ECHOCTL)
+#define _SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING
+#define _SC_REGEX_VERSION _SC_REGEX_VERSION
+#define __ptr_t void *
+#define __DBL_MANT_DIG__ 53
+#define ___int_size_t_h 
+#define __TIMER_T_TYPE void *
+#define _POSIX_REALTIME_SIGNALS 200809L
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+#define CCEQ(val,c) ((c) == (val) && (val) != _POSIX_VDISABLE)
+#define LIBKNP_H 
+#define __SIZEOF_FLOAT128__ 16
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+#define _POSIX_TRACE -1
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+#define __clock_t_defined 1
+#define ERROR_SPI_DEV_UNAVAIL 48
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+#define __GLIBC_MINOR__ 36
+#define __DEC64_MIN__ 1E-383DD
+#define __WINT_TYPE__ unsigned int
+#define __UINT_LEAST32_TYPE__ unsigned int
+#define _POSIX_FSYNC 200809L
+#define __SIZEOF_SHORT__ 2
+#define SIOCSIFNAME 0x8923
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define __SSE__ 1
+#define VEOL2 16
+#define VLQ_MAX_BYTES 5
+#define __sigset_t_defined 1
+#define __intptr_t_defined 
+#define _SC_AVPHYS_PAGES _SC_AVPHYS_PAGES
+#define __LDBL_MIN_EXP__ (-16381)
+#define _mm_slli_si128(A,N) ((__m128i)__builtin_ia32_pslldqi128 ((__m128i)(A), (int)(N) * 8))
+#define _CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS
+#define _BITS_STDINT_UINTN_H 1
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define _POSIX_VDISABLE '\0'
+#define FD_SETSIZE __FD_SETSIZE
+#define _SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32
+#define SCNu32 "u"
+#define stdout stdout
+#define __amd64__ 1
+#define _SC_SIGNALS _SC_SIGNALS
+#define __WINT_WIDTH__ 32
+#define __struct_FILE_defined 1
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+#define _POSIX_THREAD_PRIO_INHERIT 200809L
+#define __INT_LEAST8_MAX__ 0x7f
+#define TYPE_ACK 3
+#define __USE_POSIX199309 1
+#define __INT_LEAST64_WIDTH__ 64
+#define __LDBL_MAX_EXP__ 16384
+#define _IOC_READ 2U
+#define __FLT32X_MAX_10_EXP__ 308
+#define SIOCRTMSG 0x890D
+#define FIOCLEX 0x5451
+#define ____mbstate_t_defined 1
+#define VQUIT 1
+#define TIOCM_CD TIOCM_CAR
+#define sched_priority sched_priority
+#define N_MOUSE 2
+#define __SIZEOF_INT128__ 16
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+#define _CS_LFS64_CFLAGS _CS_LFS64_CFLAGS
+#define PRIXLEAST32 "X"
+#define __FLT64X_IS_IEC_60559__ 2
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __LDBL_MAX_10_EXP__ 4932
+#define _POSIX_SEMAPHORES 200809L
+#define TYPE_BASE_STATS 15
+#define __ATOMIC_RELAXED 0
+#define TIOCOUTQ 0x5411
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define _CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS
+#define CRDLY 0003000
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+#define _SC_ATEXIT_MAX _SC_ATEXIT_MAX
+#define __stub_stty 
+#define _SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+#define le16toh(x) __uint16_identity (x)
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+#define _SIZET_ 
+#define _PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN
+#define POSIX_FADV_DONTNEED __POSIX_FADV_DONTNEED
+#define _LP64 1
+#define ERROR_ALREADY_FINAL 12
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+#define EPOLLET EPOLLET
+#define __UINT8_C(c) c
+#define _BITS_STDINT_INTN_H 1
+#define SCNoFAST16 __PRIPTR_PREFIX "o"
+#define __FLT64_MAX_EXP__ 1024
+#define TIOCPKT_DATA 0
+#define B2000000 0010013
+#define __S_IFSOCK 0140000
+#define _CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS
+#define __INT_LEAST32_TYPE__ int
+#define CWERASE CTRL('w')
+#define _MM_ROUND_MASK 0x6000
+#define _SC_PII_INTERNET _SC_PII_INTERNET
+#define _SC_REGEXP _SC_REGEXP
+#define _LFS_LARGEFILE 1
+#define SIOCDRARP 0x8960
+#define __wchar_t__ 
+#define SCNxFAST32 __PRIPTR_PREFIX "x"
+#define SIOCGIFCONF 0x8912
+#define SEEK_END 2
+#define __SIZEOF_WCHAR_T__ 4
+#define __USE_POSIX_IMPLICITLY 1
+#define __UINT64_TYPE__ long unsigned int
+#define _PTHREAD_H 1
+#define __GNUC_PATCHLEVEL__ 0
+#define SCNiFAST16 __PRIPTR_PREFIX "i"
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+#define __ILP32_OFF32_CFLAGS "-m32"
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define _SC_IOV_MAX _SC_IOV_MAX
+#define TYPE_PWM_SET 31
+#define _SC_PASS_MAX _SC_PASS_MAX
+#define __PRI64_PREFIX "l"
+#define B19200 0000016
+#define _STDDEF_H_ 
+#define _XOPEN_UNIX 1
+#define ONLRET 0000040
+#define TYPE_BASE_GET_CONFIG 9
+#define B4800 0000014
+#define __stub___compat_bdflush 
+#define SCNiFAST32 __PRIPTR_PREFIX "i"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define __FLT128_HAS_QUIET_NAN__ 1
+#define O_TRUNC 01000
+#define TCSBRK 0x5409
+#define TYPE_DEBUG_PING 20
+#define _CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+#define _SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX
+#define PRIoFAST32 __PRIPTR_PREFIX "o"
+#define TIOCSERGWILD 0x5454
+#define _SC_MAPPED_FILES _SC_MAPPED_FILES
+#define BENCH_COBS_LOOPS 64
+#define __INT_FAST8_TYPE__ signed char
+#define _IOC_DIRSHIFT (_IOC_SIZESHIFT+_IOC_SIZEBITS)
+#define PRIiMAX __PRI64_PREFIX "i"
+#define __PID_T_TYPE __S32_TYPE
+#define TIOCM_LE 0x001
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+#define _SC_AIO_MAX _SC_AIO_MAX
+#define O_WRONLY 01
+#define _SC_JOB_CONTROL _SC_JOB_CONTROL
+#define S_ISGID __S_ISGID
+#define ECHOK 0000040
+#define _THREAD_SHARED_TYPES_H 1
+#define SYSEX_SUB_SCHED_RESET 127
+#define AT_REMOVEDIR 0x200
+#define SCNiFAST64 __PRI64_PREFIX "i"
+#define __GLIBC_USE_ISOC2X 0
+#define __f128(x) x ##f128
+#define __glibc_has_extension(ext) 0
+#define SYSEX_SUB_SCHED_LIST_REP 6
+#define PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE
+#define _IOC_DIR(nr) (((nr) >> _IOC_DIRSHIFT) & _IOC_DIRMASK)
+#define __GNUC_STDC_INLINE__ 1
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+#define _mm_insert_pi16(A,D,N) ((__m64) __builtin_ia32_vec_set_v4hi ((__v4hi)(__m64)(A), (int)(D), (int)(N)))
+#define P_tmpdir "/tmp"
+#define __attribute_pure__ __attribute__ ((__pure__))
+#define __FLT64_HAS_DENORM__ 1
+#define _POSIX_MESSAGE_PASSING 200809L
+#define PROTOCOL_ENCODING_NORMAL 1
+#define EPOLLRDHUP EPOLLRDHUP
+#define __HAVE_FLOAT32 1
+#define _MM_FLUSH_ZERO_ON 0x8000
+#define STATUS_DIGITAL_PORT_REPORT 0x90
+#define __WORDSIZE_TIME64_COMPAT32 1
+#define SYSEX_PINCAPS_REP 0x41
+#define __HAVE_DISTINCT_FLOAT32 0
+#define PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+#define BENCH_RING_SIZE 4096
+#define _MM_EXCEPT_INVALID 0x0001
+#define R_OK 4
+#define CSUSP CTRL('z')
+#define PTHREAD_ONCE_INIT 0
+#define __FLT16_HAS_DENORM__ 1
+#define _BITS_TYPES___LOCALE_T_H 1
+#define __DBL_DECIMAL_DIG__ 17
+#define __STDC_UTF_32__ 1
+#define _BITS_STDIO_LIM_H 1
+#define __INT_FAST8_WIDTH__ 8
+#define __FXSR__ 1
+#define TYPE_NACK 4
+#define TIOCPKT_DOSTOP 32
+#define _SIZE_T 
+#define _POSIX2_VERSION __POSIX2_THIS_VERSION
+#define ICRNL 0000400
+#define _IO_ERR_SEEN 0x0020
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+#define _MM_MASK_UNDERFLOW 0x0800
+#define __ULONG32_TYPE unsigned int
+#define TIOCSERSETMULTI 0x545B
+#define STATUS_CUSTOM_F5 0xF5
+#define STATUS_CUSTOM_F7 0xF7
+#define STATUS_CUSTOM_F8 0xF8
+#define SCNuPTR __PRIPTR_PREFIX "u"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define _BITS_CPU_SET_H 1
+#define UTIME_OMIT ((1l << 30) - 2l)
+#define PIN_MODE_UNUSED 0
+#define FOPEN_MAX 16
+#define _WMMINTRIN_H_INCLUDED 
+#define __BIG_ENDIAN 4321
+#define __S_TYPEISMQ(buf) ((buf)->st_mode - (buf)->st_mode)
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define __suseconds_t_defined 
+#define _IOC_NRBITS 8
+#define F_EXLCK 4
+#define __off_t_defined 
+#define SYSEX_SUB_SCHED_SCHEDULE 4
+#define ONEWIRE_CH 0
+#define __GCC_DESTRUCTIVE_SIZE 64
+#define _SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC
+#define _BITS_TYPES_STRUCT_SCHED_PARAM 1
+#define PRIdFAST16 __PRIPTR_PREFIX "d"
+#define TCGETA 0x5405
+#define TIOCM_SR 0x010
+#define _STRUCT_TIMESPEC 1
+#define TIOCM_ST 0x008
+#define __INTMAX_WIDTH__ 64
+#define ERROR_TMCUART_LARGE_DATA 59
+#define SCNxFAST64 __PRI64_PREFIX "x"
+#define RELEASE_BOARD __GIT_REVPARSE__
+#define _POSIX_REENTRANT_FUNCTIONS 1
+#define B921600 0010007
+#define _SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC
+#define __mode_t_defined 
+#define __CPU_ALLOC(count) __sched_cpualloc (count)
+#define _GCC_SIZE_T 
+#define _POSIX_THREAD_PRIO_PROTECT 200809L
+#define RELAY_NODE_HOST 0
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define TIOCINQ FIONREAD
+#define SYSEX_SUB_FEATURES_TOTAL 1
+#define __W_CONTINUED 0xffff
+#define L_SET SEEK_SET
+#define TOSTOP 0000400
+#define _IOC_SIZEBITS 14
+#define __UINT32_C(c) c ## U
+#define PRIdFAST32 __PRIPTR_PREFIX "d"
+#define COMMPORT_TYPE_TOTAL 7
+#define B75 0000002
+#define _SC_INT_MAX _SC_INT_MAX
+#define __size_t__ 
+#define SYSEX_SUB_SCHED_DELAY 3
+#define BENCH_FD_CHANNELS 8
+#define B3500000 0010016
+#define SYSEX_SCHEDULER_DATA 0x09
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+#define PRIoPTR __PRIPTR_PREFIX "o"
+#define _BITS_TIME64_H 1
+#define _CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS
+#define _ENDIAN_H 1
+#define ERROR_MSG_ENC 4
+#define _GETOPT_POSIX_H 1
+#define __TIME64_T_TYPE __TIME_T_TYPE
+#define __glibc_has_builtin(name) __has_builtin (name)
+#define TIOCMBIS 0x5416
+#define _LFS_ASYNCHRONOUS_IO 1
+#define __ONCE_FLAG_INIT { 0 }
+#define _SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+#define _SC_TRACE_INHERIT _SC_TRACE_INHERIT
+#define B4000000 0010017
+#define _CS_LFS64_LIBS _CS_LFS64_LIBS
+#define MSG_DEST 0x10
+#define CRC16_HAVE_CLMUL 1
+#define __INT8_MAX__ 0x7f
+#define __LONG_WIDTH__ 64
+#define AT_FDCWD -100
+#define SIOCGRARP 0x8961
+#define SYSEX_VERSION 0x20
+#define __PIC__ 2
+#define TCGETS 0x5401
+#define SYSEX_FEATURES 0x21
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+#define _CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS
+#define PRIdFAST64 __PRI64_PREFIX "d"
+#define __UINT_FAST32_TYPE__ long unsigned int
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define O_NOFOLLOW __O_NOFOLLOW
+#define __PRIPTR_PREFIX "l"
+#define BENCH_PULSE_FRAMES 200
+#define PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define __POSIX_FADV_NOREUSE 5
+#define PRIXMAX __PRI64_PREFIX "X"
+#define __CHAR32_TYPE__ unsigned int
+#define PIN_MODE_INPUT 2
+#define _CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS
+#define TIOCCONS 0x541D
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+#define MAX(a,b) ({ __typeof__ (a) _a = (a); __typeof__ (b) _b = (b); _a > _b ? _a : _b; })
+#define BENCH_FD_MSG 64
+#define WINT_MIN (0u)
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+#define __GLIBC_USE_IEC_60559_EXT 0
+#define __fsfilcnt_t_defined 
+#define __blkcnt_t_defined 
+#define __HAVE_FLOAT128 1
+#define ERROR_INVALID_CMD 13
+#define FD_TYPE_TTY 2
+#define FIONREAD 0x541B
+#define _IO(type,nr) _IOC(_IOC_NONE,(type),(nr),0)
+#define UINT_LEAST32_MAX (4294967295U)
+#define CDSUSP CTRL('y')
+#define _SC_2_PBS_LOCATE _SC_2_PBS_LOCATE
+#define SCNxLEAST8 "hhx"
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+#define UINTMAX_C(c) c ## UL
+#define PROTOCOL_ENCODING_COMPAT 2
+#define __SSE2__ 1
+#define _SC_2_FORT_DEV _SC_2_FORT_DEV
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS
+#define _MM_MASK_INVALID 0x0080
+#define __INT32_TYPE__ int
+#define PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE
+#define _SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX
+#define __SIZEOF_DOUBLE__ 8
+#define __FLT_MIN_10_EXP__ (-37)
+#define _mm_shuffle_epi32(A,N) ((__m128i)__builtin_ia32_pshufd ((__v4si)(__m128i)(A), (int)(N)))
+#define SIOCGIFNAME 0x8910
+#define _SC_INT_MIN _SC_INT_MIN
+#define TIOCGLCKTRMIOS 0x5456
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+#define __INT_LEAST32_WIDTH__ 32
+#define TCION 3
+#define TIOCGSOFTCAR 0x5419
+#define AT_EACCESS 0x200
+#define __SWORD_TYPE long int
+#define __INTMAX_TYPE__ long int
+#define MSG_HEADER_SIZE 2
+#define __CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))
+#define RELEASE_ARCH __GIT_REVPARSE__
+#define SIG_JITTER 0
+#define CBAUDEX 000000010000
+#define TIOCSCTTY 0x540E
+#define __DEC128_MAX_EXP__ 6145
+#define __CPU_FREE(cpuset) __sched_cpufree (cpuset)
+#define TIOCSER_TEMT 0x01
+#define _T_SIZE 
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define BIT_SET(p,m) ((p) |= (m))
+#define PRIdFAST8 "d"
+#define S_IRWXG (S_IRWXU >> 3)
+#define _CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS
+#define EPOLLERR EPOLLERR
+#define S_IXGRP (S_IXUSR >> 3)
+#define __FLT32X_HAS_QUIET_NAN__ 1
+#define _POSIX2_C_BIND __POSIX2_THIS_VERSION
+#define __ATOMIC_CONSUME 1
+#define _CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS
+#define __GNUC_MINOR__ 2
+#define __INT_FAST16_WIDTH__ 64
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+#define _SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define CSTOPB 0000100
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+#define __LDBL_REDIR2_DECL(name) 
+#define _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+#define INTMAX_C(c) c ## L
+#define __glibc_clang_prereq(maj,min) 0
+#define SIOCSIFLINK 0x8911
+#define __nlink_t_defined 
+#define POSIX_FADV_RANDOM 1
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define _POSIX2_C_DEV __POSIX2_THIS_VERSION
+#define SIOCSIFADDR 0x8916
+#define TIOCSWINSZ 0x5414
+#define SYSEX_SUB_SCHED_DELETE 1
+#define _STDINT_H 1
+#define ERROR_CLOSE_TIMER 25
+#define _RWLOCK_INTERNAL_H 
+#define __DBL_MAX_10_EXP__ 308
+#define __FILE_defined 1
+#define PIN_MODE_1WIRE 6
+#define UINT16_MAX (65535)
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+#define _CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS
+#define _CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS
+#define S_ISUID __S_ISUID
+#define _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS
+#define SYSEX_SUB_SPI_ 0
+#define TCFLSH 0x540B
+#define __CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))
+#define _POSIX_TRACE_LOG -1
+#define __INT16_C(c) c
+#define _MM_MASK_INEXACT 0x1000
+#define _SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS
+#define __U32_TYPE unsigned int
+#define _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS
+#define _SC_THREADS _SC_THREADS
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define ERROR_FORCE_SHUTDOWN 8
+#define _CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS
+#define N_R3964 9
+#define VSTART 8
+#define __STDC__ 1
+#define TTYDEF_SPEED (B9600)
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+#define TIOCGEXCL _IOR('T', 0x40, int)
+#define __PTRDIFF_TYPE__ long int
+#define TYPE_I2C_CONFIG 35
+#define TIOCMBIC 0x5417
+#define _mm_clmulepi64_si128(X,Y,I) ((__m128i) __builtin_ia32_pclmulqdq128 ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(I)))
+#define stdin stdin
+#define __clockid_t_defined 1
+#define TCSANOW 0
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+#define SCNoLEAST16 "ho"
+#define _BITS_STAT_H 1
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+#define __ATOMIC_SEQ_CST 5
+#define ERROR_SPI_CONFIG_INVALID 43
+#define N_PPP 3
+#define TYPE_PWM_CONFIG 29
+#define _SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT
+#define PRIdPTR __PRIPTR_PREFIX "d"
+#define TIOCMIWAIT 0x545C
+#define BIT(x) (0x01 << (x))
+#define _MM_SHUFFLE2(fp1,fp0) (((fp1) << 1) | (fp0))
+#define MSG_COBS_OVERHEAD ((MSG_MAX/254)+1)
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define _BITS_FLOATN_H 
+#define B300 0000007
+#define F_SETFD 2
+#define PROTOCOL_ENCODING_REPORT 127
+#define PROTOCOL_ERR_NEED_DATA 3
+#define __FLT32X_MIN_10_EXP__ (-307)
+#define SYSEX_SUB_RELAY_ROUTE_DEL 2
+#define PRId16 "d"
+#define FD_CLOEXEC 1
+#define PRIuFAST64 __PRI64_PREFIX "u"
+#define __UINTPTR_TYPE__ long unsigned int
+#define N_IRDA 11
+#define RX_BUFFER_SIZE 64
+#define SIOGIFINDEX SIOCGIFINDEX
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+#define _PC_2_SYMLINKS _PC_2_SYMLINKS
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __DEC128_MANT_DIG__ 34
+#define __LDBL_MIN_10_EXP__ (-4931)
+#define SYSEX_MOD_SYNC 0x7E
+#define __useconds_t_defined 
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define _SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+#define PRId32 "d"
+#define _SC_SPAWN _SC_SPAWN
+#define SYSEX_RELAY_DATA 0x0A
+#define _mm_srli_si128(A,N) ((__m128i)__builtin_ia32_psrldqi128 ((__m128i)(A), (int)(N) * 8))
+#define _SC_CHAR_MAX _SC_CHAR_MAX
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define SCNxLEAST16 "hx"
+#define __SIZEOF_LONG_LONG__ 8
+#define ERROR_INVALID_COUNT_PARAM 22
+#define PRIo16 "o"
+#define __USE_ATFILE 1
+#define BENCH_CRC_MSGS (1UL << 20)
+#define POSIX_FADV_SEQUENTIAL 2
+#define SIOCSARP 0x8955
+#define TYPE_SHUTDOWN_NOW 5
+#define _GCC_PTRDIFF_T 
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+#define __sched_priority sched_priority
+#define EPOLLONESHOT EPOLLONESHOT
+#define __O_PATH 010000000
+#define CLNEXT CTRL('v')
+#define __FLT128_DECIMAL_DIG__ 36
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+#define F_CPU 1000000000ULL
+#define TIOCNOTTY 0x5422
+#define _STDLIB_H 1
+#define PRId64 __PRI64_PREFIX "d"
+#define _SC_NZERO _SC_NZERO
+#define VINTR 0
+#define _GETOPT_CORE_H 1
+#define __FLT32_HAS_QUIET_NAN__ 1
+#define __FLT_DECIMAL_DIG__ 9
+#define ERROR_NEXT_PWM_EXTENDS 18
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define PRIo32 "o"
+#define S_IROTH (S_IRGRP >> 3)
+#define __CPUELT(cpu) ((cpu) / __NCPUBITS)
+#define _MM_EXCEPT_DIV_ZERO 0x0004
+#define STATUS_SYSTEM_PAUSE 0xFA
+#define _SC_STREAMS _SC_STREAMS
+#define __POSIX2_THIS_VERSION 200809L
+#define __WALL 0x40000000
+#define __ldiv_t_defined 1
+#define ___int_ptrdiff_t_h 
+#define EPOLLWRNORM EPOLLWRNORM
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define TCSETSF2 _IOW('T', 0x2D, struct termios2)
+#define UTILITY_PULSETHREAD_LINUX_H 
+#define X_OK 1
+#define CDISCARD CTRL('o')
+#define _MM_EXCEPT_MASK 0x003f
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define SIOCSIFTXQLEN 0x8943
+#define PROTOCOL_ENCODING_UNKNOWN 0
+#define CLOCK_MONOTONIC_COARSE 6
+#define _SC_CHAR_BIT _SC_CHAR_BIT
+#define PRIX16 "X"
+#define ERROR_GENERIC 1
+#define _SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK
+#define PROTOCOL_VERSION_MAJOR 3
+#define ECHOKE 0004000
+#define PRIoFAST8 "o"
+#define INT_LEAST16_MAX (32767)
+#define ERROR_MISSED_EVENT 19
+#define PRIoLEAST8 "o"
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+#define __UINT_FAST8_TYPE__ unsigned char
+#define _IOWR_BAD(type,nr,size) _IOC(_IOC_READ|_IOC_WRITE,(type),(nr),sizeof(size))
+#define SCNuLEAST32 "u"
+#define SCNi8 "hhi"
+#define __P(args) args
+#define _POSIX_BARRIERS 200809L
+#define PRIo64 __PRI64_PREFIX "o"
+#define PRIXFAST16 __PRIPTR_PREFIX "X"
+#define __S_ISGID 02000
+#define PWM_MIN_RESOLUTION 0
+#define BS0 0000000
+#define BS1 0020000
+#define __ATOMIC_ACQ_REL 4
+#define S_IFIFO __S_IFIFO
+#define SCNuFAST8 "hhu"
+#define __WCHAR_T 
+#define __ATOMIC_RELEASE 3
+#define __fsblkcnt_t_defined 
+#define __LP64_OFF64_CFLAGS "-m64"
@@ -0,0 +1,1130 @@
+#define _BITS_FLOATN_COMMON_H 
+#define COMMPORT_TYPE_TTY 4
+#define PRIXFAST32 __PRIPTR_PREFIX "X"
+#define __attr_access(x) __attribute__ ((__access__ x))
+#define __DBL_MIN_EXP__ (-1021)
+#define ____sigset_t_defined 
+#define __CFLOAT32 _Complex _Float32
+#define __UINT_LEAST16_MAX__ 0xffff
+#define __FLT16_HAS_QUIET_NAN__ 1
+#define __ATOMIC_ACQUIRE 2
+#define COMMPORT_ERROR_NO 0
+#define __FLT128_MAX_10_EXP__ 4932
+#define PRIXFAST64 __PRI64_PREFIX "X"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+#define __GCC_IEC_559_COMPLEX 2
+#define SCNiFAST8 "hhi"
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+#define __UINT_LEAST8_TYPE__ unsigned char
+#define __SIZEOF_FLOAT80__ 16
+#define _T_WCHAR_ 
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+#define INT_LEAST16_MIN (-32767-1)
+#define __CFLOAT64 _Complex _Float64
+#define __flexarr []
+#define __S64_TYPE long int
+#define __stub_fchflags 
+#define PRIuPTR __PRIPTR_PREFIX "u"
+#define __SQUAD_TYPE long int
+#define __DEFINED_ptrdiff_t 
+#define GPIO_REG(pin) ((pin) >> 4)
+#define __INTMAX_C(c) c ## L
+#define _BSD_SIZE_T_DEFINED_ 
+#define __CHAR_BIT__ 8
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+#define __UINT8_MAX__ 0xff
+#define __SCHAR_WIDTH__ 8
+#define PRIiLEAST16 "i"
+#define INT16_C(c) c
+#define __WINT_MAX__ 0xffffffffU
+#define PIN_MODE_SHIFT 11
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define __FLT32_MIN_EXP__ (-125)
+#define INT8_MAX (127)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+#define stderr stderr
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+#define PRIXLEAST8 "X"
+#define __OFF_T_MATCHES_OFF64_T 1
+#define __ORDER_LITTLE_ENDIAN__ 1234
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+#define PRIdMAX __PRI64_PREFIX "d"
+#define __WCHAR_MAX__ 0x7fffffff
+#define SCNx16 "hx"
+#define PIN_MODE_I2C 8
+#define TX_BUFFER_SIZE 64
+#define INT16_MAX (32767)
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+#define __GCC_IEC_559 2
+#define __FLT32X_DECIMAL_DIG__ 17
+#define _IOFBF 0
+#define __FLT_EVAL_METHOD__ 0
+#define _IO_USER_LOCK 0x8000
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+#define __FLT64_DECIMAL_DIG__ 17
+#define __HAVE_GENERIC_SELECTION 1
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+#define __HAVE_FLOAT64 1
+#define COMMPORT_ERROR_BUFOVF 4
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+#define INT8_MIN (-128)
+#define GPIO_MASK(pin) _BV((pin) & 0xf)
+#define be64toh(x) __bswap_64 (x)
+#define __DEFINED_wchar_t 
+#define TIMER16 0
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+#define __DEFINED_size_t 
+#define __CFLOAT128 _Complex _Float128
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+#define __SIG_ATOMIC_TYPE__ int
+#define __COMPAR_FN_T 
+#define __GID_T_TYPE __U32_TYPE
+#define __STATFS_MATCHES_STATFS64 1
+#define __DBL_MIN_10_EXP__ (-307)
+#define INT16_MIN (-32767-1)
+#define TIMER32 3
+#define __FINITE_MATH_ONLY__ 0
+#define __id_t_defined 
+#define PRIi32 "i"
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+#define __FLT32X_MAX_EXP__ 1024
+#define PRIxPTR __PRIPTR_PREFIX "x"
+#define __u_char_defined 
+#define WIFEXITED(status) __WIFEXITED (status)
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+#define __pid_t_defined 
+#define __FLT32_HAS_DENORM__ 1
+#define SPI_CH 0
+#define __UINT_FAST8_MAX__ 0xff
+#define __LEAF , __leaf__
+#define _THREAD_MUTEX_INTERNAL_H 1
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __size_t 
+#define SCNdLEAST8 "hhd"
+#define __FLT32_MAX_10_EXP__ 38
+#define BIT_GET(p,m) ((p) & (m))
+#define INT_FAST8_MAX (127)
+#define __DEC64_MAX_EXP__ 385
+#define _WCHAR_T_DEFINED 
+#define PRIX16 "X"
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __INT8_C(c) c
+#define WCHAR_MAX __WCHAR_MAX
+#define __INT_LEAST8_WIDTH__ 8
+#define PWM_MAX_RESOLUTION 0
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+#define htobe16(x) __bswap_16 (x)
+#define __always_inline __inline __attribute__ ((__always_inline__))
+#define NFDBITS __NFDBITS
+#define __SHRT_MAX__ 0x7fff
+#define SCNd8 "hhd"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define __FLT64X_MAX_10_EXP__ 4932
+#define CEIL127(a) ({ __typeof__ (a) _a = (a); _a < 127 ? _a : 127; })
+#define PIN_MODE_PWM 4
+#define __daddr_t_defined 
+#define __LDBL_IS_IEC_60559__ 2
+#define INT_FAST16_MAX (9223372036854775807L)
+#define __fortify_function __extern_always_inline __attribute_artificial__
+#define __FLT64X_HAS_QUIET_NAN__ 1
+#define SCNd16 "hd"
+#define __UINT_LEAST8_MAX__ 0xff
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+#define __UINTMAX_TYPE__ long unsigned int
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define INT_FAST8_MIN (-128)
+#define SCNd32 "d"
+#define BIT_WRITE(c,p,m) (c ? BIT_SET(p,m) : BIT_CLEAR(p,m))
+#define __linux 1
+#define __DEC32_EPSILON__ 1E-6DF
+#define WCHAR_MIN __WCHAR_MIN
+#define __PRIPTR_PREFIX "l"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+#define _BITS_TYPES_H 1
+#define __unix 1
+#define SCNo16 "ho"
+#define ____gwchar_t_defined 1
+#define _BITS_PTHREADTYPES_ARCH_H 1
+#define NULL ((void *)0)
+#define __UINT32_MAX__ 0xffffffffU
+#define __UID_T_TYPE __U32_TYPE
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+#define __SIZE_T 
+#define SCNd64 __PRI64_PREFIX "d"
+#define SCNo32 "o"
+#define _ATFILE_SOURCE 1
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+#define SCNuLEAST16 "hu"
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+#define __FLT128_MIN_EXP__ (-16381)
+#define __WINT_MIN__ 0U
+#define PRIxFAST8 "x"
+#define WUNTRACED 2
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define UINT16_C(c) c
+#define SCNo8 "hho"
+#define __FLT128_MIN_10_EXP__ (-4931)
+#define __FLT32X_IS_IEC_60559__ 2
+#define SCNo64 __PRI64_PREFIX "o"
+#define EXIT_FAILURE 1
+#define __INT_LEAST16_WIDTH__ 16
+#define _SIZE_T_DEFINED_ 
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __SCHAR_MAX__ 0x7f
+#define __FLT128_MANT_DIG__ 113
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+#define __KERNEL_STRICT_NAMES 
+#define SCNxFAST16 __PRIPTR_PREFIX "x"
+#define __INT64_C(c) c ## L
+#define SCNuLEAST64 __PRI64_PREFIX "u"
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+#define __INT_WCHAR_T_H 
+#define WSTOPPED 2
+#define I2C_CH 0
+#define SCNoFAST64 __PRI64_PREFIX "o"
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+#define PRIxFAST32 __PRIPTR_PREFIX "x"
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+#define _POSIX_SOURCE 1
+#define RELEASE_HAL __GIT_REVPARSE__
+#define _DEFAULT_SOURCE 1
+#define PIN_MODE_OUTPUT 3
+#define __attribute_used__ __attribute__ ((__used__))
+#define PRIuLEAST16 "u"
+#define SCNxFAST64 __PRI64_PREFIX "x"
+#define __LOCK_ALIGNMENT 
+#define __FLT32X_MANT_DIG__ 53
+#define PRIuFAST16 __PRIPTR_PREFIX "u"
+#define SCNx32 "x"
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+#define SCNx8 "hhx"
+#define _BITS_ENDIANNESS_H 1
+#define PRIuLEAST32 "u"
+#define __GLIBC__ 2
+#define __END_DECLS 
+#define PRIuFAST32 __PRIPTR_PREFIX "u"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+#define __CONCAT(x,y) x ## y
+#define PIN_MODE_IGNORE 14
+#define WCONTINUED 8
+#define __STDC_HOSTED__ 1
+#define PIN_MODE_TTY 7
+#define GPIO_ATOMIC(pin,expr) do { if (pin < GPIO_ATOMIC_MAX) { expr; } else { uint8_t sreg = SREG; __asm__ __volatile__("cli" ::: "memory"); expr; SREG = sreg; __asm__ __volatile__("" ::: "memory"); } } while (0)
+#define __SLONG32_TYPE int
+#define _BITS_UINTN_IDENTITY_H 1
+#define _SYS_SELECT_H 1
+#define PRIuLEAST64 __PRI64_PREFIX "u"
+#define __DEC64_MIN_EXP__ (-382)
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define COMMPORT_ERROR_DATAOVR 2
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+#define __GNU_LIBRARY__ 6
+#define SCNi32 "i"
+#define __DBL_DIG__ 15
+#define __FLT32_DIG__ 6
+#define __RLIM_T_MATCHES_RLIM64_T 1
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+#define INT32_MIN (-2147483647-1)
+#define _IO_EOF_SEEN 0x0010
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __SHRT_WIDTH__ 16
+#define __f64x(x) x ##f64x
+#define _STDIO_H 1
+#define TMP_MAX 238328
+#define __FLT32_IS_IEC_60559__ 2
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+#define __STDC_UTF_16__ 1
+#define _____fpos_t_defined 1
+#define __nonnull(params) __attribute_nonnull__ (params)
+#define __DBL_IS_IEC_60559__ 2
+#define le32toh(x) __uint32_identity (x)
+#define _SIZE_T_DEFINED 
+#define __DEC32_MAX__ 9.999999E96DF
+#define PIN_IS_DIGITAL(p) (0)
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+#define _WCHAR_T_ 
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+#define _STDDEF_H 
+#define _VA_LIST_DEFINED 
+#define __FLT32X_HAS_INFINITY__ 1
+#define __INT32_MAX__ 0x7fffffff
+#define __GLIBC_USE_DEPRECATED_GETS 0
+#define __SIZEOF_PTHREAD_COND_T 48
+#define SCNoLEAST16 "ho"
+#define __FLT16_DIG__ 3
+#define __unix__ 1
+#define __INT_WIDTH__ 32
+#define __SIZEOF_LONG__ 8
+#define _IONBF 2
+#define __STDC_IEC_559__ 1
+#define __STDC_ISO_10646__ 201706L
+#define PRIoFAST16 __PRIPTR_PREFIX "o"
+#define PRIX64 __PRI64_PREFIX "X"
+#define __UINT16_C(c) c
+#define SCNoLEAST32 "o"
+#define __DECIMAL_DIG__ 21
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+#define __USE_FORTIFY_LEVEL 0
+#define __STDC_IEC_559_COMPLEX__ 1
+#define PRIoFAST32 __PRIPTR_PREFIX "o"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+#define __gnu_linux__ 1
+#define __FLT128_IS_IEC_60559__ 2
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+#define SCNdLEAST32 "d"
+#define PRIX8 "X"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+#define PULSE_SLOTS (1000/PULSE_SLOT_US)
+#define __LDBL_HAS_QUIET_NAN__ 1
+#define INT64_C(c) c ## L
+#define PRIuFAST8 "u"
+#define PRIoFAST64 __PRI64_PREFIX "o"
+#define __USE_ISOC11 1
+#define __HAVE_FLOAT64X 1
+#define __FLT16_MIN_EXP__ (-13)
+#define __FLT64_MANT_DIG__ 53
+#define __attribute_const__ __attribute__ ((__const__))
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define SCNxFAST8 "hhx"
+#define SCNdLEAST64 __PRI64_PREFIX "d"
+#define htobe32(x) __bswap_32 (x)
+#define __FLT64X_MANT_DIG__ 64
+#define L_tmpnam 20
+#define ___int_wchar_t_h 
+#define UINT8_C(c) c
+#define BIT_CLEAR(p,m) ((p) &= ~(m))
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+#define _T_PTRDIFF 
+#define __GNUC__ 12
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+#define PRIoLEAST16 "o"
+#define UINT_LEAST8_MAX (255)
+#define __MMX__ 1
+#define L_ctermid 9
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define __FLT_HAS_DENORM__ 1
+#define __SIZEOF_LONG_DOUBLE__ 16
+#define PRIoLEAST32 "o"
+#define __timeval_defined 1
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define PRIdLEAST16 "d"
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define SEEK_CUR 1
+#define __BIGGEST_ALIGNMENT__ 16
+#define RAM 8000000UL
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+#define PRIuMAX __PRI64_PREFIX "u"
+#define __ONCE_ALIGNMENT 
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+#define __FLT64_MAX_10_EXP__ 308
+#define PRIdLEAST32 "d"
+#define PRIoLEAST64 __PRI64_PREFIX "o"
+#define __GLIBC_USE_LIB_EXT2 0
+#define __USE_ISOC95 1
+#define __USE_ISOC99 1
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __FLT16_MAX_10_EXP__ 4
+#define PRIi64 __PRI64_PREFIX "i"
+#define _GCC_WCHAR_T 
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define _BITS_STDINT_UINTN_H 1
+#define PRIiFAST16 __PRIPTR_PREFIX "i"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+#define __DBL_HAS_INFINITY__ 1
+#define __FIRMWARE_BOARD_HOSTLINUX__ 1
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define PRIdLEAST64 __PRI64_PREFIX "d"
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+#define PRId8 "d"
+#define __SIZEOF_FLOAT__ 4
+#define PRIiFAST32 __PRIPTR_PREFIX "i"
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define PRIi16 "i"
+#define __USE_XOPEN2K 1
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+#define __lldiv_t_defined 1
+#define __DEC32_MIN_EXP__ (-94)
+#define __DADDR_T_TYPE __S32_TYPE
+#define __INTPTR_WIDTH__ 64
+#define __FLT64X_HAS_INFINITY__ 1
+#define PIN_MODE_PULLUP 1
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+#define PRIiFAST64 __PRI64_PREFIX "i"
+#define __FD_SETSIZE 1024
+#define be32toh(x) __bswap_32 (x)
+#define __FLT32X_HAS_DENORM__ 1
+#define __INT_FAST16_TYPE__ long int
+#define __HAVE_FLOAT128X 0
+#define __MMX_WITH_SSE__ 1
+#define _WCHAR_T_DEFINED_ 
+#define PRIi8 "i"
+#define __INO_T_MATCHES_INO64_T 1
+#define SCNdFAST8 "hhd"
+#define __USE_POSIX199506 1
+#define _FEATURES_H 1
+#define __LDBL_HAS_DENORM__ 1
+#define SCNiLEAST16 "hi"
+#define __SEG_GS 1
+#define __stub_setlogin 
+#define __FLT128_HAS_INFINITY__ 1
+#define _GCC_WRAP_STDINT_H 
+#define SCNoLEAST64 __PRI64_PREFIX "o"
+#define __DEC32_MIN__ 1E-95DF
+#define SCNiLEAST32 "i"
+#define __dev_t_defined 
+#define __S32_TYPE int
+#define ROM 8000000UL
+#define __DBL_MAX_EXP__ 1024
+#define __WCHAR_WIDTH__ 32
+#define __BIT_TYPES_DEFINED__ 1
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define _BITS_WCHAR_H 1
+#define __DEC128_EPSILON__ 1E-33DL
+#define __FLT16_DECIMAL_DIG__ 5
+#define __SSE2_MATH__ 1
+#define __ATOMIC_HLE_RELEASE 131072
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __HAVE_FLOAT16 0
+#define PRIo8 "o"
+#define SCNiLEAST64 __PRI64_PREFIX "i"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+#define __amd64 1
+#define __SYSCALL_WORDSIZE 64
+#define DEFAULT_BAUD 57600
+#define SCNdLEAST16 "hd"
+#define SCNdFAST16 __PRIPTR_PREFIX "d"
+#define TIMER8 0
+#define __USECONDS_T_TYPE __U32_TYPE
+#define _PTRDIFF_T_DECLARED 
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __glibc_objsize(__o) __bos (__o)
+#define BIT_FLIP(p,m) ((p) ^= (m))
+#define COMMPORT_TYPE_1WIRE 3
+#define __ATOMIC_HLE_ACQUIRE 65536
+#define _T_WCHAR 
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+#define __SIZEOF_SIZE_T__ 8
+#define __GIT_REVPARSE__ 0xeb544d5
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+#define _WCHAR_T 
+#define SCNiPTR __PRIPTR_PREFIX "i"
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+#define BIT_SET(p,m) ((p) |= (m))
+#define PRIu8 "u"
+#define __FLT64X_MIN_EXP__ (-16381)
+#define SIZE_MAX (18446744073709551615UL)
+#define __SIZEOF_WINT_T__ 4
+#define PRIxLEAST8 "x"
+#define PRIiLEAST32 "i"
+#define SCNdFAST64 __PRI64_PREFIX "d"
+#define PIN_MODE_UNUSED 0
+#define __f32x(x) x ##f32x
+#define UINT64_C(c) c ## UL
+#define __LONG_LONG_WIDTH__ 64
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+#define __U16_TYPE unsigned short int
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+#define __FLT32_MAX_EXP__ 128
+#define WINT_MAX (4294967295u)
+#define PRIiFAST8 "i"
+#define UINTPTR_MAX (18446744073709551615UL)
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+#define PRIx8 "x"
+#define _PTRDIFF_T 
+#define PRIiLEAST64 __PRI64_PREFIX "i"
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+#define __GXX_ABI_VERSION 1017
+#define __WTERMSIG(status) ((status) & 0x7f)
+#define __FLT_MIN_EXP__ (-125)
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+#define WEXITED 4
+#define INT64_MAX (__INT64_C(9223372036854775807))
+#define COMMPORT_ERROR_FRAME 1
+#define UINT32_MAX (4294967295U)
+#define __uid_t_defined 
+#define WNOHANG 1
+#define alloca(size) __builtin_alloca (size)
+#define __INT16_MAX__ 0x7fff
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+#define __x86_64 1
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+#define __PTRDIFF_T 
+#define TICKS_FREQ 1000000UL
+#define _BSD_SIZE_T_ 
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+#define __INT_FAST64_TYPE__ long int
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+#define SCNuLEAST8 "hhu"
+#define _ANSI_STDDEF_H 
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+#define WINT_MIN (0u)
+#define PRIx16 "x"
+#define __key_t_defined 
+#define SCNxFAST32 __PRIPTR_PREFIX "x"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+#define PIN_MODE_ANALOG 5
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __SIZEOF_POINTER__ 8
+#define SCNi64 __PRI64_PREFIX "i"
+#define __WCOREFLAG 0x80
+#define PRIx32 "x"
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __LP64__ 1
+#define SCNu8 "hhu"
+#define __DBL_HAS_QUIET_NAN__ 1
+#define __HAVE_FLOAT32X 1
+#define __time_t_defined 1
+#define SCNoMAX __PRI64_PREFIX "o"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+#define __MODE_T_TYPE __U32_TYPE
+#define EOF (-1)
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+#define __DECIMAL_BID_FORMAT__ 1
+#define __FLT64_MIN_EXP__ (-1021)
+#define PRIx64 __PRI64_PREFIX "x"
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define _INTTYPES_H 1
+#define PIN_MODE_TOTAL 15
+#define INT_LEAST8_MAX (127)
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+#define __CFLOAT64X _Complex _Float64x
+#define __FLT64_MIN_10_EXP__ (-307)
+#define __FDS_BITS(set) ((set)->__fds_bits)
+#define __FLT16_MIN_10_EXP__ (-4)
+#define __FLT64X_DECIMAL_DIG__ 21
+#define __DEC128_MIN__ 1E-6143DL
+#define __REGISTER_PREFIX__ 
+#define __UINT16_MAX__ 0xffff
+#define __DBL_HAS_DENORM__ 1
+#define INT_LEAST32_MAX (2147483647)
+#define SCNoFAST8 "hho"
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+#define __LDBL_HAS_INFINITY__ 1
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+#define __UINT8_TYPE__ unsigned char
+#define COMMPORT_ERROR_TOTAL 5
+#define __FLT_DIG__ 6
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __NO_INLINE__ 1
+#define __DEC_EVAL_METHOD__ 2
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+#define SCNiMAX __PRI64_PREFIX "i"
+#define __FLT_MANT_DIG__ 24
+#define __LDBL_DECIMAL_DIG__ 21
+#define INT_LEAST8_MIN (-128)
+#define __VERSION__ "12.2.0"
+#define PIN_MODE_DEBOUNCE 10
+#define SCNoLEAST8 "hho"
+#define GPIO_PIN(port,pin) (((port) << 4) | (pin))
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+#define UINT_LEAST16_MAX (65535)
+#define __UINT64_C(c) c ## UL
+#define _SYS_TYPES_H 1
+#define _PTRDIFF_T_ 
+#define PRIXLEAST16 "X"
+#define _SYS_CDEFS_H 1
+#define _IO_ERR_SEEN 0x0020
+#define PIN_MODE_SERVO 13
+#define SCNi16 "hi"
+#define _STDC_PREDEF_H 1
+#define INT_LEAST32_MIN (-2147483647-1)
+#define PRIXLEAST32 "X"
+#define __USE_XOPEN2K8 1
+#define htobe64(x) __bswap_64 (x)
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define PIN_IS_ANALOG(p) (0)
+#define __INT_LEAST32_MAX__ 0x7fffffff
+#define __STRING(x) #x
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+#define _T_PTRDIFF_ 
+#define __FLT128_MAX_EXP__ 16384
+#define PRIXLEAST64 __PRI64_PREFIX "X"
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define be16toh(x) __bswap_16 (x)
+#define SYSTEM_RESET_ZERO 0
+#define __ssize_t_defined 
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+#define __FLT32_MANT_DIG__ 24
+#define _SYS_SIZE_T_H 
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define SCNoPTR __PRIPTR_PREFIX "o"
+#define __FLT32X_MIN_EXP__ (-1021)
+#define __stub_gtty 
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define SIG_ATOMIC_MAX (2147483647)
+#define PIN_MODE_STEPPER 12
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+#define INT32_MAX (2147483647)
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define SYSTEM_RESET_TOTAL 3
+#define __wur 
+#define BITLONG(x) ((uint32_t)0x00000001 << (x))
+#define __FLT128_HAS_DENORM__ 1
+#define COMMPORT_TYPE_FD 1
+#define __FLT32_DECIMAL_DIG__ 9
+#define COMMPORT_ERROR_PARITY 3
+#define HAL_BOARD_H 
+#define __FLT128_DIG__ 33
+#define __INT32_C(c) c
+#define SCNiLEAST8 "hhi"
+#define __DEC64_EPSILON__ 1E-15DD
+#define __ORDER_PDP_ENDIAN__ 3412
+#define __DEC128_MIN_EXP__ (-6142)
+#define __PDP_ENDIAN 3412
+#define BYTE_ORDER __BYTE_ORDER
+#define __INT_FAST32_TYPE__ long int
+#define __have_pthread_attr_t 1
+#define SCNi8 "hhi"
+#define _BITS_TYPESIZES_H 1
+#define __FIRMWARE_MCU_X86__ 1
+#define htole32(x) __uint32_identity (x)
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define __UINT_LEAST16_TYPE__ short unsigned int
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+#define COMMPORT_TYPE_NULL 0
+#define RAND_MAX 2147483647
+#define PIN_MODE_SPI 9
+#define unix 1
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+#define SCNdFAST32 __PRIPTR_PREFIX "d"
+#define __THROWNL __attribute__ ((__nothrow__))
+#define POINTER_SIZE 64
+#define PULSE_SLOT_US 4
+#define __SIZE_TYPE__ long unsigned int
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+#define __ULONGWORD_TYPE unsigned long int
+#define _SIZE_T_DECLARED 
+#define __FLT_IS_IEC_60559__ 2
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+#define __FLT64X_DIG__ 18
+#define __INT8_TYPE__ signed char
+#define __HAVE_DISTINCT_FLOAT128 1
+#define __ELF__ 1
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+#define __UINT32_TYPE__ unsigned int
+#define PRIxMAX __PRI64_PREFIX "x"
+#define _BITS_BYTESWAP_H 1
+#define __ID_T_TYPE __U32_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define RX_BUFFER_MASK ( RX_BUFFER_SIZE - 1 )
+#define __FLT_RADIX__ 2
+#define PRIdLEAST8 "d"
+#define __INT_LEAST16_TYPE__ short int
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+#define INTPTR_MAX (9223372036854775807L)
+#define __UINTMAX_C(c) c ## UL
+#define _POSIX_C_SOURCE 200809L
+#define SCNdPTR __PRIPTR_PREFIX "d"
+#define __SSE_MATH__ 1
+#define _ALLOCA_H 1
+#define __k8 1
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+#define __LDBL_REDIR(name,proto) name proto
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+#define SCNxLEAST32 "x"
+#define __f32(x) x ##f32
+#define PRIu16 "u"
+#define __blksize_t_defined 
+#define TTY_CH 0
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+#define __USER_LABEL_PREFIX__ 
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+#define __STDC_IEC_60559_BFP__ 201404L
+#define __WCHAR_MAX __WCHAR_MAX__
+#define __SIZEOF_PTRDIFF_T__ 8
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define SEEK_SET 0
+#define PRIu32 "u"
+#define SCNu64 __PRI64_PREFIX "u"
+#define SCNxLEAST64 __PRI64_PREFIX "x"
+#define __f64(x) x ##f64
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+#define __stub_sigreturn 
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+#define SCNx64 __PRI64_PREFIX "x"
+#define __restrict_arr __restrict
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define __CFLOAT32X _Complex _Float32x
+#define INT8_C(c) c
+#define PRIu64 __PRI64_PREFIX "u"
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+#define __USE_MISC 1
+#define __UWORD_TYPE unsigned long int
+#define __LDBL_DIG__ 18
+#define __FLT64_IS_IEC_60559__ 2
+#define __x86_64__ 1
+#define _SIZE_T_ 
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+#define __FLT16_IS_IEC_60559__ 2
+#define __FLT16_MAX_EXP__ 16
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+#define HAL_DEFINES_H 
+#define UINT_FAST32_MAX (18446744073709551615UL)
+#define HAL_H 
+#define _WCHAR_T_H 
+#define PRIxLEAST16 "x"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+#define __stub_revoke 
+#define __timer_t_defined 1
+#define __WCLONE 0x80000000
+#define __GCC_CONSTRUCTIVE_SIZE 64
+#define PRIxLEAST32 "x"
+#define __WCHAR_MIN __WCHAR_MIN__
+#define __FLT64_DIG__ 15
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+#define __UINT_LEAST64_TYPE__ long unsigned int
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+#define __U64_TYPE unsigned long int
+#define __FLT_HAS_QUIET_NAN__ 1
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+#define INT32_C(c) c
+#define __FLT_MAX_10_EXP__ 38
+#define _____fpos64_t_defined 1
+#define __SIZE_T__ 
+#define __glibc_c99_flexarr_available 1
+#define __LONG_MAX__ 0x7fffffffffffffffL
+#define __WCHAR_T__ 
+#define __FLT64X_HAS_DENORM__ 1
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __FLT_HAS_INFINITY__ 1
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+#define PRIxLEAST64 __PRI64_PREFIX "x"
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+#define PRIxFAST16 __PRIPTR_PREFIX "x"
+#define _BSD_PTRDIFF_T_ 
+#define _BITS_PTHREADTYPES_COMMON_H 1
+#define PRIXPTR __PRIPTR_PREFIX "X"
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+#define __UINT_FAST16_TYPE__ long unsigned int
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+#define __DEC64_MAX__ 9.999999999999999E384DD
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+#define __INT_FAST32_WIDTH__ 64
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+#define __CHAR16_TYPE__ short unsigned int
+#define __PRAGMA_REDEFINE_EXTNAME 1
+#define SCNuPTR __PRIPTR_PREFIX "u"
+#define BIG_ENDIAN __BIG_ENDIAN
+#define PRIX32 "X"
+#define __SIZE_WIDTH__ 64
+#define __SEG_FS 1
+#define __INT_LEAST16_MAX__ 0x7fff
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define __DEC64_MANT_DIG__ 16
+#define __INT64_MAX__ 0x7fffffffffffffffL
+#define _BITS_ENDIAN_H 1
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+#define __SIG_ATOMIC_WIDTH__ 32
+#define PRIxFAST64 __PRI64_PREFIX "x"
+#define __INT_LEAST64_TYPE__ long int
+#define WATCHDOG 1
+#define htole16(x) __uint16_identity (x)
+#define __INT16_TYPE__ short int
+#define __INT_LEAST8_TYPE__ signed char
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define __STDC_VERSION__ 201710L
+#define __SIZEOF_INT__ 4
+#define __DEC32_MAX_EXP__ 97
+#define TX_BUFFER_MASK ( TX_BUFFER_SIZE - 1 )
+#define GPIO_ATOMIC_MAX GPIO_PIN(0x40,0)
+#define UTILITY_MACROS_H 
+#define __INT_FAST8_MAX__ 0x7f
+#define ADC_CH 0
+#define __PMT(args) args
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+#define WTERMSIG(status) __WTERMSIG (status)
+#define linux 1
+#define SCNdMAX __PRI64_PREFIX "d"
+#define PIN_TOTAL 0
+#define __FLT64_HAS_QUIET_NAN__ 1
+#define PDP_ENDIAN __PDP_ENDIAN
+#define htole64(x) __uint64_identity (x)
+#define SYSTEM_RESET_REBOOT 1
+#define __USE_POSIX2 1
+#define SCNuFAST32 __PRIPTR_PREFIX "u"
+#define __FLT32_MIN_10_EXP__ (-37)
+#define __FLT32X_DIG__ 15
+#define SCNuFAST16 __PRIPTR_PREFIX "u"
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+#define __WORDSIZE 64
+#define __PTRDIFF_WIDTH__ 64
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+#define __BEGIN_DECLS 
+#define __LDBL_MANT_DIG__ 64
+#define SCNuFAST64 __PRI64_PREFIX "u"
+#define __FLT64_HAS_INFINITY__ 1
+#define PWM_CH 0
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __FLT16_HAS_INFINITY__ 1
+#define PRIuLEAST8 "u"
+#define __GNUC_VA_LIST 
+#define _GCC_MAX_ALIGN_T 
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+#define __code_model_small__ 1
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+#define COMMPORT_TYPE_I2C 5
+#define __DEC32_MANT_DIG__ 7
+#define le64toh(x) __uint64_identity (x)
+#define FILENAME_MAX 4096
+#define __FLT16_MANT_DIG__ 11
+#define __ino_t_defined 
+#define __k8__ 1
+#define __INTPTR_TYPE__ long int
+#define __UINT16_TYPE__ short unsigned int
+#define __WCHAR_TYPE__ int
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __SLONGWORD_TYPE long int
+#define __FIRMWARE_ARCH_LINUX__ 1
+#define PRIiPTR __PRIPTR_PREFIX "i"
+#define __pic__ 2
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+#define COMMPORT_TYPE_PIN 2
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+#define __INT_FAST64_WIDTH__ 64
+#define __stub_chflags 
+#define SCNxPTR __PRIPTR_PREFIX "x"
+#define __UQUAD_TYPE unsigned long int
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define __BYTE_ORDER __LITTLE_ENDIAN
+#define __USE_POSIX 1
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+#define RELEASE_DEFINES __GIT_REVPARSE__
+#define __LITTLE_ENDIAN 1234
+#define BUFSIZ 8192
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+#define __FLT32_HAS_INFINITY__ 1
+#define INT_FAST32_MAX (9223372036854775807L)
+#define COMMPORT_TYPE_SPI 6
+#define __FLT64X_MAX_EXP__ 16384
+#define _WCHAR_T_DECLARED 
+#define __UINT_FAST64_TYPE__ long unsigned int
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+#define WNOWAIT 0x01000000
+#define PRIXFAST8 "X"
+#define EXIT_SUCCESS 0
+#define __LDBL_REDIR_DECL(name) 
+#define UINT_FAST8_MAX (255)
+#define __INT_MAX__ 0x7fffffff
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+#define SCNoFAST16 __PRIPTR_PREFIX "o"
+#define __linux__ 1
+#define UINT8_MAX (255)
+#define __S16_TYPE short int
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define PRIXMAX __PRI64_PREFIX "X"
+#define _T_SIZE_ 
+#define __TIMESIZE __WORDSIZE
+#define SCNoFAST32 __PRIPTR_PREFIX "o"
+#define __WNOTHREAD 0x20000000
+#define __INT64_TYPE__ long int
+#define MSB16(a) ({ __typeof__ (a) _a = (a); _a & 0xF0; })
+#define SCNuMAX __PRI64_PREFIX "u"
+#define __FLT_MAX_EXP__ 128
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __gid_t_defined 
+#define UINT32_C(c) c ## U
+#define __ORDER_BIG_ENDIAN__ 4321
+#define __ptr_t void *
+#define __DBL_MANT_DIG__ 53
+#define ___int_size_t_h 
+#define __TIMER_T_TYPE void *
+#define ONEWIRE_CH 0
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+#define __SIZEOF_FLOAT128__ 16
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+#define __clock_t_defined 1
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+#define __GLIBC_MINOR__ 36
+#define __DEC64_MIN__ 1E-383DD
+#define HAL_ARCH_H 
+#define __WINT_TYPE__ unsigned int
+#define __UINT_LEAST32_TYPE__ unsigned int
+#define __SIZEOF_SHORT__ 2
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define __SSE__ 1
+#define SCNu16 "hu"
+#define __sigset_t_defined 1
+#define __intptr_t_defined 
+#define __LDBL_MIN_EXP__ (-16381)
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define FD_SETSIZE __FD_SETSIZE
+#define SCNu32 "u"
+#define stdout stdout
+#define __amd64__ 1
+#define __WINT_WIDTH__ 32
+#define __struct_FILE_defined 1
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+#define __INT_LEAST8_MAX__ 0x7f
+#define __USE_POSIX199309 1
+#define __INT_LEAST64_WIDTH__ 64
+#define __LDBL_MAX_EXP__ 16384
+#define __FLT32X_MAX_10_EXP__ 308
+#define ____mbstate_t_defined 1
+#define __SIZEOF_INT128__ 16
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+#define __FLT64X_IS_IEC_60559__ 2
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __LDBL_MAX_10_EXP__ 4932
+#define __ATOMIC_RELAXED 0
+#define LSB16(a) ({ __typeof__ (a) _a = (a); _a & 0x0F; })
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+#define __stub_stty 
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+#define le16toh(x) __uint16_identity (x)
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+#define _SIZET_ 
+#define _LP64 1
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+#define __UINT8_C(c) c
+#define _BITS_STDINT_INTN_H 1
+#define __FLT64_MAX_EXP__ 1024
+#define __INT_LEAST32_TYPE__ int
+#define __wchar_t__ 
+#define SEEK_END 2
+#define __SIZEOF_WCHAR_T__ 4
+#define __USE_POSIX_IMPLICITLY 1
+#define __UINT64_TYPE__ long unsigned int
+#define ____FILE_defined 1
+#define __GNUC_PATCHLEVEL__ 0
+#define SCNiFAST16 __PRIPTR_PREFIX "i"
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define __PRI64_PREFIX "l"
+#define _STDDEF_H_ 
+#define __stub___compat_bdflush 
+#define SCNiFAST32 __PRIPTR_PREFIX "i"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define __FLT128_HAS_QUIET_NAN__ 1
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+#define __INT_FAST8_TYPE__ signed char
+#define _IOLBF 1
+#define PRIiMAX __PRI64_PREFIX "i"
+#define __PID_T_TYPE __S32_TYPE
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define _THREAD_SHARED_TYPES_H 1
+#define SCNiFAST64 __PRI64_PREFIX "i"
+#define __GLIBC_USE_ISOC2X 0
+#define __f128(x) x ##f128
+#define __glibc_has_extension(ext) 0
+#define SCNxMAX __PRI64_PREFIX "x"
+#define __GNUC_STDC_INLINE__ 1
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+#define P_tmpdir "/tmp"
+#define __attribute_pure__ __attribute__ ((__pure__))
+#define __FLT64_HAS_DENORM__ 1
+#define __HAVE_FLOAT32 1
+#define __WORDSIZE_TIME64_COMPAT32 1
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+#define __FLT16_HAS_DENORM__ 1
+#define __DBL_DECIMAL_DIG__ 17
+#define __STDC_UTF_32__ 1
+#define _BITS_STDIO_LIM_H 1
+#define __INT_FAST8_WIDTH__ 8
+#define __FXSR__ 1
+#define _SIZE_T 
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+#define __ULONG32_TYPE unsigned int
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define FOPEN_MAX 16
+#define __BIG_ENDIAN 4321
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define __suseconds_t_defined 
+#define __off_t_defined 
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __GCC_DESTRUCTIVE_SIZE 64
+#define PRIdFAST16 __PRIPTR_PREFIX "d"
+#define _STRUCT_TIMESPEC 1
+#define __INTMAX_WIDTH__ 64
+#define RELEASE_BOARD __GIT_REVPARSE__
+#define __mode_t_defined 
+#define _GCC_SIZE_T 
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __W_CONTINUED 0xffff
+#define __UINT32_C(c) c ## U
+#define PRIdFAST32 __PRIPTR_PREFIX "d"
+#define COMMPORT_TYPE_TOTAL 7
+#define __size_t__ 
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+#define PRIoPTR __PRIPTR_PREFIX "o"
+#define _BITS_TIME64_H 1
+#define _ENDIAN_H 1
+#define __TIME64_T_TYPE __TIME_T_TYPE
+#define __glibc_has_builtin(name) __has_builtin (name)
+#define __ONCE_FLAG_INIT { 0 }
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+#define __INT8_MAX__ 0x7f
+#define __LONG_WIDTH__ 64
+#define __PIC__ 2
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+#define PRIdFAST64 __PRI64_PREFIX "d"
+#define __UINT_FAST32_TYPE__ long unsigned int
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define __CHAR32_TYPE__ unsigned int
+#define PIN_MODE_INPUT 2
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+#define __GLIBC_USE_IEC_60559_EXT 0
+#define __fsfilcnt_t_defined 
+#define __blkcnt_t_defined 
+#define __HAVE_FLOAT128 1
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+#define UINT_LEAST32_MAX (4294967295U)
+#define SCNxLEAST8 "hhx"
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+#define UINTMAX_C(c) c ## UL
+#define __SSE2__ 1
+#define __INT32_TYPE__ int
+#define __SIZEOF_DOUBLE__ 8
+#define __FLT_MIN_10_EXP__ (-37)
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+#define __INT_LEAST32_WIDTH__ 32
+#define __KEY_T_TYPE __S32_TYPE
+#define __SWORD_TYPE long int
+#define __INTMAX_TYPE__ long int
+#define RELEASE_ARCH __GIT_REVPARSE__
+#define __DEC128_MAX_EXP__ 6145
+#define __ldiv_t_defined 1
+#define _T_SIZE 
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define PRIdFAST8 "d"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+#define __ATOMIC_CONSUME 1
+#define __GNUC_MINOR__ 2
+#define __INT_FAST16_WIDTH__ 64
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+#define PRIiLEAST8 "i"
+#define __LDBL_REDIR2_DECL(name) 
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+#define INTMAX_C(c) c ## L
+#define __glibc_clang_prereq(maj,min) 0
+#define __nlink_t_defined 
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define _STDINT_H 1
+#define _RWLOCK_INTERNAL_H 
+#define __DBL_MAX_10_EXP__ 308
+#define __FILE_defined 1
+#define PIN_MODE_1WIRE 6
+#define UINT16_MAX (65535)
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+#define MAX(a,b) ({ __typeof__ (a) _a = (a); __typeof__ (b) _b = (b); _a > _b ? _a : _b; })
+#define __INT16_C(c) c
+#define __WCHAR_T 
+#define __U32_TYPE unsigned int
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define __STDC__ 1
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+#define __PTRDIFF_TYPE__ long int
+#define stdin stdin
+#define __clockid_t_defined 1
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+#define __ATOMIC_SEQ_CST 5
+#define PRIdPTR __PRIPTR_PREFIX "d"
+#define BIT(x) (0x01 << (x))
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define _BITS_FLOATN_H 
+#define __FLT32X_MIN_10_EXP__ (-307)
+#define PRId16 "d"
+#define PRIuFAST64 __PRI64_PREFIX "u"
+#define __UINTPTR_TYPE__ long unsigned int
+#define RX_BUFFER_SIZE 64
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __DEC128_MANT_DIG__ 34
+#define __LDBL_MIN_10_EXP__ (-4931)
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+#define PRId32 "d"
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define SCNxLEAST16 "hx"
+#define __SIZEOF_LONG_LONG__ 8
+#define PRIo16 "o"
+#define __USE_ATFILE 1
+#define SYSTEM_RESET_HALT 2
+#define _GCC_PTRDIFF_T 
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+#define __FLT128_DECIMAL_DIG__ 36
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+#define F_CPU 1000000000ULL
+#define _STDLIB_H 1
+#define PRId64 __PRI64_PREFIX "d"
+#define PTRDIFF_MAX (9223372036854775807L)
+#define __FLT32_HAS_QUIET_NAN__ 1
+#define __FLT_DECIMAL_DIG__ 9
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+#define PRIo32 "o"
+#define __WALL 0x40000000
+#define ___int_ptrdiff_t_h 
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define PRIoMAX __PRI64_PREFIX "o"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define PRIoFAST8 "o"
+#define INT_LEAST16_MAX (32767)
+#define PRIoLEAST8 "o"
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+#define __UINT_FAST8_TYPE__ unsigned char
+#define SCNuLEAST32 "u"
+#define __P(args) args
+#define PRIo64 __PRI64_PREFIX "o"
+#define PRIXFAST16 __PRIPTR_PREFIX "X"
+#define PWM_MIN_RESOLUTION 0
+#define __ATOMIC_ACQ_REL 4
+#define SCNuFAST8 "hhu"
+#define __ATOMIC_RELEASE 3
+#define __fsblkcnt_t_defined 
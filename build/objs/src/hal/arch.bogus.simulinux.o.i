@@ -0,0 +1,3098 @@
+#define _mm512_mask_max_round_pd(W,U,A,B,R) (__m512d)__builtin_ia32_maxpd512_mask(A, B, W, U, R)
+#define _mm512_mask_max_round_ph(A,B,C,D,E) (__builtin_ia32_maxph512_mask_round ((C), (D), (A), (B), (E)))
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define _mm512_mask_max_round_ps(W,U,A,B,R) (__m512)__builtin_ia32_maxps512_mask(A, B, W, U, R)
+#define _mm512_cvt_roundepi32_ph(A,B) (__builtin_ia32_vcvtdq2ph512_mask_round ((__v16si)(A), _mm256_setzero_ph (), (__mmask16)-1, (B)))
+#define _mm512_range_pd(A,B,C) ((__m512d) __builtin_ia32_rangepd512_mask ((__v8df)(__m512d)(A), (__v8df)(__m512d)(B), (int)(C), (__v8df)_mm512_setzero_pd (), (__mmask8)-1, _MM_FROUND_CUR_DIRECTION))
+#define __attr_access(x) __attribute__ ((__access__ x))
+#define _mm_mask_i32gather_epi64(SRC,BASE,INDEX,MASK,SCALE) (__m128i) __builtin_ia32_gathersiv2di ((__v2di)(__m128i) (SRC), (long long const *) (BASE), (__v4si)(__m128i) (INDEX), (__v2di)(__m128i) (MASK), (int) (SCALE))
+#define __DBL_MIN_EXP__ (-1021)
+#define _mm512_range_ps(A,B,C) ((__m512) __builtin_ia32_rangeps512_mask ((__v16sf)(__m512)(A), (__v16sf)(__m512)(B), (int)(C), (__v16sf)_mm512_setzero_ps (), (__mmask16)-1, _MM_FROUND_CUR_DIRECTION))
+#define _mm_alignr_pi8(X,Y,N) ((__m64) __builtin_ia32_palignr ((__v1di)(__m64)(X), (__v1di)(__m64)(Y), (int)(N) * 8))
+#define _mm_mask_min_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_minss_mask_round(A, B, W, U, C)
+#define __CFLOAT32 _Complex _Float32
+#define _AVX512IFMAINTRIN_H_INCLUDED 
+#define __UINT_LEAST16_MAX__ 0xffff
+#define _mm_mask_mul_round_sh(A,B,C,D,E) ((__m128h)__builtin_ia32_mulsh_mask_round ((C), (D), (A), (B), (E)))
+#define _mm256_gf2p8affineinv_epi64_epi8(A,B,C) ((__m256i) __builtin_ia32_vgf2p8affineinvqb_v32qi((__v32qi)(__m256i)(A), (__v32qi)(__m256i)(B), (int)(C)))
+#define _mm_getmant_ph(X,B,C) ((__m128h) __builtin_ia32_getmantph128_mask ((__v8hf)(__m128h) (X), (int)(((C)<<2) | (B)), (__v8hf)(__m128h)_mm_setzero_ph (), (__mmask8)-1))
+#define __FLT128_MAX_10_EXP__ 4932
+#define _mm_mask_rsqrt28_sd(W,U,A,B) _mm_mask_rsqrt28_round_sd ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm_mask_rsqrt28_ss(W,U,A,B) _mm_mask_rsqrt28_round_ss ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm512_mask_shuffle_pd(W,U,X,Y,C) ((__m512d)__builtin_ia32_shufpd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(C), (__v8df)(__m512d)(W), (__mmask8)(U)))
+#define _mm_mask_fixupimm_round_sd(X,U,Y,Z,C,R) ((__m128d)__builtin_ia32_fixupimmsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(U), (R)))
+#define MSB16(a) ({ __typeof__ (a) _a = (a); _a & 0xF0; })
+#define _mm512_mask_shuffle_ps(W,U,X,Y,C) ((__m512)__builtin_ia32_shufps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(C), (__v16sf)(__m512)(W), (__mmask16)(U)))
+#define _mm_mask_fixupimm_round_ss(X,U,Y,Z,C,R) ((__m128)__builtin_ia32_fixupimmss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(U), (R)))
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define PRIxLEAST64 __PRI64_PREFIX "x"
+#define _mm256_extracti64x2_epi64(X,C) ((__m128i) __builtin_ia32_extracti64x2_256_mask ((__v4di)(__m256i) (X), (int) (C), (__v2di)(__m128i) _mm_setzero_si128 (), (__mmask8)-1))
+#define _T_WCHAR_ 
+#define _mm512_mask_i64gather_pd(V1OLD,MASK,INDEX,ADDR,SCALE) (__m512d) __builtin_ia32_gatherdiv8df ((__v8df)(__m512d) (V1OLD), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm_mask_cmp_epi8_mask(M,X,Y,P) ((__mmask16) __builtin_ia32_cmpb128_mask ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(P), (__mmask16)(M)))
+#define _IONBF 2
+#define _mm512_mask_i64gather_ps(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256) __builtin_ia32_gatherdiv16sf ((__v8sf)(__m256) (V1OLD), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+#define _MM_FROUND_RAISE_EXC 0x00
+#define _mm256_mask_i64scatter_epi32(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8si ((void *) (ADDR), (__mmask8) (MASK), (__v4di)(__m256i) (INDEX), (__v4si)(__m128i) (V1), (int) (SCALE))
+#define _mm512_fpclass_pd_mask(X,C) ((__mmask8) __builtin_ia32_fpclasspd512_mask ((__v8df) (__m512d) (X), (int) (C), (__mmask8)-1))
+#define __CFLOAT64 _Complex _Float64
+#define _kshiftri_mask64(X,Y) ((__mmask64) __builtin_ia32_kshiftridi ((__mmask64)(X), (__mmask8)(Y)))
+#define __S64_TYPE long int
+#define _mm_cmp_round_sd_mask(X,Y,P,R) ((__mmask8) __builtin_ia32_cmpsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P), (__mmask8)-1, R))
+#define PRIuPTR __PRIPTR_PREFIX "u"
+#define __SQUAD_TYPE long int
+#define __DEFINED_ptrdiff_t 
+#define _mm512_mask_fmadd_round_pd(A,U,B,C,R) (__m512d)__builtin_ia32_vfmaddpd512_mask(A, B, C, U, R)
+#define GPIO_REG(pin) ((pin) >> 4)
+#define _mm512_mask_fmadd_round_ph(A,U,B,C,R) ((__m512h)__builtin_ia32_vfmaddph512_mask ((A), (B), (C), (U), (R)))
+#define __GNU_LIBRARY__ 6
+#define _mm512_mask_fmadd_round_ps(A,U,B,C,R) (__m512)__builtin_ia32_vfmaddps512_mask(A, B, C, U, R)
+#define _mm256_cvtps_ph(A,I) ((__m128i) __builtin_ia32_vcvtps2ph256 ((__v8sf)(__m256) (A), (int) (I)))
+#define __CHAR_BIT__ 8
+#define _mm256_gf2p8affine_epi64_epi8(A,B,C) ((__m256i) __builtin_ia32_vgf2p8affineqb_v32qi ((__v32qi)(__m256i)(A), ( __v32qi)(__m256i)(B), (int)(C)))
+#define _mm512_mask_scalef_round_pd(W,U,A,B,C) ((__m512d) __builtin_ia32_scalefpd512_mask((A), (B), (W), (U), (C)))
+#define _mm512_mask_scalef_round_ph(A,B,C,D,E) (__builtin_ia32_scalefph512_mask_round ((C), (D), (A), (B), (E)))
+#define _mm_shuffle_ps(A,B,MASK) ((__m128) __builtin_ia32_shufps ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(MASK)))
+#define _mm512_mask_scalef_round_ps(W,U,A,B,C) ((__m512) __builtin_ia32_scalefps512_mask((A), (B), (W), (U), (C)))
+#define _mm256_i64gather_epi32(BASE,INDEX,SCALE) (__m128i) __builtin_ia32_gatherdiv4si256 ((__v4si) _mm_setzero_si128 (), (int const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4si)_mm_set1_epi32(-1), (int) (SCALE))
+#define _mm_cvtt_roundsd_i32(A,B) ((int)__builtin_ia32_vcvttsd2si32(A, B))
+#define _SGXINTRIN_H_INCLUDED 
+#define _mm512_mask_sqrt_round_pd(W,U,A,C) (__m512d)__builtin_ia32_sqrtpd512_mask(A, W, U, C)
+#define _mm512_mask_shldi_epi64(A,B,C,D,E) ((__m512i) __builtin_ia32_vpshld_v8di_mask ((__v8di)(__m512i)(C), (__v8di)(__m512i)(D), (int)(E), (__v8di)(__m512i)(A), (__mmask8)(B)))
+#define _mm512_setr4_ps(e0,e1,e2,e3) _mm512_set4_ps(e3,e2,e1,e0)
+#define _mm256_maskz_mul_pch(U,A,B) _mm256_maskz_fmul_pch ((U), (A), (B))
+#define _mm_mask3_fmsub_round_sd(A,B,C,U,R) (__m128d) __builtin_ia32_vfmsubsd3_mask3 (A, B, C, U, R)
+#define __encls_bcd(leaf,b,c,d,retval) __asm__ __volatile__("encls\n\t" : "=a" (retval) : "a" (leaf), "b" (b), "c" (c), "d" (d) : "cc")
+#define __LONG_WIDTH__ 64
+#define __VAESINTRIN_H_INCLUDED 
+#define _mm_mask_add_round_sh(A,B,C,D,E) ((__m128h)__builtin_ia32_addsh_mask_round ((C), (D), (A), (B), (E)))
+#define _mm512_mask_add_round_pd(W,U,A,B,C) (__m512d)__builtin_ia32_addpd512_mask(A, B, W, U, C)
+#define stderr stderr
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+#define _mm_mask_fpclass_ph_mask(u,X,C) ((__mmask8) __builtin_ia32_fpclassph128_mask ((__v8hf) (__m128h) (X), (int) (C),(__mmask8)(u)))
+#define _mm_shufflelo_epi16(A,N) ((__m128i)__builtin_ia32_pshuflw ((__v8hi)(__m128i)(A), (int)(N)))
+#define PRIiLEAST8 "i"
+#define _mm_mask_fmsub_round_sd(A,U,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_mask (A, B, -(C), U, R)
+#define _mm512_mask_prefetch_i32scatter_pd(ADDR,MASK,INDEX,SCALE,HINT) __builtin_ia32_scatterpfdpd ((__mmask8) (MASK), (__v8si)(__m256i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm_mask_fmsub_round_sh(A,U,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_mask ((A), (B), -(C), (U), (R)))
+#define _mm_mask_fmsub_round_ss(A,U,B,C,R) (__m128) __builtin_ia32_vfmaddss3_mask (A, B, -(C), U, R)
+#define _mm512_mask_i64scatter_pd(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8df ((void *) (ADDR), (__mmask8) (MASK), (__v8di)(__m512i) (INDEX), (__v8df)(__m512d) (V1), (int) (SCALE))
+#define _mm512_mask_i64scatter_ps(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv16sf ((void *) (ADDR), (__mmask16) (MASK), (__v8di)(__m512i) (INDEX), (__v8sf)(__m256) (V1), (int) (SCALE))
+#define __ORDER_LITTLE_ENDIAN__ 1234
+#define _mm512_undefined_si512 _mm512_undefined_epi32
+#define _mm_mask_roundscale_sh(A,B,C,D,E) (__builtin_ia32_rndscalesh_mask_round ((C), (D), (E), (A), (B), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_mask_fcmul_round_pch(A,B,C,D,E) (__m512h) __builtin_ia32_vfcmulcph512_mask_round ((C), (D), (A), (B), (E))
+#define _mm512_setr4_pd(e0,e1,e2,e3) _mm512_set4_pd(e3,e2,e1,e0)
+#define PIN_MODE_I2C 8
+#define _mm_mask_add_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_addss_mask_round(A, B, W, U, C)
+#define _MM_MALLOC_H_INCLUDED 
+#define _mm512_fixupimm_round_pd(X,Y,Z,C,R) ((__m512d)__builtin_ia32_fixupimmpd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (__v8di)(__m512i)(Z), (int)(C), (__mmask8)(-1), (R)))
+#define _mm512_maskz_fixupimm_pd(U,X,Y,Z,C) ((__m512d)__builtin_ia32_fixupimmpd512_maskz ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (__v8di)(__m512i)(Z), (int)(C), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define TX_BUFFER_SIZE 64
+#define _mm512_fixupimm_round_ps(X,Y,Z,C,R) ((__m512)__builtin_ia32_fixupimmps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (__v16si)(__m512i)(Z), (int)(C), (__mmask16)(-1), (R)))
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define _mm512_maskz_cvt_roundps_epu64(U,A,B) ((__m512i)__builtin_ia32_cvtps2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define _mm256_maskz_ror_epi32(U,A,B) ((__m256i)__builtin_ia32_prord256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i) _mm256_setzero_si256 (), (__mmask8)(U)))
+#define _mm256_permute4x64_pd(X,M) ((__m256d) __builtin_ia32_permdf256 ((__v4df)(__m256d)(X), (int)(M)))
+#define _mm512_maskz_cvtx_roundph_ps(A,B,C) (__builtin_ia32_vcvtph2psx512_mask_round ((B), _mm512_setzero_ps (), (A), (C)))
+#define __FLT32X_DECIMAL_DIG__ 17
+#define _mm_mask_max_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_maxsd_mask_round(A, B, W, U, C)
+#define _mm_mask_max_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_maxss_mask_round(A, B, W, U, C)
+#define _mm512_maskz_extracti64x4_epi64(U,X,C) ((__m256i) __builtin_ia32_extracti64x4_mask ((__v8di)(__m512i) (X), (int) (C), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define _IO_USER_LOCK 0x8000
+#define _mm_cvt_roundsd_sh(A,B,R) (__builtin_ia32_vcvtsd2sh_mask_round ((B), (A), _mm_setzero_ph (), (__mmask8) -1, R))
+#define _mm512_mask_cmp_epu8_mask(M,X,Y,P) ((__mmask64) __builtin_ia32_ucmpb512_mask ((__v64qi)(__m512i)(X), (__v64qi)(__m512i)(Y), (int)(P), (__mmask64)(M)))
+#define _mm_mask_range_round_ss(W,U,A,B,C,R) ((__m128) __builtin_ia32_rangess128_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)(__m128)(W), (__mmask8)(U), (R)))
+#define _mm_insert_epi8(D,S,N) ((__m128i) __builtin_ia32_vec_set_v16qi ((__v16qi)(__m128i)(D), (int)(S), (int)(N)))
+#define _AVX512VPOPCNTDQINTRIN_H_INCLUDED 
+#define _mm512_exp2a23_round_pd(A,C) __builtin_ia32_exp2pd_mask(A, (__v8df)_mm512_setzero_pd(), -1, C)
+#define _mm512_exp2a23_round_ps(A,C) __builtin_ia32_exp2ps_mask(A, (__v16sf)_mm512_setzero_ps(), -1, C)
+#define _mm_cmpistri(X,Y,M) ((int) __builtin_ia32_pcmpistri128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _mm_cmpistrm(X,Y,M) ((__m128i) __builtin_ia32_pcmpistrm128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _mm_cmpistro(X,Y,M) ((int) __builtin_ia32_pcmpistrio128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _mm_cmpistrs(X,Y,M) ((int) __builtin_ia32_pcmpistris128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _mm_mask_i64gather_ps(SRC,BASE,INDEX,MASK,SCALE) (__m128) __builtin_ia32_gatherdiv4sf ((__v4sf)(__m128) (SRC), (float const *) (BASE), (__v2di)(__m128i) (INDEX), (__v4sf)(__m128) (MASK), (int) (SCALE))
+#define _mm_cmpistrz(X,Y,M) ((int) __builtin_ia32_pcmpistriz128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _mm512_getmant_round_pd(X,B,C,R) ((__m512d)__builtin_ia32_getmantpd512_mask ((__v8df)(__m512d)(X), (int)(((C)<<2) | (B)), (__v8df)(__m512d)_mm512_undefined_pd(), (__mmask8)-1, (R)))
+#define _mm512_getmant_round_ph(X,B,C,R) ((__m512h)__builtin_ia32_getmantph512_mask ((__v32hf)(__m512h)(X), (int)(((C)<<2) | (B)), (__v32hf)(__m512h) _mm512_setzero_ph(), (__mmask32)-1, (R)))
+#define _mm512_fmsub_round_pd(A,B,C,R) (__m512d)__builtin_ia32_vfmsubpd512_mask(A, B, C, -1, R)
+#define _mm512_getmant_round_ps(X,B,C,R) ((__m512)__builtin_ia32_getmantps512_mask ((__v16sf)(__m512)(X), (int)(((C)<<2) | (B)), (__v16sf)(__m512)_mm512_undefined_ps(), (__mmask16)-1, (R)))
+#define _mm512_cvt_roundepi32_ps(A,B) (__m512)__builtin_ia32_cvtdq2ps512_mask((__v16si)(A), (__v16sf)_mm512_undefined_ps(), -1, B)
+#define _mm512_fmsub_round_ps(A,B,C,R) (__m512)__builtin_ia32_vfmsubps512_mask(A, B, C, -1, R)
+#define TIMER8 1
+#define _mm_mask_fpclass_ps_mask(u,X,C) ((__mmask8) __builtin_ia32_fpclassps128_mask ((__v4sf) (__m128) (X), (int) (C),(__mmask8)(u)))
+#define __PDP_ENDIAN 3412
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+#define __DEFINED_wchar_t 
+#define _mm_maskz_fcmul_round_sch(__A,__B,__C,__E) (__m128h) __builtin_ia32_vfcmulcsh_mask_round ((__v8hf) __B, (__v8hf) __C, _mm_setzero_ph (), __A, __E)
+#define _mm512_mask_cmp_round_pd_mask(M,X,Y,P,R) ((__mmask8) __builtin_ia32_cmppd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(P), (__mmask8)(M), R))
+#define _mm512_shuffle_epi32(X,C) ((__m512i) __builtin_ia32_pshufd512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_undefined_epi32 (), (__mmask16)-1))
+#define _mm512_mask_permutex_pd(W,U,X,M) ((__m512d) __builtin_ia32_permdf512_mask ((__v8df)(__m512d)(X), (int)(M), (__v8df)(__m512d)(W), (__mmask8)(U)))
+#define __UINT_FAST32_TYPE__ long unsigned int
+#define _mm_fnmadd_round_sd(A,B,C,R) (__m128d)__builtin_ia32_vfmaddsd3_round(A, -(B), C, R)
+#define _mm_fnmadd_round_sh(A,B,C,R) ((__m128h) __builtin_ia32_vfnmaddsh3_mask ((A), (B), (C), (-1), (R)))
+#define _mm256_cmp_epu8_mask(X,Y,P) ((__mmask32) __builtin_ia32_ucmpb256_mask ((__v32qi)(__m256i)(X), (__v32qi)(__m256i)(Y), (int)(P), (__mmask32)-1))
+#define __DEFINED_size_t 
+#define _mm512_cvt_roundph_epi64(A,B) (__builtin_ia32_vcvtph2qq512_mask_round ((A), _mm512_setzero_si512 (), (__mmask8)-1, (B)))
+#define _mm_fnmadd_round_ss(A,B,C,R) (__m128)__builtin_ia32_vfmaddss3_round(A, -(B), C, R)
+#define FD_SETSIZE __FD_SETSIZE
+#define __CFLOAT128 _Complex _Float128
+#define _mm_getmant_round_sd(X,Y,C,D,R) ((__m128d)__builtin_ia32_getmantsd_round ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(((D)<<2) | (C)), (R)))
+#define _mm512_mask_getmant_ps(W,U,X,B,C) ((__m512)__builtin_ia32_getmantps512_mask ((__v16sf)(__m512)(X), (int)(((C)<<2) | (B)), (__v16sf)(__m512)(W), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm_getmant_round_sh(X,Y,C,D,R) ((__m128h)__builtin_ia32_getmantsh_mask_round ((__v8hf)(__m128h)(X), (__v8hf)(__m128h)(Y), (int)(((D)<<2) | (C)), (__v8hf)(__m128h) _mm_setzero_ph (), (__mmask8)-1, (R)))
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+#define __SIG_ATOMIC_TYPE__ int
+#define _mm512_mask_mul_round_pd(W,U,A,B,C) (__m512d)__builtin_ia32_mulpd512_mask(A, B, W, U, C)
+#define _mm_getmant_round_ss(X,Y,C,D,R) ((__m128)__builtin_ia32_getmantss_round ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(((D)<<2) | (C)), (R)))
+#define _mm512_mask_mul_round_ps(W,U,A,B,C) (__m512)__builtin_ia32_mulps512_mask(A, B, W, U, C)
+#define _mm_cvtt_roundsd_i64(A,B) ((long long)__builtin_ia32_vcvttsd2si64(A, B))
+#define _mm_sub_round_sd(A,B,C) (__m128d)__builtin_ia32_subsd_round(A, B, C)
+#define _mm512_mask3_fmadd_round_pch(A,B,C,D,E) (__m512h) __builtin_ia32_vfmaddcph512_mask3_round ((A), (B), (C), (D), (E))
+#define __DBL_MIN_10_EXP__ (-307)
+#define _mm_sub_round_ss(A,B,C) (__m128)__builtin_ia32_subss_round(A, B, C)
+#define _RTMINTRIN_H_INCLUDED 
+#define _mm512_mask_range_pd(W,U,A,B,C) ((__m512d) __builtin_ia32_rangepd512_mask ((__v8df)(__m512d)(A), (__v8df)(__m512d)(B), (int)(C), (__v8df)(__m512d)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm256_maskz_shufflehi_epi16(U,A,B) ((__m256i) __builtin_ia32_pshufhw256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)(__m256i)_mm256_setzero_si256 (), (__mmask16)(U)))
+#define _mm512_range_round_pd(A,B,C,R) ((__m512d) __builtin_ia32_rangepd512_mask ((__v8df)(__m512d)(A), (__v8df)(__m512d)(B), (int)(C), (__v8df)_mm512_setzero_pd (), (__mmask8)-1, (R)))
+#define _mm512_mask_range_ps(W,U,A,B,C) ((__m512) __builtin_ia32_rangeps512_mask ((__v16sf)(__m512)(A), (__v16sf)(__m512)(B), (int)(C), (__v16sf)(__m512)(W), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_range_round_ps(A,B,C,R) ((__m512) __builtin_ia32_rangeps512_mask ((__v16sf)(__m512)(A), (__v16sf)(__m512)(B), (int)(C), (__v16sf)_mm512_setzero_ps (), (__mmask16)-1, (R)))
+#define __DISABLE_AVX512VLCD__ 
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+#define _MM_FROUND_TO_POS_INF 0x02
+#define _mm_maskz_add_round_sh(A,B,C,D) ((__m128h)__builtin_ia32_addsh_mask_round ((B), (C), _mm_setzero_ph (), (A), (D)))
+#define _mm_mask_blend_epi8(__U,__A,__W) ((__m128i) __builtin_ia32_blendmb_128_mask ((__v16qi) (__A), (__v16qi) (__W), (__mmask16) (__U)))
+#define __u_char_defined 
+#define _MM_FLUSH_ZERO_MASK 0x8000
+#define _mm256_floor_ps(V) _mm256_round_ps ((V), _MM_FROUND_FLOOR)
+#define _mm_mask_roundscale_pd(W,U,A,B) ((__m128d) __builtin_ia32_rndscalepd_128_mask ((__v2df)(__m128d)(A), (int)(B), (__v2df)(__m128d)(W), (__mmask8)(U)))
+#define __FLT32_HAS_DENORM__ 1
+#define _mm_mask_roundscale_ph(A,B,C,D) (__builtin_ia32_rndscaleph128_mask ((C), (D), (A), (B)))
+#define SPI_CH 1
+#define _AVX512BITALGINTRIN_H_INCLUDED 
+#define _mm_mask_roundscale_ps(W,U,A,B) ((__m128) __builtin_ia32_rndscaleps_128_mask ((__v4sf)(__m128)(A), (int)(B), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define _mm_mask3_fnmadd_round_sh(A,B,C,U,R) ((__m128h) __builtin_ia32_vfnmaddsh3_mask3 ((A), (B), (C), (U), (R)))
+#define _mm512_maskz_inserti32x4(A,X,Y,C) ((__m512i) __builtin_ia32_inserti32x4_mask ((__v16si)(__m512i) (X), (__v4si)(__m128i) (Y), (int) (C), (__v16si)_mm512_setzero_si512 (), (__mmask16)(A)))
+#define _mm_cvt_roundi32_sh(A,B,C) (__builtin_ia32_vcvtsi2sh32_round ((A), (B), (C)))
+#define __UINT_FAST8_MAX__ 0xff
+#define __LEAF , __leaf__
+#define _mm512_gf2p8affineinv_epi64_epi8(A,B,C) ((__m512i) __builtin_ia32_vgf2p8affineinvqb_v64qi ( (__v64qi)(__m512i)(A), (__v64qi)(__m512i)(B), (int)(C)))
+#define _MM_TRANSPOSE4_PS(row0,row1,row2,row3) do { __v4sf __r0 = (row0), __r1 = (row1), __r2 = (row2), __r3 = (row3); __v4sf __t0 = __builtin_ia32_unpcklps (__r0, __r1); __v4sf __t1 = __builtin_ia32_unpcklps (__r2, __r3); __v4sf __t2 = __builtin_ia32_unpckhps (__r0, __r1); __v4sf __t3 = __builtin_ia32_unpckhps (__r2, __r3); (row0) = __builtin_ia32_movlhps (__t0, __t1); (row1) = __builtin_ia32_movhlps (__t1, __t0); (row2) = __builtin_ia32_movlhps (__t2, __t3); (row3) = __builtin_ia32_movhlps (__t3, __t2); } while (0)
+#define _BITS_TYPES_LOCALE_T_H 1
+#define SCNdLEAST8 "hhd"
+#define _mm512_maskz_fmsubadd_round_pd(U,A,B,C,R) (__m512d)__builtin_ia32_vfmaddsubpd512_maskz(A, B, -(C), U, R)
+#define BIT_GET(p,m) ((p) & (m))
+#define _mm512_maskz_fmsubadd_round_ph(U,A,B,C,R) ((__m512h)__builtin_ia32_vfmsubaddph512_maskz ((A), (B), (C), (U), (R)))
+#define _mm512_ternarylogic_epi32(A,B,C,I) ((__m512i) __builtin_ia32_pternlogd512_mask ((__v16si) (__m512i) (A), (__v16si) (__m512i) (B), (__v16si) (__m512i) (C), (unsigned char) (I), (__mmask16) -1))
+#define _WCHAR_T_DEFINED 
+#define _mm512_maskz_fmsubadd_round_ps(U,A,B,C,R) (__m512)__builtin_ia32_vfmaddsubps512_maskz(A, B, -(C), U, R)
+#define _tile_dpbssd(dst,src1,src2) _tile_int8_dp_internal (tdpbssd, dst, src1, src2)
+#define _mm256_mask_dbsad_epu8(W,U,X,Y,C) ((__m256i) __builtin_ia32_dbpsadbw256_mask ((__v32qi)(__m256i) (X), (__v32qi)(__m256i) (Y), (int) (C), (__v16hi)(__m256i)(W), (__mmask16)(U)))
+#define __pic__ 2
+#define _mm_mask_add_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_addsd_mask_round(A, B, W, U, C)
+#define _mm_mask_roundscale_sd(A,U,B,C,I) ((__m128d) __builtin_ia32_rndscalesd_mask_round ((__v2df) (__m128d) (B), (__v2df) (__m128d) (C), (int) (I), (__v2df) (__m128d) (A), (__mmask8) (U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_cvt_roundpd_epi32(A,B) ((__m256i)__builtin_ia32_cvtpd2dq512_mask(A, (__v8si)_mm256_undefined_si256(), -1, B))
+#define _mm_mask_roundscale_ss(A,U,B,C,I) ((__m128) __builtin_ia32_rndscaless_mask_round ((__v4sf) (__m128) (B), (__v4sf) (__m128) (C), (int) (I), (__v4sf) (__m128) (A), (__mmask8) (U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_extracti64x2_epi64(X,C) ((__m128i) __builtin_ia32_extracti64x2_512_mask ((__v8di)(__m512i) (X), (int) (C), (__v2di)(__m128i) _mm_setzero_si128 (), (__mmask8)-1))
+#define __INT_LEAST8_WIDTH__ 8
+#define _mm_maskz_roundscale_round_sh(A,B,C,D,E) (__builtin_ia32_rndscalesh_mask_round ((B), (C), (D), _mm_setzero_ph (), (A), (E)))
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+#define _mm512_maskz_shuffle_f32x4(U,X,Y,C) ((__m512) __builtin_ia32_shuf_f32x4_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(C), (__v16sf)(__m512)_mm512_setzero_ps(), (__mmask16)(U)))
+#define __stub_sigreturn 
+#define _mm256_maskz_inserti64x2(U,X,Y,C) ((__m256i) __builtin_ia32_inserti64x2_256_mask ((__v4di)(__m256i) (X), (__v2di)(__m128i) (Y), (int) (C), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define __always_inline __inline __attribute__ ((__always_inline__))
+#define _mm512_cvt_roundepu64_ph(A,B) (__builtin_ia32_vcvtuqq2ph512_mask_round ((__v8di)(A), _mm_setzero_ph (), (__mmask8)-1, (B)))
+#define SCNd8 "hhd"
+#define _mm512_cmul_round_pch(A,B,R) _mm512_fcmul_round_pch ((A), (B), (R))
+#define _mm_fixupimm_round_sd(X,Y,Z,C,R) ((__m128d)__builtin_ia32_fixupimmsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(-1), (R)))
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+#define _mm_fixupimm_round_ss(X,Y,Z,C,R) ((__m128)__builtin_ia32_fixupimmss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(-1), (R)))
+#define _mm512_mask_cvtx_roundps_ph(A,B,C,D) (__builtin_ia32_vcvtps2phx512_mask_round ((__v16sf)(C), (A), (B), (D)))
+#define _mm512_mask3_fmaddsub_round_pd(A,B,C,U,R) (__m512d)__builtin_ia32_vfmaddsubpd512_mask3(A, B, C, U, R)
+#define _mm256_mask_cvt_roundps_ph(A,B,C,D) _mm256_mask_cvtps_ph ((A), (B), (C), (D))
+#define _mm256_cmp_epi64_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpq256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(P), (__mmask8)-1))
+#define _mm512_cvt_roundpd_epi64(A,B) ((__m512i)__builtin_ia32_cvtpd2qq512_mask ((A), (__v8di)_mm512_setzero_si512 (), -1, (B)))
+#define _mm_mask_rcp28_round_sd(W,U,A,B,R) __builtin_ia32_rcp28sd_mask_round ((A), (B), (W), (U), (R))
+#define PIN_MODE_PWM 4
+#define _mm_mask_rcp28_round_ss(W,U,A,B,R) __builtin_ia32_rcp28ss_mask_round ((A), (B), (W), (U), (R))
+#define _mm_mask_fpclass_sd_mask(X,C,U) ((__mmask8) __builtin_ia32_fpclasssd_mask ((__v2df) (__m128d) (X), (int) (C), (__mmask8) (U)))
+#define __fortify_function __extern_always_inline __attribute_artificial__
+#define _xabort(N) __builtin_ia32_xabort (N)
+#define _mm512_mask_cmp_ph_mask(A,B,C,D) (__builtin_ia32_cmpph512_mask ((B), (C), (D), (A)))
+#define _mm_maskz_gf2p8affineinv_epi64_epi8(A,B,C,D) ((__m128i) __builtin_ia32_vgf2p8affineinvqb_v16qi_mask( (__v16qi)(__m128i)(B), (__v16qi)(__m128i)(C), (int)(D), (__v16qi)(__m128i) _mm_setzero_si128 (), (__mmask16)(A)))
+#define _mm512_mask_div_round_pd(W,U,A,B,C) (__m512d)__builtin_ia32_divpd512_mask(A, B, W, U, C)
+#define _mm512_mask_div_round_ph(A,B,C,D,E) ((__m512h)__builtin_ia32_divph512_mask_round((C), (D), (A), (B), (E)))
+#define _mm512_mask_mul_round_pch(W,U,A,B,R) _mm512_mask_fmul_round_pch ((W), (U), (A), (B), (R))
+#define _mm_gf2p8affine_epi64_epi8(A,B,C) ((__m128i) __builtin_ia32_vgf2p8affineqb_v16qi ((__v16qi)(__m128i)(A), (__v16qi)(__m128i)(B), (int)(C)))
+#define SCNd16 "hd"
+#define _LWPINTRIN_H_INCLUDED 
+#define __UINT_LEAST8_MAX__ 0xff
+#define _mm_mask3_fnmsub_round_sh(A,B,C,U,R) ((__m128h) __builtin_ia32_vfmsubsh3_mask3 ((A), -(B), (C), (U), (R)))
+#define __UINTMAX_TYPE__ long unsigned int
+#define _SIDD_CMP_EQUAL_ANY 0x00
+#define SCNd32 "d"
+#define _mm256_ternarylogic_epi64(A,B,C,I) ((__m256i) __builtin_ia32_pternlogq256_mask ((__v4di) (__m256i) (A), (__v4di) (__m256i) (B), (__v4di) (__m256i) (C), (unsigned char) (I), (__mmask8) -1))
+#define BIT_WRITE(c,p,m) (c ? BIT_SET(p,m) : BIT_CLEAR(p,m))
+#define __linux 1
+#define _X86INTRIN_H_INCLUDED 
+#define _CMP_NEQ_OQ 0x0c
+#define _CMP_NEQ_OS 0x1c
+#define __lwpval32(D2,D1,F) (__builtin_ia32_lwpval32 ((unsigned int) (D2), (unsigned int) (D1), (unsigned int) (F)))
+#define _mm_shrdi_epi16(A,B,C) ((__m128i) __builtin_ia32_vpshrd_v8hi ((__v8hi)(__m128i)(A), (__v8hi)(__m128i)(B),(int)(C)))
+#define _mm512_cvtt_roundph_epu16(A,B) ((__m512i) __builtin_ia32_vcvttph2uw512_mask_round ((A), (__v32hi) _mm512_setzero_si512 (), (__mmask32)-1, (B)))
+#define _mm_insert_ps(D,S,N) ((__m128) __builtin_ia32_insertps128 ((__v4sf)(__m128)(D), (__v4sf)(__m128)(S), (int)(N)))
+#define _mm512_setr_epi64(e0,e1,e2,e3,e4,e5,e6,e7) _mm512_set_epi64(e7,e6,e5,e4,e3,e2,e1,e0)
+#define __unix 1
+#define _BITS_PTHREADTYPES_ARCH_H 1
+#define _mm_cmp_pd_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmppd128_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P), (__mmask8)-1))
+#define _mm512_rcp28_round_pd(A,C) __builtin_ia32_rcp28pd_mask(A, (__v8df)_mm512_setzero_pd(), -1, C)
+#define __UINT32_MAX__ 0xffffffffU
+#define _mm512_rcp28_round_ps(A,C) __builtin_ia32_rcp28ps_mask(A, (__v16sf)_mm512_setzero_ps(), -1, C)
+#define __SIZE_T 
+#define _mm_mask_mul_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_mulsd_mask_round(A, B, W, U, C)
+#define _mm_mask_mul_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_mulss_mask_round(A, B, W, U, C)
+#define SCNd64 __PRI64_PREFIX "d"
+#define _mm512_mask_i32scatter_epi32(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv16si ((void *) (ADDR), (__mmask16) (MASK), (__v16si)(__m512i) (INDEX), (__v16si)(__m512i) (V1), (int) (SCALE))
+#define _mm512_maskz_mul_round_pd(U,A,B,C) (__m512d)__builtin_ia32_mulpd512_mask(A, B, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm512_cvtt_roundph_epu32(A,B) ((__m512i) __builtin_ia32_vcvttph2udq512_mask_round ((A), (__v16si) _mm512_setzero_si512 (), (__mmask16)-1, (B)))
+#define _mm_dpwssd_epi32(A,B,C) ((__m128i) __builtin_ia32_vpdpwssd_v4si ((__v4si) (A), (__v4si) (B), (__v4si) (C)))
+#define _ATFILE_SOURCE 1
+#define SCNuLEAST16 "hu"
+#define __FLT128_MIN_EXP__ (-16381)
+#define __lwpval64(D2,D1,F) (__builtin_ia32_lwpval64 ((unsigned long long) (D2), (unsigned int) (D1), (unsigned int) (F)))
+#define _mm512_maskz_mul_round_ph(A,B,C,D) ((__m512h)__builtin_ia32_mulph512_mask_round((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define __enclu_generic(leaf,b,c,d,retval) __asm__ __volatile__("enclu\n\t" : "=a" (retval), "=b" (b), "=c" (c), "=d" (d) : "a" (leaf), "b" (b), "c" (c), "d" (d) : "cc")
+#define WUNTRACED 2
+#define UINT16_C(c) c
+#define _mm512_maskz_cvtt_roundph_epi64(A,B,C) (__builtin_ia32_vcvttph2qq512_mask_round ((B), _mm512_setzero_si512 (), (A), (C)))
+#define _mm512_maskz_cvtt_roundph_epu16(A,B,C) ((__m512i) __builtin_ia32_vcvttph2uw512_mask_round ((B), (__v32hi) _mm512_setzero_si512 (), (A), (C)))
+#define _mm_cvt_roundi64_sd(A,B,C) (__m128d)__builtin_ia32_cvtsi2sd64(A, B, C)
+#define SCNo8 "hho"
+#define NULL ((void *)0)
+#define _mm512_fmul_round_pch(A,B,D) (__m512h) __builtin_ia32_vfmulcph512_round ((A), (B), (D))
+#define _mm512_mask_i32scatter_epi64(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv8di ((void *) (ADDR), (__mmask8) (MASK), (__v8si)(__m256i) (INDEX), (__v8di)(__m512i) (V1), (int) (SCALE))
+#define _mm_cvt_roundi64_ss(A,B,C) (__m128)__builtin_ia32_cvtsi2ss64(A, B, C)
+#define __f64x(x) x ##f64x
+#define _mm_mask_shufflelo_epi16(W,U,A,B) ((__m128i) __builtin_ia32_pshuflw128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)(__m128i)(W), (__mmask8)(U)))
+#define EXIT_FAILURE 1
+#define _AVX512IFMAVLINTRIN_H_INCLUDED 
+#define _mm256_mask_cmp_epi32_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpd256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(P), (__mmask8)(M)))
+#define _SIZE_T_DEFINED_ 
+#define _mm256_permutexvar_ps(A,B) _mm256_permutevar8x32_ps ((B), (A))
+#define _mm512_maskz_extractf32x8_ps(U,X,C) ((__m256) __builtin_ia32_extractf32x8_mask ((__v16sf)(__m512) (X), (int) (C), (__v8sf)(__m256) _mm256_setzero_ps (), (__mmask8) (U)))
+#define _CMP_NEQ_UQ 0x04
+#define _CMP_NEQ_US 0x14
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __SCHAR_MAX__ 0x7f
+#define _mm_maskz_scalef_round_sd(U,A,B,C) ((__m128d) __builtin_ia32_scalefsd_mask_round ((A), (B), (__v2df) _mm_setzero_pd (), (U), (C)))
+#define _mm_maskz_scalef_round_sh(A,B,C,D) (__builtin_ia32_scalefsh_mask_round ((B), (C), _mm_setzero_ph (), (A), (D)))
+#define _mm_max_round_ss(A,B,C) (__m128)__builtin_ia32_maxss_round(A, B, C)
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+#define _mm_maskz_scalef_round_ss(U,A,B,C) ((__m128) __builtin_ia32_scalefss_mask_round ((A), (B), (__v4sf) _mm_setzero_ps (), (U), (C)))
+#define _mm_fnmsub_round_sd(A,B,C,R) (__m128d)__builtin_ia32_vfmaddsd3_round(A, -(B), -(C), R)
+#define _XSAVECINTRIN_H_INCLUDED 
+#define __FLT32X_HAS_QUIET_NAN__ 1
+#define __KERNEL_STRICT_NAMES 
+#define SCNxFAST16 __PRIPTR_PREFIX "x"
+#define _mm512_maskz_fmadd_round_pd(U,A,B,C,R) (__m512d)__builtin_ia32_vfmaddpd512_maskz(A, B, C, U, R)
+#define _mm512_maskz_fmadd_round_ps(U,A,B,C,R) (__m512)__builtin_ia32_vfmaddps512_maskz(A, B, C, U, R)
+#define __INT64_C(c) c ## L
+#define SCNuLEAST64 __PRI64_PREFIX "u"
+#define _mm256_mask_permute_pd(W,U,X,C) ((__m256d) __builtin_ia32_vpermilpd256_mask ((__v4df)(__m256d)(X), (int)(C), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define _mm256_mask_permute_ps(W,U,X,C) ((__m256) __builtin_ia32_vpermilps256_mask ((__v8sf)(__m256)(X), (int)(C), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _mm512_maskz_fmadd_round_ph(U,A,B,C,R) ((__m512h)__builtin_ia32_vfmaddph512_maskz ((A), (B), (C), (U), (R)))
+#define _mm_mask_scalef_sd(W,U,A,B) _mm_mask_scalef_round_sd ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm_maskz_getmant_sd(U,X,Y,C,D) ((__m128d)__builtin_ia32_getmantsd_mask_round ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(((D)<<2) | (C)), (__v2df)_mm_setzero_pd(), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_cmp_epu16_mask(X,Y,P) ((__mmask32) __builtin_ia32_ucmpw512_mask ((__v32hi)(__m512i)(X), (__v32hi)(__m512i)(Y), (int)(P), (__mmask32)(-1)))
+#define _mm_mask_scalef_ss(W,U,A,B) _mm_mask_scalef_round_ss ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm256_permutex_pd(X,M) ((__m256d) __builtin_ia32_permdf256_mask ((__v4df)(__m256d)(X), (int)(M), (__v4df)(__m256d) _mm256_undefined_pd (), (__mmask8)-1))
+#define _mm256_mmask_i64gather_ps(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128) __builtin_ia32_gather3div8sf ((__v4sf)(__m128) (V1OLD), (void const *) (ADDR), (__v4di)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _AVX512PFINTRIN_H_INCLUDED 
+#define _XMMINTRIN_H_INCLUDED 
+#define _mm_mask_reduce_pd(W,U,A,B) ((__m128d) __builtin_ia32_reducepd128_mask ((__v2df)(__m128d)(A), (int)(B), (__v2df)(__m128d)(W), (__mmask8)(U)))
+#define _mm_mask_reduce_ph(A,B,C,D) (__builtin_ia32_reduceph128_mask ((C), (D), (A), (B)))
+#define _mm512_mask_shrdi_epi16(A,B,C,D,E) ((__m512i) __builtin_ia32_vpshrd_v32hi_mask ((__v32hi)(__m512i)(C), (__v32hi)(__m512i)(D), (int)(E), (__v32hi)(__m512i)(A), (__mmask32)(B)))
+#define _mm_maskz_cmul_round_sch(U,A,B,R) _mm_maskz_fcmul_round_sch ((U), (A), (B), (R))
+#define __SIZEOF_FLOAT128__ 16
+#define _mm_mask_shrdi_epi16(A,B,C,D,E) ((__m128i) __builtin_ia32_vpshrd_v8hi_mask ((__v8hi)(__m128i)(C), (__v8hi)(__m128i)(D), (int)(E), (__v8hi)(__m128i)(A), (__mmask8)(B)))
+#define _POSIX_SOURCE 1
+#define SCNu8 "hhu"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+#define _mm512_mask_dbsad_epu8(W,U,X,Y,C) ((__m512i) __builtin_ia32_dbpsadbw512_mask ((__v64qi)(__m512i) (X), (__v64qi)(__m512i) (Y), (int) (C), (__v32hi)(__m512i)(W), (__mmask32)(U)))
+#define __PRAGMA_REDEFINE_EXTNAME 1
+#define _mm_maskz_getmant_sh(U,X,Y,C,D) ((__m128h)__builtin_ia32_getmantsh_mask_round ((__v8hf)(__m128h)(X), (__v8hf)(__m128h)(Y), (int)(((D)<<2) | (C)), (__v8hf)(__m128h) _mm_setzero_ph(), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _SIDD_CMP_RANGES 0x04
+#define __attribute_used__ __attribute__ ((__used__))
+#define SCNxFAST64 __PRI64_PREFIX "x"
+#define CLOCK_REALTIME 0
+#define _mm512_mask_shrdi_epi32(A,B,C,D,E) ((__m512i) __builtin_ia32_vpshrd_v16si_mask ((__v16si)(__m512i)(C), (__v16si)(__m512i)(D), (int)(E), (__v16si)(__m512i)(A), (__mmask16)(B)))
+#define _mm512_mask_cvtx_roundph_ps(A,B,C,D) (__builtin_ia32_vcvtph2psx512_mask_round ((C), (A), (B), (D)))
+#define _mm512_mask_cmp_ps_mask(M,X,Y,P) ((__mmask16) __builtin_ia32_cmpps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(P), (__mmask16)(M),_MM_FROUND_CUR_DIRECTION))
+#define _mm_mask_div_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_divsd_mask_round(A, B, W, U, C)
+#define _mm_mask_cmp_ps_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpps128_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P), (__mmask8)(M)))
+#define _mm_mask_div_round_sh(A,B,C,D,E) ((__m128h)__builtin_ia32_divsh_mask_round ((C), (D), (A), (B), (E)))
+#define _mm256_mask_permutex_pd(W,U,A,B) ((__m256d) __builtin_ia32_permdf256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+#define PRIuFAST16 __PRIPTR_PREFIX "u"
+#define _mm_test_all_zeros(M,V) _mm_testz_si128 ((M), (V))
+#define _mm_mask_i32scatter_pd(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv2df ((void *) (ADDR), (__mmask8) (MASK), (__v4si)(__m128i) (INDEX), (__v2df)(__m128d) (V1), (int) (SCALE))
+#define _mm_mask_reduce_sd(W,U,A,B,C) ((__m128d) __builtin_ia32_reducesd_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)(__m128d)(W), (__mmask8)(U)))
+#define _mm_mask_reduce_sh(A,B,C,D,E) (__builtin_ia32_reducesh_mask_round ((C), (D), (E), (A), (B), _MM_FROUND_CUR_DIRECTION))
+#define _mm_mask_i32scatter_ps(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv4sf ((void *) (ADDR), (__mmask8) (MASK), (__v4si)(__m128i) (INDEX), (__v4sf)(__m128) (V1), (int) (SCALE))
+#define _mm256_mask_rol_epi32(W,U,A,B) ((__m256i)__builtin_ia32_prold256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define _mm_mask_reduce_ss(W,U,A,B,C) ((__m128) __builtin_ia32_reducess_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+#define SCNx8 "hhx"
+#define _BITS_ENDIANNESS_H 1
+#define _mm_mask_fnmadd_round_ss(A,U,B,C,R) (__m128) __builtin_ia32_vfmaddss3_mask (A, -(B), C, U, R)
+#define __GLIBC__ 2
+#define PRIuFAST32 __PRIPTR_PREFIX "u"
+#define _mm256_cmp_epi8_mask(X,Y,P) ((__mmask32) __builtin_ia32_cmpb256_mask ((__v32qi)(__m256i)(X), (__v32qi)(__m256i)(Y), (int)(P), (__mmask32)(-1)))
+#define _tile_dpbsud(dst,src1,src2) _tile_int8_dp_internal (tdpbsud, dst, src1, src2)
+#define _mm_mask_gf2p8affineinv_epi64_epi8(A,B,C,D,E) ((__m128i) __builtin_ia32_vgf2p8affineinvqb_v16qi_mask( (__v16qi)(__m128i)(C), (__v16qi)(__m128i)(D), (int)(E), (__v16qi)(__m128i)(A), (__mmask16)(B)))
+#define _kshiftri_mask16(X,Y) ((__mmask16) __builtin_ia32_kshiftrihi ((__mmask16)(X), (__mmask8)(Y)))
+#define WCONTINUED 8
+#define _AMMINTRIN_H_INCLUDED 
+#define _mm512_mask_shrdi_epi64(A,B,C,D,E) ((__m512i) __builtin_ia32_vpshrd_v8di_mask ((__v8di)(__m512i)(C), (__v8di)(__m512i)(D), (int)(E), (__v8di)(__m512i)(A), (__mmask8)(B)))
+#define _mm512_mask_exp2a23_pd(W,U,A) _mm512_mask_exp2a23_round_pd(W, U, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm_mask_shrdi_epi64(A,B,C,D,E) ((__m128i) __builtin_ia32_vpshrd_v2di_mask ((__v2di)(__m128i)(C), (__v2di)(__m128i)(D), (int)(E), (__v2di)(__m128i)(A), (__mmask8)(B)))
+#define _mm256_maskz_getmant_ph(U,X,B,C) ((__m256h) __builtin_ia32_getmantph256_mask ((__v16hf)(__m256h) (X), (int)(((C)<<2) | (B)), (__v16hf)(__m256h)_mm256_setzero_ph (), (__mmask16)(U)))
+#define __LDBL_HAS_INFINITY__ 1
+#define GPIO_ATOMIC(pin,expr) do { if (pin < GPIO_ATOMIC_MAX) { expr; } else { uint8_t sreg = SREG; __asm__ __volatile__("cli" ::: "memory"); expr; SREG = sreg; __asm__ __volatile__("" ::: "memory"); } } while (0)
+#define __FIRMWARE_ARCH_BOGUS__ 1
+#define _mm512_maskz_cvtt_roundpd_epu32(U,A,B) ((__m256i)__builtin_ia32_cvttpd2udq512_mask(A, (__v8si)_mm256_setzero_si256(), U, B))
+#define _mm256_mask_rol_epi64(W,U,A,B) ((__m256i)__builtin_ia32_prolq256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define _BITS_UINTN_IDENTITY_H 1
+#define _mm_mask_cmp_sd_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P), M,_MM_FROUND_CUR_DIRECTION))
+#define __fsfilcnt_t_defined 
+#define _mm_mask_mul_round_sch(W,U,A,B,R) _mm_mask_fmul_round_sch ((W), (U), (A), (B), (R))
+#define _mm_roundscale_sh(A,B,C) (__builtin_ia32_rndscalesh_mask_round ((A), (B), (C), _mm_setzero_ph (), (__mmask8)-1, _MM_FROUND_CUR_DIRECTION))
+#define _BITS_TYPESIZES_H 1
+#define _mm512_clmulepi64_epi128(A,B,C) ((__m512i) __builtin_ia32_vpclmulqdq_v8di ((__v8di)(__m512i)(A), (__v8di)(__m512i)(B), (int)(C)))
+#define _BSD_SIZE_T_DEFINED_ 
+#define __FLT32_DIG__ 6
+#define _CMP_GE_OQ 0x1d
+#define _CMP_GE_OS 0x0d
+#define __RLIM_T_MATCHES_RLIM64_T 1
+#define _mm512_maskz_cvtt_roundpd_epu64(U,A,B) ((__m512i)__builtin_ia32_cvttpd2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define _mm_mask_cmul_round_sch(W,U,A,B,R) _mm_mask_fcmul_round_sch ((W), (U), (A), (B), (R))
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+#define _AVX512VLINTRIN_H_INCLUDED 
+#define _mm256_maskz_cvtps_ph(U,A,I) ((__m128i) __builtin_ia32_vcvtps2ph256_mask ((__v8sf)(__m256) (A), (int) (I), (__v8hi)(__m128i) _mm_setzero_si128 (), (__mmask8) (U)))
+#define NFDBITS __NFDBITS
+#define _mm512_extractf64x2_pd(X,C) ((__m128d) __builtin_ia32_extractf64x2_512_mask ((__v8df)(__m512d) (X), (int) (C), (__v2df)(__m128d) _mm_setzero_pd (), (__mmask8)-1))
+#define _mm256_cmp_ph_mask(A,B,C) (__builtin_ia32_cmpph256_mask ((A), (B), (C), (-1)))
+#define _MM_MK_INSERTPS_NDX(S,D,M) (((S) << 6) | ((D) << 4) | (M))
+#define _AVX512BF16VLINTRIN_H_INCLUDED 
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define _mm_maskz_getmant_round_sh(U,X,Y,C,D,R) ((__m128h)__builtin_ia32_getmantsh_mask_round ((__v8hf)(__m128h)(X), (__v8hf)(__m128h)(Y), (int)(((D)<<2) | (C)), (__v8hf)(__m128h) _mm_setzero_ph(), (__mmask8)(U), (R)))
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define _mm_maskz_getmant_round_ss(U,X,Y,C,D,R) ((__m128)__builtin_ia32_getmantss_mask_round ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(((D)<<2) | (C)), (__v4sf)(__m128)_mm_setzero_ps(), (__mmask8)(U), (R)))
+#define _mm_maskz_getmant_round_sd(U,X,Y,C,D,R) ((__m128d)__builtin_ia32_getmantsd_mask_round ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(((D)<<2) | (C)), (__v2df)(__m128d)_mm_setzero_pd(), (__mmask8)(U), (R)))
+#define _mm_maskz_cvtss_sd(U,A,B) _mm_maskz_cvt_roundss_sd ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm512_mask_cvt_roundepu64_pd(W,U,A,B) ((__m512d)__builtin_ia32_cvtuqq2pd512_mask ((__v8di)(A), (W), (U), (B)))
+#define _mm_prefetch(P,I) __builtin_prefetch ((P), ((I & 0x4) >> 2), (I & 0x3))
+#define _mm512_mul_round_pch(A,B,R) _mm512_fmul_round_pch ((A), (B), (R))
+#define __STDC_UTF_16__ 1
+#define __DBL_IS_IEC_60559__ 2
+#define _mm512_getmant_pd(X,B,C) ((__m512d)__builtin_ia32_getmantpd512_mask ((__v8df)(__m512d)(X), (int)(((C)<<2) | (B)), (__v8df)_mm512_undefined_pd(), (__mmask8)-1, _MM_FROUND_CUR_DIRECTION))
+#define _mm512_getmant_ph(X,B,C) ((__m512h)__builtin_ia32_getmantph512_mask ((__v32hf)(__m512h)(X), (int)(((C)<<2) | (B)), (__v32hf)(__m512h) _mm512_setzero_ph(), (__mmask32)-1, _MM_FROUND_CUR_DIRECTION))
+#define le32toh(x) __uint32_identity (x)
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+#define _mm512_mask_rsqrt28_round_ps(W,U,A,C) __builtin_ia32_rsqrt28ps_mask(A, W, U, C)
+#define _mm_mask_sqrt_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_sqrtsd_mask_round (B, A, W, U, C)
+#define __DEC32_MAX__ 9.999999E96DF
+#define PIN_IS_DIGITAL(p) (0)
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+#define _mm_fpclass_sd_mask(X,C) ((__mmask8) __builtin_ia32_fpclasssd_mask ((__v2df) (__m128d) (X), (int) (C), (__mmask8) (-1)))
+#define _mm512_mask_cvt_roundps_pd(W,U,A,B) (__m512d)__builtin_ia32_cvtps2pd512_mask(A, (__v8df)(W), U, B)
+#define _mm512_mask_cvt_roundps_ph(U,W,A,I) ((__m256i) __builtin_ia32_vcvtps2ph512_mask ((__v16sf)(__m512) (A), (int) (I), (__v16hi)(__m256i)(U), (__mmask16) (W)))
+#define _mm256_mask_cmp_ph_mask(A,B,C,D) (__builtin_ia32_cmpph256_mask ((B), (C), (D), (A)))
+#define __SIZEOF_SHORT__ 2
+#define _XABORT_NESTED (1 << 5)
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+#define __FLT32X_HAS_INFINITY__ 1
+#define _mm_permute2_ps(X,Y,C,I) ((__m128) __builtin_ia32_vpermil2ps ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(C), (int)(I)))
+#define __INT32_MAX__ 0x7fffffff
+#define __GLIBC_USE_DEPRECATED_GETS 0
+#define __INT_WIDTH__ 32
+#define __SIZE_WIDTH__ 64
+#define __STDC_IEC_559__ 1
+#define __STDC_ISO_10646__ 201706L
+#define __PTRDIFF_WIDTH__ 64
+#define VCD_SIGNALS_MAX 64
+#define __DECIMAL_DIG__ 21
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+#define __USE_FORTIFY_LEVEL 0
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+#define _mm512_mask_cvt_roundepu64_ph(A,B,C,D) (__builtin_ia32_vcvtuqq2ph512_mask_round ((__v8di)(C), (A), (B), (D)))
+#define __enclu_bc(leaf,b,c,retval) __asm__ __volatile__("enclu\n\t" : "=a" (retval) : "a" (leaf), "b" (b), "c" (c) : "cc")
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+#define __DBL_DIG__ 15
+#define __MMX_WITH_SSE__ 1
+#define _mm_mask_cvt_roundss_sh(A,B,C,D,R) (__builtin_ia32_vcvtss2sh_mask_round ((D), (C), (A), (B), (R)))
+#define CLOCK_BOOTTIME 7
+#define __FLT128_IS_IEC_60559__ 2
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+#define _mm512_srli_epi16(A,B) ((__m512i) __builtin_ia32_psrlwi512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)_mm512_setzero_si512 (), (__mmask32)-1))
+#define _WCHAR_T_DEFINED_ 
+#define _mm_maskz_rcp28_round_ss(U,A,B,R) __builtin_ia32_rcp28ss_mask_round ((A), (B), (__v4sf) _mm_setzero_ps (), (U), (R))
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+#define _mm256_mask_cvtps_ph(W,U,A,I) ((__m128i) __builtin_ia32_vcvtps2ph256_mask ((__v8sf)(__m256) (A), (int) (I), (__v8hi)(__m128i) (W), (__mmask8) (U)))
+#define _mm512_mask_getexp_round_ps(W,U,A,R) ((__m512)__builtin_ia32_getexpps512_mask((__v16sf)(__m512)(A), (__v16sf)(__m512)(W), (__mmask16)(U), R))
+#define ____sigset_t_defined 
+#define _mm512_mask_cvt_roundepu64_ps(W,U,A,B) ((__m256)__builtin_ia32_cvtuqq2ps512_mask ((__v8di)(A), (W), (U), (B)))
+#define _CMP_EQ_UQ 0x08
+#define PRIX8 "X"
+#define _mm_cvtt_roundss_u64(A,B) ((unsigned long long)__builtin_ia32_vcvttss2usi64(A, B))
+#define PULSE_SLOTS (1000/PULSE_SLOT_US)
+#define __LDBL_HAS_QUIET_NAN__ 1
+#define INT64_C(c) c ## L
+#define _mm512_srli_epi32(X,C) ((__m512i) __builtin_ia32_psrldi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_undefined_epi32 (), (__mmask16)-1))
+#define _mm512_extractf32x4_ps(X,C) ((__m128) __builtin_ia32_extractf32x4_mask ((__v16sf)(__m512) (X), (int) (C), (__v4sf)(__m128)_mm_undefined_ps(), (__mmask8)-1))
+#define _mm_maskz_ror_epi64(U,A,B) ((__m128i)__builtin_ia32_prorq128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm_maskz_fmadd_round_ss(U,A,B,C,R) (__m128) __builtin_ia32_vfmaddss3_maskz (A, B, C, U, R)
+#define _mm_permute2_pd(X,Y,C,I) ((__m128d) __builtin_ia32_vpermil2pd ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(C), (int)(I)))
+#define _mm512_srai_epi16(A,B) ((__m512i) __builtin_ia32_psrawi512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)_mm512_setzero_si512 (), (__mmask32)-1))
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define htobe32(x) __bswap_32 (x)
+#define _mm256_roundscale_pd(A,B) ((__m256d) __builtin_ia32_rndscalepd_256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)(__m256d)_mm256_setzero_pd (), (__mmask8)-1))
+#define __LDBL_MANT_DIG__ 64
+#define _mm256_shuffle_f64x2(X,Y,C) ((__m256d) __builtin_ia32_shuf_f64x2_256_mask ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(C), (__v4df)(__m256d)_mm256_setzero_pd (), (__mmask8)-1))
+#define _mm256_roundscale_ps(A,B) ((__m256) __builtin_ia32_rndscaleps_256_mask ((__v8sf)(__m256)(A), (int)(B), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)-1))
+#define _mm_fcmadd_round_sch(A,B,C,D) __builtin_ia32_vfcmaddcsh_round ((A), (B), (C), (D))
+#define _mm512_fmaddsub_round_ph(A,B,C,R) ((__m512h)__builtin_ia32_vfmaddsubph512_mask ((A), (B), (C), -1, (R)))
+#define _mm512_mask_cmp_epi32_mask(M,X,Y,P) ((__mmask16) __builtin_ia32_cmpd512_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(P), (__mmask16)(M)))
+#define ___int_wchar_t_h 
+#define BIT_CLEAR(p,m) ((p) &= ~(m))
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+#define __GNUC__ 12
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+#define _mm512_srai_epi32(X,C) ((__m512i) __builtin_ia32_psradi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_undefined_epi32 (), (__mmask16)-1))
+#define _mm512_srli_epi64(X,C) ((__m512i) __builtin_ia32_psrlqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)_mm512_undefined_epi32 (), (__mmask8)-1))
+#define PRIx64 __PRI64_PREFIX "x"
+#define PRIoLEAST16 "o"
+#define __MMX__ 1
+#define _mm256_shrdi_epi32(A,B,C) ((__m256i) __builtin_ia32_vpshrd_v8si ((__v8si)(__m256i)(A), (__v8si)(__m256i)(B),(int)(C)))
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define _mm256_mask_alignr_epi32(W,U,X,Y,C) ((__m256i)__builtin_ia32_alignd256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(C), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define _CETINTRIN_H_INCLUDED 
+#define _mm256_maskz_cvt_roundps_ph(A,B,C) _mm256_maskz_cvtps_ph ((A), (B), (C))
+#define PRIoLEAST32 "o"
+#define _mm256_maskz_gf2p8affineinv_epi64_epi8(A,B,C,D) ((__m256i) __builtin_ia32_vgf2p8affineinvqb_v32qi_mask( (__v32qi)(__m256i)(B), (__v32qi)(__m256i)(C), (int)(D), (__v32qi)(__m256i) _mm256_setzero_si256 (), (__mmask32)(A)))
+#define _mm512_maskz_cvt_roundepi32_ph(A,B,C) (__builtin_ia32_vcvtdq2ph512_mask_round ((__v16si)(B), _mm256_setzero_ph (), (A), (C)))
+#define _mm512_mask_extractf32x8_ps(W,U,X,C) ((__m256) __builtin_ia32_extractf32x8_mask ((__v16sf)(__m512) (X), (int) (C), (__v8sf)(__m256) (W), (__mmask8) (U)))
+#define _mm512_maskz_cvt_roundepi32_ps(U,A,B) (__m512)__builtin_ia32_cvtdq2ps512_mask((__v16si)(A), (__v16sf)_mm512_setzero_ps(), U, B)
+#define _mm_mask_getmant_pd(W,U,X,B,C) ((__m128d) __builtin_ia32_getmantpd128_mask ((__v2df)(__m128d) (X), (int)(((C)<<2) | (B)), (__v2df)(__m128d)(W), (__mmask8)(U)))
+#define _mm_mask_getmant_ph(W,U,X,B,C) ((__m128h) __builtin_ia32_getmantph128_mask ((__v8hf)(__m128h) (X), (int)(((C)<<2) | (B)), (__v8hf)(__m128h)(W), (__mmask8)(U)))
+#define _mm256_mask_shrdi_epi16(A,B,C,D,E) ((__m256i) __builtin_ia32_vpshrd_v16hi_mask ((__v16hi)(__m256i)(C), (__v16hi)(__m256i)(D), (int)(E), (__v16hi)(__m256i)(A), (__mmask16)(B)))
+#define _mm_mask_getmant_ps(W,U,X,B,C) ((__m128) __builtin_ia32_getmantps128_mask ((__v4sf)(__m128) (X), (int)(((C)<<2) | (B)), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define _mm512_prefetch_i64gather_pd(INDEX,ADDR,SCALE,HINT) __builtin_ia32_gatherpfqpd ((__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm512_srai_epi64(X,C) ((__m512i) __builtin_ia32_psraqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)_mm512_undefined_epi32 (), (__mmask8)-1))
+#define PRIdLEAST16 "d"
+#define _mm512_prefetch_i64gather_ps(INDEX,ADDR,SCALE,HINT) __builtin_ia32_gatherpfqps ((__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm_mask_roundscale_round_sd(A,U,B,C,I,R) ((__m128d) __builtin_ia32_rndscalesd_mask_round ((__v2df) (__m128d) (B), (__v2df) (__m128d) (C), (int) (I), (__v2df) (__m128d) (A), (__mmask8) (U), (int) (R)))
+#define _mm_mask_roundscale_round_sh(A,B,C,D,E,F) (__builtin_ia32_rndscalesh_mask_round ((C), (D), (E), (A), (B), (F)))
+#define _mm256_shrdi_epi64(A,B,C) ((__m256i) __builtin_ia32_vpshrd_v4di ((__v4di)(__m256i)(A), (__v4di)(__m256i)(B),(int)(C)))
+#define _PKUINTRIN_H_INCLUDED 
+#define __BIGGEST_ALIGNMENT__ 16
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define _mm_round_ps(V,M) ((__m128) __builtin_ia32_roundps ((__v4sf)(__m128)(V), (int)(M)))
+#define _mm256_mask_alignr_epi64(W,U,X,Y,C) ((__m256i)__builtin_ia32_alignq256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(C), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+#define _mm512_getexp_round_pd(A,R) ((__m512d)__builtin_ia32_getexppd512_mask((__v8df)(__m512d)(A), (__v8df)_mm512_undefined_pd(), (__mmask8)-1, R))
+#define _mm512_getexp_round_ph(A,R) ((__m512h)__builtin_ia32_getexpph512_mask((__v32hf)(__m512h)(A), (__v32hf)_mm512_setzero_ph(), (__mmask32)-1, R))
+#define PRIuMAX __PRI64_PREFIX "u"
+#define _mm512_getexp_round_ps(A,R) ((__m512)__builtin_ia32_getexpps512_mask((__v16sf)(__m512)(A), (__v16sf)_mm512_undefined_ps(), (__mmask16)-1, R))
+#define __FLT64_MAX_10_EXP__ 308
+#define _mm256_mask_cmp_ps_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpps256_mask ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(P), (__mmask8)(M)))
+#define PRIdLEAST32 "d"
+#define PRIoLEAST64 __PRI64_PREFIX "o"
+#define __GLIBC_USE_LIB_EXT2 0
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define _rotwl(a,b) __rolw((a), (b))
+#define _rotwr(a,b) __rorw((a), (b))
+#define _mm_mask_getmant_sd(W,U,X,Y,C,D) ((__m128d)__builtin_ia32_getmantsd_mask_round ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(((D)<<2) | (C)), (__v2df)(__m128d)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define WTERMSIG(status) __WTERMSIG (status)
+#define _mm_mask_getmant_ss(W,U,X,Y,C,D) ((__m128)__builtin_ia32_getmantss_mask_round ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(((D)<<2) | (C)), (__v4sf)(__m128)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _MM_FROUND_TO_NEAREST_INT 0x00
+#define _mm512_mask_cvt_roundph_pd(A,B,C,D) (__builtin_ia32_vcvtph2pd512_mask_round ((C), (A), (B), (D)))
+#define _mm_shuffle_pi16(A,N) ((__m64) __builtin_ia32_pshufw ((__v4hi)(__m64)(A), (int)(N)))
+#define _mm_mask_cmul_pch(W,U,A,B) _mm_mask_fcmul_pch ((W), (U), (A), (B))
+#define _mm512_mask_cvt_roundph_ps(W,U,A,B) (__m512)__builtin_ia32_vcvtph2ps512_mask((__v16hi)(A), (__v16sf)(W), U, B)
+#define EXIT_SUCCESS 0
+#define _mm512_shufflehi_epi16(A,B) ((__m512i) __builtin_ia32_pshufhw512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i) _mm512_setzero_si512 (), (__mmask32)-1))
+#define _mm_round_sd(D,V,M) ((__m128d) __builtin_ia32_roundsd ((__v2df)(__m128d)(D), (__v2df)(__m128d)(V), (int)(M)))
+#define UINT_LEAST8_MAX (255)
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+#define _mm_cvt_roundsh_ss(A,B,R) (__builtin_ia32_vcvtsh2ss_mask_round ((B), (A), _mm_setzero_ps (), (__mmask8) -1, (R)))
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define PRIdLEAST64 __PRI64_PREFIX "d"
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+#define PRId8 "d"
+#define __USE_POSIX199506 1
+#define PRIiFAST32 __PRIPTR_PREFIX "i"
+#define _FEATURES_H 1
+#define __lldiv_t_defined 1
+#define __DADDR_T_TYPE __S32_TYPE
+#define _mm_mask_srli_epi16(W,U,A,B) ((__m128i) __builtin_ia32_psrlwi128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)(__m128i)(W), (__mmask8)(U)))
+#define _mm_fmsub_round_sd(A,B,C,R) (__m128d)__builtin_ia32_vfmaddsd3_round(A, B, -(C), R)
+#define __INTPTR_WIDTH__ 64
+#define _mm512_mask_cvt_roundps_epu64(W,U,A,B) ((__m512i)__builtin_ia32_cvtps2uqq512_mask ((A), (__v8di)(W), (U), (B)))
+#define _mm512_fmadd_round_pch(A,B,C,D) (__m512h) __builtin_ia32_vfmaddcph512_round ((A), (B), (C), (D))
+#define PIN_MODE_PULLUP 1
+#define _mm256_maskz_insertf64x2(U,X,Y,C) ((__m256d) __builtin_ia32_insertf64x2_256_mask ((__v4df)(__m256d) (X), (__v2df)(__m128d) (Y), (int) (C), (__v4df)(__m256d)_mm256_setzero_pd(), (__mmask8)(U)))
+#define _mm_cmp_epi64_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpq128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(P), (__mmask8)-1))
+#define _mm_mask_cmp_epi16_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpw128_mask ((__v8hi)(__m128i)(X), (__v8hi)(__m128i)(Y), (int)(P), (__mmask8)(M)))
+#define _mm_fmsub_round_sh(A,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_mask ((A), (B), -(C), (-1), (R)))
+#define PRIiFAST64 __PRI64_PREFIX "i"
+#define __FD_SETSIZE 1024
+#define _mm512_getmant_ps(X,B,C) ((__m512)__builtin_ia32_getmantps512_mask ((__v16sf)(__m512)(X), (int)(((C)<<2) | (B)), (__v16sf)_mm512_undefined_ps(), (__mmask16)-1, _MM_FROUND_CUR_DIRECTION))
+#define _mm_mask_srli_epi32(W,U,A,B) ((__m128i) __builtin_ia32_psrldi128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define _mm512_mask_rsqrt28_round_pd(W,U,A,C) __builtin_ia32_rsqrt28pd_mask(A, W, U, C)
+#define _mm512_bsrli_epi128(A,N) ((__m512i)__builtin_ia32_psrldq512 ((__m512i)(A), (int)(N) * 8))
+#define _mm_mask_srai_epi16(W,U,A,B) ((__m128i) __builtin_ia32_psrawi128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)(__m128i)(W), (__mmask8)(U)))
+#define PRIi8 "i"
+#define _mm512_mask_slli_epi16(W,U,X,C) ((__m512i)__builtin_ia32_psllwi512_mask ((__v32hi)(__m512i)(X), (int)(C), (__v32hi)(__m512i)(W), (__mmask32)(U)))
+#define _mm512_maskz_roundscale_round_pd(A,B,C,R) ((__m512d) __builtin_ia32_rndscalepd_mask ((__v8df)(__m512d)(B), (int)(C), (__v8df)_mm512_setzero_pd(), (__mmask8)(A), R))
+#define _PRFCHWINTRIN_H_INCLUDED 
+#define _mm512_maskz_roundscale_round_ph(A,B,C,D) (__builtin_ia32_rndscaleph512_mask_round ((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define _mm512_maskz_roundscale_round_ps(A,B,C,R) ((__m512) __builtin_ia32_rndscaleps_mask ((__v16sf)(__m512)(B), (int)(C), (__v16sf)_mm512_setzero_ps(), (__mmask16)(A), R))
+#define _mm512_i32gather_epi32(INDEX,ADDR,SCALE) (__m512i) __builtin_ia32_gathersiv16si ((__v16si)_mm512_undefined_epi32 (), (void const *) (ADDR), (__v16si)(__m512i) (INDEX), (__mmask16)0xFFFF, (int) (SCALE))
+#define _mm256_inserti128_si256(X,Y,M) ((__m256i) __builtin_ia32_insert128i256 ((__v4di)(__m256i)(X), (__v2di)(__m128i)(Y), (int)(M)))
+#define __USE_XOPEN2K 1
+#define __LDBL_HAS_DENORM__ 1
+#define SCNiLEAST16 "hi"
+#define _mm512_mask_blend_epi8(__U,__A,__W) ((__m512i) __builtin_ia32_blendmb_512_mask ((__v64qi) (__A), (__v64qi) (__W), (__mmask64) (__U)))
+#define _mm_maskz_dbsad_epu8(U,X,Y,C) ((__m128i) __builtin_ia32_dbpsadbw128_mask ((__v16qi)(__m128i) (X), (__v16qi)(__m128i) (Y), (int) (C), (__v8hi)(__m128i)_mm_setzero_si128(), (__mmask8)(U)))
+#define _mm_mask_srli_epi64(W,U,A,B) ((__m128i) __builtin_ia32_psrlqi128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)(W), (__mmask8)(U)))
+#define _mm512_mask_slli_epi32(W,U,X,C) ((__m512i) __builtin_ia32_pslldi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define _mm512_maskz_fixupimm_round_pd(U,X,Y,Z,C,R) ((__m512d)__builtin_ia32_fixupimmpd512_maskz ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (__v8di)(__m512i)(Z), (int)(C), (__mmask8)(U), (R)))
+#define _GCC_WRAP_STDINT_H 
+#define _mm512_maskz_fixupimm_round_ps(U,X,Y,Z,C,R) ((__m512)__builtin_ia32_fixupimmps512_maskz ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (__v16si)(__m512i)(Z), (int)(C), (__mmask16)(U), (R)))
+#define _mm512_sub_round_ph(A,B,C) ((__m512h)__builtin_ia32_subph512_mask_round((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define __DEC32_MIN__ 1E-95DF
+#define _mm256_bslli_epi128(A,N) ((__m256i)__builtin_ia32_pslldqi256 ((__m256i)(A), (int)(N) * 8))
+#define SCNiLEAST32 "i"
+#define __dev_t_defined 
+#define _bit_scan_forward(a) __bsfd(a)
+#define _mm256_range_pd(A,B,C) ((__m256d) __builtin_ia32_rangepd256_mask ((__v4df)(__m256d)(A), (__v4df)(__m256d)(B), (int)(C), (__v4df)_mm256_setzero_pd(), (__mmask8)-1))
+#define _mm512_cvt_roundph_epu16(A,B) ((__m512i) __builtin_ia32_vcvtph2uw512_mask_round ((A), (__v32hi) _mm512_setzero_si512 (), (__mmask32)-1, (B)))
+#define _mm512_i32gather_epi64(INDEX,ADDR,SCALE) (__m512i) __builtin_ia32_gathersiv8di ((__v8di)_mm512_undefined_epi32 (), (void const *) (ADDR), (__v8si)(__m256i) (INDEX), (__mmask8)0xFF, (int) (SCALE))
+#define _mm256_range_ps(A,B,C) ((__m256) __builtin_ia32_rangeps256_mask ((__v8sf)(__m256)(A), (__v8sf)(__m256)(B), (int)(C), (__v8sf)_mm256_setzero_ps(), (__mmask8)-1))
+#define _mm512_maskz_cvt_roundepi64_ps(U,A,B) ((__m256)__builtin_ia32_cvtqq2ps512_mask ((__v8di)(A), (__v8sf)_mm256_setzero_ps (), (U), (B)))
+#define _mm512_maskz_cvt_roundph_epi16(A,B,C) ((__m512i)__builtin_ia32_vcvtph2w512_mask_round ((B), (__v32hi) _mm512_setzero_si512 (), (A), (C)))
+#define __DBL_MAX_EXP__ 1024
+#define _mm_cmpestra(X,LX,Y,LY,M) ((int) __builtin_ia32_pcmpestria128 ((__v16qi)(__m128i)(X), (int)(LX), (__v16qi)(__m128i)(Y), (int)(LY), (int)(M)))
+#define _mm_cmpestrc(X,LX,Y,LY,M) ((int) __builtin_ia32_pcmpestric128 ((__v16qi)(__m128i)(X), (int)(LX), (__v16qi)(__m128i)(Y), (int)(LY), (int)(M)))
+#define _mm_cmpestri(X,LX,Y,LY,M) ((int) __builtin_ia32_pcmpestri128 ((__v16qi)(__m128i)(X), (int)(LX), (__v16qi)(__m128i)(Y), (int)(LY), (int)(M)))
+#define __WCHAR_WIDTH__ 32
+#define _mm_cmpestrm(X,LX,Y,LY,M) ((__m128i) __builtin_ia32_pcmpestrm128 ((__v16qi)(__m128i)(X), (int)(LX), (__v16qi)(__m128i)(Y), (int)(LY), (int)(M)))
+#define _mm_cmpestro(X,LX,Y,LY,M) ((int) __builtin_ia32_pcmpestrio128 ((__v16qi)(__m128i)(X), (int)(LX), (__v16qi)(__m128i)(Y), (int)(LY), (int)(M)))
+#define _mm_cmpestrs(X,LX,Y,LY,M) ((int) __builtin_ia32_pcmpestris128 ((__v16qi)(__m128i)(X), (int)(LX), (__v16qi)(__m128i)(Y), (int)(LY), (int)(M)))
+#define _mm_cmpestrz(X,LX,Y,LY,M) ((int) __builtin_ia32_pcmpestriz128 ((__v16qi)(__m128i)(X), (int)(LX), (__v16qi)(__m128i)(Y), (int)(LY), (int)(M)))
+#define _BITS_WCHAR_H 1
+#define _mm_mask_srai_epi64(W,U,A,B) ((__m128i) __builtin_ia32_psraqi128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)(W), (__mmask8)(U)))
+#define _mm512_mask_slli_epi64(W,U,X,C) ((__m512i) __builtin_ia32_psllqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define _rdtsc() __rdtsc()
+#define _mm_mask_cmp_round_ss_mask(M,X,Y,P,R) ((__mmask8) __builtin_ia32_cmpss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P), (M), R))
+#define __SSE2_MATH__ 1
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define _mm_mask_sqrt_round_sh(A,B,C,D,E) (__builtin_ia32_sqrtsh_mask_round ((D), (C), (A), (B), (E)))
+#define _mm512_maskz_cvt_roundph_epi32(A,B,C) ((__m512i) __builtin_ia32_vcvtph2dq512_mask_round ((B), (__v16si) _mm512_setzero_si512 (), (A), (C)))
+#define PRIo8 "o"
+#define SCNiLEAST64 __PRI64_PREFIX "i"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+#define _ENQCMDINTRIN_H_INCLUDED 
+#define _mm512_cmp_epi16_mask(X,Y,P) ((__mmask32) __builtin_ia32_cmpw512_mask ((__v32hi)(__m512i)(X), (__v32hi)(__m512i)(Y), (int)(P), (__mmask32)(-1)))
+#define _mm512_getexp_ps(A) ((__m512)__builtin_ia32_getexpps512_mask((__v16sf)(__m512)(A), (__v16sf)_mm512_undefined_ps(), (__mmask16)-1, _MM_FROUND_CUR_DIRECTION))
+#define _mm512_maskz_shrdi_epi64(A,B,C,D) ((__m512i) __builtin_ia32_vpshrd_v8di_mask ((__v8di)(__m512i)(B), (__v8di)(__m512i)(C),(int)(D), (__v8di)(__m512i)_mm512_setzero_si512 (), (__mmask8)(A)))
+#define _mm_maskz_roundscale_pd(U,A,B) ((__m128d) __builtin_ia32_rndscalepd_128_mask ((__v2df)(__m128d)(A), (int)(B), (__v2df)(__m128d)_mm_setzero_pd (), (__mmask8)(U)))
+#define _mm_maskz_roundscale_ph(A,B,C) (__builtin_ia32_rndscaleph128_mask ((B), (C), _mm_setzero_ph (), (A)))
+#define _mm_maskz_roundscale_ps(U,A,B) ((__m128) __builtin_ia32_rndscaleps_128_mask ((__v4sf)(__m128)(A), (int)(B), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)(U)))
+#define _mm_floor_pd(V) _mm_round_pd((V), _MM_FROUND_FLOOR)
+#define _mm512_maskz_fnmsub_round_ps(U,A,B,C,R) (__m512)__builtin_ia32_vfnmsubps512_maskz(A, B, C, U, R)
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define _mm_mask_sqrt_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_sqrtss_mask_round (B, A, W, U, C)
+#define _mm512_maskz_cvt_roundph_epi64(A,B,C) (__builtin_ia32_vcvtph2qq512_mask_round ((B), _mm512_setzero_si512 (), (A), (C)))
+#define __ATOMIC_HLE_ACQUIRE 65536
+#define _mm512_mask_fmsubadd_round_pd(A,U,B,C,R) (__m512d)__builtin_ia32_vfmaddsubpd512_mask(A, B, -(C), U, R)
+#define _mm512_mask_fmsubadd_round_ph(A,U,B,C,R) ((__m512h)__builtin_ia32_vfmsubaddph512_mask ((A), (B), (C), (U), (R)))
+#define _mm256_i32scatter_pd(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv4df ((void *) (ADDR), (__mmask8)0xFF, (__v4si)(__m128i) (INDEX), (__v4df)(__m256d) (V1), (int) (SCALE))
+#define _mm512_mask_fmsubadd_round_ps(A,U,B,C,R) (__m512)__builtin_ia32_vfmaddsubps512_mask(A, B, -(C), U, R)
+#define _mm512_mask_insertf64x4(W,U,X,Y,C) ((__m512d) __builtin_ia32_insertf64x4_mask ((__v8df)(__m512d) (X), (__v4df)(__m256d) (Y), (int) (C), (__v8df)(__m512d)(W), (__mmask8)(U)))
+#define _mm256_i32scatter_ps(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv8sf ((void *) (ADDR), (__mmask8)0xFF, (__v8si)(__m256i) (INDEX), (__v8sf)(__m256) (V1), (int) (SCALE))
+#define _T_WCHAR 
+#define _mm512_maskz_alignr_epi32(U,X,Y,C) ((__m512i)__builtin_ia32_alignd512_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(C), (__v16si)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _MM_FROUND_CUR_DIRECTION 0x04
+#define __GIT_REVPARSE__ 0xeb544d5
+#define _mm_maskz_roundscale_ss(U,A,B,I) ((__m128) __builtin_ia32_rndscaless_mask_round ((__v4sf) (__m128) (A), (__v4sf) (__m128) (B), (int) (I), (__v4sf) _mm_setzero_ps (), (__mmask8) (U), _MM_FROUND_CUR_DIRECTION))
+#define _mm_floor_sd(D,V) _mm_round_sd ((D), (V), _MM_FROUND_FLOOR)
+#define _mm_floor_ss(D,V) _mm_round_ss ((D), (V), _MM_FROUND_FLOOR)
+#define _mm512_maskz_cvt_roundps_pd(U,A,B) (__m512d)__builtin_ia32_cvtps2pd512_mask(A, (__v8df)_mm512_setzero_pd(), U, B)
+#define _mm512_maskz_cvt_roundps_ph(W,A,I) ((__m256i) __builtin_ia32_vcvtps2ph512_mask ((__v16sf)(__m512) (A), (int) (I), (__v16hi)_mm256_setzero_si256 (), (__mmask16) (W)))
+#define __AVX512VNNIINTRIN_H_INCLUDED 
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+#define __PRIPTR_PREFIX "l"
+#define PRIu8 "u"
+#define __SIZEOF_WINT_T__ 4
+#define PRIxLEAST8 "x"
+#define _mm512_mask_mul_pch(W,U,A,B) _mm512_mask_fmul_pch ((W), (U), (A), (B))
+#define _mm512_cmul_pch(A,B) _mm512_fcmul_pch ((A), (B))
+#define SCNdFAST64 __PRI64_PREFIX "d"
+#define _mm_fpclass_sh_mask(X,C) ((__mmask8) __builtin_ia32_fpclasssh_mask ((__v8hf) (__m128h) (X), (int) (C), (__mmask8) (-1)))
+#define __f32x(x) x ##f32x
+#define _mm_i64scatter_pd(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv2df ((void *) (ADDR), (__mmask8)0xFF, (__v2di)(__m128i) (INDEX), (__v2df)(__m128d) (V1), (int) (SCALE))
+#define _mm512_maskz_alignr_epi64(U,X,Y,C) ((__m512i)__builtin_ia32_alignq512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(C), (__v8di)_mm512_setzero_si512 (), (__mmask8)(U)))
+#define _mm512_maskz_inserti64x2(U,X,Y,C) ((__m512i) __builtin_ia32_inserti64x2_512_mask ((__v8di)(__m512i) (X), (__v2di)(__m128i) (Y), (int) (C), (__v8di)(__m512i) _mm512_setzero_si512 (), (__mmask8) (U)))
+#define _mm512_maskz_inserti64x4(U,X,Y,C) ((__m512i) __builtin_ia32_inserti64x4_mask ((__v8di)(__m512i) (X), (__v4di)(__m256i) (Y), (int) (C), (__v8di)(__m512i)_mm512_setzero_si512 (), (__mmask8)(U)))
+#define _mm_i64scatter_ps(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4sf ((void *) (ADDR), (__mmask8)0xFF, (__v2di)(__m128i) (INDEX), (__v4sf)(__m128) (V1), (int) (SCALE))
+#define _STDIO_H 1
+#define WINT_MAX (4294967295u)
+#define _mm512_mul_round_ph(A,B,C) ((__m512h)__builtin_ia32_mulph512_mask_round((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define PIN_MODE_INPUT 2
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+#define _mm512_max_round_ps(A,B,R) (__m512)__builtin_ia32_maxps512_mask(A, B, (__v16sf)_mm512_undefined_pd(), -1, R)
+#define UINTPTR_MAX (18446744073709551615UL)
+#define _mm512_fpclass_ph_mask(x,c) ((__mmask32) __builtin_ia32_fpclassph512_mask ((__v32hf) (__m512h) (x), (int) (c),(__mmask8)-1))
+#define PRIx8 "x"
+#define _mm256_extracti128_si256(X,M) ((__m128i) __builtin_ia32_extract128i256 ((__v4di)(__m256i)(X), (int)(M)))
+#define _mm512_mask_i32gather_pd(V1OLD,MASK,INDEX,ADDR,SCALE) (__m512d) __builtin_ia32_gathersiv8df ((__v8df)(__m512d) (V1OLD), (void const *) (ADDR), (__v8si)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _MMINTRIN_H_INCLUDED 
+#define _tile_stream_loadd(dst,base,stride) _tile_stream_loadd_internal (dst, base, stride)
+#define _mm512_maskz_cvt_roundpd_epi32(U,A,B) ((__m256i)__builtin_ia32_cvtpd2dq512_mask(A, (__v8si)_mm256_setzero_si256(), U, B))
+#define __LDBL_REDIR2_DECL(name) 
+#define _mm256_mask_shuffle_epi32(W,U,X,C) ((__m256i) __builtin_ia32_pshufd256_mask ((__v8si)(__m256i)(X), (int)(C), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define _mm_mask_i32scatter_epi32(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv4si ((void *) (ADDR), (__mmask8) (MASK), (__v4si)(__m128i) (INDEX), (__v4si)(__m128i) (V1), (int) (SCALE))
+#define _mm_cmp_round_sh_mask(A,B,C,D) (__builtin_ia32_cmpsh_mask_round ((A), (B), (C), (-1), (D)))
+#define _mm_mask_rol_epi32(W,U,A,B) ((__m128i)__builtin_ia32_prold128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define __INT_LEAST64_TYPE__ long int
+#define __FLT128_HAS_INFINITY__ 1
+#define __FLT_MIN_EXP__ (-125)
+#define _mm512_mask_div_round_ps(W,U,A,B,C) (__m512)__builtin_ia32_divps512_mask(A, B, W, U, C)
+#define _XSAVEOPTINTRIN_H_INCLUDED 
+#define _mm512_maskz_extractf64x2_pd(U,X,C) ((__m128d) __builtin_ia32_extractf64x2_512_mask ((__v8df)(__m512d) (X), (int) (C), (__v2df)(__m128d) _mm_setzero_pd (), (__mmask8) (U)))
+#define _mm512_mask_blend_epi16(__U,__A,__W) ((__m512i) __builtin_ia32_blendmw_512_mask ((__v32hi) (__A), (__v32hi) (__W), (__mmask32) (__U)))
+#define _mm_i64gather_epi32(BASE,INDEX,SCALE) (__m128i) __builtin_ia32_gatherdiv4si ((__v4si) _mm_setzero_si128 (), (int const *) (BASE), (__v2di)(__m128i) (INDEX), (__v4si)_mm_set1_epi32 (-1), (int) (SCALE))
+#define _mm_mask_blend_epi16(__U,__A,__W) ((__m128i) __builtin_ia32_blendmw_128_mask ((__v8hi) (__A), (__v8hi) (__W), (__mmask8) (__U)))
+#define _mm_mask_srai_epi32(W,U,A,B) ((__m128i) __builtin_ia32_psradi128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define alloca(size) __builtin_alloca (size)
+#define _mm512_maskz_cvt_roundpd_epi64(U,A,B) ((__m512i)__builtin_ia32_cvtpd2qq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define _mm_mask_i32scatter_epi64(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv2di ((void *) (ADDR), (__mmask8) (MASK), (__v4si)(__m128i) (INDEX), (__v2di)(__m128i) (V1), (int) (SCALE))
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+#define _mm_mask_rol_epi64(W,U,A,B) ((__m128i)__builtin_ia32_prolq128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)(W), (__mmask8)(U)))
+#define _mm_mask_blend_epi32(__U,__A,__W) ((__m128i) __builtin_ia32_blendmd_128_mask ((__v4si) (__A), (__v4si) (__W), (__mmask8) (__U)))
+#define _MM_FROUND_NEARBYINT (_MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC)
+#define _mm512_mask_shufflehi_epi16(W,U,A,B) ((__m512i) __builtin_ia32_pshufhw512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i)(W), (__mmask32)(U)))
+#define __FLT64X_HAS_QUIET_NAN__ 1
+#define _mm256_shuffle_pd(A,B,N) ((__m256d)__builtin_ia32_shufpd256 ((__v4df)(__m256d)(A), (__v4df)(__m256d)(B), (int)(N)))
+#define _mm_i64gather_epi64(BASE,INDEX,SCALE) (__m128i) __builtin_ia32_gatherdiv2di ((__v2di) _mm_setzero_si128 (), (long long const *) (BASE), (__v2di)(__m128i) (INDEX), (__v2di)_mm_set1_epi64x (-1), (int) (SCALE))
+#define _mm256_permutex_epi64(X,I) ((__m256i) __builtin_ia32_permdi256_mask ((__v4di)(__m256i)(X), (int)(I), (__v4di)(__m256i) (_mm256_setzero_si256 ()), (__mmask8) -1))
+#define _mm256_shuffle_ps(A,B,N) ((__m256) __builtin_ia32_shufps256 ((__v8sf)(__m256)(A), (__v8sf)(__m256)(B), (int)(N)))
+#define _mm_reduce_pd(A,B) ((__m128d) __builtin_ia32_reducepd128_mask ((__v2df)(__m128d)(A), (int)(B), (__v2df)_mm_setzero_pd(), (__mmask8)-1))
+#define _mm_mask_reduce_round_ss(W,U,A,B,C,R) ((__m128) __builtin_ia32_reducess_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)(__m128)(W), (__mmask8)(U), (int)(R)))
+#define _mm512_dbsad_epu8(X,Y,C) ((__m512i) __builtin_ia32_dbpsadbw512_mask ((__v64qi)(__m512i) (X), (__v64qi)(__m512i) (Y), (int) (C), (__v32hi)(__m512i) _mm512_setzero_si512 (), (__mmask32)-1))
+#define _mm_reduce_ps(A,B) ((__m128) __builtin_ia32_reduceps128_mask ((__v4sf)(__m128)(A), (int)(B), (__v4sf)_mm_setzero_ps(), (__mmask8)-1))
+#define __struct_FILE_defined 1
+#define _ANSI_STDDEF_H 
+#define __INT_LEAST32_MAX__ 0x7fffffff
+#define WINT_MIN (0u)
+#define __key_t_defined 
+#define SCNxFAST32 __PRIPTR_PREFIX "x"
+#define __encls_c(leaf,c,retval) __asm__ __volatile__("encls\n\t" : "=a" (retval) : "a" (leaf), "c" (c) : "cc")
+#define _mm_mask_blend_epi64(__U,__A,__W) ((__m128i) __builtin_ia32_blendmq_128_mask ((__v2di) (__A), (__v2di) (__W), (__mmask8) (__U)))
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+#define _mm_cvt_roundsd_ss(A,B,C) (__m128)__builtin_ia32_cvtsd2ss_round(A, B, C)
+#define _mm512_mask_cmp_round_ph_mask(A,B,C,D,E) (__builtin_ia32_cmpph512_mask_round ((B), (C), (D), (A), (E)))
+#define _lrotr(a,b) __rorq((a), (b))
+#define PIN_MODE_ANALOG 5
+#define _mm_reduce_sd(A,B,C) ((__m128d) __builtin_ia32_reducesd_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df) _mm_setzero_pd (), (__mmask8)-1))
+#define _mm_reduce_sh(A,B,C) (__builtin_ia32_reducesh_mask_round ((A), (B), (C), _mm_setzero_ph (), (__mmask8)-1, _MM_FROUND_CUR_DIRECTION))
+#define _mm_maskz_ror_epi32(U,A,B) ((__m128i)__builtin_ia32_prord128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm_reduce_ss(A,B,C) ((__m128) __builtin_ia32_reducess_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf) _mm_setzero_ps (), (__mmask8)-1))
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __LP64__ 1
+#define __HAVE_FLOAT32X 1
+#define _mm512_mask_cvt_roundepi32_ps(W,U,A,B) (__m512)__builtin_ia32_cvtdq2ps512_mask((__v16si)(A), W, U, B)
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+#define CLOCK_REALTIME_ALARM 8
+#define EOF (-1)
+#define _mm256_maskz_ternarylogic_epi64(U,A,B,C,I) ((__m256i) __builtin_ia32_pternlogq256_maskz ((__v4di) (__m256i) (A), (__v4di) (__m256i) (B), (__v4di) (__m256i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+#define __DECIMAL_BID_FORMAT__ 1
+#define __FLT64_MIN_EXP__ (-1021)
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define _mm_test_mix_ones_zeros(M,V) _mm_testnzc_si128 ((M), (V))
+#define _mm512_cvt_roundps_epi32(A,B) ((__m512i)__builtin_ia32_cvtps2dq512_mask(A, (__v16si)_mm512_undefined_epi32 (), -1, B))
+#define __GLIBC_USE_ISOC2X 0
+#define PIN_MODE_TOTAL 15
+#define _mm512_mask_extracti32x8_epi32(W,U,X,C) ((__m256i) __builtin_ia32_extracti32x8_mask ((__v16si)(__m512i) (X), (int) (C), (__v8si)(__m256i) (W), (__mmask8) (U)))
+#define _mm512_mask_fmul_round_pch(A,B,C,D,E) (__m512h) __builtin_ia32_vfmulcph512_mask_round ((C), (D), (A), (B), (E))
+#define _mm512_maskz_cvt_roundph_pd(A,B,C) (__builtin_ia32_vcvtph2pd512_mask_round ((B), _mm512_setzero_pd (), (A), (C)))
+#define _mm512_maskz_cvt_roundph_ps(U,A,B) (__m512)__builtin_ia32_vcvtph2ps512_mask((__v16hi)(A), (__v16sf)_mm512_setzero_ps(), U, B)
+#define _mm_fpclass_ss_mask(X,C) ((__mmask8) __builtin_ia32_fpclassss_mask ((__v4sf) (__m128) (X), (int) (C), (__mmask8) (-1)))
+#define _MM_GET_DENORMALS_ZERO_MODE() (_mm_getcsr() & _MM_DENORMALS_ZERO_MASK)
+#define _bswap64(a) __bswapq(a)
+#define __FDS_BITS(set) ((set)->__fds_bits)
+#define __ULONGWORD_TYPE unsigned long int
+#define _mm256_maskz_extractf64x2_pd(U,X,C) ((__m128d) __builtin_ia32_extractf64x2_256_mask ((__v4df)(__m256d) (X), (int) (C), (__v2df)(__m128d) _mm_setzero_pd(), (__mmask8) (U)))
+#define _mm_extract_ps(X,N) (__extension__ ({ union { int i; float f; } __tmp; __tmp.f = __builtin_ia32_vec_ext_v4sf ((__v4sf)(__m128)(X), (int)(N)); __tmp.i; }))
+#define __FLT16_MIN_10_EXP__ (-4)
+#define _SIZE_T_DECLARED 
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define __REGISTER_PREFIX__ 
+#define __UINT16_MAX__ 0xffff
+#define _mm_mask_ror_epi32(W,U,A,B) ((__m128i)__builtin_ia32_prord128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define _mm512_mask_rsqrt28_pd(W,U,A) _mm512_mask_rsqrt28_round_pd(W, U, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm512_mask_rsqrt28_ps(W,U,A) _mm512_mask_rsqrt28_round_ps(W, U, A, _MM_FROUND_CUR_DIRECTION)
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+#define __USE_POSIX2 1
+#define COMMPORT_ERROR_TOTAL 5
+#define _MM_EXCEPT_DIV_ZERO 0x0004
+#define _mm_maskz_rcp28_sd(U,A,B) _mm_maskz_rcp28_round_sd ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __INT_LEAST32_WIDTH__ 32
+#define _mm_maskz_mul_round_sch(U,A,B,R) _mm_maskz_fmul_round_sch ((U), (A), (B), (R))
+#define SCNiMAX __PRI64_PREFIX "i"
+#define _mm_mask_blend_pd(__U,__A,__W) ((__m128d) __builtin_ia32_blendmpd_128_mask ((__v2df) (__A), (__v2df) (__W), (__mmask8) (__U)))
+#define __VERSION__ "12.2.0"
+#define SCNoLEAST8 "hho"
+#define _mm_mask_blend_ps(__U,__A,__W) ((__m128) __builtin_ia32_blendmps_128_mask ((__v4sf) (__A), (__v4sf) (__W), (__mmask8) (__U)))
+#define _mm512_cvt_roundepi64_pd(A,B) ((__m512d)__builtin_ia32_cvtqq2pd512_mask ((__v8di)(A), (__v8df)_mm512_setzero_pd (), -1, (B)))
+#define _mm512_cvt_roundepi64_ph(A,B) (__builtin_ia32_vcvtqq2ph512_mask_round ((__v8di)(A), _mm_setzero_ph (), (__mmask8)-1, (B)))
+#define _mm256_maskz_fixupimm_ps(U,X,Y,Z,C) ((__m256)__builtin_ia32_fixupimmps256_maskz ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (__v8si)(__m256i)(Z), (int)(C), (__mmask8)(U)))
+#define _mm512_cvt_roundepi64_ps(A,B) ((__m256)__builtin_ia32_cvtqq2ps512_mask ((__v8di)(A), (__v8sf)_mm256_setzero_ps (), -1, (B)))
+#define _mm_mask_dbsad_epu8(W,U,X,Y,C) ((__m128i) __builtin_ia32_dbpsadbw128_mask ((__v16qi)(__m128i) (X), (__v16qi)(__m128i) (Y), (int) (C), (__v8hi)(__m128i)(W), (__mmask8)(U)))
+#define _ENDIAN_H 1
+#define __UINT64_C(c) c ## UL
+#define _mm256_maskz_inserti32x4(U,X,Y,C) ((__m256i) __builtin_ia32_inserti32x4_256_mask ((__v8si)(__m256i) (X), (__v4si)(__m128i) (Y), (int) (C), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define PRIXLEAST16 "X"
+#define _mm512_permute_ps(X,C) ((__m512) __builtin_ia32_vpermilps512_mask ((__v16sf)(__m512)(X), (int)(C), (__v16sf)(__m512)_mm512_undefined_ps(), (__mmask16)(-1)))
+#define _mm_cvt_roundss_i32(A,B) ((int)__builtin_ia32_vcvtss2si32(A, B))
+#define _rotr(a,b) __rord((a), (b))
+#define PIN_MODE_SERVO 13
+#define _tile_stored(dst,base,stride) _tile_stored_internal (dst, base, stride)
+#define _mm512_mask_extracti32x4_epi32(W,U,X,C) ((__m128i) __builtin_ia32_extracti32x4_mask ((__v16si)(__m512i) (X), (int) (C), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define _mm_i32scatter_epi32(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv4si ((void *) (ADDR), (__mmask8)0xFF, (__v4si)(__m128i) (INDEX), (__v4si)(__m128i) (V1), (int) (SCALE))
+#define _mm256_mask_inserti64x2(W,U,X,Y,C) ((__m256i) __builtin_ia32_inserti64x2_256_mask ((__v4di)(__m256i) (X), (__v2di)(__m128i) (Y), (int) (C), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define _STDC_PREDEF_H 1
+#define PRIXLEAST32 "X"
+#define _AVX512VPOPCNTDQVLINTRIN_H_INCLUDED 
+#define _mm_rsqrt28_sd(A,B) __builtin_ia32_rsqrt28sd_round(B, A, _MM_FROUND_CUR_DIRECTION)
+#define __INT_WCHAR_T_H 
+#define _mm_rsqrt28_ss(A,B) __builtin_ia32_rsqrt28ss_round(B, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm512_mask_fnmsub_round_pd(A,U,B,C,R) (__m512d)__builtin_ia32_vfnmsubpd512_mask(A, B, C, U, R)
+#define _kshiftri_mask8(X,Y) ((__mmask8) __builtin_ia32_kshiftriqi ((__mmask8)(X), (__mmask8)(Y)))
+#define _mm512_mask_fnmsub_round_ps(A,U,B,C,R) (__m512)__builtin_ia32_vfnmsubps512_mask(A, B, C, U, R)
+#define _mm_mask_rsqrt28_round_sd(W,U,A,B,R) __builtin_ia32_rsqrt28sd_mask_round ((A), (B), (W), (U), (R))
+#define _mm_shrdi_epi64(A,B,C) ((__m128i) __builtin_ia32_vpshrd_v2di ((__v2di)(__m128i)(A), (__v2di)(__m128i)(B),(int)(C)))
+#define _mm_mask_rsqrt28_round_ss(W,U,A,B,R) __builtin_ia32_rsqrt28ss_mask_round ((A), (B), (W), (U), (R))
+#define _mm512_i32gather_pd(INDEX,ADDR,SCALE) (__m512d) __builtin_ia32_gathersiv8df ((__v8df)_mm512_undefined_pd(), (void const *) (ADDR), (__v8si)(__m256i) (INDEX), (__mmask8)0xFF, (int) (SCALE))
+#define _mm_cvt_roundss_i64(A,B) ((long long)__builtin_ia32_vcvtss2si64(A, B))
+#define _mm512_i32gather_ps(INDEX,ADDR,SCALE) (__m512) __builtin_ia32_gathersiv16sf ((__v16sf)_mm512_undefined_ps(), (void const *) (ADDR), (__v16si)(__m512i) (INDEX), (__mmask16)0xFFFF, (int) (SCALE))
+#define _mm512_maskz_mul_round_pch(U,A,B,R) _mm512_maskz_fmul_round_pch ((U), (A), (B), (R))
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+#define _mm_i32scatter_epi64(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv2di ((void *) (ADDR), (__mmask8)0xFF, (__v4si)(__m128i) (INDEX), (__v2di)(__m128i) (V1), (int) (SCALE))
+#define _mm256_blend_epi16(X,Y,M) ((__m256i) __builtin_ia32_pblendw256 ((__v16hi)(__m256i)(X), (__v16hi)(__m256i)(Y), (int)(M)))
+#define _mm_mask_fpclass_sh_mask(U,X,C) ((__mmask8) __builtin_ia32_fpclasssh_mask ((__v8hf) (__m128h) (X), (int) (C), (__mmask8) (U)))
+#define _mm_maskz_sqrt_round_sd(U,A,B,C) (__m128d)__builtin_ia32_sqrtsd_mask_round (B, A, (__v2df) _mm_setzero_pd (), U, C)
+#define _LP64 1
+#define _SIDD_SBYTE_OPS 0x02
+#define _mm_maskz_sqrt_round_ss(U,A,B,C) (__m128)__builtin_ia32_sqrtss_mask_round (B, A, (__v4sf) _mm_setzero_ps (), U, C)
+#define _mm256_round_pd(V,M) ((__m256d) __builtin_ia32_roundpd256 ((__v4df)(__m256d)(V), (int)(M)))
+#define __FLT128_MAX_EXP__ 16384
+#define _mm256_mask_fpclass_pd_mask(u,X,C) ((__mmask8) __builtin_ia32_fpclasspd256_mask ((__v4df) (__m256d) (X), (int) (C),(__mmask8)(u)))
+#define _mm256_maskz_extractf32x4_ps(U,X,C) ((__m128) __builtin_ia32_extractf32x4_256_mask ((__v8sf)(__m256) (X), (int) (C), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)(U)))
+#define _AVX512ERINTRIN_H_INCLUDED 
+#define SYSTEM_RESET_ZERO 0
+#define _mm512_extracti32x4_epi32(X,C) ((__m128i) __builtin_ia32_extracti32x4_mask ((__v16si)(__m512i) (X), (int) (C), (__v4si)(__m128i)_mm_undefined_si128 (), (__mmask8)-1))
+#define _tile_dpbf16ps(dst,src1,src2) _tile_dpbf16ps_internal (dst, src1, src2)
+#define _mm512_shufflelo_epi16(A,B) ((__m512i) __builtin_ia32_pshuflw512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i) _mm512_setzero_si512 (), (__mmask32)-1))
+#define _mm512_mask_rcp28_round_ps(W,U,A,C) __builtin_ia32_rcp28ps_mask(A, W, U, C)
+#define __FLT32_MANT_DIG__ 24
+#define _SYS_SIZE_T_H 
+#define _mm_cvt_roundsi32_ss(A,B,C) (__m128)__builtin_ia32_cvtsi2ss32(A, B, C)
+#define __enclu_eenter(leaf,b,c,retval) __asm__ __volatile__("enclu\n\t" : "=a" (retval), "=c" (c) : "a" (leaf), "b" (b), "c" (c) : "cc")
+#define _mm_mask_gf2p8affine_epi64_epi8(A,B,C,D,E) ((__m128i) __builtin_ia32_vgf2p8affineqb_v16qi_mask((__v16qi)(__m128i)(C), (__v16qi)(__m128i)(D), (int)(E), (__v16qi)(__m128i)(A), (__mmask16)(B)))
+#define _mm256_mask_ror_epi32(W,U,A,B) ((__m256i)__builtin_ia32_prord256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define __STDC_IEC_60559_BFP__ 201404L
+#define TX_BUFFER_MASK ( TX_BUFFER_SIZE - 1 )
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+#define _mm256_mask_blend_epi16(__U,__A,__W) ((__m256i) __builtin_ia32_blendmw_256_mask ((__v16hi) (__A), (__v16hi) (__W), (__mmask16) (__U)))
+#define __SIZE_T__ 
+#define _mm512_min_round_pd(A,B,R) (__m512d)__builtin_ia32_minpd512_mask(A, B, (__v8df)_mm512_undefined_pd(), -1, R)
+#define __stub_gtty 
+#define _mm512_min_round_ps(A,B,R) (__m512)__builtin_ia32_minps512_mask(A, B, (__v16sf)_mm512_undefined_ps(), -1, R)
+#define _mm_maskz_min_round_sd(U,A,B,C) (__m128d)__builtin_ia32_minsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, C)
+#define _mm512_shuffle_ps(X,Y,C) ((__m512)__builtin_ia32_shufps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(C), (__v16sf)(__m512)_mm512_undefined_ps(), (__mmask16)-1))
+#define _mm512_mask_roundscale_pd(A,B,C,D) ((__m512d) __builtin_ia32_rndscalepd_mask ((__v8df)(__m512d)(C), (int)(D), (__v8df)(__m512d)(A), (__mmask8)(B), _MM_FROUND_CUR_DIRECTION))
+#define _mm_mask_i64gather_epi32(SRC,BASE,INDEX,MASK,SCALE) (__m128i) __builtin_ia32_gatherdiv4si ((__v4si)(__m128i) (SRC), (int const *) (BASE), (__v2di)(__m128i) (INDEX), (__v4si)(__m128i) (MASK), (int) (SCALE))
+#define PIN_MODE_STEPPER 12
+#define _mm512_mask_roundscale_ph(A,B,C,D) (__builtin_ia32_rndscaleph512_mask_round ((C), (D), (A), (B), _MM_FROUND_CUR_DIRECTION))
+#define _XOPMMINTRIN_H_INCLUDED 
+#define _mm512_mask_roundscale_ps(A,B,C,D) ((__m512) __builtin_ia32_rndscaleps_mask ((__v16sf)(__m512)(C), (int)(D), (__v16sf)(__m512)(A), (__mmask16)(B), _MM_FROUND_CUR_DIRECTION))
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+#define _MM_FROUND_NINT (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_RAISE_EXC)
+#define _mm512_cvtt_roundps_epu32(A,B) ((__m512i)__builtin_ia32_cvttps2udq512_mask(A, (__v16si)_mm512_undefined_epi32 (), -1, B))
+#define _mm256_mask_blend_epi32(__U,__A,__W) ((__m256i) __builtin_ia32_blendmd_256_mask ((__v8si) (__A), (__v8si) (__W), (__mmask8) (__U)))
+#define _mm256_insert_epi16(X,D,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 3); __Y = _mm_insert_epi16 (__Y, (D), (N) % 8); _mm256_insertf128_si256 ((X), __Y, (N) >> 3); }))
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define _mm256_mask_ternarylogic_epi32(A,U,B,C,I) ((__m256i) __builtin_ia32_pternlogd256_mask ((__v8si) (__m256i) (A), (__v8si) (__m256i) (B), (__v8si) (__m256i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define _mm256_extract_epi16(X,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 3); _mm_extract_epi16 (__Y, (N) % 8); }))
+#define _mm512_fpclass_ps_mask(x,c) ((__mmask16) __builtin_ia32_fpclassps512_mask ((__v16sf) (__m512) (x), (int) (c),(__mmask16)-1))
+#define _SIDD_MOST_SIGNIFICANT 0x40
+#define __wur 
+#define _mm512_fnmadd_round_pd(A,B,C,R) (__m512d)__builtin_ia32_vfnmaddpd512_mask(A, B, C, -1, R)
+#define _MM_ROUND_MASK 0x6000
+#define _mm512_fnmadd_round_ps(A,B,C,R) (__m512)__builtin_ia32_vfnmaddps512_mask(A, B, C, -1, R)
+#define _mm_mask_i64gather_epi64(SRC,BASE,INDEX,MASK,SCALE) (__m128i) __builtin_ia32_gatherdiv2di ((__v2di)(__m128i) (SRC), (long long const *) (BASE), (__v2di)(__m128i) (INDEX), (__v2di)(__m128i) (MASK), (int) (SCALE))
+#define __FLT128_HAS_DENORM__ 1
+#define _mm512_mask_prefetch_i64gather_pd(INDEX,MASK,ADDR,SCALE,HINT) __builtin_ia32_gatherpfqpd ((__mmask8) (MASK), (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm_fixupimm_pd(X,Y,Z,C) ((__m128d)__builtin_ia32_fixupimmpd128_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(-1)))
+#define _mm256_extract_epi32(X,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 2); _mm_extract_epi32 (__Y, (N) % 4); }))
+#define _mm_fixupimm_ps(X,Y,Z,C) ((__m128)__builtin_ia32_fixupimmps128_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(-1)))
+#define _mm512_maskz_fnmadd_round_pd(U,A,B,C,R) (__m512d)__builtin_ia32_vfnmaddpd512_maskz(A, B, C, U, R)
+#define _mm512_cvtt_roundps_epu64(A,B) ((__m512i)__builtin_ia32_cvttps2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), -1, (B)))
+#define _mm256_mask_blend_epi64(__U,__A,__W) ((__m256i) __builtin_ia32_blendmq_256_mask ((__v4di) (__A), (__v4di) (__W), (__mmask8) (__U)))
+#define __INT32_C(c) c
+#define __DEC64_EPSILON__ 1E-15DD
+#define _mm256_mask_ternarylogic_epi64(A,U,B,C,I) ((__m256i) __builtin_ia32_pternlogq256_mask ((__v4di) (__m256i) (A), (__v4di) (__m256i) (B), (__v4di) (__m256i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define __ORDER_PDP_ENDIAN__ 3412
+#define _mm256_maskz_alignr_epi8(U,X,Y,N) ((__m256i) __builtin_ia32_palignr256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)((N) * 8), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask32)(U)))
+#define _mm512_maskz_cvtt_roundps_epu32(U,A,B) ((__m512i)__builtin_ia32_cvttps2udq512_mask(A, (__v16si)_mm512_setzero_si512 (), U, B))
+#define BYTE_ORDER __BYTE_ORDER
+#define _mm_mask_permute_pd(W,U,X,C) ((__m128d) __builtin_ia32_vpermilpd_mask ((__v2df)(__m128d)(X), (int)(C), (__v2df)(__m128d)(W), (__mmask8)(U)))
+#define _mm256_insert_epi64(X,D,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 1); __Y = _mm_insert_epi64 (__Y, (D), (N) % 2); _mm256_insertf128_si256 ((X), __Y, (N) >> 1); }))
+#define _mm_cmpistrc(X,Y,M) ((int) __builtin_ia32_pcmpistric128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _mm_mask_permute_ps(W,U,X,C) ((__m128) __builtin_ia32_vpermilps_mask ((__v4sf)(__m128)(X), (int)(C), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define __have_pthread_attr_t 1
+#define _mm_fixupimm_sd(X,Y,Z,C) ((__m128d)__builtin_ia32_fixupimmsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(-1), _MM_FROUND_CUR_DIRECTION))
+#define _mm256_extract_epi64(X,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 1); _mm_extract_epi64 (__Y, (N) % 2); }))
+#define SCNi8 "hhi"
+#define _mm_fixupimm_ss(X,Y,Z,C) ((__m128)__builtin_ia32_fixupimmss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(-1), _MM_FROUND_CUR_DIRECTION))
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+#define _SHAINTRIN_H_INCLUDED 
+#define _mm256_extract_epi8(X,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 4); _mm_extract_epi8 (__Y, (N) % 16); }))
+#define htole32(x) __uint32_identity (x)
+#define _mm512_fnmsub_round_ps(A,B,C,R) (__m512)__builtin_ia32_vfnmsubps512_mask(A, B, C, -1, R)
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+#define _mm_maskz_ternarylogic_epi32(U,A,B,C,I) ((__m128i) __builtin_ia32_pternlogd128_maskz ((__v4si) (__m128i) (A), (__v4si) (__m128i) (B), (__v4si) (__m128i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __UINT_LEAST16_TYPE__ short unsigned int
+#define PRIuFAST8 "u"
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+#define _mm_reduce_round_sd(A,B,C,R) ((__m128d) __builtin_ia32_reducesd_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__mmask8)(U), (int)(R)))
+#define _mm512_i64scatter_ps(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv16sf ((void *) (ADDR), (__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (__v8sf)(__m256) (V1), (int) (SCALE))
+#define _mm_reduce_round_sh(A,B,C,D) (__builtin_ia32_reducesh_mask_round ((A), (B), (C), _mm_setzero_ph (), (__mmask8)-1, (D)))
+#define _mm_reduce_round_ss(A,B,C,R) ((__m128) __builtin_ia32_reducess_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__mmask8)(U), (int)(R)))
+#define _mm256_maskz_shldi_epi16(A,B,C,D) ((__m256i) __builtin_ia32_vpshld_v16hi_mask ((__v16hi)(__m256i)(B), (__v16hi)(__m256i)(C),(int)(D), (__v16hi)(__m256i)_mm256_setzero_si256 (), (__mmask16)(A)))
+#define _mm512_maskz_cvtt_roundps_epu64(U,A,B) ((__m512i)__builtin_ia32_cvttps2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define RAND_MAX 2147483647
+#define __FLT64X_HAS_INFINITY__ 1
+#define unix 1
+#define _mm512_maskz_scalef_round_ps(U,A,B,C) ((__m512) __builtin_ia32_scalefps512_mask((A), (B), (__v16sf) _mm512_setzero_ps(), (U), (C)))
+#define _mm512_mask_fnmadd_round_ph(A,U,B,C,R) ((__m512h)__builtin_ia32_vfnmaddph512_mask ((A), (B), (C), (U), (R)))
+#define __INT16_MAX__ 0x7fff
+#define _MM_SET_DENORMALS_ZERO_MODE(mode) _mm_setcsr ((_mm_getcsr () & ~_MM_DENORMALS_ZERO_MASK) | (mode))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define _BSD_SIZE_T_ 
+#define PULSE_SLOT_US 4
+#define _mm512_mask_cvt_roundepi32_ph(A,B,C,D) (__builtin_ia32_vcvtdq2ph512_mask_round ((__v16si)(C), (A), (B), (D)))
+#define __SIZE_TYPE__ long unsigned int
+#define _mm512_mask_alignr_epi32(W,U,X,Y,C) ((__m512i)__builtin_ia32_alignd512_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(C), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define __enclv_generic(leaf,b,c,d,retval) __asm__ __volatile__("enclv\n\t" : "=a" (retval), "=b" (b), "=c" (b), "=d" (d) : "a" (leaf), "b" (b), "c" (c), "d" (d) : "cc")
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+#define __FLT_IS_IEC_60559__ 2
+#define _mm256_i64gather_pd(BASE,INDEX,SCALE) (__m256d) __builtin_ia32_gatherdiv4df ((__v4df) _mm256_setzero_pd (), (double const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4df) _mm256_cmp_pd (_mm256_setzero_pd (), _mm256_setzero_pd (), _CMP_EQ_OQ), (int) (SCALE))
+#define _mm_mask_fmadd_round_sch(A,B,C,D,E) ((__m128h) __builtin_ia32_vfmaddcsh_mask_round ((__v8hf) (A), (__v8hf) (C), (__v8hf) (D), (B), (E)))
+#define _mm256_i64gather_ps(BASE,INDEX,SCALE) (__m128) __builtin_ia32_gatherdiv4sf256 ((__v4sf) _mm_setzero_ps (), (float const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4sf) _mm_cmpeq_ps (_mm_setzero_ps (), _mm_setzero_ps ()), (int) (SCALE))
+#define _mm_mask_fpclass_ss_mask(X,C,U) ((__mmask8) __builtin_ia32_fpclassss_mask ((__v4sf) (__m128) (X), (int) (C), (__mmask8) (U)))
+#define _mm512_cvt_roundps_epi64(A,B) ((__m512i)__builtin_ia32_cvtps2qq512_mask ((A), (__v8di)_mm512_setzero_si512 (), -1, (B)))
+#define _mm256_dpbusds_epi32(A,B,C) ((__m256i) __builtin_ia32_vpdpbusds_v8si ((__v8si) (A), (__v8si) (B), (__v8si) (C)))
+#define _mm_sha1rnds4_epu32(A,B,I) ((__m128i) __builtin_ia32_sha1rnds4 ((__v4si)(__m128i)(A), (__v4si)(__m128i)(B), (int)(I)))
+#define _mm512_mask_prefetch_i32gather_ps(INDEX,MASK,ADDR,SCALE,HINT) __builtin_ia32_gatherpfdps ((__mmask16) (MASK), (__v16si)(__m512i) (INDEX), (void const *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm512_rsqrt28_round_pd(A,C) __builtin_ia32_rsqrt28pd_mask(A, (__v8df)_mm512_setzero_pd(), -1, C)
+#define __HAVE_DISTINCT_FLOAT128 1
+#define _mm512_rsqrt28_round_ps(A,C) __builtin_ia32_rsqrt28ps_mask(A, (__v16sf)_mm512_setzero_ps(), -1, C)
+#define _mm512_mask_prefetch_i32gather_pd(INDEX,MASK,ADDR,SCALE,HINT) __builtin_ia32_gatherpfdpd ((__mmask8) (MASK), (__v8si)(__m256i) (INDEX), (void const *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _GCC_MAX_ALIGN_T 
+#define _mm512_mask_alignr_epi64(W,U,X,Y,C) ((__m512i)__builtin_ia32_alignq512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(C), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define _mm_maskz_mul_pch(U,A,B) _mm_maskz_fmul_pch ((U), (A), (B))
+#define _mm_cvt_roundsh_u32(A,B) ((int)__builtin_ia32_vcvtsh2usi32_round ((A), (B)))
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define _mm_shuffle_pd(A,B,N) ((__m128d)__builtin_ia32_shufpd ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(N)))
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define _WBNOINVDINTRIN_H_INCLUDED 
+#define _LZCNTINTRIN_H_INCLUDED 
+#define PRIdLEAST8 "d"
+#define _mm_rsqrt28_round_sd(A,B,R) __builtin_ia32_rsqrt28sd_round(A, B, R)
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+#define SCNoLEAST16 "ho"
+#define _mm_rsqrt28_round_ss(A,B,R) __builtin_ia32_rsqrt28ss_round(A, B, R)
+#define __UINTMAX_C(c) c ## UL
+#define _SIDD_CMP_EQUAL_ORDERED 0x0c
+#define _mm_maskz_fmsub_round_sd(U,A,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_maskz (A, B, -(C), U, R)
+#define _POSIX_C_SOURCE 200809L
+#define _mm_maskz_fmsub_round_ss(U,A,B,C,R) (__m128) __builtin_ia32_vfmaddss3_maskz (A, B, -(C), U, R)
+#define _mm_getexp_round_sh(A,B,R) ((__m128h)__builtin_ia32_getexpsh_mask_round((__v8hf)(__m128h)(A), (__v8hf)(__m128h)(B), (__v8hf)_mm_setzero_ph(), (__mmask8)-1, R))
+#define __SSE_MATH__ 1
+#define __k8 1
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define _mm512_mask_fpclass_pd_mask(u,X,C) ((__mmask8) __builtin_ia32_fpclasspd512_mask ((__v8df) (__m512d) (X), (int) (C), (__mmask8)(u)))
+#define __LDBL_REDIR(name,proto) name proto
+#define __bextri_u32(X,I) ((unsigned int)__builtin_ia32_bextri_u32 ((unsigned int)(X), (unsigned int)(I)))
+#define _mm_alignr_epi8(X,Y,N) ((__m128i) __builtin_ia32_palignr128 ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(N) * 8))
+#define _mm_cmp_epu64_mask(X,Y,P) ((__mmask8) __builtin_ia32_ucmpq128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(P), (__mmask8)-1))
+#define _mm256_dpbusd_epi32(A,B,C) ((__m256i) __builtin_ia32_vpdpbusd_v8si ((__v8si) (A), (__v8si) (B), (__v8si) (C)))
+#define _mm512_mask_extracti64x4_epi64(W,U,X,C) ((__m256i) __builtin_ia32_extracti64x4_mask ((__v8di)(__m512i) (X), (int) (C), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define _mm512_maskz_fmul_round_pch(A,B,C,E) (__m512h) __builtin_ia32_vfmulcph512_mask_round ((B), (C), (__v32hf) _mm512_setzero_ph (), (A), (E))
+#define PRIu16 "u"
+#define WCHAR_MIN __WCHAR_MIN
+#define __blksize_t_defined 
+#define _mm512_maskz_min_round_pd(U,A,B,R) (__m512d)__builtin_ia32_minpd512_mask(A, B, (__v8df)_mm512_setzero_pd(), U, R)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+#define _mm512_maskz_insertf64x2(U,X,Y,C) ((__m512d) __builtin_ia32_insertf64x2_512_mask ((__v8df)(__m512d) (X), (__v2df)(__m128d) (Y), (int) (C), (__v8df)(__m512d) _mm512_setzero_pd (), (__mmask8) (U)))
+#define _mm512_maskz_insertf64x4(U,X,Y,C) ((__m512d) __builtin_ia32_insertf64x4_mask ((__v8df)(__m512d) (X), (__v4df)(__m256d) (Y), (int) (C), (__v8df)(__m512d)_mm512_setzero_pd(), (__mmask8)(U)))
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+#define _mm_maskz_range_round_sd(U,A,B,C,R) ((__m128d) __builtin_ia32_rangesd128_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df) _mm_setzero_pd (), (__mmask8)(U), (R)))
+#define _mm512_maskz_fcmul_round_pch(A,B,C,E) (__m512h) __builtin_ia32_vfcmulcph512_mask_round ((B), (C), (__v32hf) _mm512_setzero_ph (), (A), (E))
+#define __WCHAR_MAX __WCHAR_MAX__
+#define _mm_maskz_range_round_ss(U,A,B,C,R) ((__m128) __builtin_ia32_rangess128_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf) _mm_setzero_ps (), (__mmask8)(U), (R)))
+#define __enclv_bc(leaf,b,c,retval) __asm__ __volatile__("enclv\n\t" : "=a" (retval) : "a" (leaf), "b" (b), "c" (c) : "cc")
+#define _mm_mask_cmp_epu16_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_ucmpw128_mask ((__v8hi)(__m128i)(X), (__v8hi)(__m128i)(Y), (int)(P), (__mmask8)(M)))
+#define PRIu32 "u"
+#define __bextri_u64(X,I) ((unsigned long long)__builtin_ia32_bextri_u64 ((unsigned long long)(X), (unsigned long long)(I)))
+#define __enclv_cd(leaf,c,d,retval) __asm__ __volatile__("enclv\n\t" : "=a" (retval) : "a" (leaf), "c" (c), "d" (d) : "cc")
+#define _mm512_mask_cvtt_roundpd_epu64(W,U,A,B) ((__m512i)__builtin_ia32_cvttpd2uqq512_mask ((A), (__v8di)(W), (U), (B)))
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+#define _MM_CMPINT_EQ 0x0
+#define _mm512_cvt_roundps_ph(A,I) ((__m256i) __builtin_ia32_vcvtps2ph512_mask ((__v16sf)(__m512) (A), (int) (I), (__v16hi)_mm256_undefined_si256 (), -1))
+#define _mm_mask_alignr_epi32(W,U,X,Y,C) ((__m128i)__builtin_ia32_alignd128_mask ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(C), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define SCNoMAX __PRI64_PREFIX "o"
+#define _mm512_mask_fixupimm_round_ps(X,U,Y,Z,C,R) ((__m512)__builtin_ia32_fixupimmps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (__v16si)(__m512i)(Z), (int)(C), (__mmask16)(U), (R)))
+#define __CFLOAT32X _Complex _Float32x
+#define INT8_C(c) c
+#define _mm256_mask_cmp_epu64_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_ucmpq256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(P), (__mmask8)(M)))
+#define PRIu64 __PRI64_PREFIX "u"
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+#define _mm512_mask_i32scatter_ps(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv16sf ((void *) (ADDR), (__mmask16) (MASK), (__v16si)(__m512i) (INDEX), (__v16sf)(__m512) (V1), (int) (SCALE))
+#define _MM_CMPINT_GE 0x5
+#define _mm256_maskz_shuffle_epi32(U,X,C) ((__m256i) __builtin_ia32_pshufd256_mask ((__v8si)(__m256i)(X), (int)(C), (__v8si)(__m256i) _mm256_setzero_si256 (), (__mmask8)(U)))
+#define _mm_maskz_range_sd(U,A,B,C) ((__m128d) __builtin_ia32_rangesd128_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df) _mm_setzero_pd (), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _MM_CMPINT_GT 0x6
+#define _mm512_mask_cvt_roundph_epi16(A,B,C,D) ((__m512i)__builtin_ia32_vcvtph2w512_mask_round ((C), (__v32hi)(A), (B), (D)))
+#define __uid_t_defined 
+#define _mm_insert_epi16(A,D,N) ((__m128i) __builtin_ia32_vec_set_v8hi ((__v8hi)(__m128i)(A), (int)(D), (int)(N)))
+#define _mm_range_pd(A,B,C) ((__m128d) __builtin_ia32_rangepd128_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)_mm_setzero_pd(), (__mmask8)-1))
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+#define _mm_range_ps(A,B,C) ((__m128) __builtin_ia32_rangeps128_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)_mm_setzero_ps(), (__mmask8)-1))
+#define __FLT32X_MIN_EXP__ (-1021)
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+#define HAL_DEFINES_H 
+#define _mm_mask_reduce_ps(W,U,A,B) ((__m128) __builtin_ia32_reduceps128_mask ((__v4sf)(__m128)(A), (int)(B), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define _mm512_mask_ror_epi32(W,U,A,B) ((__m512i)__builtin_ia32_prord512_mask ((__v16si)(__m512i)(A), (int)(B), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define _mm_mask_alignr_epi64(W,U,X,Y,C) ((__m128i)__builtin_ia32_alignq128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(C), (__v2di)(__m128i)(X), (__mmask8)-1))
+#define PRIxLEAST16 "x"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+#define __timer_t_defined 1
+#define _mm256_permute2f128_si256(X,Y,C) ((__m256i) __builtin_ia32_vperm2f128_si256 ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(C)))
+#define _mm_cmp_round_ss_mask(X,Y,P,R) ((__mmask8) __builtin_ia32_cmpss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P), (__mmask8)-1, R))
+#define __WCLONE 0x80000000
+#define _mm_maskz_fnmsub_round_sd(U,A,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_maskz (A, -(B), -(C), U, R)
+#define _mm_insert_epi32(D,S,N) ((__m128i) __builtin_ia32_vec_set_v4si ((__v4si)(__m128i)(D), (int)(S), (int)(N)))
+#define _mm_maskz_fnmsub_round_sh(U,A,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_maskz ((A), -(B), -(C), (U), (R)))
+#define _mm512_shrdi_epi64(A,B,C) ((__m512i) __builtin_ia32_vpshrd_v8di ((__v8di)(__m512i)(A), (__v8di)(__m512i)(B),(int)(C)))
+#define _mm_mask_fcmadd_round_sch(A,B,C,D,E) ((__m128h) __builtin_ia32_vfcmaddcsh_mask_round ((__v8hf) (A), (__v8hf) (C), (__v8hf) (D), (B), (E)))
+#define _mm_range_sd(A,B,C) ((__m128d) __builtin_ia32_rangesd128_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df) _mm_setzero_pd (), (__mmask8) -1, _MM_FROUND_CUR_DIRECTION))
+#define PRIxLEAST32 "x"
+#define __WCHAR_MIN __WCHAR_MIN__
+#define __FLT64_DIG__ 15
+#define _mm_range_ss(A,B,C) ((__m128) __builtin_ia32_rangess128_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf) _mm_setzero_ps (), (__mmask8) -1, _MM_FROUND_CUR_DIRECTION))
+#define _mm256_srli_si256(A,N) ((__m256i)__builtin_ia32_psrldqi256 ((__m256i)(A), (int)(N) * 8))
+#define _CMP_EQ_OQ 0x00
+#define _mm512_mask_ror_epi64(W,U,A,B) ((__m512i)__builtin_ia32_prorq512_mask ((__v8di)(__m512i)(A), (int)(B), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define _mm256_mmask_i32gather_epi32(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256i) __builtin_ia32_gather3siv8si ((__v8si)(__m256i) (V1OLD), (void const *) (ADDR), (__v8si)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _tile_dpbusd(dst,src1,src2) _tile_int8_dp_internal (tdpbusd, dst, src1, src2)
+#define _MM_EXCEPT_INEXACT 0x0020
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+#define _MM_CMPINT_LE 0x2
+#define INT32_C(c) c
+#define _MM_CMPINT_LT 0x1
+#define _CLZEROINTRIN_H_INCLUDED 
+#define _mm512_mask_cvt_roundph_epi64(A,B,C,D) (__builtin_ia32_vcvtph2qq512_mask_round ((C), (A), (B), (D)))
+#define _mm_insert_epi64(D,S,N) ((__m128i) __builtin_ia32_vec_set_v2di ((__v2di)(__m128i)(D), (long long)(S), (int)(N)))
+#define _mm_mask_cmp_ph_mask(A,B,C,D) (__builtin_ia32_cmpph128_mask ((B), (C), (D), (A)))
+#define __glibc_c99_flexarr_available 1
+#define _mm512_inserti64x2(X,Y,C) ((__m512i) __builtin_ia32_inserti64x2_512_mask ((__v8di)(__m512i) (X), (__v2di)(__m128i) (Y), (int) (C), (__v8di)(__m512i) (X), (__mmask8)-1))
+#define _mm512_inserti64x4(X,Y,C) ((__m512i) __builtin_ia32_inserti64x4_mask ((__v8di)(__m512i) (X), (__v4di)(__m256i) (Y), (int) (C), (__v8di)(__m512i)_mm512_undefined_epi32 (), (__mmask8)-1))
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define _AMXINT8INTRIN_H_INCLUDED 
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+#define _mm_mask_cvtss_sd(W,U,A,B) _mm_mask_cvt_roundss_sd ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm_mask_cmp_ss_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P), M,_MM_FROUND_CUR_DIRECTION))
+#define _tile_dpbuud(dst,src1,src2) _tile_int8_dp_internal (tdpbuud, dst, src1, src2)
+#define _MM_CMPINT_NE 0x4
+#define PRIxFAST16 __PRIPTR_PREFIX "x"
+#define _mm512_mask_sqrt_round_ps(W,U,A,C) (__m512)__builtin_ia32_sqrtps512_mask(A, W, U, C)
+#define _mm512_maskz_cvt_roundpd_ph(A,B,C) (__builtin_ia32_vcvtpd2ph512_mask_round ((__v8df)(B), _mm_setzero_ph (), (A), (C)))
+#define _BITS_PTHREADTYPES_COMMON_H 1
+#define _mm256_mmask_i32gather_epi64(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256i) __builtin_ia32_gather3siv4di ((__v4di)(__m256i) (V1OLD), (void const *) (ADDR), (__v4si)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define PRIX16 "X"
+#define _mm512_mask_gf2p8affineinv_epi64_epi8(A,B,C,D,E) ((__m512i) __builtin_ia32_vgf2p8affineinvqb_v64qi_mask( (__v64qi)(__m512i)(C), (__v64qi)(__m512i)(D), (int)(E), (__v64qi)(__m512i)(A), (__mmask64)(B)))
+#define __UINT_FAST16_TYPE__ long unsigned int
+#define __DEC64_MAX__ 9.999999999999999E384DD
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+#define _mm_rol_epi64(A,B) ((__m128i)__builtin_ia32_prolq128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)-1))
+#define _mm_max_round_sd(A,B,C) (__m128d)__builtin_ia32_maxsd_round(A, B, C)
+#define _mm256_cmp_epu16_mask(X,Y,P) ((__mmask16) __builtin_ia32_ucmpw256_mask ((__v16hi)(__m256i)(X), (__v16hi)(__m256i)(Y), (int)(P), (__mmask16)(-1)))
+#define _mm_mask3_fmadd_round_sd(A,B,C,U,R) (__m128d) __builtin_ia32_vfmaddsd3_mask3 (A, B, C, U, R)
+#define _mm_mask3_fmadd_round_sh(A,B,C,U,R) ((__m128h) __builtin_ia32_vfmaddsh3_mask3 ((A), (B), (C), (U), (R)))
+#define _SIDD_UWORD_OPS 0x01
+#define PRIxFAST32 __PRIPTR_PREFIX "x"
+#define _XSAVESINTRIN_H_INCLUDED 
+#define _mm_fmul_round_sch(__A,__B,__D) (__m128h) __builtin_ia32_vfmulcsh_round ((__v8hf) __A, (__v8hf) __B, __D)
+#define _mm_ternarylogic_epi32(A,B,C,I) ((__m128i) __builtin_ia32_pternlogd128_mask ((__v4si) (__m128i) (A), (__v4si) (__m128i) (B), (__v4si) (__m128i) (C), (unsigned char) (I), (__mmask8) -1))
+#define __FLT16_DECIMAL_DIG__ 5
+#define _VA_LIST_DEFINED 
+#define PRIX32 "X"
+#define _mm_maskz_rcp28_round_sd(U,A,B,R) __builtin_ia32_rcp28sd_mask_round ((A), (B), (__v2df) _mm_setzero_pd (), (U), (R))
+#define _mm_mask_cvt_roundss_sd(W,U,A,B,C) (__m128d)__builtin_ia32_cvtss2sd_mask_round ((A), (B), (W), (U), (C))
+#define _mm512_cmp_round_pd_mask(X,Y,P,R) ((__mmask8) __builtin_ia32_cmppd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(P), (__mmask8)-1, R))
+#define __ATOMIC_CONSUME 1
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define _mm_i64gather_pd(BASE,INDEX,SCALE) (__m128d) __builtin_ia32_gatherdiv2df ((__v2df) _mm_setzero_pd (), (double const *) (BASE), (__v2di)(__m128i) (INDEX), (__v2df) _mm_cmpeq_pd (_mm_setzero_pd (), _mm_setzero_pd ()), (int) (SCALE))
+#define _CMP_EQ_US 0x18
+#define __INT_LEAST16_MAX__ 0x7fff
+#define _mm_i64gather_ps(BASE,INDEX,SCALE) (__m128) __builtin_ia32_gatherdiv4sf ((__v4sf) _mm_setzero_pd (), (float const *) (BASE), (__v2di)(__m128i) (INDEX), (__v4sf) _mm_cmpeq_ps (_mm_setzero_ps (), _mm_setzero_ps ()), (int) (SCALE))
+#define _mm_mask_fmadd_round_sd(A,U,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_mask (A, B, C, U, R)
+#define _mm_mask_fmadd_round_sh(A,U,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_mask ((A), (B), (C), (U), (R)))
+#define __DEC64_MANT_DIG__ 16
+#define _mm512_mask_cvt_roundepi16_ph(A,B,C,D) (__builtin_ia32_vcvtw2ph512_mask_round ((__v32hi)(C), (A), (B), (D)))
+#define _mm_mask_fmadd_round_ss(A,U,B,C,R) (__m128) __builtin_ia32_vfmaddss3_mask (A, B, C, U, R)
+#define __INT64_MAX__ 0x7fffffffffffffffL
+#define _BITS_ENDIAN_H 1
+#define _mm_cmp_epu8_mask(X,Y,P) ((__mmask16) __builtin_ia32_ucmpb128_mask ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(P), (__mmask16)(-1)))
+#define __SEG_GS 1
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+#define _mm256_mask_shuffle_i64x2(W,U,X,Y,C) ((__m256i) __builtin_ia32_shuf_i64x2_256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(C), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define _mm_broadcastsd_pd(X) _mm_movedup_pd(X)
+#define __SIG_ATOMIC_WIDTH__ 32
+#define _mm256_slli_si256(A,N) ((__m256i)__builtin_ia32_pslldqi256 ((__m256i)(A), (int)(N) * 8))
+#define PRIxFAST64 __PRI64_PREFIX "x"
+#define __UINT8_C(c) c
+#define _mm_mask_reduce_round_sd(W,U,A,B,C,R) ((__m128d) __builtin_ia32_reducesd_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)(__m128d)(W), (__mmask8)(U), (int)(R)))
+#define INT64_MAX (__INT64_C(9223372036854775807))
+#define _mm512_mask_cvt_roundpd_epi32(W,U,A,B) ((__m256i)__builtin_ia32_cvtpd2dq512_mask(A, (__v8si)(W), U, B))
+#define _mm_ternarylogic_epi64(A,B,C,I) ((__m128i) __builtin_ia32_pternlogq128_mask ((__v2di) (__m128i) (A), (__v2di) (__m128i) (B), (__v2di) (__m128i) (C), (unsigned char) (I), (__mmask8) -1))
+#define __INT16_TYPE__ short int
+#define PRIX64 __PRI64_PREFIX "X"
+#define __ATOMIC_HLE_RELEASE 131072
+#define _mm_cmul_pch(A,B) _mm_fcmul_pch ((A), (B))
+#define _mm256_mask_i64scatter_epi64(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4di ((void *) (ADDR), (__mmask8) (MASK), (__v4di)(__m256i) (INDEX), (__v4di)(__m256i) (V1), (int) (SCALE))
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+#define _tile_zero_internal(dst) __asm__ volatile ("tilezero\t%%tmm"#dst ::)
+#define _mm512_mask_shuffle_i32x4(W,U,X,Y,C) ((__m512i) __builtin_ia32_shuf_i32x4_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(C), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define ONEWIRE_CH 8
+#define _mm512_mask_cvt_roundpd_epi64(W,U,A,B) ((__m512i)__builtin_ia32_cvtpd2qq512_mask ((A), (__v8di)(W), (U), (B)))
+#define linux 1
+#define _mm512_fmadd_round_pd(A,B,C,R) (__m512d)__builtin_ia32_vfmaddpd512_mask(A, B, C, -1, R)
+#define _mm512_fmadd_round_ps(A,B,C,R) (__m512)__builtin_ia32_vfmaddps512_mask(A, B, C, -1, R)
+#define SCNdMAX __PRI64_PREFIX "d"
+#define PDP_ENDIAN __PDP_ENDIAN
+#define htole64(x) __uint64_identity (x)
+#define _XTESTINTRIN_H_INCLUDED 
+#define _mm_cvtps_ph(A,I) ((__m128i) __builtin_ia32_vcvtps2ph ((__v4sf)(__m128) (A), (int) (I)))
+#define _mm_dpbusd_epi32(A,B,C) ((__m128i) __builtin_ia32_vpdpbusd_v4si ((__v4si) (A), (__v4si) (B), (__v4si) (C)))
+#define _mm256_mask_shuffle_pd(W,U,A,B,C) ((__m256d)__builtin_ia32_shufpd256_mask ((__v4df)(__m256d)(A), (__v4df)(__m256d)(B), (int)(C), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define __FLT32_MIN_10_EXP__ (-37)
+#define __FLT32X_DIG__ 15
+#define _mm256_maskz_insertf32x4(U,X,Y,C) ((__m256) __builtin_ia32_insertf32x4_256_mask ((__v8sf)(__m256) (X), (__v4sf)(__m128) (Y), (int) (C), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)(U)))
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+#define __WORDSIZE 64
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+#define _mm_add_round_ss(A,B,C) (__m128)__builtin_ia32_addss_round(A, B, C)
+#define _mm512_maskz_shuffle_pd(U,X,Y,C) ((__m512d)__builtin_ia32_shufpd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(C), (__v8df)(__m512d)_mm512_setzero_pd(), (__mmask8)(U)))
+#define _mm_maskz_shuffle_pd(U,A,B,C) ((__m128d)__builtin_ia32_shufpd128_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)(__m128d)_mm_setzero_pd (), (__mmask8)(U)))
+#define _mm512_maskz_shuffle_ps(U,X,Y,C) ((__m512)__builtin_ia32_shufps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(C), (__v16sf)(__m512)_mm512_setzero_ps(), (__mmask16)(U)))
+#define PRIXLEAST8 "X"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+#define __DBL_HAS_QUIET_NAN__ 1
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __FLT16_HAS_INFINITY__ 1
+#define PRIuLEAST8 "u"
+#define _mm256_mmask_i64gather_epi64(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256i) __builtin_ia32_gather3div4di ((__v4di)(__m256i) (V1OLD), (void const *) (ADDR), (__v4di)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _BITS_BYTESWAP_H 1
+#define _mm256_mask_extractf64x2_pd(W,U,X,C) ((__m128d) __builtin_ia32_extractf64x2_256_mask ((__v4df)(__m256d) (X), (int) (C), (__v2df)(__m128d) (W), (__mmask8) (U)))
+#define _CMP_NLT_UQ 0x15
+#define _mm_mmask_i64gather_pd(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128d) __builtin_ia32_gather3div2df ((__v2df)(__m128d) (V1OLD), (void const *) (ADDR), (__v2di)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm_mmask_i64gather_ps(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128) __builtin_ia32_gather3div4sf ((__v4sf)(__m128) (V1OLD), (void const *) (ADDR), (__v2di)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define __code_model_small__ 1
+#define _mm512_fmadd_round_ph(A,B,C,R) ((__m512h)__builtin_ia32_vfmaddph512_mask ((A), (B), (C), -1, (R)))
+#define _mm512_mask3_fmaddsub_round_ph(A,B,C,U,R) ((__m512h)__builtin_ia32_vfmaddsubph512_mask3 ((A), (B), (C), (U), (R)))
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define _mm512_mask3_fmaddsub_round_ps(A,B,C,U,R) (__m512)__builtin_ia32_vfmaddsubps512_mask3(A, B, C, U, R)
+#define le64toh(x) __uint64_identity (x)
+#define _ADXINTRIN_H_INCLUDED 
+#define __FLT16_MANT_DIG__ 11
+#define _mm_mask_cmp_epu32_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_ucmpd128_mask ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(P), (__mmask8)(M)))
+#define __INTPTR_TYPE__ long int
+#define __WCHAR_TYPE__ int
+#define __SIZEOF_FLOAT__ 4
+#define __SLONGWORD_TYPE long int
+#define _mm512_mask_gf2p8affine_epi64_epi8(A,B,C,D,E) ((__m512i) __builtin_ia32_vgf2p8affineqb_v64qi_mask((__v64qi)(__m512i)(C), (__v64qi)(__m512i)(D), (int)(E), (__v64qi)(__m512i)(A), (__mmask64)(B)))
+#define _mm512_maskz_extractf32x4_ps(U,X,C) ((__m128) __builtin_ia32_extractf32x4_mask ((__v16sf)(__m512) (X), (int) (C), (__v4sf)(__m128)_mm_setzero_ps(), (__mmask8)(U)))
+#define _mm_mul_sch(A,B) _mm_fmul_sch ((A), (B))
+#define PULSE_SPIN_US 80
+#define _mm_mask_mul_pch(W,U,A,B) _mm_mask_fmul_pch ((W), (U), (A), (B))
+#define _mm_round_ss(D,V,M) ((__m128) __builtin_ia32_roundss ((__v4sf)(__m128)(D), (__v4sf)(__m128)(V), (int)(M)))
+#define __DEC64_MIN_EXP__ (-382)
+#define __stub_chflags 
+#define SCNxPTR __PRIPTR_PREFIX "x"
+#define _mm_maskz_rsqrt28_round_sd(U,A,B,R) __builtin_ia32_rsqrt28sd_mask_round ((A), (B), (__v2df) _mm_setzero_pd (), (U), (R))
+#define _mm_maskz_rsqrt28_round_ss(U,A,B,R) __builtin_ia32_rsqrt28ss_mask_round ((A), (B), (__v4sf) _mm_setzero_ps (), (U), (R))
+#define _mm_mask_shldi_epi64(A,B,C,D,E) ((__m128i) __builtin_ia32_vpshld_v2di_mask ((__v2di)(__m128i)(C), (__v2di)(__m128i)(D), (int)(E), (__v2di)(__m128i)(A), (__mmask8)(B)))
+#define __FLT32_DECIMAL_DIG__ 9
+#define _mm_mask_cvt_roundsh_sd(A,B,C,D,R) (__builtin_ia32_vcvtsh2sd_mask_round ((D), (C), (A), (B), (R)))
+#define _mm_mask_cvt_roundsh_ss(A,B,C,D,R) (__builtin_ia32_vcvtsh2ss_mask_round ((D), (C), (A), (B), (R)))
+#define __USE_POSIX 1
+#define RELEASE_DEFINES __GIT_REVPARSE__
+#define BUFSIZ 8192
+#define _AVX512VP2INTERSECTINTRIN_H_INCLUDED 
+#define _mm512_ror_epi32(A,B) ((__m512i)__builtin_ia32_prord512_mask ((__v16si)(__m512i)(A), (int)(B), (__v16si)_mm512_undefined_epi32 (), (__mmask16)(-1)))
+#define _mm256_cmul_pch(A,B) _mm256_fcmul_pch ((A), (B))
+#define _mm512_mask_cmp_epu64_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_ucmpq512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(P), (__mmask8)(M)))
+#define COMMPORT_TYPE_SPI 6
+#define __FLT_MAX_10_EXP__ 38
+#define _mm_maskz_rcp28_ss(U,A,B) _mm_maskz_rcp28_round_ss ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _WCHAR_T_DECLARED 
+#define _mm512_maskz_cvt_roundps_epi32(U,A,B) ((__m512i)__builtin_ia32_cvtps2dq512_mask(A, (__v16si)_mm512_setzero_si512 (), U, B))
+#define _MM_FROUND_FLOOR (_MM_FROUND_TO_NEG_INF | _MM_FROUND_RAISE_EXC)
+#define _mm_maskz_getexp_round_sd(U,A,B,C) (__m128d)__builtin_ia32_getexpsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, C)
+#define WNOWAIT 0x01000000
+#define _mm512_maskz_shuffle_epi32(U,X,C) ((__m512i) __builtin_ia32_pshufd512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _mm_mul_round_sd(A,B,C) (__m128d)__builtin_ia32_mulsd_round(A, B, C)
+#define _mm_mul_round_ss(A,B,C) (__m128)__builtin_ia32_mulss_round(A, B, C)
+#define __amd64__ 1
+#define _mm256_maskz_shufflelo_epi16(U,A,B) ((__m256i) __builtin_ia32_pshuflw256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)(__m256i)_mm256_setzero_si256 (), (__mmask16)(U)))
+#define _mm_mask_roundscale_round_ss(A,U,B,C,I,R) ((__m128) __builtin_ia32_rndscaless_mask_round ((__v4sf) (__m128) (B), (__v4sf) (__m128) (C), (int) (I), (__v4sf) (__m128) (A), (__mmask8) (U), (int) (R)))
+#define _mm512_mask3_fnmsub_round_pd(A,B,C,U,R) (__m512d)__builtin_ia32_vfnmsubpd512_mask3(A, B, C, U, R)
+#define _mm512_ror_epi64(A,B) ((__m512i)__builtin_ia32_prorq512_mask ((__v8di)(__m512i)(A), (int)(B), (__v8di)_mm512_undefined_epi32 (), (__mmask8)(-1)))
+#define _mm512_mask3_fnmsub_round_ph(A,B,C,U,R) ((__m512h)__builtin_ia32_vfnmsubph512_mask3 ((A), (B), (C), (U), (R)))
+#define _mm512_insertf32x4(X,Y,C) ((__m512) __builtin_ia32_insertf32x4_mask ((__v16sf)(__m512) (X), (__v4sf)(__m128) (Y), (int) (C), (__v16sf)(__m512) (X), (__mmask16)(-1)))
+#define __S16_TYPE short int
+#define _mm512_mask3_fnmsub_round_ps(A,B,C,U,R) (__m512)__builtin_ia32_vfnmsubps512_mask3(A, B, C, U, R)
+#define _mm512_maskz_getexp_round_pd(U,A,R) ((__m512d)__builtin_ia32_getexppd512_mask((__v8df)(__m512d)(A), (__v8df)_mm512_setzero_pd(), (__mmask8)(U), R))
+#define _mm512_maskz_getexp_round_ph(U,A,R) ((__m512h)__builtin_ia32_getexpph512_mask((__v32hf)(__m512h)(A), (__v32hf)_mm512_setzero_ph(), (__mmask32)(U), R))
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define _mm512_maskz_getexp_round_ps(U,A,R) ((__m512)__builtin_ia32_getexpps512_mask((__v16sf)(__m512)(A), (__v16sf)_mm512_setzero_ps(), (__mmask16)(U), R))
+#define _mm512_mask_cvtt_roundph_epu64(A,B,C,D) __builtin_ia32_vcvttph2uqq512_mask_round ((C), (A), (B), (D))
+#define PRIXMAX __PRI64_PREFIX "X"
+#define _mm512_maskz_cvt_roundps_epi64(U,A,B) ((__m512i)__builtin_ia32_cvtps2qq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define __TIMESIZE __WORDSIZE
+#define SCNoFAST32 __PRIPTR_PREFIX "o"
+#define _mm512_mask_cmul_pch(W,U,A,B) _mm512_mask_fcmul_pch ((W), (U), (A), (B))
+#define __FLT16_HAS_QUIET_NAN__ 1
+#define SCNuMAX __PRI64_PREFIX "u"
+#define __FLT_MAX_EXP__ 128
+#define _mm256_ternarylogic_epi32(A,B,C,I) ((__m256i) __builtin_ia32_pternlogd256_mask ((__v8si) (__m256i) (A), (__v8si) (__m256i) (B), (__v8si) (__m256i) (C), (unsigned char) (I), (__mmask8) -1))
+#define _mm512_maskz_shufflehi_epi16(U,A,B) ((__m512i) __builtin_ia32_pshufhw512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i) _mm512_setzero_si512 (), (__mmask32)(U)))
+#define __gid_t_defined 
+#define _mm256_mask_extractf32x4_ps(W,U,X,C) ((__m128) __builtin_ia32_extractf32x4_256_mask ((__v8sf)(__m256) (X), (int) (C), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define _mm512_mask_getmant_pd(W,U,X,B,C) ((__m512d)__builtin_ia32_getmantpd512_mask ((__v8df)(__m512d)(X), (int)(((C)<<2) | (B)), (__v8df)(__m512d)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm_maskz_fmadd_round_sch(A,B,C,D,E) __builtin_ia32_vfmaddcsh_maskz_round ((B), (C), (D), (A), (E))
+#define _mm512_maskz_fixupimm_ps(U,X,Y,Z,C) ((__m512)__builtin_ia32_fixupimmps512_maskz ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (__v16si)(__m512i)(Z), (int)(C), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_maskz_range_pd(U,A,B,C) ((__m512d) __builtin_ia32_rangepd512_mask ((__v8df)(__m512d)(A), (__v8df)(__m512d)(B), (int)(C), (__v8df)_mm512_setzero_pd (), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_maskz_range_ps(U,A,B,C) ((__m512) __builtin_ia32_rangeps512_mask ((__v16sf)(__m512)(A), (__v16sf)(__m512)(B), (int)(C), (__v16sf)_mm512_setzero_ps (), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_maskz_inserti32x8(U,X,Y,C) ((__m512i) __builtin_ia32_inserti32x8_mask ((__v16si)(__m512i) (X), (__v8si)(__m256i) (Y), (int) (C), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define __ptr_t void *
+#define __DBL_MANT_DIG__ 53
+#define _mm_maskz_getexp_sd(U,A,B) (__m128d)__builtin_ia32_getexpsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, _MM_FROUND_CUR_DIRECTION)
+#define __TIMER_T_TYPE void *
+#define _mm_maskz_getexp_ss(U,A,B) (__m128)__builtin_ia32_getexpss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, _MM_FROUND_CUR_DIRECTION)
+#define SCNoFAST64 __PRI64_PREFIX "o"
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+#define __clock_t_defined 1
+#define _mm512_fixupimm_ps(X,Y,Z,C) ((__m512)__builtin_ia32_fixupimmps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (__v16si)(__m512i)(Z), (int)(C), (__mmask16)(-1), _MM_FROUND_CUR_DIRECTION))
+#define _AVX512BF16INTRIN_H_INCLUDED 
+#define __glibc_clang_prereq(maj,min) 0
+#define __GLIBC_MINOR__ 36
+#define __DEC64_MIN__ 1E-383DD
+#define HAL_ARCH_H 
+#define __UINT_LEAST32_TYPE__ unsigned int
+#define __SSE__ 1
+#define SCNu16 "hu"
+#define __sigset_t_defined 1
+#define _rdtscp(a) __rdtscp(a)
+#define __LDBL_MIN_EXP__ (-16381)
+#define _mm512_cvt_roundph_epu64(A,B) (__builtin_ia32_vcvtph2uqq512_mask_round ((A), _mm512_setzero_si512 (), (__mmask8)-1, (B)))
+#define _MM_CMPINT_NLE 0x6
+#define _mm512_maskz_cvt_roundepi64_pd(U,A,B) ((__m512d)__builtin_ia32_cvtqq2pd512_mask ((__v8di)(A), (__v8df)_mm512_setzero_pd (), (U), (B)))
+#define _mm512_maskz_cvt_roundepi64_ph(A,B,C) (__builtin_ia32_vcvtqq2ph512_mask_round ((__v8di)(B), _mm_setzero_ph (), (A), (C)))
+#define _mm512_sub_round_pd(A,B,C) (__m512d)__builtin_ia32_subpd512_mask(A, B, (__v8df)_mm512_undefined_pd(), -1, C)
+#define _MM_CMPINT_NLT 0x5
+#define __BIT_TYPES_DEFINED__ 1
+#define _mm512_sub_round_ps(A,B,C) (__m512)__builtin_ia32_subps512_mask(A, B, (__v16sf)_mm512_undefined_ps(), -1, C)
+#define _mm_maskz_sub_round_sd(U,A,B,C) (__m128d)__builtin_ia32_subsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, C)
+#define _mm_maskz_sub_round_sh(A,B,C,D) ((__m128h)__builtin_ia32_subsh_mask_round ((B), (C), _mm_setzero_ph (), (A), (D)))
+#define _mm_getmant_pd(X,B,C) ((__m128d) __builtin_ia32_getmantpd128_mask ((__v2df)(__m128d) (X), (int)(((C)<<2) | (B)), (__v2df)(__m128d)_mm_setzero_pd (), (__mmask8)-1))
+#define SCNu32 "u"
+#define _mm512_mask_cvtt_roundpd_epu32(W,U,A,B) ((__m256i)__builtin_ia32_cvttpd2udq512_mask(A, (__v8si)(W), U, B))
+#define stdout stdout
+#define _mm_maskz_sub_round_ss(U,A,B,C) (__m128)__builtin_ia32_subss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, C)
+#define _mm_getmant_ps(X,B,C) ((__m128) __builtin_ia32_getmantps128_mask ((__v4sf)(__m128) (X), (int)(((C)<<2) | (B)), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)-1))
+#define _AVX512VLBWINTRIN_H_INCLUDED 
+#define __WINT_WIDTH__ 32
+#define __INT_LEAST8_MAX__ 0x7f
+#define __AVX512FP16INTRIN_H_INCLUDED 
+#define __FLT32X_MAX_10_EXP__ 308
+#define _mm_cvt_roundsd_i32(A,B) ((int)__builtin_ia32_vcvtsd2si32(A, B))
+#define ____mbstate_t_defined 1
+#define __stub_stty 
+#define _mm_div_round_sd(A,B,C) (__m128d)__builtin_ia32_divsd_round(A, B, C)
+#define _mm_div_round_sh(A,B,C) ((__m128h)__builtin_ia32_divsh_mask_round ((A), (B), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define _mm_div_round_ss(A,B,C) (__m128)__builtin_ia32_divss_round(A, B, C)
+#define _mm_cmp_epi8_mask(X,Y,P) ((__mmask16) __builtin_ia32_cmpb128_mask ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(P), (__mmask16)(-1)))
+#define __FLT64X_IS_IEC_60559__ 2
+#define _mm_getmant_sd(X,Y,C,D) ((__m128d)__builtin_ia32_getmantsd_round ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(((D)<<2) | (C)), _MM_FROUND_CUR_DIRECTION))
+#define _mm_getmant_sh(X,Y,C,D) ((__m128h)__builtin_ia32_getmantsh_mask_round ((__v8hf)(__m128h)(X), (__v8hf)(__m128h)(Y), (int)(((D)<<2) | (C)), (__v8hf)(__m128h) _mm_setzero_ph (), (__mmask8)-1, _MM_FROUND_CUR_DIRECTION))
+#define SCNu64 __PRI64_PREFIX "u"
+#define _mm_getmant_ss(X,Y,C,D) ((__m128)__builtin_ia32_getmantss_round ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(((D)<<2) | (C)), _MM_FROUND_CUR_DIRECTION))
+#define _mm_range_round_sd(A,B,C,R) ((__m128d) __builtin_ia32_rangesd128_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df) _mm_setzero_pd (), (__mmask8) -1, (R)))
+#define _mm512_mask_srli_epi16(W,U,A,B) ((__m512i) __builtin_ia32_psrlwi512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i)(W), (__mmask32)(U)))
+#define _mm_range_round_ss(A,B,C,R) ((__m128) __builtin_ia32_rangess128_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf) _mm_setzero_ps (), (__mmask8) -1, (R)))
+#define _mm_cvtt_roundsh_i32(A,B) ((int)__builtin_ia32_vcvttsh2si32_round ((A), (B)))
+#define _mm_mask3_fmsub_round_ss(A,B,C,U,R) (__m128) __builtin_ia32_vfmsubss3_mask3 (A, B, C, U, R)
+#define _SIZET_ 
+#define _mm512_i32scatter_pd(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv8df ((void *) (ADDR), (__mmask8)0xFF, (__v8si)(__m256i) (INDEX), (__v8df)(__m512d) (V1), (int) (SCALE))
+#define _mm_cvtt_roundss_u32(A,B) ((unsigned)__builtin_ia32_vcvttss2usi32(A, B))
+#define MAX(a,b) ({ __typeof__ (a) _a = (a); __typeof__ (b) _b = (b); _a > _b ? _a : _b; })
+#define _mm256_mask_shufflehi_epi16(W,U,A,B) ((__m256i) __builtin_ia32_pshufhw256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)(__m256i)(W), (__mmask16)(U)))
+#define _BITS_STDINT_INTN_H 1
+#define _MM_DENORMALS_ZERO_ON 0x0040
+#define __FLT64_MAX_EXP__ 1024
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define _mm512_mask_extractf64x2_pd(W,U,X,C) ((__m128d) __builtin_ia32_extractf64x2_512_mask ((__v8df)(__m512d) (X), (int) (C), (__v2df)(__m128d) (W), (__mmask8) (U)))
+#define _mm512_mask_srli_epi32(W,U,X,C) ((__m512i) __builtin_ia32_psrldi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define _mm_ror_epi32(A,B) ((__m128i)__builtin_ia32_prord128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)-1))
+#define _mm512_i64scatter_epi64(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8di ((void *) (ADDR), (__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (__v8di)(__m512i) (V1), (int) (SCALE))
+#define _mm256_shuffle_f32x4(X,Y,C) ((__m256) __builtin_ia32_shuf_f32x4_256_mask ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(C), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)-1))
+#define __USE_POSIX_IMPLICITLY 1
+#define __UINT64_TYPE__ long unsigned int
+#define _mm512_mask_srai_epi16(W,U,A,B) ((__m512i) __builtin_ia32_psrawi512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i)(W), (__mmask32)(U)))
+#define _mm512_maskz_fnmsub_round_pd(U,A,B,C,R) (__m512d)__builtin_ia32_vfnmsubpd512_maskz(A, B, C, U, R)
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+#define _mm256_ror_epi32(A,B) ((__m256i)__builtin_ia32_prord256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)-1))
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+#define _mm256_mask_cmp_epi64_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpq256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(P), (__mmask8)(M)))
+#define _mm512_maskz_fnmsub_round_ph(U,A,B,C,R) ((__m512h)__builtin_ia32_vfnmsubph512_maskz ((A), (B), (C), (U), (R)))
+#define _mm_maskz_fixupimm_pd(U,X,Y,Z,C) ((__m128d)__builtin_ia32_fixupimmpd128_maskz ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(U)))
+#define SCNiFAST8 "hhi"
+#define __PRI64_PREFIX "l"
+#define _mm512_i32scatter_ps(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv16sf ((void *) (ADDR), (__mmask16)0xFFFF, (__v16si)(__m512i) (INDEX), (__v16sf)(__m512) (V1), (int) (SCALE))
+#define _mm512_mask_srai_epi32(W,U,X,C) ((__m512i) __builtin_ia32_psradi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define _mm512_mask_srli_epi64(W,U,X,C) ((__m512i) __builtin_ia32_psrlqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define _mm_maskz_fixupimm_ps(U,X,Y,Z,C) ((__m128)__builtin_ia32_fixupimmps128_maskz ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(U)))
+#define __stub___compat_bdflush 
+#define _AVX512VP2INTERSECTVLINTRIN_H_INCLUDED 
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+#define __FLT128_HAS_QUIET_NAN__ 1
+#define _mm512_fmaddsub_round_pd(A,B,C,R) (__m512d)__builtin_ia32_vfmaddsubpd512_mask(A, B, C, -1, R)
+#define _mm_mask_range_sd(W,U,A,B,C) ((__m128d) __builtin_ia32_rangesd128_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)(__m128d)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_shuffle_i64x2(X,Y,C) ((__m512i) __builtin_ia32_shuf_i64x2_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(C), (__v8di)(__m512i)_mm512_undefined_epi32 (), (__mmask8)-1))
+#define _mm512_fmaddsub_round_ps(A,B,C,R) (__m512)__builtin_ia32_vfmaddsubps512_mask(A, B, C, -1, R)
+#define _mm256_maskz_shuffle_pd(U,A,B,C) ((__m256d)__builtin_ia32_shufpd256_mask ((__v4df)(__m256d)(A), (__v4df)(__m256d)(B), (int)(C), (__v4df)(__m256d) _mm256_setzero_pd (), (__mmask8)(U)))
+#define SCNdFAST16 __PRIPTR_PREFIX "d"
+#define _mm256_maskz_shuffle_ps(U,A,B,C) ((__m256) __builtin_ia32_shufps256_mask ((__v8sf)(__m256)(A), (__v8sf)(__m256)(B), (int)(C), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)(U)))
+#define _AVX512VLDQINTRIN_H_INCLUDED 
+#define _IOLBF 1
+#define PRIiMAX __PRI64_PREFIX "i"
+#define _mm512_maskz_alignr_epi8(U,X,Y,N) ((__m512i) __builtin_ia32_palignr512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)((N) * 8), (__v8di)(__m512i) _mm512_setzero_si512 (), (__mmask64)(U)))
+#define _mm256_ror_epi64(A,B) ((__m256i)__builtin_ia32_prorq256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)-1))
+#define PRIoFAST64 __PRI64_PREFIX "o"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+#define _mm_maskz_fixupimm_sd(U,X,Y,Z,C) ((__m128d)__builtin_ia32_fixupimmsd_maskz ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_mask_srai_epi64(W,U,X,C) ((__m512i) __builtin_ia32_psraqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define _mm_maskz_fixupimm_ss(U,X,Y,Z,C) ((__m128)__builtin_ia32_fixupimmss_maskz ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm256_mask_i32gather_epi32(SRC,BASE,INDEX,MASK,SCALE) (__m256i) __builtin_ia32_gathersiv8si ((__v8si)(__m256i) (SRC), (int const *) (BASE), (__v8si)(__m256i) (INDEX), (__v8si)(__m256i) (MASK), (int) (SCALE))
+#define __GNUC_STDC_INLINE__ 1
+#define _mm256_maskz_shldi_epi32(A,B,C,D) ((__m256i) __builtin_ia32_vpshld_v8si_mask ((__v8si)(__m256i)(B), (__v8si)(__m256i)(C),(int)(D), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)(A)))
+#define _mm_cmp_ph_mask(A,B,C) (__builtin_ia32_cmpph128_mask ((A), (B), (C), (-1)))
+#define _mm256_mask_i32gather_ps(SRC,BASE,INDEX,MASK,SCALE) (__m256) __builtin_ia32_gathersiv8sf ((__v8sf)(__m256) (SRC), (float const *) (BASE), (__v8si)(__m256i) (INDEX), (__v8sf)(__m256) (MASK), (int) (SCALE))
+#define LSB16(a) ({ __typeof__ (a) _a = (a); _a & 0x0F; })
+#define _mm512_maskz_exp2a23_round_pd(U,A,C) __builtin_ia32_exp2pd_mask(A, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm_floor_ps(V) _mm_round_ps ((V), _MM_FROUND_FLOOR)
+#define __WORDSIZE_TIME64_COMPAT32 1
+#define _mm512_cmp_epu8_mask(X,Y,P) ((__mmask64) __builtin_ia32_ucmpb512_mask ((__v64qi)(__m512i)(X), (__v64qi)(__m512i)(Y), (int)(P), (__mmask64)(-1)))
+#define BIT_FLIP(p,m) ((p) ^= (m))
+#define _MM_EXCEPT_INVALID 0x0001
+#define _mm512_maskz_getmant_round_pd(U,X,B,C,R) ((__m512d)__builtin_ia32_getmantpd512_mask ((__v8df)(__m512d)(X), (int)(((C)<<2) | (B)), (__v8df)(__m512d)_mm512_setzero_pd(), (__mmask8)(U), (R)))
+#define _mm512_maskz_getmant_round_ps(U,X,B,C,R) ((__m512)__builtin_ia32_getmantps512_mask ((__v16sf)(__m512)(X), (int)(((C)<<2) | (B)), (__v16sf)(__m512)_mm512_setzero_ps(), (__mmask16)(U), (R)))
+#define __DBL_DECIMAL_DIG__ 17
+#define _POPCNTINTRIN_H_INCLUDED 
+#define __DEC_EVAL_METHOD__ 2
+#define _IO_ERR_SEEN 0x0020
+#define _MM_MASK_UNDERFLOW 0x0800
+#define _mm256_mask_i32gather_epi64(SRC,BASE,INDEX,MASK,SCALE) (__m256i) __builtin_ia32_gathersiv4di ((__v4di)(__m256i) (SRC), (long long const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4di)(__m256i) (MASK), (int) (SCALE))
+#define _AVX512BWINTRIN_H_INCLUDED 
+#define _mm256_i64gather_epi64(BASE,INDEX,SCALE) (__m256i) __builtin_ia32_gatherdiv4di ((__v4di) _mm256_setzero_si256 (), (long long const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4di)_mm256_set1_epi64x (-1), (int) (SCALE))
+#define _mm_srai_epi64(A,B) ((__m128i) __builtin_ia32_psraqi128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)_mm_setzero_si128 (), (__mmask8)-1))
+#define TIME_UTC 1
+#define _mm512_cvtt_roundph_epi32(A,B) ((__m512i) __builtin_ia32_vcvttph2dq512_mask_round ((A), (__v16si) (_mm512_setzero_si512 ()), (__mmask16)(-1), (B)))
+#define _mm_mask3_fmadd_round_sch(A,B,C,D,E) ((__m128h) __builtin_ia32_vfmaddcsh_mask3_round ((__v8hf) (A), (__v8hf) (B), (__v8hf) (C), (D), (E)))
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define UINT16_MAX (65535)
+#define _AVX512VBMIINTRIN_H_INCLUDED 
+#define __FLT128_MIN_10_EXP__ (-4931)
+#define _mm256_cmp_epi16_mask(X,Y,P) ((__mmask16) __builtin_ia32_cmpw256_mask ((__v16hi)(__m256i)(X), (__v16hi)(__m256i)(Y), (int)(P), (__mmask16)(-1)))
+#define _mm_rcp28_round_sd(A,B,R) __builtin_ia32_rcp28sd_round(A, B, R)
+#define _mm512_maskz_cvt_roundps_epu32(U,A,B) ((__m512i)__builtin_ia32_cvtps2udq512_mask(A, (__v16si)_mm512_setzero_si512 (), U, B))
+#define _mm_rcp28_round_ss(A,B,R) __builtin_ia32_rcp28ss_round(A, B, R)
+#define PRIdFAST16 __PRIPTR_PREFIX "d"
+#define _STRUCT_TIMESPEC 1
+#define __INTMAX_WIDTH__ 64
+#define _mm512_mask_extractf32x4_ps(W,U,X,C) ((__m128) __builtin_ia32_extractf32x4_mask ((__v16sf)(__m512) (X), (int) (C), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define _mm_mask_cvtps_ph(W,U,A,I) ((__m128i) __builtin_ia32_vcvtps2ph_mask ((__v4sf)(__m128) (A), (int) (I), (__v8hi)(__m128i) (W), (__mmask8) (U)))
+#define __mode_t_defined 
+#define _mm_bslli_si128(A,N) ((__m128i)__builtin_ia32_pslldqi128 ((__m128i)(A), (int)(N) * 8))
+#define __ORDER_BIG_ENDIAN__ 4321
+#define _mm512_maskz_cvtt_roundph_epi16(A,B,C) ((__m512i) __builtin_ia32_vcvttph2w512_mask_round ((B), (__v32hi) _mm512_setzero_si512 (), (A), (C)))
+#define INTPTR_MAX (9223372036854775807L)
+#define _MM3DNOW_H_INCLUDED 
+#define _mm512_cvtt_roundph_epi64(A,B) (__builtin_ia32_vcvttph2qq512_mask_round ((A), _mm512_setzero_si512 (), (__mmask8)-1, (B)))
+#define __UINT32_C(c) c ## U
+#define _mm_maskz_cvtsd_ss(U,A,B) _mm_maskz_cvt_roundsd_ss ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define PRIdFAST32 __PRIPTR_PREFIX "d"
+#define COMMPORT_TYPE_TOTAL 7
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define _MM_DENORMALS_ZERO_OFF 0x0000
+#define _mm512_mask_cvt_roundph_epu32(A,B,C,D) ((__m512i) __builtin_ia32_vcvtph2udq512_mask_round ((C), (__v16si)(A), (B), (D)))
+#define _mm512_insertf64x2(X,Y,C) ((__m512d) __builtin_ia32_insertf64x2_512_mask ((__v8df)(__m512d) (X), (__v2df)(__m128d) (Y), (int) (C), (__v8df)(__m512d) (X), (__mmask8)-1))
+#define _mm512_insertf64x4(X,Y,C) ((__m512d) __builtin_ia32_insertf64x4_mask ((__v8df)(__m512d) (X), (__v4df)(__m256d) (Y), (int) (C), (__v8df)(__m512d)_mm512_undefined_pd(), (__mmask8)-1))
+#define _mm512_mask_add_round_ps(W,U,A,B,C) (__m512)__builtin_ia32_addps512_mask(A, B, W, U, C)
+#define _BITS_TIME64_H 1
+#define ____FILE_defined 1
+#define _AVX512DQINTRIN_H_INCLUDED 
+#define __glibc_has_builtin(name) __has_builtin (name)
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+#define _mm_cvt_roundsd_u32(A,B) ((unsigned)__builtin_ia32_vcvtsd2usi32(A, B))
+#define _mm_roundscale_pd(A,B) ((__m128d) __builtin_ia32_rndscalepd_128_mask ((__v2df)(__m128d)(A), (int)(B), (__v2df)(__m128d)_mm_setzero_pd (), (__mmask8)-1))
+#define _mm_mask_cvt_roundps_ph(A,B,C,D) _mm_mask_cvtps_ph ((A), (B), (C), (D))
+#define COMMPORT_TYPE_TTY 4
+#define _mm_roundscale_ps(A,B) ((__m128) __builtin_ia32_rndscaleps_128_mask ((__v4sf)(__m128)(A), (int)(B), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)-1))
+#define _TBMINTRIN_H_INCLUDED 
+#define _mm512_mask_cvt_roundpd_ph(A,B,C,D) (__builtin_ia32_vcvtpd2ph512_mask_round ((__v8df)(C), (A), (B), (D)))
+#define _mm_cmp_epu16_mask(X,Y,P) ((__mmask8) __builtin_ia32_ucmpw128_mask ((__v8hi)(__m128i)(X), (__v8hi)(__m128i)(Y), (int)(P), (__mmask8)(-1)))
+#define _mm512_mask_cvt_roundpd_ps(W,U,A,B) (__m256)__builtin_ia32_cvtpd2ps512_mask(A, (__v8sf)(W), U, B)
+#define __INT8_MAX__ 0x7f
+#define _MM_ROUND_TOWARD_ZERO 0x6000
+#define __PIC__ 2
+#define PRIdFAST64 __PRI64_PREFIX "d"
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define _AVXINTRIN_H_INCLUDED 
+#define _mm256_maskz_reduce_pd(U,A,B) ((__m256d) __builtin_ia32_reducepd256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)_mm256_setzero_pd(), (__mmask8)(U)))
+#define _mm256_maskz_reduce_ph(A,B,C) (__builtin_ia32_reduceph256_mask ((B), (C), _mm256_setzero_ph (), (A)))
+#define _mm256_maskz_reduce_ps(U,A,B) ((__m256) __builtin_ia32_reduceps256_mask ((__v8sf)(__m256)(A), (int)(B), (__v8sf)_mm256_setzero_ps(), (__mmask8)(U)))
+#define _mm_maskz_alignr_epi8(U,X,Y,N) ((__m128i) __builtin_ia32_palignr128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)((N) * 8), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask16)(U)))
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+#define _mm512_i64gather_epi32(INDEX,ADDR,SCALE) (__m256i) __builtin_ia32_gatherdiv16si ((__v8si)_mm256_undefined_si256(), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8)0xFF, (int) (SCALE))
+#define _mm_cvt_roundsd_u64(A,B) ((unsigned long long)__builtin_ia32_vcvtsd2usi64(A, B))
+#define _mm512_cvtx_roundph_ps(A,B) (__builtin_ia32_vcvtph2psx512_mask_round ((A), _mm512_setzero_ps (), (__mmask16)-1, (B)))
+#define _mm_roundscale_sd(A,B,I) ((__m128d) __builtin_ia32_rndscalesd_mask_round ((__v2df) (__m128d) (A), (__v2df) (__m128d) (B), (int) (I), (__v2df) _mm_setzero_pd (), (__mmask8) (-1), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_undefined _mm512_undefined_ps
+#define _mm_roundscale_ss(A,B,I) ((__m128) __builtin_ia32_rndscaless_mask_round ((__v4sf) (__m128) (A), (__v4sf) (__m128) (B), (int) (I), (__v4sf) _mm_setzero_ps (), (__mmask8) (-1), _MM_FROUND_CUR_DIRECTION))
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+#define _mm512_mask_getexp_round_pd(W,U,A,R) ((__m512d)__builtin_ia32_getexppd512_mask((__v8df)(__m512d)(A), (__v8df)(__m512d)(W), (__mmask8)(U), R))
+#define _mm512_mask_getexp_round_ph(W,U,A,R) ((__m512h)__builtin_ia32_getexpph512_mask((__v32hf)(__m512h)(A), (__v32hf)(__m512h)(W), (__mmask32)(U), R))
+#define _mm256_maskz_getmant_pd(U,X,B,C) ((__m256d) __builtin_ia32_getmantpd256_mask ((__v4df)(__m256d) (X), (int)(((C)<<2) | (B)), (__v4df)(__m256d)_mm256_setzero_pd (), (__mmask8)(U)))
+#define _mm256_insert_epi8(X,D,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 4); __Y = _mm_insert_epi8 (__Y, (D), (N) % 16); _mm256_insertf128_si256 ((X), __Y, (N) >> 4); }))
+#define _mm512_mask_cvt_roundps_epi64(W,U,A,B) ((__m512i)__builtin_ia32_cvtps2qq512_mask ((A), (__v8di)(W), (U), (B)))
+#define ADC_CH 1
+#define __SSE2__ 1
+#define _mm512_cvtt_roundpd_epi32(A,B) ((__m256i)__builtin_ia32_cvttpd2dq512_mask(A, (__v8si)_mm256_undefined_si256(), -1, B))
+#define _MM_EXCEPT_OVERFLOW 0x0008
+#define _MM_FROUND_TRUNC (_MM_FROUND_TO_ZERO | _MM_FROUND_RAISE_EXC)
+#define _mm_getexp_sd(A,B) ((__m128d)__builtin_ia32_getexpsd128_round((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), _MM_FROUND_CUR_DIRECTION))
+#define __INT32_TYPE__ int
+#define _mm512_i64gather_epi64(INDEX,ADDR,SCALE) (__m512i) __builtin_ia32_gatherdiv8di ((__v8di)_mm512_undefined_epi32 (), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8)0xFF, (int) (SCALE))
+#define _mm_maskz_min_round_ss(U,A,B,C) (__m128)__builtin_ia32_minss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, C)
+#define _mm256_extractf128_si256(X,N) ((__m128i) __builtin_ia32_vextractf128_si256 ((__v8si)(__m256i)(X), (int)(N)))
+#define _mm512_mask_inserti64x2(W,U,X,Y,C) ((__m512i) __builtin_ia32_inserti64x2_512_mask ((__v8di)(__m512i) (X), (__v2di)(__m128i) (Y), (int) (C), (__v8di)(__m512i) (W), (__mmask8) (U)))
+#define _mm512_mask_inserti64x4(W,U,X,Y,C) ((__m512i) __builtin_ia32_inserti64x4_mask ((__v8di)(__m512i) (X), (__v4di)(__m256i) (Y), (int) (C), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define __SIZEOF_DOUBLE__ 8
+#define _mm256_extracti32x4_epi32(X,C) ((__m128i) __builtin_ia32_extracti32x4_256_mask ((__v8si)(__m256i) (X), (int) (C), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)-1))
+#define __FLT_MANT_DIG__ 24
+#define _mm_mask_rcp28_sd(W,U,A,B) _mm_mask_rcp28_round_sd ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define __SWORD_TYPE long int
+#define _mm_mask_rcp28_ss(W,U,A,B) _mm_mask_rcp28_round_ss ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm512_mask_i64scatter_epi64(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8di ((void *) (ADDR), (__mmask8) (MASK), (__v8di)(__m512i) (INDEX), (__v8di)(__m512i) (V1), (int) (SCALE))
+#define _mm512_maskz_exp2a23_pd(U,A) _mm512_maskz_exp2a23_round_pd(U, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm512_maskz_exp2a23_ps(U,A) _mm512_maskz_exp2a23_round_ps(U, A, _MM_FROUND_CUR_DIRECTION)
+#define PIN_MODE_SPI 9
+#define _mm512_cvtt_roundpd_epi64(A,B) ((__m512i)__builtin_ia32_cvttpd2qq512_mask ((A), (__v8di) _mm512_setzero_si512 (), -1, (B)))
+#define _mm512_mask_shuffle_f32x4(W,U,X,Y,C) ((__m512) __builtin_ia32_shuf_f32x4_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(C), (__v16sf)(__m512)(W), (__mmask16)(U)))
+#define SEEK_CUR 1
+#define _T_SIZE 
+#define UINT8_C(c) c
+#define _tile_zero(dst) _tile_zero_internal (dst)
+#define __INT16_C(c) c
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define _mm512_cvt_roundps_pd(A,B) (__m512d)__builtin_ia32_cvtps2pd512_mask(A, (__v8df)_mm512_undefined_pd(), -1, B)
+#define _mm512_maskz_ror_epi32(U,A,B) ((__m512i)__builtin_ia32_prord512_mask ((__v16si)(__m512i)(A), (int)(B), (__v16si)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _mm512_maskz_cvtt_roundpd_epi32(U,A,B) ((__m256i)__builtin_ia32_cvttpd2dq512_mask(A, (__v8si)_mm256_setzero_si256(), U, B))
+#define __INT_FAST16_WIDTH__ 64
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+#define _mm_mask_cmp_epi32_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpd128_mask ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(P), (__mmask8)(M)))
+#define _mm_maskz_scalef_ss(U,A,B) _mm_maskz_scalef_round_ss ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _RWLOCK_INTERNAL_H 
+#define __DBL_MAX_10_EXP__ 308
+#define _mm256_blend_pd(X,Y,M) ((__m256d) __builtin_ia32_blendpd256 ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(M)))
+#define PIN_MODE_1WIRE 6
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+#define _mm256_blend_ps(X,Y,M) ((__m256) __builtin_ia32_blendps256 ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(M)))
+#define _mm512_maskz_ror_epi64(U,A,B) ((__m512i)__builtin_ia32_prorq512_mask ((__v8di)(__m512i)(A), (int)(B), (__v8di)_mm512_setzero_si512 (), (__mmask8)(U)))
+#define _mm512_maskz_cvtt_roundpd_epi64(U,A,B) ((__m512i)__builtin_ia32_cvttpd2qq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define _mm512_mask_i32gather_epi32(V1OLD,MASK,INDEX,ADDR,SCALE) (__m512i) __builtin_ia32_gathersiv16si ((__v16si)(__m512i) (V1OLD), (void const *) (ADDR), (__v16si)(__m512i) (INDEX), (__mmask16) (MASK), (int) (SCALE))
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define _mm512_extractf64x4_pd(X,C) ((__m256d) __builtin_ia32_extractf64x4_mask ((__v8df)(__m512d) (X), (int) (C), (__v4df)(__m256d)_mm256_undefined_pd(), (__mmask8)-1))
+#define _mm256_dp_ps(X,Y,M) ((__m256) __builtin_ia32_dpps256 ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(M)))
+#define _GFNIINTRIN_H_INCLUDED 
+#define _mm_min_round_sh(A,B,C) (__builtin_ia32_minsh_mask_round ((A), (B), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define _kor_mask16 _mm512_kor
+#define _CMP_ORD_Q 0x07
+#define _CMP_ORD_S 0x17
+#define _mm512_mask_fmsub_round_ps(A,U,B,C,R) (__m512)__builtin_ia32_vfmsubps512_mask(A, B, C, U, R)
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+#define _tile_loadd_internal(dst,base,stride) __asm__ volatile ("{tileloadd\t(%0,%1,1), %%tmm"#dst"|tileloadd\t%%tmm"#dst", [%0+%1*1]}" :: "r" ((const void*) (base)), "r" ((long) (stride)))
+#define _mm512_mask_i32gather_epi64(V1OLD,MASK,INDEX,ADDR,SCALE) (__m512i) __builtin_ia32_gathersiv8di ((__v8di)(__m512i) (V1OLD), (void const *) (ADDR), (__v8si)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm512_cvtps_ph(A,I) ((__m256i) __builtin_ia32_vcvtps2ph512_mask ((__v16sf)(__m512) (A), (int) (I), (__v16hi)_mm256_undefined_si256 (), -1))
+#define _mm_blend_epi16(X,Y,M) ((__m128i) __builtin_ia32_pblendw128 ((__v8hi)(__m128i)(X), (__v8hi)(__m128i)(Y), (int)(M)))
+#define _mm256_maskz_fixupimm_pd(U,X,Y,Z,C) ((__m256d)__builtin_ia32_fixupimmpd256_maskz ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (__v4di)(__m256i)(Z), (int)(C), (__mmask8)(U)))
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define _BITS_FLOATN_H 
+#define _mm512_mask_prefetch_i32scatter_ps(ADDR,MASK,INDEX,SCALE,HINT) __builtin_ia32_scatterpfdps ((__mmask16) (MASK), (__v16si)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm512_maskz_reduce_round_ps(U,A,B,R) ((__m512) __builtin_ia32_reduceps512_mask_round ((__v16sf)(__m512)(A), (int)(B), (__v16sf)_mm512_setzero_ps (), (__mmask16)(U), (R)))
+#define _CLWBINTRIN_H_INCLUDED 
+#define __UINTPTR_TYPE__ long unsigned int
+#define _mm512_maskz_min_round_ph(A,B,C,D) (__builtin_ia32_minph512_mask_round ((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define _mm_maskz_mul_sch(U,A,B) _mm_maskz_fmul_sch ((U), (A), (B))
+#define __DEC128_MANT_DIG__ 34
+#define _mm512_maskz_min_round_ps(U,A,B,R) (__m512)__builtin_ia32_minps512_mask(A, B, (__v16sf)_mm512_setzero_ps(), U, R)
+#define _mm512_cmp_epi32_mask(X,Y,P) ((__mmask16) __builtin_ia32_cmpd512_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(P), (__mmask16)-1))
+#define _MM_DENORMALS_ZERO_MASK 0x0040
+#define SCNoLEAST64 __PRI64_PREFIX "o"
+#define SCNxLEAST16 "hx"
+#define _mm512_mask_getexp_pd(W,U,A) ((__m512d)__builtin_ia32_getexppd512_mask((__v8df)(__m512d)(A), (__v8df)(__m512d)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_mask_getexp_ps(W,U,A) ((__m512)__builtin_ia32_getexpps512_mask((__v16sf)(__m512)(A), (__v16sf)(__m512)(W), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define _kxor_mask16 _mm512_kxor
+#define _SIDD_POSITIVE_POLARITY 0x00
+#define _mm256_mask_fpclass_ps_mask(u,X,C) ((__mmask8) __builtin_ia32_fpclassps256_mask ((__v8sf) (__m256) (X), (int) (C),(__mmask8)(u)))
+#define PRIo16 "o"
+#define __USE_ATFILE 1
+#define SYSTEM_RESET_HALT 2
+#define _mm_scalef_round_sd(A,B,C) ((__m128d) __builtin_ia32_scalefsd_mask_round ((A), (B), (__v2df) _mm_undefined_pd (), -1, (C)))
+#define _mm512_cmp_epi8_mask(X,Y,P) ((__mmask64) __builtin_ia32_cmpb512_mask ((__v64qi)(__m512i)(X), (__v64qi)(__m512i)(Y), (int)(P), (__mmask64)(-1)))
+#define _mm_scalef_round_ss(A,B,C) ((__m128) __builtin_ia32_scalefss_mask_round ((A), (B), (__v4sf) _mm_undefined_ps (), -1, (C)))
+#define __FLT128_DECIMAL_DIG__ 36
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define _mm_cvtt_roundss_i32(A,B) ((int)__builtin_ia32_vcvttss2si32(A, B))
+#define PTRDIFF_MAX (9223372036854775807L)
+#define SCNdFAST32 __PRIPTR_PREFIX "d"
+#define __FLT_DECIMAL_DIG__ 9
+#define PRIo32 "o"
+#define _mm512_mask3_fmsub_round_pd(A,B,C,U,R) (__m512d)__builtin_ia32_vfmsubpd512_mask3(A, B, C, U, R)
+#define __WALL 0x40000000
+#define _mm512_mask3_fmsub_round_ps(A,B,C,U,R) (__m512)__builtin_ia32_vfmsubps512_mask3(A, B, C, U, R)
+#define _mm512_rcp28_pd(A) _mm512_rcp28_round_pd(A, _MM_FROUND_CUR_DIRECTION)
+#define UTILITY_PULSETHREAD_LINUX_H 
+#define PRIoMAX __PRI64_PREFIX "o"
+#define __FLT_MIN_10_EXP__ (-37)
+#define _mm_shldi_epi16(A,B,C) ((__m128i) __builtin_ia32_vpshld_v8hi ((__v8hi)(__m128i)(A), (__v8hi)(__m128i)(B),(int)(C)))
+#define _mm512_maskz_shufflelo_epi16(U,A,B) ((__m512i) __builtin_ia32_pshuflw512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i) _mm512_setzero_si512 (), (__mmask32)(U)))
+#define _mm_i32scatter_pd(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv2df ((void *) (ADDR), (__mmask8)0xFF, (__v4si)(__m128i) (INDEX), (__v2df)(__m128d) (V1), (int) (SCALE))
+#define _mm_i32scatter_ps(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv4sf ((void *) (ADDR), (__mmask8)0xFF, (__v4si)(__m128i) (INDEX), (__v4sf)(__m128) (V1), (int) (SCALE))
+#define INT_LEAST16_MAX (32767)
+#define _mm256_i32gather_epi64(BASE,INDEX,SCALE) (__m256i) __builtin_ia32_gathersiv4di ((__v4di) _mm256_setzero_si256 (), (long long const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4di)_mm256_set1_epi64x (-1), (int) (SCALE))
+#define PRIoLEAST8 "o"
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+#define SCNuLEAST32 "u"
+#define _UINTRNTRIN_H_INCLUDED 
+#define _mm_cvtt_roundss_i64(A,B) ((long long)__builtin_ia32_vcvttss2si64(A, B))
+#define _mm_add_round_sd(A,B,C) (__m128d)__builtin_ia32_addsd_round(A, B, C)
+#define PRIo64 __PRI64_PREFIX "o"
+#define _mm_dbsad_epu8(X,Y,C) ((__m128i) __builtin_ia32_dbpsadbw128_mask ((__v16qi)(__m128i) (X), (__v16qi)(__m128i) (Y), (int) (C), (__v8hi)(__m128i)_mm_setzero_si128(), (__mmask8)-1))
+#define PRIXFAST16 __PRIPTR_PREFIX "X"
+#define _mm512_cvt_roundph_pd(A,B) (__builtin_ia32_vcvtph2pd512_mask_round ((A), _mm512_setzero_pd (), (__mmask8)-1, (B)))
+#define __ATOMIC_ACQ_REL 4
+#define _mm512_cvt_roundph_ps(A,B) (__m512)__builtin_ia32_vcvtph2ps512_mask((__v16hi)(A), (__v16sf)_mm512_undefined_ps(), -1, B)
+#define __U32_TYPE unsigned int
+#define __FIRMWARE_MCU_BOGUS__ 1
+#define _mm512_cvt_roundepu32_ps(A,B) (__m512)__builtin_ia32_cvtudq2ps512_mask((__v16si)(A), (__v16sf)_mm512_undefined_ps(), -1, B)
+#define _mm256_maskz_shrdi_epi32(A,B,C,D) ((__m256i) __builtin_ia32_vpshrd_v8si_mask ((__v8si)(__m256i)(B), (__v8si)(__m256i)(C),(int)(D), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)(A)))
+#define _STDLIB_H 1
+#define _mm512_mask_fpclass_ph_mask(u,x,c) ((__mmask32) __builtin_ia32_fpclassph512_mask ((__v32hf) (__m512h) (x), (int) (c),(__mmask8)(u)))
+#define _BITS_FLOATN_COMMON_H 
+#define _mm_mul_round_sch(A,B,R) _mm_fmul_round_sch ((A), (B), (R))
+#define _mm512_maskz_insertf32x4(A,X,Y,C) ((__m512) __builtin_ia32_insertf32x4_mask ((__v16sf)(__m512) (X), (__v4sf)(__m128) (Y), (int) (C), (__v16sf)_mm512_setzero_ps(), (__mmask16)(A)))
+#define PRIXFAST32 __PRIPTR_PREFIX "X"
+#define _mm512_maskz_insertf32x8(U,X,Y,C) ((__m512) __builtin_ia32_insertf32x8_mask ((__v16sf)(__m512) (X), (__v8sf)(__m256) (Y), (int) (C), (__v16sf)(__m512)_mm512_setzero_ps (), (__mmask16)(U)))
+#define __FLT32X_MAX_EXP__ 1024
+#define _mm_shldi_epi64(A,B,C) ((__m128i) __builtin_ia32_vpshld_v2di ((__v2di)(__m128i)(A), (__v2di)(__m128i)(B),(int)(C)))
+#define _mm512_maskz_fnmadd_round_ph(U,A,B,C,R) ((__m512h)__builtin_ia32_vfnmaddph512_maskz ((A), (B), (C), (U), (R)))
+#define _mm512_maskz_fnmadd_round_ps(U,A,B,C,R) (__m512)__builtin_ia32_vfnmaddps512_maskz(A, B, C, U, R)
+#define __ATOMIC_ACQUIRE 2
+#define COMMPORT_ERROR_NO 0
+#define PRIXFAST64 __PRI64_PREFIX "X"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+#define __GCC_IEC_559_COMPLEX 2
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+#define __UINT_LEAST8_TYPE__ unsigned char
+#define __SIZEOF_FLOAT80__ 16
+#define _mm_maskz_cmul_sch(U,A,B) _mm_maskz_fcmul_sch ((U), (A), (B))
+#define _X86GPRINTRIN_H_INCLUDED 
+#define INT_LEAST16_MIN (-32767-1)
+#define _SYS_CDEFS_H 1
+#define __flexarr []
+#define _mm512_maskz_extracti64x2_epi64(U,X,C) ((__m128i) __builtin_ia32_extracti64x2_512_mask ((__v8di)(__m512i) (X), (int) (C), (__v2di)(__m128i) _mm_setzero_si128 (), (__mmask8) (U)))
+#define _mm_mask_shldi_epi32(A,B,C,D,E) ((__m128i) __builtin_ia32_vpshld_v4si_mask ((__v4si)(__m128i)(C), (__v4si)(__m128i)(D), (int)(E), (__v4si)(__m128i)(A), (__mmask8)(B)))
+#define _mm_cvt_roundsi64_ss(A,B,C) (__m128)__builtin_ia32_cvtsi2ss64(A, B, C)
+#define _SIDD_MASKED_POSITIVE_POLARITY 0x20
+#define _MM_FROUND_TO_NEG_INF 0x01
+#define _MM_MASK_MASK 0x1f80
+#define _mm_cvt_roundu32_sh(A,B,C) (__builtin_ia32_vcvtusi2sh32_round ((A), (B), (C)))
+#define _mm256_mask_shufflelo_epi16(W,U,A,B) ((__m256i) __builtin_ia32_pshuflw256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)(__m256i)(W), (__mmask16)(U)))
+#define __stub_fchflags 
+#define __INTMAX_C(c) c ## L
+#define _mm_sqrt_round_sh(A,B,C) (__builtin_ia32_sqrtsh_mask_round ((B), (A), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define _mm_sqrt_round_ss(A,B,C) (__m128)__builtin_ia32_sqrtss_mask_round (B, A, (__v4sf) _mm_setzero_ps (), -1, C)
+#define _BITS_TIME_H 1
+#define _mm512_mask_reduce_round_ph(A,B,C,D,E) (__builtin_ia32_reduceph512_mask_round ((C), (D), (A), (B), (E)))
+#define _mm512_roundscale_pd(A,B) ((__m512d) __builtin_ia32_rndscalepd_mask ((__v8df)(__m512d)(A), (int)(B), (__v8df)_mm512_undefined_pd(), (__mmask8)(-1), _MM_FROUND_CUR_DIRECTION))
+#define _IO_EOF_SEEN 0x0010
+#define __FLT64X_MIN_10_EXP__ (-4931)
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+#define __WCHAR_MAX__ 0x7fffffff
+#define _mm_maskz_roundscale_sd(U,A,B,I) ((__m128d) __builtin_ia32_rndscalesd_mask_round ((__v2df) (__m128d) (A), (__v2df) (__m128d) (B), (int) (I), (__v2df) _mm_setzero_pd (), (__mmask8) (U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_reduce_round_pd(A,B,R) ((__m512d) __builtin_ia32_reducepd512_mask_round ((__v8df)(__m512d)(A), (int)(B), (__v8df)_mm512_setzero_pd (), (__mmask8)-1, (R)))
+#define _mm512_maskz_cvt_roundpd_ps(U,A,B) (__m256)__builtin_ia32_cvtpd2ps512_mask(A, (__v8sf)_mm256_setzero_ps(), U, B)
+#define _mm512_mask_cvt_roundps_epi32(W,U,A,B) ((__m512i)__builtin_ia32_cvtps2dq512_mask(A, (__v16si)(W), U, B))
+#define _mm512_reduce_round_ps(A,B,R) ((__m512) __builtin_ia32_reduceps512_mask_round ((__v16sf)(__m512)(A), (int)(B), (__v16sf)_mm512_setzero_ps (), (__mmask16)-1, (R)))
+#define __UINT8_MAX__ 0xff
+#define _mm_cvt_roundu32_ss(A,B,C) (__m128)__builtin_ia32_cvtusi2ss32(A, B, C)
+#define _mm_maskz_gf2p8affine_epi64_epi8(A,B,C,D) ((__m128i) __builtin_ia32_vgf2p8affineqb_v16qi_mask((__v16qi)(__m128i)(B), (__v16qi)(__m128i)(C), (int)(D), (__v16qi)(__m128i) _mm_setzero_si128 (), (__mmask16)(A)))
+#define _mm_maskz_shufflehi_epi16(U,A,B) ((__m128i) __builtin_ia32_pshufhw128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm512_maskz_cvt_roundepu16_ph(A,B,C) (__builtin_ia32_vcvtuw2ph512_mask_round ((__v32hi)(B), _mm512_setzero_ph (), (A), (C)))
+#define _mm_mask3_fnmsub_round_sd(A,B,C,U,R) (__m128d) __builtin_ia32_vfmsubsd3_mask3 (A, -(B), C, U, R)
+#define _mm_maskz_roundscale_sh(A,B,C,D) (__builtin_ia32_rndscalesh_mask_round ((B), (C), (D), _mm_setzero_ph (), (A), _MM_FROUND_CUR_DIRECTION))
+#define _mm_mask3_fnmsub_round_ss(A,B,C,U,R) (__m128) __builtin_ia32_vfmsubss3_mask3 (A, -(B), C, U, R)
+#define _mm_maskz_getexp_round_sh(U,A,B,C) (__m128h)__builtin_ia32_getexpsh_mask_round(A, B, (__v8hf)_mm_setzero_ph(), U, C)
+#define _mm512_mask_permute_pd(W,U,X,C) ((__m512d) __builtin_ia32_vpermilpd512_mask ((__v8df)(__m512d)(X), (int)(C), (__v8df)(__m512d)(W), (__mmask8)(U)))
+#define _mm512_fixupimm_pd(X,Y,Z,C) ((__m512d)__builtin_ia32_fixupimmpd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (__v8di)(__m512i)(Z), (int)(C), (__mmask8)(-1), _MM_FROUND_CUR_DIRECTION))
+#define INT16_C(c) c
+#define __USER_LABEL_PREFIX__ 
+#define _mm_maskz_getexp_round_ss(U,A,B,C) (__m128)__builtin_ia32_getexpss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, C)
+#define __WINT_MAX__ 0xffffffffU
+#define _mm512_mask_permute_ps(W,U,X,C) ((__m512) __builtin_ia32_vpermilps512_mask ((__v16sf)(__m512)(X), (int)(C), (__v16sf)(__m512)(W), (__mmask16)(U)))
+#define PIN_MODE_SHIFT 11
+#define _mm512_mask_cvtps_ph(U,W,A,I) ((__m256i) __builtin_ia32_vcvtps2ph512_mask ((__v16sf)(__m512) (A), (int) (I), (__v16hi)(__m256i)(U), (__mmask16) (W)))
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define _mm256_round_ps(V,M) ((__m256) __builtin_ia32_roundps256 ((__v8sf)(__m256)(V), (int)(M)))
+#define __FLT32_MIN_EXP__ (-125)
+#define _mm512_inserti32x4(X,Y,C) ((__m512i) __builtin_ia32_inserti32x4_mask ((__v16si)(__m512i) (X), (__v4si)(__m128i) (Y), (int) (C), (__v16si)(__m512i) (X), (__mmask16)(-1)))
+#define _mm512_inserti32x8(X,Y,C) ((__m512i) __builtin_ia32_inserti32x8_mask ((__v16si)(__m512i) (X), (__v8si)(__m256i) (Y), (int) (C), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)-1))
+#define _mm512_setr_pd(e0,e1,e2,e3,e4,e5,e6,e7) _mm512_set_pd(e7,e6,e5,e4,e3,e2,e1,e0)
+#define _mm512_setr_ps(e0,e1,e2,e3,e4,e5,e6,e7,e8,e9,e10,e11,e12,e13,e14,e15) _mm512_set_ps(e15,e14,e13,e12,e11,e10,e9,e8,e7,e6,e5,e4,e3,e2,e1,e0)
+#define INT8_MAX (127)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+#define _mm_mask_shldi_epi16(A,B,C,D,E) ((__m128i) __builtin_ia32_vpshld_v8hi_mask ((__v8hi)(__m128i)(C), (__v8hi)(__m128i)(D), (int)(E), (__v8hi)(__m128i)(A), (__mmask8)(B)))
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+#define _XABORT_RETRY (1 << 1)
+#define __OFF_T_MATCHES_OFF64_T 1
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+#define _MWAITINTRIN_H_INCLUDED 
+#define PRIdMAX __PRI64_PREFIX "d"
+#define _mm512_roundscale_ph(A,B) (__builtin_ia32_rndscaleph512_mask_round ((A), (B), _mm512_setzero_ph (), (__mmask32)-1, _MM_FROUND_CUR_DIRECTION))
+#define _mm512_shuffle_f64x2(X,Y,C) ((__m512d) __builtin_ia32_shuf_f64x2_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(C), (__v8df)(__m512d)_mm512_undefined_pd(), (__mmask8)-1))
+#define _mm512_maskz_slli_epi16(U,X,C) ((__m512i)__builtin_ia32_psllwi512_mask ((__v32hi)(__m512i)(X), (int)(C), (__v32hi)(__m512i)_mm512_setzero_si512 (), (__mmask32)(U)))
+#define _mm512_roundscale_ps(A,B) ((__m512) __builtin_ia32_rndscaleps_mask ((__v16sf)(__m512)(A), (int)(B), (__v16sf)_mm512_undefined_ps(), (__mmask16)(-1), _MM_FROUND_CUR_DIRECTION))
+#define _mm_maskz_slli_epi16(U,X,C) ((__m128i)__builtin_ia32_psllwi128_mask ((__v8hi)(__m128i)(X), (int)(C), (__v8hi)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define INT16_MAX (32767)
+#define __INT_LEAST16_WIDTH__ 16
+#define __STDC__ 1
+#define _mm_permute_pd(X,C) ((__m128d) __builtin_ia32_vpermilpd ((__v2df)(__m128d)(X), (int)(C)))
+#define WIFEXITED(status) __WIFEXITED (status)
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+#define _mm_permute_ps(X,C) ((__m128) __builtin_ia32_vpermilps ((__v4sf)(__m128)(X), (int)(C)))
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+#define __GCC_IEC_559 2
+#define _mm_comi_round_ss(A,B,C,D) __builtin_ia32_vcomiss(A, B, C, D)
+#define __USE_ISOC11 1
+#define _IOFBF 0
+#define _mm512_maskz_slli_epi32(U,X,C) ((__m512i) __builtin_ia32_pslldi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _mm256_mask_i64scatter_pd(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4df ((void *) (ADDR), (__mmask8) (MASK), (__v4di)(__m256i) (INDEX), (__v4df)(__m256d) (V1), (int) (SCALE))
+#define _mm_maskz_slli_epi32(U,X,C) ((__m128i)__builtin_ia32_pslldi128_mask ((__v4si)(__m128i)(X), (int)(C), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm512_mask_fpclass_ps_mask(u,x,c) ((__mmask16) __builtin_ia32_fpclassps512_mask ((__v16sf) (__m512) (x), (int) (c),(__mmask16)(u)))
+#define __FLT_EVAL_METHOD__ 0
+#define _mm256_mask_i64scatter_ps(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8sf ((void *) (ADDR), (__mmask8) (MASK), (__v4di)(__m256i) (INDEX), (__v4sf)(__m128) (V1), (int) (SCALE))
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+#define SCNiPTR __PRIPTR_PREFIX "i"
+#define __FLT64_DECIMAL_DIG__ 17
+#define _mm_cvtt_roundsh_u32(A,B) ((int)__builtin_ia32_vcvttsh2usi32_round ((A), (B)))
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+#define _mm512_mask_rcp28_ps(W,U,A) _mm512_mask_rcp28_round_ps(W, U, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm_cmp_pd(X,Y,P) ((__m128d) __builtin_ia32_cmppd ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P)))
+#define _mm512_mask_cvt_roundepi64_ps(W,U,A,B) ((__m256)__builtin_ia32_cvtqq2ps512_mask ((__v8di)(A), (W), (U), (B)))
+#define _mm_cmp_ps(X,Y,P) ((__m128) __builtin_ia32_cmpps ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P)))
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+#define _mm_mask_getmant_sh(W,U,X,Y,C,D) ((__m128h)__builtin_ia32_getmantsh_mask_round ((__v8hf)(__m128h)(X), (__v8hf)(__m128h)(Y), (int)(((D)<<2) | (C)), (__v8hf)(__m128h)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define COMMPORT_ERROR_BUFOVF 4
+#define _mm_slli_si128(A,N) ((__m128i)__builtin_ia32_pslldqi128 ((__m128i)(A), (int)(N) * 8))
+#define _MM_FLUSH_ZERO_OFF 0x0000
+#define INT8_MIN (-128)
+#define GPIO_MASK(pin) _BV((pin) & 0xf)
+#define _mm512_prefetch_i64scatter_pd(ADDR,INDEX,SCALE,HINT) __builtin_ia32_scatterpfqpd ((__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm512_prefetch_i64scatter_ps(ADDR,INDEX,SCALE,HINT) __builtin_ia32_scatterpfqps ((__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm512_getexp_pd(A) ((__m512d)__builtin_ia32_getexppd512_mask((__v8df)(__m512d)(A), (__v8df)_mm512_undefined_pd(), (__mmask8)-1, _MM_FROUND_CUR_DIRECTION))
+#define _mm512_shrdi_epi32(A,B,C) ((__m512i) __builtin_ia32_vpshrd_v16si ((__v16si)(__m512i)(A), (__v16si)(__m512i)(B),(int)(C)))
+#define TIMER16 1
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+#define _mm_cmp_epi16_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpw128_mask ((__v8hi)(__m128i)(X), (__v8hi)(__m128i)(Y), (int)(P), (__mmask8)(-1)))
+#define _mm_cmp_sd(X,Y,P) ((__m128d) __builtin_ia32_cmpsd ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P)))
+#define _mm_cmp_ss(X,Y,P) ((__m128) __builtin_ia32_cmpss ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P)))
+#define __COMPAR_FN_T 
+#define __GID_T_TYPE __U32_TYPE
+#define UINT64_C(c) c ## UL
+#define __STATFS_MATCHES_STATFS64 1
+#define INT16_MIN (-32767-1)
+#define TIMER32 1
+#define __FINITE_MATH_ONLY__ 0
+#define __id_t_defined 
+#define _mm_mask_scalef_round_ss(W,U,A,B,C) ((__m128) __builtin_ia32_scalefss_mask_round ((A), (B), (W), (U), (C)))
+#define _CMP_NGT_UQ 0x1a
+#define _CMP_NGT_US 0x0a
+#define _mm_roundscale_round_sd(A,B,I,R) ((__m128d) __builtin_ia32_rndscalesd_mask_round ((__v2df) (__m128d) (A), (__v2df) (__m128d) (B), (int) (I), (__v2df) _mm_setzero_pd (), (__mmask8) (-1), (int) (R)))
+#define _mm512_maskz_gf2p8affineinv_epi64_epi8(A,B,C,D) ((__m512i) __builtin_ia32_vgf2p8affineinvqb_v64qi_mask( (__v64qi)(__m512i)(B), (__v64qi)(__m512i)(C), (int)(D), (__v64qi)(__m512i) _mm512_setzero_si512 (), (__mmask64)(A)))
+#define PRIxPTR __PRIPTR_PREFIX "x"
+#define _TSXLDTRKINTRIN_H_INCLUDED 
+#define __pid_t_defined 
+#define _mm512_alignr_epi8(X,Y,N) ((__m512i) __builtin_ia32_palignr512 ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)((N) * 8)))
+#define _mm512_mask_cvt_roundph_epu64(A,B,C,D) (__builtin_ia32_vcvtph2uqq512_mask_round ((C), (A), (B), (D)))
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+#define _THREAD_MUTEX_INTERNAL_H 1
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __size_t 
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+#define _mm_roundscale_ph(A,B) (__builtin_ia32_rndscaleph128_mask ((A), (B), _mm_setzero_ph (), ((__mmask8)-1)))
+#define _mm512_cvt_roundepu16_ph(A,B) (__builtin_ia32_vcvtuw2ph512_mask_round ((__v32hi)(A), _mm512_setzero_ph (), (__mmask32)-1, (B)))
+#define INT_FAST8_MAX (127)
+#define __DEC64_MAX_EXP__ 385
+#define _MM_MASK_DIV_ZERO 0x0200
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __INT8_C(c) c
+#define WCHAR_MAX __WCHAR_MAX
+#define L_tmpnam 20
+#define _m_pshufw(A,N) _mm_shuffle_pi16 (A, N)
+#define _mm_roundscale_round_ss(A,B,I,R) ((__m128) __builtin_ia32_rndscaless_mask_round ((__v4sf) (__m128) (A), (__v4sf) (__m128) (B), (int) (I), (__v4sf) _mm_setzero_ps (), (__mmask8) (-1), (int) (R)))
+#define _mm512_mul_pch(A,B) _mm512_fmul_pch ((A), (B))
+#define __FLT64_MANT_DIG__ 53
+#define _mm256_maskz_shldi_epi64(A,B,C,D) ((__m256i) __builtin_ia32_vpshld_v4di_mask ((__v4di)(__m256i)(B), (__v4di)(__m256i)(C),(int)(D), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(A)))
+#define CLOCKS_PER_SEC ((__clock_t) 1000000)
+#define htobe16(x) __bswap_16 (x)
+#define _mm512_mask_shufflelo_epi16(W,U,A,B) ((__m512i) __builtin_ia32_pshuflw512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)(__m512i)(W), (__mmask32)(U)))
+#define __SHRT_MAX__ 0x7fff
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define _mm256_maskz_rol_epi32(U,A,B) ((__m256i)__builtin_ia32_prold256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define _mm512_maskz_cvtt_roundph_epu32(A,B,C) ((__m512i) __builtin_ia32_vcvttph2udq512_mask_round ((B), (__v16si) _mm512_setzero_si512 (), (A), (C)))
+#define __FLT64X_MAX_10_EXP__ 4932
+#define CEIL127(a) ({ __typeof__ (a) _a = (a); _a < 127 ? _a : 127; })
+#define _mm512_mask_i64scatter_epi32(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv16si ((void *) (ADDR), (__mmask8) (MASK), (__v8di)(__m512i) (INDEX), (__v8si)(__m256i) (V1), (int) (SCALE))
+#define __attribute_const__ __attribute__ ((__const__))
+#define _mm_mask_shuffle_epi32(W,U,X,C) ((__m128i) __builtin_ia32_pshufd128_mask ((__v4si)(__m128i)(X), (int)(C), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define __clockid_t_defined 1
+#define __daddr_t_defined 
+#define _mm256_dbsad_epu8(X,Y,C) ((__m256i) __builtin_ia32_dbpsadbw256_mask ((__v32qi)(__m256i) (X), (__v32qi)(__m256i) (Y), (int) (C), (__v16hi)(__m256i)_mm256_setzero_si256(), (__mmask16)-1))
+#define __LDBL_IS_IEC_60559__ 2
+#define _mm512_ternarylogic_epi64(A,B,C,I) ((__m512i) __builtin_ia32_pternlogq512_mask ((__v8di) (__m512i) (A), (__v8di) (__m512i) (B), (__v8di) (__m512i) (C), (unsigned char) (I), (__mmask8) -1))
+#define _mm256_ceil_pd(V) _mm256_round_pd ((V), _MM_FROUND_CEIL)
+#define _mm_mask_fnmadd_round_sd(A,U,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_mask (A, -(B), C, U, R)
+#define _mm256_ceil_ps(V) _mm256_round_ps ((V), _MM_FROUND_CEIL)
+#define _mm512_mask_insertf64x2(W,U,X,Y,C) ((__m512d) __builtin_ia32_insertf64x2_512_mask ((__v8df)(__m512d) (X), (__v2df)(__m128d) (Y), (int) (C), (__v8df)(__m512d) (W), (__mmask8) (U)))
+#define _MM_EXCEPT_UNDERFLOW 0x0010
+#define _mm256_maskz_shuffle_i64x2(U,X,Y,C) ((__m256i) __builtin_ia32_shuf_i64x2_256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(C), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define _mm512_mask_i32gather_ps(V1OLD,MASK,INDEX,ADDR,SCALE) (__m512) __builtin_ia32_gathersiv16sf ((__v16sf)(__m512) (V1OLD), (void const *) (ADDR), (__v16si)(__m512i) (INDEX), (__mmask16) (MASK), (int) (SCALE))
+#define _mm512_maskz_ternarylogic_epi32(U,A,B,C,I) ((__m512i) __builtin_ia32_pternlogd512_maskz ((__v16si) (__m512i) (A), (__v16si) (__m512i) (B), (__v16si) (__m512i) (C), (unsigned char) (I), (__mmask16) (U)))
+#define _mm256_maskz_rol_epi64(U,A,B) ((__m256i)__builtin_ia32_prolq256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define __LITTLE_ENDIAN 1234
+#define _mm512_maskz_fmaddsub_round_pd(U,A,B,C,R) (__m512d)__builtin_ia32_vfmaddsubpd512_maskz(A, B, C, U, R)
+#define _mm512_maskz_fmaddsub_round_ph(U,A,B,C,R) ((__m512h)__builtin_ia32_vfmaddsubph512_maskz ((A), (B), (C), (U), (R)))
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+#define _mm512_maskz_fmaddsub_round_ps(U,A,B,C,R) (__m512)__builtin_ia32_vfmaddsubps512_maskz(A, B, C, U, R)
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+#define _rotl(a,b) __rold((a), (b))
+#define _mm_mmask_i32gather_epi32(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128i) __builtin_ia32_gather3siv4si ((__v4si)(__m128i) (V1OLD), (void const *) (ADDR), (__v4si)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define htobe64(x) __bswap_64 (x)
+#define _AMXBF16INTRIN_H_INCLUDED 
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define _mm256_mask_permutex_epi64(W,M,X,I) ((__m256i) __builtin_ia32_permdi256_mask ((__v4di)(__m256i)(X), (int)(I), (__v4di)(__m256i)(W), (__mmask8)(M)))
+#define INT_FAST8_MIN (-128)
+#define CLOCK_MONOTONIC_COARSE 6
+#define _mm512_mask_fnmadd_round_pd(A,U,B,C,R) (__m512d)__builtin_ia32_vfnmaddpd512_mask(A, B, C, U, R)
+#define _mm_comi_round_sd(A,B,C,D) __builtin_ia32_vcomisd(A, B, C, D)
+#define _mm256_alignr_epi32(X,Y,C) ((__m256i)__builtin_ia32_alignd256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(C), (__v8si)(__m256i)(X), (__mmask8)-1))
+#define __DEC32_EPSILON__ 1E-6DF
+#define _BITS_TYPES_H 1
+#define _mm_extract_epi16(A,N) ((int) (unsigned short) __builtin_ia32_vec_ext_v8hi ((__v8hi)(__m128i)(A), (int)(N)))
+#define _mm512_maskz_ternarylogic_epi64(U,A,B,C,I) ((__m512i) __builtin_ia32_pternlogq512_maskz ((__v8di) (__m512i) (A), (__v8di) (__m512i) (B), (__v8di) (__m512i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define _mm512_mask_cvtt_roundps_epu32(W,U,A,B) ((__m512i)__builtin_ia32_cvttps2udq512_mask(A, (__v16si)(W), U, B))
+#define SCNo16 "ho"
+#define ____gwchar_t_defined 1
+#define __UID_T_TYPE __U32_TYPE
+#define _mm_mmask_i32gather_epi64(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128i) __builtin_ia32_gather3siv2di ((__v2di)(__m128i) (V1OLD), (void const *) (ADDR), (__v4si)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define CLOCK_THREAD_CPUTIME_ID 3
+#define _AMXTILEINTRIN_H_INCLUDED 
+#define _mm256_mask_shuffle_ps(W,U,A,B,C) ((__m256) __builtin_ia32_shufps256_mask ((__v8sf)(__m256)(A), (__v8sf)(__m256)(B), (int)(C), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _SIDD_CMP_EQUAL_EACH 0x08
+#define _mm256_mask_ror_epi64(W,U,A,B) ((__m256i)__builtin_ia32_prorq256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define _mm256_i32scatter_epi32(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv8si ((void *) (ADDR), (__mmask8)0xFF, (__v8si)(__m256i) (INDEX), (__v8si)(__m256i) (V1), (int) (SCALE))
+#define _mm_extract_epi32(X,N) ((int) __builtin_ia32_vec_ext_v4si ((__v4si)(__m128i)(X), (int)(N)))
+#define __LDBL_MAX_EXP__ 16384
+#define SCNo32 "o"
+#define _mm256_alignr_epi64(X,Y,C) ((__m256i)__builtin_ia32_alignq256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(C), (__v4di)(__m256i)(X), (__mmask8)-1))
+#define _mm512_mask_min_round_pd(W,U,A,B,R) (__m512d)__builtin_ia32_minpd512_mask(A, B, W, U, R)
+#define _mm512_mask_min_round_ph(A,B,C,D,E) (__builtin_ia32_minph512_mask_round ((C), (D), (A), (B), (E)))
+#define _XABORT_DEBUG (1 << 4)
+#define _mm512_mask_min_round_ps(W,U,A,B,R) (__m512)__builtin_ia32_minps512_mask(A, B, W, U, R)
+#define _mm256_fpclass_pd_mask(X,C) ((__mmask8) __builtin_ia32_fpclasspd256_mask ((__v4df) (__m256d) (X), (int) (C),(__mmask8)-1))
+#define __PTRDIFF_TYPE__ long int
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define _mm512_mask_cvtt_roundps_epu64(W,U,A,B) ((__m512i)__builtin_ia32_cvttps2uqq512_mask ((A), (__v8di)(W), (U), (B)))
+#define _CMP_UNORD_Q 0x03
+#define __WINT_MIN__ 0U
+#define _CMP_UNORD_S 0x13
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define _mm_maskz_sqrt_sd(U,A,B) _mm_maskz_sqrt_round_sd ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm_maskz_sqrt_ss(U,A,B) _mm_maskz_sqrt_round_ss ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define __linux__ 1
+#define _mm_mask_i64scatter_epi32(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4si ((void *) (ADDR), (__mmask8) (MASK), (__v2di)(__m128i) (INDEX), (__v4si)(__m128i) (V1), (int) (SCALE))
+#define _mm512_cvt_roundepu32_ph(A,B) (__builtin_ia32_vcvtudq2ph512_mask_round ((__v16si)(A), _mm256_setzero_ph (), (__mmask16)-1, B))
+#define _mm_extract_epi64(X,N) ((long long) __builtin_ia32_vec_ext_v2di ((__v2di)(__m128i)(X), (int)(N)))
+#define __FLT32X_IS_IEC_60559__ 2
+#define SCNo64 __PRI64_PREFIX "o"
+#define _mm256_shrdi_epi16(A,B,C) ((__m256i) __builtin_ia32_vpshrd_v16hi ((__v16hi)(__m256i)(A), (__v16hi)(__m256i)(B),(int)(C)))
+#define __itimerspec_defined 1
+#define _IMMINTRIN_H_INCLUDED 
+#define __FLT128_MANT_DIG__ 113
+#define _mm256_maskz_slli_epi16(U,X,C) ((__m256i)__builtin_ia32_psllwi256_mask ((__v16hi)(__m256i)(X), (int)(C), (__v16hi)(__m256i)_mm256_setzero_si256 (), (__mmask16)(U)))
+#define __encls_edbgrd(leaf,b,c,retval) __asm__ __volatile__("encls\n\t" : "=a" (retval), "=b" (b) : "a" (leaf), "c" (c))
+#define _mm_mask_i64scatter_epi64(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv2di ((void *) (ADDR), (__mmask8) (MASK), (__v2di)(__m128i) (INDEX), (__v2di)(__m128i) (V1), (int) (SCALE))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __PID_T_TYPE __S32_TYPE
+#define _mm_mpsadbw_epu8(X,Y,M) ((__m128i) __builtin_ia32_mpsadbw128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _T_PTRDIFF 
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+#define _FXSRINTRIN_H_INCLUDED 
+#define _mm256_maskz_slli_epi32(U,X,C) ((__m256i)__builtin_ia32_pslldi256_mask ((__v8si)(__m256i)(X), (int)(C), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define _mm512_cvt_roundph_epi16(A,B) ((__m512i)__builtin_ia32_vcvtph2w512_mask_round ((A), (__v32hi) _mm512_setzero_si512 (), (__mmask32)-1, (B)))
+#define _mm_mmask_i32gather_pd(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128d) __builtin_ia32_gather3siv2df ((__v2df)(__m128d) (V1OLD), (void const *) (ADDR), (__v4si)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm256_permute2_pd(X,Y,C,I) ((__m256d) __builtin_ia32_vpermil2pd256 ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (__v4di)(__m256i)(C), (int)(I)))
+#define _mm512_roundscale_round_pd(A,B,R) ((__m512d) __builtin_ia32_rndscalepd_mask ((__v8df)(__m512d)(A), (int)(B), (__v8df)_mm512_undefined_pd(), (__mmask8)(-1), R))
+#define _mm512_roundscale_round_ph(A,B,C) (__builtin_ia32_rndscaleph512_mask_round ((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define _mm512_roundscale_round_ps(A,B,R) ((__m512) __builtin_ia32_rndscaleps_mask ((__v16sf)(__m512)(A), (int)(B), (__v16sf)_mm512_undefined_ps(), (__mmask16)(-1), R))
+#define _mm512_sqrt_round_ph(A,B) (__builtin_ia32_sqrtph512_mask_round ((A), _mm512_setzero_ph (), (__mmask32)-1, (B)))
+#define _mm_dpbusds_epi32(A,B,C) ((__m128i) __builtin_ia32_vpdpbusds_v4si ((__v4si) (A), (__v4si) (B), (__v4si) (C)))
+#define I2C_CH 1
+#define PRIuFAST64 __PRI64_PREFIX "u"
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+#define _tile_dpbf16ps_internal(dst,src1,src2) __asm__ volatile ("{tdpbf16ps\t%%tmm"#src2", %%tmm"#src1", %%tmm"#dst"|tdpbf16ps\t%%tmm"#dst", %%tmm"#src1", %%tmm"#src2"}" ::)
+#define _mm_mask_i32gather_ps(SRC,BASE,INDEX,MASK,SCALE) (__m128) __builtin_ia32_gathersiv4sf ((__v4sf)(__m128) (SRC), (float const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4sf)(__m128) (MASK), (int) (SCALE))
+#define _mm512_maskz_rsqrt28_pd(U,A) _mm512_maskz_rsqrt28_round_pd(U, A, _MM_FROUND_CUR_DIRECTION)
+#define _SIDD_SWORD_OPS 0x03
+#define __pconfig_b(leaf,b,retval) __asm__ __volatile__ ("pconfig\n\t" : "=a" (retval) : "a" (leaf), "b" (b) : "cc")
+#define _mm512_bslli_epi128(A,N) ((__m512i)__builtin_ia32_pslldq512 ((__m512i)(A), (int)(N) * 8))
+#define _DEFAULT_SOURCE 1
+#define _mm256_maskz_slli_epi64(U,X,C) ((__m256i)__builtin_ia32_psllqi256_mask ((__v4di)(__m256i)(X), (int)(C), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define PIN_MODE_OUTPUT 3
+#define PRIuLEAST16 "u"
+#define _mm512_mask_fcmadd_round_pch(A,B,C,D,E) ((__m512h) __builtin_ia32_vfcmaddcph512_mask_round ((__v32hf) (A), (__v32hf) (C), (__v32hf) (D), (B), (E)))
+#define _mm512_maskz_fcmadd_round_pch(A,B,C,D,E) (__m512h) __builtin_ia32_vfcmaddcph512_maskz_round ((B), (C), (D), (A), (E))
+#define _BMIINTRIN_H_INCLUDED 
+#define _mm_comi_sh(A,B,P) (__builtin_ia32_cmpsh_mask_round ((A), (B), (P), (__mmask8) (-1), _MM_FROUND_CUR_DIRECTION))
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+#define _mm256_roundscale_ph(A,B) (__builtin_ia32_rndscaleph256_mask ((A), (B), _mm256_setzero_ph(), ((__mmask16)-1)))
+#define _mm256_getmant_pd(X,B,C) ((__m256d) __builtin_ia32_getmantpd256_mask ((__v4df)(__m256d) (X), (int)(((C)<<2) | (B)), (__v4df)(__m256d)_mm256_setzero_pd (), (__mmask8)-1))
+#define _mm_maskz_rsqrt28_sd(U,A,B) _mm_maskz_rsqrt28_round_sd ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm256_getmant_ps(X,B,C) ((__m256) __builtin_ia32_getmantps256_mask ((__v8sf)(__m256) (X), (int)(((C)<<2) | (B)), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)-1))
+#define _mm_maskz_rsqrt28_ss(U,A,B) _mm_maskz_rsqrt28_round_ss ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+#define PRIuLEAST32 "u"
+#define __END_DECLS 
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+#define _mm256_mmask_i64gather_epi32(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128i) __builtin_ia32_gather3div8si ((__v4si)(__m128i) (V1OLD), (void const *) (ADDR), (__v4di)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define __CONCAT(x,y) x ## y
+#define _mm_mask_max_round_sh(A,B,C,D,E) (__builtin_ia32_maxsh_mask_round ((C), (D), (A), (B), (E)))
+#define PIN_MODE_IGNORE 14
+#define _mm_maskz_fmsub_round_sh(U,A,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_maskz ((A), (B), -(C), (U), (R)))
+#define __STDC_HOSTED__ 1
+#define PIN_MODE_TTY 7
+#define _bit_scan_reverse(a) __bsrd(a)
+#define __SLONG32_TYPE int
+#define _SYS_SELECT_H 1
+#define _mm_blend_pd(X,Y,M) ((__m128d) __builtin_ia32_blendpd ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(M)))
+#define PRIuLEAST64 __PRI64_PREFIX "u"
+#define _CMP_LT_OQ 0x11
+#define _CMP_LT_OS 0x01
+#define _mm_blend_ps(X,Y,M) ((__m128) __builtin_ia32_blendps ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(M)))
+#define _VPCLMULQDQINTRIN_H_INCLUDED 
+#define UTILITY_VCD_BOGUS_H 
+#define _mm512_shuffle_i32x4(X,Y,C) ((__m512i) __builtin_ia32_shuf_i32x4_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(C), (__v16si)(__m512i)_mm512_undefined_epi32 (), (__mmask16)-1))
+#define _mm_cvt_roundi64_sh(A,B,C) (__builtin_ia32_vcvtsi2sh64_round ((A), (B), (C)))
+#define COMMPORT_ERROR_DATAOVR 2
+#define _mm256_dpwssd_epi32(A,B,C) ((__m256i) __builtin_ia32_vpdpwssd_v8si ((__v8si) (A), (__v8si) (B), (__v8si) (C)))
+#define _AVX512VBMIVLINTRIN_H_INCLUDED 
+#define PRIdPTR __PRIPTR_PREFIX "d"
+#define _mm_mask_min_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_minsd_mask_round(A, B, W, U, C)
+#define _mm512_maskz_shldi_epi32(A,B,C,D) ((__m512i) __builtin_ia32_vpshld_v16si_mask ((__v16si)(__m512i)(B), (__v16si)(__m512i)(C),(int)(D), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(A)))
+#define _mm_getexp_round_sd(A,B,R) ((__m128d)__builtin_ia32_getexpsd128_round((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), R))
+#define _mm512_mask_cvtt_roundpd_epi32(W,U,A,B) ((__m256i)__builtin_ia32_cvttpd2dq512_mask(A, (__v8si)(W), U, B))
+#define _mm512_maskz_sub_round_pd(U,A,B,C) (__m512d)__builtin_ia32_subpd512_mask(A, B, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm512_maskz_sub_round_ph(A,B,C,D) ((__m512h)__builtin_ia32_subph512_mask_round((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define _mm512_maskz_sub_round_ps(U,A,B,C) (__m512)__builtin_ia32_subps512_mask(A, B, (__v16sf)_mm512_setzero_ps(), U, C)
+#define _mm256_maskz_extracti32x4_epi32(U,X,C) ((__m128i) __builtin_ia32_extracti32x4_256_mask ((__v8si)(__m256i) (X), (int) (C), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _popcnt32(a) __popcntd(a)
+#define _mm_reduce_ph(A,B) (__builtin_ia32_reduceph128_mask ((A), (B), _mm_setzero_ph (), ((__mmask8)-1)))
+#define __SHRT_WIDTH__ 16
+#define _mm_comi_round_sh(A,B,P,R) (__builtin_ia32_cmpsh_mask_round ((A), (B), (P), (__mmask8) (-1), (R)))
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define BIT(x) (0x01 << (x))
+#define _mm512_maskz_shldi_epi64(A,B,C,D) ((__m512i) __builtin_ia32_vpshld_v8di_mask ((__v8di)(__m512i)(B), (__v8di)(__m512i)(C),(int)(D), (__v8di)(__m512i)_mm512_setzero_si512 (), (__mmask8)(A)))
+#define TMP_MAX 238328
+#define _mm_maskz_cvt_roundss_sd(U,A,B,C) (__m128d)__builtin_ia32_cvtss2sd_mask_round ((A), (B), _mm_setzero_pd (), (U), (C))
+#define __FLT32_IS_IEC_60559__ 2
+#define _mm_maskz_cvt_roundss_sh(A,B,C,R) (__builtin_ia32_vcvtss2sh_mask_round ((C), (B), _mm_setzero_ph (), A, R))
+#define _mm_maskz_fmadd_round_sd(U,A,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_maskz (A, B, C, U, R)
+#define _mm_maskz_fmadd_round_sh(U,A,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_maskz ((A), (B), (C), (U), (R)))
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+#define _mm512_i64gather_ps(INDEX,ADDR,SCALE) (__m256) __builtin_ia32_gatherdiv16sf ((__v8sf)_mm256_undefined_ps(), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8)0xFF, (int) (SCALE))
+#define _popcnt64(a) __popcntq(a)
+#define _mm_alignr_epi32(X,Y,C) ((__m128i)__builtin_ia32_alignd128_mask ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(C), (__v4si)(__m128i)(X), (__mmask8)-1))
+#define _MM_SHUFFLE2(fp1,fp0) (((fp1) << 1) | (fp0))
+#define _mm512_maskz_cmul_pch(U,A,B) _mm512_maskz_fcmul_pch ((U), (A), (B))
+#define _mm_maskz_shufflelo_epi16(U,A,B) ((__m128i) __builtin_ia32_pshuflw128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm256_mask_insertf64x2(W,U,X,Y,C) ((__m256d) __builtin_ia32_insertf64x2_256_mask ((__v4df)(__m256d) (X), (__v2df)(__m128d) (Y), (int) (C), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define _mm256_shuffle_i64x2(X,Y,C) ((__m256i) __builtin_ia32_shuf_i64x2_256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(C), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)-1))
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+#define _WCHAR_T_ 
+#define _rdpmc(a) __rdpmc(a)
+#define _mm512_maskz_getexp_pd(U,A) ((__m512d)__builtin_ia32_getexppd512_mask((__v8df)(__m512d)(A), (__v8df)_mm512_setzero_pd(), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _STDDEF_H 
+#define _mm256_mask_fpclass_ph_mask(u,X,C) ((__mmask16) __builtin_ia32_fpclassph256_mask ((__v16hf) (__m256h) (X), (int) (C),(__mmask16)(u)))
+#define _mm512_maskz_getexp_ps(U,A) ((__m512)__builtin_ia32_getexpps512_mask((__v16sf)(__m512)(A), (__v16sf)_mm512_setzero_ps(), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm_mask_range_round_sd(W,U,A,B,C,R) ((__m128d) __builtin_ia32_rangesd128_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)(__m128d)(W), (__mmask8)(U), (R)))
+#define _mm512_maskz_roundscale_pd(A,B,C) ((__m512d) __builtin_ia32_rndscalepd_mask ((__v8df)(__m512d)(B), (int)(C), (__v8df)_mm512_setzero_pd(), (__mmask8)(A), _MM_FROUND_CUR_DIRECTION))
+#define __LONG_LONG_WIDTH__ 64
+#define __SIZEOF_PTRDIFF_T__ 8
+#define _mm512_i64scatter_epi32(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv16si ((void *) (ADDR), (__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (__v8si)(__m256i) (V1), (int) (SCALE))
+#define _mm_i64scatter_epi32(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4si ((void *) (ADDR), (__mmask8)0xFF, (__v2di)(__m128i) (INDEX), (__v4si)(__m128i) (V1), (int) (SCALE))
+#define __unix__ 1
+#define __SIZEOF_LONG__ 8
+#define _EMMINTRIN_H_INCLUDED 
+#define FILENAME_MAX 4096
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+#define _mm512_mask_fixupimm_ps(X,U,Y,Z,C) ((__m512)__builtin_ia32_fixupimmps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (__v16si)(__m512i)(Z), (int)(C), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define PRIoFAST16 __PRIPTR_PREFIX "o"
+#define __UINT16_C(c) c
+#define _mm512_mask_permutex_epi64(W,M,X,I) ((__m512i) __builtin_ia32_permdi512_mask ((__v8di)(__m512i)(X), (int)(I), (__v8di)(__m512i)(W), (__mmask8)(M)))
+#define PIN_IS_ANALOG(p) (0)
+#define SCNoLEAST32 "o"
+#define _KEYLOCKERINTRIN_H_INCLUDED 
+#define _mm512_insertf32x8(X,Y,C) ((__m512) __builtin_ia32_insertf32x8_mask ((__v16sf)(__m512) (X), (__v8sf)(__m256) (Y), (int) (C), (__v16sf)(__m512)_mm512_setzero_ps (), (__mmask16)-1))
+#define _mm256_srai_epi64(A,B) ((__m256i) __builtin_ia32_psraqi256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)_mm256_setzero_si256 (), (__mmask8)-1))
+#define _mm_maskz_shldi_epi16(A,B,C,D) ((__m128i) __builtin_ia32_vpshld_v8hi_mask ((__v8hi)(__m128i)(B), (__v8hi)(__m128i)(C),(int)(D), (__v8hi)(__m128i)_mm_setzero_si128 (), (__mmask8)(A)))
+#define _mm256_cmp_epu32_mask(X,Y,P) ((__mmask8) __builtin_ia32_ucmpd256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(P), (__mmask8)-1))
+#define SCNdLEAST16 "hd"
+#define _mm512_cvtt_roundps_epi64(A,B) ((__m512i)__builtin_ia32_cvttps2qq512_mask ((A), (__v8di)_mm512_setzero_si512 (), -1, (B)))
+#define _mm_i64scatter_epi64(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv2di ((void *) (ADDR), (__mmask8)0xFF, (__v2di)(__m128i) (INDEX), (__v2di)(__m128i) (V1), (int) (SCALE))
+#define PRIoFAST32 __PRIPTR_PREFIX "o"
+#define __gnu_linux__ 1
+#define INT_FAST16_MAX (9223372036854775807L)
+#define _mm256_mmask_i64gather_pd(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256d) __builtin_ia32_gather3div4df ((__v4df)(__m256d) (V1OLD), (void const *) (ADDR), (__v4di)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm256_permute4x64_epi64(X,M) ((__m256i) __builtin_ia32_permdi256 ((__v4di)(__m256i)(X), (int)(M)))
+#define __HAVE_DISTINCT_FLOAT32 0
+#define _mm_maskz_scalef_sd(U,A,B) _mm_maskz_scalef_round_sd ((U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm512_maskz_cvtt_roundps_epi32(U,A,B) ((__m512i)__builtin_ia32_cvttps2dq512_mask(A, (__v16si)_mm512_setzero_si512 (), U, B))
+#define _mm_maskz_shldi_epi32(A,B,C,D) ((__m128i) __builtin_ia32_vpshld_v4si_mask ((__v4si)(__m128i)(B), (__v4si)(__m128i)(C),(int)(D), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(A)))
+#define _mm_roti_epi16(A,N) ((__m128i) __builtin_ia32_vprotwi ((__v8hi)(__m128i)(A), (int)(N)))
+#define SCNdLEAST32 "d"
+#define _mm256_maskz_range_pd(U,A,B,C) ((__m256d) __builtin_ia32_rangepd256_mask ((__v4df)(__m256d)(A), (__v4df)(__m256d)(B), (int)(C), (__v4df)_mm256_setzero_pd(), (__mmask8)(U)))
+#define _mm256_maskz_range_ps(U,A,B,C) ((__m256) __builtin_ia32_rangeps256_mask ((__v8sf)(__m256)(A), (__v8sf)(__m256)(B), (int)(C), (__v8sf)_mm256_setzero_ps(), (__mmask8)(U)))
+#define _SIDD_LEAST_SIGNIFICANT 0x00
+#define _mm_maskz_reduce_pd(U,A,B) ((__m128d) __builtin_ia32_reducepd128_mask ((__v2df)(__m128d)(A), (int)(B), (__v2df)_mm_setzero_pd(), (__mmask8)(U)))
+#define _mm_maskz_reduce_ph(A,B,C) (__builtin_ia32_reduceph128_mask ((B), (C), _mm_setzero_ph (), (A)))
+#define __HAVE_FLOAT64X 1
+#define _mm_maskz_fnmadd_round_sd(U,A,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_maskz (A, -(B), C, U, R)
+#define _mm_maskz_fnmadd_round_sh(U,A,B,C,R) ((__m128h) __builtin_ia32_vfnmaddsh3_maskz ((A), (B), (C), (U), (R)))
+#define _mm_maskz_reduce_ps(U,A,B) ((__m128) __builtin_ia32_reduceps128_mask ((__v4sf)(__m128)(A), (int)(B), (__v4sf)_mm_setzero_ps(), (__mmask8)(U)))
+#define __FLT16_MIN_EXP__ (-13)
+#define __U16_TYPE unsigned short int
+#define _mm_maskz_fnmadd_round_ss(U,A,B,C,R) (__m128) __builtin_ia32_vfmaddss3_maskz (A, -(B), C, U, R)
+#define _mm_roti_epi32(A,N) ((__m128i) __builtin_ia32_vprotdi ((__v4si)(__m128i)(A), (int)(N)))
+#define _mm512_maskz_cvtt_roundps_epi64(U,A,B) ((__m512i)__builtin_ia32_cvttps2qq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define SCNxFAST8 "hhx"
+#define _mm_maskz_shldi_epi64(A,B,C,D) ((__m128i) __builtin_ia32_vpshld_v2di_mask ((__v2di)(__m128i)(B), (__v2di)(__m128i)(C),(int)(D), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)(A)))
+#define SCNdLEAST64 __PRI64_PREFIX "d"
+#define __FLT64X_MANT_DIG__ 64
+#define _mm_maskz_reduce_sh(A,B,C,D) (__builtin_ia32_reducesh_mask_round ((B), (C), (D), _mm_setzero_ph (), (A), _MM_FROUND_CUR_DIRECTION))
+#define _mm256_maskz_permutex_pd(U,A,B) ((__m256d) __builtin_ia32_permdf256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)(__m256d)_mm256_setzero_pd (), (__mmask8)(U)))
+#define _mm512_mask_fixupimm_pd(X,U,Y,Z,C) ((__m512d)__builtin_ia32_fixupimmpd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (__v8di)(__m512i)(Z), (int)(C), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm_dp_pd(X,Y,M) ((__m128d) __builtin_ia32_dppd ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(M)))
+#define _mm_mask_fixupimm_pd(X,U,Y,Z,C) ((__m128d)__builtin_ia32_fixupimmpd128_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(U)))
+#define _mm_dp_ps(X,Y,M) ((__m128) __builtin_ia32_dpps ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(M)))
+#define PRId16 "d"
+#define _mm_mask_fixupimm_ps(X,U,Y,Z,C) ((__m128)__builtin_ia32_fixupimmps128_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(U)))
+#define __glibc_has_extension(ext) 0
+#define _mm_maskz_reduce_sd(U,A,B,C) ((__m128d) __builtin_ia32_reducesd_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df) _mm_setzero_pd (), (__mmask8)(U)))
+#define _mm512_mask_inserti32x4(A,B,X,Y,C) ((__m512i) __builtin_ia32_inserti32x4_mask ((__v16si)(__m512i) (X), (__v4si)(__m128i) (Y), (int) (C), (__v16si)(__m512i) (A), (__mmask16)(B)))
+#define _mm512_mask_inserti32x8(W,U,X,Y,C) ((__m512i) __builtin_ia32_inserti32x8_mask ((__v16si)(__m512i) (X), (__v8si)(__m256i) (Y), (int) (C), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define _mm_maskz_reduce_ss(U,A,B,C) ((__m128) __builtin_ia32_reducess_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf) _mm_setzero_ps (), (__mmask8)(U)))
+#define _mm256_mmask_i32gather_ps(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256) __builtin_ia32_gather3siv8sf ((__v8sf)(__m256) (V1OLD), (void const *) (ADDR), (__v8si)(__m256i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _m_pextrw(A,N) _mm_extract_pi16(A, N)
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+#define _MM_ROUND_NEAREST 0x0000
+#define __encls_generic(leaf,b,c,d,retval) __asm__ __volatile__("encls\n\t" : "=a" (retval), "=b" (b), "=c" (c), "=d" (d) : "a" (leaf), "b" (b), "c" (c), "d" (d) : "cc")
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define __FLT_HAS_DENORM__ 1
+#define __SIZEOF_LONG_DOUBLE__ 16
+#define __timeval_defined 1
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define _mm_mask_fixupimm_sd(X,U,Y,Z,C) ((__m128d)__builtin_ia32_fixupimmsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_i32scatter_epi64(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv8di ((void *) (ADDR), (__mmask8)0xFF, (__v8si)(__m256i) (INDEX), (__v8di)(__m512i) (V1), (int) (SCALE))
+#define _mm512_mask_cmp_epu16_mask(M,X,Y,P) ((__mmask32) __builtin_ia32_ucmpw512_mask ((__v32hi)(__m512i)(X), (__v32hi)(__m512i)(Y), (int)(P), (__mmask32)(M)))
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+#define _mm_mask_fixupimm_ss(X,U,Y,Z,C) ((__m128)__builtin_ia32_fixupimmss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define SCNxMAX __PRI64_PREFIX "x"
+#define _mm_maskz_cvt_roundsh_sd(A,B,C,R) (__builtin_ia32_vcvtsh2sd_mask_round ((C), (B), _mm_setzero_pd (), (A), (R)))
+#define _mm512_alignr_epi32(X,Y,C) ((__m512i)__builtin_ia32_alignd512_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(C), (__v16si)_mm512_undefined_epi32 (), (__mmask16)-1))
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define _mm_cvt_roundsh_i32(A,B) ((int)__builtin_ia32_vcvtsh2si32_round ((A), (B)))
+#define _CMP_NGE_UQ 0x19
+#define RAM 8
+#define __STRING(x) #x
+#define _mm256_mmask_i32gather_pd(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256d) __builtin_ia32_gather3siv4df ((__v4df)(__m256d) (V1OLD), (void const *) (ADDR), (__v4si)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define __k8__ 1
+#define _mm256_mask_i32gather_pd(SRC,BASE,INDEX,MASK,SCALE) (__m256d) __builtin_ia32_gathersiv4df ((__v4df)(__m256d) (SRC), (double const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4df)(__m256d) (MASK), (int) (SCALE))
+#define __ONCE_ALIGNMENT 
+#define _mm_mask_cvtsd_ss(W,U,A,B) _mm_mask_cvt_roundsd_ss ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+#define _MM_EXTRACT_FLOAT(D,S,N) { (D) = __builtin_ia32_vec_ext_v4sf ((__v4sf)(S), (N)); }
+#define _mm256_shuffle_epi32(A,N) ((__m256i)__builtin_ia32_pshufd256 ((__v8si)(__m256i)(A), (int)(N)))
+#define __USE_ISOC95 1
+#define _TIME_H 1
+#define __USE_ISOC99 1
+#define __FLT16_MAX_10_EXP__ 4
+#define _mm512_mask_cvt_roundepu16_ph(A,B,C,D) (__builtin_ia32_vcvtuw2ph512_mask_round ((__v32hi)(C), (A), (B), (D)))
+#define _mm_cmpistra(X,Y,M) ((int) __builtin_ia32_pcmpistria128 ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(M)))
+#define _mm_aeskeygenassist_si128(X,C) ((__m128i) __builtin_ia32_aeskeygenassist128 ((__v2di)(__m128i)(X), (int)(C)))
+#define _mm_cvt_roundsh_i64(A,B) ((long long)__builtin_ia32_vcvtsh2si64_round ((A), (B)))
+#define _mm256_permute2x128_si256(X,Y,M) ((__m256i) __builtin_ia32_permti256 ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(M)))
+#define _mm256_mul_pch(A,B) _mm256_fmul_pch ((A), (B))
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define _BITS_STDINT_UINTN_H 1
+#define _mm_roti_epi64(A,N) ((__m128i) __builtin_ia32_vprotqi ((__v2di)(__m128i)(A), (int)(N)))
+#define _mm256_mask_range_pd(W,U,A,B,C) ((__m256d) __builtin_ia32_rangepd256_mask ((__v4df)(__m256d)(A), (__v4df)(__m256d)(B), (int)(C), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define _mm256_permute2_ps(X,Y,C,I) ((__m256) __builtin_ia32_vpermil2ps256 ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (__v8si)(__m256i)(C), (int)(I)))
+#define _mm512_mask_rcp28_pd(W,U,A) _mm512_mask_rcp28_round_pd(W, U, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm256_cmp_ps_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpps256_mask ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(P), (__mmask8)-1))
+#define __DBL_HAS_INFINITY__ 1
+#define _mm512_cvt_roundph_epi32(A,B) ((__m512i) __builtin_ia32_vcvtph2dq512_mask_round ((A), (__v16si) _mm512_setzero_si512 (), (__mmask16)-1, (B)))
+#define _T_PTRDIFF_ 
+#define _mm_mask_cvt_roundsd_ss(W,U,A,B,C) (__m128)__builtin_ia32_cvtsd2ss_mask_round ((A), (B), (W), (U), (C))
+#define _mm512_mask_cmul_round_pch(W,U,A,B,R) _mm512_mask_fcmul_round_pch ((W), (U), (A), (B), (R))
+#define _mm_mask_i64gather_pd(SRC,BASE,INDEX,MASK,SCALE) (__m128d) __builtin_ia32_gatherdiv2df ((__v2df)(__m128d) (SRC), (double const *) (BASE), (__v2di)(__m128i) (INDEX), (__v2df)(__m128d) (MASK), (int) (SCALE))
+#define _mm_cvt_roundu64_sd(A,B,C) (__m128d)__builtin_ia32_cvtusi2sd64(A, B, C)
+#define _mm256_mask_extracti32x4_epi32(W,U,X,C) ((__m128i) __builtin_ia32_extracti32x4_256_mask ((__v8si)(__m256i) (X), (int) (C), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define _mm_cvt_roundu64_ss(A,B,C) (__m128)__builtin_ia32_cvtusi2ss64(A, B, C)
+#define stdin stdin
+#define PRIi16 "i"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+#define _mm256_maskz_ror_epi64(U,A,B) ((__m256i)__builtin_ia32_prorq256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+#define _mm512_setr4_epi32(e0,e1,e2,e3) _mm512_set4_epi32(e3,e2,e1,e0)
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DEC32_MIN_EXP__ (-94)
+#define _mm256_dpwssds_epi32(A,B,C) ((__m256i) __builtin_ia32_vpdpwssds_v8si ((__v8si) (A), (__v8si) (B), (__v8si) (C)))
+#define _mm256_insert_epi32(X,D,N) (__extension__ ({ __m128i __Y = _mm256_extractf128_si256 ((X), (N) >> 2); __Y = _mm_insert_epi32 (__Y, (D), (N) % 4); _mm256_insertf128_si256 ((X), __Y, (N) >> 2); }))
+#define P_tmpdir "/tmp"
+#define PRIi32 "i"
+#define _XABORT_CONFLICT (1 << 2)
+#define _mm512_mask3_fcmadd_round_pch(A,B,C,D,E) ((__m512h) __builtin_ia32_vfcmaddcph512_mask3_round ((A), (B), (C), (D), (E)))
+#define _mm512_mask_cvt_roundepi64_pd(W,U,A,B) ((__m512d)__builtin_ia32_cvtqq2pd512_mask ((__v8di)(A), (W), (U), (B)))
+#define _mm_bsrli_si128(A,N) ((__m128i)__builtin_ia32_psrldqi128 ((__m128i)(A), (int)(N) * 8))
+#define _mm512_maskz_permutex_epi64(M,X,I) ((__m512i) __builtin_ia32_permdi512_mask ((__v8di)(__m512i)(X), (int)(I), (__v8di)(__m512i) (_mm512_setzero_si512 ()), (__mmask8)(M)))
+#define _mm_mask_ternarylogic_epi32(A,U,B,C,I) ((__m128i) __builtin_ia32_pternlogd128_mask ((__v4si) (__m128i) (A), (__v4si) (__m128i) (B), (__v4si) (__m128i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define be32toh(x) __bswap_32 (x)
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+#define _mm512_mask_add_round_ph(A,B,C,D,E) ((__m512h)__builtin_ia32_addph512_mask_round((C), (D), (A), (B), (E)))
+#define _mm512_setr4_epi64(e0,e1,e2,e3) _mm512_set4_epi64(e3,e2,e1,e0)
+#define _mm512_mask_cvt_roundepi64_ph(A,B,C,D) (__builtin_ia32_vcvtqq2ph512_mask_round ((__v8di)(C), (A), (B), (D)))
+#define __FLT32X_HAS_DENORM__ 1
+#define __INT_FAST16_TYPE__ long int
+#define _mm256_mask_gf2p8affineinv_epi64_epi8(A,B,C,D,E) ((__m256i) __builtin_ia32_vgf2p8affineinvqb_v32qi_mask( (__v32qi)(__m256i)(C), (__v32qi)(__m256i)(D), (int)(E), (__v32qi)(__m256i)(A), (__mmask32)(B)))
+#define __HAVE_FLOAT128X 0
+#define _mm512_maskz_cvtt_roundph_epu64(A,B,C) (__builtin_ia32_vcvttph2uqq512_mask_round ((B), _mm512_setzero_si512 (), (A), (C)))
+#define _SIZE_T_DEFINED 
+#define _mm512_sqrt_round_pd(A,C) (__m512d)__builtin_ia32_sqrtpd512_mask(A, (__v8df)_mm512_undefined_pd(), -1, C)
+#define SCNdFAST8 "hhd"
+#define _SIDD_UNIT_MASK 0x40
+#define _mm256_mask_cmp_epu8_mask(M,X,Y,P) ((__mmask32) __builtin_ia32_ucmpb256_mask ((__v32qi)(__m256i)(X), (__v32qi)(__m256i)(Y), (int)(P), (__mmask32)(M)))
+#define PRIi64 __PRI64_PREFIX "i"
+#define __FLT64_HAS_DENORM__ 1
+#define _mm_extract_pi16(A,N) ((int) (unsigned short) __builtin_ia32_vec_ext_v4hi ((__v4hi)(__m64)(A), (int)(N)))
+#define _mm512_mask_alignr_epi8(W,U,X,Y,N) ((__m512i) __builtin_ia32_palignr512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)((N) * 8), (__v8di)(__m512i)(W), (__mmask64)(U)))
+#define COMMPORT_TYPE_1WIRE 3
+#define _mm_mask_ternarylogic_epi64(A,U,B,C,I) ((__m128i) __builtin_ia32_pternlogq128_mask ((__v2di) (__m128i) (A), (__v2di) (__m128i) (B), (__v2di) (__m128i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define __stub_setlogin 
+#define _XSAVEINTRIN_H_INCLUDED 
+#define _mm512_fmsub_round_ph(A,B,C,R) ((__m512h)__builtin_ia32_vfmsubph512_mask ((A), (B), (C), -1, (R)))
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+#define _mm_mask_getexp_round_sh(W,U,A,B,C) (__m128h)__builtin_ia32_getexpsh_mask_round(A, B, W, U, C)
+#define _mm_maskz_sqrt_round_sh(A,B,C,D) (__builtin_ia32_sqrtsh_mask_round ((C), (B), _mm_setzero_ph (), (A), (D)))
+#define _MM_FROUND_TO_ZERO 0x03
+#define _mm512_cvt_roundph_epu32(A,B) ((__m512i) __builtin_ia32_vcvtph2udq512_mask_round ((A), (__v16si) _mm512_setzero_si512 (), (__mmask16)-1, (B)))
+#define _mm_i32gather_pd(BASE,INDEX,SCALE) (__m128d) __builtin_ia32_gathersiv2df ((__v2df) _mm_setzero_pd (), (double const *) (BASE), (__v4si)(__m128i) (INDEX), (__v2df) _mm_cmpeq_pd (_mm_setzero_pd (), _mm_setzero_pd ()), (int) (SCALE))
+#define __S32_TYPE int
+#define _mm512_mask_cvt_roundepu32_ph(A,B,C,D) (__builtin_ia32_vcvtudq2ph512_mask_round ((__v16si)C, A, B, D))
+#define _mm_mask_i32gather_pd(SRC,BASE,INDEX,MASK,SCALE) (__m128d) __builtin_ia32_gathersiv2df ((__v2df)(__m128d) (SRC), (double const *) (BASE), (__v4si)(__m128i) (INDEX), (__v2df)(__m128d) (MASK), (int) (SCALE))
+#define ROM 4
+#define _mm_cvtt_roundsd_u32(A,B) ((unsigned)__builtin_ia32_vcvttsd2usi32(A, B))
+#define _mm256_extractf64x2_pd(X,C) ((__m128d) __builtin_ia32_extractf64x2_256_mask ((__v4df)(__m256d) (X), (int) (C), (__v2df)(__m128d) _mm_setzero_pd(), (__mmask8)-1))
+#define _mm512_maskz_exp2a23_round_ps(U,A,C) __builtin_ia32_exp2ps_mask(A, (__v16sf)_mm512_setzero_ps(), U, C)
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define _mm_mask_ror_epi64(W,U,A,B) ((__m128i)__builtin_ia32_prorq128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)(W), (__mmask8)(U)))
+#define __DEC128_EPSILON__ 1E-33DL
+#define _mm512_mask_getmant_ph(W,U,X,B,C) ((__m512h)__builtin_ia32_getmantph512_mask ((__v32hf)(__m512h)(X), (int)(((C)<<2) | (B)), (__v32hf)(__m512h)(W), (__mmask32)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm256_i64scatter_epi32(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8si ((void *) (ADDR), (__mmask8)0xFF, (__v4di)(__m256i) (INDEX), (__v4si)(__m128i) (V1), (int) (SCALE))
+#define _mm512_maskz_rsqrt28_round_pd(U,A,C) __builtin_ia32_rsqrt28pd_mask(A, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm512_maskz_rsqrt28_round_ps(U,A,C) __builtin_ia32_rsqrt28ps_mask(A, (__v16sf)_mm512_setzero_ps(), U, C)
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+#define __HAVE_FLOAT16 0
+#define _CMP_NLE_UQ 0x16
+#define _CMP_NLE_US 0x06
+#define _mm_maskz_fmul_round_sch(__A,__B,__C,__E) (__m128h) __builtin_ia32_vfmulcsh_mask_round ((__v8hf) __B, (__v8hf) __C, _mm_setzero_ph (), __A, __E)
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+#define __amd64 1
+#define __SYSCALL_WORDSIZE 64
+#define DEFAULT_BAUD 57600
+#define _mm256_mask_gf2p8affine_epi64_epi8(A,B,C,D,E) ((__m256i) __builtin_ia32_vgf2p8affineqb_v32qi_mask((__v32qi)(__m256i)(C), (__v32qi)(__m256i)(D), (int)(E), (__v32qi)(__m256i)(A), (__mmask32)(B)))
+#define _mm256_i32scatter_epi64(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv4di ((void *) (ADDR), (__mmask8)0xFF, (__v4si)(__m128i) (INDEX), (__v4di)(__m256i) (V1), (int) (SCALE))
+#define _mm_cvtt_roundsd_u64(A,B) ((unsigned long long)__builtin_ia32_vcvttsd2usi64(A, B))
+#define _mm512_mask_exp2a23_ps(W,U,A) _mm512_mask_exp2a23_round_ps(W, U, A, _MM_FROUND_CUR_DIRECTION)
+#define __HAVE_FLOAT32 1
+#define _mm512_max_round_pd(A,B,R) (__m512d)__builtin_ia32_maxpd512_mask(A, B, (__v8df)_mm512_undefined_pd(), -1, R)
+#define PRIXLEAST64 __PRI64_PREFIX "X"
+#define _mm512_max_round_ph(A,B,C) (__builtin_ia32_maxph512_mask_round ((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define _PTRDIFF_T_DECLARED 
+#define _mm256_mask_cmp_epu16_mask(M,X,Y,P) ((__mmask16) __builtin_ia32_ucmpw256_mask ((__v16hi)(__m256i)(X), (__v16hi)(__m256i)(Y), (int)(P), (__mmask16)(M)))
+#define _mm_maskz_shuffle_ps(U,A,B,C) ((__m128) __builtin_ia32_shufps128_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)(U)))
+#define _mm256_i64scatter_epi64(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4di ((void *) (ADDR), (__mmask8)0xFF, (__v4di)(__m256i) (INDEX), (__v4di)(__m256i) (V1), (int) (SCALE))
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+#define __glibc_objsize(__o) __bos (__o)
+#define _mm_maskz_max_round_sd(U,A,B,C) (__m128d)__builtin_ia32_maxsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, C)
+#define _mm_maskz_max_round_ss(U,A,B,C) (__m128)__builtin_ia32_maxss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, C)
+#define _mm_maskz_fcmadd_round_sch(A,B,C,D,E) __builtin_ia32_vfcmaddcsh_maskz_round ((B), (C), (D), (A), (E))
+#define _tile_stream_loadd_internal(dst,base,stride) __asm__ volatile ("{tileloaddt1\t(%0,%1,1), %%tmm"#dst"|tileloaddt1\t%%tmm"#dst", [%0+%1*1]}" :: "r" ((const void*) (base)), "r" ((long) (stride)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+#define _mm_ceil_sd(D,V) _mm_round_sd ((D), (V), _MM_FROUND_CEIL)
+#define _mm512_mask_cmp_epi64_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpq512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(P), (__mmask8)(M)))
+#define __FLT32_HAS_QUIET_NAN__ 1
+#define L_ctermid 9
+#define _mm256_fixupimm_pd(X,Y,Z,C) ((__m256d)__builtin_ia32_fixupimmpd256_mask ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (__v4di)(__m256i)(Z), (int)(C), (__mmask8)(-1)))
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+#define _mm256_fixupimm_ps(X,Y,Z,C) ((__m256)__builtin_ia32_fixupimmps256_mask ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (__v8si)(__m256i)(Z), (int)(C), (__mmask8)(-1)))
+#define __SIZEOF_SIZE_T__ 8
+#define PRIiLEAST16 "i"
+#define _mm256_inserti32x4(X,Y,C) ((__m256i) __builtin_ia32_inserti32x4_256_mask ((__v8si)(__m256i) (X), (__v4si)(__m128i) (Y), (int) (C), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)-1))
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+#define _WCHAR_T 
+#define __HAVE_FLOAT64 1
+#define _mm256_maskz_shrdi_epi16(A,B,C,D) ((__m256i) __builtin_ia32_vpshrd_v16hi_mask ((__v16hi)(__m256i)(B), (__v16hi)(__m256i)(C),(int)(D), (__v16hi)(__m256i)_mm256_setzero_si256 (), (__mmask16)(A)))
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+#define _mm512_mask_fmsub_round_pd(A,U,B,C,R) (__m512d)__builtin_ia32_vfmsubpd512_mask(A, B, C, U, R)
+#define BIT_SET(p,m) ((p) |= (m))
+#define _mm512_mask_fmsub_round_ph(A,U,B,C,R) ((__m512h)__builtin_ia32_vfmsubph512_mask ((A), (B), (C), (U), (R)))
+#define __FLT64X_MIN_EXP__ (-16381)
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+#define SIZE_MAX (18446744073709551615UL)
+#define _mm256_mask_i64gather_epi32(SRC,BASE,INDEX,MASK,SCALE) (__m128i) __builtin_ia32_gatherdiv4si256 ((__v4si)(__m128i) (SRC), (int const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4si)(__m128i) (MASK), (int) (SCALE))
+#define PRIiLEAST32 "i"
+#define _PTRDIFF_T 
+#define _mm_mask_alignr_epi8(W,U,X,Y,N) ((__m128i) __builtin_ia32_palignr128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)((N) * 8), (__v2di)(__m128i)(X), (__mmask16)(U)))
+#define _mm512_mask3_fnmadd_round_pd(A,B,C,U,R) (__m512d)__builtin_ia32_vfnmaddpd512_mask3(A, B, C, U, R)
+#define _mm512_mask3_fnmadd_round_ph(A,B,C,U,R) ((__m512h)__builtin_ia32_vfnmaddph512_mask3 ((A), (B), (C), (U), (R)))
+#define _mm_mask_cmp_epu64_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_ucmpq128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(P), (__mmask8)(M)))
+#define PIN_MODE_UNUSED 0
+#define _mm512_i64gather_pd(INDEX,ADDR,SCALE) (__m512d) __builtin_ia32_gatherdiv8df ((__v8df)_mm512_undefined_pd(), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8)0xFF, (int) (SCALE))
+#define _mm512_mask3_fnmadd_round_ps(A,B,C,U,R) (__m512)__builtin_ia32_vfnmaddps512_mask3(A, B, C, U, R)
+#define _mm512_cvt_roundpd_epu32(A,B) ((__m256i)__builtin_ia32_cvtpd2udq512_mask(A, (__v8si)_mm256_undefined_si256(), -1, B))
+#define _mm512_maskz_rsqrt28_ps(U,A) _mm512_maskz_rsqrt28_round_ps(U, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm256_maskz_alignr_epi32(U,X,Y,C) ((__m256i)__builtin_ia32_alignd256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(C), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define __LDBL_MIN_10_EXP__ (-4931)
+#define _mm_maskz_shuffle_epi32(U,X,C) ((__m128i) __builtin_ia32_pshufd128_mask ((__v4si)(__m128i)(X), (int)(C), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm512_maskz_extractf64x4_pd(U,X,C) ((__m256d) __builtin_ia32_extractf64x4_mask ((__v8df)(__m512d) (X), (int) (C), (__v4df)(__m256d)_mm256_setzero_pd(), (__mmask8)(U)))
+#define PRIiLEAST64 __PRI64_PREFIX "i"
+#define _mm256_mask_fixupimm_pd(X,U,Y,Z,C) ((__m256d)__builtin_ia32_fixupimmpd256_mask ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (__v4di)(__m256i)(Z), (int)(C), (__mmask8)(U)))
+#define _GCC_WCHAR_T 
+#define __FLT32_MAX_EXP__ 128
+#define _mm256_mask_fixupimm_ps(X,U,Y,Z,C) ((__m256)__builtin_ia32_fixupimmps256_mask ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (__v8si)(__m256i)(Z), (int)(C), (__mmask8)(U)))
+#define _mm512_maskz_getmant_round_ph(U,X,B,C,R) ((__m512h)__builtin_ia32_getmantph512_mask ((__v32hf)(__m512h)(X), (int)(((C)<<2) | (B)), (__v32hf)(__m512h) _mm512_setzero_ph(), (__mmask32)(U), (R)))
+#define PRIiFAST8 "i"
+#define _mm256_mask_inserti32x4(W,U,X,Y,C) ((__m256i) __builtin_ia32_inserti32x4_256_mask ((__v8si)(__m256i) (X), (__v4si)(__m128i) (Y), (int) (C), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+#define _mm256_mask_i64gather_epi64(SRC,BASE,INDEX,MASK,SCALE) (__m256i) __builtin_ia32_gatherdiv4di ((__v4di)(__m256i) (SRC), (long long const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4di)(__m256i) (MASK), (int) (SCALE))
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+#define _mm512_maskz_slli_epi64(U,X,C) ((__m512i) __builtin_ia32_psllqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)_mm512_setzero_si512 (), (__mmask8)(U)))
+#define __GXX_ABI_VERSION 1017
+#define _mm512_mask_fmaddsub_round_pd(A,U,B,C,R) (__m512d)__builtin_ia32_vfmaddsubpd512_mask(A, B, C, U, R)
+#define __WTERMSIG(status) ((status) & 0x7f)
+#define _mm512_mask_fmaddsub_round_ph(A,U,B,C,R) ((__m512h)__builtin_ia32_vfmaddsubph512_mask ((A), (B), (C), (U), (R)))
+#define _mm512_cvt_roundpd_epu64(A,B) ((__m512i)__builtin_ia32_cvtpd2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), -1, (B)))
+#define _mm512_mask_fmaddsub_round_ps(A,U,B,C,R) (__m512)__builtin_ia32_vfmaddsubps512_mask(A, B, C, U, R)
+#define _mm512_mask_range_round_pd(W,U,A,B,C,R) ((__m512d) __builtin_ia32_rangepd512_mask ((__v8df)(__m512d)(A), (__v8df)(__m512d)(B), (int)(C), (__v8df)(__m512d)(W), (__mmask8)(U), (R)))
+#define _mm512_mask_sqrt_round_ph(A,B,C,D) (__builtin_ia32_sqrtph512_mask_round ((C), (A), (B), (D)))
+#define _mm256_maskz_alignr_epi64(U,X,Y,C) ((__m256i)__builtin_ia32_alignq256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(C), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define _mm512_mask_range_round_ps(W,U,A,B,C,R) ((__m512) __builtin_ia32_rangeps512_mask ((__v16sf)(__m512)(A), (__v16sf)(__m512)(B), (int)(C), (__v16sf)(__m512)(W), (__mmask16)(U), (R)))
+#define UINT_LEAST16_MAX (65535)
+#define _mm512_mask_sub_round_pd(W,U,A,B,C) (__m512d)__builtin_ia32_subpd512_mask(A, B, W, U, C)
+#define CLOCK_MONOTONIC_RAW 4
+#define _mm512_mask_sub_round_ps(W,U,A,B,C) (__m512)__builtin_ia32_subps512_mask(A, B, W, U, C)
+#define _mm512_prefetch_i32gather_pd(INDEX,ADDR,SCALE,HINT) __builtin_ia32_gatherpfdpd ((__mmask8)0xFF, (__v8si)(__m256i) (INDEX), (void const *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm256_extractf32x4_ps(X,C) ((__m128) __builtin_ia32_extractf32x4_256_mask ((__v8sf)(__m256) (X), (int) (C), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)-1))
+#define _mm512_prefetch_i32gather_ps(INDEX,ADDR,SCALE,HINT) __builtin_ia32_gatherpfdps ((__mmask16)0xFFFF, (__v16si)(__m512i) (INDEX), (void const *) (ADDR), (int) (SCALE), (int) (HINT))
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+#define _XABORT_CODE(x) (((x) >> 24) & 0xFF)
+#define COMMPORT_ERROR_FRAME 1
+#define UINT32_MAX (4294967295U)
+#define SCNx64 __PRI64_PREFIX "x"
+#define _mm_maskz_slli_epi64(U,X,C) ((__m128i)__builtin_ia32_psllqi128_mask ((__v2di)(__m128i)(X), (int)(C), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define WNOHANG 1
+#define _mm_cvt_roundss_sd(A,B,C) (__m128d)__builtin_ia32_cvtss2sd_round(A, B, C)
+#define _mm_cvt_roundss_sh(A,B,R) (__builtin_ia32_vcvtss2sh_mask_round ((B), (A), _mm_setzero_ph (), (__mmask8) -1, R))
+#define __x86_64 1
+#define _mm_fmadd_round_sd(A,B,C,R) (__m128d)__builtin_ia32_vfmaddsd3_round(A, B, C, R)
+#define _mm_fmadd_round_sh(A,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_mask ((A), (B), (C), (-1), (R)))
+#define __PTRDIFF_T 
+#define _mm_fmadd_round_ss(A,B,C,R) (__m128)__builtin_ia32_vfmaddss3_round(A, B, C, R)
+#define _mm512_add_round_pd(A,B,C) (__m512d)__builtin_ia32_addpd512_mask(A, B, (__v8df)_mm512_undefined_pd(), -1, C)
+#define _mm_broadcastsi128_si256(X) _mm256_broadcastsi128_si256(X)
+#define _mm512_add_round_ph(A,B,C) ((__m512h)__builtin_ia32_addph512_mask_round((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define _mm512_add_round_ps(A,B,C) (__m512)__builtin_ia32_addps512_mask(A, B, (__v16sf)_mm512_undefined_ps(), -1, C)
+#define TICKS_FREQ 1000000UL
+#define __HAVE_GENERIC_SELECTION 1
+#define _TMMINTRIN_H_INCLUDED 
+#define _mm_maskz_add_round_sd(U,A,B,C) (__m128d)__builtin_ia32_addsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, C)
+#define __FLT16_HAS_DENORM__ 1
+#define _MM_CMPINT_UNUSED 0x3
+#define _mm_maskz_add_round_ss(U,A,B,C) (__m128)__builtin_ia32_addss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, C)
+#define _AVX5124FMAPSINTRIN_H_INCLUDED 
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+#define _BITS_TYPES___LOCALE_T_H 1
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+#define SCNuLEAST8 "hhu"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+#define __STDC_UTF_32__ 1
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+#define _mm512_mask_fixupimm_round_pd(X,U,Y,Z,C,R) ((__m512d)__builtin_ia32_fixupimmpd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (__v8di)(__m512i)(Z), (int)(C), (__mmask8)(U), (R)))
+#define PRIx16 "x"
+#define _mm512_scalef_round_pd(A,B,C) ((__m512d) __builtin_ia32_scalefpd512_mask((A), (B), (__v8df) _mm512_undefined_pd(), -1, (C)))
+#define _mm512_scalef_round_ps(A,B,C) ((__m512) __builtin_ia32_scalefps512_mask((A), (B), (__v16sf) _mm512_undefined_ps(), -1, (C)))
+#define __SIZEOF_INT__ 4
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __SIZEOF_POINTER__ 8
+#define _XABORT_EXPLICIT (1 << 0)
+#define __WCOREFLAG 0x80
+#define PRIx32 "x"
+#define _mm256_alignr_epi8(A,B,N) ((__m256i) __builtin_ia32_palignr256 ((__v4di)(__m256i)(A), (__v4di)(__m256i)(B), (int)(N) * 8))
+#define __INT_FAST8_WIDTH__ 8
+#define _mm_test_all_ones(V) _mm_testc_si128 ((V), _mm_cmpeq_epi32 ((V), (V)))
+#define COMMPORT_TYPE_PIN 2
+#define _mm_fnmsub_round_sh(A,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_mask ((A), -(B), -(C), (-1), (R)))
+#define _mm_fnmsub_round_ss(A,B,C,R) (__m128)__builtin_ia32_vfmaddss3_round(A, -(B), -(C), R)
+#define __MODE_T_TYPE __U32_TYPE
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define _mm256_shufflehi_epi16(A,N) ((__m256i)__builtin_ia32_pshufhw256 ((__v16hi)(__m256i)(A), (int)(N)))
+#define __nonnull(params) __attribute_nonnull__ (params)
+#define _mm_shrdi_epi32(A,B,C) ((__m128i) __builtin_ia32_vpshrd_v4si ((__v4si)(__m128i)(A), (__v4si)(__m128i)(B),(int)(C)))
+#define _mm_cmp_ps_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpps128_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P), (__mmask8)-1))
+#define _mm256_permute_pd(X,C) ((__m256d) __builtin_ia32_vpermilpd256 ((__v4df)(__m256d)(X), (int)(C)))
+#define _mm256_permute_ps(X,C) ((__m256) __builtin_ia32_vpermilps256 ((__v8sf)(__m256)(X), (int)(C)))
+#define _mm256_cmp_epi32_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpd256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(P), (__mmask8)-1))
+#define _mm512_fcmul_round_pch(A,B,D) (__m512h) __builtin_ia32_vfcmulcph512_round ((A), (B), (D))
+#define _mm512_mask_cvtt_roundph_epi16(A,B,C,D) ((__m512i) __builtin_ia32_vcvttph2w512_mask_round ((C), (__v32hi)(A), (B), (D)))
+#define INT_LEAST8_MAX (127)
+#define _mm512_maskz_cvt_roundepu32_ph(A,B,C) (__builtin_ia32_vcvtudq2ph512_mask_round ((__v16si)B, _mm256_setzero_ph (), A, C))
+#define _mm512_maskz_cvt_roundepu32_ps(U,A,B) (__m512)__builtin_ia32_cvtudq2ps512_mask((__v16si)(A), (__v16sf)_mm512_setzero_ps(), U, B)
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+#define _mm512_mask_prefetch_i64scatter_pd(ADDR,MASK,INDEX,SCALE,HINT) __builtin_ia32_scatterpfqpd ((__mmask8) (MASK), (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define __CFLOAT64X _Complex _Float64x
+#define _mm512_mask_prefetch_i64scatter_ps(ADDR,MASK,INDEX,SCALE,HINT) __builtin_ia32_scatterpfqps ((__mmask8) (MASK), (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define __FLT64_MIN_10_EXP__ (-307)
+#define _mm256_mask_alignr_epi8(W,U,X,Y,N) ((__m256i) __builtin_ia32_palignr256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)((N) * 8), (__v4di)(__m256i)(X), (__mmask32)(U)))
+#define _mm512_mul_round_pd(A,B,C) (__m512d)__builtin_ia32_mulpd512_mask(A, B, (__v8df)_mm512_undefined_pd(), -1, C)
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+#define _mm512_mul_round_ps(A,B,C) (__m512)__builtin_ia32_mulps512_mask(A, B, (__v16sf)_mm512_undefined_ps(), -1, C)
+#define __AVX512VBMI2INTRIN_H_INCLUDED 
+#define _mm_maskz_mul_round_sd(U,A,B,C) (__m128d)__builtin_ia32_mulsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, C)
+#define _mm_maskz_mul_round_sh(A,B,C,D) ((__m128h)__builtin_ia32_mulsh_mask_round ((B), (C), _mm_setzero_ph (), (A), (D)))
+#define _mm512_mask_cvtt_roundph_epi32(A,B,C,D) ((__m512i) __builtin_ia32_vcvttph2dq512_mask_round ((C), (__v16si)(A), (B), (D)))
+#define _mm_maskz_mul_round_ss(U,A,B,C) (__m128)__builtin_ia32_mulss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, C)
+#define _mm256_mask_cmp_epi8_mask(M,X,Y,P) ((__mmask32) __builtin_ia32_cmpb256_mask ((__v32qi)(__m256i)(X), (__v32qi)(__m256i)(Y), (int)(P), (__mmask32)(M)))
+#define _mm512_mask_rcp28_round_pd(W,U,A,C) __builtin_ia32_rcp28pd_mask(A, W, U, C)
+#define _tile_loadd(dst,base,stride) _tile_loadd_internal (dst, base, stride)
+#define __FLT64X_DECIMAL_DIG__ 21
+#define _mm512_maskz_cmul_round_pch(U,A,B,R) _mm512_maskz_fcmul_round_pch ((U), (A), (B), (R))
+#define _mm512_shuffle_pd(X,Y,C) ((__m512d)__builtin_ia32_shufpd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(C), (__v8df)(__m512d)_mm512_undefined_pd(), (__mmask8)-1))
+#define __DEC128_MIN__ 1E-6143DL
+#define _mm256_mpsadbw_epu8(X,Y,M) ((__m256i) __builtin_ia32_mpsadbw256 ((__v32qi)(__m256i)(X), (__v32qi)(__m256i)(Y), (int)(M)))
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define _mm512_shldi_epi16(A,B,C) ((__m512i) __builtin_ia32_vpshld_v32hi ((__v32hi)(__m512i)(A), (__v32hi)(__m512i)(B),(int)(C)))
+#define _mm512_mask_prefetch_i64gather_ps(INDEX,MASK,ADDR,SCALE,HINT) __builtin_ia32_gatherpfqps ((__mmask8) (MASK), (__v8di)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define __DBL_HAS_DENORM__ 1
+#define INT_LEAST32_MAX (2147483647)
+#define SCNoFAST8 "hho"
+#define _mm512_cvtt_roundph_epi16(A,B) ((__m512i) __builtin_ia32_vcvttph2w512_mask_round ((A), (__v32hi) _mm512_setzero_si512 (), (__mmask32)-1, (B)))
+#define _mm512_mask_reduce_pd(W,U,A,B) ((__m512d) __builtin_ia32_reducepd512_mask ((__v8df)(__m512d)(A), (int)(B), (__v8df)(__m512d)(W), (__mmask8)(U)))
+#define _mm512_mask_reduce_ph(A,B,C,D) (__builtin_ia32_reduceph512_mask_round ((C), (D), (A), (B), _MM_FROUND_CUR_DIRECTION))
+#define __enclu_eexit(leaf,b,c,retval) __asm__ __volatile__("enclu\n\t" : "=a" (retval), "=c" (c) : "a" (leaf), "b" (b) : "cc")
+#define _mm512_mask_reduce_ps(W,U,A,B) ((__m512) __builtin_ia32_reduceps512_mask ((__v16sf)(__m512)(A), (int)(B), (__v16sf)(__m512)(W), (__mmask16)(U)))
+#define __attribute_pure__ __attribute__ ((__pure__))
+#define _mm_mask_sub_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_subsd_mask_round(A, B, W, U, C)
+#define _mm_cmp_epu32_mask(X,Y,P) ((__mmask8) __builtin_ia32_ucmpd128_mask ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(P), (__mmask8)-1))
+#define _mm_mask_sub_round_sh(A,B,C,D,E) ((__m128h)__builtin_ia32_subsh_mask_round ((C), (D), (A), (B), (E)))
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+#define _mm_mask_sub_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_subss_mask_round(A, B, W, U, C)
+#define _mm512_fcmadd_round_pch(A,B,C,D) (__m512h) __builtin_ia32_vfcmaddcph512_round ((A), (B), (C), (D))
+#define _mm512_mask_fnmadd_round_ps(A,U,B,C,R) (__m512)__builtin_ia32_vfnmaddps512_mask(A, B, C, U, R)
+#define _mm512_mask_cvtt_roundph_epi64(A,B,C,D) __builtin_ia32_vcvttph2qq512_mask_round ((C), (A), (B), (D))
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+#define __UINT8_TYPE__ unsigned char
+#define _mm256_mask_slli_epi16(W,U,X,C) ((__m256i)__builtin_ia32_psllwi256_mask ((__v16hi)(__m256i)(X), (int)(C), (__v16hi)(__m256i)(W), (__mmask16)(U)))
+#define _mm256_blend_epi32(X,Y,M) ((__m256i) __builtin_ia32_pblendd256 ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(M)))
+#define _mm256_i32gather_epi32(BASE,INDEX,SCALE) (__m256i) __builtin_ia32_gathersiv8si ((__v8si) _mm256_setzero_si256 (), (int const *) (BASE), (__v8si)(__m256i) (INDEX), (__v8si)_mm256_set1_epi32 (-1), (int) (SCALE))
+#define __NO_INLINE__ 1
+#define _mm_cvtt_roundsd_si32(A,B) ((int)__builtin_ia32_vcvttsd2si32(A, B))
+#define _mm256_maskz_roundscale_ph(A,B,C) (__builtin_ia32_rndscaleph256_mask ((B), (C), _mm256_setzero_ph (), (A)))
+#define _m_pinsrw(A,D,N) _mm_insert_pi16(A, D, N)
+#define _mm512_maskz_getmant_pd(U,X,B,C) ((__m512d)__builtin_ia32_getmantpd512_mask ((__v8df)(__m512d)(X), (int)(((C)<<2) | (B)), (__v8df)_mm512_setzero_pd(), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_maskz_getmant_ph(U,X,B,C) ((__m512h)__builtin_ia32_getmantph512_mask ((__v32hf)(__m512h)(X), (int)(((C)<<2) | (B)), (__v32hf)(__m512h) _mm512_setzero_ph(), (__mmask32)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm_maskz_getmant_pd(U,X,B,C) ((__m128d) __builtin_ia32_getmantpd128_mask ((__v2df)(__m128d) (X), (int)(((C)<<2) | (B)), (__v2df)(__m128d)_mm_setzero_pd (), (__mmask8)(U)))
+#define _mm_maskz_getmant_ph(U,X,B,C) ((__m128h) __builtin_ia32_getmantph128_mask ((__v8hf)(__m128h) (X), (int)(((C)<<2) | (B)), (__v8hf)(__m128h)_mm_setzero_ph (), (__mmask8)(U)))
+#define _mm512_maskz_getmant_ps(U,X,B,C) ((__m512)__builtin_ia32_getmantps512_mask ((__v16sf)(__m512)(X), (int)(((C)<<2) | (B)), (__v16sf)_mm512_setzero_ps(), (__mmask16)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm256_maskz_shrdi_epi64(A,B,C,D) ((__m256i) __builtin_ia32_vpshrd_v4di_mask ((__v4di)(__m256i)(B), (__v4di)(__m256i)(C),(int)(D), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)(A)))
+#define _mm512_mask_i64gather_epi32(V1OLD,MASK,INDEX,ADDR,SCALE) (__m256i) __builtin_ia32_gatherdiv16si ((__v8si)(__m256i) (V1OLD), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm_maskz_range_pd(U,A,B,C) ((__m128d) __builtin_ia32_rangepd128_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)_mm_setzero_pd(), (__mmask8)(U)))
+#define _mm_maskz_getmant_ps(U,X,B,C) ((__m128) __builtin_ia32_getmantps128_mask ((__v4sf)(__m128) (X), (int)(((C)<<2) | (B)), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)(U)))
+#define _mm_maskz_range_ps(U,A,B,C) ((__m128) __builtin_ia32_rangeps128_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)_mm_setzero_ps(), (__mmask8)(U)))
+#define _mm_cmul_sch(A,B) _mm_fcmul_sch ((A), (B))
+#define _mm256_mask_slli_epi32(W,U,X,C) ((__m256i)__builtin_ia32_pslldi256_mask ((__v8si)(__m256i)(X), (int)(C), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define _SIZE_T 
+#define __isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))
+#define _mm256_floor_pd(V) _mm256_round_pd ((V), _MM_FROUND_FLOOR)
+#define _mm512_shldi_epi64(A,B,C) ((__m512i) __builtin_ia32_vpshld_v8di ((__v8di)(__m512i)(A), (__v8di)(__m512i)(B), (int)(C)))
+#define INT_LEAST8_MIN (-128)
+#define _MM_FROUND_CEIL (_MM_FROUND_TO_POS_INF | _MM_FROUND_RAISE_EXC)
+#define _mm512_cmp_pd_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmppd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(P), (__mmask8)-1,_MM_FROUND_CUR_DIRECTION))
+#define _mm512_maskz_reduce_round_pd(U,A,B,R) ((__m512d) __builtin_ia32_reducepd512_mask_round ((__v8df)(__m512d)(A), (int)(B), (__v8df)_mm512_setzero_pd (), (U), (R)))
+#define PIN_MODE_DEBOUNCE 10
+#define _mm_cvt_roundsh_sd(A,B,R) (__builtin_ia32_vcvtsh2sd_mask_round ((B), (A), _mm_setzero_pd (), (__mmask8) -1, (R)))
+#define GPIO_PIN(port,pin) (((port) << 4) | (pin))
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+#define _mm_cvtt_roundsd_si64(A,B) ((long long)__builtin_ia32_vcvttsd2si64(A, B))
+#define _PTRDIFF_T_ 
+#define _mm512_mask_i64gather_epi64(V1OLD,MASK,INDEX,ADDR,SCALE) (__m512i) __builtin_ia32_gatherdiv8di ((__v8di)(__m512i) (V1OLD), (void const *) (ADDR), (__v8di)(__m512i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm_maskz_getmant_ss(U,X,Y,C,D) ((__m128)__builtin_ia32_getmantss_mask_round ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(((D)<<2) | (C)), (__v4sf)_mm_setzero_ps(), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define SCNi16 "hi"
+#define _mm_maskz_range_ss(U,A,B,C) ((__m128) __builtin_ia32_rangess128_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf) _mm_setzero_ps (), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm_mask_cmp_round_sh_mask(A,B,C,D,E) (__builtin_ia32_cmpsh_mask_round ((B), (C), (D), (A), (E)))
+#define _mm256_mask_slli_epi64(W,U,X,C) ((__m256i)__builtin_ia32_psllqi256_mask ((__v4di)(__m256i)(X), (int)(C), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define ___int_size_t_h 
+#define _mm512_mask_i32scatter_pd(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv8df ((void *) (ADDR), (__mmask8) (MASK), (__v8si)(__m256i) (INDEX), (__v8df)(__m512d) (V1), (int) (SCALE))
+#define INT_LEAST32_MIN (-2147483647-1)
+#define __ssize_t_defined 
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+#define _mm_maskz_rol_epi32(U,A,B) ((__m128i)__builtin_ia32_prold128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define UINTMAX_C(c) c ## UL
+#define __USE_XOPEN2K8 1
+#define __USE_MISC 1
+#define _mm_gf2p8affineinv_epi64_epi8(A,B,C) ((__m128i) __builtin_ia32_vgf2p8affineinvqb_v16qi((__v16qi)(__m128i)(A), (__v16qi)(__m128i)(B), (int)(C)))
+#define SCNi32 "i"
+#define _mm_cvt_roundsd_si32(A,B) ((int)__builtin_ia32_vcvtsd2si32(A, B))
+#define _mm512_mask_insertf32x4(A,B,X,Y,C) ((__m512) __builtin_ia32_insertf32x4_mask ((__v16sf)(__m512) (X), (__v4sf)(__m128) (Y), (int) (C), (__v16sf)(__m512) (A), (__mmask16)(B)))
+#define _mm512_mask_insertf32x8(W,U,X,Y,C) ((__m512) __builtin_ia32_insertf32x8_mask ((__v16sf)(__m512) (X), (__v8sf)(__m256) (Y), (int) (C), (__v16sf)(__m512)(W), (__mmask16)(U)))
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+#define _mm512_div_round_pd(A,B,C) (__m512d)__builtin_ia32_divpd512_mask(A, B, (__v8df)_mm512_undefined_pd(), -1, C)
+#define _mm512_div_round_ph(A,B,C) ((__m512h)__builtin_ia32_divph512_mask_round((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define __UQUAD_TYPE unsigned long int
+#define _mm512_div_round_ps(A,B,C) (__m512)__builtin_ia32_divps512_mask(A, B, (__v16sf)_mm512_undefined_ps(), -1, C)
+#define _mm_maskz_div_round_sd(U,A,B,C) (__m128d)__builtin_ia32_divsd_mask_round(A, B, (__v2df)_mm_setzero_pd(), U, C)
+#define _mm_maskz_div_round_sh(A,B,C,D) ((__m128h)__builtin_ia32_divsh_mask_round ((B), (C), _mm_setzero_ph (), (A), (D)))
+#define _mm512_maskz_shuffle_i64x2(U,X,Y,C) ((__m512i) __builtin_ia32_shuf_i64x2_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(C), (__v8di)(__m512i)_mm512_setzero_si512 (), (__mmask8)(U)))
+#define _mm_maskz_div_round_ss(U,A,B,C) (__m128)__builtin_ia32_divss_mask_round(A, B, (__v4sf)_mm_setzero_ps(), U, C)
+#define _PMMINTRIN_H_INCLUDED 
+#define _mm_maskz_rol_epi64(U,A,B) ((__m128i)__builtin_ia32_prolq128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define _mm512_maskz_srli_epi16(U,A,B) ((__m512i) __builtin_ia32_psrlwi512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)_mm512_setzero_si512 (), (__mmask32)(U)))
+#define _mm_maskz_srli_epi16(U,A,B) ((__m128i) __builtin_ia32_psrlwi128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)_mm_setzero_si128(), (__mmask8)(U)))
+#define _mm_maskz_shrdi_epi16(A,B,C,D) ((__m128i) __builtin_ia32_vpshrd_v8hi_mask ((__v8hi)(__m128i)(B), (__v8hi)(__m128i)(C),(int)(D), (__v8hi)(__m128i)_mm_setzero_si128 (), (__mmask8)(A)))
+#define __UWORD_TYPE unsigned long int
+#define SCNi64 __PRI64_PREFIX "i"
+#define _mm512_mask_cvtt_roundpd_epi64(W,U,A,B) ((__m512i)__builtin_ia32_cvttpd2qq512_mask ((A), (__v8di)(W), (U), (B)))
+#define _mm_cvt_roundsd_si64(A,B) ((long long)__builtin_ia32_vcvtsd2si64(A, B))
+#define _mm_mask3_fcmadd_round_sch(A,B,C,D,E) ((__m128h) __builtin_ia32_vfcmaddcsh_mask3_round ((__v8hf) (A), (__v8hf) (B), (__v8hf) (C), (D), (E)))
+#define __struct_tm_defined 1
+#define __LDBL_DECIMAL_DIG__ 21
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+#define _mm256_bsrli_epi128(A,N) ((__m256i)__builtin_ia32_psrldqi256 ((__m256i)(A), (int)(N) * 8))
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+#define _mm512_mask_cvtt_roundph_epu16(A,B,C,D) ((__m512i) __builtin_ia32_vcvttph2uw512_mask_round ((C), (__v32hi)(A), (B), (D)))
+#define _mm512_maskz_srli_epi32(U,X,C) ((__m512i) __builtin_ia32_psrldi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _mm_maskz_srli_epi32(U,A,B) ((__m128i) __builtin_ia32_psrldi128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm_cvtt_roundsh_u64(A,B) ((long long)__builtin_ia32_vcvttsh2usi64_round ((A), (B)))
+#define _mm512_cvtx_roundps_ph(A,B) (__builtin_ia32_vcvtps2phx512_mask_round ((__v16sf)(A), _mm256_setzero_ph (), (__mmask16)-1, (B)))
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define __BYTE_ORDER __LITTLE_ENDIAN
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+#define _MM_EXCEPT_DENORM 0x0002
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define _mm512_maskz_srai_epi16(U,A,B) ((__m512i) __builtin_ia32_psrawi512_mask ((__v32hi)(__m512i)(A), (int)(B), (__v32hi)_mm512_setzero_si512 (), (__mmask32)(U)))
+#define SCNoPTR __PRIPTR_PREFIX "o"
+#define _MM_MASK_OVERFLOW 0x0400
+#define _mm_scalef_round_sh(A,B,C) (__builtin_ia32_scalefsh_mask_round ((A), (B), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define _mm512_mask_extractf64x4_pd(W,U,X,C) ((__m256d) __builtin_ia32_extractf64x4_mask ((__v8df)(__m512d) (X), (int) (C), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define _SIDD_UBYTE_OPS 0x00
+#define _mm_mask_shuffle_pd(W,U,A,B,C) ((__m128d)__builtin_ia32_shufpd128_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)(__m128d)(W), (__mmask8)(U)))
+#define _mm512_cvtt_roundpd_epu32(A,B) ((__m256i)__builtin_ia32_cvttpd2udq512_mask(A, (__v8si)_mm256_undefined_si256(), -1, B))
+#define _mm_mask_shuffle_ps(W,U,A,B,C) ((__m128) __builtin_ia32_shufps128_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define SIG_ATOMIC_MAX (2147483647)
+#define _mm_sqrt_round_sd(A,B,C) (__m128d)__builtin_ia32_sqrtsd_mask_round (B, A, (__v2df) _mm_setzero_pd (), -1, C)
+#define __nlink_t_defined 
+#define _MM_ROUND_UP 0x4000
+#define _mm512_sqrt_round_ps(A,C) (__m512)__builtin_ia32_sqrtps512_mask(A, (__v16sf)_mm512_undefined_ps(), -1, C)
+#define _mm512_maskz_srai_epi32(U,X,C) ((__m512i) __builtin_ia32_psradi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _mm512_maskz_srli_epi64(U,X,C) ((__m512i) __builtin_ia32_psrlqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)_mm512_setzero_si512 (), (__mmask8)(U)))
+#define _mm_maskz_srai_epi32(U,A,B) ((__m128i) __builtin_ia32_psradi128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm_fpclass_pd_mask(X,C) ((__mmask8) __builtin_ia32_fpclasspd128_mask ((__v2df) (__m128d) (X), (int) (C),(__mmask8)-1))
+#define _mm_maskz_srli_epi64(U,A,B) ((__m128i) __builtin_ia32_psrlqi128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm512_permute_pd(X,C) ((__m512d) __builtin_ia32_vpermilpd512_mask ((__v8df)(__m512d)(X), (int)(C), (__v8df)(__m512d)_mm512_undefined_pd(), (__mmask8)(-1)))
+#define _mm512_maskz_fmsub_round_pd(U,A,B,C,R) (__m512d)__builtin_ia32_vfmsubpd512_maskz(A, B, C, U, R)
+#define _mm512_maskz_fmsub_round_ph(U,A,B,C,R) ((__m512h)__builtin_ia32_vfmsubph512_maskz ((A), (B), (C), (U), (R)))
+#define INT32_MAX (2147483647)
+#define _mm_maskz_max_round_sh(A,B,C,D) (__builtin_ia32_maxsh_mask_round ((B), (C), _mm_setzero_ph (), (A), (D)))
+#define _cvtss_sh(__F,__I) (__extension__ ({ __v4sf __A = __extension__ (__v4sf){ __F, 0, 0, 0 }; __v8hi __H = __builtin_ia32_vcvtps2ph (__A, __I); (unsigned short) __builtin_ia32_vec_ext_v8hi (__H, 0); }))
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define SYSTEM_RESET_TOTAL 3
+#define _mm512_mask_cvt_roundph_epu16(A,B,C,D) ((__m512i) __builtin_ia32_vcvtph2uw512_mask_round ((C), (__v32hi)(A), (B), (D)))
+#define __STDC_IEC_559_COMPLEX__ 1
+#define _MM_MASK_INEXACT 0x1000
+#define _mm512_setr_epi32(e0,e1,e2,e3,e4,e5,e6,e7,e8,e9,e10,e11,e12,e13,e14,e15) _mm512_set_epi32(e15,e14,e13,e12,e11,e10,e9,e8,e7,e6,e5,e4,e3,e2,e1,e0)
+#define BITLONG(x) ((uint32_t)0x00000001 << (x))
+#define _mm_add_round_sh(A,B,C) ((__m128h)__builtin_ia32_addsh_mask_round ((A), (B), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define _mm256_mask_roundscale_pd(W,U,A,B) ((__m256d) __builtin_ia32_rndscalepd_256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define _mm256_mask_roundscale_ph(A,B,C,D) (__builtin_ia32_rndscaleph256_mask ((C), (D), (A), (B)))
+#define _mm256_mask_shuffle_f64x2(W,U,X,Y,C) ((__m256d) __builtin_ia32_shuf_f64x2_256_mask ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(C), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define __encls_bc(leaf,b,c,retval) __asm__ __volatile__ ("encls\n\t" : "=a" (retval) : "a" (leaf), "b" (b), "c" (c) : "cc")
+#define _mm256_mask_roundscale_ps(W,U,A,B) ((__m256) __builtin_ia32_rndscaleps_256_mask ((__v8sf)(__m256)(A), (int)(B), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _FMA4INTRIN_H_INCLUDED 
+#define _mm512_maskz_srai_epi64(U,X,C) ((__m512i) __builtin_ia32_psraqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)_mm512_setzero_si512 (), (__mmask8)(U)))
+#define COMMPORT_ERROR_PARITY 3
+#define _mm_maskz_srai_epi64(U,A,B) ((__m128i) __builtin_ia32_psraqi128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)_mm_setzero_si128 (), (__mmask8)(U)))
+#define __FLT128_DIG__ 33
+#define __SCHAR_WIDTH__ 8
+#define SCNiLEAST8 "hhi"
+#define __DEC128_MIN_EXP__ (-6142)
+#define _CMP_NLT_US 0x05
+#define _mm_round_pd(V,M) ((__m128d) __builtin_ia32_roundpd ((__v2df)(__m128d)(V), (int)(M)))
+#define _CLDEMOTE_H_INCLUDED 
+#define WEXITED 4
+#define __FLT32_MAX_10_EXP__ 38
+#define _mm_maskz_roundscale_round_sd(U,A,B,I,R) ((__m128d) __builtin_ia32_rndscalesd_mask_round ((__v2df) (__m128d) (A), (__v2df) (__m128d) (B), (int) (I), (__v2df) _mm_setzero_pd (), (__mmask8) (U), (int) (R)))
+#define _mm512_maskz_range_round_pd(U,A,B,C,R) ((__m512d) __builtin_ia32_rangepd512_mask ((__v8df)(__m512d)(A), (__v8df)(__m512d)(B), (int)(C), (__v8df)_mm512_setzero_pd (), (__mmask8)(U), (R)))
+#define _mm_maskz_roundscale_round_ss(U,A,B,I,R) ((__m128) __builtin_ia32_rndscaless_mask_round ((__v4sf) (__m128) (A), (__v4sf) (__m128) (B), (int) (I), (__v4sf) _mm_setzero_ps (), (__mmask8) (U), (int) (R)))
+#define _mm512_maskz_range_round_ps(U,A,B,C,R) ((__m512) __builtin_ia32_rangeps512_mask ((__v16sf)(__m512)(A), (__v16sf)(__m512)(B), (int)(C), (__v16sf)_mm512_setzero_ps (), (__mmask16)(U), (R)))
+#define _mm_mask3_fmsub_round_sh(A,B,C,U,R) ((__m128h) __builtin_ia32_vfmsubsh3_mask3 ((A), (B), (C), (U), (R)))
+#define _mm_mask_shrdi_epi32(A,B,C,D,E) ((__m128i) __builtin_ia32_vpshrd_v4si_mask ((__v4si)(__m128i)(C), (__v4si)(__m128i)(D), (int)(E), (__v4si)(__m128i)(A), (__mmask8)(B)))
+#define _mm512_mask_shuffle_epi32(W,U,X,C) ((__m512i) __builtin_ia32_pshufd512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define __INT_FAST32_TYPE__ long int
+#define _mm512_cvt_roundpd_ph(A,B) (__builtin_ia32_vcvtpd2ph512_mask_round ((__v8df)(A), _mm_setzero_ph (), (__mmask8)-1, (B)))
+#define _mm512_cvt_roundpd_ps(A,B) (__m256)__builtin_ia32_cvtpd2ps512_mask(A, (__v8sf)_mm256_undefined_ps(), -1, B)
+#define _mm_mask_mul_sch(W,U,A,B) _mm_mask_fmul_sch ((W), (U), (A), (B))
+#define __FLT64_IS_IEC_60559__ 2
+#define _mm_extract_epi8(X,N) ((int) (unsigned char) __builtin_ia32_vec_ext_v16qi ((__v16qi)(__m128i)(X), (int)(N)))
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define _mm_mask_fnmsub_round_sd(A,U,B,C,R) (__m128d) __builtin_ia32_vfmaddsd3_mask (A, -(B), -(C), U, R)
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+#define _mm_mask_fnmsub_round_sh(A,U,B,C,R) ((__m128h) __builtin_ia32_vfmaddsh3_mask ((A), -(B), -(C), (U), (R)))
+#define COMMPORT_TYPE_NULL 0
+#define _mm_cmp_sh_mask(A,B,C) (__builtin_ia32_cmpsh_mask_round ((A), (B), (C), (-1), (_MM_FROUND_CUR_DIRECTION)))
+#define _mm_mask_fnmsub_round_ss(A,U,B,C,R) (__m128) __builtin_ia32_vfmaddss3_mask (A, -(B), -(C), U, R)
+#define _mm512_maskz_permutex_pd(U,X,M) ((__m512d) __builtin_ia32_permdf512_mask ((__v8df)(__m512d)(X), (int)(M), (__v8df)(__m512d)_mm512_setzero_pd(), (__mmask8)(U)))
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+#define _mm256_mask_cmp_epi16_mask(M,X,Y,P) ((__mmask16) __builtin_ia32_cmpw256_mask ((__v16hi)(__m256i)(X), (__v16hi)(__m256i)(Y), (int)(P), (__mmask16)(M)))
+#define INT32_MIN (-2147483647-1)
+#define _mm512_cvt_roundepi16_ph(A,B) (__builtin_ia32_vcvtw2ph512_mask_round ((__v32hi)(A), _mm512_setzero_ph (), (__mmask32)-1, (B)))
+#define POINTER_SIZE 8
+#define _MOVDIRINTRIN_H_INCLUDED 
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+#define _CMP_GT_OQ 0x1e
+#define _CMP_GT_OS 0x0e
+#define _mm_mask_cmp_sh_mask(A,B,C,D) (__builtin_ia32_cmpsh_mask_round ((B), (C), (D), (A), (_MM_FROUND_CUR_DIRECTION)))
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+#define _mm_fmadd_round_sch(A,B,C,D) __builtin_ia32_vfmaddcsh_round ((A), (B), (C), (D))
+#define __FLT64X_DIG__ 18
+#define __INT8_TYPE__ signed char
+#define _mm_roti_epi8(A,N) ((__m128i) __builtin_ia32_vprotbi ((__v16qi)(__m128i)(A), (int)(N)))
+#define __BIG_ENDIAN 4321
+#define _kshiftri_mask32(X,Y) ((__mmask32) __builtin_ia32_kshiftrisi ((__mmask32)(X), (__mmask8)(Y)))
+#define __ELF__ 1
+#define _mm512_reduce_ps(A,B) ((__m512) __builtin_ia32_reduceps512_mask ((__v16sf)(__m512)(A), (int)(B), (__v16sf)_mm512_setzero_ps (), (__mmask16)-1))
+#define _SIDD_NEGATIVE_POLARITY 0x10
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+#define _mm_mask_div_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_divss_mask_round(A, B, W, U, C)
+#define PRIxMAX __PRI64_PREFIX "x"
+#define _mm_mask_cmp_epi64_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmpq128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(P), (__mmask8)(M)))
+#define __ID_T_TYPE __U32_TYPE
+#define _MM_SHUFFLE(fp3,fp2,fp1,fp0) (((fp3) << 6) | ((fp2) << 4) | ((fp1) << 2) | (fp0))
+#define _tile_int8_dp_internal(name,dst,src1,src2) __asm__ volatile ("{"#name"\t%%tmm"#src2", %%tmm"#src1", %%tmm"#dst"|"#name"\t%%tmm"#dst", %%tmm"#src1", %%tmm"#src2"}" ::)
+#define _mm512_mask_mul_round_ph(A,B,C,D,E) ((__m512h)__builtin_ia32_mulph512_mask_round((C), (D), (A), (B), (E)))
+#define RX_BUFFER_MASK ( RX_BUFFER_SIZE - 1 )
+#define __FLT_RADIX__ 2
+#define __INT_LEAST16_TYPE__ short int
+#define _MWAITXINTRIN_H_INCLUDED 
+#define _mm256_maskz_getmant_ps(U,X,B,C) ((__m256) __builtin_ia32_getmantps256_mask ((__v8sf)(__m256) (X), (int)(((C)<<2) | (B)), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)(U)))
+#define SCNdPTR __PRIPTR_PREFIX "d"
+#define _kshiftli_mask8(X,Y) ((__mmask8) __builtin_ia32_kshiftliqi ((__mmask8)(X), (__mmask8)(Y)))
+#define _mm_dpwssds_epi32(A,B,C) ((__m128i) __builtin_ia32_vpdpwssds_v4si ((__v4si) (A), (__v4si) (B), (__v4si) (C)))
+#define _mm512_mask_extracti64x2_epi64(W,U,X,C) ((__m128i) __builtin_ia32_extracti64x2_512_mask ((__v8di)(__m512i) (X), (int) (C), (__v2di)(__m128i) (W), (__mmask8) (U)))
+#define _mm256_fpclass_ps_mask(X,C) ((__mmask8) __builtin_ia32_fpclassps256_mask ((__v8sf) (__m256) (X), (int) (C),(__mmask8)-1))
+#define _mm256_insertf32x4(X,Y,C) ((__m256) __builtin_ia32_insertf32x4_256_mask ((__v8sf)(__m256) (X), (__v4sf)(__m128) (Y), (int) (C), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)-1))
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+#define _mm_ror_epi64(A,B) ((__m128i)__builtin_ia32_prorq128_mask ((__v2di)(__m128i)(A), (int)(B), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)-1))
+#define SCNx16 "hx"
+#define _mm512_mask3_fmadd_round_pd(A,B,C,U,R) (__m512d)__builtin_ia32_vfmaddpd512_mask3(A, B, C, U, R)
+#define _mm_mask_i64scatter_pd(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv2df ((void *) (ADDR), (__mmask8) (MASK), (__v2di)(__m128i) (INDEX), (__v2df)(__m128d) (V1), (int) (SCALE))
+#define _mm256_maskz_roundscale_pd(U,A,B) ((__m256d) __builtin_ia32_rndscalepd_256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)(__m256d)_mm256_setzero_pd (), (__mmask8)(U)))
+#define _mm256_maskz_shuffle_f64x2(U,X,Y,C) ((__m256d) __builtin_ia32_shuf_f64x2_256_mask ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(C), (__v4df)(__m256d)_mm256_setzero_pd( ), (__mmask8)(U)))
+#define _mm512_mask3_fmadd_round_ps(A,B,C,U,R) (__m512)__builtin_ia32_vfmaddps512_mask3(A, B, C, U, R)
+#define _mm_mask_i64scatter_ps(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4sf ((void *) (ADDR), (__mmask8) (MASK), (__v2di)(__m128i) (INDEX), (__v4sf)(__m128) (V1), (int) (SCALE))
+#define _mm256_maskz_roundscale_ps(U,A,B) ((__m256) __builtin_ia32_rndscaleps_256_mask ((__v8sf)(__m256)(A), (int)(B), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)(U)))
+#define _AVX5124VNNIWINTRIN_H_INCLUDED 
+#define SCNxLEAST32 "x"
+#define PWM_MAX_RESOLUTION 8
+#define INTMAX_C(c) c ## L
+#define __f32(x) x ##f32
+#define _mm256_getmant_ph(X,B,C) ((__m256h) __builtin_ia32_getmantph256_mask ((__v16hf)(__m256h) (X), (int)(((C)<<2) | (B)), (__v16hf)(__m256h)_mm256_setzero_ph (), (__mmask16)-1))
+#define _mm512_mask_roundscale_round_pd(A,B,C,D,R) ((__m512d) __builtin_ia32_rndscalepd_mask ((__v8df)(__m512d)(C), (int)(D), (__v8df)(__m512d)(A), (__mmask8)(B), R))
+#define _mm512_maskz_rcp28_round_pd(U,A,C) __builtin_ia32_rcp28pd_mask(A, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm512_mask_roundscale_round_ph(A,B,C,D,E) (__builtin_ia32_rndscaleph512_mask_round ((C), (D), (A), (B), (E)))
+#define _mm512_mask_roundscale_round_ps(A,B,C,D,R) ((__m512) __builtin_ia32_rndscaleps_mask ((__v16sf)(__m512)(C), (int)(D), (__v16sf)(__m512)(A), (__mmask16)(B), R))
+#define _mm512_maskz_rcp28_round_ps(U,A,C) __builtin_ia32_rcp28ps_mask(A, (__v16sf)_mm512_setzero_ps(), U, C)
+#define SCNx32 "x"
+#define _mm512_mask_cmp_round_ps_mask(M,X,Y,P,R) ((__mmask16) __builtin_ia32_cmpps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(P), (__mmask16)(M), R))
+#define __SIZEOF_PTHREAD_COND_T 48
+#define SEEK_SET 0
+#define _mm256_mask_shrdi_epi32(A,B,C,D,E) ((__m256i) __builtin_ia32_vpshrd_v8si_mask ((__v8si)(__m256i)(C), (__v8si)(__m256i)(D), (int)(E), (__v8si)(__m256i)(A), (__mmask8)(B)))
+#define _mm256_mask_insertf32x4(W,U,X,Y,C) ((__m256) __builtin_ia32_insertf32x4_256_mask ((__v8sf)(__m256) (X), (__v4sf)(__m128) (Y), (int) (C), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _mm512_mask_reduce_round_pd(W,U,A,B,R) ((__m512d) __builtin_ia32_reducepd512_mask_round ((__v8df)(__m512d)(A), (int)(B), (__v8df)(__m512d)(W), (U), (R)))
+#define SCNxLEAST64 __PRI64_PREFIX "x"
+#define _mm512_mask_reduce_round_ps(W,U,A,B,R) ((__m512) __builtin_ia32_reduceps512_mask_round ((__v16sf)(__m512)(A), (int)(B), (__v16sf)(__m512)(W), (U), (R)))
+#define _mm512_maskz_mul_pch(U,A,B) _mm512_maskz_fmul_pch ((U), (A), (B))
+#define __f64(x) x ##f64
+#define _mm512_cmp_epi64_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpq512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(P), (__mmask8)-1))
+#define CLOCK_REALTIME_COARSE 5
+#define _MM_ROUND_DOWN 0x2000
+#define __FLT32X_MANT_DIG__ 53
+#define CLOCK_TAI 11
+#define _mm_sub_round_sh(A,B,C) ((__m128h)__builtin_ia32_subsh_mask_round ((A), (B), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define __restrict_arr __restrict
+#define _mm_rcp28_sd(A,B) __builtin_ia32_rcp28sd_round(B, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm_rcp28_ss(A,B) __builtin_ia32_rcp28ss_round(B, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm256_maskz_srli_epi16(U,A,B) ((__m256i) __builtin_ia32_psrlwi256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)_mm256_setzero_si256 (), (__mmask16)(U)))
+#define _MM_PICK_OUT_PS(X,N) _mm_insert_ps (_mm_setzero_ps (), (X), _MM_MK_INSERTPS_NDX ((N), 0, 0x0e))
+#define _MM_MASK_DENORM 0x0100
+#define __x86_64__ 1
+#define _SIZE_T_ 
+#define _SIDD_MASKED_NEGATIVE_POLARITY 0x30
+#define __FLT16_IS_IEC_60559__ 2
+#define __FLT16_MAX_EXP__ 16
+#define _mm256_maskz_gf2p8affine_epi64_epi8(A,B,C,D) ((__m256i) __builtin_ia32_vgf2p8affineqb_v32qi_mask((__v32qi)(__m256i)(B), (__v32qi)(__m256i)(C), (int)(D), (__v32qi)(__m256i) _mm256_setzero_si256 (), (__mmask32)(A)))
+#define UINT_FAST32_MAX (18446744073709551615UL)
+#define _WCHAR_T_H 
+#define _mm_max_round_sh(A,B,C) (__builtin_ia32_maxsh_mask_round ((A), (B), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define _mm_extracti_si64(X,I,L) ((__m128i) __builtin_ia32_extrqi ((__v2di)(__m128i)(X), (unsigned int)(I), (unsigned int)(L)))
+#define _mm256_maskz_srli_epi32(U,A,B) ((__m256i) __builtin_ia32_psrldi256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define _bswap(a) __bswapd(a)
+#define __stub_revoke 
+#define _mm_maskz_srai_epi16(U,A,B) ((__m128i) __builtin_ia32_psrawi128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)_mm_setzero_si128(), (__mmask8)(U)))
+#define _mm256_maskz_srai_epi16(U,A,B) ((__m256i) __builtin_ia32_psrawi256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)_mm256_setzero_si256 (), (__mmask16)(U)))
+#define _mm256_mask_i32scatter_pd(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv4df ((void *) (ADDR), (__mmask8) (MASK), (__v4si)(__m128i) (INDEX), (__v4df)(__m256d) (V1), (int) (SCALE))
+#define _mm512_maskz_cvt_roundph_epu16(A,B,C) ((__m512i) __builtin_ia32_vcvtph2uw512_mask_round ((B), (__v32hi) _mm512_setzero_si512 (), (A), (C)))
+#define _mm256_mask_i32scatter_ps(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv8sf ((void *) (ADDR), (__mmask8) (MASK), (__v8si)(__m256i) (INDEX), (__v8sf)(__m256) (V1), (int) (SCALE))
+#define __GCC_CONSTRUCTIVE_SIZE 64
+#define PULSE_RT_PRIO 80
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+#define __UINT_LEAST64_TYPE__ long unsigned int
+#define _mm512_i32scatter_epi32(ADDR,INDEX,V1,SCALE) __builtin_ia32_scattersiv16si ((void *) (ADDR), (__mmask16)0xFFFF, (__v16si)(__m512i) (INDEX), (__v16si)(__m512i) (V1), (int) (SCALE))
+#define _mm256_maskz_srai_epi32(U,A,B) ((__m256i) __builtin_ia32_psradi256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+#define __lwpins32(D2,D1,F) (__builtin_ia32_lwpins32 ((unsigned int) (D2), (unsigned int) (D1), (unsigned int) (F)))
+#define _AVX512CDINTRIN_H_INCLUDED 
+#define __FLT_HAS_QUIET_NAN__ 1
+#define _mm512_cvt_roundepu64_pd(A,B) ((__m512d)__builtin_ia32_cvtuqq2pd512_mask ((__v8di)(A), (__v8df)_mm512_setzero_pd (), -1, (B)))
+#define __pconfig_generic(leaf,b,c,d,retval) __asm__ __volatile__ ("pconfig\n\t" : "=a" (retval), "=b" (b), "=c" (c), "=d" (d) : "a" (leaf), "b" (b), "c" (c), "d" (d) : "cc")
+#define _mm512_cvt_roundepu64_ps(A,B) ((__m256)__builtin_ia32_cvtuqq2ps512_mask ((__v8di)(A), (__v8sf)_mm256_setzero_ps (), -1, (B)))
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+#define _BMI2INTRIN_H_INCLUDED 
+#define _mm_mask_fpclass_pd_mask(u,X,C) ((__mmask8) __builtin_ia32_fpclasspd128_mask ((__v2df) (__m128d) (X), (int) (C),(__mmask8)(u)))
+#define _mm512_mask_shldi_epi16(A,B,C,D,E) ((__m512i) __builtin_ia32_vpshld_v32hi_mask ((__v32hi)(__m512i)(C), (__v32hi)(__m512i)(D), (int)(E), (__v32hi)(__m512i)(A), (__mmask32)(B)))
+#define _mm256_shufflelo_epi16(A,N) ((__m256i)__builtin_ia32_pshuflw256 ((__v16hi)(__m256i)(A), (int)(N)))
+#define __FLT64X_HAS_DENORM__ 1
+#define _mm256_reduce_ph(A,B) (__builtin_ia32_reduceph256_mask ((A), (B), _mm256_setzero_ph (), ((__mmask16)-1)))
+#define _mm256_reduce_ps(A,B) ((__m256) __builtin_ia32_reduceps256_mask ((__v8sf)(__m256)(A), (int)(B), (__v8sf)_mm256_setzero_ps(), (__mmask8)-1))
+#define __FLT_HAS_INFINITY__ 1
+#define _mm512_prefetch_i32scatter_pd(ADDR,INDEX,SCALE,HINT) __builtin_ia32_scatterpfdpd ((__mmask8)0xFF, (__v8si)(__m256i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+#define _mm512_prefetch_i32scatter_ps(ADDR,INDEX,SCALE,HINT) __builtin_ia32_scatterpfdps ((__mmask16)0xFFFF, (__v16si)(__m512i) (INDEX), (void *) (ADDR), (int) (SCALE), (int) (HINT))
+#define _mm512_exp2a23_pd(A) _mm512_exp2a23_round_pd(A, _MM_FROUND_CUR_DIRECTION)
+#define _mm512_exp2a23_ps(A) _mm512_exp2a23_round_ps(A, _MM_FROUND_CUR_DIRECTION)
+#define _BSD_PTRDIFF_T_ 
+#define _mm256_maskz_srai_epi64(U,A,B) ((__m256i) __builtin_ia32_psraqi256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define PRIXPTR __PRIPTR_PREFIX "X"
+#define __lwpins64(D2,D1,F) (__builtin_ia32_lwpins64 ((unsigned long long) (D2), (unsigned int) (D1), (unsigned int) (F)))
+#define _mm_mask_fnmadd_round_sh(A,U,B,C,R) ((__m128h) __builtin_ia32_vfnmaddsh3_mask ((A), (B), (C), (U), (R)))
+#define _mm_mask3_fnmadd_round_sd(A,B,C,U,R) (__m128d) __builtin_ia32_vfmaddsd3_mask3 (A, -(B), C, U, R)
+#define _mm512_min_round_ph(A,B,C) (__builtin_ia32_minph512_mask_round ((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define _mm512_mask_cvtt_roundph_epu32(A,B,C,D) ((__m512i) __builtin_ia32_vcvttph2udq512_mask_round ((C), (__v16si)(A), (B), (D)))
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+#define _mm512_maskz_cvt_roundph_epu64(A,B,C) (__builtin_ia32_vcvtph2uqq512_mask_round ((B), _mm512_setzero_si512 (), (A), (C)))
+#define _mm256_maskz_cmul_pch(U,A,B) _mm256_maskz_fcmul_pch((U), (A), (B))
+#define _mm_mask3_fnmadd_round_ss(A,B,C,U,R) (__m128) __builtin_ia32_vfmaddss3_mask3 (A, -(B), C, U, R)
+#define _mm_cvt_roundi32_ss(A,B,C) (__m128)__builtin_ia32_cvtsi2ss32(A, B, C)
+#define __INT_FAST32_WIDTH__ 64
+#define __CHAR16_TYPE__ short unsigned int
+#define _mm_cmp_epi32_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpd128_mask ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(P), (__mmask8)-1))
+#define SCNuPTR __PRIPTR_PREFIX "u"
+#define _mm256_insertf128_pd(X,Y,O) ((__m256d) __builtin_ia32_vinsertf128_pd256 ((__v4df)(__m256d)(X), (__v2df)(__m128d)(Y), (int)(O)))
+#define BIG_ENDIAN __BIG_ENDIAN
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define _mm512_maskz_shrdi_epi16(A,B,C,D) ((__m512i) __builtin_ia32_vpshrd_v32hi_mask ((__v32hi)(__m512i)(B), (__v32hi)(__m512i)(C),(int)(D), (__v32hi)(__m512i)_mm512_setzero_si512 (), (__mmask32)(A)))
+#define _mm256_insertf128_ps(X,Y,O) ((__m256) __builtin_ia32_vinsertf128_ps256 ((__v8sf)(__m256)(X), (__v4sf)(__m128)(Y), (int)(O)))
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+#define _mm512_reduce_pd(A,B) ((__m512d) __builtin_ia32_reducepd512_mask ((__v8df)(__m512d)(A), (int)(B), (__v8df)_mm512_setzero_pd (), (__mmask8)-1))
+#define __W_CONTINUED 0xffff
+#define _mm_mask3_fmadd_round_ss(A,B,C,U,R) (__m128) __builtin_ia32_vfmaddss3_mask3 (A, B, C, U, R)
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define _mm256_mask_mul_pch(W,U,A,B) _mm256_mask_fmul_pch ((W), (U), (A), (B))
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+#define _mm512_maskz_dbsad_epu8(U,X,Y,C) ((__m512i) __builtin_ia32_dbpsadbw512_mask ((__v64qi)(__m512i) (X), (__v64qi)(__m512i) (Y), (int) (C), (__v32hi)(__m512i) _mm512_setzero_si512 (), (__mmask32)(U)))
+#define _mm_mmask_i64gather_epi32(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128i) __builtin_ia32_gather3div4si ((__v4si)(__m128i) (V1OLD), (void const *) (ADDR), (__v2di)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define __GCC_DESTRUCTIVE_SIZE 64
+#define _mm512_reduce_ph(A,B) (__builtin_ia32_reduceph512_mask_round ((A), (B), _mm512_setzero_ph (), (__mmask32)-1, _MM_FROUND_CUR_DIRECTION))
+#define WATCHDOG 1
+#define __INT_LEAST8_TYPE__ signed char
+#define __AVX512FP16VLINTRIN_H_INCLUDED 
+#define _INTTYPES_H 1
+#define _mm_blend_epi32(X,Y,M) ((__m128i) __builtin_ia32_pblendd128 ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(M)))
+#define _mm256_cmp_pd(X,Y,P) ((__m256d) __builtin_ia32_cmppd256 ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(P)))
+#define _mm512_mask_sub_round_ph(A,B,C,D,E) ((__m512h)__builtin_ia32_subph512_mask_round((C), (D), (A), (B), (E)))
+#define _mm_mask_getexp_sd(W,U,A,B) (__m128d)__builtin_ia32_getexpsd_mask_round(A, B, W, U, _MM_FROUND_CUR_DIRECTION)
+#define __STDC_VERSION__ 201710L
+#define _mm_mask_getexp_ss(W,U,A,B) (__m128)__builtin_ia32_getexpss_mask_round(A, B, W, U, _MM_FROUND_CUR_DIRECTION)
+#define __DEC32_MAX_EXP__ 97
+#define _mm256_i32gather_pd(BASE,INDEX,SCALE) (__m256d) __builtin_ia32_gathersiv4df ((__v4df) _mm256_setzero_pd (), (double const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4df) _mm256_cmp_pd (_mm256_setzero_pd (), _mm256_setzero_pd (), _CMP_EQ_OQ), (int) (SCALE))
+#define TIMER_ABSTIME 1
+#define UTILITY_MACROS_H 
+#define _mm256_i32gather_ps(BASE,INDEX,SCALE) (__m256) __builtin_ia32_gathersiv8sf ((__v8sf) _mm256_setzero_ps (), (float const *) (BASE), (__v8si)(__m256i) (INDEX), (__v8sf) _mm256_cmp_ps (_mm256_setzero_ps (), _mm256_setzero_ps (), _CMP_EQ_OQ), (int) (SCALE))
+#define __INT_FAST8_MAX__ 0x7f
+#define _mm_mask_scalef_round_sd(W,U,A,B,C) ((__m128d) __builtin_ia32_scalefsd_mask_round ((A), (B), (W), (U), (C)))
+#define _mm512_mask_cmp_epi16_mask(M,X,Y,P) ((__mmask32) __builtin_ia32_cmpw512_mask ((__v32hi)(__m512i)(X), (__v32hi)(__m512i)(Y), (int)(P), (__mmask32)(M)))
+#define __PMT(args) args
+#define _mm_mmask_i64gather_epi64(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128i) __builtin_ia32_gather3div2di ((__v2di)(__m128i) (V1OLD), (void const *) (ADDR), (__v2di)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _SYS_TYPES_H 1
+#define _mm512_maskz_fmadd_round_pch(A,B,C,D,E) (__m512h) __builtin_ia32_vfmaddcph512_maskz_round ((B), (C), (D), (A), (E))
+#define _mm512_maskz_cvt_roundpd_epu32(U,A,B) ((__m256i)__builtin_ia32_cvtpd2udq512_mask(A, (__v8si)_mm256_setzero_si256(), U, B))
+#define _mm512_mask_cvt_roundph_epi32(A,B,C,D) ((__m512i) __builtin_ia32_vcvtph2dq512_mask_round ((C), (__v16si)(A), (B), (D)))
+#define _mm_mask_scalef_round_sh(A,B,C,D,E) (__builtin_ia32_scalefsh_mask_round ((C), (D), (A), (B), (E)))
+#define _AVX512VNNIVLINTRIN_H_INCLUDED 
+#define _mm256_maskz_permutex_epi64(M,X,I) ((__m256i) __builtin_ia32_permdi256_mask ((__v4di)(__m256i)(X), (int)(I), (__v4di)(__m256i) (_mm256_setzero_si256 ()), (__mmask8)(M)))
+#define SCNuFAST16 __PRIPTR_PREFIX "u"
+#define CLOCK_MONOTONIC 1
+#define _mm512_mask_rol_epi32(W,U,A,B) ((__m512i)__builtin_ia32_prold512_mask ((__v16si)(__m512i)(A), (int)(B), (__v16si)(__m512i)(W), (__mmask16)(U)))
+#define _PCONFIGINTRIN_H_INCLUDED 
+#define _mm512_mask3_fmsubadd_round_pd(A,B,C,U,R) (__m512d)__builtin_ia32_vfmsubaddpd512_mask3(A, B, C, U, R)
+#define _mm512_mask3_fmsubadd_round_ph(A,B,C,U,R) ((__m512h)__builtin_ia32_vfmsubaddph512_mask3 ((A), (B), (C), (U), (R)))
+#define PIN_TOTAL 8
+#define _mm512_mask3_fmsubadd_round_ps(A,B,C,U,R) (__m512)__builtin_ia32_vfmsubaddps512_mask3(A, B, C, U, R)
+#define __FLT64_HAS_QUIET_NAN__ 1
+#define _mm512_extractf32x8_ps(X,C) ((__m256) __builtin_ia32_extractf32x8_mask ((__v16sf)(__m512) (X), (int) (C), (__v8sf)(__m256) _mm256_setzero_ps (), (__mmask8)-1))
+#define _mm512_mask3_fmsub_round_ph(A,B,C,U,R) ((__m512h)__builtin_ia32_vfmsubph512_mask3 ((A), (B), (C), (U), (R)))
+#define _mm_cmul_round_sch(A,B,R) _mm_fcmul_round_sch ((A), (B), (R))
+#define _mm256_mask_blend_epi8(__U,__A,__W) ((__m256i) __builtin_ia32_blendmb_256_mask ((__v32qi) (__A), (__v32qi) (__W), (__mmask32) (__U)))
+#define SYSTEM_RESET_REBOOT 1
+#define _mm512_maskz_cvt_roundpd_epu64(U,A,B) ((__m512i)__builtin_ia32_cvtpd2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), (U), (B)))
+#define _mm_maskz_min_round_sh(A,B,C,D) (__builtin_ia32_minsh_mask_round ((B), (C), _mm_setzero_ph (), (A), (D)))
+#define SCNuFAST32 __PRIPTR_PREFIX "u"
+#define _mm256_mask_shuffle_i32x4(W,U,X,Y,C) ((__m256i) __builtin_ia32_shuf_i32x4_256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(C), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define TTY_CH 2
+#define __INTMAX_TYPE__ long int
+#define __KEY_T_TYPE __S32_TYPE
+#define PRIXFAST8 "X"
+#define _mm256_mask_cmul_pch(W,U,A,B) _mm256_mask_fcmul_pch ((W), (U), (A), (B))
+#define _mm512_mask_rol_epi64(W,U,A,B) ((__m512i)__builtin_ia32_prolq512_mask ((__v8di)(__m512i)(A), (int)(B), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define _mm_cmp_sd_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P), (__mmask8)-1,_MM_FROUND_CUR_DIRECTION))
+#define _mm512_mask_ternarylogic_epi32(A,U,B,C,I) ((__m512i) __builtin_ia32_pternlogd512_mask ((__v16si) (__m512i) (A), (__v16si) (__m512i) (B), (__v16si) (__m512i) (C), (unsigned char) (I), (__mmask16) (U)))
+#define __BEGIN_DECLS 
+#define _mm512_mask_exp2a23_round_pd(W,U,A,C) __builtin_ia32_exp2pd_mask(A, W, U, C)
+#define _mm512_mask_cmp_epu32_mask(M,X,Y,P) ((__mmask16) __builtin_ia32_ucmpd512_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(P), (__mmask16)(M)))
+#define _mm512_mask_exp2a23_round_ps(W,U,A,C) __builtin_ia32_exp2ps_mask(A, W, U, C)
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define _mm_mul_round_sh(A,B,C) ((__m128h)__builtin_ia32_mulsh_mask_round ((A), (B), _mm_setzero_ph (), (__mmask8)-1, (C)))
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define _mm512_mask_getmant_round_pd(W,U,X,B,C,R) ((__m512d)__builtin_ia32_getmantpd512_mask ((__v8df)(__m512d)(X), (int)(((C)<<2) | (B)), (__v8df)(__m512d)(W), (__mmask8)(U), (R)))
+#define _mm512_mask_getmant_round_ph(W,U,X,B,C,R) ((__m512h)__builtin_ia32_getmantph512_mask ((__v32hf)(__m512h)(X), (int)(((C)<<2) | (B)), (__v32hf)(__m512h)(W), (__mmask32)(U), (R)))
+#define _mm512_mask_shuffle_f64x2(W,U,X,Y,C) ((__m512d) __builtin_ia32_shuf_f64x2_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(C), (__v8df)(__m512d)(W), (__mmask8)(U)))
+#define _mm512_mask_getmant_round_ps(W,U,X,B,C,R) ((__m512)__builtin_ia32_getmantps512_mask ((__v16sf)(__m512)(X), (int)(((C)<<2) | (B)), (__v16sf)(__m512)(W), (__mmask16)(U), (R)))
+#define SCNuFAST64 __PRI64_PREFIX "u"
+#define __FLT64_HAS_INFINITY__ 1
+#define PWM_CH 1
+#define __GNUC_VA_LIST 
+#define be16toh(x) __bswap_16 (x)
+#define _mm_ceil_pd(V) _mm_round_pd ((V), _MM_FROUND_CEIL)
+#define _mm512_mask_shldi_epi32(A,B,C,D,E) ((__m512i) __builtin_ia32_vpshld_v16si_mask ((__v16si)(__m512i)(C), (__v16si)(__m512i)(D), (int)(E), (__v16si)(__m512i)(A), (__mmask16)(B)))
+#define WSTOPPED 2
+#define _mm_ceil_ps(V) _mm_round_ps ((V), _MM_FROUND_CEIL)
+#define _mm512_mask_ternarylogic_epi64(A,U,B,C,I) ((__m512i) __builtin_ia32_pternlogq512_mask ((__v8di) (__m512i) (A), (__v8di) (__m512i) (B), (__v8di) (__m512i) (C), (unsigned char)(I), (__mmask8) (U)))
+#define _mm512_maskz_shrdi_epi32(A,B,C,D) ((__m512i) __builtin_ia32_vpshrd_v16si_mask ((__v16si)(__m512i)(B), (__v16si)(__m512i)(C),(int)(D), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(A)))
+#define _SIDD_BIT_MASK 0x00
+#define COMMPORT_TYPE_I2C 5
+#define _mm512_maskz_cvtps_ph(W,A,I) ((__m256i) __builtin_ia32_vcvtps2ph512_mask ((__v16sf)(__m512) (A), (int) (I), (__v16hi)_mm256_setzero_si256 (), (__mmask16) (W)))
+#define _CLFLUSHOPTINTRIN_H_INCLUDED 
+#define _mm256_permute2f128_pd(X,Y,C) ((__m256d) __builtin_ia32_vperm2f128_pd256 ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(C)))
+#define _mm512_maskz_roundscale_ph(A,B,C) (__builtin_ia32_rndscaleph512_mask_round ((B), (C), _mm512_setzero_ph (), (A), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_maskz_shuffle_f64x2(U,X,Y,C) ((__m512d) __builtin_ia32_shuf_f64x2_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(C), (__v8df)(__m512d)_mm512_setzero_pd(), (__mmask8)(U)))
+#define _mm256_inserti64x2(X,Y,C) ((__m256i) __builtin_ia32_inserti64x2_256_mask ((__v4di)(__m256i) (X), (__v2di)(__m128i) (Y), (int) (C), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)-1))
+#define _mm512_maskz_roundscale_ps(A,B,C) ((__m512) __builtin_ia32_rndscaleps_mask ((__v16sf)(__m512)(B), (int)(C), (__v16sf)_mm512_setzero_ps(), (__mmask16)(A), _MM_FROUND_CUR_DIRECTION))
+#define _mm256_permute2f128_ps(X,Y,C) ((__m256) __builtin_ia32_vperm2f128_ps256 ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(C)))
+#define _mm256_mask_i64gather_pd(SRC,BASE,INDEX,MASK,SCALE) (__m256d) __builtin_ia32_gatherdiv4df ((__v4df)(__m256d) (SRC), (double const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4df)(__m256d) (MASK), (int) (SCALE))
+#define _mm256_mask_i64gather_ps(SRC,BASE,INDEX,MASK,SCALE) (__m128) __builtin_ia32_gatherdiv4sf256 ((__v4sf)(__m128) (SRC), (float const *) (BASE), (__v4di)(__m256i) (INDEX), (__v4sf)(__m128) (MASK), (int) (SCALE))
+#define __ino_t_defined 
+#define _CMP_NGE_US 0x09
+#define _WAITPKG_H_INCLUDED 
+#define __UINT16_TYPE__ short unsigned int
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define _mm_maskz_shrdi_epi32(A,B,C,D) ((__m128i) __builtin_ia32_vpshrd_v4si_mask ((__v4si)(__m128i)(B), (__v4si)(__m128i)(C),(int)(D), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(A)))
+#define PRIiPTR __PRIPTR_PREFIX "i"
+#define _mm512_mask_cvt_roundepu32_ps(W,U,A,B) (__m512)__builtin_ia32_cvtudq2ps512_mask((__v16si)(A), W, U, B)
+#define _kshiftli_mask16(X,Y) ((__mmask16) __builtin_ia32_kshiftlihi ((__mmask16)(X), (__mmask8)(Y)))
+#define _mm_ceil_ss(D,V) _mm_round_ss ((D), (V), _MM_FROUND_CEIL)
+#define _mm512_mask_cmp_pd_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmppd512_mask ((__v8df)(__m512d)(X), (__v8df)(__m512d)(Y), (int)(P), (__mmask8)(M), _MM_FROUND_CUR_DIRECTION))
+#define _mm_mask_cmp_pd_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmppd128_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P), (__mmask8)(M)))
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+#define __INT_FAST64_WIDTH__ 64
+#define _mm512_cvt_roundps_epu32(A,B) ((__m512i)__builtin_ia32_cvtps2udq512_mask(A, (__v16si)_mm512_undefined_epi32 (), -1, B))
+#define _CMP_EQ_OS 0x10
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define _mm512_maskz_permute_pd(U,X,C) ((__m512d) __builtin_ia32_vpermilpd512_mask ((__v8df)(__m512d)(X), (int)(C), (__v8df)(__m512d)_mm512_setzero_pd(), (__mmask8)(U)))
+#define _kshiftli_mask32(X,Y) ((__mmask32) __builtin_ia32_kshiftlisi ((__mmask32)(X), (__mmask8)(Y)))
+#define _mm_maskz_permute_pd(U,X,C) ((__m128d) __builtin_ia32_vpermilpd_mask ((__v2df)(__m128d)(X), (int)(C), (__v2df)(__m128d)_mm_setzero_pd (), (__mmask8)(U)))
+#define _mm512_maskz_permute_ps(U,X,C) ((__m512) __builtin_ia32_vpermilps512_mask ((__v16sf)(__m512)(X), (int)(C), (__v16sf)(__m512)_mm512_setzero_ps(), (__mmask16)(U)))
+#define _mm_maskz_shrdi_epi64(A,B,C,D) ((__m128i) __builtin_ia32_vpshrd_v2di_mask ((__v2di)(__m128i)(B), (__v2di)(__m128i)(C),(int)(D), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)(A)))
+#define _mm512_rcp28_ps(A) _mm512_rcp28_round_ps(A, _MM_FROUND_CUR_DIRECTION)
+#define _mm_maskz_permute_ps(U,X,C) ((__m128) __builtin_ia32_vpermilps_mask ((__v4sf)(__m128)(X), (int)(C), (__v4sf)(__m128)_mm_setzero_ps (), (__mmask8)(U)))
+#define _mm512_maskz_cvtx_roundps_ph(A,B,C) (__builtin_ia32_vcvtps2phx512_mask_round ((__v16sf)(B), _mm256_setzero_ph (), (A), (C)))
+#define _mm256_shuffle_i32x4(X,Y,C) ((__m256i) __builtin_ia32_shuf_i32x4_256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(C), (__v8si)(__m256i) _mm256_setzero_si256 (), (__mmask8)-1))
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+#define __FLT_DIG__ 6
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+#define __FLT32_HAS_INFINITY__ 1
+#define INT_FAST32_MAX (9223372036854775807L)
+#define _mm512_maskz_reduce_pd(U,A,B) ((__m512d) __builtin_ia32_reducepd512_mask ((__v8df)(__m512d)(A), (int)(B), (__v8df)_mm512_setzero_pd (), (__mmask8)(U)))
+#define _mm512_maskz_reduce_ph(A,B,C) (__builtin_ia32_reduceph512_mask_round ((B), (C), _mm512_setzero_ph (), (A), _MM_FROUND_CUR_DIRECTION))
+#define __FLT64X_MAX_EXP__ 16384
+#define _mm512_maskz_reduce_ps(U,A,B) ((__m512) __builtin_ia32_reduceps512_mask ((__v16sf)(__m512)(A), (int)(B), (__v16sf)_mm512_setzero_ps (), (__mmask16)(U)))
+#define VCD_RING_SIZE 4096
+#define __UINT_FAST64_TYPE__ long unsigned int
+#define _mm512_cvtt_roundpd_epu64(A,B) ((__m512i)__builtin_ia32_cvttpd2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), -1, (B)))
+#define _mm512_cvt_roundps_epu64(A,B) ((__m512i)__builtin_ia32_cvtps2uqq512_mask ((A), (__v8di)_mm512_setzero_si512 (), -1, (B)))
+#define _MM_FROUND_NO_EXC 0x08
+#define __LDBL_REDIR_DECL(name) 
+#define _kshiftli_mask64(X,Y) ((__mmask64) __builtin_ia32_kshiftlidi ((__mmask64)(X), (__mmask8)(Y)))
+#define _mm512_maskz_rcp28_pd(U,A) _mm512_maskz_rcp28_round_pd(U, A, _MM_FROUND_CUR_DIRECTION)
+#define _mm_maskz_cvt_roundsh_ss(A,B,C,R) (__builtin_ia32_vcvtsh2ss_mask_round ((C), (B), _mm_setzero_ps (), (A), (R)))
+#define UINT_FAST8_MAX (255)
+#define __INT_MAX__ 0x7fffffff
+#define _mm256_insertf128_si256(X,Y,O) ((__m256i) __builtin_ia32_vinsertf128_si256 ((__v8si)(__m256i)(X), (__v4si)(__m128i)(Y), (int)(O)))
+#define _mm_mask_sqrt_ss(W,U,A,B) _mm_mask_sqrt_round_ss ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _mm_maskz_reduce_round_sd(U,A,B,C,R) ((__m128d) __builtin_ia32_reducesd_mask_round ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df) _mm_setzero_pd (), (__mmask8)(U), (int)(R)))
+#define _mm_maskz_reduce_round_ss(U,A,B,C,R) ((__m128) __builtin_ia32_reducesd_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf) _mm_setzero_ps (), (__mmask8)(U), (int)(R)))
+#define UINT8_MAX (255)
+#define _T_SIZE_ 
+#define _mm512_mask_shuffle_i64x2(W,U,X,Y,C) ((__m512i) __builtin_ia32_shuf_i64x2_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(C), (__v8di)(__m512i)(W), (__mmask8)(U)))
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+#define __WNOTHREAD 0x20000000
+#define _mm256_maskz_shuffle_i32x4(U,X,Y,C) ((__m256i) __builtin_ia32_shuf_i32x4_256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(C), (__v8si)(__m256i) _mm256_setzero_si256 (), (__mmask8)(U)))
+#define __INT64_TYPE__ long int
+#define CLOCK_PROCESS_CPUTIME_ID 2
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define UINT32_C(c) c ## U
+#define __INT_FAST64_TYPE__ long int
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+#define _mm_cvt_roundss_u32(A,B) ((unsigned)__builtin_ia32_vcvtss2usi32(A, B))
+#define __WINT_TYPE__ unsigned int
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define _CMP_TRUE_UQ 0x0f
+#define _CMP_TRUE_US 0x1f
+#define __intptr_t_defined 
+#define _mm512_maskz_rcp28_ps(U,A) _mm512_maskz_rcp28_round_ps(U, A, _MM_FROUND_CUR_DIRECTION)
+#define _AVXVNNIINTRIN_H_INCLUDED 
+#define _mm512_maskz_cvt_roundepi16_ph(A,B,C) (__builtin_ia32_vcvtw2ph512_mask_round ((__v32hi)(B), _mm512_setzero_ph (), (A), (C)))
+#define _mm_i32gather_ps(BASE,INDEX,SCALE) (__m128) __builtin_ia32_gathersiv4sf ((__v4sf) _mm_setzero_ps (), (float const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4sf) _mm_cmpeq_ps (_mm_setzero_ps (), _mm_setzero_ps ()), (int) (SCALE))
+#define _mm_cvtt_roundsh_i64(A,B) ((long long)__builtin_ia32_vcvttsh2si64_round ((A), (B)))
+#define PRIiFAST16 __PRIPTR_PREFIX "i"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define _mm256_maskz_dbsad_epu8(U,X,Y,C) ((__m256i) __builtin_ia32_dbpsadbw256_mask ((__v32qi)(__m256i) (X), (__v32qi)(__m256i) (Y), (int) (C), (__v16hi)(__m256i)_mm256_setzero_si256(), (__mmask16)(U)))
+#define _mm256_i64scatter_pd(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv4df ((void *) (ADDR), (__mmask8)0xFF, (__v4di)(__m256i) (INDEX), (__v4df)(__m256d) (V1), (int) (SCALE))
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+#define _mm_cvt_roundss_u64(A,B) ((unsigned long long)__builtin_ia32_vcvtss2usi64(A, B))
+#define _mm256_i64scatter_ps(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8sf ((void *) (ADDR), (__mmask8)0xFF, (__v4di)(__m256i) (INDEX), (__v4sf)(__m128) (V1), (int) (SCALE))
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __USE_POSIX199309 1
+#define __INT_LEAST64_WIDTH__ 64
+#define _mm_fcmul_round_sch(__A,__B,__D) (__m128h) __builtin_ia32_vfcmulcsh_round ((__v8hf) __A, (__v8hf) __B, __D)
+#define _mm512_slli_epi16(X,C) ((__m512i)__builtin_ia32_psllwi512_mask ((__v32hi)(__m512i)(X), (int)(C), (__v32hi)(__m512i)_mm512_setzero_si512 (), (__mmask32)-1))
+#define _tile_stored_internal(src,base,stride) __asm__ volatile ("{tilestored\t%%tmm"#src", (%0,%1,1)|tilestored\t[%0+%1*1], %%tmm"#src"}" :: "r" ((void*) (base)), "r" ((long) (stride)) : "memory")
+#define __SIZEOF_INT128__ 16
+#define _mm512_gf2p8affine_epi64_epi8(A,B,C) ((__m512i) __builtin_ia32_vgf2p8affineqb_v64qi ((__v64qi)(__m512i)(A), (__v64qi)(__m512i)(B), (int)(C)))
+#define _mm512_maskz_max_round_pd(U,A,B,R) (__m512d)__builtin_ia32_maxpd512_mask(A, B, (__v8df)_mm512_setzero_pd(), U, R)
+#define _mm512_fmsubadd_round_pd(A,B,C,R) (__m512d)__builtin_ia32_vfmaddsubpd512_mask(A, B, -(C), -1, R)
+#define _mm512_maskz_max_round_ph(A,B,C,D) (__builtin_ia32_maxph512_mask_round ((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define _mm512_fmsubadd_round_ph(A,B,C,R) ((__m512h)__builtin_ia32_vfmsubaddph512_mask ((A), (B), (C), -1, (R)))
+#define _mm512_maskz_max_round_ps(U,A,B,R) (__m512)__builtin_ia32_maxps512_mask(A, B, (__v16sf)_mm512_setzero_ps(), U, R)
+#define _mm512_fmsubadd_round_ps(A,B,C,R) (__m512)__builtin_ia32_vfmaddsubps512_mask(A, B, -(C), -1, R)
+#define __LDBL_MAX_10_EXP__ 4932
+#define __ATOMIC_RELAXED 0
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+#define _mm512_slli_epi32(X,C) ((__m512i) __builtin_ia32_pslldi512_mask ((__v16si)(__m512i)(X), (int)(C), (__v16si)(__m512i)_mm512_undefined_epi32 (), (__mmask16)-1))
+#define le16toh(x) __uint16_identity (x)
+#define GPIO_ATOMIC_MAX GPIO_PIN(0x40,0)
+#define _RDSEEDINTRIN_H_INCLUDED 
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+#define _mm512_rol_epi32(A,B) ((__m512i)__builtin_ia32_prold512_mask ((__v16si)(__m512i)(A), (int)(B), (__v16si)_mm512_undefined_epi32 (), (__mmask16)(-1)))
+#define _mm256_fpclass_ph_mask(X,C) ((__mmask16) __builtin_ia32_fpclassph256_mask ((__v16hf) (__m256h) (X), (int) (C),(__mmask16)-1))
+#define SCNoFAST16 __PRIPTR_PREFIX "o"
+#define _SERIALIZE_H_INCLUDED 
+#define _mm_maskz_ternarylogic_epi64(U,A,B,C,I) ((__m128i) __builtin_ia32_pternlogq128_maskz ((__v2di) (__m128i) (A), (__v2di) (__m128i) (B), (__v2di) (__m128i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define _mm256_shldi_epi16(A,B,C) ((__m256i) __builtin_ia32_vpshld_v16hi ((__v16hi)(__m256i)(A), (__v16hi)(__m256i)(B),(int)(C)))
+#define __INT_LEAST32_TYPE__ int
+#define _AVX512VBMI2VLINTRIN_H_INCLUDED 
+#define __wchar_t__ 
+#define __SIZEOF_WCHAR_T__ 4
+#define _mm512_maskz_fmsub_round_ps(U,A,B,C,R) (__m512)__builtin_ia32_vfmsubps512_maskz(A, B, C, U, R)
+#define __GNUC_PATCHLEVEL__ 0
+#define _mm512_slli_epi64(X,C) ((__m512i) __builtin_ia32_psllqi512_mask ((__v8di)(__m512i)(X), (int)(C), (__v8di)(__m512i)_mm512_undefined_epi32 (), (__mmask8)-1))
+#define SCNiFAST16 __PRIPTR_PREFIX "i"
+#define _mm256_shldi_epi32(A,B,C) ((__m256i) __builtin_ia32_vpshld_v8si ((__v8si)(__m256i)(A), (__v8si)(__m256i)(B),(int)(C)))
+#define _mm_min_round_sd(A,B,C) (__m128d)__builtin_ia32_minsd_round(A, B, C)
+#define _mm512_rol_epi64(A,B) ((__m512i)__builtin_ia32_prolq512_mask ((__v8di)(__m512i)(A), (int)(B), (__v8di)_mm512_undefined_epi32 (), (__mmask8)(-1)))
+#define _mm_min_round_ss(A,B,C) (__m128)__builtin_ia32_minss_round(A, B, C)
+#define __ATOMIC_RELEASE 3
+#define _mm_maskz_reduce_round_sh(A,B,C,D,E) (__builtin_ia32_reducesh_mask_round ((B), (C), (D), _mm_setzero_ph (), (A), (E)))
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define _mm256_mask_range_ps(W,U,A,B,C) ((__m256) __builtin_ia32_rangeps256_mask ((__v8sf)(__m256)(A), (__v8sf)(__m256)(B), (int)(C), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _mm512_mask_fmadd_round_pch(A,B,C,D,E) ((__m512h) __builtin_ia32_vfmaddcph512_mask_round ((__v32hf) (A), (__v32hf) (C), (__v32hf) (D), (B), (E)))
+#define _mm_mask_sqrt_sd(W,U,A,B) _mm_mask_sqrt_round_sd ((W), (U), (A), (B), _MM_FROUND_CUR_DIRECTION)
+#define _STDDEF_H_ 
+#define _mm512_permutex_pd(X,M) ((__m512d) __builtin_ia32_permdf512_mask ((__v8df)(__m512d)(X), (int)(M), (__v8df)(__m512d)_mm512_undefined_pd(), (__mmask8)-1))
+#define SCNiFAST32 __PRIPTR_PREFIX "i"
+#define be64toh(x) __bswap_64 (x)
+#define _mm256_extractf128_pd(X,N) ((__m128d) __builtin_ia32_vextractf128_pd256 ((__v4df)(__m256d)(X), (int)(N)))
+#define _mm_roundscale_round_sh(A,B,C,D) (__builtin_ia32_rndscalesh_mask_round ((A), (B), (C), _mm_setzero_ph (), (__mmask8)-1, (D)))
+#define _mm256_extractf128_ps(X,N) ((__m128) __builtin_ia32_vextractf128_ps256 ((__v8sf)(__m256)(X), (int)(N)))
+#define _mm256_mask_shldi_epi16(A,B,C,D,E) ((__m256i) __builtin_ia32_vpshld_v16hi_mask ((__v16hi)(__m256i)(C), (__v16hi)(__m256i)(D), (int)(E), (__v16hi)(__m256i)(A), (__mmask16)(B)))
+#define __UINT_FAST8_TYPE__ unsigned char
+#define __INT_FAST8_TYPE__ signed char
+#define _mm256_shldi_epi64(A,B,C) ((__m256i) __builtin_ia32_vpshld_v4di ((__v4di)(__m256i)(A), (__v4di)(__m256i)(B),(int)(C)))
+#define _mm256_cmp_pd_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmppd256_mask ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(P), (__mmask8)-1))
+#define _mm_shufflehi_epi16(A,N) ((__m128i)__builtin_ia32_pshufhw ((__v8hi)(__m128i)(A), (int)(N)))
+#define _mm256_mask_extracti64x2_epi64(W,U,X,C) ((__m128i) __builtin_ia32_extracti64x2_256_mask ((__v4di)(__m256i) (X), (int) (C), (__v2di)(__m128i) (W), (__mmask8) (U)))
+#define _mm_mmask_i32gather_ps(V1OLD,MASK,INDEX,ADDR,SCALE) (__m128) __builtin_ia32_gather3siv4sf ((__v4sf)(__m128) (V1OLD), (void const *) (ADDR), (__v4si)(__m128i) (INDEX), (__mmask8) (MASK), (int) (SCALE))
+#define _mm_getexp_round_ss(A,B,R) ((__m128)__builtin_ia32_getexpss128_round((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), R))
+#define _mm256_mask_shldi_epi32(A,B,C,D,E) ((__m256i) __builtin_ia32_vpshld_v8si_mask ((__v8si)(__m256i)(C), (__v8si)(__m256i)(D), (int)(E), (__v8si)(__m256i)(A), (__mmask8)(B)))
+#define _THREAD_SHARED_TYPES_H 1
+#define _mm_mask_cvt_roundsd_sh(A,B,C,D,R) (__builtin_ia32_vcvtsd2sh_mask_round ((D), (C), (A), (B), (R)))
+#define SCNiFAST64 __PRI64_PREFIX "i"
+#define __f128(x) x ##f128
+#define _mm256_mask_shrdi_epi64(A,B,C,D,E) ((__m256i) __builtin_ia32_vpshrd_v4di_mask ((__v4di)(__m256i)(C), (__v4di)(__m256i)(D), (int)(E), (__v4di)(__m256i)(A), (__mmask8)(B)))
+#define _mm512_maskz_reduce_round_ph(A,B,C,D) (__builtin_ia32_reduceph512_mask_round ((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define _CMP_FALSE_OQ 0x0b
+#define _CMP_FALSE_OS 0x1b
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+#define _mm_insert_pi16(A,D,N) ((__m64) __builtin_ia32_vec_set_v4hi ((__v4hi)(__m64)(A), (int)(D), (int)(N)))
+#define _mm512_maskz_shldi_epi16(A,B,C,D) ((__m512i) __builtin_ia32_vpshld_v32hi_mask ((__v32hi)(__m512i)(B), (__v32hi)(__m512i)(C),(int)(D), (__v32hi)(__m512i)_mm512_setzero_si512 (), (__mmask32)(A)))
+#define _mm512_cmp_epu64_mask(X,Y,P) ((__mmask8) __builtin_ia32_ucmpq512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(P), (__mmask8)-1))
+#define _mm_cvt_roundsi64_sd(A,B,C) (__m128d)__builtin_ia32_cvtsi2sd64(A, B, C)
+#define _mm512_maskz_add_round_pd(U,A,B,C) (__m512d)__builtin_ia32_addpd512_mask(A, B, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm512_maskz_add_round_ph(A,B,C,D) ((__m512h)__builtin_ia32_addph512_mask_round((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define _BITS_STDIO_LIM_H 1
+#define _mm512_maskz_add_round_ps(U,A,B,C) (__m512)__builtin_ia32_addps512_mask(A, B, (__v16sf)_mm512_setzero_ps(), U, C)
+#define _FMAINTRIN_H_INCLUDED 
+#define __FXSR__ 1
+#define _mm512_mask_cvtt_roundps_epi32(W,U,A,B) ((__m512i)__builtin_ia32_cvttps2dq512_mask(A, (__v16si)(W), U, B))
+#define _mm256_maskz_srli_epi64(U,A,B) ((__m256i) __builtin_ia32_psrlqi256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)_mm256_setzero_si256 (), (__mmask8)(U)))
+#define _mm256_mask_shldi_epi64(A,B,C,D,E) ((__m256i) __builtin_ia32_vpshld_v4di_mask ((__v4di)(__m256i)(C), (__v4di)(__m256i)(D), (int)(E), (__v4di)(__m256i)(A), (__mmask8)(B)))
+#define _mm512_extracti32x8_epi32(X,C) ((__m256i) __builtin_ia32_extracti32x8_mask ((__v16si)(__m512i) (X), (int) (C), (__v8si)(__m256i) _mm256_setzero_si256 (), (__mmask8)-1))
+#define _CMP_LE_OQ 0x12
+#define _CMP_LE_OS 0x02
+#define _mm256_mask_cmp_pd_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_cmppd256_mask ((__v4df)(__m256d)(X), (__v4df)(__m256d)(Y), (int)(P), (__mmask8)(M)))
+#define PRIxFAST8 "x"
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define __ULONG32_TYPE unsigned int
+#define _mm_cvt_roundsd_i64(A,B) ((long long)__builtin_ia32_vcvtsd2si64(A, B))
+#define _mm512_mask_cvt_roundps_epu32(W,U,A,B) ((__m512i)__builtin_ia32_cvtps2udq512_mask(A, (__v16si)(W), U, B))
+#define _mm512_maskz_sqrt_round_pd(U,A,C) (__m512d)__builtin_ia32_sqrtpd512_mask(A, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm512_maskz_sqrt_round_ph(A,B,C) (__builtin_ia32_sqrtph512_mask_round ((B), _mm512_setzero_ph (), (A), (C)))
+#define FOPEN_MAX 16
+#define _WMMINTRIN_H_INCLUDED 
+#define _mm512_maskz_sqrt_round_ps(U,A,C) (__m512)__builtin_ia32_sqrtps512_mask(A, (__v16sf)_mm512_setzero_ps(), U, C)
+#define __suseconds_t_defined 
+#define _mm256_maskz_permute_pd(U,X,C) ((__m256d) __builtin_ia32_vpermilpd256_mask ((__v4df)(__m256d)(X), (int)(C), (__v4df)(__m256d)_mm256_setzero_pd (), (__mmask8)(U)))
+#define _mm256_maskz_permute_ps(U,X,C) ((__m256) __builtin_ia32_vpermilps256_mask ((__v8sf)(__m256)(X), (int)(C), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)(U)))
+#define __CHAR32_TYPE__ unsigned int
+#define __off_t_defined 
+#define __P(args) args
+#define _____fpos64_t_defined 1
+#define _MM_FLUSH_ZERO_ON 0x8000
+#define _mm_mask_slli_epi16(W,U,X,C) ((__m128i)__builtin_ia32_psllwi128_mask ((__v8hi)(__m128i)(X), (int)(C), (__v8hi)(__m128i)(W), (__mmask8)(U)))
+#define _mm512_mask_cvtt_roundps_epi64(W,U,A,B) ((__m512i)__builtin_ia32_cvttps2qq512_mask ((A), (__v8di)(W), (U), (B)))
+#define _mm256_cmp_ps(X,Y,P) ((__m256) __builtin_ia32_cmpps256 ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(P)))
+#define _mm_i32gather_epi32(BASE,INDEX,SCALE) (__m128i) __builtin_ia32_gathersiv4si ((__v4si) _mm_setzero_si128 (), (int const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4si)_mm_set1_epi32 (-1), (int) (SCALE))
+#define _GCC_SIZE_T 
+#define _mm512_maskz_extracti32x8_epi32(U,X,C) ((__m256i) __builtin_ia32_extracti32x8_mask ((__v16si)(__m512i) (X), (int) (C), (__v8si)(__m256i) _mm256_setzero_si256 (), (__mmask8) (U)))
+#define _mm_maskz_cvt_roundsd_sh(A,B,C,R) (__builtin_ia32_vcvtsd2sh_mask_round ((C), (B), _mm_setzero_ph (), (A), (R)))
+#define __U64_TYPE unsigned long int
+#define _mm_maskz_cvt_roundsd_ss(U,A,B,C) (__m128)__builtin_ia32_cvtsd2ss_mask_round ((A), (B), _mm_setzero_ps (), (U), (C))
+#define _mm_mask_slli_epi32(W,U,X,C) ((__m128i)__builtin_ia32_pslldi128_mask ((__v4si)(__m128i)(X), (int)(C), (__v4si)(__m128i)(W), (__mmask8)(U)))
+#define __SEG_FS 1
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+#define __size_t__ 
+#define _mm_maskz_fnmsub_round_ss(U,A,B,C,R) (__m128) __builtin_ia32_vfmaddss3_maskz (A, -(B), -(C), U, R)
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+#define _mm512_cmp_ph_mask(A,B,C) (__builtin_ia32_cmpph512_mask ((A), (B), (C), (-1)))
+#define PRIoPTR __PRIPTR_PREFIX "o"
+#define _mm512_cvtt_roundph_epu64(A,B) (__builtin_ia32_vcvttph2uqq512_mask_round ((A), _mm512_setzero_si512 (), (__mmask8)-1, (B)))
+#define __TIME64_T_TYPE __TIME_T_TYPE
+#define __ONCE_FLAG_INIT { 0 }
+#define _mm_maskz_cmul_pch(U,A,B) _mm_maskz_fcmul_pch ((U), (A), (B))
+#define _mm_mask_reduce_round_sh(A,B,C,D,E,F) (__builtin_ia32_reducesh_mask_round ((C), (D), (E), (A), (B), (F)))
+#define _mm512_maskz_cvt_roundph_epu32(A,B,C) ((__m512i) __builtin_ia32_vcvtph2udq512_mask_round ((B), (__v16si) _mm512_setzero_si512 (), (A), (C)))
+#define _mm512_shuffle_f32x4(X,Y,C) ((__m512) __builtin_ia32_shuf_f32x4_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(C), (__v16sf)(__m512)_mm512_undefined_ps(), (__mmask16)-1))
+#define _mm_mask_slli_epi64(W,U,X,C) ((__m128i)__builtin_ia32_psllqi128_mask ((__v2di)(__m128i)(X), (int)(C), (__v2di)(__m128i)(W), (__mmask8)(U)))
+#define _mm256_rol_epi32(A,B) ((__m256i)__builtin_ia32_prold256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i)_mm256_setzero_si256 (), (__mmask8)-1))
+#define _mm512_cmp_round_ph_mask(A,B,C,D) (__builtin_ia32_cmpph512_mask_round ((A), (B), (C), (-1), (D)))
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+#define __INO_T_MATCHES_INO64_T 1
+#define _mm512_mask_cmp_epi8_mask(M,X,Y,P) ((__mmask64) __builtin_ia32_cmpb512_mask ((__v64qi)(__m512i)(X), (__v64qi)(__m512i)(Y), (int)(P), (__mmask64)(M)))
+#define _mm256_mask_blend_pd(__U,__A,__W) ((__m256d) __builtin_ia32_blendmpd_256_mask ((__v4df) (__A), (__v4df) (__W), (__mmask8) (__U)))
+#define _mm256_mask_blend_ps(__U,__A,__W) ((__m256) __builtin_ia32_blendmps_256_mask ((__v8sf) (__A), (__v8sf) (__W), (__mmask8) (__U)))
+#define _XABORT_CAPACITY (1 << 3)
+#define _mm512_maskz_shuffle_i32x4(U,X,Y,C) ((__m512i) __builtin_ia32_shuf_i32x4_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(C), (__v16si)(__m512i)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _mm512_maskz_mul_round_ps(U,A,B,C) (__m512)__builtin_ia32_mulps512_mask(A, B, (__v16sf)_mm512_setzero_ps(), U, C)
+#define _mm_mask_cmp_epu8_mask(M,X,Y,P) ((__mmask16) __builtin_ia32_ucmpb128_mask ((__v16qi)(__m128i)(X), (__v16qi)(__m128i)(Y), (int)(P), (__mmask16)(M)))
+#define __enclu_bcd(leaf,b,c,d,retval) __asm__ __volatile__("enclu\n\t" : "=a" (retval) : "a" (leaf), "b" (b), "c" (c), "d" (d) : "cc")
+#define htole16(x) __uint16_identity (x)
+#define __GLIBC_USE_IEC_60559_EXT 0
+#define _mm512_maskz_scalef_round_pd(U,A,B,C) ((__m512d) __builtin_ia32_scalefpd512_mask((A), (B), (__v8df) _mm512_setzero_pd(), (U), (C)))
+#define __blkcnt_t_defined 
+#define _mm512_maskz_scalef_round_ph(A,B,C,D) (__builtin_ia32_scalefph512_mask_round ((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define __HAVE_FLOAT128 1
+#define UINT_LEAST32_MAX (4294967295U)
+#define __FLT16_DIG__ 3
+#define _mm256_rol_epi64(A,B) ((__m256i)__builtin_ia32_prolq256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)_mm256_setzero_si256 (), (__mmask8)-1))
+#define SCNxLEAST8 "hhx"
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+#define _MM_MASK_INVALID 0x0080
+#define _mm_fmsub_round_ss(A,B,C,R) (__m128)__builtin_ia32_vfmaddss3_round(A, B, -(C), R)
+#define _ALLOCA_H 1
+#define __LOCK_ALIGNMENT 
+#define _mm512_maskz_gf2p8affine_epi64_epi8(A,B,C,D) ((__m512i) __builtin_ia32_vgf2p8affineqb_v64qi_mask((__v64qi)(__m512i)(B), (__v64qi)(__m512i)(C), (int)(D), (__v64qi)(__m512i) _mm512_setzero_si512 (), (__mmask64)(A)))
+#define _mm_shuffle_epi32(A,N) ((__m128i)__builtin_ia32_pshufd ((__v4si)(__m128i)(A), (int)(N)))
+#define __time_t_defined 1
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+#define _AVX512FINTRIN_H_INCLUDED 
+#define SEEK_END 2
+#define _mm512_cmp_epu32_mask(X,Y,P) ((__mmask16) __builtin_ia32_ucmpd512_mask ((__v16si)(__m512i)(X), (__v16si)(__m512i)(Y), (int)(P), (__mmask16)-1))
+#define _mm_shldi_epi32(A,B,C) ((__m128i) __builtin_ia32_vpshld_v4si ((__v4si)(__m128i)(A), (__v4si)(__m128i)(B),(int)(C)))
+#define _mm_alignr_epi64(X,Y,C) ((__m128i)__builtin_ia32_alignq128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(C), (__v2di)(__m128i)(X), (__mmask8)-1))
+#define _XBEGIN_STARTED (~0u)
+#define _mm256_mask_getmant_pd(W,U,X,B,C) ((__m256d) __builtin_ia32_getmantpd256_mask ((__v4df)(__m256d) (X), (int)(((C)<<2) | (B)), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define _mm256_mask_getmant_ph(W,U,X,B,C) ((__m256h) __builtin_ia32_getmantph256_mask ((__v16hf)(__m256h) (X), (int)(((C)<<2) | (B)), (__v16hf)(__m256h)(W), (__mmask16)(U)))
+#define _mm_mask_cmp_round_sd_mask(M,X,Y,P,R) ((__mmask8) __builtin_ia32_cmpsd_mask ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(P), (M), R))
+#define _mm512_maskz_extracti32x4_epi32(U,X,C) ((__m128i) __builtin_ia32_extracti32x4_mask ((__v16si)(__m512i) (X), (int) (C), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm256_mask_getmant_ps(W,U,X,B,C) ((__m256) __builtin_ia32_getmantps256_mask ((__v8sf)(__m256) (X), (int)(((C)<<2) | (B)), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _mm512_mask_fnmsub_round_ph(A,U,B,C,R) ((__m512h)__builtin_ia32_vfnmsubph512_mask ((A), (B), (C), (U), (R)))
+#define RELEASE_ARCH __GIT_REVPARSE__
+#define _mm512_fnmsub_round_pd(A,B,C,R) (__m512d)__builtin_ia32_vfnmsubpd512_mask(A, B, C, -1, R)
+#define _mm512_fnmsub_round_ph(A,B,C,R) ((__m512h)__builtin_ia32_vfnmsubph512_mask ((A), (B), (C), -1, (R)))
+#define _mm512_fnmadd_round_ph(A,B,C,R) ((__m512h)__builtin_ia32_vfnmaddph512_mask ((A), (B), (C), -1, (R)))
+#define __DEC128_MAX_EXP__ 6145
+#define _mm_mul_pch(A,B) _mm_fmul_pch ((A), (B))
+#define _mm_mask_range_pd(W,U,A,B,C) ((__m128d) __builtin_ia32_rangepd128_mask ((__v2df)(__m128d)(A), (__v2df)(__m128d)(B), (int)(C), (__v2df)(__m128d)(W), (__mmask8)(U)))
+#define _mm_rol_epi32(A,B) ((__m128i)__builtin_ia32_prold128_mask ((__v4si)(__m128i)(A), (int)(B), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)-1))
+#define _mm_mask_range_ps(W,U,A,B,C) ((__m128) __builtin_ia32_rangeps128_mask ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)(__m128)(W), (__mmask8)(U)))
+#define PRIdFAST8 "d"
+#define _mm_mask_fcmul_round_sch(__A,__B,__C,__D,__E) (__m128h) __builtin_ia32_vfcmulcsh_mask_round ((__v8hf) __C, (__v8hf) __D, (__v8hf) __A, __B, __E)
+#define __GNUC_MINOR__ 2
+#define __DEC32_MANT_DIG__ 7
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+#define _mm_cmp_ss_mask(X,Y,P) ((__mmask8) __builtin_ia32_cmpss_mask ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(P), (__mmask8)-1,_MM_FROUND_CUR_DIRECTION))
+#define _mm256_cmp_epu64_mask(X,Y,P) ((__mmask8) __builtin_ia32_ucmpq256_mask ((__v4di)(__m256i)(X), (__v4di)(__m256i)(Y), (int)(P), (__mmask8)-1))
+#define _mm_cvt_roundu64_sh(A,B,C) (__builtin_ia32_vcvtusi2sh64_round ((A), (B), (C)))
+#define _mm_fpclass_ph_mask(X,C) ((__mmask8) __builtin_ia32_fpclassph128_mask ((__v8hf) (__m128h) (X), (int) (C),(__mmask8)-1))
+#define _mm_mask_cmul_sch(W,U,A,B) _mm_mask_fcmul_sch ((W), (U), (A), (B))
+#define _mm256_mask_shuffle_f32x4(W,U,X,Y,C) ((__m256) __builtin_ia32_shuf_f32x4_256_mask ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(C), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _mm_mask_fmul_round_sch(__A,__B,__C,__D,__E) (__m128h) __builtin_ia32_vfmulcsh_mask_round ((__v8hf) __C, (__v8hf) __D, (__v8hf) __A, __B, __E)
+#define _mm256_mask_i32scatter_epi32(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv8si ((void *) (ADDR), (__mmask8) (MASK), (__v8si)(__m256i) (INDEX), (__v8si)(__m256i) (V1), (int) (SCALE))
+#define _STDINT_H 1
+#define _mm512_shldi_epi32(A,B,C) ((__m512i) __builtin_ia32_vpshld_v16si ((__v16si)(__m512i)(A), (__v16si)(__m512i)(B),(int)(C)))
+#define __FILE_defined 1
+#define _mm_mask_range_ss(W,U,A,B,C) ((__m128) __builtin_ia32_rangess128_mask_round ((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), (int)(C), (__v4sf)(__m128)(W), (__mmask8)(U), _MM_FROUND_CUR_DIRECTION))
+#define _mm512_rsqrt28_pd(A) _mm512_rsqrt28_round_pd(A, _MM_FROUND_CUR_DIRECTION)
+#define _mm512_rsqrt28_ps(A) _mm512_rsqrt28_round_ps(A, _MM_FROUND_CUR_DIRECTION)
+#define _kandn_mask16 _mm512_kandn
+#define _mm256_clmulepi64_epi128(A,B,C) ((__m256i) __builtin_ia32_vpclmulqdq_v4di ((__v4di)(__m256i)(A), (__v4di)(__m256i)(B), (int)(C)))
+#define SCNuFAST8 "hhu"
+#define _mm512_permutex_epi64(X,I) ((__m512i) __builtin_ia32_permdi512_mask ((__v8di)(__m512i)(X), (int)(I), (__v8di)(__m512i) (_mm512_undefined_epi32 ()), (__mmask8)(-1)))
+#define _mm_getexp_ss(A,B) ((__m128)__builtin_ia32_getexpss128_round((__v4sf)(__m128)(A), (__v4sf)(__m128)(B), _MM_FROUND_CUR_DIRECTION))
+#define _mm_cvtt_roundss_si32(A,B) ((int)__builtin_ia32_vcvttss2si32(A, B))
+#define _mm512_shrdi_epi16(A,B,C) ((__m512i) __builtin_ia32_vpshrd_v32hi ((__v32hi)(__m512i)(A), (__v32hi)(__m512i)(B),(int)(C)))
+#define _mm_i32gather_epi64(BASE,INDEX,SCALE) (__m128i) __builtin_ia32_gathersiv2di ((__v2di) _mm_setzero_si128 (), (long long const *) (BASE), (__v4si)(__m128i) (INDEX), (__v2di)_mm_set1_epi64x (-1), (int) (SCALE))
+#define _mm_cvt_roundsh_u64(A,B) ((long long)__builtin_ia32_vcvtsh2usi64_round ((A), (B)))
+#define _mm512_maskz_cvtt_roundph_epi32(A,B,C) ((__m512i) __builtin_ia32_vcvttph2dq512_mask_round ((B), (__v16si) _mm512_setzero_si512 (), (A), (C)))
+#define _mm512_maskz_div_round_pd(U,A,B,C) (__m512d)__builtin_ia32_divpd512_mask(A, B, (__v8df)_mm512_setzero_pd(), U, C)
+#define _mm512_reduce_round_ph(A,B,C) (__builtin_ia32_reduceph512_mask_round ((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define _mm512_maskz_div_round_ps(U,A,B,C) (__m512)__builtin_ia32_divps512_mask(A, B, (__v16sf)_mm512_setzero_ps(), U, C)
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+#define _mm256_mask_i32scatter_epi64(ADDR,MASK,INDEX,V1,SCALE) __builtin_ia32_scattersiv4di ((void *) (ADDR), (__mmask8) (MASK), (__v4si)(__m128i) (INDEX), (__v4di)(__m256i) (V1), (int) (SCALE))
+#define _mm_clmulepi64_si128(X,Y,I) ((__m128i) __builtin_ia32_pclmulqdq128 ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(I)))
+#define _mm512_cmp_ps_mask(X,Y,P) ((__mmask16) __builtin_ia32_cmpps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(P), (__mmask16)-1,_MM_FROUND_CUR_DIRECTION))
+#define _mm256_mask_srli_epi16(W,U,A,B) ((__m256i) __builtin_ia32_psrlwi256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)(__m256i)(W), (__mmask16)(U)))
+#define __FIRMWARE_BOARD_SIMULINUX__ 1
+#define _mm_maskz_alignr_epi32(U,X,Y,C) ((__m128i)__builtin_ia32_alignd128_mask ((__v4si)(__m128i)(X), (__v4si)(__m128i)(Y), (int)(C), (__v4si)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define __fsblkcnt_t_defined 
+#define _mm512_scalef_round_ph(A,B,C) (__builtin_ia32_scalefph512_mask_round ((A), (B), _mm512_setzero_ph (), (__mmask32)-1, (C)))
+#define _F16CINTRIN_H_INCLUDED 
+#define _SMMINTRIN_H_INCLUDED 
+#define _mm512_cvtt_roundps_epi32(A,B) ((__m512i)__builtin_ia32_cvttps2dq512_mask(A, (__v16si)_mm512_undefined_epi32 (), -1, B))
+#define _mm_cvtt_roundss_si64(A,B) ((long long)__builtin_ia32_vcvttss2si64(A, B))
+#define __ATOMIC_SEQ_CST 5
+#define COMMPORT_TYPE_FD 1
+#define _mm512_cmp_round_ps_mask(X,Y,P,R) ((__mmask16) __builtin_ia32_cmpps512_mask ((__v16sf)(__m512)(X), (__v16sf)(__m512)(Y), (int)(P), (__mmask16)-1, R))
+#define _mm256_mask_srli_epi32(W,U,A,B) ((__m256i) __builtin_ia32_psrldi256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define __LONG_MAX__ 0x7fffffffffffffffL
+#define _mm512_maskz_cvt_roundepu64_pd(U,A,B) ((__m512d)__builtin_ia32_cvtuqq2pd512_mask ((__v8di)(A), (__v8df)_mm512_setzero_pd (), (U), (B)))
+#define _mm512_maskz_cvt_roundepu64_ph(A,B,C) (__builtin_ia32_vcvtuqq2ph512_mask_round ((__v8di)(B), _mm_setzero_ph (), (A), (C)))
+#define __UINT32_TYPE__ unsigned int
+#define __FLT32X_MIN_10_EXP__ (-307)
+#define _mm512_maskz_cvt_roundepu64_ps(U,A,B) ((__m256)__builtin_ia32_cvtuqq2ps512_mask ((__v8di)(A), (__v8sf)_mm256_setzero_ps (), (U), (B)))
+#define _mm_mask_shufflehi_epi16(W,U,A,B) ((__m128i) __builtin_ia32_pshufhw128_mask ((__v8hi)(__m128i)(A), (int)(B), (__v8hi)(__m128i)(W), (__mmask8)(U)))
+#define _mm256_mask_srai_epi16(W,U,A,B) ((__m256i) __builtin_ia32_psrawi256_mask ((__v16hi)(__m256i)(A), (int)(B), (__v16hi)(__m256i)(W), (__mmask16)(U)))
+#define RX_BUFFER_SIZE 64
+#define _mm_maskz_alignr_epi64(U,X,Y,C) ((__m128i)__builtin_ia32_alignq128_mask ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (int)(C), (__v2di)(__m128i)_mm_setzero_si128 (), (__mmask8)(U)))
+#define _mm_maskz_cvt_roundps_ph(A,B,C) _mm_maskz_cvtps_ph ((A), (B), (C))
+#define _mm_mask_getexp_round_sd(W,U,A,B,C) (__m128d)__builtin_ia32_getexpsd_mask_round(A, B, W, U, C)
+#define _mm_mask_getexp_round_ss(W,U,A,B,C) (__m128)__builtin_ia32_getexpss_mask_round(A, B, W, U, C)
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define _____fpos_t_defined 1
+#define _mm_cvt_roundss_si32(A,B) ((int)__builtin_ia32_vcvtss2si32(A, B))
+#define __WCHAR_T__ 
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+#define _mm256_reduce_pd(A,B) ((__m256d) __builtin_ia32_reducepd256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)_mm256_setzero_pd(), (__mmask8)-1))
+#define PRId32 "d"
+#define CLOCK_BOOTTIME_ALARM 9
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+#define _mm_srli_si128(A,N) ((__m128i)__builtin_ia32_psrldqi128 ((__m128i)(A), (int)(N) * 8))
+#define _MM_FROUND_RINT (_MM_FROUND_CUR_DIRECTION | _MM_FROUND_RAISE_EXC)
+#define _mm256_mask_srai_epi32(W,U,A,B) ((__m256i) __builtin_ia32_psradi256_mask ((__v8si)(__m256i)(A), (int)(B), (__v8si)(__m256i)(W), (__mmask8)(U)))
+#define _mm256_mask_srli_epi64(W,U,A,B) ((__m256i) __builtin_ia32_psrlqi256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define _mm256_insertf64x2(X,Y,C) ((__m256d) __builtin_ia32_insertf64x2_256_mask ((__v4df)(__m256d) (X), (__v2df)(__m128d) (Y), (int) (C), (__v4df)(__m256d)_mm256_setzero_pd(), (__mmask8)-1))
+#define __SIZEOF_LONG_LONG__ 8
+#define _mm512_alignr_epi64(X,Y,C) ((__m512i)__builtin_ia32_alignq512_mask ((__v8di)(__m512i)(X), (__v8di)(__m512i)(Y), (int)(C), (__v8di)_mm512_undefined_epi32 (), (__mmask8)-1))
+#define _HRESETINTRIN_H_INCLUDED 
+#define _mm256_mask_reduce_pd(W,U,A,B) ((__m256d) __builtin_ia32_reducepd256_mask ((__v4df)(__m256d)(A), (int)(B), (__v4df)(__m256d)(W), (__mmask8)(U)))
+#define _mm256_mask_reduce_ph(A,B,C,D) (__builtin_ia32_reduceph256_mask ((C), (D), (A), (B)))
+#define _mm256_mask_cmp_epu32_mask(M,X,Y,P) ((__mmask8) __builtin_ia32_ucmpd256_mask ((__v8si)(__m256i)(X), (__v8si)(__m256i)(Y), (int)(P), (__mmask8)(M)))
+#define _mm256_mask_reduce_ps(W,U,A,B) ((__m256) __builtin_ia32_reduceps256_mask ((__v8sf)(__m256)(A), (int)(B), (__v8sf)(__m256)(W), (__mmask8)(U)))
+#define _kand_mask16 _mm512_kand
+#define _GCC_PTRDIFF_T 
+#define _mm512_i64scatter_pd(ADDR,INDEX,V1,SCALE) __builtin_ia32_scatterdiv8df ((void *) (ADDR), (__mmask8)0xFF, (__v8di)(__m512i) (INDEX), (__v8df)(__m512d) (V1), (int) (SCALE))
+#define _mm_cvt_roundss_si64(A,B) ((long long)__builtin_ia32_vcvtss2si64(A, B))
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+#define _mm512_mask_cvt_roundpd_epu32(W,U,A,B) ((__m256i)__builtin_ia32_cvtpd2udq512_mask(A, (__v8si)(W), U, B))
+#define F_CPU 16000000UL
+#define _mm_inserti_si64(X,Y,I,L) ((__m128i) __builtin_ia32_insertqi ((__v2di)(__m128i)(X), (__v2di)(__m128i)(Y), (unsigned int)(I), (unsigned int)(L)))
+#define __LDBL_DIG__ 18
+#define PRId64 __PRI64_PREFIX "d"
+#define _kxnor_mask16 _mm512_kxnor
+#define _mm256_mask_srai_epi64(W,U,A,B) ((__m256i) __builtin_ia32_psraqi256_mask ((__v4di)(__m256i)(A), (int)(B), (__v4di)(__m256i)(W), (__mmask8)(U)))
+#define _mm256_maskz_ternarylogic_epi32(U,A,B,C,I) ((__m256i) __builtin_ia32_pternlogd256_maskz ((__v8si) (__m256i) (A), (__v8si) (__m256i) (B), (__v8si) (__m256i) (C), (unsigned char) (I), (__mmask8) (U)))
+#define __ldiv_t_defined 1
+#define ___int_ptrdiff_t_h 
+#define _mm512_extracti64x4_epi64(X,C) ((__m256i) __builtin_ia32_extracti64x4_mask ((__v8di)(__m512i) (X), (int) (C), (__v4di)(__m256i)_mm256_undefined_si256 (), (__mmask8)-1))
+#define _MM_EXCEPT_MASK 0x003f
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+#define _mm512_maskz_rol_epi32(U,A,B) ((__m512i)__builtin_ia32_prold512_mask ((__v16si)(__m512i)(A), (int)(B), (__v16si)_mm512_setzero_si512 (), (__mmask16)(U)))
+#define _mm256_maskz_extracti64x2_epi64(U,X,C) ((__m128i) __builtin_ia32_extracti64x2_256_mask ((__v4di)(__m256i) (X), (int) (C), (__v2di)(__m128i) _mm_setzero_si128 (), (__mmask8) (U)))
+#define _lrotl(a,b) __rolq((a), (b))
+#define PRIoFAST8 "o"
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+#define _mm512_mask_cvt_roundpd_epu64(W,U,A,B) ((__m512i)__builtin_ia32_cvtpd2uqq512_mask ((A), (__v8di)(W), (U), (B)))
+#define _mm_maskz_cvtps_ph(U,A,I) ((__m128i) __builtin_ia32_vcvtps2ph_mask ((__v4sf)(__m128) (A), (int) (I), (__v8hi)(__m128i) _mm_setzero_si128 (), (__mmask8) (U)))
+#define _mm_mask_i32gather_epi32(SRC,BASE,INDEX,MASK,SCALE) (__m128i) __builtin_ia32_gathersiv4si ((__v4si)(__m128i) (SRC), (int const *) (BASE), (__v4si)(__m128i) (INDEX), (__v4si)(__m128i) (MASK), (int) (SCALE))
+#define _mm512_maskz_div_round_ph(A,B,C,D) ((__m512h)__builtin_ia32_divph512_mask_round((B), (C), _mm512_setzero_ph (), (A), (D)))
+#define _mm_maskz_fixupimm_round_sd(U,X,Y,Z,C,R) ((__m128d)__builtin_ia32_fixupimmsd_maskz ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (__v2di)(__m128i)(Z), (int)(C), (__mmask8)(U), (R)))
+#define _mm512_mask3_fmadd_round_ph(A,B,C,U,R) ((__m512h)__builtin_ia32_vfmaddph512_mask3 ((A), (B), (C), (U), (R)))
+#define _knot_mask16 _mm512_knot
+#define _mm_maskz_fixupimm_round_ss(U,X,Y,Z,C,R) ((__m128)__builtin_ia32_fixupimmss_maskz ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (__v4si)(__m128i)(Z), (int)(C), (__mmask8)(U), (R)))
+#define _AVX2INTRIN_H_INCLUDED 
+#define PWM_MIN_RESOLUTION 8
+#define _mm256_maskz_shuffle_f32x4(U,X,Y,C) ((__m256) __builtin_ia32_shuf_f32x4_256_mask ((__v8sf)(__m256)(X), (__v8sf)(__m256)(Y), (int)(C), (__v8sf)(__m256)_mm256_setzero_ps (), (__mmask8)(U)))
+#define __WCHAR_T 
+#define _mm_mask_getmant_round_sd(W,U,X,Y,C,D,R) ((__m128d)__builtin_ia32_getmantsd_mask_round ((__v2df)(__m128d)(X), (__v2df)(__m128d)(Y), (int)(((D)<<2) | (C)), (__v2df)(__m128d)(W), (__mmask8)(U), (R)))
+#define _mm_mask_min_round_sh(A,B,C,D,E) (__builtin_ia32_minsh_mask_round ((C), (D), (A), (B), (E)))
+#define _mm_mask_getmant_round_sh(W,U,X,Y,C,D,R) ((__m128h)__builtin_ia32_getmantsh_mask_round ((__v8hf)(__m128h)(X), (__v8hf)(__m128h)(Y), (int)(((D)<<2) | (C)), (__v8hf)(__m128h)(W), (__mmask8)(U), (R)))
+#define _mm_fpclass_ps_mask(X,C) ((__mmask8) __builtin_ia32_fpclassps128_mask ((__v4sf) (__m128) (X), (int) (C),(__mmask8)-1))
+#define _mm_mask_getmant_round_ss(W,U,X,Y,C,D,R) ((__m128)__builtin_ia32_getmantss_mask_round ((__v4sf)(__m128)(X), (__v4sf)(__m128)(Y), (int)(((D)<<2) | (C)), (__v4sf)(__m128)(W), (__mmask8)(U), (R)))
+#define _mm512_maskz_rol_epi64(U,A,B) ((__m512i)__builtin_ia32_prolq512_mask ((__v8di)(__m512i)(A), (int)(B), (__v8di)_mm512_setzero_si512 (), (__mmask8)(U)))
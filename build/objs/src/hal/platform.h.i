@@ -0,0 +1,10 @@
+enum pin_e {
+    P1 = 0,
+    P2 = 1,
+    P3 = 2,
+    P4 = 3,
+    P5 = 4,
+    P6 = 5,
+    P7 = 6,
+    P8 = 7,
+};
@@ -0,0 +1,1681 @@
+#define _BITS_FLOATN_COMMON_H 
+#define _SC_CHAR_MIN _SC_CHAR_MIN
+#define COMMPORT_TYPE_TTY 4
+#define PRIXFAST32 __PRIPTR_PREFIX "X"
+#define STATUS_EMERGENCY_STOP 0xF9
+#define __attr_access(x) __attribute__ ((__access__ x))
+#define __DBL_MIN_EXP__ (-1021)
+#define _SC_XOPEN_UNIX _SC_XOPEN_UNIX
+#define STATUS_SIGNAL 0xF3
+#define ____sigset_t_defined 
+#define _PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED
+#define _CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS
+#define _ALLOCA_H 1
+#define SYSEX_DEVICE_REP 0x47
+#define SYSEX_DEVICE_REQ 0x46
+#define _POSIX_THREAD_PRIORITY_SCHEDULING 200809L
+#define _POSIX_SHARED_MEMORY_OBJECTS 200809L
+#define __CFLOAT32 _Complex _Float32
+#define __UINT_LEAST16_MAX__ 0xffff
+#define _STDBOOL_H 
+#define __FLT16_HAS_QUIET_NAN__ 1
+#define _SC_RE_DUP_MAX _SC_RE_DUP_MAX
+#define __ATOMIC_ACQUIRE 2
+#define COMMPORT_ERROR_NO 0
+#define _POSIX2_SW_DEV __POSIX2_THIS_VERSION
+#define __FLT128_MAX_10_EXP__ 4932
+#define _CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS
+#define _SC_PII_OSI_COTS _SC_PII_OSI_COTS
+#define SYSEX_ANALOG_PIN_DATA 0x03
+#define _SC_NGROUPS_MAX _SC_NGROUPS_MAX
+#define PRIXFAST64 __PRI64_PREFIX "X"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+#define __GCC_IEC_559_COMPLEX 2
+#define SCNiFAST8 "hhi"
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define _SC_SPIN_LOCKS _SC_SPIN_LOCKS
+#define _SC_TIMEOUTS _SC_TIMEOUTS
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+#define _PC_MAX_INPUT _PC_MAX_INPUT
+#define __UINT_LEAST8_TYPE__ unsigned char
+#define __SIZEOF_FLOAT80__ 16
+#define _T_WCHAR_ 
+#define _SC_IPV6 _SC_IPV6
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+#define INT_LEAST16_MIN (-32767-1)
+#define _SC_XOPEN_REALTIME _SC_XOPEN_REALTIME
+#define __CFLOAT64 _Complex _Float64
+#define __flexarr []
+#define _SC_LINE_MAX _SC_LINE_MAX
+#define __S64_TYPE long int
+#define _POSIX_PRIORITIZED_IO 200809L
+#define _SC_LONG_BIT _SC_LONG_BIT
+#define __stub_fchflags 
+#define PRIuPTR __PRIPTR_PREFIX "u"
+#define __SQUAD_TYPE long int
+#define __DEFINED_ptrdiff_t 
+#define GPIO_REG(pin) ((pin) >> 4)
+#define __INTMAX_C(c) c ## L
+#define _SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE
+#define _BSD_SIZE_T_DEFINED_ 
+#define SYSEX_RCSWITCH_IN 0x48
+#define __socklen_t_defined 
+#define __CHAR_BIT__ 8
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+#define PROTOCOL_ERR_TOTAL 7
+#define _SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS
+#define IRQ_PRIORITY 0
+#define PROTOCOL_ERR_SIZE 2
+#define _SC_XOPEN_VERSION _SC_XOPEN_VERSION
+#define __UINT8_MAX__ 0xff
+#define _POSIX_CLOCK_SELECTION 200809L
+#define _POSIX_TYPED_MEMORY_OBJECTS -1
+#define __SCHAR_WIDTH__ 8
+#define _SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS
+#define PRIiLEAST16 "i"
+#define INT16_C(c) c
+#define __WINT_MAX__ 0xffffffffU
+#define PIN_MODE_SHIFT 11
+#define _SC_TTY_NAME_MAX _SC_TTY_NAME_MAX
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define __FLT32_MIN_EXP__ (-125)
+#define _SC_XOPEN_XPG2 _SC_XOPEN_XPG2
+#define INT8_MAX (127)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+#define _SC_XOPEN_XPG4 _SC_XOPEN_XPG4
+#define stderr stderr
+#define _CS_LFS_LIBS _CS_LFS_LIBS
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define RELAY_NODE_MAX 127
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+#define PRIXLEAST8 "X"
+#define _CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS
+#define va_start(v,l) __builtin_va_start(v,l)
+#define _SC_PII_SOCKET _SC_PII_SOCKET
+#define _SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32
+#define __OFF_T_MATCHES_OFF64_T 1
+#define __ORDER_LITTLE_ENDIAN__ 1234
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+#define PRIdMAX __PRI64_PREFIX "d"
+#define __WCHAR_MAX__ 0x7fffffff
+#define SCNx16 "hx"
+#define PIN_MODE_I2C 8
+#define _SC_2_C_DEV _SC_2_C_DEV
+#define _SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE
+#define TX_BUFFER_SIZE 64
+#define INT16_MAX (32767)
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+#define SYSEX_SUB_VERSION_HAL 4
+#define __GCC_IEC_559 2
+#define __FLT32X_DECIMAL_DIG__ 17
+#define _IOFBF 0
+#define __FLT_EVAL_METHOD__ 0
+#define _SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF
+#define _SC_SPORADIC_SERVER _SC_SPORADIC_SERVER
+#define _IO_USER_LOCK 0x8000
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+#define _SC_XOPEN_STREAMS _SC_XOPEN_STREAMS
+#define _SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT
+#define _SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN
+#define _CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS
+#define __FLT64_DECIMAL_DIG__ 17
+#define _XOPEN_VERSION 700
+#define __HAVE_GENERIC_SELECTION 1
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+#define __HAVE_FLOAT64 1
+#define COMMPORT_ERROR_BUFOVF 4
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+#define INT8_MIN (-128)
+#define GPIO_MASK(pin) _BV((pin) & 0xf)
+#define be64toh(x) __bswap_64 (x)
+#define __DEFINED_wchar_t 
+#define _SC_2_CHAR_TERM _SC_2_CHAR_TERM
+#define _CS_LFS_CFLAGS _CS_LFS_CFLAGS
+#define _SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX
+#define TIMER16 0
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+#define __DEFINED_size_t 
+#define bool _Bool
+#define __CFLOAT128 _Complex _Float128
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define _SC_CPUTIME _SC_CPUTIME
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+#define __SIG_ATOMIC_TYPE__ int
+#define _CS_PATH _CS_PATH
+#define __COMPAR_FN_T 
+#define __GID_T_TYPE __U32_TYPE
+#define _SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT
+#define __STATFS_MATCHES_STATFS64 1
+#define __DBL_MIN_10_EXP__ (-307)
+#define INT16_MIN (-32767-1)
+#define TIMER32 3
+#define __FINITE_MATH_ONLY__ 0
+#define __id_t_defined 
+#define _SC_PAGE_SIZE _SC_PAGESIZE
+#define PRIi32 "i"
+#define _SC_SCHAR_MAX _SC_SCHAR_MAX
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+#define __FLT32X_MAX_EXP__ 1024
+#define _SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG
+#define PRIxPTR __PRIPTR_PREFIX "x"
+#define __u_char_defined 
+#define _SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS
+#define WIFEXITED(status) __WIFEXITED (status)
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+#define __pid_t_defined 
+#define __FLT32_HAS_DENORM__ 1
+#define SPI_CH 0
+#define _POSIX_TRACE_EVENT_FILTER -1
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS
+#define __UINT_FAST8_MAX__ 0xff
+#define __LEAF , __leaf__
+#define _THREAD_MUTEX_INTERNAL_H 1
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define _BITS_TYPES_LOCALE_T_H 1
+#define __size_t 
+#define _POSIX_SPIN_LOCKS 200809L
+#define SCNdLEAST8 "hhd"
+#define __FLT32_MAX_10_EXP__ 38
+#define BIT_GET(p,m) ((p) & (m))
+#define INT_FAST8_MAX (127)
+#define __DEC64_MAX_EXP__ 385
+#define _WCHAR_T_DEFINED 
+#define _POSIX_V7_LP64_OFF64 1
+#define _XOPEN_XCU_VERSION 4
+#define PRIX16 "X"
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define _SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES
+#define __INT8_C(c) c
+#define WCHAR_MAX __WCHAR_MAX
+#define __INT_LEAST8_WIDTH__ 8
+#define PWM_MAX_RESOLUTION 0
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+#define SYSEX_PINSTATE_REP 0x45
+#define SYSEX_PINSTATE_REQ 0x44
+#define _XBS5_LPBIG_OFFBIG -1
+#define _SC_UIO_MAXIOV _SC_UIO_MAXIOV
+#define _SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION
+#define __always_inline __inline __attribute__ ((__always_inline__))
+#define _SC_PII_OSI_M _SC_PII_OSI_M
+#define NFDBITS __NFDBITS
+#define __SHRT_MAX__ 0x7fff
+#define SCNd8 "hhd"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define _SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX
+#define __FLT64X_MAX_10_EXP__ 4932
+#define CEIL127(a) ({ __typeof__ (a) _a = (a); _a < 127 ? _a : 127; })
+#define __ILP32_OFFBIG_CFLAGS "-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64"
+#define SYSEX_SUB_SCHED_TASK_REP 8
+#define SYSEX_SUB_SCHED_TASK_REQ 7
+#define _SC_SCHAR_MIN _SC_SCHAR_MIN
+#define PIN_MODE_PWM 4
+#define __daddr_t_defined 
+#define _POSIX_SYNCHRONIZED_IO 200809L
+#define __LDBL_IS_IEC_60559__ 2
+#define INT_FAST16_MAX (9223372036854775807L)
+#define SYSEX_SUB_SCHED_ERROR_REP 9
+#define __fortify_function __extern_always_inline __attribute_artificial__
+#define __FLT64X_HAS_QUIET_NAN__ 1
+#define SYSEX_SUB_RELAY_ROUTE_ADD 1
+#define SCNd16 "hd"
+#define _POSIX_VERSION 200809L
+#define _CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION
+#define _SC_SHRT_MIN _SC_SHRT_MIN
+#define _POSIX_JOB_CONTROL 1
+#define __UINT_LEAST8_MAX__ 0xff
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+#define _SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64
+#define _SC_SYMLOOP_MAX _SC_SYMLOOP_MAX
+#define __UINTMAX_TYPE__ long unsigned int
+#define _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define _SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX
+#define INT_FAST8_MIN (-128)
+#define STATUS_SYSTEM_PAUSE 0xFA
+#define SCNd32 "d"
+#define BIT_WRITE(c,p,m) (c ? BIT_SET(p,m) : BIT_CLEAR(p,m))
+#define _POSIX_THREAD_CPUTIME 0
+#define __linux 1
+#define __DEC32_EPSILON__ 1E-6DF
+#define WCHAR_MIN __WCHAR_MIN
+#define __PRIPTR_PREFIX "l"
+#define htobe16(x) __bswap_16 (x)
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+#define _BITS_TYPES_H 1
+#define PROTOCOL_ERR_EVENT_UNKNOWN 6
+#define __unix 1
+#define SCNo16 "ho"
+#define ____gwchar_t_defined 1
+#define _BITS_PTHREADTYPES_ARCH_H 1
+#define NULL ((void *)0)
+#define __UINT32_MAX__ 0xffffffffU
+#define __UID_T_TYPE __U32_TYPE
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+#define _POSIX_READER_WRITER_LOCKS 200809L
+#define _SC_MB_LEN_MAX _SC_MB_LEN_MAX
+#define __SIZE_T 
+#define SCNd64 __PRI64_PREFIX "d"
+#define _BITS_POSIX_OPT_H 1
+#define _SC_PII _SC_PII
+#define SCNo32 "o"
+#define _SC_USHRT_MAX _SC_USHRT_MAX
+#define _SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R
+#define _ATFILE_SOURCE 1
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+#define SCNuLEAST16 "hu"
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define _SC_NETWORKING _SC_NETWORKING
+#define __FLT128_MIN_EXP__ (-16381)
+#define __WINT_MIN__ 0U
+#define STATUS_DIGITAL_PIN_REPORT 0xB0
+#define PRIxFAST8 "x"
+#define WUNTRACED 2
+#define SYSEX_MOD_ASYNC 0x7D
+#define _SC_SHELL _SC_SHELL
+#define SYSEX_FEATURES 0x21
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define _POSIX_V6_LP64_OFF64 1
+#define UINT16_C(c) c
+#define SCNo8 "hho"
+#define __FLT128_MIN_10_EXP__ (-4931)
+#define __FLT32X_IS_IEC_60559__ 2
+#define SCNo64 __PRI64_PREFIX "o"
+#define _PC_PRIO_IO _PC_PRIO_IO
+#define EXIT_FAILURE 1
+#define _STDARG_H 
+#define __INT_LEAST16_WIDTH__ 16
+#define _SIZE_T_DEFINED_ 
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __SCHAR_MAX__ 0x7f
+#define __FLT128_MANT_DIG__ 113
+#define _SC_SELECT _SC_SELECT
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+#define __KERNEL_STRICT_NAMES 
+#define SCNxFAST16 __PRIPTR_PREFIX "x"
+#define __INT64_C(c) c ## L
+#define SCNuLEAST64 __PRI64_PREFIX "u"
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define _CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS
+#define _SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+#define __INT_WCHAR_T_H 
+#define WSTOPPED 2
+#define _CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS
+#define SYSEX_MOD_EXTEND 0x7F
+#define I2C_CH 0
+#define SCNoFAST64 __PRI64_PREFIX "o"
+#define STDOUT_FILENO 1
+#define _SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC
+#define _SC_2_C_BIND _SC_2_C_BIND
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+#define _CS_V6_ENV _CS_V6_ENV
+#define PRIxFAST32 __PRIPTR_PREFIX "x"
+#define _SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+#define SYSEX_SUB_VERSION_ALL 127
+#define _SC_2_UPE _SC_2_UPE
+#define _POSIX_SOURCE 1
+#define RELEASE_HAL __GIT_REVPARSE__
+#define _SC_PII_OSI_CLTS _SC_PII_OSI_CLTS
+#define _DEFAULT_SOURCE 1
+#define STATUS_ANALOG_PIN_SET 0xE0
+#define PIN_MODE_OUTPUT 3
+#define _SC_XOPEN_SHM _SC_XOPEN_SHM
+#define __attribute_used__ __attribute__ ((__used__))
+#define PRIuLEAST16 "u"
+#define SCNxFAST64 __PRI64_PREFIX "x"
+#define __LOCK_ALIGNMENT 
+#define __FLT32X_MANT_DIG__ 53
+#define _XOPEN_REALTIME_THREADS 1
+#define PRIuFAST16 __PRIPTR_PREFIX "u"
+#define _SC_VERSION _SC_VERSION
+#define SCNx32 "x"
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+#define STATUS_PROTOCOL_VERSION 0xF0
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+#define _SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM
+#define SCNx8 "hhx"
+#define _BITS_ENDIANNESS_H 1
+#define PRIuLEAST32 "u"
+#define _SC_BC_SCALE_MAX _SC_BC_SCALE_MAX
+#define __GLIBC__ 2
+#define _SC_POLL _SC_POLL
+#define EXIT_SUCCESS 0
+#define __END_DECLS 
+#define PRIuFAST32 __PRIPTR_PREFIX "u"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+#define _POSIX_V6_LPBIG_OFFBIG -1
+#define __CONCAT(x,y) x ## y
+#define PIN_MODE_IGNORE 14
+#define _SC_RTSIG_MAX _SC_RTSIG_MAX
+#define WCONTINUED 8
+#define __STDC_HOSTED__ 1
+#define _SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX
+#define SYSEX_DIGITAL_PIN_DATA 0x02
+#define PIN_MODE_TTY 7
+#define GPIO_ATOMIC(pin,expr) do { if (pin < GPIO_ATOMIC_MAX) { expr; } else { uint8_t sreg = SREG; __asm__ __volatile__("cli" ::: "memory"); expr; SREG = sreg; __asm__ __volatile__("" ::: "memory"); } } while (0)
+#define __SLONG32_TYPE int
+#define _BITS_UINTN_IDENTITY_H 1
+#define _SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE
+#define _SYS_SELECT_H 1
+#define PRIuLEAST64 __PRI64_PREFIX "u"
+#define __DEC64_MIN_EXP__ (-382)
+#define _XOPEN_ENH_I18N 1
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define COMMPORT_ERROR_DATAOVR 2
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+#define _SC_TZNAME_MAX _SC_TZNAME_MAX
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS
+#define __GNU_LIBRARY__ 6
+#define SCNi32 "i"
+#define __DBL_DIG__ 15
+#define SYSEX_SUB_I2C_ 0
+#define __FLT32_DIG__ 6
+#define __f32x(x) x ##f32x
+#define _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS
+#define __RLIM_T_MATCHES_RLIM64_T 1
+#define _SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+#define INT32_MIN (-2147483647-1)
+#define STATUS_SYSTEM_RESUME 0xFB
+#define _IO_EOF_SEEN 0x0010
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define _SC_TIMER_MAX _SC_TIMER_MAX
+#define _POSIX_SPAWN 200809L
+#define __SHRT_WIDTH__ 16
+#define __f64x(x) x ##f64x
+#define PROTOCOL_H 
+#define _STDIO_H 1
+#define TMP_MAX 238328
+#define __FLT32_IS_IEC_60559__ 2
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define SYSEX_SUB_VERSION_PROTOCOL 3
+#define PROTOCOL_USE_CRC 1
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+#define __STDC_UTF_16__ 1
+#define _____fpos_t_defined 1
+#define __nonnull(params) __attribute_nonnull__ (params)
+#define __DBL_IS_IEC_60559__ 2
+#define le32toh(x) __uint32_identity (x)
+#define _SIZE_T_DEFINED 
+#define __DEC32_MAX__ 9.999999E96DF
+#define PIN_IS_DIGITAL(p) (0)
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+#define SYSEX_SUB_ANALOG_DATA_ 0
+#define _SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+#define _WCHAR_T_ 
+#define _POSIX_THREAD_ATTR_STACKSIZE 200809L
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+#define _STDDEF_H 
+#define _SC_MEMLOCK _SC_MEMLOCK
+#define _VA_LIST_DEFINED 
+#define __FLT32X_HAS_INFINITY__ 1
+#define _SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE
+#define __INT32_MAX__ 0x7fffffff
+#define _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS
+#define __GLIBC_USE_DEPRECATED_GETS 0
+#define __SIZEOF_PTHREAD_COND_T 48
+#define SCNoLEAST16 "ho"
+#define _POSIX_THREAD_SAFE_FUNCTIONS 200809L
+#define __FLT16_DIG__ 3
+#define _POSIX_V7_LPBIG_OFFBIG -1
+#define __unix__ 1
+#define __INT_WIDTH__ 32
+#define __SIZEOF_LONG__ 8
+#define _IONBF 2
+#define F_LOCK 1
+#define __STDC_IEC_559__ 1
+#define __STDC_ISO_10646__ 201706L
+#define PRIoFAST16 __PRIPTR_PREFIX "o"
+#define PRIX64 __PRI64_PREFIX "X"
+#define _SC_NL_NMAX _SC_NL_NMAX
+#define __UINT16_C(c) c
+#define SYSEX_SUB_VERSION_ARCH 6
+#define _SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R
+#define SCNoLEAST32 "o"
+#define STATUS_SYSEX_END 0xFE
+#define __DECIMAL_DIG__ 21
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+#define __USE_FORTIFY_LEVEL 0
+#define __STDC_IEC_559_COMPLEX__ 1
+#define PRIoFAST32 __PRIPTR_PREFIX "o"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+#define __gnu_linux__ 1
+#define _SC_T_IOV_MAX _SC_T_IOV_MAX
+#define _SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX
+#define __FLT128_IS_IEC_60559__ 2
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+#define _SC_2_SW_DEV _SC_2_SW_DEV
+#define _PC_FILESIZEBITS _PC_FILESIZEBITS
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+#define SCNdLEAST32 "d"
+#define __bool_true_false_are_defined 1
+#define _CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS
+#define _SC_CLOCK_SELECTION _SC_CLOCK_SELECTION
+#define RELEASE_PROTOCOL __GIT_REVPARSE__
+#define PRIX8 "X"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+#define _SC_UINT_MAX _SC_UINT_MAX
+#define F_OK 0
+#define PULSE_SLOTS (1000/PULSE_SLOT_US)
+#define __LDBL_HAS_QUIET_NAN__ 1
+#define INT64_C(c) c ## L
+#define PRIuFAST8 "u"
+#define PRIoFAST64 __PRI64_PREFIX "o"
+#define __USE_ISOC11 1
+#define __HAVE_FLOAT64X 1
+#define __FLT16_MIN_EXP__ (-13)
+#define _POSIX_MAPPED_FILES 200809L
+#define __FLT64_MANT_DIG__ 53
+#define __attribute_const__ __attribute__ ((__const__))
+#define _SC_FIFO _SC_FIFO
+#define _PC_PATH_MAX _PC_PATH_MAX
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define SCNxFAST8 "hhx"
+#define _POSIX_NO_TRUNC 1
+#define SCNdLEAST64 __PRI64_PREFIX "d"
+#define htobe32(x) __bswap_32 (x)
+#define __FLT64X_MANT_DIG__ 64
+#define _SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG
+#define L_tmpnam 20
+#define ___int_wchar_t_h 
+#define UINT8_C(c) c
+#define BIT_CLEAR(p,m) ((p) &= ~(m))
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+#define SYSEX_SUB_SCHED_CREATE 0
+#define _T_PTRDIFF 
+#define __GNUC__ 12
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+#define RELAY_HOPS_MAX 8
+#define PRIoLEAST16 "o"
+#define UINT_LEAST8_MAX (255)
+#define __MMX__ 1
+#define PROTOCOL_USE_SEQUENCEID 1
+#define L_ctermid 9
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+#define SYSEX_I2C_DATA 0x06
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define __FLT_HAS_DENORM__ 1
+#define __SIZEOF_LONG_DOUBLE__ 16
+#define PRIoLEAST32 "o"
+#define _SC_ARG_MAX _SC_ARG_MAX
+#define __timeval_defined 1
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define _SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32
+#define PRIdLEAST16 "d"
+#define _SC_USER_GROUPS_R _SC_USER_GROUPS_R
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __BIGGEST_ALIGNMENT__ 16
+#define RAM 8000000UL
+#define _SC_BC_STRING_MAX _SC_BC_STRING_MAX
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define STDERR_FILENO 2
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+#define PRIuMAX __PRI64_PREFIX "u"
+#define __ONCE_ALIGNMENT 
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+#define __FLT64_MAX_10_EXP__ 308
+#define PRIdLEAST32 "d"
+#define _POSIX_CHOWN_RESTRICTED 0
+#define PRIoLEAST64 __PRI64_PREFIX "o"
+#define __GLIBC_USE_LIB_EXT2 0
+#define __USE_ISOC95 1
+#define __USE_ISOC99 1
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __FLT16_MAX_10_EXP__ 4
+#define PRIi64 __PRI64_PREFIX "i"
+#define _SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS
+#define _GCC_WCHAR_T 
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define _SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE
+#define _BITS_STDINT_UINTN_H 1
+#define PRIiFAST16 __PRIPTR_PREFIX "i"
+#define _CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+#define _CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS
+#define __DBL_HAS_INFINITY__ 1
+#define __FIRMWARE_BOARD_HOSTLINUX__ 1
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define _PC_SYMLINK_MAX _PC_SYMLINK_MAX
+#define _PC_NO_TRUNC _PC_NO_TRUNC
+#define PRIdLEAST64 __PRI64_PREFIX "d"
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+#define _CS_LFS_LDFLAGS _CS_LFS_LDFLAGS
+#define PRId8 "d"
+#define __SIZEOF_FLOAT__ 4
+#define PRIiFAST32 __PRIPTR_PREFIX "i"
+#define PRIi16 "i"
+#define _CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS
+#define __USE_XOPEN2K 1
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+#define _SC_CLK_TCK _SC_CLK_TCK
+#define _SC_2_VERSION _SC_2_VERSION
+#define __lldiv_t_defined 1
+#define __DEC32_MIN_EXP__ (-94)
+#define __DADDR_T_TYPE __S32_TYPE
+#define SYSEX_SUB_FEATURES_PIN_TOTAL 0
+#define _SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE
+#define __INTPTR_WIDTH__ 64
+#define __FLT64X_HAS_INFINITY__ 1
+#define _POSIX_THREAD_SPORADIC_SERVER -1
+#define PIN_MODE_PULLUP 1
+#define _SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+#define _POSIX_ASYNC_IO 1
+#define PRIiFAST64 __PRI64_PREFIX "i"
+#define __FD_SETSIZE 1024
+#define be32toh(x) __bswap_32 (x)
+#define _PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE
+#define __FLT32X_HAS_DENORM__ 1
+#define __INT_FAST16_TYPE__ long int
+#define __HAVE_FLOAT128X 0
+#define _XBS5_LP64_OFF64 1
+#define _POSIX_PRIORITY_SCHEDULING 200809L
+#define __MMX_WITH_SSE__ 1
+#define _WCHAR_T_DEFINED_ 
+#define _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS
+#define PRIi8 "i"
+#define __INO_T_MATCHES_INO64_T 1
+#define SCNdFAST8 "hhd"
+#define _POSIX_REGEXP 1
+#define _SC_CHILD_MAX _SC_CHILD_MAX
+#define __USE_POSIX199506 1
+#define _FEATURES_H 1
+#define __LDBL_HAS_DENORM__ 1
+#define PROTOCOL_ERR_CRC 1
+#define SCNiLEAST16 "hi"
+#define __SEG_GS 1
+#define __stub_setlogin 
+#define _POSIX_SPORADIC_SERVER -1
+#define __FLT128_HAS_INFINITY__ 1
+#define _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS
+#define _GCC_WRAP_STDINT_H 
+#define SCNoLEAST64 __PRI64_PREFIX "o"
+#define _POSIX_MEMORY_PROTECTION 200809L
+#define __DEC32_MIN__ 1E-95DF
+#define true 1
+#define SCNiLEAST32 "i"
+#define __dev_t_defined 
+#define _SC_XOPEN_CRYPT _SC_XOPEN_CRYPT
+#define _SC_RAW_SOCKETS _SC_RAW_SOCKETS
+#define __S32_TYPE int
+#define SYSEX_UART_DATA 0x05
+#define ROM 8000000UL
+#define __DBL_MAX_EXP__ 1024
+#define _SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER
+#define __WCHAR_WIDTH__ 32
+#define __BIT_TYPES_DEFINED__ 1
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define STATUS_DIGITAL_PIN_SET 0xC0
+#define _SC_NL_LANGMAX _SC_NL_LANGMAX
+#define _BITS_WCHAR_H 1
+#define __DEC128_EPSILON__ 1E-33DL
+#define _POSIX_TIMERS 200809L
+#define __FLT16_DECIMAL_DIG__ 5
+#define __SSE2_MATH__ 1
+#define __ATOMIC_HLE_RELEASE 131072
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __HAVE_FLOAT16 0
+#define _SC_OPEN_MAX _SC_OPEN_MAX
+#define _VA_LIST_ 
+#define PRIo8 "o"
+#define SCNiLEAST64 __PRI64_PREFIX "i"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+#define _SC_STREAM_MAX _SC_STREAM_MAX
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+#define __amd64 1
+#define __SYSCALL_WORDSIZE 64
+#define DEFAULT_BAUD 57600
+#define SCNdLEAST16 "hd"
+#define STATUS_DIGITAL_PORT_SET 0xA0
+#define _SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO
+#define SCNdFAST16 __PRIPTR_PREFIX "d"
+#define TIMER8 0
+#define _SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define _PTRDIFF_T_DECLARED 
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __glibc_objsize(__o) __bos (__o)
+#define BIT_FLIP(p,m) ((p) ^= (m))
+#define SYSEX_SUB_VERSION_FIRMWARE_NAME 0
+#define COMMPORT_TYPE_1WIRE 3
+#define __ATOMIC_HLE_ACQUIRE 65536
+#define _T_WCHAR 
+#define _PC_VDISABLE _PC_VDISABLE
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+#define __SIZEOF_SIZE_T__ 8
+#define __GIT_REVPARSE__ 0xeb544d5
+#define _SC_BARRIERS _SC_BARRIERS
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+#define _WCHAR_T 
+#define SCNiPTR __PRIPTR_PREFIX "i"
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+#define _CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS
+#define BIT_SET(p,m) ((p) |= (m))
+#define PRIu8 "u"
+#define __FLT64X_MIN_EXP__ (-16381)
+#define SIZE_MAX (18446744073709551615UL)
+#define __SIZEOF_WINT_T__ 4
+#define PRIxLEAST8 "x"
+#define PRIiLEAST32 "i"
+#define _SC_BASE _SC_BASE
+#define SYSEX_SUB_RELAY_FORWARD 0
+#define SCNdFAST64 __PRI64_PREFIX "d"
+#define PIN_MODE_UNUSED 0
+#define STATUS_EVENT_BEGIN 0xFD
+#define UINT64_C(c) c ## UL
+#define __LONG_LONG_WIDTH__ 64
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+#define PROTOCOL_VERSION_MINOR 0
+#define _SC_ADVISORY_INFO _SC_ADVISORY_INFO
+#define __U16_TYPE unsigned short int
+#define _POSIX2_C_VERSION __POSIX2_THIS_VERSION
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+#define __FLT32_MAX_EXP__ 128
+#define WINT_MAX (4294967295u)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+#define PRIiFAST8 "i"
+#define UINTPTR_MAX (18446744073709551615UL)
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+#define PRIx8 "x"
+#define _PTRDIFF_T 
+#define PRIiLEAST64 __PRI64_PREFIX "i"
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+#define _SC_PIPE _SC_PIPE
+#define __GXX_ABI_VERSION 1017
+#define __WTERMSIG(status) ((status) & 0x7f)
+#define PROTOCOL_ERR_NEED_CTRL 4
+#define _SC_PAGESIZE _SC_PAGESIZE
+#define _SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION
+#define __FLT_MIN_EXP__ (-125)
+#define _SC_PII_OSI _SC_PII_OSI
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+#define _SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+#define WEXITED 4
+#define _SC_2_C_VERSION _SC_2_C_VERSION
+#define _PC_LINK_MAX _PC_LINK_MAX
+#define INT64_MAX (__INT64_C(9223372036854775807))
+#define _SC_NL_ARGMAX _SC_NL_ARGMAX
+#define COMMPORT_ERROR_FRAME 1
+#define UINT32_MAX (4294967295U)
+#define __key_t_defined 
+#define __uid_t_defined 
+#define _POSIX_SHELL 1
+#define WNOHANG 1
+#define alloca(size) __builtin_alloca (size)
+#define __INT16_MAX__ 0x7fff
+#define _XOPEN_SHM 1
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+#define __x86_64 1
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+#define __PTRDIFF_T 
+#define _SC_WORD_BIT _SC_WORD_BIT
+#define _SC_ULONG_MAX _SC_ULONG_MAX
+#define TICKS_FREQ 1000000UL
+#define _BSD_SIZE_T_ 
+#define _SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE
+#define _POSIX_ADVISORY_INFO 200809L
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+#define __INT_FAST64_TYPE__ long int
+#define _SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX
+#define SYSEX_SUB_VERSION_LIBKNP 2
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+#define SCNuLEAST8 "hhu"
+#define _ANSI_STDDEF_H 
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+#define WINT_MIN (0u)
+#define PRIx16 "x"
+#define htole32(x) __uint32_identity (x)
+#define SCNxFAST32 __PRIPTR_PREFIX "x"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+#define STATUS_PROTOCOL_ENCODING 0xF1
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+#define _XOPEN_XPG2 1
+#define _XOPEN_XPG3 1
+#define _XOPEN_XPG4 1
+#define PIN_MODE_ANALOG 5
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __SIZEOF_POINTER__ 8
+#define _CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS
+#define SCNi64 __PRI64_PREFIX "i"
+#define __WCOREFLAG 0x80
+#define _XOPEN_LEGACY 1
+#define _CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS
+#define PRIx32 "x"
+#define __HAVE_DISTINCT_FLOAT64 0
+#define STATUS_ANALOG_PIN_REPORT 0xD0
+#define __LP64__ 1
+#define RELEASE_LIBKNP __GIT_REVPARSE__
+#define SCNu8 "hhu"
+#define __DBL_HAS_QUIET_NAN__ 1
+#define __HAVE_FLOAT32X 1
+#define _POSIX_IPV6 200809L
+#define __time_t_defined 1
+#define SCNoMAX __PRI64_PREFIX "o"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+#define __MODE_T_TYPE __U32_TYPE
+#define EOF (-1)
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+#define __DECIMAL_BID_FORMAT__ 1
+#define __FLT64_MIN_EXP__ (-1021)
+#define PRIx64 __PRI64_PREFIX "x"
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define _INTTYPES_H 1
+#define PIN_MODE_TOTAL 15
+#define INT_LEAST8_MAX (127)
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+#define __CFLOAT64X _Complex _Float64x
+#define __FLT64_MIN_10_EXP__ (-307)
+#define __FDS_BITS(set) ((set)->__fds_bits)
+#define PROTOCOL_ERR_UNKNOWN 0
+#define __FLT16_MIN_10_EXP__ (-4)
+#define _SC_BC_DIM_MAX _SC_BC_DIM_MAX
+#define _SC_FILE_LOCKING _SC_FILE_LOCKING
+#define __FLT64X_DECIMAL_DIG__ 21
+#define __DEC128_MIN__ 1E-6143DL
+#define __REGISTER_PREFIX__ 
+#define __UINT16_MAX__ 0xffff
+#define __DBL_HAS_DENORM__ 1
+#define SYSEX_SUB_ONEWIRE_ 0
+#define INT_LEAST32_MAX (2147483647)
+#define _SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX
+#define SCNoFAST8 "hho"
+#define _PC_NAME_MAX _PC_NAME_MAX
+#define _CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+#define __LDBL_HAS_INFINITY__ 1
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+#define __UINT8_TYPE__ unsigned char
+#define COMMPORT_ERROR_TOTAL 5
+#define _SC_BC_BASE_MAX _SC_BC_BASE_MAX
+#define _SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC
+#define __FLT_DIG__ 6
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __NO_INLINE__ 1
+#define PROTOCOL_SYSEX_FRAMING 5
+#define _SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC
+#define __DEC_EVAL_METHOD__ 2
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+#define _SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS
+#define SCNiMAX __PRI64_PREFIX "i"
+#define __FLT_MANT_DIG__ 24
+#define __LDBL_DECIMAL_DIG__ 21
+#define INT_LEAST8_MIN (-128)
+#define __VERSION__ "12.2.0"
+#define PIN_MODE_DEBOUNCE 10
+#define SCNoLEAST8 "hho"
+#define _SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX
+#define GPIO_PIN(port,pin) (((port) << 4) | (pin))
+#define SYSEX_SUB_RELAY_ROUTE_RESET 127
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+#define UINT_LEAST16_MAX (65535)
+#define __UINT64_C(c) c ## UL
+#define _SYS_TYPES_H 1
+#define _PTRDIFF_T_ 
+#define PRIXLEAST16 "X"
+#define _SYS_CDEFS_H 1
+#define _IO_ERR_SEEN 0x0020
+#define PIN_MODE_SERVO 13
+#define SCNi16 "hi"
+#define _STDC_PREDEF_H 1
+#define INT_LEAST32_MIN (-2147483647-1)
+#define PRIXLEAST32 "X"
+#define SIG_DISCARD 1
+#define __USE_XOPEN2K8 1
+#define _SC_NL_MSGMAX _SC_NL_MSGMAX
+#define htobe64(x) __bswap_64 (x)
+#define _SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX
+#define _PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define PROTOCOL_VERSION_MAJOR 3
+#define STATUS_INTERRUPT 0xF4
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define PIN_IS_ANALOG(p) (0)
+#define _CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS
+#define __INT_LEAST32_MAX__ 0x7fffffff
+#define __STRING(x) #x
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+#define _T_PTRDIFF_ 
+#define __FLT128_MAX_EXP__ 16384
+#define PRIXLEAST64 __PRI64_PREFIX "X"
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define be16toh(x) __bswap_16 (x)
+#define SYSTEM_RESET_ZERO 0
+#define _CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS
+#define F_ULOCK 0
+#define _SC_TRACE _SC_TRACE
+#define _SC_2_PBS_TRACK _SC_2_PBS_TRACK
+#define __ssize_t_defined 
+#define _SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+#define _SC_FSYNC _SC_FSYNC
+#define __FLT32_MANT_DIG__ 24
+#define _SYS_SIZE_T_H 
+#define STATUS_CUSTOM_F6 0xF6
+#define SYSEX_STRING_DATA 0x08
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+#define _CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS
+#define _POSIX_THREAD_PROCESS_SHARED 200809L
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define _SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING
+#define STATUS_PIN_MODE 0x80
+#define SCNoPTR __PRIPTR_PREFIX "o"
+#define _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS
+#define __FLT32X_MIN_EXP__ (-1021)
+#define __stub_gtty 
+#define _CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS
+#define _SC_2_LOCALEDEF _SC_2_LOCALEDEF
+#define SEEK_CUR 1
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define SIG_ATOMIC_MAX (2147483647)
+#define PIN_MODE_STEPPER 12
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+#define SYSEX_PREFPINS_DATA 0x00
+#define _SC_SHRT_MAX _SC_SHRT_MAX
+#define _SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX
+#define INT32_MAX (2147483647)
+#define _SC_DEVICE_IO _SC_DEVICE_IO
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+#define _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS
+#define _CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS
+#define _SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE
+#define _SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define SYSTEM_RESET_TOTAL 3
+#define __wur 
+#define _SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT
+#define _PC_ASYNC_IO _PC_ASYNC_IO
+#define BITLONG(x) ((uint32_t)0x00000001 << (x))
+#define __FLT128_HAS_DENORM__ 1
+#define COMMPORT_TYPE_FD 1
+#define _SC_SSIZE_MAX _SC_SSIZE_MAX
+#define __FLT32_DECIMAL_DIG__ 9
+#define COMMPORT_ERROR_PARITY 3
+#define HAL_BOARD_H 
+#define __FLT128_DIG__ 33
+#define __INT32_C(c) c
+#define SCNiLEAST8 "hhi"
+#define __DEC64_EPSILON__ 1E-15DD
+#define __ORDER_PDP_ENDIAN__ 3412
+#define __DEC128_MIN_EXP__ (-6142)
+#define __PDP_ENDIAN 3412
+#define _POSIX_MEMLOCK 200809L
+#define __va_copy(d,s) __builtin_va_copy(d,s)
+#define _SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG
+#define _SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE
+#define BYTE_ORDER __BYTE_ORDER
+#define _SC_MESSAGE_PASSING _SC_MESSAGE_PASSING
+#define __INT_FAST32_TYPE__ long int
+#define __have_pthread_attr_t 1
+#define _POSIX_CPUTIME 0
+#define SCNi8 "hhi"
+#define _BITS_TYPESIZES_H 1
+#define _SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT
+#define _SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS
+#define __FIRMWARE_MCU_X86__ 1
+#define _SC_MULTI_PROCESS _SC_MULTI_PROCESS
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define _ANSI_STDARG_H_ 
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define __UINT_LEAST16_TYPE__ short unsigned int
+#define _POSIX_THREAD_ATTR_STACKADDR 200809L
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+#define _STRUCT_TIMESPEC 1
+#define TICKTIME 1000
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+#define COMMPORT_TYPE_NULL 0
+#define RAND_MAX 2147483647
+#define PIN_MODE_SPI 9
+#define unix 1
+#define PROTOCOL_MAX_EVENT_BYTES 64
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+#define SCNdFAST32 __PRIPTR_PREFIX "d"
+#define __need___va_list 
+#define _SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX
+#define _SC_2_FORT_RUN _SC_2_FORT_RUN
+#define __THROWNL __attribute__ ((__nothrow__))
+#define POINTER_SIZE 64
+#define PULSE_SLOT_US 4
+#define __SIZE_TYPE__ long unsigned int
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+#define __ULONGWORD_TYPE unsigned long int
+#define _SIZE_T_DECLARED 
+#define SYSEX_SUB_SCHED_ADD 2
+#define __FLT_IS_IEC_60559__ 2
+#define _POSIX_THREADS 200809L
+#define _SC_UCHAR_MAX _SC_UCHAR_MAX
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+#define __FLT64X_DIG__ 18
+#define _SC_SINGLE_PROCESS _SC_SINGLE_PROCESS
+#define _SC_USER_GROUPS _SC_USER_GROUPS
+#define _CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS
+#define __INT8_TYPE__ signed char
+#define _CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS
+#define __HAVE_DISTINCT_FLOAT128 1
+#define __ELF__ 1
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+#define _SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG
+#define _CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS
+#define SYSEX_SUB_FEATURES_TOTAL 1
+#define __UINT32_TYPE__ unsigned int
+#define __ILP32_OFFBIG_LDFLAGS "-m32"
+#define PRIxMAX __PRI64_PREFIX "x"
+#define _BITS_BYTESWAP_H 1
+#define __ID_T_TYPE __U32_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define _SC_PRIORITIZED_IO _SC_PRIORITIZED_IO
+#define F_TLOCK 2
+#define _CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define RX_BUFFER_MASK ( RX_BUFFER_SIZE - 1 )
+#define __FLT_RADIX__ 2
+#define PRIdLEAST8 "d"
+#define __INT_LEAST16_TYPE__ short int
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+#define INTPTR_MAX (9223372036854775807L)
+#define __UINTMAX_C(c) c ## UL
+#define _POSIX_C_SOURCE 200809L
+#define SCNdPTR __PRIPTR_PREFIX "d"
+#define __SSE_MATH__ 1
+#define _PC_PIPE_BUF _PC_PIPE_BUF
+#define _SC_THREADS _SC_THREADS
+#define __k8 1
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+#define _SC_XOPEN_XPG3 _SC_XOPEN_XPG3
+#define STATUS_SYSEX_START 0xFF
+#define __LDBL_REDIR(name,proto) name proto
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+#define _SC_FD_MGMT _SC_FD_MGMT
+#define F_TEST 3
+#define SCNxLEAST32 "x"
+#define __f32(x) x ##f32
+#define PRIu16 "u"
+#define __blksize_t_defined 
+#define TTY_CH 0
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+#define _POSIX_TIMEOUTS 200809L
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+#define __USER_LABEL_PREFIX__ 
+#define _LFS64_LARGEFILE 1
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+#define _POSIX_SEMAPHORES 200809L
+#define __STDC_IEC_60559_BFP__ 201404L
+#define __WCHAR_MAX __WCHAR_MAX__
+#define _SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT
+#define __SIZEOF_PTRDIFF_T__ 8
+#define _LFS64_ASYNCHRONOUS_IO 1
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define SEEK_SET 0
+#define PRIu32 "u"
+#define _CS_V7_ENV _CS_V7_ENV
+#define _PC_SOCK_MAXBUF _PC_SOCK_MAXBUF
+#define _LFS64_STDIO 1
+#define SCNu64 __PRI64_PREFIX "u"
+#define SCNxLEAST64 __PRI64_PREFIX "x"
+#define __f64(x) x ##f64
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+#define __stub_sigreturn 
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+#define _CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS
+#define SCNx64 __PRI64_PREFIX "x"
+#define __restrict_arr __restrict
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define __CFLOAT32X _Complex _Float32x
+#define INT8_C(c) c
+#define SYSEX_SUB_STRING_ 0
+#define _SC_SIGSTKSZ _SC_SIGSTKSZ
+#define _SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX
+#define PRIu64 __PRI64_PREFIX "u"
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+#define __USE_MISC 1
+#define __UWORD_TYPE unsigned long int
+#define __LDBL_DIG__ 18
+#define W_OK 2
+#define _POSIX_ASYNCHRONOUS_IO 200809L
+#define __FLT64_IS_IEC_60559__ 2
+#define __x86_64__ 1
+#define _SIZE_T_ 
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+#define __FLT16_IS_IEC_60559__ 2
+#define __FLT16_MAX_EXP__ 16
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+#define HAL_DEFINES_H 
+#define SYSEX_ONEWIRE_DATA 0x04
+#define UINT_FAST32_MAX (18446744073709551615UL)
+#define HAL_H 
+#define _WCHAR_T_H 
+#define _SC_SAVED_IDS _SC_SAVED_IDS
+#define PRIxLEAST16 "x"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+#define __stub_revoke 
+#define __timer_t_defined 1
+#define __WCLONE 0x80000000
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS
+#define _CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS
+#define _POSIX_MONOTONIC_CLOCK 0
+#define _SC_PHYS_PAGES _SC_PHYS_PAGES
+#define __GCC_CONSTRUCTIVE_SIZE 64
+#define PRIxLEAST32 "x"
+#define _SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING
+#define __WCHAR_MIN __WCHAR_MIN__
+#define __FLT64_DIG__ 15
+#define _SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+#define RELAY_EVENT_MAX ((PROTOCOL_MAX_EVENT_BYTES - PROTOCOL_SYSEX_FRAMING) / 2 - 6)
+#define __UINT_LEAST64_TYPE__ long unsigned int
+#define _SC_SEMAPHORES _SC_SEMAPHORES
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+#define __U64_TYPE unsigned long int
+#define __FLT_HAS_QUIET_NAN__ 1
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+#define _SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR
+#define _SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM
+#define INT32_C(c) c
+#define _POSIX_TRACE_INHERIT -1
+#define __FLT_MAX_10_EXP__ 38
+#define _____fpos64_t_defined 1
+#define __SIZE_T__ 
+#define _SC_HOST_NAME_MAX _SC_HOST_NAME_MAX
+#define __glibc_c99_flexarr_available 1
+#define __LONG_MAX__ 0x7fffffffffffffffL
+#define __WCHAR_T__ 
+#define __FLT64X_HAS_DENORM__ 1
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+#define _PC_SYNC_IO _PC_SYNC_IO
+#define va_copy(d,s) __builtin_va_copy(d,s)
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define _CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS
+#define _SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX
+#define __FLT_HAS_INFINITY__ 1
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+#define SYSEX_SUB_VERSION_FIRMWARE_VER 1
+#define PRIxLEAST64 __PRI64_PREFIX "x"
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+#define PRIxFAST16 __PRIPTR_PREFIX "x"
+#define L_INCR SEEK_CUR
+#define _BSD_PTRDIFF_T_ 
+#define _BITS_PTHREADTYPES_COMMON_H 1
+#define PRIXPTR __PRIPTR_PREFIX "X"
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+#define __UINT_FAST16_TYPE__ long unsigned int
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+#define __DEC64_MAX__ 9.999999999999999E384DD
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+#define __INT_FAST32_WIDTH__ 64
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+#define _POSIX_RAW_SOCKETS 200809L
+#define __CHAR16_TYPE__ short unsigned int
+#define __PRAGMA_REDEFINE_EXTNAME 1
+#define SCNuPTR __PRIPTR_PREFIX "u"
+#define BIG_ENDIAN __BIG_ENDIAN
+#define _STRINGS_H 1
+#define SYSEX_SUB_VERSION_DEFINES 7
+#define PRIX32 "X"
+#define __SIZE_WIDTH__ 64
+#define __SEG_FS 1
+#define __INT_LEAST16_MAX__ 0x7fff
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define __LP64_OFF64_LDFLAGS "-m64"
+#define __DEC64_MANT_DIG__ 16
+#define __INT64_MAX__ 0x7fffffffffffffffL
+#define _BITS_ENDIAN_H 1
+#define _SC_SS_REPL_MAX _SC_SS_REPL_MAX
+#define _PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+#define __SIG_ATOMIC_WIDTH__ 32
+#define _SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX
+#define PRIxFAST64 __PRI64_PREFIX "x"
+#define _SC_TRACE_LOG _SC_TRACE_LOG
+#define __INT_LEAST64_TYPE__ long int
+#define WATCHDOG 1
+#define htole16(x) __uint16_identity (x)
+#define __INT16_TYPE__ short int
+#define __INT_LEAST8_TYPE__ signed char
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define __STDC_VERSION__ 201710L
+#define __SIZEOF_INT__ 4
+#define SYSEX_RCSWITCH_OUT 0x49
+#define __DEC32_MAX_EXP__ 97
+#define TX_BUFFER_MASK ( TX_BUFFER_SIZE - 1 )
+#define GPIO_ATOMIC_MAX GPIO_PIN(0x40,0)
+#define UTILITY_MACROS_H 
+#define _SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE
+#define __INT_FAST8_MAX__ 0x7f
+#define ADC_CH 0
+#define __PMT(args) args
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+#define _SC_XOPEN_LEGACY _SC_XOPEN_LEGACY
+#define WTERMSIG(status) __WTERMSIG (status)
+#define _SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE
+#define linux 1
+#define _SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX
+#define _SC_THREAD_CPUTIME _SC_THREAD_CPUTIME
+#define SCNdMAX __PRI64_PREFIX "d"
+#define PIN_TOTAL 0
+#define __FLT64_HAS_QUIET_NAN__ 1
+#define PDP_ENDIAN __PDP_ENDIAN
+#define htole64(x) __uint64_identity (x)
+#define _POSIX_THREAD_ROBUST_PRIO_PROTECT -1
+#define _POSIX_SAVED_IDS 1
+#define SYSEX_SUB_DIGITAL_DATA_ 0
+#define SYSTEM_RESET_REBOOT 1
+#define __USE_POSIX2 1
+#define L_XTND SEEK_END
+#define SCNuFAST32 __PRIPTR_PREFIX "u"
+#define _SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE
+#define __FLT32_MIN_10_EXP__ (-37)
+#define __FLT32X_DIG__ 15
+#define _CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION
+#define SCNuFAST16 __PRIPTR_PREFIX "u"
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+#define __WORDSIZE 64
+#define __PTRDIFF_WIDTH__ 64
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+#define __BEGIN_DECLS 
+#define _SC_PII_XTI _SC_PII_XTI
+#define __LDBL_MANT_DIG__ 64
+#define _PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE
+#define SCNuFAST64 __PRI64_PREFIX "u"
+#define __FLT64_HAS_INFINITY__ 1
+#define PWM_CH 0
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __FLT16_HAS_INFINITY__ 1
+#define PRIuLEAST8 "u"
+#define false 0
+#define _SC_FILE_SYSTEM _SC_FILE_SYSTEM
+#define _STRING_H 1
+#define __GNUC_VA_LIST 
+#define _GCC_MAX_ALIGN_T 
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+#define __code_model_small__ 1
+#define _SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX
+#define _XOPEN_REALTIME 1
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+#define COMMPORT_TYPE_I2C 5
+#define __DEC32_MANT_DIG__ 7
+#define le64toh(x) __uint64_identity (x)
+#define _POSIX2_LOCALEDEF __POSIX2_THIS_VERSION
+#define FILENAME_MAX 4096
+#define _SC_NL_TEXTMAX _SC_NL_TEXTMAX
+#define __FLT16_MANT_DIG__ 11
+#define __ino_t_defined 
+#define __k8__ 1
+#define __INTPTR_TYPE__ long int
+#define __UINT16_TYPE__ short unsigned int
+#define __WCHAR_TYPE__ int
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __SLONGWORD_TYPE long int
+#define _SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N
+#define __FIRMWARE_ARCH_LINUX__ 1
+#define PRIiPTR __PRIPTR_PREFIX "i"
+#define _POSIX_MEMLOCK_RANGE 200809L
+#define SYSEX_SPI_DATA 0x07
+#define __pic__ 2
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+#define SYSEX_PINMAP_REP 0x43
+#define SYSEX_PINMAP_REQ 0x42
+#define COMMPORT_TYPE_PIN 2
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+#define __INT_FAST64_WIDTH__ 64
+#define __stub_chflags 
+#define SCNxPTR __PRIPTR_PREFIX "x"
+#define __UQUAD_TYPE unsigned long int
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define __BYTE_ORDER __LITTLE_ENDIAN
+#define __USE_POSIX 1
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+#define RELEASE_DEFINES __GIT_REVPARSE__
+#define __LITTLE_ENDIAN 1234
+#define BUFSIZ 8192
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+#define __FLT32_HAS_INFINITY__ 1
+#define PROTOCOL_ERR_START 5
+#define INT_FAST32_MAX (9223372036854775807L)
+#define COMMPORT_TYPE_SPI 6
+#define _SC_NL_SETMAX _SC_NL_SETMAX
+#define __FLT64X_MAX_EXP__ 16384
+#define _WCHAR_T_DECLARED 
+#define __UINT_FAST64_TYPE__ long unsigned int
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+#define _POSIX2_CHAR_TERM 200809L
+#define WNOWAIT 0x01000000
+#define PRIXFAST8 "X"
+#define RELAY_ROUTES_MAX 16
+#define STATUS_SYSTEM_RESET 0xFC
+#define __LDBL_REDIR_DECL(name) 
+#define _SC_2_PBS _SC_2_PBS
+#define UINT_FAST8_MAX (255)
+#define __INT_MAX__ 0x7fffffff
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+#define _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS
+#define SYSEX_SUB_UART_ 0
+#define SCNoFAST16 __PRIPTR_PREFIX "o"
+#define __linux__ 1
+#define STDIN_FILENO 0
+#define UINT8_MAX (255)
+#define __ILP32_OFF32_LDFLAGS "-m32"
+#define __S16_TYPE short int
+#define RELAY_PORT_UPSTREAM 0
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define PRIXMAX __PRI64_PREFIX "X"
+#define _T_SIZE_ 
+#define __TIMESIZE __WORDSIZE
+#define SYSEX_PINGROUPS_DATA 0x01
+#define _POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L
+#define SCNoFAST32 __PRIPTR_PREFIX "o"
+#define __WNOTHREAD 0x20000000
+#define __INT64_TYPE__ long int
+#define MSB16(a) ({ __typeof__ (a) _a = (a); _a & 0xF0; })
+#define SCNuMAX __PRI64_PREFIX "u"
+#define __FLT_MAX_EXP__ 128
+#define _SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __gid_t_defined 
+#define UINT32_C(c) c ## U
+#define __ORDER_BIG_ENDIAN__ 4321
+#define _SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING
+#define _SC_REGEX_VERSION _SC_REGEX_VERSION
+#define __ptr_t void *
+#define STATUS_DIGITAL_PORT_REPORT 0x90
+#define __DBL_MANT_DIG__ 53
+#define ___int_size_t_h 
+#define __TIMER_T_TYPE void *
+#define _POSIX_REALTIME_SIGNALS 200809L
+#define ONEWIRE_CH 0
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+#define LIBKNP_H 
+#define __SIZEOF_FLOAT128__ 16
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+#define _POSIX_TRACE -1
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+#define __clock_t_defined 1
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+#define __GLIBC_MINOR__ 36
+#define __DEC64_MIN__ 1E-383DD
+#define HAL_ARCH_H 
+#define __WINT_TYPE__ unsigned int
+#define __UINT_LEAST32_TYPE__ unsigned int
+#define _POSIX_FSYNC 200809L
+#define __SIZEOF_SHORT__ 2
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define __SSE__ 1
+#define SCNu16 "hu"
+#define __sigset_t_defined 1
+#define __intptr_t_defined 
+#define _SC_AVPHYS_PAGES _SC_AVPHYS_PAGES
+#define __LDBL_MIN_EXP__ (-16381)
+#define _CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define _POSIX_VDISABLE '\0'
+#define FD_SETSIZE __FD_SETSIZE
+#define _SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32
+#define SCNu32 "u"
+#define stdout stdout
+#define __amd64__ 1
+#define _SC_SIGNALS _SC_SIGNALS
+#define __WINT_WIDTH__ 32
+#define __struct_FILE_defined 1
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+#define _POSIX_THREAD_PRIO_INHERIT 200809L
+#define __INT_LEAST8_MAX__ 0x7f
+#define __USE_POSIX199309 1
+#define __INT_LEAST64_WIDTH__ 64
+#define __LDBL_MAX_EXP__ 16384
+#define __FLT32X_MAX_10_EXP__ 308
+#define ____mbstate_t_defined 1
+#define _SC_MINSIGSTKSZ _SC_MINSIGSTKSZ
+#define __SIZEOF_INT128__ 16
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+#define _CS_LFS64_CFLAGS _CS_LFS64_CFLAGS
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+#define __FLT64X_IS_IEC_60559__ 2
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __LDBL_MAX_10_EXP__ 4932
+#define __W_CONTINUED 0xffff
+#define __ATOMIC_RELAXED 0
+#define LSB16(a) ({ __typeof__ (a) _a = (a); _a & 0x0F; })
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define _CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+#define _SC_ATEXIT_MAX _SC_ATEXIT_MAX
+#define __stub_stty 
+#define _SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+#define le16toh(x) __uint16_identity (x)
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+#define _SIZET_ 
+#define _PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN
+#define _LP64 1
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+#define __UINT8_C(c) c
+#define _SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC
+#define _BITS_STDINT_INTN_H 1
+#define __FLT64_MAX_EXP__ 1024
+#define _CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS
+#define __INT_LEAST32_TYPE__ int
+#define _SC_PII_INTERNET _SC_PII_INTERNET
+#define _SC_REGEXP _SC_REGEXP
+#define _LFS_LARGEFILE 1
+#define __wchar_t__ 
+#define SEEK_END 2
+#define __SIZEOF_WCHAR_T__ 4
+#define __USE_POSIX_IMPLICITLY 1
+#define __UINT64_TYPE__ long unsigned int
+#define ____FILE_defined 1
+#define __GNUC_PATCHLEVEL__ 0
+#define SCNiFAST16 __PRIPTR_PREFIX "i"
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+#define __ILP32_OFF32_CFLAGS "-m32"
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define _SC_IOV_MAX _SC_IOV_MAX
+#define _SC_PASS_MAX _SC_PASS_MAX
+#define __PRI64_PREFIX "l"
+#define _STDDEF_H_ 
+#define _XOPEN_UNIX 1
+#define __stub___compat_bdflush 
+#define SCNiFAST32 __PRIPTR_PREFIX "i"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define __FLT128_HAS_QUIET_NAN__ 1
+#define _CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+#define _SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX
+#define RELAY_PORT_PEERING 1
+#define _SC_MAPPED_FILES _SC_MAPPED_FILES
+#define __INT_FAST8_TYPE__ signed char
+#define PRIiMAX __PRI64_PREFIX "i"
+#define __PID_T_TYPE __S32_TYPE
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+#define SYSEX_SUB_VERSION_BOARD 5
+#define _SC_AIO_MAX _SC_AIO_MAX
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define _SC_JOB_CONTROL _SC_JOB_CONTROL
+#define va_arg(v,l) __builtin_va_arg(v,l)
+#define _PC_MAX_CANON _PC_MAX_CANON
+#define _THREAD_SHARED_TYPES_H 1
+#define SYSEX_SUB_SCHED_RESET 127
+#define SCNiFAST64 __PRI64_PREFIX "i"
+#define __GLIBC_USE_ISOC2X 0
+#define __f128(x) x ##f128
+#define __glibc_has_extension(ext) 0
+#define _SC_TIMERS _SC_TIMERS
+#define SYSEX_SUB_SCHED_LIST_REP 6
+#define SYSEX_SUB_SCHED_LIST_REQ 5
+#define SCNxMAX __PRI64_PREFIX "x"
+#define PROTOCOL_ENCODING_UNKNOWN 0
+#define __GNUC_STDC_INLINE__ 1
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+#define P_tmpdir "/tmp"
+#define __attribute_pure__ __attribute__ ((__pure__))
+#define __FLT64_HAS_DENORM__ 1
+#define _POSIX_MESSAGE_PASSING 200809L
+#define __FILE_defined 1
+#define __HAVE_FLOAT32 1
+#define __WORDSIZE_TIME64_COMPAT32 1
+#define SYSEX_PINCAPS_REP 0x41
+#define SYSEX_PINCAPS_REQ 0x40
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+#define R_OK 4
+#define _CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS
+#define __FLT16_HAS_DENORM__ 1
+#define _BITS_TYPES___LOCALE_T_H 1
+#define __DBL_DECIMAL_DIG__ 17
+#define __STDC_UTF_32__ 1
+#define _BITS_STDIO_LIM_H 1
+#define __INT_FAST8_WIDTH__ 8
+#define __FXSR__ 1
+#define _SIZE_T 
+#define _POSIX2_VERSION __POSIX2_THIS_VERSION
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+#define __ULONG32_TYPE unsigned int
+#define STATUS_CUSTOM_F5 0xF5
+#define STATUS_CUSTOM_F7 0xF7
+#define STATUS_CUSTOM_F8 0xF8
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define FOPEN_MAX 16
+#define __BIG_ENDIAN 4321
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define __suseconds_t_defined 
+#define __off_t_defined 
+#define SYSEX_SUB_SCHED_SCHEDULE 4
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __GCC_DESTRUCTIVE_SIZE 64
+#define _SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC
+#define PRIdFAST16 __PRIPTR_PREFIX "d"
+#define __INTMAX_WIDTH__ 64
+#define RELEASE_BOARD __GIT_REVPARSE__
+#define _POSIX_REENTRANT_FUNCTIONS 1
+#define _SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC
+#define __mode_t_defined 
+#define _GCC_SIZE_T 
+#define _POSIX_THREAD_PRIO_PROTECT 200809L
+#define RELAY_NODE_HOST 0
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define L_SET SEEK_SET
+#define __UINT32_C(c) c ## U
+#define PRIdFAST32 __PRIPTR_PREFIX "d"
+#define COMMPORT_TYPE_TOTAL 7
+#define _SC_INT_MAX _SC_INT_MAX
+#define __size_t__ 
+#define SYSEX_SCHEDULER_DATA 0x09
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+#define PRIoPTR __PRIPTR_PREFIX "o"
+#define _BITS_TIME64_H 1
+#define _CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS
+#define _ENDIAN_H 1
+#define _GETOPT_POSIX_H 1
+#define __TIME64_T_TYPE __TIME_T_TYPE
+#define __glibc_has_builtin(name) __has_builtin (name)
+#define _LFS_ASYNCHRONOUS_IO 1
+#define __ONCE_FLAG_INIT { 0 }
+#define _SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+#define _SC_TRACE_INHERIT _SC_TRACE_INHERIT
+#define _CS_LFS64_LIBS _CS_LFS64_LIBS
+#define _VA_LIST_T_H 
+#define __INT8_MAX__ 0x7f
+#define __LONG_WIDTH__ 64
+#define SYSEX_VERSION 0x20
+#define __PIC__ 2
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+#define _CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS
+#define PRIdFAST64 __PRI64_PREFIX "d"
+#define __UINT_FAST32_TYPE__ long unsigned int
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define __CHAR32_TYPE__ unsigned int
+#define PIN_MODE_INPUT 2
+#define _CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+#define _VA_LIST 
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+#define __GLIBC_USE_IEC_60559_EXT 0
+#define __fsfilcnt_t_defined 
+#define __blkcnt_t_defined 
+#define __HAVE_FLOAT128 1
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+#define UINT_LEAST32_MAX (4294967295U)
+#define __va_list__ 
+#define _SC_2_PBS_LOCATE _SC_2_PBS_LOCATE
+#define SCNxLEAST8 "hhx"
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+#define UINTMAX_C(c) c ## UL
+#define PROTOCOL_ENCODING_COMPAT 2
+#define __SSE2__ 1
+#define _IOLBF 1
+#define _SC_2_FORT_DEV _SC_2_FORT_DEV
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS
+#define __INT32_TYPE__ int
+#define _SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX
+#define __SIZEOF_DOUBLE__ 8
+#define __FLT_MIN_10_EXP__ (-37)
+#define _SC_INT_MIN _SC_INT_MIN
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+#define __INT_LEAST32_WIDTH__ 32
+#define __KEY_T_TYPE __S32_TYPE
+#define __SWORD_TYPE long int
+#define __INTMAX_TYPE__ long int
+#define RELEASE_ARCH __GIT_REVPARSE__
+#define SIG_JITTER 0
+#define __DEC128_MAX_EXP__ 6145
+#define __ldiv_t_defined 1
+#define _T_SIZE 
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define PRIdFAST8 "d"
+#define _CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS
+#define STATUS_INFO 0xF2
+#define __FLT32X_HAS_QUIET_NAN__ 1
+#define _POSIX2_C_BIND __POSIX2_THIS_VERSION
+#define va_end(v) __builtin_va_end(v)
+#define __ATOMIC_CONSUME 1
+#define _CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS
+#define __GNUC_MINOR__ 2
+#define __INT_FAST16_WIDTH__ 64
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+#define _SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+#define PRIiLEAST8 "i"
+#define __LDBL_REDIR2_DECL(name) 
+#define _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+#define INTMAX_C(c) c ## L
+#define __glibc_clang_prereq(maj,min) 0
+#define __nlink_t_defined 
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define _POSIX2_C_DEV __POSIX2_THIS_VERSION
+#define SYSEX_SUB_SCHED_DELETE 1
+#define _STDINT_H 1
+#define _RWLOCK_INTERNAL_H 
+#define __DBL_MAX_10_EXP__ 308
+#define PROTOCOL_ENCODING_NORMAL 1
+#define PIN_MODE_1WIRE 6
+#define UINT16_MAX (65535)
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+#define _CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS
+#define _CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS
+#define _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS
+#define MAX(a,b) ({ __typeof__ (a) _a = (a); __typeof__ (b) _b = (b); _a > _b ? _a : _b; })
+#define SYSEX_SUB_SPI_ 0
+#define SYSEX_SUB_SCHED_DELAY 3
+#define _POSIX_TRACE_LOG -1
+#define __INT16_C(c) c
+#define __WCHAR_T 
+#define __U32_TYPE unsigned int
+#define _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define _CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS
+#define __STDC__ 1
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+#define __PTRDIFF_TYPE__ long int
+#define stdin stdin
+#define __clockid_t_defined 1
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+#define __ATOMIC_SEQ_CST 5
+#define _SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT
+#define PRIdPTR __PRIPTR_PREFIX "d"
+#define BIT(x) (0x01 << (x))
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define _BITS_FLOATN_H 
+#define PROTOCOL_ENCODING_REPORT 127
+#define PROTOCOL_ERR_NEED_DATA 3
+#define __FLT32X_MIN_10_EXP__ (-307)
+#define SYSEX_SUB_RELAY_ROUTE_DEL 2
+#define PRId16 "d"
+#define PRIuFAST64 __PRI64_PREFIX "u"
+#define __UINTPTR_TYPE__ long unsigned int
+#define RX_BUFFER_SIZE 64
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+#define _PC_2_SYMLINKS _PC_2_SYMLINKS
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __DEC128_MANT_DIG__ 34
+#define __LDBL_MIN_10_EXP__ (-4931)
+#define SYSEX_MOD_SYNC 0x7E
+#define __useconds_t_defined 
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define _SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+#define PRId32 "d"
+#define _SC_SPAWN _SC_SPAWN
+#define SYSEX_RELAY_DATA 0x0A
+#define _SC_CHAR_MAX _SC_CHAR_MAX
+#define _CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define SCNxLEAST16 "hx"
+#define X_OK 1
+#define __SIZEOF_LONG_LONG__ 8
+#define PRIo16 "o"
+#define __USE_ATFILE 1
+#define SYSTEM_RESET_HALT 2
+#define _GCC_PTRDIFF_T 
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+#define __FLT128_DECIMAL_DIG__ 36
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+#define F_CPU 1000000000ULL
+#define _STDLIB_H 1
+#define PRId64 __PRI64_PREFIX "d"
+#define PTRDIFF_MAX (9223372036854775807L)
+#define _SC_NZERO _SC_NZERO
+#define _GETOPT_CORE_H 1
+#define __FLT32_HAS_QUIET_NAN__ 1
+#define __FLT_DECIMAL_DIG__ 9
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+#define PRIo32 "o"
+#define _SC_STREAMS _SC_STREAMS
+#define __POSIX2_THIS_VERSION 200809L
+#define __WALL 0x40000000
+#define ___int_ptrdiff_t_h 
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define PRIoMAX __PRI64_PREFIX "o"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define _UNISTD_H 1
+#define _SC_CHAR_BIT _SC_CHAR_BIT
+#define _SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK
+#define PRIoFAST8 "o"
+#define INT_LEAST16_MAX (32767)
+#define PRIoLEAST8 "o"
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+#define __UINT_FAST8_TYPE__ unsigned char
+#define SCNuLEAST32 "u"
+#define __P(args) args
+#define _POSIX_BARRIERS 200809L
+#define PRIo64 __PRI64_PREFIX "o"
+#define PRIXFAST16 __PRIPTR_PREFIX "X"
+#define PWM_MIN_RESOLUTION 0
+#define __ATOMIC_ACQ_REL 4
+#define SCNuFAST8 "hhu"
+#define __ATOMIC_RELEASE 3
+#define __fsblkcnt_t_defined 
+#define __LP64_OFF64_CFLAGS "-m64"
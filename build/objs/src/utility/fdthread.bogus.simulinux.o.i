@@ -0,0 +1,3394 @@
+#define __S_IFBLK 0060000
+#define BLKSECDISCARD _IO(0x12,125)
+#define __NR_waitid 247
+#define _BITS_SCHED_H 1
+#define _BITS_FLOATN_COMMON_H 
+#define _SC_CHAR_MIN _SC_CHAR_MIN
+#define __NR_dup3 292
+#define __NR_fdatasync 75
+#define SYS_statfs __NR_statfs
+#define __NR_mq_getsetattr 245
+#define PRIXFAST32 __PRIPTR_PREFIX "X"
+#define S_ISCHR(mode) __S_ISTYPE((mode), __S_IFCHR)
+#define __attr_access(x) __attribute__ ((__access__ x))
+#define __DBL_MIN_EXP__ (-1021)
+#define FSCRYPT_KEY_STATUS_INCOMPLETELY_REMOVED 3
+#define _SC_XOPEN_UNIX _SC_XOPEN_UNIX
+#define SYS_setns __NR_setns
+#define ____sigset_t_defined 
+#define SYS_ftruncate __NR_ftruncate
+#define SYS_rseq __NR_rseq
+#define SYNC_FILE_RANGE_WRITE_AND_WAIT (SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WAIT_AFTER)
+#define FS_ENCRYPT_FL 0x00000800
+#define EOWNERDEAD 130
+#define SYS_sendfile __NR_sendfile
+#define O_NOCTTY 0400
+#define SYS_openat2 __NR_openat2
+#define SYS_rt_sigpending __NR_rt_sigpending
+#define _POSIX_THREAD_PRIORITY_SCHEDULING 200809L
+#define SYS_getuid __NR_getuid
+#define __NR_connect 42
+#define TIOCMBIC 0x5417
+#define _POSIX_SHARED_MEMORY_OBJECTS 200809L
+#define __CFLOAT32 _Complex _Float32
+#define FIONBIO 0x5421
+#define SYS_epoll_wait_old __NR_epoll_wait_old
+#define __NR_epoll_pwait 281
+#define __UINT_LEAST16_MAX__ 0xffff
+#define _STDBOOL_H 
+#define __FLT16_HAS_QUIET_NAN__ 1
+#define __NR_epoll_ctl_old 214
+#define __NR_init_module 175
+#define __ATOMIC_ACQUIRE 2
+#define SYS_getegid __NR_getegid
+#define _POSIX2_SW_DEV __POSIX2_THIS_VERSION
+#define __FLT128_MAX_10_EXP__ 4932
+#define __NR_delete_module 176
+#define BLKFLSBUF _IO(0x12,97)
+#define FS_XFLAG_COWEXTSIZE 0x00010000
+#define _CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS
+#define _SC_PII_OSI_COTS _SC_PII_OSI_COTS
+#define RWF_SUPPORTED (RWF_HIPRI | RWF_DSYNC | RWF_SYNC | RWF_NOWAIT | RWF_APPEND)
+#define _SC_NGROUPS_MAX _SC_NGROUPS_MAX
+#define __MAX_BAUD B4000000
+#define FS_NOCOMP_FL 0x00000400
+#define __NR_exit_group 231
+#define PRIXFAST64 __PRI64_PREFIX "X"
+#define SYS_ioprio_get __NR_ioprio_get
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+#define __GCC_IEC_559_COMPLEX 2
+#define TIOCSERGETMULTI 0x545A
+#define SCNiFAST8 "hhi"
+#define _LINUX_TIME_TYPES_H 
+#define __F_GETSIG 11
+#define VSWTC 7
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define FSCRYPT_KEY_SPEC_TYPE_IDENTIFIER 2
+#define _SC_SPIN_LOCKS _SC_SPIN_LOCKS
+#define _SC_TIMEOUTS _SC_TIMEOUTS
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+#define CRPRNT CREPRINT
+#define _PC_MAX_INPUT _PC_MAX_INPUT
+#define __UINT_LEAST8_TYPE__ unsigned char
+#define __SIZEOF_FLOAT80__ 16
+#define __NR_mkdirat 258
+#define _T_WCHAR_ 
+#define _SC_IPV6 _SC_IPV6
+#define SYS_get_mempolicy __NR_get_mempolicy
+#define SIOCDELDLCI 0x8981
+#define TIOCSIG _IOW('T', 0x36, int)
+#define IORING_SETUP_SQE128 (1U << 10)
+#define FIOASYNC 0x5452
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+#define TCIOFF 2
+#define __NR_io_uring_enter 426
+#define INT_LEAST16_MIN (-32767-1)
+#define _SC_XOPEN_REALTIME _SC_XOPEN_REALTIME
+#define __CFLOAT64 _Complex _Float64
+#define N_X25 6
+#define SYS_rt_sigtimedwait __NR_rt_sigtimedwait
+#define __NR_accept 43
+#define SYS_newfstatat __NR_newfstatat
+#define __flexarr []
+#define _SC_LINE_MAX _SC_LINE_MAX
+#define IOSQE_FIXED_FILE (1U << IOSQE_FIXED_FILE_BIT)
+#define __NR_openat 257
+#define FF0 0000000
+#define ACCESSPERMS (S_IRWXU|S_IRWXG|S_IRWXO)
+#define TCSETS2 _IOW('T', 0x2B, struct termios2)
+#define __S64_TYPE long int
+#define _POSIX_PRIORITIZED_IO 200809L
+#define EKEYEXPIRED 127
+#define SYS_fgetxattr __NR_fgetxattr
+#define _SC_LONG_BIT _SC_LONG_BIT
+#define __stub_fchflags 
+#define CMIN 1
+#define PRIuPTR __PRIPTR_PREFIX "u"
+#define __SQUAD_TYPE long int
+#define SYS_reboot __NR_reboot
+#define FSPICK_SYMLINK_NOFOLLOW 0x00000002
+#define SYS_request_key __NR_request_key
+#define __INTMAX_C(c) c ## L
+#define _SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE
+#define SIOCSIFHWADDR 0x8924
+#define PENDIN 0040000
+#define _BSD_SIZE_T_DEFINED_ 
+#define PTHREAD_CANCELED ((void *) -1)
+#define _BITS_TIME_H 1
+#define IORING_TIMEOUT_REALTIME (1U << 3)
+#define __NR_setdomainname 171
+#define __NR_open 2
+#define __socklen_t_defined 
+#define O_ACCMODE 0003
+#define SYS_swapon __NR_swapon
+#define SYS_rt_sigreturn __NR_rt_sigreturn
+#define TIOCEXCL 0x540C
+#define SYS_setitimer __NR_setitimer
+#define __CHAR_BIT__ 8
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+#define TIOCPKT_IOCTL 64
+#define SYS_inotify_rm_watch __NR_inotify_rm_watch
+#define IORING_POLL_UPDATE_EVENTS (1U << 1)
+#define __NR_timerfd_settime 286
+#define _IOC_DIRMASK ((1 << _IOC_DIRBITS)-1)
+#define __NR_getxattr 191
+#define SYS_sched_setaffinity __NR_sched_setaffinity
+#define MOUNT_ATTR_NOSUID 0x00000002
+#define EAFNOSUPPORT 97
+#define _SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS
+#define IORING_ASYNC_CANCEL_FD_FIXED (1U << 3)
+#define _SYS_STAT_H 1
+#define EREMCHG 78
+#define MOUNT_ATTR_NODEV 0x00000004
+#define __NR_semop 65
+#define SYS_msgctl __NR_msgctl
+#define __CPU_ZERO_S(setsize,cpusetp) do __builtin_memset (cpusetp, '\0', setsize); while (0)
+#define SYS_sync __NR_sync
+#define BLKTRACETEARDOWN _IO(0x12,118)
+#define __NR_swapoff 168
+#define EACCES 13
+#define __UINT8_MAX__ 0xff
+#define _POSIX_CLOCK_SELECTION 200809L
+#define EL3RST 47
+#define _POSIX_TYPED_MEMORY_OBJECTS -1
+#define FSCRYPT_KEY_DESCRIPTOR_SIZE 8
+#define __SCHAR_WIDTH__ 8
+#define SIOCADDDLCI 0x8980
+#define S_IFSOCK __S_IFSOCK
+#define FSCRYPT_KEY_REMOVAL_STATUS_FLAG_OTHER_USERS 0x00000002
+#define _SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS
+#define _XOPEN_UNIX 1
+#define FS_KEY_DESC_PREFIX_SIZE FSCRYPT_KEY_DESC_PREFIX_SIZE
+#define __NR_io_submit 209
+#define SYS_flock __NR_flock
+#define CREAD 0000200
+#define EDESTADDRREQ 89
+#define PRIiLEAST16 "i"
+#define INT16_C(c) c
+#define __WINT_MAX__ 0xffffffffU
+#define _SC_TTY_NAME_MAX _SC_TTY_NAME_MAX
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define PARENB 0000400
+#define SYS_exit __NR_exit
+#define TIME_UTC 1
+#define __FLT32_MIN_EXP__ (-125)
+#define IOSQE_ASYNC (1U << IOSQE_ASYNC_BIT)
+#define PIPE_BUF 4096
+#define _SC_XOPEN_XPG2 _SC_XOPEN_XPG2
+#define SYS_mremap __NR_mremap
+#define INT8_MAX (127)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+#define SIOCSIFHWBROADCAST 0x8937
+#define __NR_ioperm 173
+#define stderr stderr
+#define _CS_LFS_LIBS _CS_LFS_LIBS
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define __NR_mknod 133
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+#define PRIXLEAST8 "X"
+#define _CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS
+#define _CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS
+#define S_TYPEISSEM(buf) __S_TYPEISSEM(buf)
+#define EILSEQ 84
+#define SIOCSIFDSTADDR 0x8918
+#define _SC_PII_SOCKET _SC_PII_SOCKET
+#define FD_POLL_MS 100
+#define ESPIPE 29
+#define SYS_tkill __NR_tkill
+#define __NR_ioprio_get 252
+#define _SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32
+#define SYS_finit_module __NR_finit_module
+#define SYS_munmap __NR_munmap
+#define SYS_fdatasync __NR_fdatasync
+#define __NR_setpriority 141
+#define __NR_pkey_mprotect 329
+#define B1200 0000011
+#define EPERM 1
+#define __OFF_T_MATCHES_OFF64_T 1
+#define __NR_rt_sigqueueinfo 129
+#define EMLINK 31
+#define __NR_gettid 186
+#define __ORDER_LITTLE_ENDIAN__ 1234
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+#define IORING_FEAT_FAST_POLL (1U << 5)
+#define __NR_nanosleep 35
+#define SYS_clock_getres __NR_clock_getres
+#define EALREADY 114
+#define MS_NODEV 4
+#define SYS_pkey_alloc __NR_pkey_alloc
+#define IORING_OFF_CQ_RING 0x8000000ULL
+#define SYS_pwritev2 __NR_pwritev2
+#define PRIdMAX __PRI64_PREFIX "d"
+#define __WCHAR_MAX__ 0x7fffffff
+#define SIOCGIFADDR 0x8915
+#define SCNx16 "hx"
+#define _SC_2_C_DEV _SC_2_C_DEV
+#define _SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE
+#define ENOSR 63
+#define INT16_MAX (32767)
+#define FS_IOC_SETVERSION _IOW('v', 2, long)
+#define TIOCGWINSZ 0x5413
+#define __NR_pidfd_send_signal 424
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define MADV_MERGEABLE 12
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+#define __S_IREAD 0400
+#define EHOSTUNREACH 113
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+#define SYS_inotify_init __NR_inotify_init
+#define __NR_shmdt 67
+#define __GCC_IEC_559 2
+#define BLKGETSIZE64 _IOR(0x12,114,size_t)
+#define SYS_adjtimex __NR_adjtimex
+#define FS_ENCRYPTION_MODE_AES_256_CBC 3
+#define URING_DATA(id,op) (((uint64_t)(id) << 8) | (op))
+#define __FLT32X_DECIMAL_DIG__ 17
+#define F_RDLCK 0
+#define __NR_fanotify_init 300
+#define _IOFBF 0
+#define __NR_open_by_handle_at 304
+#define __FLT_EVAL_METHOD__ 0
+#define TIOCGPTPEER _IO('T', 0x41)
+#define _SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF
+#define FIGETBSZ _IO(0x00,2)
+#define TTYDEF_IFLAG (BRKINT | ISTRIP | ICRNL | IMAXBEL | IXON | IXANY)
+#define _SC_SPORADIC_SERVER _SC_SPORADIC_SERVER
+#define _IO_USER_LOCK 0x8000
+#define __NR_fsopen 430
+#define SYS_fsopen __NR_fsopen
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+#define SYS_chroot __NR_chroot
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+#define ECHONL 0000100
+#define FSCRYPT_KEY_STATUS_PRESENT 2
+#define _SC_XOPEN_STREAMS _SC_XOPEN_STREAMS
+#define _SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT
+#define _SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN
+#define __NR_read 0
+#define _CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS
+#define SYS_stat __NR_stat
+#define SYS_removexattr __NR_removexattr
+#define __FLT64_DECIMAL_DIG__ 17
+#define _XOPEN_VERSION 700
+#define SYS_preadv __NR_preadv
+#define __NR_kcmp 312
+#define _POSIX_ASYNC_IO 1
+#define SCHED_RR 2
+#define __HAVE_GENERIC_SELECTION 1
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+#define __HAVE_FLOAT64 1
+#define __NR_swapon 167
+#define __NR_io_getevents 208
+#define __aligned_be64 __be64 __attribute__((aligned(8)))
+#define _CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS
+#define LINK_MAX 127
+#define SYS_mq_timedreceive __NR_mq_timedreceive
+#define MAP_32BIT 0x40
+#define __NR_link 86
+#define FNONBLOCK O_NONBLOCK
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+#define INT8_MIN (-128)
+#define XATTR_SIZE_MAX 65536
+#define UTILITY_FDTHREAD_LINUX_H 
+#define __DEFINED_wchar_t 
+#define IORING_CQ_EVENTFD_DISABLED (1U << 0)
+#define FS_IOC_GET_ENCRYPTION_POLICY _IOW('f', 21, struct fscrypt_policy_v1)
+#define _SC_2_CHAR_TERM _SC_2_CHAR_TERM
+#define _CS_LFS_CFLAGS _CS_LFS_CFLAGS
+#define _SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX
+#define __CPU_COUNT_S(setsize,cpusetp) __sched_cpucount (setsize, cpusetp)
+#define SYS_readlink __NR_readlink
+#define PTHREAD_PROCESS_SHARED PTHREAD_PROCESS_SHARED
+#define SYS_creat __NR_creat
+#define __NR_execveat 322
+#define TCIOFLUSH 2
+#define _IOC_TYPE(nr) (((nr) >> _IOC_TYPESHIFT) & _IOC_TYPEMASK)
+#define SYS_futimesat __NR_futimesat
+#define __NR_sendmmsg 307
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+#define __S_IFIFO 0010000
+#define SYS_mount_setattr __NR_mount_setattr
+#define __NR_quotactl_fd 443
+#define __DEFINED_size_t 
+#define FS_NODUMP_FL 0x00000040
+#define __CPUMASK(cpu) ((__cpu_mask) 1 << ((cpu) % __NCPUBITS))
+#define SEEK_MAX SEEK_HOLE
+#define FS_XFLAG_PREALLOC 0x00000002
+#define __NR_timerfd_create 283
+#define bool _Bool
+#define __CFLOAT128 _Complex _Float128
+#define _SC_CPUTIME _SC_CPUTIME
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+#define __SIG_ATOMIC_TYPE__ int
+#define _ASM_GENERIC_ERRNO_BASE_H 
+#define __COMPAR_FN_T 
+#define SYS_fchdir __NR_fchdir
+#define __GID_T_TYPE __U32_TYPE
+#define SYS_vmsplice __NR_vmsplice
+#define IORING_SETUP_SQPOLL (1U << 1)
+#define SYS_get_thread_area __NR_get_thread_area
+#define __STATFS_MATCHES_STATFS64 1
+#define __DBL_MIN_10_EXP__ (-307)
+#define INT16_MIN (-32767-1)
+#define __FINITE_MATH_ONLY__ 0
+#define __id_t_defined 
+#define SYS_signalfd4 __NR_signalfd4
+#define _SC_PAGE_SIZE _SC_PAGESIZE
+#define PRIi32 "i"
+#define _SC_SCHAR_MAX _SC_SCHAR_MAX
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+#define __NR_set_tid_address 218
+#define __FLT32X_MAX_EXP__ 1024
+#define IORING_FEAT_EXT_ARG (1U << 8)
+#define EPOLLMSG EPOLLMSG
+#define EBADF 9
+#define _SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG
+#define EBADR 53
+#define SIOCGIFHWADDR 0x8927
+#define PRIxPTR __PRIPTR_PREFIX "x"
+#define __u_char_defined 
+#define __NR_setregid 114
+#define _SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS
+#define WIFEXITED(status) __WIFEXITED (status)
+#define __NR_setitimer 38
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+#define INLCR 0000100
+#define __pid_t_defined 
+#define ERANGE 34
+#define __FLT32_HAS_DENORM__ 1
+#define CQUIT 034
+#define ECANCELED 125
+#define MS_NOSYMFOLLOW 256
+#define S_IFBLK __S_IFBLK
+#define _POSIX_TRACE_EVENT_FILTER -1
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS
+#define SYS_shmat __NR_shmat
+#define FS_XFLAG_FILESTREAM 0x00004000
+#define __UINT_FAST8_MAX__ 0xff
+#define __LEAF , __leaf__
+#define __NR_membarrier 324
+#define _THREAD_MUTEX_INTERNAL_H 1
+#define PATH_MAX 4096
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define FSOPEN_CLOEXEC 0x00000001
+#define _BITS_TYPES_LOCALE_T_H 1
+#define __size_t 
+#define TIOCM_CTS 0x020
+#define _POSIX_SPIN_LOCKS 200809L
+#define BLKROGET _IO(0x12,94)
+#define SCNdLEAST8 "hhd"
+#define __FLT32_MAX_10_EXP__ 38
+#define _HAVE_STRUCT_TERMIOS_C_ISPEED 1
+#define INT_FAST8_MAX (127)
+#define __DEC64_MAX_EXP__ 385
+#define _WCHAR_T_DEFINED 
+#define _POSIX_V7_LP64_OFF64 1
+#define _XOPEN_XCU_VERSION 4
+#define __O_NOATIME 01000000
+#define PRIX16 "X"
+#define ETXTBSY 26
+#define IORING_POLL_UPDATE_USER_DATA (1U << 2)
+#define ENOMEM 12
+#define RWF_NOWAIT ((__kernel_rwf_t)0x00000008)
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __cleanup_fct_attribute 
+#define _SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES
+#define __INT8_C(c) c
+#define WCHAR_MAX __WCHAR_MAX
+#define TCOFLUSH 1
+#define MS_LAZYTIME (1<<25)
+#define TIOCSISO7816 _IOWR('T', 0x43, struct serial_iso7816)
+#define SIOCSIFNETMASK 0x891c
+#define SYS_inotify_init1 __NR_inotify_init1
+#define EPOLLEXCLUSIVE EPOLLEXCLUSIVE
+#define __INT_LEAST8_WIDTH__ 8
+#define _CS_PATH _CS_PATH
+#define MCL_CURRENT 1
+#define _ASM_X86_POSIX_TYPES_64_H 
+#define __NR_io_uring_register 427
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+#define _ERRNO_H 1
+#define __NR_mq_unlink 241
+#define IUTF8 0040000
+#define SYS_shmdt __NR_shmdt
+#define MOVE_MOUNT_T_SYMLINKS 0x00000010
+#define FITHAW _IOWR('X', 120, int)
+#define CLOCKS_PER_SEC ((__clock_t) 1000000)
+#define htobe16(x) __bswap_16 (x)
+#define _XBS5_LPBIG_OFFBIG -1
+#define FS_UNRM_FL 0x00000002
+#define _SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION
+#define __always_inline __inline __attribute__ ((__always_inline__))
+#define _SC_PII_OSI_M _SC_PII_OSI_M
+#define NFDBITS __NFDBITS
+#define IOC_IN (_IOC_WRITE << _IOC_DIRSHIFT)
+#define __NR_request_key 249
+#define __SHRT_MAX__ 0x7fff
+#define SYS_fsmount __NR_fsmount
+#define SCNd8 "hhd"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define PROT_NONE 0x0
+#define __NR_putpmsg 182
+#define _SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX
+#define __FLT64X_MAX_10_EXP__ 4932
+#define __NR_get_robust_list 274
+#define S_IXOTH (S_IXGRP >> 3)
+#define IORING_CQE_F_NOTIF (1U << 3)
+#define __NR_get_kernel_syms 177
+#define XCASE 0000004
+#define __ILP32_OFFBIG_CFLAGS "-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64"
+#define __NR_statx 332
+#define _SC_SCHAR_MIN _SC_SCHAR_MIN
+#define BLKIOOPT _IO(0x12,121)
+#define __daddr_t_defined 
+#define __NR_mkdir 83
+#define _POSIX_SYNCHRONIZED_IO 200809L
+#define __O_CLOEXEC 02000000
+#define FS_XFLAG_RTINHERIT 0x00000100
+#define __LDBL_IS_IEC_60559__ 2
+#define IORING_FEAT_RSRC_TAGS (1U << 10)
+#define VWERASE 14
+#define INT_FAST16_MAX (9223372036854775807L)
+#define TCION 3
+#define _HAVE_STRUCT_TERMIOS_C_OSPEED 1
+#define __fortify_function __extern_always_inline __attribute_artificial__
+#define FS_NOCOW_FL 0x00800000
+#define SIOCDARP 0x8953
+#define SYS_semctl __NR_semctl
+#define IORING_SQ_CQ_OVERFLOW (1U << 1)
+#define __FLT64X_HAS_QUIET_NAN__ 1
+#define SCNd16 "hd"
+#define _LFS_ASYNCHRONOUS_IO 1
+#define FS_IOC_REMOVE_ENCRYPTION_KEY _IOWR('f', 24, struct fscrypt_remove_key_arg)
+#define _CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION
+#define NAME_MAX 255
+#define _SYS_EPOLL_H 1
+#define SYS_process_vm_readv __NR_process_vm_readv
+#define _POSIX_JOB_CONTROL 1
+#define __UINT_LEAST8_MAX__ 0xff
+#define MAP_EXECUTABLE 0x01000
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+#define __NR_semctl 66
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+#define _SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64
+#define B0 0000000
+#define SIOCGIFMETRIC 0x891d
+#define _SC_SYMLOOP_MAX _SC_SYMLOOP_MAX
+#define __UINTMAX_TYPE__ long unsigned int
+#define SYS_epoll_pwait2 __NR_epoll_pwait2
+#define _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define _SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX
+#define __NR_sysinfo 99
+#define __ASM_GENERIC_BITS_PER_LONG 
+#define IORING_SETUP_SINGLE_ISSUER (1U << 12)
+#define SYS_epoll_pwait __NR_epoll_pwait
+#define __NR_getrandom 318
+#define __NR_utime 132
+#define INT_FAST8_MIN (-128)
+#define ICRNL 0000400
+#define SCNd32 "d"
+#define __NR_poll 7
+#define _POSIX_THREAD_CPUTIME 0
+#define __linux 1
+#define __DEC32_EPSILON__ 1E-6DF
+#define FS_FL_USER_VISIBLE 0x0003DFFF
+#define WCHAR_MIN __WCHAR_MIN
+#define __PRIPTR_PREFIX "l"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+#define _BITS_TYPES_H 1
+#define SYS_fspick __NR_fspick
+#define FD_TYPE_SOCKET 3
+#define __NR_pread64 17
+#define __unix 1
+#define SCNo16 "ho"
+#define ____gwchar_t_defined 1
+#define SYS_accept __NR_accept
+#define IGNCR 0000200
+#define _BITS_PTHREADTYPES_ARCH_H 1
+#define __NR_inotify_add_watch 254
+#define FS_XFLAG_NOSYMLINKS 0x00000400
+#define SYS_clock_adjtime __NR_clock_adjtime
+#define __UINT32_MAX__ 0xffffffffU
+#define SYS_geteuid __NR_geteuid
+#define __UID_T_TYPE __U32_TYPE
+#define SYS_flistxattr __NR_flistxattr
+#define B2500000 0010014
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+#define _POSIX_READER_WRITER_LOCKS 200809L
+#define PTHREAD_BARRIER_SERIAL_THREAD -1
+#define _SC_MB_LEN_MAX _SC_MB_LEN_MAX
+#define __SIZE_T 
+#define VSTOP 9
+#define PROT_GROWSDOWN 0x01000000
+#define SYS_getresgid __NR_getresgid
+#define _PC_NO_TRUNC _PC_NO_TRUNC
+#define __NR_mq_timedsend 242
+#define SCNd64 __PRI64_PREFIX "d"
+#define SYS_setresuid __NR_setresuid
+#define __S_ISVTX 01000
+#define _BITS_POSIX_OPT_H 1
+#define _SC_PII _SC_PII
+#define FSCRYPT_POLICY_FLAGS_PAD_16 0x02
+#define SCNo32 "o"
+#define FS_POLICY_FLAGS_VALID 0x07
+#define __NR_timerfd_gettime 287
+#define _SC_USHRT_MAX _SC_USHRT_MAX
+#define _SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R
+#define MS_SHARED (1<<20)
+#define __NR_pkey_free 331
+#define _ATFILE_SOURCE 1
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+#define SCNuLEAST16 "hu"
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+#define _SC_NETWORKING _SC_NETWORKING
+#define __FLT128_MIN_EXP__ (-16381)
+#define _STATBUF_ST_BLKSIZE 
+#define __struct_group_tag(TAG) TAG
+#define __WINT_MIN__ 0U
+#define SYS_readahead __NR_readahead
+#define __NR_removexattr 197
+#define SYS_access __NR_access
+#define VEOL 11
+#define WUNTRACED 2
+#define EPROTOTYPE 91
+#define _SC_SHELL _SC_SHELL
+#define FS_NOATIME_FL 0x00000080
+#define F_LOCK 1
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define _POSIX_V6_LP64_OFF64 1
+#define FSCRYPT_POLICY_FLAGS_PAD_32 0x03
+#define EISNAM 120
+#define TTYDEF_OFLAG (OPOST | ONLCR | XTABS)
+#define _STATBUF_ST_RDEV 
+#define UINT16_C(c) c
+#define SIOCSIFPFLAGS 0x8934
+#define SCNo8 "hho"
+#define __FLT128_MIN_10_EXP__ (-4931)
+#define ENOKEY 126
+#define MS_ACTIVE (1<<30)
+#define __FLT32X_IS_IEC_60559__ 2
+#define SCNo64 __PRI64_PREFIX "o"
+#define ENOMSG 42
+#define _PC_PRIO_IO _PC_PRIO_IO
+#define __NR_mq_notify 244
+#define EXIT_FAILURE 1
+#define _IOC_NONE 0U
+#define RENAME_EXCHANGE (1 << 1)
+#define __INT_LEAST16_WIDTH__ 16
+#define _SIZE_T_DEFINED_ 
+#define SYS_rt_sigaction __NR_rt_sigaction
+#define SYS_timerfd_gettime __NR_timerfd_gettime
+#define IUCLC 0001000
+#define SYS_setpgid __NR_setpgid
+#define __NR_inotify_init1 294
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define SYS_chdir __NR_chdir
+#define __SCHAR_MAX__ 0x7f
+#define __NR_semget 64
+#define __FLT128_MANT_DIG__ 113
+#define SYS_getgid __NR_getgid
+#define _SC_SELECT _SC_SELECT
+#define IOC_INOUT ((_IOC_WRITE|_IOC_READ) << _IOC_DIRSHIFT)
+#define __NR_munmap 11
+#define SYS_eventfd __NR_eventfd
+#define BLKSSZGET _IO(0x12,104)
+#define __NR_nfsservctl 180
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+#define SYS_timer_settime __NR_timer_settime
+#define __KERNEL_STRICT_NAMES 
+#define SCNxFAST16 __PRIPTR_PREFIX "x"
+#define __NR_munlockall 152
+#define FS_IOC_FSGETXATTR _IOR('X', 31, struct fsxattr)
+#define PTHREAD_COND_INITIALIZER { { {0}, {0}, {0, 0}, {0, 0}, 0, 0, {0, 0} } }
+#define IORING_TIMEOUT_UPDATE_MASK (IORING_TIMEOUT_UPDATE | IORING_LINK_TIMEOUT_UPDATE)
+#define __INT64_C(c) c ## L
+#define POSIX_MADV_SEQUENTIAL 2
+#define SCNuLEAST64 __PRI64_PREFIX "u"
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NR_prctl 157
+#define _CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+#define __NR_rt_sigpending 127
+#define __INT_WCHAR_T_H 
+#define WSTOPPED 2
+#define B3000000 0010015
+#define _LINUX_MOUNT_H 
+#define S_IFLNK __S_IFLNK
+#define FD_URING 1
+#define MS_REMOUNT 32
+#define __ASM_X86_BITSPERLONG_H 
+#define _CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS
+#define MS_KERNMOUNT (1<<22)
+#define FICLONERANGE _IOW(0x94, 13, struct file_clone_range)
+#define SYS_clock_nanosleep __NR_clock_nanosleep
+#define IORING_FEAT_NODROP (1U << 1)
+#define _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS
+#define __NR_lremovexattr 198
+#define SCNoFAST64 __PRI64_PREFIX "o"
+#define _SC_2_C_BIND _SC_2_C_BIND
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+#define TIOCSERGSTRUCT 0x5458
+#define VTIME 5
+#define FS_XFLAG_REALTIME 0x00000001
+#define DEFFILEMODE (S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP|S_IROTH|S_IWOTH)
+#define PRIxFAST32 __PRIPTR_PREFIX "x"
+#define _SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX
+#define SYS_execve __NR_execve
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+#define EMULTIHOP 72
+#define FSCRYPT_KEY_STATUS_ABSENT 1
+#define TIOCLINUX 0x541C
+#define _SC_2_UPE _SC_2_UPE
+#define _POSIX_SOURCE 1
+#define __NR_epoll_ctl 233
+#define S_IRWXO (S_IRWXG >> 3)
+#define __NR_pwritev 296
+#define SCNu8 "hhu"
+#define FS_JOURNAL_DATA_FL 0x00004000
+#define _SC_PII_OSI_CLTS _SC_PII_OSI_CLTS
+#define __NR_pwritev2 328
+#define __NR_quotactl 179
+#define __NR_perf_event_open 298
+#define _DEFAULT_SOURCE 1
+#define _LINUX_POSIX_TYPES_H 
+#define VDISCARD 13
+#define FS_XFLAG_PROJINHERIT 0x00000200
+#define __NR_newfstatat 262
+#define __attribute_used__ __attribute__ ((__used__))
+#define PRIuLEAST16 "u"
+#define SIOCDELRT 0x890C
+#define SCNxFAST64 __PRI64_PREFIX "x"
+#define INPCK 0000020
+#define S_IFMT __S_IFMT
+#define SYS_splice __NR_splice
+#define CLOCK_REALTIME 0
+#define __LOCK_ALIGNMENT 
+#define __FLT32X_MANT_DIG__ 53
+#define __NR_tuxcall 184
+#define __NR_setresuid 117
+#define __NR_mincore 27
+#define _XOPEN_REALTIME_THREADS 1
+#define __NR_rt_sigreturn 15
+#define ETIMEDOUT 110
+#define __NR_epoll_wait_old 215
+#define _ASM_GENERIC_INT_LL64_H 
+#define __X32_SYSCALL_BIT 0x40000000
+#define PRIuFAST16 __PRIPTR_PREFIX "u"
+#define _SC_VERSION _SC_VERSION
+#define S_ISSOCK(mode) __S_ISTYPE((mode), __S_IFSOCK)
+#define _SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX
+#define SYS_llistxattr __NR_llistxattr
+#define S_TYPEISSHM(buf) __S_TYPEISSHM(buf)
+#define SCNx32 "x"
+#define EPOLL_CTL_DEL 2
+#define __NR_setfsgid 123
+#define SYS_fremovexattr __NR_fremovexattr
+#define SCHED_OTHER 0
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+#define ECOMM 70
+#define SYS_dup __NR_dup
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+#define ENODATA 61
+#define SCNx8 "hhx"
+#define _BITS_ENDIANNESS_H 1
+#define PRIuLEAST32 "u"
+#define FSCRYPT_POLICY_FLAG_DIRECT_KEY 0x04
+#define __NR_restart_syscall 219
+#define __NR_process_vm_readv 310
+#define _SC_BC_SCALE_MAX _SC_BC_SCALE_MAX
+#define __GLIBC__ 2
+#define BLKBSZSET _IOW(0x12,113,size_t)
+#define _SC_POLL _SC_POLL
+#define IORING_NOTIF_USAGE_ZC_COPIED (1U << 31)
+#define PTHREAD_CANCEL_DEFERRED PTHREAD_CANCEL_DEFERRED
+#define __END_DECLS 
+#define _STATBUF_ST_NSEC 
+#define PRIuFAST32 __PRIPTR_PREFIX "u"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+#define _POSIX_V6_LPBIG_OFFBIG -1
+#define __CONCAT(x,y) x ## y
+#define _SC_RTSIG_MAX _SC_RTSIG_MAX
+#define CREPRINT CTRL('r')
+#define WCONTINUED 8
+#define SYS_timer_delete __NR_timer_delete
+#define __NR_vhangup 153
+#define __STDC_HOSTED__ 1
+#define _SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX
+#define E2BIG 7
+#define _IOC_TYPECHECK(t) (sizeof(t))
+#define FSCRYPT_MODE_AES_256_CTS 4
+#define __BITS_PER_LONG 64
+#define __SLONG32_TYPE int
+#define _BITS_UINTN_IDENTITY_H 1
+#define TCSBRKP 0x5425
+#define _SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE
+#define F_GETLK F_GETLK64
+#define _SYS_SELECT_H 1
+#define CTIME 0
+#define POSIX_MADV_WILLNEED 3
+#define PRIuLEAST64 __PRI64_PREFIX "u"
+#define __NR_landlock_create_ruleset 444
+#define BLKSECTSET _IO(0x12,102)
+#define __DEC64_MIN_EXP__ (-382)
+#define SYS_poll __NR_poll
+#define _XOPEN_ENH_I18N 1
+#define B230400 0010003
+#define TIOCM_RTS 0x004
+#define __NR_io_destroy 207
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define NCC 8
+#define __jmp_buf_tag_defined 1
+#define TIOCGSID 0x5429
+#define _PC_PIPE_BUF _PC_PIPE_BUF
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+#define SIOCSIFMAP 0x8971
+#define __O_NOFOLLOW 0400000
+#define _SC_TZNAME_MAX _SC_TZNAME_MAX
+#define FS_COMPR_FL 0x00000004
+#define __NR_renameat 264
+#define __NR_clock_getres 229
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS
+#define ENOTTY 25
+#define MS_BIND 4096
+#define __GNU_LIBRARY__ 6
+#define EPOLLIN EPOLLIN
+#define SCNi32 "i"
+#define __DBL_DIG__ 15
+#define __FLT32_DIG__ 6
+#define MS_ASYNC 1
+#define EINTR 4
+#define CMSPAR 010000000000
+#define _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS
+#define __RLIM_T_MATCHES_RLIM64_T 1
+#define _SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER
+#define MAP_FAILED ((void *) -1)
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+#define __NR_mount 165
+#define __NR_lsetxattr 189
+#define INT32_MIN (-2147483647-1)
+#define SYS_time __NR_time
+#define ENOLINK 67
+#define __NCPUBITS (8 * sizeof (__cpu_mask))
+#define __NR_inotify_init 253
+#define _IO_EOF_SEEN 0x0010
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define _IOC_SIZESHIFT (_IOC_TYPESHIFT+_IOC_TYPEBITS)
+#define ECHILD 10
+#define _SC_TIMER_MAX _SC_TIMER_MAX
+#define _POSIX_SPAWN 200809L
+#define __SHRT_WIDTH__ 16
+#define _CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS
+#define EISDIR 21
+#define __f64x(x) x ##f64x
+#define BLKRAGET _IO(0x12,99)
+#define MS_NOEXEC 8
+#define SYS_prctl __NR_prctl
+#define ICANON 0000002
+#define _STDIO_H 1
+#define RENAME_NOREPLACE (1 << 0)
+#define ENOENT 2
+#define TMP_MAX 238328
+#define __FLT32_IS_IEC_60559__ 2
+#define SYS_lookup_dcookie __NR_lookup_dcookie
+#define PTHREAD_CANCEL_ASYNCHRONOUS PTHREAD_CANCEL_ASYNCHRONOUS
+#define __NR_fgetxattr 193
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define S_IWGRP (S_IWUSR >> 3)
+#define __NR_wait4 61
+#define SIOCGIFPFLAGS 0x8935
+#define SYS_pidfd_getfd __NR_pidfd_getfd
+#define _CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS
+#define IOSQE_IO_HARDLINK (1U << IOSQE_IO_HARDLINK_BIT)
+#define EPOLLWRBAND EPOLLWRBAND
+#define POSIX_MADV_DONTNEED 4
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+#define __STDC_UTF_16__ 1
+#define _____fpos_t_defined 1
+#define __nonnull(params) __attribute_nonnull__ (params)
+#define __DBL_IS_IEC_60559__ 2
+#define SYS_symlinkat __NR_symlinkat
+#define BLKTRACESETUP _IOWR(0x12,115,struct blk_user_trace_setup)
+#define le32toh(x) __uint32_identity (x)
+#define _SIZE_T_DEFINED 
+#define SYS_setgroups __NR_setgroups
+#define SIOCGIFCOUNT 0x8938
+#define SYS_getitimer __NR_getitimer
+#define SYS_epoll_create1 __NR_epoll_create1
+#define __DEC32_MAX__ 9.999999E96DF
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+#define EPOLLERR EPOLLERR
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+#define __O_LARGEFILE 0
+#define ENOTNAM 118
+#define FS_DIRSYNC_FL 0x00010000
+#define __ASM_GENERIC_IOCTLS_H 
+#define TIOCNXCL 0x540D
+#define AT_SYMLINK_FOLLOW 0x400
+#define SIOCSIFFLAGS 0x8914
+#define _SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED
+#define __NR_munlock 150
+#define MADV_REMOVE 9
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+#define MS_NODIRATIME 2048
+#define _WCHAR_T_ 
+#define _POSIX_THREAD_ATTR_STACKSIZE 200809L
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+#define SYS_lsetxattr __NR_lsetxattr
+#define __F_SETOWN 8
+#define ECHO 0000010
+#define EADV 68
+#define CLOCK_BOOTTIME_ALARM 9
+#define TIOCSLCKTRMIOS 0x5457
+#define _VA_LIST_DEFINED 
+#define __FLT32X_HAS_INFINITY__ 1
+#define _SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE
+#define __INT32_MAX__ 0x7fffffff
+#define FS_RESERVED_FL 0x80000000
+#define _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS
+#define __GLIBC_USE_DEPRECATED_GETS 0
+#define __SIZEOF_PTHREAD_COND_T 48
+#define SCNoLEAST16 "ho"
+#define _POSIX_THREAD_SAFE_FUNCTIONS 200809L
+#define __FLT16_DIG__ 3
+#define _POSIX_V7_LPBIG_OFFBIG -1
+#define __unix__ 1
+#define STDOUT_FILENO 1
+#define __NR_dup2 33
+#define __NR_kexec_file_load 320
+#define EUCLEAN 117
+#define __INT_WIDTH__ 32
+#define __SIZEOF_LONG__ 8
+#define _IONBF 2
+#define __NR_mount_setattr 442
+#define O_NDELAY O_NONBLOCK
+#define __S_IFCHR 0020000
+#define EXFULL 54
+#define B300 0000007
+#define O_ASYNC 020000
+#define TCOOFF 0
+#define __NR_select 23
+#define __STDC_IEC_559__ 1
+#define B1152000 0010011
+#define IORING_FEAT_RW_CUR_POS (1U << 3)
+#define __STDC_ISO_10646__ 201706L
+#define PRIoFAST16 __PRIPTR_PREFIX "o"
+#define __NR_semtimedop 220
+#define __NR_syslog 103
+#define _SC_NL_NMAX _SC_NL_NMAX
+#define FS_IOC_SET_ENCRYPTION_POLICY _IOR('f', 19, struct fscrypt_policy_v1)
+#define __UINT16_C(c) c
+#define ELOOP 40
+#define VEOL2 16
+#define MAP_PRIVATE 0x02
+#define _SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R
+#define B576000 0010006
+#define OPOST 0000001
+#define SCNoLEAST32 "o"
+#define CFLUSH CDISCARD
+#define _SC_UIO_MAXIOV _SC_UIO_MAXIOV
+#define CLNEXT CTRL('v')
+#define __NR_lchown 94
+#define __DECIMAL_DIG__ 21
+#define CR0 0000000
+#define CR1 0001000
+#define CR2 0002000
+#define CR3 0003000
+#define B1500000 0010012
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+#define __USE_FORTIFY_LEVEL 0
+#define __STDC_IEC_559_COMPLEX__ 1
+#define LOCK_EX 2
+#define __NR_mlockall 151
+#define IORING_SETUP_IOPOLL (1U << 0)
+#define TIOCSRS485 0x542F
+#define MAP_TYPE 0x0f
+#define PRIoFAST32 __PRIPTR_PREFIX "o"
+#define F_DUPFD 0
+#define TCIFLUSH 0
+#define VKILL 3
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+#define __gnu_linux__ 1
+#define _SC_T_IOV_MAX _SC_T_IOV_MAX
+#define CS5 0000000
+#define __NR_fsync 74
+#define CS7 0000040
+#define TCSAFLUSH 2
+#define __NR_close 3
+#define MAX_INPUT 255
+#define CLOCK_BOOTTIME 7
+#define __FLT128_IS_IEC_60559__ 2
+#define MOVE_MOUNT_T_EMPTY_PATH 0x00000040
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __NR_fstat 5
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+#define _SC_2_SW_DEV _SC_2_SW_DEV
+#define N_STRIP 4
+#define _PC_FILESIZEBITS _PC_FILESIZEBITS
+#define __NR_capset 126
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+#define SYS_quotactl __NR_quotactl
+#define SCNdLEAST32 "d"
+#define SYS_fanotify_init __NR_fanotify_init
+#define _SC_CLOCK_SELECTION _SC_CLOCK_SELECTION
+#define FNDELAY O_NDELAY
+#define TIOCGPGRP 0x540F
+#define LINUX_IO_URING_H 
+#define PRIX8 "X"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+#define _SC_UINT_MAX _SC_UINT_MAX
+#define SYNC_FILE_RANGE_WRITE 2
+#define _POSIX_THREAD_ATTR_STACKADDR 200809L
+#define SYS_getpgrp __NR_getpgrp
+#define __LDBL_HAS_QUIET_NAN__ 1
+#define INT64_C(c) c ## L
+#define EBUSY 16
+#define PRIuFAST8 "u"
+#define PRIoFAST64 __PRI64_PREFIX "o"
+#define __USE_ISOC11 1
+#define S_ISDIR(mode) __S_ISTYPE((mode), __S_IFDIR)
+#define MADV_NORMAL 0
+#define __HAVE_FLOAT64X 1
+#define MS_NOATIME 1024
+#define __FLT16_MIN_EXP__ (-13)
+#define __NR_sendfile 40
+#define TIOCPKT_DOSTOP 32
+#define __NR_getdents 78
+#define __NR_ftruncate 77
+#define FS_POLICY_FLAGS_PAD_4 FSCRYPT_POLICY_FLAGS_PAD_4
+#define _POSIX_MAPPED_FILES 200809L
+#define SYS_copy_file_range __NR_copy_file_range
+#define RTSIG_MAX 32
+#define __FLT64_MANT_DIG__ 53
+#define __attribute_const__ __attribute__ ((__const__))
+#define FSCRYPT_MODE_AES_128_CTS 6
+#define SYS_linkat __NR_linkat
+#define _SC_FIFO _SC_FIFO
+#define _PC_PATH_MAX _PC_PATH_MAX
+#define MS_RDONLY 1
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define _SC_XOPEN_VERSION _SC_XOPEN_VERSION
+#define SYS_recvfrom __NR_recvfrom
+#define SCNxFAST8 "hhx"
+#define _POSIX_NO_TRUNC 1
+#define SCNdLEAST64 __PRI64_PREFIX "d"
+#define htobe32(x) __bswap_32 (x)
+#define BLKGETDISKSEQ _IOR(0x12,128,__u64)
+#define B460800 0010004
+#define SYS_mount __NR_mount
+#define __FLT64X_MANT_DIG__ 64
+#define _POSIX2_C_VERSION __POSIX2_THIS_VERSION
+#define __NR_times 100
+#define BLKSECTGET _IO(0x12,103)
+#define IEXTEN 0100000
+#define SYS_msgsnd __NR_msgsnd
+#define _SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG
+#define SYS_wait4 __NR_wait4
+#define L_tmpnam 20
+#define ___int_wchar_t_h 
+#define UINT8_C(c) c
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+#define __GNUC__ 12
+#define FS_IOC_GETFSLABEL _IOR(0x94, 49, char[FSLABEL_MAX])
+#define MADV_WIPEONFORK 18
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+#define _IOC_NR(nr) (((nr) >> _IOC_NRSHIFT) & _IOC_NRMASK)
+#define _CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS
+#define PRIoLEAST16 "o"
+#define UINT_LEAST8_MAX (255)
+#define TIOCOUTQ 0x5411
+#define __MMX__ 1
+#define SYS_setpriority __NR_setpriority
+#define SYS_keyctl __NR_keyctl
+#define TAB1 0004000
+#define TAB2 0010000
+#define TAB3 0014000
+#define SYS_sched_getparam __NR_sched_getparam
+#define L_ctermid 9
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define FS_INLINE_DATA_FL 0x10000000
+#define IORING_LINK_TIMEOUT_UPDATE (1U << 4)
+#define __NR_memfd_secret 447
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define __FLT_HAS_DENORM__ 1
+#define __SIZEOF_LONG_DOUBLE__ 16
+#define URING_ENTRIES 64
+#define MCL_ONFAULT 4
+#define POSIX_FADV_WILLNEED 3
+#define __NR_madvise 28
+#define __aligned_u64 __u64 __attribute__((aligned(8)))
+#define __NR_recvfrom 45
+#define FS_ENCRYPTION_MODE_SPECK128_256_CTS 8
+#define PRIoLEAST32 "o"
+#define LOCK_NB 4
+#define _SC_ARG_MAX _SC_ARG_MAX
+#define __timeval_defined 1
+#define __NR_unlinkat 263
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define _SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32
+#define SYS_clone __NR_clone
+#define __NR_pivot_root 155
+#define XTABS 0014000
+#define ISTRIP 0000040
+#define PRIdLEAST16 "d"
+#define PTHREAD_CREATE_JOINABLE PTHREAD_CREATE_JOINABLE
+#define __NR_socketpair 53
+#define _SC_USER_GROUPS_R _SC_USER_GROUPS_R
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define SEEK_CUR 1
+#define ELNRNG 48
+#define __BIGGEST_ALIGNMENT__ 16
+#define _SC_BC_STRING_MAX _SC_BC_STRING_MAX
+#define CLOCAL 0004000
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define TIOCSBRK 0x5427
+#define FSCRYPT_POLICY_FLAGS_PAD_MASK 0x03
+#define TIOCGISO7816 _IOR('T', 0x42, struct serial_iso7816)
+#define STDERR_FILENO 2
+#define SYS_kexec_load __NR_kexec_load
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+#define IORING_SETUP_COOP_TASKRUN (1U << 8)
+#define POSIX_FADV_DONTNEED __POSIX_FADV_DONTNEED
+#define PRIuMAX __PRI64_PREFIX "u"
+#define __ONCE_ALIGNMENT 
+#define MAX_EVENTS 64
+#define SYS_process_mrelease __NR_process_mrelease
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+#define __FLT64_MAX_10_EXP__ 308
+#define IORING_FEAT_SINGLE_MMAP (1U << 0)
+#define NGROUPS_MAX 65536
+#define SIOCDELMULTI 0x8932
+#define PRIdLEAST32 "d"
+#define _POSIX_CHOWN_RESTRICTED 0
+#define PRIoLEAST64 __PRI64_PREFIX "o"
+#define __GLIBC_USE_LIB_EXT2 0
+#define __USE_ISOC95 1
+#define _TIME_H 1
+#define N_PROFIBUS_FDL 10
+#define __USE_ISOC99 1
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define O_FSYNC O_SYNC
+#define EXTA B19200
+#define FSPICK_NO_AUTOMOUNT 0x00000004
+#define TCSETAF 0x5408
+#define __FLT16_MAX_10_EXP__ 4
+#define PRIi64 __PRI64_PREFIX "i"
+#define _SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS
+#define FIONCLEX 0x5450
+#define _GCC_WCHAR_T 
+#define _SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define FS_IOC_ADD_ENCRYPTION_KEY _IOWR('f', 23, struct fscrypt_add_key_arg)
+#define FSLABEL_MAX 256
+#define _SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE
+#define _BITS_STDINT_UINTN_H 1
+#define PRIiFAST16 __PRIPTR_PREFIX "i"
+#define _CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS
+#define __NR_clock_adjtime 305
+#define SYS_security __NR_security
+#define _SYS_MMAN_H 1
+#define MAP_ANON MAP_ANONYMOUS
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+#define TIOCCBRK 0x5428
+#define _CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS
+#define __DBL_HAS_INFINITY__ 1
+#define SYS_fsync __NR_fsync
+#define SYS_close __NR_close
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define SYS_select __NR_select
+#define _PC_SYMLINK_MAX _PC_SYMLINK_MAX
+#define __HAVE_FLOAT32 1
+#define PRIdLEAST64 __PRI64_PREFIX "d"
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+#define TIOCPKT_FLUSHWRITE 2
+#define _CS_LFS_LDFLAGS _CS_LFS_LDFLAGS
+#define B9600 0000015
+#define _PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED
+#define SYS_statx __NR_statx
+#define PRId8 "d"
+#define VMIN 6
+#define __NR_pidfd_getfd 438
+#define __SIZEOF_FLOAT__ 4
+#define __NR_unshare 272
+#define PRIiFAST32 __PRIPTR_PREFIX "i"
+#define BLKTRACESTOP _IO(0x12,117)
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define PRIi16 "i"
+#define SYS_sched_setscheduler __NR_sched_setscheduler
+#define TIOCMGET 0x5415
+#define __NR_io_setup 206
+#define SYS_getrusage __NR_getrusage
+#define __USE_XOPEN2K 1
+#define LOCK_UN 8
+#define SYS_clock_settime __NR_clock_settime
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+#define IORING_TIMEOUT_ABS (1U << 0)
+#define SYS_chmod __NR_chmod
+#define __NR_getgroups 115
+#define _SC_CLK_TCK _SC_CLK_TCK
+#define __lldiv_t_defined 1
+#define _SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC
+#define __DEC32_MIN_EXP__ (-94)
+#define SCHED_FIFO 1
+#define SYS_setgid __NR_setgid
+#define SYS__sysctl __NR__sysctl
+#define __DADDR_T_TYPE __S32_TYPE
+#define EHWPOISON 133
+#define FSPICK_EMPTY_PATH 0x00000008
+#define _SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE
+#define BLKALIGNOFF _IO(0x12,122)
+#define EDEADLK 35
+#define __INTPTR_WIDTH__ 64
+#define __FLT64X_HAS_INFINITY__ 1
+#define EPIPE 32
+#define _POSIX_THREAD_SPORADIC_SERVER -1
+#define _SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R
+#define FD_TYPE_FILE 0
+#define OFILL 0000100
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+#define __NR_ioprio_set 251
+#define FSPICK_CLOEXEC 0x00000001
+#define __CPU_ISSET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? ((((const __cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] & __CPUMASK (__cpu))) != 0 : 0; }))
+#define FSCRYPT_MODE_ADIANTUM 9
+#define FIOQSIZE 0x5460
+#define PRIiFAST64 __PRI64_PREFIX "i"
+#define __FD_SETSIZE 1024
+#define be32toh(x) __bswap_32 (x)
+#define FSCRYPT_MAX_KEY_SIZE 64
+#define MS_SYNC 4
+#define _PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE
+#define __FLT32X_HAS_DENORM__ 1
+#define __INT_FAST16_TYPE__ long int
+#define __HAVE_FLOAT128X 0
+#define _XBS5_LP64_OFF64 1
+#define TCOON 1
+#define _POSIX_PRIORITY_SCHEDULING 200809L
+#define SYS_open_by_handle_at __NR_open_by_handle_at
+#define _IOC_TYPEMASK ((1 << _IOC_TYPEBITS)-1)
+#define _SC_XOPEN_SHM _SC_XOPEN_SHM
+#define POSIX_MADV_NORMAL 0
+#define SYS_pwrite64 __NR_pwrite64
+#define __MMX_WITH_SSE__ 1
+#define _WCHAR_T_DEFINED_ 
+#define _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS
+#define SIOCGIFBR 0x8940
+#define SYS_getsockname __NR_getsockname
+#define PRIi8 "i"
+#define __INO_T_MATCHES_INO64_T 1
+#define SCNdFAST8 "hhd"
+#define EBADMSG 74
+#define __NR_getpeername 52
+#define _POSIX_REGEXP 1
+#define _SC_CHILD_MAX _SC_CHILD_MAX
+#define FS_EOFBLOCKS_FL 0x00400000
+#define __USE_POSIX199506 1
+#define _FEATURES_H 1
+#define SYS_set_robust_list __NR_set_robust_list
+#define __LDBL_HAS_DENORM__ 1
+#define __NR_getitimer 36
+#define SCNiLEAST16 "hi"
+#define TCSETA 0x5406
+#define __NR_set_thread_area 205
+#define FSCRYPT_KEY_REMOVAL_STATUS_FLAG_FILES_BUSY 0x00000001
+#define __SEG_GS 1
+#define __stub_setlogin 
+#define OPEN_TREE_CLOEXEC O_CLOEXEC
+#define _POSIX_SPORADIC_SERVER -1
+#define __FLT128_HAS_INFINITY__ 1
+#define __NR_landlock_add_rule 445
+#define IORING_ASYNC_CANCEL_ALL (1U << 0)
+#define SYS_faccessat2 __NR_faccessat2
+#define SYS_mbind __NR_mbind
+#define _GCC_WRAP_STDINT_H 
+#define IORING_FSYNC_DATASYNC (1U << 0)
+#define SCNoLEAST64 __PRI64_PREFIX "o"
+#define _IOC_NRSHIFT 0
+#define _POSIX_MEMORY_PROTECTION 200809L
+#define POSIX_FADV_NORMAL 0
+#define __NR_msgrcv 70
+#define TIOCGETD 0x5424
+#define __DEC32_MIN__ 1E-95DF
+#define _IOC_SIZE(nr) (((nr) >> _IOC_SIZESHIFT) & _IOC_SIZEMASK)
+#define __NR_truncate 76
+#define FD_BACKEND_URING 1
+#define S_IFCHR __S_IFCHR
+#define SYS_setfsuid __NR_setfsuid
+#define true 1
+#define SCNiLEAST32 "i"
+#define __dev_t_defined 
+#define _SC_XOPEN_CRYPT _SC_XOPEN_CRYPT
+#define __NR_setresgid 119
+#define __NR_sched_setparam 142
+#define _SC_RAW_SOCKETS _SC_RAW_SOCKETS
+#define __S32_TYPE int
+#define _SC_PHYS_PAGES _SC_PHYS_PAGES
+#define _POSIX2_LOCALEDEF __POSIX2_THIS_VERSION
+#define SYS_getpid __NR_getpid
+#define SYS_write __NR_write
+#define EUNATCH 49
+#define SYS_fchown __NR_fchown
+#define _SC_2_FORT_DEV _SC_2_FORT_DEV
+#define __DBL_MAX_EXP__ 1024
+#define IXON 0002000
+#define __GLIBC_LINUX_VERSION_CODE 332544
+#define _SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER
+#define SYS_setsockopt __NR_setsockopt
+#define __WCHAR_WIDTH__ 32
+#define __BIT_TYPES_DEFINED__ 1
+#define _SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM
+#define MAP_LOCKED 0x02000
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define __NR_getresuid 118
+#define _BITS_WCHAR_H 1
+#define __NR_lstat 6
+#define FS_XFLAG_HASATTR 0x80000000
+#define __DEC128_EPSILON__ 1E-33DL
+#define __NR_setsockopt 54
+#define SYS_lseek __NR_lseek
+#define _POSIX_TIMERS 200809L
+#define ERFKILL 132
+#define _IOC_TYPESHIFT (_IOC_NRSHIFT+_IOC_NRBITS)
+#define __FLT16_DECIMAL_DIG__ 5
+#define EREMOTEIO 121
+#define TAB0 0000000
+#define __SSE2_MATH__ 1
+#define __ATOMIC_HLE_RELEASE 131072
+#define CINTR CTRL('c')
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define PDP_ENDIAN __PDP_ENDIAN
+#define EREMOTE 66
+#define _SC_OPEN_MAX _SC_OPEN_MAX
+#define S_BLKSIZE 512
+#define PRIo8 "o"
+#define SCNiLEAST64 __PRI64_PREFIX "i"
+#define __NR_rt_sigtimedwait 128
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+#define ETOOMANYREFS 109
+#define _SC_STREAM_MAX _SC_STREAM_MAX
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+#define EPFNOSUPPORT 96
+#define CEOF CTRL('d')
+#define __amd64 1
+#define CEOL _POSIX_VDISABLE
+#define __SYSCALL_WORDSIZE 64
+#define CEOT CEOF
+#define MS_RELATIME (1<<21)
+#define OPEN_TREE_CLONE 1
+#define MADV_KEEPONFORK 19
+#define SCNdLEAST16 "hd"
+#define PROT_EXEC 0x4
+#define ENOTSUP EOPNOTSUPP
+#define TIOCM_DSR 0x100
+#define SYS_memfd_create __NR_memfd_create
+#define SYS_munlock __NR_munlock
+#define SYS_sched_getaffinity __NR_sched_getaffinity
+#define _SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO
+#define SCNdFAST16 __PRIPTR_PREFIX "d"
+#define __NR_reboot 169
+#define BLKZEROOUT _IO(0x12,127)
+#define __NR_dup 32
+#define __NR_process_mrelease 448
+#define _SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE
+#define SYS_create_module __NR_create_module
+#define __USECONDS_T_TYPE __U32_TYPE
+#define TIOCM_DTR 0x002
+#define N_6PACK 7
+#define TCGETX 0x5432
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define MS_NOSEC (1<<28)
+#define __glibc_objsize(__o) __bos (__o)
+#define SYS_mkdir __NR_mkdir
+#define PARODD 0001000
+#define SYS_clone3 __NR_clone3
+#define ENONET 64
+#define EPOLLRDBAND EPOLLRDBAND
+#define _LINUX_STDDEF_H 
+#define __ATOMIC_HLE_ACQUIRE 65536
+#define SYS_setxattr __NR_setxattr
+#define SYS_add_key __NR_add_key
+#define PTHREAD_CANCEL_ENABLE PTHREAD_CANCEL_ENABLE
+#define _T_WCHAR 
+#define __NR_msgctl 71
+#define _PC_VDISABLE _PC_VDISABLE
+#define SYS_writev __NR_writev
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+#define EBADSLT 57
+#define __NR_create_module 174
+#define __SIZEOF_SIZE_T__ 8
+#define IORING_TIMEOUT_ETIME_SUCCESS (1U << 5)
+#define __GIT_REVPARSE__ 0xeb544d5
+#define _SC_BARRIERS _SC_BARRIERS
+#define _SC_XOPEN_LEGACY _SC_XOPEN_LEGACY
+#define TIOCGICOUNT 0x545D
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+#define _WCHAR_T 
+#define O_NONBLOCK 04000
+#define SCNiPTR __PRIPTR_PREFIX "i"
+#define st_atime st_atim.tv_sec
+#define PTHREAD_MUTEX_INITIALIZER { { __PTHREAD_MUTEX_INITIALIZER (PTHREAD_MUTEX_TIMED_NP) } }
+#define B500000 0010005
+#define VSUSP 10
+#define N_SLIP 1
+#define TCSADRAIN 1
+#define SYS_rt_tgsigqueueinfo __NR_rt_tgsigqueueinfo
+#define __NR_mprotect 10
+#define O_APPEND 02000
+#define SYS_rt_sigqueueinfo __NR_rt_sigqueueinfo
+#define PTHREAD_CREATE_DETACHED PTHREAD_CREATE_DETACHED
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+#define _LINUX_TYPES_H 
+#define __NR_pwrite64 18
+#define SYS_name_to_handle_at __NR_name_to_handle_at
+#define FS_KEY_DESCRIPTOR_SIZE FSCRYPT_KEY_DESCRIPTOR_SIZE
+#define BLOCK_SIZE_BITS 10
+#define ALLPERMS (S_ISUID|S_ISGID|S_ISVTX|S_IRWXU|S_IRWXG|S_IRWXO)
+#define _CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS
+#define __NR_getpriority 140
+#define PRIu8 "u"
+#define __FLT64X_MIN_EXP__ (-16381)
+#define __NR_rt_sigaction 13
+#define SIZE_MAX (18446744073709551615UL)
+#define __SIZEOF_WINT_T__ 4
+#define PRIxLEAST8 "x"
+#define FSCRYPT_MODE_AES_256_XTS 1
+#define PRIiLEAST32 "i"
+#define _SC_BASE _SC_BASE
+#define EADDRNOTAVAIL 99
+#define __NR_mq_open 240
+#define SCNdFAST64 __PRI64_PREFIX "d"
+#define EPOLL_CLOEXEC EPOLL_CLOEXEC
+#define TIOCSPGRP 0x5410
+#define __NR_timer_delete 226
+#define __f32x(x) x ##f32x
+#define TCSETSW2 _IOW('T', 0x2C, struct termios2)
+#define UINT64_C(c) c ## UL
+#define FS_POLICY_FLAGS_PAD_8 FSCRYPT_POLICY_FLAGS_PAD_8
+#define __LONG_LONG_WIDTH__ 64
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+#define FS_CASEFOLD_FL 0x40000000
+#define _SC_ADVISORY_INFO _SC_ADVISORY_INFO
+#define MADV_DONTNEED 4
+#define __U16_TYPE unsigned short int
+#define TIOCPKT_NOSTOP 16
+#define SYS_times __NR_times
+#define SYS_connect __NR_connect
+#define SYS_pkey_mprotect __NR_pkey_mprotect
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+#define __FLT32_MAX_EXP__ 128
+#define WINT_MAX (4294967295u)
+#define TIOCM_RI TIOCM_RNG
+#define MOUNT_ATTR_NODIRATIME 0x00000080
+#define pthread_cleanup_push(routine,arg) do { __pthread_unwind_buf_t __cancel_buf; void (*__cancel_routine) (void *) = (routine); void *__cancel_arg = (arg); int __not_first_call = __sigsetjmp_cancel (__cancel_buf.__cancel_jmp_buf, 0); if (__glibc_unlikely (__not_first_call)) { __cancel_routine (__cancel_arg); __pthread_unwind_next (&__cancel_buf); } __pthread_register_cancel (&__cancel_buf); do {
+#define S_IWUSR __S_IWRITE
+#define PRIiFAST8 "i"
+#define UINTPTR_MAX (18446744073709551615UL)
+#define _IOC_SIZEMASK ((1 << _IOC_SIZEBITS)-1)
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+#define PRIx8 "x"
+#define __NR_mremap 25
+#define _UNISTD_H 1
+#define PRIiLEAST64 __PRI64_PREFIX "i"
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+#define __NR_shutdown 48
+#define _SC_PIPE _SC_PIPE
+#define IORING_CQE_F_MORE (1U << 1)
+#define __GXX_ABI_VERSION 1017
+#define __WTERMSIG(status) ((status) & 0x7f)
+#define __NR_epoll_create1 291
+#define __ASM_GENERIC_POSIX_TYPES_H 
+#define __NR_pidfd_open 434
+#define _SC_PAGESIZE _SC_PAGESIZE
+#define _SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION
+#define __isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))
+#define SYS_sendto __NR_sendto
+#define SIOCGARP 0x8954
+#define F_UNLCK 2
+#define ECHOE 0000020
+#define __FLT_MIN_EXP__ (-125)
+#define PROT_WRITE 0x2
+#define FS_ENCRYPTION_MODE_INVALID 0
+#define CIBAUD 002003600000
+#define MAP_FILE 0
+#define MAP_FIXED 0x10
+#define SYS_getcwd __NR_getcwd
+#define FSCRYPT_POLICY_FLAG_IV_INO_LBLK_32 0x10
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+#define _SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+#define WEXITED 4
+#define SYS_seccomp __NR_seccomp
+#define _SC_2_C_VERSION _SC_2_C_VERSION
+#define F_SHLCK 8
+#define INT64_MAX (__INT64_C(9223372036854775807))
+#define PTHREAD_RWLOCK_INITIALIZER { { __PTHREAD_RWLOCK_INITIALIZER (PTHREAD_RWLOCK_DEFAULT_NP) } }
+#define _IOC_WRITE 1U
+#define __CPU_EQUAL_S(setsize,cpusetp1,cpusetp2) (__builtin_memcmp (cpusetp1, cpusetp2, setsize) == 0)
+#define __NR_chroot 161
+#define _LINUX_FSCRYPT_H 
+#define ELIBEXEC 83
+#define OCRNL 0000010
+#define __S_IFREG 0100000
+#define ENAVAIL 119
+#define _SC_NL_ARGMAX _SC_NL_ARGMAX
+#define __NR_lgetxattr 192
+#define B134 0000004
+#define UINT32_MAX (4294967295U)
+#define __NR_msgget 68
+#define __uid_t_defined 
+#define _POSIX_SHELL 1
+#define WNOHANG 1
+#define alloca(size) __builtin_alloca (size)
+#define __INT16_MAX__ 0x7fff
+#define __NR_preadv 295
+#define _XOPEN_SHM 1
+#define RWF_HIPRI ((__kernel_rwf_t)0x00000001)
+#define _SC_2_PBS_LOCATE _SC_2_PBS_LOCATE
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+#define MS_NOSUID 2
+#define __x86_64 1
+#define SYS_utimensat __NR_utimensat
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+#define MOVE_MOUNT_F_SYMLINKS 0x00000001
+#define EKEYREJECTED 129
+#define SYNC_FILE_RANGE_WAIT_AFTER 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+#define ENOCSI 50
+#define _PC_SOCK_MAXBUF _PC_SOCK_MAXBUF
+#define _SC_WORD_BIT _SC_WORD_BIT
+#define _SC_ULONG_MAX _SC_ULONG_MAX
+#define EPOLLWAKEUP EPOLLWAKEUP
+#define _BSD_SIZE_T_ 
+#define MCL_FUTURE 2
+#define FASYNC O_ASYNC
+#define B150 0000005
+#define _SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE
+#define F_GETFD 1
+#define __NR_getresgid 120
+#define RWF_DSYNC ((__kernel_rwf_t)0x00000002)
+#define F_GETFL 3
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+#define __INT_FAST64_TYPE__ long int
+#define __NR_open_tree 428
+#define SYS_recvmmsg __NR_recvmmsg
+#define MAP_STACK 0x20000
+#define PTHREAD_INHERIT_SCHED PTHREAD_INHERIT_SCHED
+#define SYS_eventfd2 __NR_eventfd2
+#define FS_XFLAG_APPEND 0x00000010
+#define SYS_swapoff __NR_swapoff
+#define _SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX
+#define TIOCSSERIAL 0x541F
+#define BLKFRASET _IO(0x12,100)
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+#define __struct_FILE_defined 1
+#define ERESTART 85
+#define SCNuLEAST8 "hhu"
+#define __NR_fanotify_mark 301
+#define IOSQE_IO_LINK (1U << IOSQE_IO_LINK_BIT)
+#define O_RSYNC O_SYNC
+#define IOCSIZE_SHIFT (_IOC_SIZESHIFT)
+#define TABDLY 0014000
+#define IORING_FEAT_LINKED_FILE (1U << 12)
+#define __NR_pselect6 270
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+#define N_HDLC 13
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+#define EADDRINUSE 98
+#define WINT_MIN (0u)
+#define PRIx16 "x"
+#define __key_t_defined 
+#define SCNxFAST32 __PRIPTR_PREFIX "x"
+#define __NR_getsockname 51
+#define SYS_msync __NR_msync
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+#define SIOCGIFFLAGS 0x8913
+#define IORING_FEAT_CQE_SKIP (1U << 11)
+#define TTYDEF_CFLAG (CREAD | CS7 | PARENB | HUPCL)
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+#define _XOPEN_XPG2 1
+#define _XOPEN_XPG3 1
+#define _XOPEN_XPG4 1
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __SIZEOF_POINTER__ 8
+#define IMAXBEL 0020000
+#define _CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS
+#define CLOCK_REALTIME_COARSE 5
+#define SYS_set_mempolicy __NR_set_mempolicy
+#define __NR_eventfd 284
+#define SCNi64 __PRI64_PREFIX "i"
+#define __WCOREFLAG 0x80
+#define _XOPEN_LEGACY 1
+#define _CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS
+#define SYS_mlockall __NR_mlockall
+#define PRIx32 "x"
+#define FD_RING_SIZE 4096
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __O_DIRECTORY 0200000
+#define _SCHED_H 1
+#define __LP64__ 1
+#define UTIME_NOW ((1l << 30) - 1l)
+#define S_IRWXU (__S_IREAD|__S_IWRITE|__S_IEXEC)
+#define __DBL_HAS_QUIET_NAN__ 1
+#define BLKFRAGET _IO(0x12,101)
+#define __HAVE_FLOAT32X 1
+#define ENETRESET 102
+#define _POSIX_IPV6 200809L
+#define SYS_fstatfs __NR_fstatfs
+#define SYS_set_tid_address __NR_set_tid_address
+#define __time_t_defined 1
+#define SCNoMAX __PRI64_PREFIX "o"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+#define SYS_setfsgid __NR_setfsgid
+#define st_ctime st_ctim.tv_sec
+#define SYS_clock_gettime __NR_clock_gettime
+#define __O_DSYNC 010000
+#define IORING_SETUP_ATTACH_WQ (1U << 5)
+#define __MODE_T_TYPE __U32_TYPE
+#define CLOCK_REALTIME_ALARM 8
+#define F_SETLKW64 7
+#define EOF (-1)
+#define __NR_vserver 236
+#define EDOM 33
+#define __NR_sched_get_priority_max 146
+#define MOUNT_ATTR_NOATIME 0x00000010
+#define BRKINT 0000002
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+#define S_IFREG __S_IFREG
+#define __DECIMAL_BID_FORMAT__ 1
+#define __NR_getcpu 309
+#define __FLT64_MIN_EXP__ (-1021)
+#define FS_PROJINHERIT_FL 0x20000000
+#define __NR_sched_getaffinity 204
+#define ECHOCTL 0001000
+#define IGNPAR 0000004
+#define PRIx64 __PRI64_PREFIX "x"
+#define SYS_getsid __NR_getsid
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define O_DSYNC __O_DSYNC
+#define __NR_pipe2 293
+#define __NR_acct 163
+#define __NR_afs_syscall 183
+#define _CS_V6_ENV _CS_V6_ENV
+#define _INTTYPES_H 1
+#define IORING_ACCEPT_MULTISHOT (1U << 0)
+#define __NR_mbind 237
+#define SYS_lstat __NR_lstat
+#define MAP_SHARED_VALIDATE 0x03
+#define TIOCGLCKTRMIOS 0x5456
+#define INT_LEAST8_MAX (127)
+#define __NR_migrate_pages 256
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define SEEK_DATA 3
+#define _BITS_SETJMP_H 1
+#define FS_ENCRYPTION_MODE_AES_128_CTS FSCRYPT_MODE_AES_128_CTS
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+#define MAP_NORESERVE 0x04000
+#define __CFLOAT64X _Complex _Float64x
+#define __FLT64_MIN_10_EXP__ (-307)
+#define CS6 0000020
+#define SYS_rename __NR_rename
+#define __NR_fchdir 81
+#define B110 0000003
+#define __NR_chown 92
+#define __FDS_BITS(set) ((set)->__fds_bits)
+#define SYS_io_cancel __NR_io_cancel
+#define __NR_security 185
+#define IORING_ENTER_SQ_WAIT (1U << 2)
+#define SIOCSIFMETRIC 0x891e
+#define MADV_HWPOISON 100
+#define _IOR(type,nr,size) _IOC(_IOC_READ,(type),(nr),(_IOC_TYPECHECK(size)))
+#define IORING_SETUP_SUBMIT_ALL (1U << 7)
+#define __FLT16_MIN_10_EXP__ (-4)
+#define CS8 0000060
+#define _SC_BC_DIM_MAX _SC_BC_DIM_MAX
+#define _SC_FILE_LOCKING _SC_FILE_LOCKING
+#define __FLT64X_DECIMAL_DIG__ 21
+#define TIOCGRS485 0x542E
+#define __DEC128_MIN__ 1E-6143DL
+#define __NR_mlock 149
+#define __REGISTER_PREFIX__ 
+#define __UINT16_MAX__ 0xffff
+#define __DBL_HAS_DENORM__ 1
+#define __NR_sched_getparam 143
+#define INT_LEAST32_MAX (2147483647)
+#define F_WRLCK 1
+#define EIDRM 43
+#define VTDLY 0040000
+#define _SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX
+#define __NR_statfs 137
+#define SCNoFAST8 "hho"
+#define _PC_NAME_MAX _PC_NAME_MAX
+#define __NR_mmap 9
+#define _IOC(dir,type,nr,size) (((dir) << _IOC_DIRSHIFT) | ((type) << _IOC_TYPESHIFT) | ((nr) << _IOC_NRSHIFT) | ((size) << _IOC_SIZESHIFT))
+#define MADV_DONTDUMP 16
+#define SYS_getresuid __NR_getresuid
+#define _CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS
+#define VT1 0040000
+#define CDSUSP CTRL('y')
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+#define __LDBL_HAS_INFINITY__ 1
+#define SYS_landlock_restrict_self __NR_landlock_restrict_self
+#define IORING_TIMEOUT_CLOCK_MASK (IORING_TIMEOUT_BOOTTIME | IORING_TIMEOUT_REALTIME)
+#define TIOCGSERIAL 0x541E
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+#define SYS_setreuid __NR_setreuid
+#define __NR_preadv2 327
+#define ONOCR 0000020
+#define __NR_utimes 235
+#define SYS_unlink __NR_unlink
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+#define __UINT8_TYPE__ unsigned char
+#define SYS_fsetxattr __NR_fsetxattr
+#define TIOCM_RNG 0x080
+#define _SC_BC_BASE_MAX _SC_BC_BASE_MAX
+#define _SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC
+#define __NR_getcwd 79
+#define __FLT_DIG__ 6
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __NO_INLINE__ 1
+#define SYS_sched_get_priority_min __NR_sched_get_priority_min
+#define SYS_io_pgetevents __NR_io_pgetevents
+#define ARG_MAX 131072
+#define __NR_sched_get_priority_min 147
+#define O_EXCL 0200
+#define SYS_io_uring_enter __NR_io_uring_enter
+#define SYS_mkdirat __NR_mkdirat
+#define SYS_io_submit __NR_io_submit
+#define _SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC
+#define IORING_TIMEOUT_UPDATE (1U << 1)
+#define FIBMAP _IO(0x00,1)
+#define __DEC_EVAL_METHOD__ 2
+#define _CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+#define _SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS
+#define ECONNABORTED 103
+#define FSCRYPT_KEY_DESC_PREFIX_SIZE 8
+#define __NR_rt_sigprocmask 14
+#define _SYSCALL_H 1
+#define SCNiMAX __PRI64_PREFIX "i"
+#define SIOCSIFMTU 0x8922
+#define MAX_CANON 255
+#define TCSETXW 0x5435
+#define __FLT_MANT_DIG__ 24
+#define __LDBL_DECIMAL_DIG__ 21
+#define TIOCMSET 0x5418
+#define IORING_ASYNC_CANCEL_FD (1U << 1)
+#define INT_LEAST8_MIN (-128)
+#define BLKDISCARD _IO(0x12,119)
+#define SYS_brk __NR_brk
+#define _IOW(type,nr,size) _IOC(_IOC_WRITE,(type),(nr),(_IOC_TYPECHECK(size)))
+#define SYS_sched_getattr __NR_sched_getattr
+#define __VERSION__ "12.2.0"
+#define SCNoLEAST8 "hho"
+#define _SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX
+#define CTRL(x) (x&037)
+#define __IOV_MAX 1024
+#define S_ISFIFO(mode) __S_ISTYPE((mode), __S_IFIFO)
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+#define UINT_LEAST16_MAX (65535)
+#define __NR_fspick 433
+#define __UINT64_C(c) c ## UL
+#define _SYS_TYPES_H 1
+#define PRIXLEAST16 "X"
+#define FS_SECRM_FL 0x00000001
+#define _SYS_CDEFS_H 1
+#define FD_MAX 16
+#define __struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS
+#define __NR_getuid 102
+#define RENAME_WHITEOUT (1 << 2)
+#define MOVE_MOUNT__MASK 0x00000177
+#define SYS_getpriority __NR_getpriority
+#define SCNi16 "hi"
+#define IXOFF 0010000
+#define B115200 0010002
+#define __NR_bind 49
+#define _POSIX_VERSION 200809L
+#define _STDC_PREDEF_H 1
+#define SYS_membarrier __NR_membarrier
+#define SYNC_FILE_RANGE_WAIT_BEFORE 1
+#define INT_LEAST32_MIN (-2147483647-1)
+#define PRIXLEAST32 "X"
+#define MS_VERBOSE 32768
+#define __NR_sched_yield 24
+#define IORING_SETUP_SQ_AFF (1U << 2)
+#define SYS_fchownat __NR_fchownat
+#define SYS_getsockopt __NR_getsockopt
+#define __USE_XOPEN2K8 1
+#define _SC_NL_MSGMAX _SC_NL_MSGMAX
+#define htobe64(x) __bswap_64 (x)
+#define SIOCSIFMEM 0x8920
+#define _SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX
+#define _PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE
+#define __NR_access 21
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define __bitwise 
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define FS_IOC32_GETVERSION _IOR('v', 1, int)
+#define ENETDOWN 100
+#define _CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS
+#define __NR_recvmsg 47
+#define st_mtime st_mtim.tv_sec
+#define O_RDWR 02
+#define __INT_LEAST32_MAX__ 0x7fffffff
+#define SYS_pipe2 __NR_pipe2
+#define SIOCGIFMAP 0x8970
+#define __NR_sysfs 139
+#define FSCRYPT_MODE_AES_256_HCTR2 10
+#define __STRING(x) #x
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+#define SYS_uselib __NR_uselib
+#define __F_GETOWN 9
+#define BLKROSET _IO(0x12,93)
+#define BLKRASET _IO(0x12,98)
+#define SYS_sched_yield __NR_sched_yield
+#define SYS_fadvise64 __NR_fadvise64
+#define _SC_NL_LANGMAX _SC_NL_LANGMAX
+#define __FLT128_MAX_EXP__ 16384
+#define SYS_tee __NR_tee
+#define PRIXLEAST64 __PRI64_PREFIX "X"
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define be16toh(x) __bswap_16 (x)
+#define __EPOLL_PACKED __attribute__ ((__packed__))
+#define SYS_setresgid __NR_setresgid
+#define FLUSHO 0010000
+#define IOSQE_CQE_SKIP_SUCCESS (1U << IOSQE_CQE_SKIP_SUCCESS_BIT)
+#define EINPROGRESS 115
+#define __NR_setuid 105
+#define N_SMSBLOCK 12
+#define BLOCK_SIZE (1<<BLOCK_SIZE_BITS)
+#define SYS_pidfd_open __NR_pidfd_open
+#define __F_SETOWN_EX 15
+#define EPOLLRDNORM EPOLLRDNORM
+#define F_ULOCK 0
+#define __NR_getgid 104
+#define SYS_renameat2 __NR_renameat2
+#define MS_SYNCHRONOUS 16
+#define __struct_tm_defined 1
+#define _SC_TRACE _SC_TRACE
+#define _SC_2_PBS_TRACK _SC_2_PBS_TRACK
+#define __ssize_t_defined 
+#define EBADFD 77
+#define _SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE
+#define SYS_mlock __NR_mlock
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+#define N_TTY 0
+#define _SC_FSYNC _SC_FSYNC
+#define SYS_umask __NR_umask
+#define __FLT32_MANT_DIG__ 24
+#define SYS_epoll_ctl __NR_epoll_ctl
+#define _SYS_SIZE_T_H 
+#define TCSETSF 0x5404
+#define TIOCPKT_START 8
+#define __NR_getpmsg 181
+#define __NR_llistxattr 195
+#define URING_CANCEL 2
+#define FS_BTREE_FL 0x00001000
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define SIOCGIFBRDADDR 0x8919
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+#define SYS_perf_event_open __NR_perf_event_open
+#define _CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS
+#define BLKGETSIZE _IO(0x12,96)
+#define __NR_seccomp 317
+#define _POSIX_THREAD_PROCESS_SHARED 200809L
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define _SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING
+#define SCNoPTR __PRIPTR_PREFIX "o"
+#define IORING_SETUP_CQE32 (1U << 11)
+#define __S_IFDIR 0040000
+#define __SIZE_T__ 
+#define SIOCADDMULTI 0x8931
+#define _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS
+#define __FLT32X_MIN_EXP__ (-1021)
+#define SYS_acct __NR_acct
+#define SYS_sysinfo __NR_sysinfo
+#define __stub_gtty 
+#define _CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS
+#define _SC_2_LOCALEDEF _SC_2_LOCALEDEF
+#define __NR_accept4 288
+#define MAP_HUGE_SHIFT 26
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define SIG_ATOMIC_MAX (2147483647)
+#define MS_PRIVATE (1<<18)
+#define __NR_fchown 93
+#define PTHREAD_SCOPE_PROCESS PTHREAD_SCOPE_PROCESS
+#define __NR_stat 4
+#define O_DIRECTORY __O_DIRECTORY
+#define IOCSIZE_MASK (_IOC_SIZEMASK << _IOC_SIZESHIFT)
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+#define FSCRYPT_POLICY_FLAGS_PAD_8 0x01
+#define _SC_MEMLOCK _SC_MEMLOCK
+#define __NR_vmsplice 278
+#define _SC_SHRT_MAX _SC_SHRT_MAX
+#define SYS_sched_setparam __NR_sched_setparam
+#define _SC_PII_OSI _SC_PII_OSI
+#define SYS_lgetxattr __NR_lgetxattr
+#define ISIG 0000001
+#define _BITS_UIO_LIM_H 1
+#define _SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX
+#define SYS_inotify_add_watch __NR_inotify_add_watch
+#define INT32_MAX (2147483647)
+#define _SC_DEVICE_IO _SC_DEVICE_IO
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+#define _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS
+#define FFSYNC O_FSYNC
+#define __NR_sched_setattr 314
+#define B2400 0000013
+#define _CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS
+#define CBAUDEX 000000010000
+#define _SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE
+#define FSCRYPT_KEY_IDENTIFIER_SIZE 16
+#define B1000000 0010010
+#define __NR_splice 275
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __wur 
+#define __S_IFMT 0170000
+#define _SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT
+#define IORING_ASYNC_CANCEL_ANY (1U << 2)
+#define _PC_ASYNC_IO _PC_ASYNC_IO
+#define _STRING_H 1
+#define SIOCGIFSLAVE 0x8929
+#define B1800 0000012
+#define __NR_process_madvise 440
+#define SIOCDEVPRIVATE 0x89F0
+#define __FLT128_HAS_DENORM__ 1
+#define IXANY 0004000
+#define F_SETFL 4
+#define N_SYNC_PPP 14
+#define SYS_mmap __NR_mmap
+#define OLCUC 0000002
+#define _SC_SSIZE_MAX _SC_SSIZE_MAX
+#define __FLT32_DECIMAL_DIG__ 9
+#define IORING_ENTER_GETEVENTS (1U << 0)
+#define BLKPBSZGET _IO(0x12,123)
+#define SIOCGIFENCAP 0x8925
+#define __FLT128_DIG__ 33
+#define SIOCSIFENCAP 0x8926
+#define SYS_modify_ldt __NR_modify_ldt
+#define __INT32_C(c) c
+#define SCNiLEAST8 "hhi"
+#define __DEC64_EPSILON__ 1E-15DD
+#define SYS_ioprio_set __NR_ioprio_set
+#define __ORDER_PDP_ENDIAN__ 3412
+#define __DEC128_MIN_EXP__ (-6142)
+#define __PDP_ENDIAN 3412
+#define _POSIX_MEMLOCK 200809L
+#define __NR_futimesat 261
+#define FFDLY 0100000
+#define SYS_utimes __NR_utimes
+#define PARMRK 0000010
+#define EL2HLT 51
+#define SYS_restart_syscall __NR_restart_syscall
+#define INR_OPEN_MAX 4096
+#define TIOCM_CAR 0x040
+#define _SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG
+#define be64toh(x) __bswap_64 (x)
+#define SYS_ptrace __NR_ptrace
+#define BYTE_ORDER __BYTE_ORDER
+#define _SC_MESSAGE_PASSING _SC_MESSAGE_PASSING
+#define FS_APPEND_FL 0x00000020
+#define _IOC_TYPEBITS 8
+#define FS_POLICY_FLAG_DIRECT_KEY FSCRYPT_POLICY_FLAG_DIRECT_KEY
+#define SYS_shmctl __NR_shmctl
+#define __INT_FAST32_TYPE__ long int
+#define __have_pthread_attr_t 1
+#define URING_RX 0
+#define CBRK CEOL
+#define _SYS_TTYDEFAULTS_H_ 
+#define _POSIX_CPUTIME 0
+#define __FIRMWARE_ARCH_BOGUS__ 1
+#define SCNi8 "hhi"
+#define _BITS_TYPESIZES_H 1
+#define __NR_fcntl 72
+#define _SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT
+#define IORING_MSG_RING_CQE_SKIP (1U << 0)
+#define IORING_SQ_TASKRUN (1U << 2)
+#define _SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS
+#define __NR_readlinkat 267
+#define SYS_signalfd __NR_signalfd
+#define _SC_MULTI_PROCESS _SC_MULTI_PROCESS
+#define htole32(x) __uint32_identity (x)
+#define _CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS
+#define SYS_sched_get_priority_max __NR_sched_get_priority_max
+#define MADV_DONTFORK 10
+#define O_RDONLY 00
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define EINVAL 22
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define __UINT_LEAST16_TYPE__ short unsigned int
+#define F_OK 0
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+#define B50 0000001
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+#define RAND_MAX 2147483647
+#define SPLICE_F_FD_IN_FIXED (1U << 31)
+#define SYS_getgroups __NR_getgroups
+#define unix 1
+#define __NR_rmdir 84
+#define __NR_getdents64 217
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+#define SYS_sigaltstack __NR_sigaltstack
+#define SCNdFAST32 __PRIPTR_PREFIX "d"
+#define SYS_nfsservctl __NR_nfsservctl
+#define _PC_LINK_MAX _PC_LINK_MAX
+#define _IOC_DIRBITS 2
+#define SYS_rmdir __NR_rmdir
+#define __NR_geteuid 107
+#define BLKROTATIONAL _IO(0x12,126)
+#define ESHUTDOWN 108
+#define F_GETOWN __F_GETOWN
+#define MS_NOUSER (1<<31)
+#define __NR_alarm 37
+#define SYS_getdents64 __NR_getdents64
+#define F_SETLK F_SETLK64
+#define _SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX
+#define _SC_2_FORT_RUN _SC_2_FORT_RUN
+#define __NR_futex 202
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __SIZE_TYPE__ long unsigned int
+#define SYS_io_destroy __NR_io_destroy
+#define SYS_move_mount __NR_move_mount
+#define __S_TYPEISSEM(buf) ((buf)->st_mode - (buf)->st_mode)
+#define __NR_arch_prctl 158
+#define SYS_pwritev __NR_pwritev
+#define SYS_unshare __NR_unshare
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+#define __ULONGWORD_TYPE unsigned long int
+#define _SIZE_T_DECLARED 
+#define __FLT_IS_IEC_60559__ 2
+#define _POSIX_THREADS 200809L
+#define SYS_bind __NR_bind
+#define SYS_getxattr __NR_getxattr
+#define __NR_tee 276
+#define _SC_UCHAR_MAX _SC_UCHAR_MAX
+#define F_SETOWN __F_SETOWN
+#define XATTR_LIST_MAX 65536
+#define __O_TMPFILE (020000000 | __O_DIRECTORY)
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+#define MOVE_MOUNT_F_EMPTY_PATH 0x00000004
+#define __FLT64X_DIG__ 18
+#define _SC_SINGLE_PROCESS _SC_SINGLE_PROCESS
+#define MS_UNBINDABLE (1<<17)
+#define _SC_USER_GROUPS _SC_USER_GROUPS
+#define MADV_POPULATE_READ 22
+#define FIONREAD 0x541B
+#define __INT8_TYPE__ signed char
+#define TIOCGPKT _IOR('T', 0x38, int)
+#define _CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS
+#define SIOCDIFADDR 0x8936
+#define F_SETLK64 6
+#define SYS_dup3 __NR_dup3
+#define MS_BORN (1<<29)
+#define __NR_umount2 166
+#define SYS_pipe __NR_pipe
+#define IORING_FILE_INDEX_ALLOC (~0U)
+#define SYS_timer_create __NR_timer_create
+#define NLDLY 0000400
+#define __HAVE_DISTINCT_FLOAT128 1
+#define __ELF__ 1
+#define FSCRYPT_POLICY_FLAG_IV_INO_LBLK_64 0x08
+#define CLOCK_THREAD_CPUTIME_ID 3
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+#define FS_IOC_FSSETXATTR _IOW('X', 32, struct fsxattr)
+#define __S_TYPEISSHM(buf) ((buf)->st_mode - (buf)->st_mode)
+#define S_ISGID __S_ISGID
+#define _SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG
+#define _CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS
+#define UIO_MAXIOV __IOV_MAX
+#define __F_GETOWN_EX 16
+#define __UINT32_TYPE__ unsigned int
+#define __ILP32_OFFBIG_LDFLAGS "-m32"
+#define SYS_settimeofday __NR_settimeofday
+#define __NR_mknodat 259
+#define PRIxMAX __PRI64_PREFIX "x"
+#define SYS_vfork __NR_vfork
+#define _BITS_BYTESWAP_H 1
+#define __NR_fork 57
+#define __ID_T_TYPE __U32_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define NL0 0000000
+#define CSIZE 0000060
+#define _SC_PRIORITIZED_IO _SC_PRIORITIZED_IO
+#define NL1 0000400
+#define ELIBSCN 81
+#define F_TLOCK 2
+#define _IOC_NRMASK ((1 << _IOC_NRBITS)-1)
+#define SYS_fstat __NR_fstat
+#define TIOCGPTLCK _IOR('T', 0x39, int)
+#define FSCRYPT_KEY_STATUS_FLAG_ADDED_BY_SELF 0x00000001
+#define TIOCSERGETLSR 0x5459
+#define _CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define SYS_shmget __NR_shmget
+#define __NR_creat 85
+#define FS_IOC32_SETVERSION _IOW('v', 2, int)
+#define SIOCADDRT 0x890B
+#define __FLT_RADIX__ 2
+#define TIOCSER_TEMT 0x01
+#define PRIdLEAST8 "d"
+#define __INT_LEAST16_TYPE__ short int
+#define __kernel_old_dev_t __kernel_old_dev_t
+#define B38400 0000017
+#define IORING_FEAT_CUR_PERSONALITY (1U << 4)
+#define IORING_RECVSEND_POLL_FIRST (1U << 0)
+#define __NR_inotify_rm_watch 255
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+#define MS_REC 16384
+#define INTPTR_MAX (9223372036854775807L)
+#define __UINTMAX_C(c) c ## UL
+#define O_SYNC 04010000
+#define CERASE 0177
+#define FICLONE _IOW(0x94, 9, int)
+#define SYS_fchmod __NR_fchmod
+#define _SC_RE_DUP_MAX _SC_RE_DUP_MAX
+#define _ASM_X86_UNISTD_H 
+#define _POSIX_C_SOURCE 200809L
+#define SCNdPTR __PRIPTR_PREFIX "d"
+#define __NR_process_vm_writev 311
+#define __NR_copy_file_range 326
+#define MOUNT_ATTR_NOSYMFOLLOW 0x00200000
+#define PTHREAD_STACK_MIN 16384
+#define _IOWR(type,nr,size) _IOC(_IOC_READ|_IOC_WRITE,(type),(nr),(_IOC_TYPECHECK(size)))
+#define __SSE_MATH__ 1
+#define _ALLOCA_H 1
+#define _SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC
+#define __NR_sched_rr_get_interval 148
+#define MADV_DOFORK 11
+#define MADV_WILLNEED 3
+#define __NR_fremovexattr 199
+#define __NR_openat2 437
+#define __k8 1
+#define FILE_DEDUPE_RANGE_SAME 0
+#define SIOCSIFBR 0x8941
+#define SYS_pause __NR_pause
+#define IO_URING_OP_SUPPORTED (1U << 0)
+#define SYS_socket __NR_socket
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+#define _SC_XOPEN_XPG3 _SC_XOPEN_XPG3
+#define _SC_XOPEN_XPG4 _SC_XOPEN_XPG4
+#define EPOLLRDHUP EPOLLRDHUP
+#define __LDBL_REDIR(name,proto) name proto
+#define SYS_kexec_file_load __NR_kexec_file_load
+#define CLOCK_MONOTONIC_RAW 4
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+#define URING_TICK 0xFFFFFFFEULL
+#define _SC_FD_MGMT _SC_FD_MGMT
+#define F_TEST 3
+#define MOUNT_ATTR_IDMAP 0x00100000
+#define SCNxLEAST32 "x"
+#define FS_XFLAG_DAX 0x00008000
+#define O_CLOEXEC __O_CLOEXEC
+#define MADV_FREE 8
+#define SYS_faccessat __NR_faccessat
+#define __f32(x) x ##f32
+#define PRIu16 "u"
+#define __NR_set_mempolicy 238
+#define ENOSTR 60
+#define __blksize_t_defined 
+#define SIOCSIFBRDADDR 0x891a
+#define IORING_RECV_MULTISHOT (1U << 1)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+#define OFDEL 0000200
+#define MS_MGC_MSK 0xffff0000
+#define IOC_OUT (_IOC_READ << _IOC_DIRSHIFT)
+#define _POSIX_TIMEOUTS 200809L
+#define SYS_syncfs __NR_syncfs
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+#define __USER_LABEL_PREFIX__ 
+#define _LFS64_LARGEFILE 1
+#define EOVERFLOW 75
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+#define __STDC_IEC_60559_BFP__ 201404L
+#define S_IRUSR __S_IREAD
+#define _CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS
+#define SYS_setsid __NR_setsid
+#define __WCHAR_MAX __WCHAR_MAX__
+#define _SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT
+#define SYS_exit_group __NR_exit_group
+#define TIOCGPTN _IOR('T', 0x30, unsigned int)
+#define __SIZEOF_PTRDIFF_T__ 8
+#define _LFS64_ASYNCHRONOUS_IO 1
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define SEEK_SET 0
+#define __NR_clock_gettime 228
+#define PRIu32 "u"
+#define _CS_V7_ENV _CS_V7_ENV
+#define RWF_APPEND ((__kernel_rwf_t)0x00000010)
+#define __NR_setrlimit 160
+#define __NR_getsockopt 55
+#define __NR_getppid 110
+#define SYS_pread64 __NR_pread64
+#define _LFS64_STDIO 1
+#define SCNu64 __PRI64_PREFIX "u"
+#define __NR_modify_ldt 154
+#define TCGETS2 _IOR('T', 0x2A, struct termios2)
+#define EPROTO 71
+#define __iovec_defined 1
+#define ENOTCONN 107
+#define URING_TX 1
+#define SCNxLEAST64 __PRI64_PREFIX "x"
+#define __f64(x) x ##f64
+#define FS_IOC_SETFSLABEL _IOW(0x94, 50, char[FSLABEL_MAX])
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+#define __NR_epoll_pwait2 441
+#define __NR_readlink 89
+#define _BITS_STRUCT_STAT_H 1
+#define SYS_alarm __NR_alarm
+#define __stub_sigreturn 
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+#define SYS_tgkill __NR_tgkill
+#define SYS_sendmmsg __NR_sendmmsg
+#define FS_IOC_GET_ENCRYPTION_POLICY_EX _IOWR('f', 22, __u8[9])
+#define SYS_memfd_secret __NR_memfd_secret
+#define CSTART CTRL('q')
+#define __NR_pause 34
+#define SYS_bpf __NR_bpf
+#define SYS_capget __NR_capget
+#define SCNx64 __PRI64_PREFIX "x"
+#define CLOCK_TAI 11
+#define SYS_quotactl_fd __NR_quotactl_fd
+#define __NR_getpgid 121
+#define __restrict_arr __restrict
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define SYS_listxattr __NR_listxattr
+#define SYS_semop __NR_semop
+#define __CFLOAT32X _Complex _Float32x
+#define INT8_C(c) c
+#define SYS_rt_sigprocmask __NR_rt_sigprocmask
+#define ESTRPIPE 86
+#define ENOMEDIUM 123
+#define _SC_SIGSTKSZ _SC_SIGSTKSZ
+#define __NR_linkat 265
+#define FS_XFLAG_SYNC 0x00000020
+#define _SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX
+#define PRIu64 __PRI64_PREFIX "u"
+#define S_IFDIR __S_IFDIR
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+#define __USE_MISC 1
+#define EFD_SEMAPHORE EFD_SEMAPHORE
+#define IORING_ENTER_SQ_WAKEUP (1U << 1)
+#define __UWORD_TYPE unsigned long int
+#define __LDBL_DIG__ 18
+#define IORING_ENTER_EXT_ARG (1U << 3)
+#define __S_IEXEC 0100
+#define _SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG
+#define TIOCSTI 0x5412
+#define W_OK 2
+#define PROT_READ 0x1
+#define _POSIX_ASYNCHRONOUS_IO 200809L
+#define __FLT64_IS_IEC_60559__ 2
+#define __x86_64__ 1
+#define _SIZE_T_ 
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+#define CBAUD 000000010017
+#define __FLT16_IS_IEC_60559__ 2
+#define MAP_POPULATE 0x08000
+#define __FLT16_MAX_EXP__ 16
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+#define SYS_mq_open __NR_mq_open
+#define UINT_FAST32_MAX (18446744073709551615UL)
+#define O_CREAT 0100
+#define __S_IWRITE 0200
+#define _WCHAR_T_H 
+#define _SC_SAVED_IDS _SC_SAVED_IDS
+#define SYS_setrlimit __NR_setrlimit
+#define __NR_rseq 334
+#define ENODEV 19
+#define SIOCGIFMEM 0x891f
+#define PRIxLEAST16 "x"
+#define __NR_keyctl 250
+#define ENOTDIR 20
+#define SIOCPROTOPRIVATE 0x89E0
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+#define __stub_revoke 
+#define __timer_t_defined 1
+#define __WCLONE 0x80000000
+#define EFD_NONBLOCK EFD_NONBLOCK
+#define SYS_read __NR_read
+#define SYS_execveat __NR_execveat
+#define EBFONT 59
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS
+#define _CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS
+#define TIOCSERCONFIG 0x5453
+#define BMAP_IOCTL 1
+#define RWF_SYNC ((__kernel_rwf_t)0x00000004)
+#define _POSIX_MONOTONIC_CLOCK 0
+#define __GCC_CONSTRUCTIVE_SIZE 64
+#define IORING_SETUP_CLAMP (1U << 4)
+#define EPOLLOUT EPOLLOUT
+#define __NR_pkey_alloc 330
+#define SYS_io_uring_register __NR_io_uring_register
+#define PRIxLEAST32 "x"
+#define _SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING
+#define __WCHAR_MIN __WCHAR_MIN__
+#define __FLT64_DIG__ 15
+#define S_ISVTX __S_ISVTX
+#define _SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64
+#define EROFS 30
+#define SYS_userfaultfd __NR_userfaultfd
+#define __NR_fchmodat 268
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+#define __CPU_ALLOC_SIZE(count) ((((count) + __NCPUBITS - 1) / __NCPUBITS) * sizeof (__cpu_mask))
+#define __UINT_LEAST64_TYPE__ long unsigned int
+#define __NR_symlink 88
+#define _SC_SEMAPHORES _SC_SEMAPHORES
+#define NULL ((void *)0)
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+#define __NR_iopl 172
+#define SIOCSIFSLAVE 0x8930
+#define __U64_TYPE unsigned long int
+#define SYS_afs_syscall __NR_afs_syscall
+#define __FLT_HAS_QUIET_NAN__ 1
+#define __NR_io_pgetevents 333
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+#define _SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR
+#define _SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM
+#define INT32_C(c) c
+#define _POSIX_TRACE_INHERIT -1
+#define __FLT_MAX_10_EXP__ 38
+#define ONLCR 0000004
+#define _____fpos64_t_defined 1
+#define IORING_FEAT_SQPOLL_NONFIXED (1U << 7)
+#define TIOCGDEV _IOR('T', 0x32, unsigned int)
+#define __NR_getrusage 98
+#define SYS_dup2 __NR_dup2
+#define POSIX_FADV_NOREUSE __POSIX_FADV_NOREUSE
+#define IORING_REGISTER_FILES_SKIP (-2)
+#define _PTY_H 1
+#define __NR_sched_setaffinity 203
+#define _SC_HOST_NAME_MAX _SC_HOST_NAME_MAX
+#define F_DUPFD_CLOEXEC 1030
+#define __glibc_c99_flexarr_available 1
+#define __LONG_MAX__ 0x7fffffffffffffffL
+#define PROT_GROWSUP 0x02000000
+#define _SC_ATEXIT_MAX _SC_ATEXIT_MAX
+#define __WCHAR_T__ 
+#define __FLT64X_HAS_DENORM__ 1
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+#define _PC_SYNC_IO _PC_SYNC_IO
+#define ELIBACC 79
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define _CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS
+#define _SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX
+#define __FLT_HAS_INFINITY__ 1
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+#define IORING_FEAT_SUBMIT_STABLE (1U << 2)
+#define PRIxLEAST64 __PRI64_PREFIX "x"
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+#define TCSETS 0x5402
+#define TCSETX 0x5433
+#define __NR_exit 60
+#define VREPRINT 12
+#define PRIxFAST16 __PRIPTR_PREFIX "x"
+#define __NR_sched_getattr 315
+#define L_INCR SEEK_CUR
+#define IORING_SEND_ZC_REPORT_USAGE (1U << 3)
+#define __NR_setpgid 109
+#define _BITS_PTHREADTYPES_COMMON_H 1
+#define PRIXPTR __PRIPTR_PREFIX "X"
+#define __NR_sched_setscheduler 144
+#define SYS_fork __NR_fork
+#define IORING_URING_CMD_FIXED (1U << 0)
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+#define __UINT_FAST16_TYPE__ long unsigned int
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+#define __DEC64_MAX__ 9.999999999999999E384DD
+#define SYS_ioctl __NR_ioctl
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+#define __INT_FAST32_WIDTH__ 64
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+#define _POSIX_RAW_SOCKETS 200809L
+#define SYS_setregid __NR_setregid
+#define __NR_lseek 8
+#define __CHAR16_TYPE__ short unsigned int
+#define __PRAGMA_REDEFINE_EXTNAME 1
+#define SCNuPTR __PRIPTR_PREFIX "u"
+#define EFBIG 27
+#define BIG_ENDIAN __BIG_ENDIAN
+#define S_TYPEISMQ(buf) __S_TYPEISMQ(buf)
+#define TCSETAW 0x5407
+#define IORING_SQ_NEED_WAKEUP (1U << 0)
+#define MADV_UNMERGEABLE 13
+#define _BITS_ERRNO_H 1
+#define __NR_symlinkat 266
+#define _STRINGS_H 1
+#define PRIX32 "X"
+#define __SIZE_WIDTH__ 64
+#define SYS_getpeername __NR_getpeername
+#define __DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }
+#define ECHOPRT 0002000
+#define FS_XFLAG_NODEFRAG 0x00002000
+#define __SEG_FS 1
+#define __INT_LEAST16_MAX__ 0x7fff
+#define CKILL CTRL('u')
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define SYS_process_madvise __NR_process_madvise
+#define __LP64_OFF64_LDFLAGS "-m64"
+#define __DEC64_MANT_DIG__ 16
+#define B200 0000006
+#define __INT64_MAX__ 0x7fffffffffffffffL
+#define _BITS_ENDIAN_H 1
+#define _SC_SS_REPL_MAX _SC_SS_REPL_MAX
+#define _PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+#define MS_I_VERSION (1<<23)
+#define EXTB B38400
+#define __NR_setgid 106
+#define __SIG_ATOMIC_WIDTH__ 32
+#define SYS_tuxcall __NR_tuxcall
+#define SYS_get_kernel_syms __NR_get_kernel_syms
+#define _SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX
+#define PRIxFAST64 __PRI64_PREFIX "x"
+#define _SC_TRACE_LOG _SC_TRACE_LOG
+#define __INT_LEAST64_TYPE__ long int
+#define htole16(x) __uint16_identity (x)
+#define B57600 0010001
+#define MS_SUBMOUNT (1<<26)
+#define __INT16_TYPE__ short int
+#define __INT_LEAST8_TYPE__ signed char
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+#define PRIX64 __PRI64_PREFIX "X"
+#define BLKBSZGET _IOR(0x12,112,size_t)
+#define IGNBRK 0000001
+#define IOSQE_BUFFER_SELECT (1U << IOSQE_BUFFER_SELECT_BIT)
+#define __STDC_VERSION__ 201710L
+#define SYS_futex_waitv __NR_futex_waitv
+#define __CPU_OP_S(setsize,destset,srcset1,srcset2,op) (__extension__ ({ cpu_set_t *__dest = (destset); const __cpu_mask *__arr1 = (srcset1)->__bits; const __cpu_mask *__arr2 = (srcset2)->__bits; size_t __imax = (setsize) / sizeof (__cpu_mask); size_t __i; for (__i = 0; __i < __imax; ++__i) ((__cpu_mask *) __dest->__bits)[__i] = __arr1[__i] op __arr2[__i]; __dest; }))
+#define __SIZEOF_INT__ 4
+#define BSDLY 0020000
+#define __NR_ioctl 16
+#define FD_BACKEND_EPOLL 0
+#define SYS_ioperm __NR_ioperm
+#define __DEC32_MAX_EXP__ 97
+#define FS_IOC_GET_ENCRYPTION_NONCE _IOR('f', 27, __u8[16])
+#define SEEK_HOLE 4
+#define __NR_getpid 39
+#define SYS_madvise __NR_madvise
+#define TIOCSERSWILD 0x5455
+#define FS_IOC_FIEMAP _IOWR('f', 11, struct fiemap)
+#define TIMER_ABSTIME 1
+#define _SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE
+#define __INT_FAST8_MAX__ 0x7f
+#define EDQUOT 122
+#define UINTMAX_C(c) c ## UL
+#define __PMT(args) args
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+#define ECONNRESET 104
+#define WTERMSIG(status) __WTERMSIG (status)
+#define FF1 0100000
+#define NR_FILE 8192
+#define _SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE
+#define SYS_recvmsg __NR_recvmsg
+#define _LINUX_FS_H 
+#define _LINUX_LIMITS_H 
+#define linux 1
+#define _SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX
+#define _SC_2_VERSION _SC_2_VERSION
+#define __S_ISTYPE(mode,mask) (((mode) & __S_IFMT) == (mask))
+#define __NR_utimensat 280
+#define ENXIO 6
+#define __NR_move_pages 279
+#define _SC_THREAD_CPUTIME _SC_THREAD_CPUTIME
+#define MAP_FIXED_NOREPLACE 0x100000
+#define CLOCK_MONOTONIC 1
+#define MS_NOREMOTELOCK (1<<27)
+#define SCNdMAX __PRI64_PREFIX "d"
+#define SYS_getppid __NR_getppid
+#define __FLT64_HAS_QUIET_NAN__ 1
+#define __NR_sendmsg 46
+#define ____FILE_defined 1
+#define __CPU_SET_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] |= __CPUMASK (__cpu)) : 0; }))
+#define _IOLBF 1
+#define __HAVE_FLOAT16 0
+#define htole64(x) __uint64_identity (x)
+#define _POSIX_THREAD_ROBUST_PRIO_PROTECT -1
+#define TIOCSPTLCK _IOW('T', 0x31, int)
+#define F_GETLK64 5
+#define MADV_DONTNEED_LOCKED 24
+#define EBADRQC 56
+#define _POSIX_SAVED_IDS 1
+#define TIOCPKT_FLUSHREAD 1
+#define F_SETLKW F_SETLKW64
+#define SIOCGIFDSTADDR 0x8917
+#define __USE_POSIX2 1
+#define __NR_kill 62
+#define __bool_true_false_are_defined 1
+#define L_XTND SEEK_END
+#define SCNuFAST32 __PRIPTR_PREFIX "u"
+#define ETIME 62
+#define SYS_getrlimit __NR_getrlimit
+#define _SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE
+#define __FLT32_MIN_10_EXP__ (-37)
+#define SYS_pivot_root __NR_pivot_root
+#define SYS_msgrcv __NR_msgrcv
+#define __KEY_T_TYPE __S32_TYPE
+#define __NR_umask 95
+#define FAPPEND O_APPEND
+#define TIOCPKT_STOP 4
+#define __F_SETSIG 10
+#define __FLT32X_DIG__ 15
+#define _CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION
+#define _CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS
+#define __NR_ppoll 271
+#define SCNuFAST16 __PRIPTR_PREFIX "u"
+#define SYS_iopl __NR_iopl
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+#define __WORDSIZE 64
+#define SYS_waitid __NR_waitid
+#define __NR_mq_timedreceive 243
+#define TIOCVHANGUP 0x5437
+#define FS_IOC_GETVERSION _IOR('v', 1, long)
+#define TIOCSSOFTCAR 0x541A
+#define __PTRDIFF_WIDTH__ 64
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+#define __BEGIN_DECLS 
+#define _SC_PII_XTI _SC_PII_XTI
+#define __LDBL_MANT_DIG__ 64
+#define FS_XFLAG_NOATIME 0x00000040
+#define _PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE
+#define _GETOPT_POSIX_H 1
+#define ENAMETOOLONG 36
+#define __NR_fsmount 432
+#define __NR_rename 82
+#define __OPEN_NEEDS_MODE(oflag) (((oflag) & O_CREAT) != 0 || ((oflag) & __O_TMPFILE) == __O_TMPFILE)
+#define CRTSCTS 020000000000
+#define SIOCSRARP 0x8962
+#define SCNuFAST64 __PRI64_PREFIX "u"
+#define SYS_landlock_add_rule __NR_landlock_add_rule
+#define __FLT64_HAS_INFINITY__ 1
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+#define __FLT16_HAS_INFINITY__ 1
+#define PRIuLEAST8 "u"
+#define false 0
+#define EXTPROC 0200000
+#define _SC_FILE_SYSTEM _SC_FILE_SYSTEM
+#define EPOLL_CTL_MOD 3
+#define _SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX
+#define EFD_CLOEXEC EFD_CLOEXEC
+#define __GNUC_VA_LIST 
+#define FS_POLICY_FLAGS_PAD_16 FSCRYPT_POLICY_FLAGS_PAD_16
+#define SYS_get_robust_list __NR_get_robust_list
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+#define __NR_chmod 90
+#define __code_model_small__ 1
+#define AT_SYMLINK_NOFOLLOW 0x100
+#define _SYS_IOCTL_H 1
+#define __NR_get_thread_area 211
+#define IORING_OFF_SQES 0x10000000ULL
+#define _XOPEN_REALTIME 1
+#define __NR_vfork 58
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+#define SYS_gettid __NR_gettid
+#define __DEC32_MANT_DIG__ 7
+#define __NR_get_mempolicy 239
+#define SYS_msgget __NR_msgget
+#define le64toh(x) __uint64_identity (x)
+#define EPOLLHUP EPOLLHUP
+#define FILENAME_MAX 4096
+#define _SC_NL_TEXTMAX _SC_NL_TEXTMAX
+#define __FLT16_MANT_DIG__ 11
+#define __NR_clone3 435
+#define __ino_t_defined 
+#define EPOLL_CTL_ADD 1
+#define __NR_readahead 187
+#define __k8__ 1
+#define __INTPTR_TYPE__ long int
+#define __UINT16_TYPE__ short unsigned int
+#define MAP_DENYWRITE 0x00800
+#define __WCHAR_TYPE__ int
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define SYS_migrate_pages __NR_migrate_pages
+#define __SLONGWORD_TYPE long int
+#define _LINUX_IOCTL_H 
+#define _SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N
+#define MS_STRICTATIME (1<<24)
+#define __NR_writev 20
+#define PRIiPTR __PRIPTR_PREFIX "i"
+#define BLKTRACESTART _IO(0x12,116)
+#define FS_INDEX_FL 0x00001000
+#define MOUNT_ATTR_RELATIME 0x00000000
+#define FS_KEY_DESC_PREFIX FSCRYPT_KEY_DESC_PREFIX
+#define _POSIX_MEMLOCK_RANGE 200809L
+#define S_IEXEC S_IXUSR
+#define SYS_pselect6 __NR_pselect6
+#define S_ISBLK(mode) __S_ISTYPE((mode), __S_IFBLK)
+#define __NR_signalfd 282
+#define FSCRYPT_POLICY_FLAGS_PAD_4 0x00
+#define __pic__ 2
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+#define SYS_sched_setattr __NR_sched_setattr
+#define FITRIM _IOWR('X', 121, struct fstrim_range)
+#define SYS_move_pages __NR_move_pages
+#define __NR_io_cancel 210
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+#define __NR_msgsnd 69
+#define __S_IFLNK 0120000
+#define __INT_FAST64_WIDTH__ 64
+#define __NR_userfaultfd 323
+#define __NR_personality 135
+#define MADV_NOHUGEPAGE 15
+#define __NR_flistxattr 196
+#define __stub_chflags 
+#define SCNxPTR __PRIPTR_PREFIX "x"
+#define __NR_ustat 136
+#define __UQUAD_TYPE unsigned long int
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define SIOCGIFINDEX 0x8933
+#define EDOTDOT 73
+#define __BYTE_ORDER __LITTLE_ENDIAN
+#define B921600 0010007
+#define IORING_SETUP_DEFER_TASKRUN (1U << 13)
+#define __NR_execve 59
+#define TCSETSW 0x5403
+#define __O_DIRECT 040000
+#define MADV_COLD 20
+#define EL3HLT 46
+#define __USE_POSIX 1
+#define SYS_fallocate __NR_fallocate
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+#define SYS_pidfd_send_signal __NR_pidfd_send_signal
+#define __LITTLE_ENDIAN 1234
+#define SYS_umount2 __NR_umount2
+#define BUFSIZ 8192
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __NR_timer_create 222
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+#define __FLT32_HAS_INFINITY__ 1
+#define INT_FAST32_MAX (9223372036854775807L)
+#define __NR_msync 26
+#define EBADE 52
+#define FS_IOC32_SETFLAGS _IOW('f', 2, int)
+#define SYS_process_vm_writev __NR_process_vm_writev
+#define _SC_NL_SETMAX _SC_NL_SETMAX
+#define __FLT64X_MAX_EXP__ 16384
+#define SYS_kcmp __NR_kcmp
+#define SIOCGIFTXQLEN 0x8942
+#define _WCHAR_T_DECLARED 
+#define __UINT_FAST64_TYPE__ long unsigned int
+#define MAP_SYNC 0x80000
+#define __NR_time 201
+#define MAP_SHARED 0x01
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+#define __NR_settimeofday 164
+#define _POSIX2_CHAR_TERM 200809L
+#define WNOWAIT 0x01000000
+#define SYS_getpgid __NR_getpgid
+#define PRIXFAST8 "X"
+#define __NR_fsetxattr 190
+#define __aligned_s64 __s64 __attribute__((aligned(8)))
+#define EXIT_SUCCESS 0
+#define FS_IOC_SETFLAGS _IOW('f', 2, long)
+#define __LDBL_REDIR_DECL(name) 
+#define _SYS_EVENTFD_H 1
+#define SYS_semget __NR_semget
+#define _SC_2_PBS _SC_2_PBS
+#define UINT_FAST8_MAX (255)
+#define __INT_MAX__ 0x7fffffff
+#define S_IXUSR __S_IEXEC
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+#define _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS
+#define _POSIX_ADVISORY_INFO 200809L
+#define _FCNTL_H 1
+#define __NR_lookup_dcookie 212
+#define __NR_clone 56
+#define SCNoFAST16 __PRIPTR_PREFIX "o"
+#define __linux__ 1
+#define STDIN_FILENO 0
+#define S_IWOTH (S_IWGRP >> 3)
+#define __NR_sendto 44
+#define UINT8_MAX (255)
+#define HUPCL 0002000
+#define __ILP32_OFF32_LDFLAGS "-m32"
+#define __S16_TYPE short int
+#define FS_FL_USER_MODIFIABLE 0x000380FF
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define SYS_gettimeofday __NR_gettimeofday
+#define PRIXMAX __PRI64_PREFIX "X"
+#define TCSETXF 0x5434
+#define MS_MGC_VAL 0xC0ED0000
+#define SYS_link __NR_link
+#define __itimerspec_defined 1
+#define _T_SIZE_ 
+#define __TIMESIZE __WORDSIZE
+#define __NR_clock_settime 227
+#define SYS_ppoll __NR_ppoll
+#define __CPU_SETSIZE 1024
+#define ENOTRECOVERABLE 131
+#define _POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L
+#define _ASM_GENERIC_IOCTL_H 
+#define SCNoFAST32 __PRIPTR_PREFIX "o"
+#define __WNOTHREAD 0x20000000
+#define __NR_readv 19
+#define __NR_pipe 22
+#define SYS_nanosleep __NR_nanosleep
+#define __INT64_TYPE__ long int
+#define _TERMIOS_H 1
+#define SYS_fcntl __NR_fcntl
+#define __NR_remap_file_pages 216
+#define SCNuMAX __PRI64_PREFIX "u"
+#define EIO 5
+#define __FLT_MAX_EXP__ 128
+#define SIOCGIFNETMASK 0x891b
+#define CLOCK_PROCESS_CPUTIME_ID 2
+#define _POSIX_BARRIERS 200809L
+#define B600 0000010
+#define VERASE 2
+#define _SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __gid_t_defined 
+#define ENETUNREACH 101
+#define EXDEV 18
+#define EFAULT 14
+#define fscrypt_policy fscrypt_policy_v1
+#define S_IRGRP (S_IRUSR >> 3)
+#define UINT32_C(c) c ## U
+#define TIOCPKT 0x5420
+#define __ORDER_BIG_ENDIAN__ 4321
+#define __aligned_le64 __le64 __attribute__((aligned(8)))
+#define TTYDEF_LFLAG (ECHO | ICANON | ISIG | IEXTEN | ECHOE|ECHOKE|ECHOCTL)
+#define _SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING
+#define __NR_sched_getscheduler 145
+#define _SC_REGEX_VERSION _SC_REGEX_VERSION
+#define __ptr_t void *
+#define FS_VERITY_FL 0x00100000
+#define __DBL_MANT_DIG__ 53
+#define ___int_size_t_h 
+#define __TIMER_T_TYPE void *
+#define _POSIX_REALTIME_SIGNALS 200809L
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define MS_SILENT 32768
+#define FS_DAX_FL 0x02000000
+#define SYS_open_tree __NR_open_tree
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+#define CCEQ(val,c) ((c) == (val) && (val) != _POSIX_VDISABLE)
+#define __SIZEOF_FLOAT128__ 16
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+#define __NR_chdir 80
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+#define SYS_kill __NR_kill
+#define _POSIX_TRACE -1
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+#define FS_TOPDIR_FL 0x00020000
+#define __clock_t_defined 1
+#define ESRCH 3
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+#define __GLIBC_MINOR__ 36
+#define __DEC64_MIN__ 1E-383DD
+#define __WINT_TYPE__ unsigned int
+#define __UINT_LEAST32_TYPE__ unsigned int
+#define _POSIX_FSYNC 200809L
+#define __SIZEOF_SHORT__ 2
+#define SIOCSIFNAME 0x8923
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+#define __SSE__ 1
+#define SCNu16 "hu"
+#define __NR_prlimit64 302
+#define __sigset_t_defined 1
+#define __intptr_t_defined 
+#define SYS_set_thread_area __NR_set_thread_area
+#define ENOTSOCK 88
+#define _SC_AVPHYS_PAGES _SC_AVPHYS_PAGES
+#define __LDBL_MIN_EXP__ (-16381)
+#define SYS_prlimit64 __NR_prlimit64
+#define _CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS
+#define SYS_mlock2 __NR_mlock2
+#define SYS_fanotify_mark __NR_fanotify_mark
+#define MADV_PAGEOUT 21
+#define SYS_timer_getoverrun __NR_timer_getoverrun
+#define __NR_move_mount 429
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define _POSIX_VDISABLE '\0'
+#define FD_SETSIZE __FD_SETSIZE
+#define VT0 0000000
+#define _SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32
+#define SCNu32 "u"
+#define ENOSPC 28
+#define stdout stdout
+#define __amd64__ 1
+#define ENOEXEC 8
+#define _SC_SIGNALS _SC_SIGNALS
+#define __WINT_WIDTH__ 32
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+#define TIOCSETD 0x5423
+#define _POSIX_THREAD_PRIO_INHERIT 200809L
+#define __INT_LEAST8_MAX__ 0x7f
+#define __USE_POSIX199309 1
+#define MOVE_MOUNT_T_AUTOMOUNTS 0x00000020
+#define __INT_LEAST64_WIDTH__ 64
+#define __LDBL_MAX_EXP__ 16384
+#define _IOC_READ 2U
+#define SYS_ustat __NR_ustat
+#define __FLT32X_MAX_10_EXP__ 308
+#define SIOCRTMSG 0x890D
+#define FIOCLEX 0x5451
+#define S_ISREG(mode) __S_ISTYPE((mode), __S_IFREG)
+#define _SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE
+#define FD_TYPE_PTY 1
+#define NCCS 32
+#define IORING_FEAT_POLL_32BITS (1U << 6)
+#define TIOCM_CD TIOCM_CAR
+#define sched_priority sched_priority
+#define __NR_uname 63
+#define FSCRYPT_MODE_AES_128_CBC 5
+#define _SC_MINSIGSTKSZ _SC_MINSIGSTKSZ
+#define MAP_GROWSDOWN 0x00100
+#define N_MOUSE 2
+#define __SIZEOF_INT128__ 16
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+#define _CS_LFS64_CFLAGS _CS_LFS64_CFLAGS
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+#define __FLT64X_IS_IEC_60559__ 2
+#define SYS_epoll_create __NR_epoll_create
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define SIOCGIFMTU 0x8921
+#define N_MASC 8
+#define __LDBL_MAX_10_EXP__ 4932
+#define __NR_bpf 321
+#define _POSIX_SEMAPHORES 200809L
+#define __ATOMIC_RELAXED 0
+#define __NR_setfsuid 122
+#define __NR_getsid 124
+#define SYS_unlinkat __NR_unlinkat
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define _CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS
+#define CRDLY 0003000
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+#define EMSGSIZE 90
+#define MOUNT_ATTR__ATIME 0x00000070
+#define PTHREAD_PROCESS_PRIVATE PTHREAD_PROCESS_PRIVATE
+#define __stub_stty 
+#define _SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+#define le16toh(x) __uint16_identity (x)
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+#define _SIZET_ 
+#define XATTR_NAME_MAX 255
+#define _PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN
+#define LOCK_SH 1
+#define _LP64 1
+#define SYS_readlinkat __NR_readlinkat
+#define __NR_rt_sigsuspend 130
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+#define SYS_personality __NR_personality
+#define EPOLLET EPOLLET
+#define __UINT8_C(c) c
+#define _BITS_STDINT_INTN_H 1
+#define __NR_brk 12
+#define __FLT64_MAX_EXP__ 1024
+#define TIOCPKT_DATA 0
+#define B2000000 0010013
+#define __S_IFSOCK 0140000
+#define _CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS
+#define FS_ENCRYPTION_MODE_ADIANTUM FSCRYPT_MODE_ADIANTUM
+#define __INT_LEAST32_TYPE__ int
+#define IORING_CQE_F_SOCK_NONEMPTY (1U << 2)
+#define CWERASE CTRL('w')
+#define ECHRNG 44
+#define _SC_REGEXP _SC_REGEXP
+#define _LFS_LARGEFILE 1
+#define SIOCDRARP 0x8960
+#define __wchar_t__ 
+#define MAP_HUGE_MASK 0x3f
+#define IORING_FEAT_NATIVE_WORKERS (1U << 9)
+#define SIOCGIFCONF 0x8912
+#define SEEK_END 2
+#define __SIZEOF_WCHAR_T__ 4
+#define SYS_lchown __NR_lchown
+#define CSTOP CTRL('s')
+#define __USE_POSIX_IMPLICITLY 1
+#define __UINT64_TYPE__ long unsigned int
+#define __NR_unlink 87
+#define _PTHREAD_H 1
+#define SYS_syslog __NR_syslog
+#define __NR_clock_nanosleep 230
+#define __GNUC_PATCHLEVEL__ 0
+#define SCNiFAST16 __PRIPTR_PREFIX "i"
+#define FSCRYPT_KEY_DESC_PREFIX "fscrypt:"
+#define __NR_sync_file_range 277
+#define ENOLCK 37
+#define ENFILE 23
+#define FS_DIRTY_FL 0x00000100
+#define SYS_getdents __NR_getdents
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+#define SYS_mq_getsetattr __NR_mq_getsetattr
+#define __ILP32_OFF32_CFLAGS "-m32"
+#define MADV_POPULATE_WRITE 23
+#define SYS_preadv2 __NR_preadv2
+#define SYS_readv __NR_readv
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+#define _SC_IOV_MAX _SC_IOV_MAX
+#define SYS_epoll_wait __NR_epoll_wait
+#define SYS_sched_getscheduler __NR_sched_getscheduler
+#define _SC_PASS_MAX _SC_PASS_MAX
+#define BLKRRPART _IO(0x12,95)
+#define FSCRYPT_KEY_SPEC_TYPE_DESCRIPTOR 1
+#define __PRI64_PREFIX "l"
+#define B19200 0000016
+#define __S_ISUID 04000
+#define ONLRET 0000040
+#define B4800 0000014
+#define __stub___compat_bdflush 
+#define SCNiFAST32 __PRIPTR_PREFIX "i"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+#define __FLT128_HAS_QUIET_NAN__ 1
+#define O_TRUNC 01000
+#define MADV_DODUMP 17
+#define TCSBRK 0x5409
+#define ENOSYS 38
+#define _CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+#define _SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX
+#define SYS_mq_unlink __NR_mq_unlink
+#define __NR_setxattr 188
+#define SYS_sysfs __NR_sysfs
+#define SYS_delete_module __NR_delete_module
+#define TIOCSERGWILD 0x5454
+#define MADV_SEQUENTIAL 2
+#define _SC_MAPPED_FILES _SC_MAPPED_FILES
+#define SYS_mknodat __NR_mknodat
+#define __INT_FAST8_TYPE__ signed char
+#define SYS_remap_file_pages __NR_remap_file_pages
+#define IORING_POLL_ADD_LEVEL (1U << 3)
+#define _IOC_DIRSHIFT (_IOC_SIZESHIFT+_IOC_SIZEBITS)
+#define PRIiMAX __PRI64_PREFIX "i"
+#define __PID_T_TYPE __S32_TYPE
+#define TIOCM_LE 0x001
+#define __NR_adjtimex 159
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+#define __NR_renameat2 316
+#define _SC_AIO_MAX _SC_AIO_MAX
+#define O_WRONLY 01
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define SYS_io_getevents __NR_io_getevents
+#define _SC_JOB_CONTROL _SC_JOB_CONTROL
+#define MOVE_MOUNT_F_AUTOMOUNTS 0x00000002
+#define SYS_set_mempolicy_home_node __NR_set_mempolicy_home_node
+#define __NR_fsconfig 431
+#define _PC_MAX_CANON _PC_MAX_CANON
+#define ECHOK 0000040
+#define __NR_io_uring_setup 425
+#define _THREAD_SHARED_TYPES_H 1
+#define AT_REMOVEDIR 0x200
+#define SCNiFAST64 __PRI64_PREFIX "i"
+#define __GLIBC_USE_ISOC2X 0
+#define __f128(x) x ##f128
+#define __glibc_has_extension(ext) 0
+#define _SC_TIMERS _SC_TIMERS
+#define FS_NOTAIL_FL 0x00008000
+#define SCNxMAX __PRI64_PREFIX "x"
+#define _IOC_DIR(nr) (((nr) >> _IOC_DIRSHIFT) & _IOC_DIRMASK)
+#define __GNUC_STDC_INLINE__ 1
+#define SYS_rt_sigsuspend __NR_rt_sigsuspend
+#define FS_IOC_GETFLAGS _IOR('f', 1, long)
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+#define P_tmpdir "/tmp"
+#define SYS_vserver __NR_vserver
+#define __attribute_pure__ __attribute__ ((__pure__))
+#define __FLT64_HAS_DENORM__ 1
+#define _POSIX_MESSAGE_PASSING 200809L
+#define SYS_fsconfig __NR_fsconfig
+#define __WORDSIZE_TIME64_COMPAT32 1
+#define __NR_sigaltstack 131
+#define __HAVE_DISTINCT_FLOAT32 0
+#define PTHREAD_SCOPE_SYSTEM PTHREAD_SCOPE_SYSTEM
+#define IORING_SETUP_CQSIZE (1U << 3)
+#define ESRMNT 69
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+#define __kernel_old_uid_t __kernel_old_uid_t
+#define FS_XFLAG_EXTSIZE 0x00000800
+#define EHOSTDOWN 112
+#define __NR_write 1
+#define R_OK 4
+#define MADV_RANDOM 1
+#define FS_IOC_GET_ENCRYPTION_PWSALT _IOW('f', 20, __u8[16])
+#define SYS_socketpair __NR_socketpair
+#define CSUSP CTRL('z')
+#define PTHREAD_ONCE_INIT 0
+#define __FLT16_HAS_DENORM__ 1
+#define _BITS_TYPES___LOCALE_T_H 1
+#define __DBL_DECIMAL_DIG__ 17
+#define SYS_io_uring_setup __NR_io_uring_setup
+#define __STDC_UTF_32__ 1
+#define _BITS_STDIO_LIM_H 1
+#define __INT_FAST8_WIDTH__ 8
+#define SYS_setdomainname __NR_setdomainname
+#define __FXSR__ 1
+#define EDEADLOCK EDEADLK
+#define _SIZE_T 
+#define _POSIX2_VERSION __POSIX2_THIS_VERSION
+#define ENOANO 55
+#define _IO_ERR_SEEN 0x0020
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define PRIxFAST8 "x"
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+#define SYS_uname __NR_uname
+#define __ULONG32_TYPE unsigned int
+#define TIOCSERSETMULTI 0x545B
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+#define FS_XFLAG_IMMUTABLE 0x00000008
+#define _BITS_CPU_SET_H 1
+#define SYS_getrandom __NR_getrandom
+#define UTIME_OMIT ((1l << 30) - 2l)
+#define _SYS_UIO_H 1
+#define IORING_SETUP_R_DISABLED (1U << 6)
+#define IORING_ENTER_REGISTERED_RING (1U << 4)
+#define FOPEN_MAX 16
+#define MS_SLAVE (1<<19)
+#define __BIG_ENDIAN 4321
+#define __S_TYPEISMQ(buf) ((buf)->st_mode - (buf)->st_mode)
+#define __NR_timer_getoverrun 225
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+#define __suseconds_t_defined 
+#define _IOC_NRBITS 8
+#define F_EXLCK 4
+#define ESOCKTNOSUPPORT 94
+#define SYS_symlink __NR_symlink
+#define FILE_DEDUPE_RANGE_DIFFERS 1
+#define SYS_renameat __NR_renameat
+#define __NR_fchownat 260
+#define __off_t_defined 
+#define FSMOUNT_CLOEXEC 0x00000001
+#define __NR_uselib 134
+#define MS_DIRSYNC 128
+#define SYS_close_range __NR_close_range
+#define ENOTBLK 15
+#define FS_XFLAG_EXTSZINHERIT 0x00001000
+#define __NR_timer_gettime 224
+#define SYS_epoll_ctl_old __NR_epoll_ctl_old
+#define __GCC_DESTRUCTIVE_SIZE 64
+#define _SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC
+#define _BITS_TYPES_STRUCT_SCHED_PARAM 1
+#define S_IWRITE S_IWUSR
+#define MS_RMT_MASK (MS_RDONLY|MS_SYNCHRONOUS|MS_MANDLOCK|MS_I_VERSION| MS_LAZYTIME)
+#define PRIdFAST16 __PRIPTR_PREFIX "d"
+#define TCGETA 0x5405
+#define TIOCM_SR 0x010
+#define _STRUCT_TIMESPEC 1
+#define TIOCM_ST 0x008
+#define __INTMAX_WIDTH__ 64
+#define __NR_rt_tgsigqueueinfo 297
+#define CSTATUS _POSIX_VDISABLE
+#define __NR_gettimeofday 96
+#define _POSIX_REENTRANT_FUNCTIONS 1
+#define __NR_fallocate 285
+#define _SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC
+#define __mode_t_defined 
+#define __CPU_ALLOC(count) __sched_cpualloc (count)
+#define _GCC_SIZE_T 
+#define __NR_tkill 200
+#define _POSIX_THREAD_PRIO_PROTECT 200809L
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __NR_landlock_restrict_self 446
+#define TIOCINQ FIONREAD
+#define __W_CONTINUED 0xffff
+#define L_SET SEEK_SET
+#define SYS_utime __NR_utime
+#define SYS_io_setup __NR_io_setup
+#define TOSTOP 0000400
+#define SYS_pkey_free __NR_pkey_free
+#define _IOC_SIZEBITS 14
+#define __UINT32_C(c) c ## U
+#define PRIdFAST32 __PRIPTR_PREFIX "d"
+#define EISCONN 106
+#define B75 0000002
+#define S_ISLNK(mode) __S_ISTYPE((mode), __S_IFLNK)
+#define __size_t__ 
+#define B3500000 0010016
+#define _SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX
+#define _SC_INT_MAX _SC_INT_MAX
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+#define MOVE_MOUNT_SET_GROUP 0x00000100
+#define FS_IMMUTABLE_FL 0x00000010
+#define PRIoPTR __PRIPTR_PREFIX "o"
+#define _BITS_TIME64_H 1
+#define _CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS
+#define _ENDIAN_H 1
+#define __NR_eventfd2 290
+#define __TIME64_T_TYPE __TIME_T_TYPE
+#define __glibc_has_builtin(name) __has_builtin (name)
+#define TIOCMBIS 0x5416
+#define __ONCE_FLAG_INIT { 0 }
+#define _SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+#define FS_IOC_REMOVE_ENCRYPTION_KEY_ALL_USERS _IOWR('f', 25, struct fscrypt_remove_key_arg)
+#define _SC_TRACE_INHERIT _SC_TRACE_INHERIT
+#define B4000000 0010017
+#define _CS_LFS64_LIBS _CS_LFS64_LIBS
+#define _ASM_UNISTD_64_H 
+#define TCXONC 0x540A
+#define EUSERS 87
+#define MS_MOVE 8192
+#define __INT8_MAX__ 0x7f
+#define __LONG_WIDTH__ 64
+#define AT_FDCWD -100
+#define SIOCGRARP 0x8961
+#define __PIC__ 2
+#define TCGETS 0x5401
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+#define PRIdFAST64 __PRI64_PREFIX "d"
+#define IORING_OFF_SQ_RING 0ULL
+#define __UINT_FAST32_TYPE__ long unsigned int
+#define FS_ENCRYPTION_MODE_AES_256_CTS FSCRYPT_MODE_AES_256_CTS
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define O_NOFOLLOW __O_NOFOLLOW
+#define _IOW_BAD(type,nr,size) _IOC(_IOC_WRITE,(type),(nr),sizeof(size))
+#define PTHREAD_EXPLICIT_SCHED PTHREAD_EXPLICIT_SCHED
+#define __NR_faccessat 269
+#define FS_XFLAG_NODUMP 0x00000080
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+#define __POSIX_FADV_NOREUSE 5
+#define __CHAR32_TYPE__ unsigned int
+#define ENOPROTOOPT 92
+#define MOUNT_ATTR_NOEXEC 0x00000008
+#define ESTALE 116
+#define _CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS
+#define TIOCCONS 0x541D
+#define VEOF 4
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+#define SYS_lremovexattr __NR_lremovexattr
+#define URING_WAKE 0xFFFFFFFFULL
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+#define __GLIBC_USE_IEC_60559_EXT 0
+#define __fsfilcnt_t_defined 
+#define EPROTONOSUPPORT 93
+#define __NR_futex_waitv 449
+#define FSCRYPT_POLICY_V1 0
+#define FSCRYPT_POLICY_V2 2
+#define __blkcnt_t_defined 
+#define __HAVE_FLOAT128 1
+#define MAP_HUGETLB 0x40000
+#define FS_COMPRBLK_FL 0x00000200
+#define FS_IOC32_GETFLAGS _IOR('f', 1, int)
+#define VQUIT 1
+#define FD_TYPE_TTY 2
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+#define _IO(type,nr) _IOC(_IOC_NONE,(type),(nr),0)
+#define UINT_LEAST32_MAX (4294967295U)
+#define EMFILE 24
+#define FS_IMAGIC_FL 0x00002000
+#define INR_OPEN_CUR 1024
+#define SCNxLEAST8 "hhx"
+#define FS_EA_INODE_FL 0x00200000
+#define __NR_listen 50
+#define IORING_CQE_F_BUFFER (1U << 0)
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+#define __NR_fstatfs 138
+#define SYS_sethostname __NR_sethostname
+#define __NR_set_robust_list 273
+#define __SSE2__ 1
+#define __NR_name_to_handle_at 303
+#define SYS_truncate __NR_truncate
+#define __NR_kexec_load 246
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS
+#define _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS
+#define _SC_PII_INTERNET _SC_PII_INTERNET
+#define SYS_timer_gettime __NR_timer_gettime
+#define __NR_memfd_create 319
+#define FS_ENCRYPTION_MODE_AES_128_CBC FSCRYPT_MODE_AES_128_CBC
+#define __INT32_TYPE__ int
+#define PTHREAD_CANCEL_DISABLE PTHREAD_CANCEL_DISABLE
+#define _SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX
+#define ENOBUFS 105
+#define __SIZEOF_DOUBLE__ 8
+#define SYS_chown __NR_chown
+#define __FLT_MIN_10_EXP__ (-37)
+#define __NR_listxattr 194
+#define SIOCGIFNAME 0x8910
+#define FS_IOC_GET_ENCRYPTION_KEY_STATUS _IOWR('f', 26, struct fscrypt_get_key_status_arg)
+#define _SC_INT_MIN _SC_INT_MIN
+#define SYS_landlock_create_ruleset __NR_landlock_create_ruleset
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+#define UTILITY_CBUFFER_H 
+#define EPOLLPRI EPOLLPRI
+#define __INT_LEAST32_WIDTH__ 32
+#define SYS_mincore __NR_mincore
+#define __NR_shmat 30
+#define TIOCGSOFTCAR 0x5419
+#define _SC_SHRT_MIN _SC_SHRT_MIN
+#define __NR_ptrace 101
+#define AT_EACCESS 0x200
+#define MOUNT_ATTR_RDONLY 0x00000001
+#define __SWORD_TYPE long int
+#define __INTMAX_TYPE__ long int
+#define __NR_fadvise64 221
+#define __NR_shmctl 31
+#define __NR_getegid 108
+#define MOUNT_ATTR_STRICTATIME 0x00000020
+#define __CPU_CLR_S(cpu,setsize,cpusetp) (__extension__ ({ size_t __cpu = (cpu); __cpu / 8 < (setsize) ? (((__cpu_mask *) ((cpusetp)->__bits))[__CPUELT (__cpu)] &= ~__CPUMASK (__cpu)) : 0; }))
+#define SYS_vhangup __NR_vhangup
+#define SYS_init_module __NR_init_module
+#define TIOCSCTTY 0x540E
+#define SYS_open __NR_open
+#define __DEC128_MAX_EXP__ 6145
+#define SYS_munlockall __NR_munlockall
+#define __CPU_FREE(cpuset) __sched_cpufree (cpuset)
+#define _IOR_BAD(type,nr,size) _IOC(_IOC_READ,(type),(nr),sizeof(size))
+#define __ldiv_t_defined 1
+#define SYS_capset __NR_capset
+#define _T_SIZE 
+#define FS_EXTENT_FL 0x00080000
+#define SYS_getcpu __NR_getcpu
+#define FIFREEZE _IOWR('X', 119, int)
+#define __NR_mlock2 325
+#define FS_MAX_KEY_SIZE FSCRYPT_MAX_KEY_SIZE
+#define __NR_set_mempolicy_home_node 450
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define EWOULDBLOCK EAGAIN
+#define PRIdFAST8 "d"
+#define S_IRWXG (S_IRWXU >> 3)
+#define _CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS
+#define S_IXGRP (S_IXUSR >> 3)
+#define _SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT
+#define __FLT32X_HAS_QUIET_NAN__ 1
+#define _POSIX2_C_BIND __POSIX2_THIS_VERSION
+#define __ATOMIC_CONSUME 1
+#define __NR_recvmmsg 299
+#define SYS_getpmsg __NR_getpmsg
+#define _CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS
+#define __GNUC_MINOR__ 2
+#define __INT_FAST16_WIDTH__ 64
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+#define MS_POSIXACL (1<<16)
+#define ____mbstate_t_defined 1
+#define IOSQE_IO_DRAIN (1U << IOSQE_IO_DRAIN_BIT)
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define CSTOPB 0000100
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+#define PRIiLEAST8 "i"
+#define FS_HUGE_FILE_FL 0x00040000
+#define __LDBL_REDIR2_DECL(name) 
+#define ELIBBAD 80
+#define _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+#define INTMAX_C(c) c ## L
+#define SYS_semtimedop __NR_semtimedop
+#define __glibc_clang_prereq(maj,min) 0
+#define SIOCSIFLINK 0x8911
+#define __nlink_t_defined 
+#define ECONNREFUSED 111
+#define SYS_accept4 __NR_accept4
+#define POSIX_FADV_RANDOM 1
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+#define FS_POLICY_FLAGS_PAD_32 FSCRYPT_POLICY_FLAGS_PAD_32
+#define _POSIX2_C_DEV __POSIX2_THIS_VERSION
+#define _ASM_GENERIC_ERRNO_H 
+#define EAGAIN 11
+#define __NR_setreuid 113
+#define SIOCSIFADDR 0x8916
+#define TIOCSWINSZ 0x5414
+#define _STDINT_H 1
+#define _RWLOCK_INTERNAL_H 
+#define __DBL_MAX_10_EXP__ 308
+#define __FILE_defined 1
+#define UINT16_MAX (65535)
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+#define _CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS
+#define FS_ENCRYPTION_MODE_AES_256_GCM 2
+#define _CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS
+#define S_ISUID __S_ISUID
+#define _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS
+#define TCFLSH 0x540B
+#define __NR__sysctl 156
+#define _POSIX_TRACE_LOG -1
+#define NOFLSH 0000200
+#define __INT16_C(c) c
+#define pthread_cleanup_pop(execute) do { } while (0); } while (0); __pthread_unregister_cancel (&__cancel_buf); if (execute) __cancel_routine (__cancel_arg); } while (0)
+#define __U32_TYPE unsigned int
+#define _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS
+#define FIDEDUPERANGE _IOWR(0x94, 54, struct file_dedupe_range)
+#define MS_INVALIDATE 2
+#define IORING_SETUP_TASKRUN_FLAG (1U << 9)
+#define _SC_THREADS _SC_THREADS
+#define MOUNT_ATTR_SIZE_VER0 32
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define SYS_mprotect __NR_mprotect
+#define _CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS
+#define N_R3964 9
+#define VSTART 8
+#define __STDC__ 1
+#define __FIRMWARE_MCU_BOGUS__ 1
+#define TTYDEF_SPEED (B9600)
+#define BLKDISCARDZEROES _IO(0x12,124)
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+#define SYS_mknod __NR_mknod
+#define ELIBMAX 82
+#define EEXIST 17
+#define TIOCGEXCL _IOR('T', 0x40, int)
+#define __PTRDIFF_TYPE__ long int
+#define SYS_putpmsg __NR_putpmsg
+#define IORING_POLL_ADD_MULTI (1U << 0)
+#define MS_MANDLOCK 64
+#define errno (*__errno_location ())
+#define EL2NSYNC 45
+#define stdin stdin
+#define __NR_setns 308
+#define __FIRMWARE_BOARD_SIMULINUX__ 1
+#define SYS_futex __NR_futex
+#define __clockid_t_defined 1
+#define TCSANOW 0
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+#define __NR_shmget 29
+#define _BITS_STAT_H 1
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+#define __ATOMIC_SEQ_CST 5
+#define N_PPP 3
+#define __NR_faccessat2 439
+#define _SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT
+#define PRIdPTR __PRIPTR_PREFIX "d"
+#define TIOCMIWAIT 0x545C
+#define ENOTEMPTY 39
+#define N_HCI 15
+#define IORING_OFF_MMAP_MASK 0xf8000000ULL
+#define __NR_fchmod 91
+#define ENOPKG 65
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define _BITS_FLOATN_H 
+#define F_SETFD 2
+#define SYS_sendmsg __NR_sendmsg
+#define __NR_timer_settime 223
+#define SYS_shutdown __NR_shutdown
+#define __FLT32X_MIN_10_EXP__ (-307)
+#define FS_POLICY_FLAGS_PAD_MASK FSCRYPT_POLICY_FLAGS_PAD_MASK
+#define PRId16 "d"
+#define FD_CLOEXEC 1
+#define SYS_sched_rr_get_interval __NR_sched_rr_get_interval
+#define PRIuFAST64 __PRI64_PREFIX "u"
+#define __NR_sync 162
+#define __UINTPTR_TYPE__ long unsigned int
+#define N_IRDA 11
+#define SYS_mq_notify __NR_mq_notify
+#define __NR_close_range 436
+#define IORING_RECVSEND_FIXED_BUF (1U << 2)
+#define SIOGIFINDEX SIOCGIFINDEX
+#define MADV_HUGEPAGE 14
+#define VLNEXT 15
+#define IORING_RSRC_REGISTER_SPARSE (1U << 0)
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+#define __bitwise__ __bitwise
+#define __NR_socket 41
+#define _PC_2_SYMLINKS _PC_2_SYMLINKS
+#define SYS_listen __NR_listen
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __LP64_OFF64_CFLAGS "-m64"
+#define BLKIOMIN _IO(0x12,120)
+#define SYS_openat __NR_openat
+#define __DEC128_MANT_DIG__ 34
+#define SYS_sync_file_range __NR_sync_file_range
+#define SYS_fchmodat __NR_fchmodat
+#define __LDBL_MIN_10_EXP__ (-4931)
+#define EKEYREVOKED 128
+#define S_IREAD S_IRUSR
+#define __useconds_t_defined 
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define _SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+#define PRId32 "d"
+#define _SC_SPAWN _SC_SPAWN
+#define _SC_CHAR_MAX _SC_CHAR_MAX
+#define _CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS
+#define MAP_ANONYMOUS 0x20
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define SCNxLEAST16 "hx"
+#define X_OK 1
+#define SYS_query_module __NR_query_module
+#define __SIZEOF_LONG_LONG__ 8
+#define MAP_NONBLOCK 0x10000
+#define __NR_finit_module 313
+#define FS_ENCRYPTION_MODE_AES_256_XTS FSCRYPT_MODE_AES_256_XTS
+#define __NR_syncfs 306
+#define PRIo16 "o"
+#define __USE_ATFILE 1
+#define __NR_query_module 178
+#define POSIX_FADV_SEQUENTIAL 2
+#define SIOCSARP 0x8955
+#define __NR_setsid 112
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+#define __sched_priority sched_priority
+#define EPOLLONESHOT EPOLLONESHOT
+#define __O_PATH 010000000
+#define __NR_epoll_create 213
+#define __FLT128_DECIMAL_DIG__ 36
+#define __NR_setgroups 116
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+#define TIOCNOTTY 0x5422
+#define _STDLIB_H 1
+#define ENOTUNIQ 76
+#define PRId64 __PRI64_PREFIX "d"
+#define PTRDIFF_MAX (9223372036854775807L)
+#define _SC_NZERO _SC_NZERO
+#define VINTR 0
+#define _GETOPT_CORE_H 1
+#define __FLT32_HAS_QUIET_NAN__ 1
+#define __FLT_DECIMAL_DIG__ 9
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+#define SYS_arch_prctl __NR_arch_prctl
+#define PRIo32 "o"
+#define __NR_getpgrp 111
+#define S_IROTH (S_IRGRP >> 3)
+#define __CPUELT(cpu) ((cpu) / __NCPUBITS)
+#define POSIX_MADV_RANDOM 1
+#define __NR_epoll_wait 232
+#define N_AX25 5
+#define _SC_STREAMS _SC_STREAMS
+#define __POSIX2_THIS_VERSION 200809L
+#define __WALL 0x40000000
+#define EPOLLWRNORM EPOLLWRNORM
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+#define __NR_tgkill 234
+#define TCSETSF2 _IOW('T', 0x2D, struct termios2)
+#define PRIoMAX __PRI64_PREFIX "o"
+#define CDISCARD CTRL('o')
+#define __NR_flock 73
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __NR_capget 125
+#define SIOCSIFTXQLEN 0x8943
+#define SYS_mq_timedsend __NR_mq_timedsend
+#define CLOCK_MONOTONIC_COARSE 6
+#define _SC_CHAR_BIT _SC_CHAR_BIT
+#define _ASM_GENERIC_TYPES_H 
+#define FS_SYNC_FL 0x00000008
+#define SYS_timerfd_create __NR_timerfd_create
+#define _SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK
+#define __NR_sethostname 170
+#define ECHOKE 0004000
+#define PRIoFAST8 "o"
+#define INT_LEAST16_MAX (32767)
+#define __NR_signalfd4 289
+#define PRIoLEAST8 "o"
+#define FS_ENCRYPTION_MODE_SPECK128_256_XTS 7
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+#define __UINT_FAST8_TYPE__ unsigned char
+#define EOPNOTSUPP 95
+#define _IOWR_BAD(type,nr,size) _IOC(_IOC_READ|_IOC_WRITE,(type),(nr),sizeof(size))
+#define SCNuLEAST32 "u"
+#define __NR_add_key 248
+#define __P(args) args
+#define __NR_getrlimit 97
+#define __POSIX_FADV_DONTNEED 4
+#define SYS_setuid __NR_setuid
+#define PRIo64 __PRI64_PREFIX "o"
+#define PRIXFAST16 __PRIPTR_PREFIX "X"
+#define __S_ISGID 02000
+#define BS0 0000000
+#define BS1 0020000
+#define IORING_TIMEOUT_BOOTTIME (1U << 2)
+#define __ATOMIC_ACQ_REL 4
+#define S_IFIFO __S_IFIFO
+#define SCNuFAST8 "hhu"
+#define __WCHAR_T 
+#define __ATOMIC_RELEASE 3
+#define __fsblkcnt_t_defined 
+#define EMEDIUMTYPE 124
+#define SYS_timerfd_settime __NR_timerfd_settime
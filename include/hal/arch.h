@@ -23,14 +23,19 @@ extern volatile uint16_t tsecond;
 // 1ms pulsing frame
 // 	- 8 max pulsing pins (each pulse element is a 8 bit value, each bit represent 1 pin value)
 // 	- 250 max pulses per millisecond (ie: 1 each 4us)
+// The host precomputes the bitmasks (ie: step/dir), the MCU shifts them out as they are.
+#define PULSE_SLOT_US	4						// pulse resolution
+#define PULSE_SLOTS		(1000/PULSE_SLOT_US)	// pulses per frame
 typedef struct pin_frame_s {
-	volatile uint16_t milli;
-	volatile uint8_t *pulse;
-	volatile uint8_t pulse_counter;
+	volatile uint16_t milli;		// start time, see pin_pulse_now()
+	volatile uint8_t *pulse;		// PULSE_SLOTS bitmasks
+	volatile uint8_t pulse_counter;	// next slot to play
 	volatile struct pin_frame_s *next;
 } pin_frame_t;
 typedef struct pin_pulsing_s {
-	volatile uint8_t pin[8];
+	volatile uint8_t pin[8];	// pin driven by each bit
+	volatile uint8_t enabled;	// bits in use
+	volatile uint8_t out;		// last bitmask shifted out
 	volatile pin_frame_t *head;
 	volatile pin_frame_t *tail;
 } pin_pulsing_t;
@@ -47,11 +52,29 @@ extern volatile pin_pulsing_t pin_pulsing;
 
 
 // TIME
+// Wide tick clock, TICKS_FREQ ticks per second. It rolls over: always compare with ticks_is_before().
+typedef uint32_t ticks_t;
+ticks_t ticks_now(void);
+// Return the number of ticks for a given number of microseconds (and back).
+static inline ticks_t ticks_from_us(uint32_t us) {
+	return us * (TICKS_FREQ / 1000000UL);
+}
+static inline uint32_t ticks_to_us(ticks_t ticks) {
+	return ticks / (TICKS_FREQ / 1000000UL);
+}
+// Return true if t1 is before t2 (same rule as timer_is_before()).
+static inline uint8_t ticks_is_before(ticks_t t1, ticks_t t2) {
+	return (int32_t)(t1 - t2) < 0;
+}
+// Give the cpu away until 'when' (returns at once if it is already past).
+void ticks_sleep_until(ticks_t when);
 uint16_t cycles(void);
 uint16_t nanos(void);
 uint16_t micros(void);
 uint16_t millis(void);
 uint16_t seconds(void);
+// Coherent copy of tsecond/tmilli/tmicro/tnano, safe from any thread/isr.
+void time_snapshot(uint16_t *s, uint16_t *ms, uint16_t *us, uint16_t *ns);
 uint16_t uelapsed(uint16_t mstart, uint16_t ustart, uint16_t uend, uint16_t mend);
 
 // PORTs
@@ -83,7 +106,11 @@ void pin_open_drain(uint8_t pin);
 uint16_t pin_pulse_detect(uint8_t pin);
 // Generate a single pulse with given width in micro-seconds.
 void pin_pulse_single(uint8_t pin, uint16_t width);
-// Add 1 frame at 'milli(seconds)' to pulsing queue
+// Drive 'pin' with bit 'bit' of the pulsing bitmasks (avr: 'bit' must be the pin bit in its port).
+uint8_t pin_pulse_setup(uint8_t bit, uint8_t pin);
+// Current time in the pulsing timebase (milliseconds, rolls over).
+uint16_t pin_pulse_now(void);
+// Add 1 frame at 'milli(seconds)' to pulsing queue, fill its pulse[] before 'milli'. NULL if out of memory.
 volatile pin_frame_t* pin_pulse_multi(uint16_t milli);
 
 // ARCH
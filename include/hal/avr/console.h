@@ -6,8 +6,8 @@
 #include "protocol.h" // RX_BUFFER_SIZE
 #include "generic_io.h" // readb
 
-extern uint8_t receive_buf[MSG_RX_BUFFER_SIZE], receive_pos;
-extern uint8_t transmit_buf[MSG_TX_BUFFER_SIZE], transmit_pos, transmit_max;
+extern uint8_t transmit_buf[MSG_TX_BUFFER_SIZE];
+extern uint16_t transmit_pos, transmit_max;
 
 void task_console_rx(void);
 
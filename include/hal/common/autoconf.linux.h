@@ -129,6 +129,11 @@
 #define CONFIG_AVR_STACK_SIZE 
 #define CONFIG_MACH_PRU 0
 #define CONFIG_INLINE_STEPPER_HACK 0
+#define CONFIG_SCHED_PROFILE 1
+#define CONFIG_TIMER_SLACK 1
+#define CONFIG_SCHED_HIST 1
+#define CONFIG_CRC16_TABLE 1
+#define CONFIG_DYNMEM_SIZE 20480
 #define CONFIG_AVR_SERIAL_UART3 0
 #define CONFIG_MACH_SAM3X 0
 #define CONFIG_MACH_atmega1284p 0
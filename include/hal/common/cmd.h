@@ -13,12 +13,19 @@
 typedef void (*voidPtr)(void);
 typedef uint8_t* (*cmdPtr)(uint8_t*,uint8_t*);
 
-voidPtr initFunc[FUNCS_INIT_NO];
-voidPtr taskFunc[FUNCS_TASK_NO];
-voidPtr endFunc[FUNCS_END_NO];
-cmdPtr cmdFunc[TYPE_NO];
+// Handler of the TYPE_* command 'TYPE', registered at link time like
+// DECL_INIT (see sched.h): the dispatch table only holds the commands
+// built in
+struct command_decl {
+    uint8_t type;
+    cmdPtr func;
+};
 
-void funcs_init(void);
+#define DECL_COMMAND(FUNC, TYPE)                                        \
+    static const struct command_decl __PASTE(_decl_command_, FUNC)      \
+    __attribute__((used)) __section("decl_command") = {                 \
+        .type = TYPE, .func = FUNC }
 
-#endif // cmd.h
+cmdPtr command_lookup(uint8_t type);
 
+#endif // cmd.h
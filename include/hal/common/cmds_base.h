@@ -8,7 +8,29 @@
 
 #define foreach_oid(pos,data,oidtype) for (pos=-1; (data=oid_next(&pos, oidtype)); )
 
+// Log-linear (HDR style) histograms of clock ticks: values below
+// 2^HIST_SUB_BITS get a bucket each, every power of two above is split
+// in 2^HIST_SUB_BITS linear buckets (relative error under 2^-SUB_BITS),
+// values from 2^HIST_MAX_BITS up share the last bucket
+#if CONFIG_MACH_AVR
+#define HIST_SUB_BITS 2
+#define HIST_MAX_BITS 20    // 65ms at 16MHz, 76 buckets of 16 bits
+typedef uint16_t hist_count_t;
+#else
+#define HIST_SUB_BITS 3
+#define HIST_MAX_BITS 28    // 13s at 20MHz, 208 buckets of 32 bits
+typedef uint32_t hist_count_t;
+#endif
+#define HIST_BUCKETS ((HIST_MAX_BITS - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+
+enum { HIST_TIMER_LATE, HIST_TASK_LOOP, HIST_NO };
+
+struct move_pool;
+
 void *alloc_chunk(size_t size);
+void move_pool_free(struct move_pool *p, void *m);
+void *move_pool_alloc(struct move_pool *p);
+struct move_pool *move_request_pool(uint8_t oid, int size, uint8_t share);
 void move_free(void *m);
 void *move_alloc(void);
 void move_request_size(int size);
@@ -17,6 +39,8 @@ void *oid_alloc(uint8_t oid, void *type, uint16_t size);
 void *oid_next(uint8_t *i, void *type);
 void config_reset(uint32_t *args);
 void stats_update(uint32_t start, uint32_t cur);
+void stats_report_latency(void);
+void hist_record(uint8_t id, uint32_t value);
 
 void task_unknown(void);
 void task_noop(void);
@@ -27,12 +51,15 @@ uint8_t *command_unknown(uint8_t *start, uint8_t *end);
 uint8_t *command_noop(uint8_t *start, uint8_t *end);
 uint8_t *command_allocate_oids(uint8_t *start, uint8_t *end);
 uint8_t *command_get_config(uint8_t *start, uint8_t *end);
+uint8_t *command_get_dynmem(uint8_t *start, uint8_t *end);
 uint8_t *command_finalize_config(uint8_t *start, uint8_t *end);
 uint8_t *command_get_clock(uint8_t *start, uint8_t *end);
 uint8_t *command_get_uptime(uint8_t *start, uint8_t *end);
 uint8_t *command_emergency_stop(uint8_t *start, uint8_t *end);
 uint8_t *command_clear_shutdown(uint8_t *start, uint8_t *end);
 uint8_t *command_identify(uint8_t *start, uint8_t *end);
+uint8_t *command_hist(uint8_t *start, uint8_t *end);
+uint8_t *command_move_pool(uint8_t *start, uint8_t *end);
 
 #endif // cmds_base.h
 
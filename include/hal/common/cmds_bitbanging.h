@@ -6,21 +6,38 @@
 #include "sched.h" // struct timer_s
 #include "platform.h"
 
-struct pwm_software_s {
+// Soft PWM channels sharing a cycle time, and its timer
+struct soft_pwm_group {
     struct timer_s timer;
-    uint32_t on_duration, off_duration, end_time;
-    uint32_t next_on_duration, next_off_duration;
-    uint32_t max_duration, cycle_time;
+    struct pwm_software_s *chans;   // sorted by on_duration
+    struct pwm_software_s *edge;    // next to turn off (NULL: cycle start)
+    uint32_t cycle_time, cycle_start;
+    uint8_t running;
+};
+
+struct pwm_software_s {
+    struct soft_pwm_group *group;
+    struct pwm_software_s *next;
+    uint32_t on_duration, end_time, next_on_duration, max_duration;
     struct gpio_out pin;
     uint8_t default_value, flags;
 };
 
+// spi_software_s.mode: the SPI mode (CPOL and CPHA) and the bit order
+enum {
+    SPI_SW_CPHA=1<<0, SPI_SW_CPOL=1<<1, SPI_SW_LSB_FIRST=1<<2,
+};
+
 struct spi_software_s {
+    // the routine of the mode, set by spi_sw_setup()
+    void (*transfer)(struct spi_software_s *ss, uint8_t receive_data,
+                     uint8_t len, uint8_t *data);
     struct gpio_in miso;
     struct gpio_out mosi, sclk;
     uint8_t mode;
 };
 
+void spi_sw_setup(struct spi_software_s *ss, uint8_t mode);
 void spi_sw_prepare(struct spi_software_s *ss);
 void spi_sw_transfer(struct spi_software_s *ss, uint8_t receive_data, uint8_t len, uint8_t *data);
 
@@ -20,6 +20,7 @@ void spi_set_software_bus(struct spidev_s *spi, struct spi_software_s *ss);
 void spi_transfer(struct spidev_s *spi, uint8_t receive_data, uint8_t data_len, uint8_t *data);
 
 void task_end_spidev(void);
+void task_spi_queue(void);
 
 void command_config_spi(uint32_t*);
 void command_config_spi_without_cs(uint32_t*);
@@ -28,6 +29,8 @@ void command_spi_set_software_bus(uint32_t*);
 void command_spi_transfer(uint32_t*);
 void command_spi_send(uint32_t*);
 void command_config_spi_shutdown(uint32_t*);
+void command_config_spi_queue(uint32_t*);
+void command_spi_queue_transfer(uint32_t*);
 
 #endif // cmds_spi.h
 
@@ -0,0 +1,136 @@
+#ifndef __COBS_H
+#define __COBS_H
+// Consistent overhead byte stuffing (COBS) of the message blocks, shared
+// by the firmware and the host (header only, like klippy.old/chelper/vlq.h).
+//
+// A block is framed in place, see protocol.h: buf[0] is the first code,
+// every MSG_SYNC between it and the trailing sync byte is replaced by the
+// code of the group after it. A code is the distance to the next code (or
+// to the trailing sync), stored xor MSG_SYNC so it is never read as a sync
+// itself. Blocks are at most MSG_MAX (256) bytes, so a code always fits a
+// byte and no extra code byte is ever inserted.
+//
+// The work is the search of the sync bytes: one byte at a time for AVR,
+// one word at a time (SWAR) for 32 bit MCUs, 16/32 bytes at a time with
+// SSE2/AVX2 on the host. cobs_find_sync() is the best one available.
+
+#include <stdint.h> // uint8_t
+#include <string.h> // memcpy
+#if defined(__SSE2__)
+#include <emmintrin.h> // _mm_cmpeq_epi8
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h> // _mm256_cmpeq_epi8
+#endif
+
+#include "protocol.h" // MSG_SYNC
+
+// First MSG_SYNC in [p, end), or end
+static inline uint8_t *
+cobs_find_sync_scalar(uint8_t *p, uint8_t *end)
+{
+    while (p < end && *p != MSG_SYNC)
+        p++;
+    return p;
+}
+
+// As cobs_find_sync_scalar(), testing a word at a time: a byte of
+// w ^ sync is zero where w has a sync (the lowest flagged byte is exact,
+// the ones above it may be false positives and are rescanned)
+static inline uint8_t *
+cobs_find_sync_swar(uint8_t *p, uint8_t *end)
+{
+    const uintptr_t ones = (uintptr_t)-1 / 0xff;
+    while (end - p >= (int)sizeof(uintptr_t)) {
+        uintptr_t w;
+        memcpy(&w, p, sizeof(w));
+        w ^= ones * MSG_SYNC;
+        if ((w - ones) & ~w & (ones << 7))
+            break;
+        p += sizeof(w);
+    }
+    return cobs_find_sync_scalar(p, end);
+}
+
+#if defined(__SSE2__)
+static inline uint8_t *
+cobs_find_sync_sse2(uint8_t *p, uint8_t *end)
+{
+    const __m128i sync = _mm_set1_epi8(MSG_SYNC);
+    while (end - p >= 16) {
+        __m128i b = _mm_loadu_si128((const __m128i*)p);
+        int m = _mm_movemask_epi8(_mm_cmpeq_epi8(b, sync));
+        if (m)
+            return p + __builtin_ctz(m);
+        p += 16;
+    }
+    return cobs_find_sync_scalar(p, end);
+}
+#endif
+
+#if defined(__AVX2__)
+static inline uint8_t *
+cobs_find_sync_avx2(uint8_t *p, uint8_t *end)
+{
+    const __m256i sync = _mm256_set1_epi8(MSG_SYNC);
+    while (end - p >= 32) {
+        __m256i b = _mm256_loadu_si256((const __m256i*)p);
+        uint32_t m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(b, sync));
+        if (m)
+            return p + __builtin_ctz(m);
+        p += 32;
+    }
+    return cobs_find_sync_sse2(p, end);
+}
+#endif
+
+static inline uint8_t *
+cobs_find_sync(uint8_t *p, uint8_t *end)
+{
+#if defined(__AVX2__)
+    return cobs_find_sync_avx2(p, end);
+#elif defined(__SSE2__)
+    return cobs_find_sync_sse2(p, end);
+#elif __SIZEOF_POINTER__ >= 4
+    return cobs_find_sync_swar(p, end);
+#else
+    return cobs_find_sync_scalar(p, end);
+#endif
+}
+
+// Encode the block buf[0..len) in place, buf[0] and buf[len-1] are the
+// code and sync bytes to be set
+static inline void
+cobs_encode(uint8_t *buf, uint_fast16_t len)
+{
+    uint8_t *code = buf, *end = &buf[len - 1];
+    for (;;) {
+        uint8_t *s = cobs_find_sync(code + 1, end);
+        *code = (uint8_t)(s - code) ^ MSG_SYNC;
+        if (s == end)
+            break;
+        code = s;
+    }
+    *end = MSG_SYNC;
+}
+
+// Decode the block buf[0..len), ending with its sync byte, in place:
+// the codes after buf[0] are turned back into MSG_SYNC. Returns -1 if a
+// code doesn't lead to the sync byte (buf[0] is left as it is).
+static inline int
+cobs_decode(uint8_t *buf, uint_fast16_t len)
+{
+    uint8_t *p = buf, *end = &buf[len - 1];
+    for (;;) {
+        uint_fast16_t c = *p ^ MSG_SYNC;
+        if (!c || c > (uint_fast16_t)(end - p))
+            return -1;
+        if (p != buf)
+            *p = MSG_SYNC;
+        p += c;
+        if (p == end)
+            return 0;
+    }
+}
+
+#endif // cobs.h
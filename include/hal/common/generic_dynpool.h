@@ -1,8 +1,10 @@
 #ifndef __GENERIC_DYNPOOL_H
 #define __GENERIC_DYNPOOL_H
 
+#include <stddef.h> // size_t
+
+int dynmem_setup(size_t size);
 void *dynmem_start(void);
 void *dynmem_end(void);
 
 #endif // generic_dynpool.h
-
@@ -15,6 +15,7 @@
 #endif
 #define __visible __attribute__((externally_visible))
 #define __noreturn __attribute__((noreturn))
+#define __weak __attribute__((weak))
 
 #define PACKED __attribute__((packed))
 #ifndef __aligned
@@ -0,0 +1,35 @@
+// Generated by misc/messages.py from src/hal/common/messages.txt - do not edit
+
+#ifndef __MESSAGES_H
+#define __MESSAGES_H
+
+#include <stdint.h> // uint8_t
+
+// Encoders of the messages to the host: each one vlq encodes its
+// arguments straight into the transmit buffer (see tx_buffer_alloc())
+void send_ack(void);
+void send_nack(void);
+void send_start(void);
+void send_shutdown_now(uint32_t clock, uint16_t static_string_id);
+void send_shutdown_last(uint16_t static_string_id);
+void send_base_identify(uint32_t offset, uint8_t data_len, const uint8_t *data);
+void send_base_get_config(uint8_t is_config, uint32_t crc, uint16_t move_count, uint8_t is_shutdown);
+void send_base_get_dynmem(uint32_t size, uint32_t used, uint32_t free, uint32_t largest);
+void send_base_get_clock(uint32_t clock);
+void send_base_get_uptime(uint32_t high, uint32_t clock);
+void send_base_stats(uint32_t count, uint32_t sum, uint32_t sumsq);
+void send_base_latency(uint32_t count, uint32_t p50, uint32_t p90, uint32_t p99, uint32_t p999, uint32_t max);
+void send_base_profile(uint8_t kind, uint8_t idx, uint32_t func, uint32_t count, uint32_t sum, uint32_t max, uint32_t late);
+void send_base_hist(uint8_t id, uint8_t sub_bits, uint32_t max, uint16_t pos, uint8_t counts_len, const uint32_t *counts);
+void send_base_move_pool(uint8_t oid, uint16_t count, uint16_t used, uint16_t peak);
+void send_debug_read(uint32_t val);
+void send_debug_ping(uint8_t data_len, const uint8_t *data);
+void send_adc_state(uint8_t oid, uint32_t next_clock, uint16_t value);
+void send_i2c_read(uint8_t oid, uint8_t response_len, const uint8_t *response);
+void send_spi_transfer(uint8_t oid, uint8_t response_len, const uint8_t *response);
+
+// zlib compressed host dictionary (see command_identify())
+extern const uint8_t command_identify_data[];
+extern const uint32_t command_identify_size;
+
+#endif // messages.h
@@ -5,10 +5,6 @@
 #include "protocol.h"
 
 #ifdef __BOARD_AVR__
-#define FUNCS_INIT_NO 6
-#define FUNCS_TASK_NO 7
-#define FUNCS_END_NO 12
-
 #include "autoconf.avr.h"
 #include "adc.h"
 #include "console.h"
@@ -26,10 +22,6 @@
 #include "timer.h"
 #include "watchdog.h"
 #elif defined __BOARD_LINUX__
-#define FUNCS_INIT_NO 2
-#define FUNCS_TASK_NO 5
-#define FUNCS_END_NO 5
-
 #include "autoconf.linux.h"
 #include "adc.h"
 #include "console.h"
@@ -44,10 +36,6 @@
 #include "generic_pgm.h"
 #include "generic_crc16_ccitt.h"
 #elif defined __BOARD_SIMULINUX__
-#define FUNCS_INIT_NO 2
-#define FUNCS_TASK_NO 5
-#define FUNCS_END_NO 5
-
 #include "autoconf.simulinux.h"
 #endif // CONFIG_MACH_*
 
@@ -13,7 +13,8 @@
 |______|____________________________________________________COBS code
 */
 #define MSG_MAX 256
-#define MSG_RX_BUFFER_SIZE (MSG_MAX*2)
+#define MSG_RX_RING_SIZE 512 // power of 2, holds MSG_RX_RING_SIZE-1 bytes (see rxtx_irq.c)
+#define MSG_RX_BUFFER_SIZE (MSG_RX_RING_SIZE+MSG_MAX)
 #define MSG_TX_BUFFER_SIZE (MSG_MAX+(MSG_MAX/2))
 #define MSG_COBS_OVERHEAD ((MSG_MAX/254)+1)
 #define MSG_OVERHEAD 3
@@ -75,7 +76,12 @@
 #define TYPE_SPI_TRANSFER 42
 #define TYPE_SPI_SEND 43
 #define TYPE_SPI_SHUTDOWN 44
-#define TYPE_NO 45 // number of existing commands
+#define TYPE_BASE_LATENCY 45
+#define TYPE_BASE_PROFILE 46
+#define TYPE_BASE_HIST 47
+#define TYPE_BASE_MOVE_POOL 48
+#define TYPE_BASE_GET_DYNMEM 49
+#define TYPE_NO 50 // number of existing commands
 
 #define ERROR_UNKNOWN 0
 #define ERROR_GENERIC 1
@@ -6,15 +6,16 @@
 #include "platform.h"
 
 void rx_buffer_add(uint_fast8_t data); // called from irq
-void rx_buffer_clean(uint_fast8_t len);
-int_fast8_t rx_find_block(uint8_t *buf, uint_fast8_t buf_len, uint_fast8_t *pop_count);
-void rx_run_cmds(uint8_t *buf, uint_fast8_t msglen);
-int_fast8_t rx_find_and_run(uint8_t *buf, uint_fast8_t buf_len, uint_fast8_t *pop_count);
+uint_fast16_t rx_buffer_space(uint8_t **data);
+void rx_buffer_commit(uint_fast16_t len);
+void rx_run_cmds(uint8_t *buf, uint_fast16_t msglen);
+void rx_buffer_run(void);
 
 uint8_t *tx_buffer_alloc(uint_fast8_t len);
 void tx_buffer_trigger(uint8_t *buf, uint8_t len);
 extern void tx_buffer_enable_irq(void); // callback provided by board specific code
 int tx_buffer_next(uint8_t *pdata); // called from irq
+void task_tx_flush(void);
 
 void task_end_tx(void);
 
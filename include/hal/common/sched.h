@@ -10,20 +10,77 @@ struct timer_s {
     struct timer_s *next;
     uint_fast8_t (*func)(struct timer_s*);
     uint32_t waketime;
+    // timer heap links (see sched.c)
+    struct timer_s *child, *prev;
+#if CONFIG_TIMER_SLACK
+    // may run up to 'slack' ticks after waketime, so that timers with
+    // overlapping windows share a wake up (0: on time, steppers)
+    uint32_t slack;
+#endif
 };
 
+// Set the tolerance of a timer (before sched_add_timer())
+static inline void sched_timer_slack(struct timer_s *t, uint32_t slack) {
+#if CONFIG_TIMER_SLACK
+    t->slack = slack;
+#endif
+}
+
 enum { SF_DONE=0, SF_RESCHEDULE=1 };
 
 // Task waking struct
 struct task_wake {
     uint8_t wake;
+    uint8_t mask;   // task bits in the wake bitmap (see sched.c)
+};
+
+// Link-time registration: each DECL_* emits a const entry in a section
+// of its own and the linker gathers the entries of all the linked
+// objects in one table, bounded by __start_<section>/__stop_<section>.
+// Nothing is set up at run time and only what is built in takes space.
+// The tables are read with READP (flash on AVR).
+struct task_decl {
+    void (*func)(void);
+    struct task_wake *wake;     // NULL: run on every task loop pass
+};
+
+struct init_decl {
+    uint8_t prio;
+    void (*func)(void);
 };
 
+// DECL_INIT priorities: the table is in link order, so sched_main()
+// runs it once per level, lowest first
+enum {
+    INIT_CLOCK,     // cpu clock, everything timed depends on it
+    INIT_CORE,      // timers, watchdog, allocator
+    INIT_DEVICE,    // serial, pins
+    INIT_LAST = INIT_DEVICE
+};
+
+// Run once at startup, in PRIO order (link order within a level)
+#define DECL_INIT(FUNC, PRIO)                                           \
+    static const struct init_decl __PASTE(_decl_init_, FUNC)            \
+    __attribute__((used)) __section("decl_init") = {                    \
+        .prio = PRIO, .func = FUNC }
+
+// Run from the task loop once 'WAKE' is woken (see sched_wake_task())
+#define DECL_TASK(FUNC, WAKE)                                           \
+    static const struct task_decl __PASTE(_decl_task_, FUNC)            \
+    __attribute__((used)) __section("decl_task") = {                    \
+        .func = FUNC, .wake = WAKE }
+
+// Run on shutdown
+#define DECL_END(FUNC)                                                  \
+    static void (* const __PASTE(_decl_end_, FUNC))(void)               \
+    __attribute__((used)) __section("decl_end") = FUNC
+
 // sched.c
 void sched_add_timer(struct timer_s*);
 void sched_del_timer(struct timer_s *del);
 unsigned int sched_timer_dispatch(void);
 void sched_timer_reset(void);
+uint32_t sched_timer_wake(void);
 void sched_wake_tasks(void);
 uint8_t sched_tasks_busy(void);
 void sched_wake_task(struct task_wake *w);
@@ -33,12 +90,13 @@ void sched_clear_shutdown(void);
 void sched_try_shutdown(uint_fast8_t reason);
 void sched_shutdown(uint_fast8_t reason) __noreturn;
 void sched_report_shutdown(void);
+void sched_report_profile(void);
 void sched_main(void);
 
 uint8_t *vlq_encode(uint8_t *p, uint32_t v);
 uint32_t vlq_decode(uint8_t **pp);
-void send_command(uint8_t typ, ...);
-void send_response(uint8_t typ, ...);
+uint8_t *vlq_encode_n(uint8_t *p, const uint32_t *v, uint_fast8_t n);
+void vlq_decode_n(uint8_t **pp, uint32_t *v, uint_fast8_t n);
 
 uint8_t __always_inline str_lookup(const char *str) {
     if (__builtin_strcmp(str, "Shutdown cleared when not shutdown") == 0)
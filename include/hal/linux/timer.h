@@ -18,6 +18,7 @@ uint32_t timer_from_us(uint32_t us);
 uint8_t timer_is_before(uint32_t time1, uint32_t time2);
 uint32_t timer_read_time(void);
 void timer_kick(void);
+void timer_kick_before(uint32_t time);
 
 void timer_dispatch(void);
 
@@ -62,6 +62,7 @@
 #define TIMER32				1		// 32bit timers
 #define WATCHDOG			1		//
 #define PIN_TOTAL			8		// total amount of I/O lines
+#define TICKS_FREQ			1000000UL	// ticks_now() frequency (1us)
 enum pin_e {
     P1 = 0,
     P2 = 1,
@@ -83,6 +84,7 @@ enum pin_e {
 #define TIMER32				3		// 32bit timers (3 64 bit timers per process)
 #define WATCHDOG			1		//
 #define PIN_TOTAL			0		// total amount of I/O lines
+#define TICKS_FREQ			1000000UL	// ticks_now() frequency (1us)
 enum pin_e {
 	None = 0,
 };
@@ -97,6 +99,7 @@ enum pin_e {
 #define TIMER32				0		// 32bit timers
 #define WATCHDOG			1		//
 #define PIN_TOTAL			23		// total amount of I/O lines
+#define TICKS_FREQ			1000000UL	// ticks_now() frequency (1us, from TCNT1)
 enum pin_e {
     P1 = GPIO_PIN(0x23,0),	//!< PINB:0
     P2 = GPIO_PIN(0x23,1),	//!< PINB:1
@@ -136,6 +139,7 @@ enum pin_e {
 #define TIMER32				0		// 32bit timers
 #define WATCHDOG			1		//
 #define PIN_TOTAL			32		// total amount of I/O lines
+#define TICKS_FREQ			1000000UL	// ticks_now() frequency (1us, from TCNT1)
 enum pin_e {
     P1 = GPIO_PIN(0x23,0),	//!< PINB:0
     P2 = GPIO_PIN(0x23,1),	//!< PINB:1
@@ -175,6 +179,7 @@ enum pin_e {
 #define TIMER32				0		// 32bit timers
 #define WATCHDOG			1		//
 #define PIN_TOTAL			32		// total amount of I/O lines
+#define TICKS_FREQ			1000000UL	// ticks_now() frequency (1us, from TCNT1)
 enum pin_e {
     P1 = GPIO_PIN(0x23,0),	//!< PINB:0
     P2 = GPIO_PIN(0x23,1),	//!< PINB:1
@@ -214,6 +219,7 @@ enum pin_e {
 #define TIMER32				0		// 32bit timers
 #define WATCHDOG			1		//
 #define PIN_TOTAL			86		// total amount of I/O lines
+#define TICKS_FREQ			1000000UL	// ticks_now() frequency (1us, from TCNT1)
 enum pin_e {
     P1 = GPIO_PIN(0x20,0),	//!< PINA:0
     P2 = GPIO_PIN(0x20,1),	//!< PINA:1
@@ -325,6 +331,7 @@ enum pin_e {
 #define TIMER32				0		// 32bit timers
 #define WATCHDOG			1		//
 #define PIN_TOTAL			86		// total amount of I/O lines
+#define TICKS_FREQ			1000000UL	// ticks_now() frequency (1us, from TCNT1)
 enum pin_e {
     P1 = GPIO_PIN(0x20,0),	//!< PINA:0
     P2 = GPIO_PIN(0x20,1),	//!< PINA:1
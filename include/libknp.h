@@ -22,6 +22,19 @@ extern "C" {
 	// tasks
 	extern task_t *tasks;
 
+	// multi-MCU relay: routing table entry
+	typedef struct route_s {
+		uint8_t node; // destination node id
+		uint8_t hops; // hops to destination
+		commport_t *port; // next hop
+	} route_t;
+
+	// this node id (RELAY_NODE_HOST on host side)
+	extern uint8_t nodeId;
+	// routing table
+	extern route_t routes[RELAY_ROUTES_MAX];
+	extern uint8_t routesNo;
+
 	// init once before looping run()
 	void init(char *name, char *ver);
 
@@ -30,12 +43,12 @@ extern "C" {
 	// send a string to the other side of the connection
 	void remoteLog(const char *format, ...);
 
-	// receive 1 event
-	void getEvent(void);
+	// receive 1 event, return 1 if one was run (0: input drained)
+	uint8_t getEvent(void);
 	// mcu side: run 1 event
 	void runEvent(uint8_t size, uint8_t *event);
 	// run events from scheduler (if any), at the right time
-	void runEventSched(uint16_t now);
+	void runEventSched(ticks_t now);
 	// print event in buffer (or given event)
 	void printEvent(uint8_t size, uint8_t *event, char *output);
 
@@ -83,6 +96,8 @@ extern "C" {
 	void cmdSysexSchedQueryList(void);					// scheduler query task list
 	void cmdSysexSchedQueryTask(uint8_t id);			// scheduler query specific task
 	void cmdSysexSchedReset(void);						// scheduler delete all tasks
+	void cmdSysexRelay(uint8_t node, uint8_t size, uint8_t *event);	// relay an encoded event to another node
+	void cmdSysexRoute(uint8_t cmd, uint8_t node, uint8_t port, uint8_t hops);	// add/delete/reset routes on the other side
 	void cmdSysexVersion(uint8_t item); // report firmware version details
 	void cmdSysexFeatures(void);		// report features supported by the firmware
 	void cmdSysexPinCapsReq(void);		// ask for supported modes and resolution of all pins
@@ -138,6 +153,7 @@ extern "C" {
 	void eventSysexSchedQueryList(void);
 	void eventSysexSchedQueryTask(uint8_t id);
 	void eventSysexSchedReset(void);
+	void eventSysexRelay(uint8_t size, uint8_t *data);
 	void eventSysexVersion(uint8_t item, char *ver);
 	void eventSysexFeatures(uint8_t feature);
 	void eventSysexPinCapsReq(void);
@@ -143,6 +143,7 @@ Pin groups:
 #define SYSEX_SPI_DATA				0x07 // SPI communication (see related sub commands)
 #define SYSEX_STRING_DATA			0x08 // encoded string (see related sub commands)
 #define SYSEX_SCHEDULER_DATA		0x09 // scheduler request (see related sub commands)
+#define SYSEX_RELAY_DATA			0x0A // multi-MCU relay and routing (see related sub commands)
 // 0x20-0x3F: REPORT
 #define SYSEX_VERSION				0x20 // report firmware's version details (name, libs version, ...)
 #define SYSEX_FEATURES				0x21 // report features supported by the firmware
@@ -190,6 +191,34 @@ If there's no delay_task message at the end of the task (so the time-to-run is n
 #define SYSEX_SUB_SCHED_ERROR_REP	9
 #define SYSEX_SUB_SCHED_RESET		127
 
+/* Relay data sub (0x00-0x7F)
+Each MCU is a node with a 7 bit id (0 is the host). Nodes are chained: the binary console faces the host,
+the 'peering' port faces the next MCU. An event addressed to another node is wrapped in a relay sysex:
+
+	[SYSEX_MOD_ASYNC][SYSEX_RELAY_DATA][SYSEX_SUB_RELAY_FORWARD][dst][src][hops][encoded event]
+
+The receiving node runs the wrapped event if dst is its own id, otherwise it decrements hops and forwards
+the relay to the next hop found in its routing table (default route: back to the host).
+Relays with no hops left are discarded. Routes are configured by the host (ROUTE_ADD/DEL/RESET) and
+learned from the source node id of every incoming relay.
+*/
+#define SYSEX_SUB_RELAY_FORWARD		0
+#define SYSEX_SUB_RELAY_ROUTE_ADD	1
+#define SYSEX_SUB_RELAY_ROUTE_DEL	2
+#define SYSEX_SUB_RELAY_ROUTE_RESET	127
+
+// relay ports (next hop)
+#define RELAY_PORT_UPSTREAM	0 // binary console, towards the host
+#define RELAY_PORT_PEERING	1 // peering port, towards the next MCU
+
+// relay limits
+#define RELAY_NODE_HOST		0 // host node id
+#define RELAY_NODE_MAX		127 // max node id (7 bit)
+#define RELAY_HOPS_MAX		8 // max hops for a relayed event
+#define RELAY_ROUTES_MAX	16 // routing table entries
+// max bytes of a relayed event: the 6 relay header bytes and the event are 7 bit encoded (2x)
+#define RELAY_EVENT_MAX		((PROTOCOL_MAX_EVENT_BYTES - PROTOCOL_SYSEX_FRAMING) / 2 - 6)
+
 // Onewire data sub (0x00-0x7F)
 #define SYSEX_SUB_ONEWIRE_	0
 
@@ -224,6 +253,8 @@ If there's no delay_task message at the end of the task (so the time-to-run is n
 
 // max number of data bytes in incoming messages
 #define PROTOCOL_MAX_EVENT_BYTES   64
+// sysex bytes around the encoded data: [begin][sequence id][sysex start] ... [sysex end][CRC]
+#define PROTOCOL_SYSEX_FRAMING	5
 // use sequenceId TODO, make it optional
 #define PROTOCOL_USE_SEQUENCEID	1
 // use CRC8 TODO, make it optional
@@ -231,7 +262,7 @@ If there's no delay_task message at the end of the task (so the time-to-run is n
 
 typedef struct task_s {
 	uint8_t id; // only 7bits used -> supports 127 tasks
-	long ms; // ms to task
+	uint32_t time; // ticks to task (0: not scheduled)
 	int len;
 	int pos;
 	uint8_t *messages;
@@ -275,6 +306,8 @@ uint8_t encodingSwitch(uint8_t proto);
 // - uncomplete event: returns 0,
 // - complete event: returns the number of stored bytes
 uint8_t decodeEvent(uint8_t *byte, uint8_t size, uint8_t *event);
+// returns true while an event is being decoded (ie: don't switch input stream)
+uint8_t decodePending(void);
 
 // prepare data for sending and write it at &event:
 // returns the event's number of bytes
@@ -301,6 +334,8 @@ uint8_t encodeSysexPrefPins(uint8_t *result, uint8_t cmd, uint8_t pin);
 uint8_t encodeSysexPinGroups(uint8_t *result, uint8_t group, uint8_t cmd, uint8_t pin);
 uint8_t encodeSysexTask(uint8_t *result, task_t *task, uint8_t error);
 uint8_t encodeSysexFeatures(uint8_t *result, uint8_t feature, uint8_t *data);
+uint8_t encodeSysexRelay(uint8_t *result, uint8_t dst, uint8_t src, uint8_t hops, uint8_t size, uint8_t *event);
+uint8_t encodeSysexRoute(uint8_t *result, uint8_t cmd, uint8_t node, uint8_t port, uint8_t hops);
 
 #include <protocol_custom.h>
 
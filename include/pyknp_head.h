@@ -9,7 +9,8 @@ int initFdThread(void);
 int fdOpen(const char *fname, uint8_t type);
 int fdGet(int fdid);
 int fdAvailable(int fdid);
-int fdRead(int fdid, uint8_t *data);
+int fdWait(int fdid, int timeout_ms);
+int fdRead(int fdid, uint8_t *data, int len);
 int fdWrite(int fdid, uint8_t *data, int len);
 int fdClose(int fdid);
 int closeFdThread(void);
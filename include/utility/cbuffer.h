@@ -1,4 +1,3 @@
-
 #ifndef UTILITY_CBUFFER_H
 #define UTILITY_CBUFFER_H
 
@@ -9,24 +8,45 @@ extern "C" {
 #include <inttypes.h> // for uint8_t
 #include <stdbool.h>
 
-	// - head used as write index, tail used as read index
-	// - max 255 bytes
-	// - use only N-1 elements in the N element buffer:
+	// Single producer, single consumer ring buffer:
+	// - capacity is a power of two (any size, rounded up by cbuf_init)
+	// - head and tail are free running indices, masked on access, so all N bytes are usable:
 	// 	- if head is equal to tail -> the buffer is empty
-	// 	- if (head + 1) is equal to tail -> the buffer is full
+	// 	- if (head - tail) is equal to N -> the buffer is full
+	// - head is written by the producer only, tail by the consumer only: no lock needed,
+	//   acquire/release atomics on host, irq-safe index access on AVR (16 bit indices)
+	// - bulk push/pop copy with at most 2 memcpy, peek/commit and reserve/publish give
+	//   direct access to the contiguous part of the buffer (zero-copy parsing/reading)
+#ifdef __FIRMWARE_ARCH_AVR__
+	typedef uint16_t cbuf_idx_t;
+#else
+	typedef uint32_t cbuf_idx_t;
+#endif
+
 	typedef struct cbuffer_s {
 		uint8_t *data;
-		uint8_t head;
-		uint8_t tail;
-		uint8_t len;
+		cbuf_idx_t head;	// write index (producer)
+		cbuf_idx_t tail;	// read index (consumer)
+		cbuf_idx_t mask;	// capacity - 1
 	} cbuffer_t;
 
-	void cbuf_reset(volatile cbuffer_t *buf);
-	uint8_t cbuf_init(volatile cbuffer_t *buf, uint16_t len);
-	bool cbuf_is_empty(volatile cbuffer_t *buf);
-	bool cbuf_is_full(volatile cbuffer_t *buf);
-	uint8_t cbuf_push(volatile cbuffer_t *buf, uint8_t *data, uint8_t len);
-	uint8_t cbuf_pop(volatile cbuffer_t *buf, uint8_t *data, uint8_t len);
+	uint8_t cbuf_init(cbuffer_t *buf, uint32_t len);
+	uint8_t cbuf_attach(cbuffer_t *buf, uint8_t *data, uint32_t len);
+	void cbuf_release(cbuffer_t *buf);
+	void cbuf_reset(cbuffer_t *buf);
+	cbuf_idx_t cbuf_size(cbuffer_t *buf);
+	cbuf_idx_t cbuf_used(cbuffer_t *buf);
+	cbuf_idx_t cbuf_free(cbuffer_t *buf);
+	bool cbuf_is_empty(cbuffer_t *buf);
+	bool cbuf_is_full(cbuffer_t *buf);
+	// producer side
+	cbuf_idx_t cbuf_push(cbuffer_t *buf, const uint8_t *data, cbuf_idx_t len);
+	cbuf_idx_t cbuf_reserve(cbuffer_t *buf, uint8_t **data);
+	void cbuf_publish(cbuffer_t *buf, cbuf_idx_t len);
+	// consumer side
+	cbuf_idx_t cbuf_pop(cbuffer_t *buf, uint8_t *data, cbuf_idx_t len);
+	cbuf_idx_t cbuf_peek(cbuffer_t *buf, uint8_t **data);
+	void cbuf_commit(cbuffer_t *buf, cbuf_idx_t len);
 
 #ifdef __cplusplus
 }
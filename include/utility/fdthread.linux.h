@@ -1,5 +1,5 @@
-#ifndef HAL_H
-#define HAL_H
+#ifndef UTILITY_FDTHREAD_LINUX_H
+#define UTILITY_FDTHREAD_LINUX_H
 
 #ifdef __cplusplus
 extern "C" {
@@ -7,28 +7,58 @@ extern "C" {
 
 #include <inttypes.h>
 #include <sys/epoll.h>
+#include <utility/cbuffer.h>
 
 #define FD_TYPE_FILE	0
 #define FD_TYPE_PTY		1
 #define FD_TYPE_TTY		2
 #define FD_TYPE_SOCKET	3
 
-#define BLOCK_SIZE 64
+#define BLOCK_SIZE 64		// default read/write chunk
+#define FD_MAX 16			// max open fds
+#define FD_RING_SIZE 4096	// rx and tx ring size, per fd
+#define FD_POLL_MS 100		// I/O thread timeout, regular files (not pollable) are read at this rate
 
+#define FD_BACKEND_EPOLL	0
+#define FD_BACKEND_URING	1
+
+// One I/O thread moves data between the fds and their rings, with one of two backends:
+// - epoll: blocks in epoll_wait on all fds plus an eventfd, used to wake it up when there is
+//   data to send (or room again in a full rx ring), then read()/write() each ready fd
+// - io_uring: keeps a read in flight on every fd and a write on every fd with data to send,
+//   straight from/to the rings (registered fixed buffers), all submitted and reaped with a
+//   single io_uring_enter per loop. Used if requested and the kernel supports it.
+// Each fd has its own rx and tx ring: the I/O thread is the rx producer and the tx consumer,
+// fdRead/fdWrite callers the other side, so no lock is needed to move data.
 typedef struct fd_s {
 	int type;
-	struct epoll_event event;
-	int pos;
-	uint8_t *rx_buffer;
-	int rx_buffer_len;
-	uint8_t *tx_buffer;
-	int tx_buffer_len;
+	struct epoll_event event;	// event.data.ptr is this fd_t
+	int id;			// fds[] index
+	int fd;
+	uint8_t pollable;	// not a regular file (epoll: registered, io_uring: read always in flight)
+	uint8_t eof;		// hang up or end of file, only probed every FD_POLL_MS until the peer is back
+	uint8_t rx_busy;	// read in flight (io_uring)
+	volatile uint8_t tx_busy;	// thread will come back to tx, no wake up needed (EPOLLOUT armed or write in flight)
+	volatile uint8_t rx_paused;	// rx ring was full, not read until fdRead makes room
+	volatile uint8_t closing;	// fdClose waiting for the I/O thread to drop it
+	cbuffer_t rx;
+	cbuffer_t tx;
 } fd_t;
 
+typedef struct fd_stats_s {
+	uint32_t loops;		// I/O thread wake ups
+	uint32_t syscalls;	// I/O thread syscalls
+	uint32_t events;	// reads and writes moving data
+	uint64_t rx_bytes;
+	uint64_t tx_bytes;
+} fd_stats_t;
+
 typedef void (*fptr_alarm_t)(int fdid);
 
 extern const char *fd_pty_filename;
 extern int fd_idx;
+extern int fd_backend;	// requested before initFdThread, in use after it
+extern volatile fd_stats_t fd_stats;
 extern fptr_alarm_t rBufferFullHandler;
 extern fptr_alarm_t wBufferFullHandler;
 
@@ -39,7 +69,8 @@ int fdCreateSocket(const char *fname);
 int fdOpen(const char *fname, uint8_t type);
 int fdGet(int fdid);
 int fdAvailable(int fdid);
-int fdRead(int fdid, uint8_t *data);
+int fdWait(int fdid, int timeout_ms);
+int fdRead(int fdid, uint8_t *data, int len);
 int fdWrite(int fdid, uint8_t *data, int len);
 int fdClose(int fdid);
 int closeFdThread(void);
@@ -0,0 +1,39 @@
+#ifndef UTILITY_PULSETHREAD_LINUX_H
+#define UTILITY_PULSETHREAD_LINUX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <hal/arch.h>
+
+// sleep on the timerfd until this close to the next edge, then spin
+#define PULSE_SPIN_US	80
+// realtime priority of the player thread (if allowed)
+#define PULSE_RT_PRIO	80
+
+typedef struct pulse_stats_s {
+	uint32_t frames;	// frames played
+	uint32_t edges;		// slots that changed at least 1 pin
+	uint32_t late;		// frames started more than 1 slot late
+	uint32_t max_lag;	// worst edge lateness (ns)
+	uint64_t total_lag;	// sum of edges lateness (ns)
+} pulse_stats_t;
+
+extern volatile pulse_stats_t pulse_stats;
+
+int initPulseThread(void);
+uint16_t pulseNow(void);
+volatile pin_frame_t *pulseFrame(uint16_t milli);
+uint32_t pulseQueued(void);
+void pulseSingle(uint8_t pin, uint16_t width);
+void pulseStatsReset(void);
+int closePulseThread(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,42 @@
+
+#ifndef UTILITY_VCD_BOGUS_H
+#define UTILITY_VCD_BOGUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <inttypes.h> // for uint8_t
+
+	// Value Change Dump recorder (IEEE 1364 VCD, 1 bit wires, 1ns timescale)
+	// - any thread records transitions into a lock-free memory ring
+	// - vcd_flush() drains the ring to file (call it often enough, see VCD_RING_SIZE)
+	// - overruns drop the oldest transitions and are counted in vcd_lost
+#define VCD_RING_SIZE	4096	// transitions, power of 2
+#define VCD_SIGNALS_MAX	64
+
+	typedef struct vcd_change_s {
+		uint64_t time;	// ns since vcd_open()
+		uint32_t seq;	// ring sequence number + 1, written last (0: slot not ready)
+		uint8_t signal;
+		uint8_t value;
+	} vcd_change_t;
+
+	// file to dump to (NULL: don't record)
+	extern const char *vcd_filename;
+	// stats
+	extern volatile uint32_t vcd_changes;
+	extern volatile uint32_t vcd_lost;
+
+	int vcd_open(const char *fname, const char *scope, uint8_t signals, const char **names, const uint8_t *values);
+	uint8_t vcd_is_open(void);
+	void vcd_record(uint8_t signal, uint8_t value);
+	uint32_t vcd_flush(void);
+	void vcd_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
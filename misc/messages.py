@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+# Generate the message encoders and the host dictionary from the message
+# schema (see src/hal/common/messages.txt for the format).
+import json
+import re
+import sys
+import zlib
+
+SCHEMA="src/hal/common/messages.txt"
+PROTOCOL_H="include/hal/common/protocol.h"
+DEST_H="include/hal/common/messages.h"
+DEST_C="src/hal/common/messages.c"
+DEST_JSON="src/klippy/messages.json"
+HEADER="// Generated by misc/messages.py from "+SCHEMA+" - do not edit\n"
+
+# format: (C arguments, max encoded size, encoder lines)
+# - 'N' is the parameter name, max size None: runtime length (N_len)
+PARAM_TYPES={
+        "%c":   (("uint8_t N",), 2, ("p = vlq_encode(p, N);",)),
+        "%hu":  (("uint16_t N",), 3, ("p = vlq_encode(p, N);",)),
+        "%hi":  (("int16_t N",), 3, ("p = vlq_encode(p, N);",)),
+        "%u":   (("uint32_t N",), 5, ("p = vlq_encode(p, N);",)),
+        "%i":   (("int32_t N",), 5, ("p = vlq_encode(p, N);",)),
+        "%*s":  (("uint8_t N_len", "const uint8_t *N"), None,
+                 ("*p++ = N_len;",
+                  "memcpy(p, N, N_len);",
+                  "p += N_len;")),
+        "%.*s": (("uint8_t N_len", "const uint8_t *N"), None,
+                 ("*p++ = N_len;",
+                  "for (uint_fast8_t i=0; i<N_len; i++)",
+                  "    *p++ = READP(N[i]);")),
+        "%*u":  (("uint8_t N_len", "const uint32_t *N"), None,
+                 ("*p++ = N_len;",
+                  "p = vlq_encode_n(p, N, N_len);")),
+        }
+# runtime size of the variable length ones
+PARAM_LEN={ "%*s": "1 + N_len", "%.*s": "1 + N_len", "%*u": "1 + 5*N_len" }
+
+def fail(msg):
+    sys.exit("messages.py: "+msg)
+
+def read_type_ids():
+    ids={}
+    with open(PROTOCOL_H) as f:
+        for line in f:
+            m=re.match(r"#define\s+(TYPE_\w+)\s+(\d+)", line)
+            if m:
+                ids[m.group(1)]=int(m.group(2))
+    return ids
+
+def read_schema(ids):
+    msgs=[]
+    with open(SCHEMA) as f:
+        for nr, line in enumerate(f, 1):
+            line=line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            kind, typ, fmt=(line.split(None, 2)+[''])[:3]
+            if kind not in ("block", "response"):
+                fail("%s:%d: unknown kind '%s'" % (SCHEMA, nr, kind))
+            if typ not in ids:
+                fail("%s:%d: %s not in %s" % (SCHEMA, nr, typ, PROTOCOL_H))
+            params=[]
+            for p in fmt.split()[1:]:
+                name, _, ptype=p.partition('=')
+                if ptype not in PARAM_TYPES:
+                    fail("%s:%d: bad parameter '%s'" % (SCHEMA, nr, p))
+                params.append((name, ptype))
+            if kind == "block" and params:
+                fail("%s:%d: blocks have no parameters" % (SCHEMA, nr))
+            msgs.append((kind, typ, ' '.join(fmt.split()), params))
+    return msgs
+
+def func_name(typ):
+    return "send_"+typ[len("TYPE_"):].lower()
+
+def prototype(typ, params):
+    args=[a.replace('N', name) for name, ptype in params
+          for a in PARAM_TYPES[ptype][0]]
+    return "void %s(%s)" % (func_name(typ), ', '.join(args) or "void")
+
+def encoder(kind, typ, fmt, params):
+    out=["// "+fmt, prototype(typ, params)+" {"]
+    if kind == "block":
+        out+=["    uint8_t *buf = tx_buffer_alloc(0);",
+              "    if (buf)",
+              "        tx_buffer_trigger(buf, 0);", "}"]
+        return out
+    size=1+sum(PARAM_TYPES[t][1] or 0 for n, t in params)
+    var=[PARAM_LEN[t].replace('N', n) for n, t in params if t in PARAM_LEN]
+    if var:
+        out+=["    uint_fast16_t len = %s;" % ' + '.join([str(size)]+var),
+              "    if (len > MSG_PAYLOAD_MAX_SIZE)",
+              "        return;",
+              "    uint8_t *buf = tx_buffer_alloc(len);"]
+    else:
+        out+=["    uint8_t *buf = tx_buffer_alloc(%d);" % size]
+    out+=["    if (!buf)",
+          "        return;",
+          "    uint8_t *p = &buf[MSG_POS_PAYLOAD];",
+          "    *p++ = %s;" % typ]
+    for name, ptype in params:
+        out+=["    "+l.replace('N', name) for l in PARAM_TYPES[ptype][2]]
+    out+=["    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);", "}"]
+    return out
+
+def dictionary(ids, msgs):
+    return {
+        "blocks": { fmt: ids[typ] for kind, typ, fmt, p in msgs
+                    if kind == "block" },
+        "responses": { fmt: ids[typ] for kind, typ, fmt, p in msgs
+                       if kind == "response" },
+        }
+
+def c_bytes(data):
+    lines=[]
+    for i in range(0, len(data), 12):
+        lines.append("    "+' '.join("0x%02x," % b for b in data[i:i+12]))
+    return lines
+
+def main():
+    ids=read_type_ids()
+    msgs=read_schema(ids)
+    d=json.dumps(dictionary(ids, msgs), sort_keys=True, separators=(',', ':'))
+    identify=zlib.compress(d.encode(), 9)
+
+    print("- Composing "+DEST_H)
+    h=[HEADER, "#ifndef __MESSAGES_H", "#define __MESSAGES_H", "",
+       "#include <stdint.h> // uint8_t", "",
+       "// Encoders of the messages to the host: each one vlq encodes its",
+       "// arguments straight into the transmit buffer (see tx_buffer_alloc())"]
+    h+=[prototype(typ, params)+";" for kind, typ, fmt, params in msgs]
+    h+=["", "// zlib compressed host dictionary (see command_identify())",
+        "extern const uint8_t command_identify_data[];",
+        "extern const uint32_t command_identify_size;",
+        "", "#endif // messages.h"]
+    with open(DEST_H, 'w') as f:
+        f.write('\n'.join(h)+'\n')
+
+    print("- Composing "+DEST_C)
+    c=[HEADER, "#include <string.h> // memcpy", "",
+       '#include "messages.h"', "",
+       '#include "sched.h" // vlq_encode',
+       '#include "rxtx_irq.h" // tx_buffer_alloc']
+    for m in msgs:
+        c+=[""]+encoder(*m)
+    c+=["", "const uint8_t command_identify_data[] PROGMEM = {"]
+    c+=c_bytes(identify)
+    c+=["};", "",
+        "const uint32_t command_identify_size = sizeof(command_identify_data);"]
+    with open(DEST_C, 'w') as f:
+        f.write('\n'.join(c)+'\n')
+
+    print("- Composing "+DEST_JSON)
+    with open(DEST_JSON, 'w') as f:
+        json.dump(dictionary(ids, msgs), f, sort_keys=True, indent=4)
+        f.write('\n')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,793 @@
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <pty.h>
+#include <termios.h>
+#include <time.h>
+#include <libknp.h>
+#include <hal/arch.h>
+#include <utility/cbuffer.h>
+#include <utility/pulsethread.linux.h>
+#include <utility/fdthread.linux.h>
+#include "klippy.old/chelper/vlq.h"
+#include "hal/common/cobs.h"
+#include "hal/common/crc16.h"
+
+// Micro benchmarks, run on the host (make bench).
+// Usage: bench [section ...], no section runs them all.
+
+typedef struct bench_s {
+	const char *name;
+	const char *help;
+	void (*run)(void);
+} bench_t;
+
+static uint64_t bench_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// PULSING ----------------------------------------------------------------------------------
+//
+// Queue BENCH_PULSE_FRAMES frames toggling bit 0 every 'period' slots and let the player run them.
+// No pin is mapped: this measures the engine (timing and dispatch), not the pin output cost.
+// Max sustained rate is the fastest period played with no edge lost and edges lagging less than
+// 1 slot on average (late frames and max lag depend on the host scheduler).
+
+#define BENCH_PULSE_FRAMES	200
+#define BENCH_PULSE_LEAD	20	// ms between queueing and first frame
+
+static void bench_pulse(void) {
+	const uint8_t periods[] = {64, 32, 16, 8, 4, 2, 1};
+	uint32_t best = 0;
+	arch_init();
+	printf("%10s %12s %10s %8s %12s %12s\n", "period(us)", "edges/s", "played", "late", "avg lag(us)", "max lag(us)");
+	for (uint8_t p = 0; p < sizeof(periods); p++) {
+		uint8_t period = periods[p];
+		uint8_t level = 0;
+		uint16_t start = pin_pulse_now() + BENCH_PULSE_LEAD;
+		uint32_t expected = 0;
+		pulseStatsReset();
+		for (uint16_t i = 0; i < BENCH_PULSE_FRAMES; i++) {
+			volatile pin_frame_t *f = pin_pulse_multi(start + i);
+			if (!f) {
+				printf("out of memory\n");
+				arch_reset();
+				return;
+			}
+			for (uint16_t s = 0; s < PULSE_SLOTS; s++) {
+				if ((s % period) == 0) {
+					level ^= 1;
+					expected++;
+				}
+				f->pulse[s] = level;
+			}
+		}
+		while (pulseQueued()) usleep(1000);
+		uint32_t rate = (1000000 / PULSE_SLOT_US) / period;
+		double avg = pulse_stats.edges ? (double)pulse_stats.total_lag / pulse_stats.edges / 1000.0 : 0;
+		printf("%10d %12u %10u %8u %12.2f %12.1f\n", period * PULSE_SLOT_US, rate,
+			pulse_stats.edges, pulse_stats.late, avg, pulse_stats.max_lag / 1000.0);
+		if ((pulse_stats.edges == expected) && (avg < PULSE_SLOT_US))
+			best = rate;
+	}
+	printf("max sustained rate: %u edges/s\n", best);
+	arch_reset();
+}
+
+
+// RING BUFFER ------------------------------------------------------------------------------
+//
+// Move BENCH_RING_BYTES through a BENCH_RING_SIZE ring in chunks of growing size:
+// - byte: the previous cbuffer loop (uint16 indices, modulo wrap, 1 byte per iteration)
+// - bulk: cbuf_push/cbuf_pop
+// - spsc: producer thread pushing, consumer thread popping (bulk) or parsing in place
+//   (peek/commit), every byte checked
+
+#define BENCH_RING_SIZE		4096
+#define BENCH_RING_BYTES	(16UL * 1024 * 1024)
+
+typedef struct byte_ring_s {
+	uint8_t *data;
+	uint16_t head;
+	uint16_t tail;
+	uint16_t len;
+} byte_ring_t;
+
+static uint16_t byte_push(volatile byte_ring_t *buf, const uint8_t *data, uint16_t len) {
+	for (uint16_t i = 0; i < len; i++) {
+		uint16_t next = buf->head + 1;
+		if (next >= buf->len) next = 0;
+		if (next == buf->tail) return i;
+		buf->data[buf->head] = data[i];
+		buf->head = next;
+	}
+	return len;
+}
+
+static uint16_t byte_pop(volatile byte_ring_t *buf, uint8_t *data, uint16_t len) {
+	for (uint16_t i = 0; i < len; i++) {
+		if (buf->head == buf->tail) return i;
+		uint16_t next = buf->tail + 1;
+		if (next >= buf->len) next = 0;
+		data[i] = buf->data[buf->tail];
+		buf->tail = next;
+	}
+	return len;
+}
+
+static double bench_mbs(uint64_t bytes, uint64_t ns) {
+	return ns ? (double)bytes * 1000.0 / ns : 0;
+}
+
+// one column of a result row, "n/a" for a variant not built in or not supported by the cpu
+static void bench_col(int width, double v, uint8_t ran) {
+	if (ran) printf(" %*.1f", width, v);
+	else printf(" %*s", width, "n/a");
+}
+
+typedef struct ring_job_s {
+	cbuffer_t ring;
+	uint32_t chunk;
+	uint8_t peek;
+	uint64_t errors;
+} ring_job_t;
+
+static void *ring_producer(void *data) {
+	ring_job_t *job = (ring_job_t *)data;
+	uint8_t src[BENCH_RING_SIZE];
+	uint8_t seq = 0;
+	for (uint64_t sent = 0; sent < BENCH_RING_BYTES; ) {
+		uint32_t len = job->chunk;
+		if (len > BENCH_RING_BYTES - sent) len = BENCH_RING_BYTES - sent;
+		for (uint32_t i = 0; i < len; i++) src[i] = seq + i;
+		uint32_t done = 0;
+		while (done < len) {
+			uint32_t n = cbuf_push(&job->ring, src + done, len - done);
+			if (!n) sched_yield(); // full, let the consumer run (single cpu hosts)
+			done += n;
+		}
+		seq += len;
+		sent += len;
+	}
+	return NULL;
+}
+
+static void *ring_consumer(void *data) {
+	ring_job_t *job = (ring_job_t *)data;
+	uint8_t dst[BENCH_RING_SIZE];
+	uint8_t seq = 0;
+	for (uint64_t received = 0; received < BENCH_RING_BYTES; ) {
+		uint8_t *p = dst;
+		uint32_t len;
+		if (job->peek) len = cbuf_peek(&job->ring, &p);
+		else len = cbuf_pop(&job->ring, dst, job->chunk);
+		for (uint32_t i = 0; i < len; i++, seq++)
+			if (p[i] != seq) job->errors++;
+		if (job->peek) cbuf_commit(&job->ring, len);
+		if (!len) sched_yield(); // empty, let the producer run
+		received += len;
+	}
+	return NULL;
+}
+
+static void bench_ring(void) {
+	const uint32_t chunks[] = {1, 8, 64, 512};
+	uint8_t src[BENCH_RING_SIZE], dst[BENCH_RING_SIZE];
+	uint8_t store[BENCH_RING_SIZE];
+	volatile byte_ring_t old = { .data = store, .head = 0, .tail = 0, .len = BENCH_RING_SIZE };
+	ring_job_t job;
+	memset(src, 0x55, sizeof(src));
+	if (cbuf_init(&job.ring, BENCH_RING_SIZE)) {
+		printf("out of memory\n");
+		return;
+	}
+	printf("%8s %12s %12s %12s %12s %8s\n", "chunk", "byte(MB/s)", "bulk(MB/s)", "spsc(MB/s)", "peek(MB/s)", "errors");
+	for (uint8_t c = 0; c < sizeof(chunks)/sizeof(uint32_t); c++) {
+		uint32_t chunk = chunks[c];
+		double mbs[4];
+		// single thread, push a chunk then pop it back
+		uint64_t t = bench_ns();
+		for (uint64_t n = 0; n < BENCH_RING_BYTES; n += chunk) {
+			byte_push(&old, src, chunk);
+			byte_pop(&old, dst, chunk);
+		}
+		mbs[0] = bench_mbs(BENCH_RING_BYTES, bench_ns() - t);
+		t = bench_ns();
+		for (uint64_t n = 0; n < BENCH_RING_BYTES; n += chunk) {
+			cbuf_push(&job.ring, src, chunk);
+			cbuf_pop(&job.ring, dst, chunk);
+		}
+		mbs[1] = bench_mbs(BENCH_RING_BYTES, bench_ns() - t);
+		// producer and consumer threads
+		job.errors = 0;
+		for (uint8_t peek = 0; peek < 2; peek++) {
+			pthread_t prod, cons;
+			cbuf_reset(&job.ring);
+			job.chunk = chunk;
+			job.peek = peek;
+			t = bench_ns();
+			pthread_create(&cons, NULL, ring_consumer, &job);
+			pthread_create(&prod, NULL, ring_producer, &job);
+			pthread_join(prod, NULL);
+			pthread_join(cons, NULL);
+			mbs[2 + peek] = bench_mbs(BENCH_RING_BYTES, bench_ns() - t);
+		}
+		printf("%8u %12.1f %12.1f %12.1f %12.1f %8lu\n", chunk, mbs[0], mbs[1], mbs[2], mbs[3],
+			(unsigned long)job.errors);
+	}
+	cbuf_release(&job.ring);
+}
+
+
+// FD THREAD --------------------------------------------------------------------------------
+//
+// Echo BENCH_FD_MSG bytes messages over 'channels' raw ptys for BENCH_FD_MS with each I/O
+// thread backend: the bench writes to the pty master, the I/O thread reads the slave into
+// the rx ring, the bench pops it and pushes it back to the tx ring, the I/O thread writes it
+// to the slave, the bench reads it back from the master.
+// Syscalls are the I/O thread ones, an event is a read or write moving data.
+
+#define BENCH_FD_MSG		64
+#define BENCH_FD_MS			500
+#define BENCH_FD_CHANNELS	8
+
+static void bench_fd_full(int fdid) {
+	fdid = fdid; // echo faster than the pty drains: dropping is expected
+}
+
+static void bench_fd_run(int backend, uint8_t channels) {
+	int master[BENCH_FD_CHANNELS], id[BENCH_FD_CHANNELS];
+	uint8_t msg[BENCH_FD_MSG], buf[FD_RING_SIZE];
+	uint64_t echoed = 0;
+	memset(msg, 0x55, sizeof(msg));
+	fd_backend = backend;
+	if (initFdThread() < 0) {
+		printf("can't init fdthread\n");
+		return;
+	}
+	if (fd_backend != backend) {
+		printf("%8s %8u   not available\n", "io_uring", channels);
+		closeFdThread();
+		return;
+	}
+	for (uint8_t c = 0; c < channels; c++) {
+		int sfd;
+		struct termios ti;
+		if (openpty(&master[c], &sfd, NULL, NULL, NULL) < 0) {
+			printf("can't open pty\n");
+			closeFdThread();
+			return;
+		}
+		tcgetattr(sfd, &ti);
+		cfmakeraw(&ti);
+		tcsetattr(sfd, TCSANOW, &ti);
+		fcntl(master[c], F_SETFL, fcntl(master[c], F_GETFL) | O_NONBLOCK);
+		id[c] = fdOpen(ttyname(sfd), FD_TYPE_PTY);
+		close(sfd);
+	}
+	uint64_t start = bench_ns();
+	while (bench_ns() - start < BENCH_FD_MS * 1000000ULL) {
+		uint8_t moved = 0;
+		for (uint8_t c = 0; c < channels; c++) {
+			if (write(master[c], msg, sizeof(msg)) > 0) moved = 1;
+			int n = fdRead(id[c], buf, sizeof(buf));
+			if (n > 0) {
+				fdWrite(id[c], buf, n);
+				moved = 1;
+			}
+			ssize_t r = read(master[c], buf, sizeof(buf));
+			if (r > 0) {
+				echoed += r;
+				moved = 1;
+			}
+		}
+		if (!moved) sched_yield(); // let the I/O thread run (single cpu hosts)
+	}
+	uint64_t ns = bench_ns() - start;
+	closeFdThread();
+	for (uint8_t c = 0; c < channels; c++) close(master[c]);
+	double msgs = (double)echoed / BENCH_FD_MSG;
+	printf("%8s %8u %12.0f %10.1f %10.2f %10.2f\n", backend == FD_BACKEND_URING ? "io_uring" : "epoll",
+		channels, msgs * 1e9 / ns, bench_mbs(echoed, ns),
+		fd_stats.events ? (double)fd_stats.syscalls / fd_stats.events : 0,
+		msgs ? fd_stats.syscalls / msgs : 0);
+}
+
+static void bench_fd(void) {
+	const uint8_t channels[] = {1, 4, BENCH_FD_CHANNELS};
+	wBufferFullHandler = bench_fd_full;
+	printf("%8s %8s %12s %10s %10s %10s\n", "backend", "channels", "msgs/s", "MB/s", "sys/event", "sys/msg");
+	for (uint8_t c = 0; c < sizeof(channels); c++) {
+		bench_fd_run(FD_BACKEND_EPOLL, channels[c]);
+		bench_fd_run(FD_BACKEND_URING, channels[c]);
+	}
+	fd_backend = FD_BACKEND_EPOLL;
+	wBufferFullHandler = NULL;
+}
+
+
+// VLQ --------------------------------------------------------------------------------------
+//
+// Encode and decode BENCH_VLQ_INTS integers shaped like the mcu command traffic (same seed,
+// same streams every run), one integer at a time (encode_int/decode_int) vs batched
+// (encode_ints/decode_ints, the host serialqueue ones):
+// - steps: queue_step messages, id, oid, interval, count, add (mostly 1-3 bytes)
+// - small: ids, oids and pin values (all 1 byte)
+// - clocks: schedule messages, id, oid, absolute clock (mostly 5 bytes)
+
+#define BENCH_VLQ_INTS	(1UL << 20)
+#define BENCH_VLQ_LOOPS	16
+
+static uint32_t vlq_rand(uint32_t *seed) {
+	*seed = *seed * 1103515245 + 12345;
+	return *seed >> 8;
+}
+
+static void vlq_stream(uint8_t kind, uint32_t *v) {
+	uint32_t seed = 1;
+	for (uint32_t i = 0; i < BENCH_VLQ_INTS; i++) {
+		switch (kind) {
+		case 0: {
+			const uint32_t field = i % 5;
+			if (field == 0) v[i] = 30;							// queue_step id
+			else if (field == 1) v[i] = vlq_rand(&seed) % 8;	// oid
+			else if (field == 2) v[i] = 200 + vlq_rand(&seed) % 20000;
+			else if (field == 3) v[i] = 1 + vlq_rand(&seed) % 200;
+			else v[i] = (int32_t)(vlq_rand(&seed) % 101) - 50;
+			break;
+		}
+		case 1:
+			v[i] = vlq_rand(&seed) % 90;
+			break;
+		default:
+			v[i] = (i % 3 == 2) ? vlq_rand(&seed) << 8 : vlq_rand(&seed) % 40;
+			break;
+		}
+	}
+}
+
+static void bench_vlq(void) {
+	const char *names[] = {"steps", "small", "clocks"};
+	uint32_t *v = malloc(BENCH_VLQ_INTS * sizeof(uint32_t));
+	uint32_t *out = malloc(BENCH_VLQ_INTS * sizeof(uint32_t));
+	uint8_t *buf = malloc(BENCH_VLQ_INTS * 5);
+	if (!v || !out || !buf) {
+		printf("out of memory\n");
+		goto done;
+	}
+	printf("%8s %10s %14s %14s %14s %14s %8s\n", "stream", "bytes/int", "enc(Mint/s)",
+		"enc_n(Mint/s)", "dec(Mint/s)", "dec_n(Mint/s)", "errors");
+	for (uint8_t k = 0; k < sizeof(names)/sizeof(names[0]); k++) {
+		double mis[4];
+		uint64_t ints = (uint64_t)BENCH_VLQ_INTS * BENCH_VLQ_LOOPS;
+		uint8_t *p = buf;
+		vlq_stream(k, v);
+		uint64_t t = bench_ns();
+		for (uint8_t l = 0; l < BENCH_VLQ_LOOPS; l++) {
+			p = buf;
+			for (uint32_t i = 0; i < BENCH_VLQ_INTS; i++)
+				p = encode_int(p, v[i]);
+		}
+		mis[0] = bench_mbs(ints, bench_ns() - t);
+		t = bench_ns();
+		for (uint8_t l = 0; l < BENCH_VLQ_LOOPS; l++)
+			p = encode_ints(buf, v, BENCH_VLQ_INTS);
+		mis[1] = bench_mbs(ints, bench_ns() - t);
+		uint32_t len = p - buf, errors = 0;
+		t = bench_ns();
+		for (uint8_t l = 0; l < BENCH_VLQ_LOOPS; l++) {
+			const uint8_t *q = buf;
+			for (uint32_t i = 0; i < BENCH_VLQ_INTS; i++)
+				decode_int(&q, buf + len, &out[i]);
+		}
+		mis[2] = bench_mbs(ints, bench_ns() - t);
+		for (uint32_t i = 0; i < BENCH_VLQ_INTS; i++)
+			if (out[i] != v[i]) errors++;
+		memset(out, 0, BENCH_VLQ_INTS * sizeof(uint32_t));
+		int n = 0;
+		t = bench_ns();
+		for (uint8_t l = 0; l < BENCH_VLQ_LOOPS; l++)
+			n = decode_ints(buf, len, out, BENCH_VLQ_INTS);
+		mis[3] = bench_mbs(ints, bench_ns() - t);
+		if (n != (int)BENCH_VLQ_INTS) errors++;
+		for (uint32_t i = 0; i < BENCH_VLQ_INTS; i++)
+			if (out[i] != v[i]) errors++;
+		printf("%8s %10.2f %14.1f %14.1f %14.1f %14.1f %8u\n", names[k], (double)len / BENCH_VLQ_INTS,
+			mis[0], mis[1], mis[2], mis[3], errors);
+	}
+	// too long (continuation bits all along) and truncated values are rejected, on both paths
+	uint32_t errors = 0;
+	memset(buf, 0xff, 20);
+	for (uint8_t len = 1; len <= 20; len++) {
+		const uint8_t *q = buf;
+		if (decode_ints(buf, len, out, BENCH_VLQ_INTS) != -1) errors++;
+		if (decode_int(&q, buf + len, out) != -1) errors++;
+	}
+	// largest and smallest values fit in VLQ_MAX_BYTES, the 1 and 2 byte bounds too
+	const uint32_t edges[] = {0x7fffffff, 0x80000000, 0xffffffff, 0, 95, 96, -32, -33,
+		12287, 12288, -4096, -4097};
+	uint8_t n = sizeof(edges) / sizeof(edges[0]);
+	uint8_t *p = encode_ints(buf, edges, n);
+	if (decode_ints(buf, p - buf, out, n) != n) errors++;
+	for (uint8_t i = 0; i < n; i++)
+		if (out[i] != edges[i]) errors++;
+	if (encode_int(buf, 95) - buf != 1 || encode_int(buf, -32) - buf != 1 ||
+		encode_ints(buf, &edges[7], 1) - buf != 2 || encode_ints(buf, &edges[10], 1) - buf != 2) errors++;
+	printf("malformed and edge values: %u errors\n", errors);
+done:
+	free(v);
+	free(out);
+	free(buf);
+}
+
+
+// COBS -------------------------------------------------------------------------------------
+//
+// Check the hal/common/cobs.h codec against the test vectors (raw block, with its code and
+// sync slots, and encoded block), then time the sync byte search of each variant and the
+// block encode/decode over BENCH_COBS_BLOCKS blocks of MSG_MAX bytes, with no sync bytes in
+// the data, 1 in 64 and 1 in 8 (the rx side scans the same way for the block ends).
+
+#define BENCH_COBS_BLOCKS	4096
+#define BENCH_COBS_LOOPS	64
+
+typedef struct cobs_vector_s {
+	uint8_t len;
+	uint8_t raw[8];
+	uint8_t enc[8];
+} cobs_vector_t;
+
+static const cobs_vector_t cobs_vectors[] = {
+	{2, {0x00, 0x00}, {0x7f, 0x7e}},
+	{6, {0x00, 0x11, 0x22, 0x33, 0x44, 0x00}, {0x7b, 0x11, 0x22, 0x33, 0x44, 0x7e}},
+	{4, {0x00, 0x7e, 0x7e, 0x00}, {0x7f, 0x7f, 0x7f, 0x7e}},
+	{5, {0x00, 0x11, 0x7e, 0x22, 0x00}, {0x7c, 0x11, 0x7c, 0x22, 0x7e}},
+	{6, {0x00, 0x7d, 0x7f, 0x7e, 0xff, 0x00}, {0x7d, 0x7d, 0x7f, 0x7c, 0xff, 0x7e}},
+};
+
+// Encode/decode a vector and blocks whose code is 126 (stored as 0x00) and 255 (the longest)
+static uint32_t cobs_check(void) {
+	uint8_t buf[MSG_MAX];
+	uint32_t errors = 0;
+	for (uint8_t i = 0; i < sizeof(cobs_vectors)/sizeof(cobs_vectors[0]); i++) {
+		const cobs_vector_t *v = &cobs_vectors[i];
+		memcpy(buf, v->raw, v->len);
+		cobs_encode(buf, v->len);
+		if (memcmp(buf, v->enc, v->len)) errors++;
+		if (cobs_decode(buf, v->len) || memcmp(&buf[1], &v->raw[1], v->len - 2)) errors++;
+	}
+	const uint16_t lens[] = {127, MSG_MAX};
+	for (uint8_t i = 0; i < 2; i++) {
+		memset(buf, 0x01, lens[i]);
+		cobs_encode(buf, lens[i]);
+		if (buf[0] != (uint8_t)((lens[i] - 1) ^ MSG_SYNC) || buf[lens[i] - 1] != MSG_SYNC) errors++;
+		if (cobs_decode(buf, lens[i])) errors++;
+	}
+	buf[0] = 3 ^ MSG_SYNC; // code past the sync byte
+	buf[1] = MSG_SYNC;
+	if (!cobs_decode(buf, 2)) errors++;
+	return errors;
+}
+
+typedef uint8_t *(*cobs_find_t)(uint8_t *p, uint8_t *end);
+
+static void bench_cobs(void) {
+	const cobs_find_t finds[] = {
+		cobs_find_sync_scalar, cobs_find_sync_swar,
+#if defined(__SSE2__)
+		cobs_find_sync_sse2,
+#else
+		NULL,
+#endif
+#if defined(__AVX2__)
+		cobs_find_sync_avx2,
+#else
+		NULL,
+#endif
+	};
+	const uint8_t every[] = {0, 64, 8};
+	uint32_t size = BENCH_COBS_BLOCKS * MSG_MAX;
+	uint8_t *raw = malloc(size), *buf = malloc(size);
+	if (!raw || !buf) {
+		printf("out of memory\n");
+		goto done;
+	}
+	printf("test vectors: %u errors\n", cobs_check());
+	printf("%8s %12s %12s %12s %12s %14s %8s\n", "syncs", "scalar(MB/s)", "swar(MB/s)",
+		"sse2(MB/s)", "avx2(MB/s)", "enc+dec(MB/s)", "errors");
+	for (uint8_t k = 0; k < sizeof(every); k++) {
+		uint32_t seed = 1, errors = 0, syncs = 0;
+		for (uint32_t i = 0; i < size; i++) {
+			raw[i] = vlq_rand(&seed);
+			if (raw[i] == MSG_SYNC) raw[i] = 0;
+			if (every[k] && vlq_rand(&seed) % every[k] == 0) raw[i] = MSG_SYNC;
+			if (raw[i] == MSG_SYNC) syncs++;
+		}
+		double mbs[5] = {0};
+		uint64_t bytes = (uint64_t)size * BENCH_COBS_LOOPS;
+		for (uint8_t f = 0; f < 4; f++) {
+			if (!finds[f])
+				continue;
+			uint32_t found = 0;
+			uint64_t t = bench_ns();
+			for (uint8_t l = 0; l < BENCH_COBS_LOOPS; l++) {
+				uint8_t *p = raw, *end = raw + size;
+				found = 0;
+				while ((p = finds[f](p, end)) < end) {
+					found++;
+					p++;
+				}
+			}
+			mbs[f] = bench_mbs(bytes, bench_ns() - t);
+			if (found != syncs) errors++;
+		}
+		uint64_t t = bench_ns();
+		for (uint8_t l = 0; l < BENCH_COBS_LOOPS; l++) {
+			memcpy(buf, raw, size);
+			for (uint32_t b = 0; b < size; b += MSG_MAX) {
+				buf[b] = 0;
+				cobs_encode(&buf[b], MSG_MAX);
+				if (cobs_decode(&buf[b], MSG_MAX)) errors++;
+			}
+		}
+		mbs[4] = bench_mbs(bytes, bench_ns() - t);
+		for (uint32_t b = 0; b < size; b += MSG_MAX)
+			if (memcmp(&buf[b + 1], &raw[b + 1], MSG_MAX - 2)) errors++;
+		char label[16];
+		snprintf(label, sizeof(label), every[k] ? "1/%u" : "none", every[k]);
+		printf("%8s", label);
+		for (uint8_t f = 0; f < 4; f++)
+			bench_col(12, mbs[f], finds[f] != NULL);
+		printf(" %14.1f %8u\n", mbs[4], errors);
+	}
+done:
+	free(raw);
+	free(buf);
+}
+
+
+// CRC16 ------------------------------------------------------------------------------------
+//
+// crc16_ccitt of BENCH_CRC_MSGS messages of 5 to 64 bytes (the block sizes of the mcu link),
+// shifts (avr, small MCUs) vs table (MCUs with flash to spare, ARM hosts) vs clmul (x86
+// hosts), in ns per message. Every crc is checked against the shift one.
+
+#define BENCH_CRC_MSGS	(1UL << 20)
+
+typedef uint16_t (*crc16_t)(const uint8_t *buf, uint_fast16_t len);
+
+static void bench_crc(void) {
+	const uint8_t sizes[] = {5, 8, 16, 32, 64};
+	const crc16_t crcs[] = {
+		crc16_ccitt_shift, crc16_ccitt_table,
+#if defined(CRC16_HAVE_CLMUL)
+		__builtin_cpu_supports("pclmul") ? crc16_ccitt_clmul : NULL,
+#else
+		NULL,
+#endif
+	};
+	uint8_t *buf = malloc(64 * 1024);
+	if (!buf) {
+		printf("out of memory\n");
+		return;
+	}
+	uint32_t seed = 1;
+	for (uint32_t i = 0; i < 64 * 1024; i++)
+		buf[i] = vlq_rand(&seed);
+	printf("%8s %14s %14s %14s %8s\n", "bytes", "shift(ns/msg)", "table(ns/msg)", "clmul(ns/msg)",
+		"errors");
+	for (uint8_t k = 0; k < sizeof(sizes); k++) {
+		double ns[3] = {0};
+		uint32_t errors = 0;
+		for (uint8_t c = 0; c < 3; c++) {
+			if (!crcs[c])
+				continue;
+			volatile uint16_t sink = 0;
+			uint64_t t = bench_ns();
+			for (uint32_t m = 0; m < BENCH_CRC_MSGS; m++)
+				sink ^= crcs[c](&buf[(m * 61) & 0xff00], sizes[k]);
+			ns[c] = (double)(bench_ns() - t) / BENCH_CRC_MSGS;
+			for (uint32_t m = 0; m < 256; m++)
+				if (crcs[c](&buf[m], sizes[k]) != crc16_ccitt_shift(&buf[m], sizes[k])) errors++;
+		}
+		printf("%8u", sizes[k]);
+		for (uint8_t c = 0; c < 3; c++)
+			bench_col(14, ns[c], crcs[c] != NULL);
+		printf(" %8u\n", errors);
+	}
+	free(buf);
+}
+
+
+// RELAY ------------------------------------------------------------------------------------
+//
+// Self checks of the multi-MCU relay, no timing: a relay of the largest event (RELAY_EVENT_MAX
+// bytes) is encoded, must fit PROTOCOL_MAX_EVENT_BYTES and decode back bit exact, a larger one
+// must be refused. Then a host (node 0) and two MCUs (nodes 1 and 2) are chained through memory
+// ports, each node running in turn with its own id, routes and ports: the host relays a route
+// add to node 2 through node 1, node 2 runs it and answers, the answer must come back to the
+// host through node 1 on the route learned on the way out.
+
+#define BENCH_RELAY_WIRE	256
+
+typedef struct bench_wire_s {
+	uint8_t buf[BENCH_RELAY_WIRE];
+	uint16_t head, tail;
+} bench_wire_t;
+
+// node 0: host, 1: first MCU, 2: last MCU; wires[2*i]: i -> i+1, wires[2*i+1]: i+1 -> i
+static bench_wire_t bench_wires[4];
+
+typedef struct bench_node_s {
+	uint8_t id;
+	commport_t up, down; // port id: index of the wire it reads, the one it writes follows
+	route_t routes[RELAY_ROUTES_MAX];
+	uint8_t routesNo;
+} bench_node_t;
+
+static uint8_t bench_wire_available(commport_t *cp) {
+	bench_wire_t *w = &bench_wires[cp->id];
+	return w->head != w->tail;
+}
+
+static uint8_t bench_wire_read(commport_t *cp, uint8_t *data, uint8_t count, uint16_t timeout) {
+	bench_wire_t *w = &bench_wires[cp->id];
+	uint8_t n = 0;
+	while ((n < count) && (w->tail != w->head))
+		data[n++] = w->buf[w->tail++ % BENCH_RELAY_WIRE];
+	return n;
+}
+
+static uint8_t bench_wire_write(commport_t *cp, uint8_t *data, uint8_t count, uint16_t timeout) {
+	bench_wire_t *w = &bench_wires[cp->fd];
+	for (uint8_t i = 0; i < count; i++)
+		w->buf[w->head++ % BENCH_RELAY_WIRE] = data[i];
+	return count;
+}
+
+static void bench_port(commport_t *cp, uint8_t rx, uint8_t tx) {
+	memset(cp, 0, sizeof(*cp));
+	cp->id = rx;
+	cp->fd = tx;
+	cp->available = bench_wire_available;
+	cp->read = bench_wire_read;
+	cp->write = bench_wire_write;
+}
+
+// make 'n' the running node (libknp keeps one node per process)
+static void bench_node_enter(bench_node_t *n) {
+	nodeId = n->id;
+	memcpy(routes, n->routes, sizeof(routes));
+	routesNo = n->routesNo;
+	binConsole = n->up.read ? &n->up : NULL;
+	peering = n->down.read ? &n->down : NULL;
+}
+
+static void bench_node_leave(bench_node_t *n) {
+	memcpy(n->routes, routes, sizeof(routes));
+	n->routesNo = routesNo;
+}
+
+static void bench_node_run(bench_node_t *n) {
+	bench_node_enter(n);
+	while ((binConsole && binConsole->available(binConsole)) || (peering && peering->available(peering)))
+		getEvent();
+	bench_node_leave(n);
+}
+
+static const route_t *bench_route(bench_node_t *n, uint8_t node) {
+	for (uint8_t i = 0; i < n->routesNo; i++)
+		if (n->routes[i].node == node) return &n->routes[i];
+	return NULL;
+}
+
+// encode and decode back a relay of the largest event
+static uint32_t bench_relay_frame(void) {
+	uint8_t inner[RELAY_EVENT_MAX + 1], frame[PROTOCOL_MAX_EVENT_BYTES], size = 0;
+	uint32_t errors = 0;
+	for (uint8_t i = 0; i < sizeof(inner); i++)
+		inner[i] = 0x80 | (i * 37);
+	if (encodeSysexRelay(frame, 2, 1, RELAY_HOPS_MAX, RELAY_EVENT_MAX + 1, inner)) errors++;
+	uint8_t len = encodeSysexRelay(frame, 2, 1, RELAY_HOPS_MAX, RELAY_EVENT_MAX, inner);
+	if ((!len) || (len > PROTOCOL_MAX_EVENT_BYTES)) return errors + 1;
+	bufferReset();
+	for (uint8_t i = 0; i < len; i++) {
+		size = decodeEvent(&frame[i], 0, NULL);
+		if (size && (i != len - 1)) errors++;
+	}
+	const uint8_t head[] = {STATUS_SYSEX_START, SYSEX_MOD_ASYNC, SYSEX_RELAY_DATA,
+		SYSEX_SUB_RELAY_FORWARD, 2, 1, RELAY_HOPS_MAX};
+	if ((size != sizeof(head) + RELAY_EVENT_MAX) || memcmp(eventBuffer, head, sizeof(head)) ||
+		memcmp(&eventBuffer[sizeof(head)], inner, RELAY_EVENT_MAX))
+		errors++;
+	printf("max relay: %u event bytes in a %u bytes frame (max %u)\n", RELAY_EVENT_MAX, len,
+		PROTOCOL_MAX_EVENT_BYTES);
+	return errors;
+}
+
+static void bench_relay(void) {
+	bench_node_t nodes[3];
+	uint8_t inner[PROTOCOL_MAX_EVENT_BYTES], len;
+	encodingSwitch(PROTOCOL_ENCODING_NORMAL);
+	uint32_t errors = bench_relay_frame();
+
+	memset(nodes, 0, sizeof(nodes));
+	memset(bench_wires, 0, sizeof(bench_wires));
+	for (uint8_t i = 0; i < 3; i++) {
+		nodes[i].id = i;
+		if (i > 0) bench_port(&nodes[i].up, 2 * (i - 1), 2 * (i - 1) + 1);
+		if (i < 2) bench_port(&nodes[i].down, 2 * i + 1, 2 * i);
+	}
+	// the host has no upstream: its binary console is the port to node 1
+	nodes[0].up = nodes[0].down;
+	memset(&nodes[0].down, 0, sizeof(commport_t));
+	bufferReset();
+
+	// host -> 1 -> 2: add a route to node 5 on node 2
+	bench_node_enter(&nodes[0]);
+	len = encodeSysexRoute(inner, SYSEX_SUB_RELAY_ROUTE_ADD, 5, RELAY_PORT_UPSTREAM, 3);
+	cmdSysexRelay(2, len, inner);
+	bench_node_leave(&nodes[0]);
+	bench_node_run(&nodes[1]);
+	bench_node_run(&nodes[2]);
+	const route_t *r5 = bench_route(&nodes[2], 5), *r0 = bench_route(&nodes[2], 0);
+	if ((!r5) || (r5->hops != 3)) errors++;
+	if ((!r0) || (r0->hops != 2) || (r0->port != &nodes[2].up)) errors++;
+	if (bench_route(&nodes[1], 2) || (!bench_route(&nodes[1], 0))) errors++;
+
+	// 2 -> 1 -> host: a route reset addressed to the host, run there
+	bench_node_enter(&nodes[2]);
+	len = encodeSysexRoute(inner, SYSEX_SUB_RELAY_ROUTE_RESET, 0, 0, 0);
+	cmdSysexRelay(0, len, inner);
+	bench_node_leave(&nodes[2]);
+	bench_node_run(&nodes[1]);
+	nodes[0].routesNo = 1; // must be reset by the relayed event
+	bench_node_run(&nodes[0]);
+	if (nodes[0].routesNo != 0) errors++;
+	if ((!bench_route(&nodes[1], 2)) || (bench_route(&nodes[1], 2)->port != &nodes[1].down)) errors++;
+	for (uint8_t i = 0; i < 4; i++)
+		if (bench_wires[i].head != bench_wires[i].tail) errors++;
+	printf("host -> 1 -> 2 -> 1 -> host: %u errors, %u protocol errors\n", errors, protocolErrorNo);
+	binConsole = peering = NULL;
+}
+
+
+
+// MAIN -------------------------------------------------------------------------------------
+
+static const bench_t benches[] = {
+	{"pulse", "pin pulsing engine max sustained rate", bench_pulse},
+	{"ring", "cbuffer throughput, byte loop vs bulk and spsc threads", bench_ring},
+	{"fd", "fdthread pty echo, epoll vs io_uring throughput and syscalls", bench_fd},
+	{"vlq", "vlq integer encode/decode, one at a time vs batched (sse2)", bench_vlq},
+	{"cobs", "cobs test vectors, sync search scalar/swar/sse2/avx2 and block encode/decode", bench_cobs},
+	{"crc", "crc16_ccitt of 5-64 bytes messages, shifts vs table vs clmul", bench_crc},
+	{"relay", "relay max size frame and host -> mcu -> mcu chain self checks", bench_relay},
+};
+#define BENCHES_NO (sizeof(benches)/sizeof(bench_t))
+
+int main(int argc, const char *argv[]) {
+	if ((argc > 1) && (!strcmp(argv[1], "-h"))) {
+		printf("Usage: %s [section ...]\n", argv[0]);
+		for (uint8_t i = 0; i < BENCHES_NO; i++)
+			printf("  %-10s %s\n", benches[i].name, benches[i].help);
+		exit(0);
+	}
+	for (uint8_t i = 0; i < BENCHES_NO; i++) {
+		uint8_t run = (argc < 2);
+		for (int a = 1; a < argc; a++)
+			if (!strcmp(argv[a], benches[i].name)) run = 1;
+		if (!run) continue;
+		printf("--- %s: %s\n", benches[i].name, benches[i].help);
+		benches[i].run();
+	}
+	exit(0);
+}
+
@@ -9,7 +9,10 @@
 #include <stdio.h>
 #include <unistd.h>		// usleep
 #include <signal.h>
+#include <getopt.h>
 #include <libknp.h>
+#include <utility/fdthread.linux.h>
+#include <utility/vcd.bogus.h>
 
 volatile sig_atomic_t running = 1;
 volatile sig_atomic_t reset = 0;
@@ -20,14 +23,53 @@ void sigint(int sig){
 	reset = 1;
 }
 
+void usage(const char *name) {
+	printf("Usage: %s [-n node] [-P pty prefix] [-u] [-w file.vcd]\n", name);
+	printf("  -n node        relay node id (1-%d, default 1)\n", RELAY_NODE_MAX);
+	printf("  -P pty prefix  pty files prefix (default %s): <prefix>3 is upstream, <prefix>4 peering\n", fd_pty_filename);
+	printf("  -u             io_uring I/O thread (falls back to epoll if the kernel lacks it)\n");
+	printf("  -w file.vcd    record pins waveform to VCD file\n");
+	printf("To chain MCUs link the peering pty of one instance to the upstream pty of the next, ie:\n");
+	printf("  socat pty,link=/tmp/a4,raw pty,link=/tmp/b3,raw\n");
+}
+
 int main(int argc, const char *argv[]) {
-	// TODO parse command line args
 	printf("(exec) %s ", argv[0]);
 	for (int i=1;i<argc;i++) {
 		printf("%s ", argv[i]);
 	}
 	printf("\n");
 
+	// parse command line args
+	int opt;
+	nodeId = 1; // first MCU of the chain (libknp defaults to the host)
+	while ((opt = getopt(argc, (char * const *)argv, "n:P:uw:h")) != -1) {
+		switch (opt) {
+			case 'n': {
+				char *end;
+				long node = strtol(optarg, &end, 10);
+				if ((*end) || (node <= RELAY_NODE_HOST) || (node > RELAY_NODE_MAX)) {
+					usage(argv[0]);
+					exit(1);
+				}
+				nodeId = node;
+				break;
+			}
+			case 'P':
+				fd_pty_filename = optarg;
+				break;
+			case 'u':
+				fd_backend = FD_BACKEND_URING;
+				break;
+			case 'w':
+				vcd_filename = optarg;
+				break;
+			default:
+				usage(argv[0]);
+				exit(opt == 'h' ? 0 : 1);
+		}
+	}
+
 	// intercept SIGINT
 	signal(SIGINT, sigint);
 
@@ -16,6 +16,7 @@ volatile uint16_t tnano = 0;
 volatile uint16_t tmicro = 0;
 volatile uint16_t tmilli = 0;
 volatile uint16_t tsecond = 0;
+static volatile uint32_t tms = 0; // ms since boot, base of ticks_now() (rolls over as ticks do)
 
 // AVR Costs:
 // - reg/int8 assignment/increment, 1 cycle
@@ -170,6 +171,36 @@ uint16_t seconds(void) {
 	return ticks;
 }
 
+// 1us ticks: 1ms clock plus TCNT1 (16 counts per us, back to 0 every 1ms).
+// With irqs off a TCNT1 that just went back to 0 has its compA isr still pending: TCNT1 is
+// read first, then the flag, a set flag with a small count means that ms is not in tms yet.
+// tms * 1000 wraps with ticks_t, so ticks never jump (only the 32 bits roll over).
+ticks_t ticks_now(void) {
+	uint32_t ms;
+	uint16_t count;
+	ATOMIC_BLOCK(ATOMIC_FORCEON) {
+		ms = tms;
+		count = TCNT1;
+		if ((TIFR1 & (1<<OCF1A)) && (count < (F_CPU / 2000)))
+			ms++;
+	}
+	return ms * 1000 + (count >> 4);
+}
+
+// Nothing else to run on the mcu: the caller keeps polling its ports.
+void ticks_sleep_until(ticks_t when) {
+	(void)when;
+}
+
+void time_snapshot(uint16_t *s, uint16_t *ms, uint16_t *us, uint16_t *ns) {
+	ATOMIC_BLOCK(ATOMIC_FORCEON) {
+		*s = tsecond;
+		*ms = tmilli;
+		*us = micros();
+		*ns = 0;
+	}
+}
+
 
 // ADC -----------------------------------------------------------------------------------------------
 
@@ -227,21 +258,104 @@ void pin_pulse_single(uint8_t pin, uint16_t width) {
 	__asm__ __volatile__("" ::: "memory");
 }
 
+// pulsing engine state: Timer2 shifts out 1 bitmask every 4us to pulse_reg, its interrupt is
+// only enabled while frames are played.
+static volatile uint8_t *pulse_reg = NULL;			// port register driven by the engine
+static volatile uint8_t *pulse_cur = NULL;			// next bitmask to shift out
+static volatile uint8_t pulse_left = 0;				// bitmasks left in current frame
+static volatile pin_frame_t *pulse_played = NULL;	// played frames, freed outside isr
+
+uint8_t pin_pulse_setup(uint8_t bit, uint8_t pin) {
+	// all pulsing pins share 1 port, bitmasks are port bits
+	if ((bit > 7) || (GPIO_MASK(pin) != (1 << bit))) return 0;
+	if (pulse_reg && (pulse_reg != &SFR(pin)->port)) return 0;
+	pin_output_enable(pin);
+	ATOMIC_BLOCK(ATOMIC_FORCEON) {
+		pulse_reg = &SFR(pin)->port;
+		pin_pulsing.pin[bit] = pin;
+		pin_pulsing.enabled |= (1 << bit);
+	}
+	return 1;
+}
+
+uint16_t pin_pulse_now(void) {
+	uint16_t ms;
+	ATOMIC_BLOCK(ATOMIC_FORCEON) {
+		ms = tsecond * 1000 + tmilli;
+	}
+	return ms;
+}
+
 volatile pin_frame_t* pin_pulse_multi(uint16_t milli) {
-	if (pin_pulsing.head) {
-		pin_pulsing.tail->next = malloc(sizeof(pin_frame_t));
-		pin_pulsing.tail->next->milli = milli;
-		// TODO: copy data to frame
-		pin_pulsing.tail->next->pulse = frame;
-		pin_pulsing.tail->next->next = NULL;
-		pin_pulsing.tail = pin_pulsing.tail->next;
-	} else {
-		pin_pulsing.head = malloc(sizeof(pin_frame_t));
-		pin_pulsing.head->milli = milli;
-		// TODO: copy data to frame
-		pin_pulsing.head->pulse = frame;
-		pin_pulsing.head->next = NULL;
-		pin_pulsing.tail = pin_pulsing.head;
+	pin_frame_t *f = malloc(sizeof(pin_frame_t));
+	if (!f) return NULL;
+	f->pulse = calloc(PULSE_SLOTS, sizeof(uint8_t));
+	if (!f->pulse) {
+		free(f);
+		return NULL;
+	}
+	f->milli = milli;
+	f->pulse_counter = 0;
+	f->next = NULL;
+	// keep the queue sorted by start time, appending is the common case
+	ATOMIC_BLOCK(ATOMIC_FORCEON) {
+		if (!pin_pulsing.head) {
+			pin_pulsing.head = f;
+			pin_pulsing.tail = f;
+		} else if ((int16_t)(milli - pin_pulsing.tail->milli) >= 0) {
+			pin_pulsing.tail->next = f;
+			pin_pulsing.tail = f;
+		} else {
+			// never in front of the frame being played
+			volatile pin_frame_t *prev = pin_pulsing.head, *cur = pin_pulsing.head->next;
+			while (cur && ((int16_t)(milli - cur->milli) >= 0)) {
+				prev = cur;
+				cur = cur->next;
+			}
+			f->next = cur;
+			prev->next = f;
+		}
+	}
+	return f;
+}
+
+// 1ms tick (isr): retire the played frame, start the next one when due
+static inline void pin_pulse_tick(uint16_t now) {
+	volatile pin_frame_t *f = pin_pulsing.head;
+	if (f && f->pulse_counter) {
+		pin_pulsing.head = f->next;
+		if (!pin_pulsing.head) pin_pulsing.tail = NULL;
+		f->next = pulse_played;
+		pulse_played = f;
+		f = pin_pulsing.head;
+	}
+	if (f && pulse_reg && ((int16_t)(now - f->milli) >= 0)) {
+		f->pulse_counter = 1; // playing
+		pulse_cur = f->pulse;
+		pulse_left = PULSE_SLOTS;
+		if (!(TIMSK2 & (1<<OCIE2A))) {
+			// idle: first slot 4us from now (back to back frames keep the slots phase)
+			TCNT2 = 0;
+			TIFR2 = (1<<OCF2A);
+			TIMSK2 |= (1<<OCIE2A);
+		}
+	} else if (!pulse_left) {
+		TIMSK2 &= ~(1<<OCIE2A); // next frame not due yet
+	}
+}
+
+// free played frames (main loop)
+static void pin_pulse_collect(void) {
+	volatile pin_frame_t *f;
+	ATOMIC_BLOCK(ATOMIC_FORCEON) {
+		f = pulse_played;
+		pulse_played = NULL;
+	}
+	while (f) {
+		volatile pin_frame_t *next = f->next;
+		free((void *)f->pulse);
+		free((void *)f);
+		f = next;
 	}
 }
 
@@ -370,22 +484,19 @@ void arch_init() {
 	// default text console
 	uart_enable();
 
-	// pin_pulsing.pins
-	pin_pulsing.enable();
-
-	// Timer2: pulse trigger, the counter starts at zero and resets to zero at TOP (compA value).
-	TCCR2 |= (1<<CS21); // Fast PWM mode, with prescaler = 1, ie: 1 tick each 62.5ns
+	// Timer2: pulsing engine, CTC mode, 1 compA match each 4us.
+	TCCR2A = (1<<WGM21); // CTC, TOP = OCR2A
+	TCCR2B = (1<<CS21); // prescaler = 8, ie: 1 tick each 0.5us
 	TCNT2 = 0; // initialize counter
-	OCR2A = 63; // compA, TOP (default 4us)
-	OCR2B = 255; // compB, MATCH (255>TOP -> never matches = no pulse)
-	TIMSK2 |= (1<<OCIE2A)|(1<<OCIE2B)|(1<<TOIE2); // enable interrupts
+	OCR2A = (PULSE_SLOT_US * 2) - 1; // compA, TOP (4us)
+	// interrupt enabled by pin_pulse_tick() when a frame starts
 
-	// Timer1: time keeping
-	TCCR1 |= (1<<CS11); // Fast PWM mode, with prescaler = 1, ie: 1 tick each 62.5ns
+	// Timer1: time keeping and pulsing frames, CTC mode, 1 compA match each 1ms.
+	TCCR1A = 0;
+	TCCR1B = (1<<WGM12)|(1<<CS10); // CTC, TOP = OCR1A, prescaler = 1, ie: 1 tick each 62.5ns
 	TCNT1 = 0; // initialize counter
-	OCR1A = 63; // compA, 4us
-	OCR1B = 15999; // compB, 1ms
-	TIMSK1 |= (1<<OCIE1A)|(1<<OCIE1B); // enable interrupts
+	OCR1A = 15999; // compA, TOP (1ms)
+	TIMSK1 |= (1<<OCIE1A); // enable interrupt
 
 	// Timer0: system tasks
 	TCCR0 |= (1<<CS01); // Normal mode, with prescaler = 64, ie: 1 tick each 4us
@@ -407,51 +518,30 @@ void arch_init() {
 	sei();
 }
 
-// Timer2: pulse generator
-// example: COMPA = 64, COMPB = 32
-// Pins are LOW. The counter starts counting from 0; at 32 it matches COMPB, selected pins become HIGH.
-// The counter keeps counting from 33; at 64 it maches COMPA, triggers OVF and restart from 0. OVF set selected pins to LOW.
-// Pins are LOW from 0 to 32, HIGH from 33 to 64. Then low again.
+// Timer2: pulsing engine
+// Shift out 1 precomputed bitmask per slot, only the enabled bits of the port are touched.
+// Stops at the end of the frame unless another one is queued (the next 1ms tick starts it).
 ISR(TIMER2_COMPA_vect) {
-	// TOP: once reached, counter goes back to bottom
-}
-ISR(TIMER2_COMPB_vect) {
-	// MATCH: once reached, set pins to high; ie: set match < top, to enable a pulse between match and top
-	pin_write(pin_pulsing.pin[0], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(0)) );
-	pin_write(pin_pulsing.pin[1], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(1)) );
-	pin_write(pin_pulsing.pin[2], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(2)) );
-	pin_write(pin_pulsing.pin[3], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(3)) );
-	pin_write(pin_pulsing.pin[4], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(4)) );
-	pin_write(pin_pulsing.pin[5], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(5)) );
-	pin_write(pin_pulsing.pin[6], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(6)) );
-	pin_write(pin_pulsing.pin[7], BIT_GET(pin_pulsing.head->pulse[pin_pulsing.counter], BIT(7)) );
-}
-ISR(TIMER2_OVF_vect) {
-	// overflow: every time counter reaches TOP, set pins to low
-	pin_write(pin_pulsing.pin[0], 0);
-	pin_write(pin_pulsing.pin[1], 0);
-	pin_write(pin_pulsing.pin[2], 0);
-	pin_write(pin_pulsing.pin[3], 0);
-	pin_write(pin_pulsing.pin[4], 0);
-	pin_write(pin_pulsing.pin[5], 0);
-	pin_write(pin_pulsing.pin[6], 0);
-	pin_write(pin_pulsing.pin[7], 0);
+	if (pulse_left) {
+		uint8_t en = pin_pulsing.enabled;
+		*pulse_reg = (*pulse_reg & ~en) | (*pulse_cur & en);
+		pin_pulsing.out = *pulse_cur++;
+		pulse_left--;
+	}
+	if (!pulse_left && !(pin_pulsing.head && pin_pulsing.head->next))
+		TIMSK2 &= ~(1<<OCIE2A);
 }
 
 // Timer1
 ISR(TIMER1_COMPA_vect) {
 	// update clock
+	tms++;
 	tmilli++;
-	// reset pulse counter
-	pin_pulsing.counter = 0;
-	OCR1B = 63;
+	// next pulsing frame
+	pin_pulse_tick(tsecond * 1000 + tmilli);
 	// signal overflow
 	t1_ovf = 1;
 }
-ISR(TIMER1_COMPB_vect) {
-	pin_pulsing.counter++;
-	OCR1B = OCR1B + 64;
-}
 
 // Timer0
 ISR(TIMER0_COMPA_vect) {
@@ -462,12 +552,6 @@ ISR(TIMER0_COMPA_vect) {
 	}
 }
 ISR(TIMER0_COMPB_vect) {
-	// discard current frame
-	if (pin_pulsing.head->next) {
-		pin_frame_t old = pin_pulsing.head;
-		pin_pulsing.head = pin_pulsing.head->next;
-		free(old);
-	}
 	uint16_t elapsed = cycles_end();
 	// re-start cycles count for the next 1ms
 	cycles_start();
@@ -481,6 +565,8 @@ uint8_t arch_run(uint16_t snow, uint16_t mnow) {
 	} else {
 		// run ADC
 		pin_input_adc_run();
+		// free played pulsing frames
+		pin_pulse_collect();
 	}
 	uint8_t cpu_usage = lag;
 	lag = 0;
@@ -1,11 +1,11 @@
 
 #include <hal/arch.h>
 #include <x86intrin.h>	// rdtscp
-#include <unistd.h>		// usleep
-#include <pthread.h>	// timer thread
-#include <string.h>		// memset
-#include <signal.h>		// sigaction
-#include <sys/time.h>	// itimerval
+#include <stdio.h>		// printf
+#include <stdlib.h>		// rand
+#include <time.h>		// clock_gettime
+#include <utility/pulsethread.linux.h>
+#include <utility/vcd.bogus.h>
 
 // TIME -----------------------------------------------------------------------------------
 
@@ -25,94 +25,123 @@ double arch_monotonic(void) {
 	return (double)ts.tv_sec + (double)ts.tv_nsec * .000000001;
 }
 
-static pthread_t timer_thread_id;
-static pthread_mutex_t timer_lock;
-static void _timer_handler(int signum) {
+// published time snapshot (tsecond/tmilli/tmicro/tnano) guarded by a seqlock:
+// single writer (the main loop, see timer_publish()), lock-free readers from any thread.
+static volatile uint32_t timer_seq = 0;
+
+static void timer_split(struct timespec *ts, uint16_t *s, uint16_t *ms, uint16_t *us, uint16_t *ns) {
+	*s = ts->tv_sec;
+	*ms = ts->tv_nsec/1000000;
+	*us = (ts->tv_nsec%1000000)/1000;
+	*ns = ts->tv_nsec%1000;
+}
+
+static void timer_publish(void) {
 	struct timespec ts = arch_monotonic_ts();
-	pthread_mutex_lock(&timer_lock);
-	tsecond = ts.tv_sec;
-	tmilli = ts.tv_nsec/1000000;
-    tmicro = (ts.tv_nsec%1000000)/1000;
-    tnano = ts.tv_nsec%1000;
-	pthread_mutex_unlock(&timer_lock);
-}
-static void * _timer_thread(void *data) {
-	struct sigaction sa;
-	struct itimerval timer;
-	// install _timer_handler as the signal handler for SIGALRM.
-	memset(&sa, 0, sizeof (sa));
-	sa.sa_handler = &_timer_handler;
-	sigaction(SIGALRM, &sa, NULL);
-	// configure the timer to expire after 1 usec...
-	timer.it_value.tv_sec = 0;
-	timer.it_value.tv_usec = 50;
-	// ... and every 1 usec after that.
-	timer.it_interval.tv_sec = 0;
-	timer.it_interval.tv_usec = 50;
-	// start the virtual timer (countdown).
-	setitimer(ITIMER_REAL, &timer, NULL);
-	// loop&do nothing
-	while(1) {
-		sleep(1);
-	}
-	data = data; // unused parameter
-	return 0;
+	uint16_t s, ms, us, ns;
+	timer_split(&ts, &s, &ms, &us, &ns);
+	uint32_t seq = __atomic_load_n(&timer_seq, __ATOMIC_RELAXED);
+	__atomic_store_n(&timer_seq, seq+1, __ATOMIC_RELAXED); // odd: write in progress
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	tsecond = s;
+	tmilli = ms;
+	tmicro = us;
+	tnano = ns;
+	__atomic_store_n(&timer_seq, seq+2, __ATOMIC_RELEASE);
 }
 
-static int timer_init() {
-	pthread_mutex_init(&timer_lock, NULL);
-	if(pthread_create(&timer_thread_id, NULL, _timer_thread, NULL)) return 0;
-	return 1;
+void time_snapshot(uint16_t *s, uint16_t *ms, uint16_t *us, uint16_t *ns) {
+	uint32_t seq;
+	do {
+		seq = __atomic_load_n(&timer_seq, __ATOMIC_ACQUIRE);
+		if (seq & 1) continue;
+		*s = tsecond;
+		*ms = tmilli;
+		*us = tmicro;
+		*ns = tnano;
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while ((seq & 1) || (seq != __atomic_load_n(&timer_seq, __ATOMIC_RELAXED)));
+}
+
+ticks_t ticks_now(void) {
+	struct timespec ts = arch_monotonic_ts();
+	return (ticks_t)((uint64_t)ts.tv_sec * TICKS_FREQ + (uint64_t)ts.tv_nsec / (1000000000ULL / TICKS_FREQ));
 }
 
-static void timer_clean() {
-	pthread_cancel(timer_thread_id);
-	pthread_join(timer_thread_id, NULL);
-	pthread_mutex_destroy(&timer_lock);
+void ticks_sleep_until(ticks_t when) {
+	ticks_t now = ticks_now();
+	if (!ticks_is_before(now, when))
+		return;
+	uint32_t us = ticks_to_us(when - now);
+	struct timespec ts = { us / 1000000, (us % 1000000) * 1000 };
+	nanosleep(&ts, NULL);
 }
 
 uint16_t cycles(void) {
 	return (uint16_t)(arch_ticks() & 0x000000000000FFFF);
 }
 
+// time getters read the clock directly (vDSO, no syscall, no lock)
 uint16_t nanos(void) {
-	pthread_mutex_lock(&timer_lock);
-	uint16_t t = tnano;
-	pthread_mutex_unlock(&timer_lock);
-	return t;
+	struct timespec ts = arch_monotonic_ts();
+	return ts.tv_nsec%1000;
 }
 
 uint16_t micros(void) {
-	pthread_mutex_lock(&timer_lock);
-	uint16_t t = tmicro;
-	pthread_mutex_unlock(&timer_lock);
-	return t;
+	struct timespec ts = arch_monotonic_ts();
+	return (ts.tv_nsec%1000000)/1000;
 }
 
 uint16_t millis(void) {
-	pthread_mutex_lock(&timer_lock);
-	uint16_t t = tmilli;
-	pthread_mutex_unlock(&timer_lock);
-	return t;
+	struct timespec ts = arch_monotonic_ts();
+	return ts.tv_nsec/1000000;
 }
 
 uint16_t seconds(void) {
-	pthread_mutex_lock(&timer_lock);
-	uint16_t t = tsecond;
-	pthread_mutex_unlock(&timer_lock);
-	return t;
+	struct timespec ts = arch_monotonic_ts();
+	return ts.tv_sec;
+}
+
+
+// VIRTUAL PIN BANK -------------------------------------------------------------------------
+//
+// Pins live in memory: every level change is timestamped into the VCD ring (if vcd_filename is set),
+// no artificial delay, so simulations run as fast as the host allows.
+
+static volatile uint8_t vpin_mode[PIN_TOTAL];
+static volatile uint8_t vpin_level[PIN_TOTAL];
+static volatile uint16_t vpin_pwm[PIN_TOTAL];
+static const char *vpin_names[PIN_TOTAL] = {"P1", "P2", "P3", "P4", "P5", "P6", "P7", "P8"};
+
+static void vpin_set(uint8_t pin, uint8_t value) {
+	if (pin >= PIN_TOTAL) return;
+	value = (value != 0);
+	if (__atomic_exchange_n(&vpin_level[pin], value, __ATOMIC_RELAXED) != value)
+		vcd_record(pin, value);
+}
+
+static void vpin_reset(void) {
+	for (uint8_t i = 0; i < PIN_TOTAL; i++) {
+		vpin_mode[i] = PIN_MODE_UNUSED;
+		vpin_level[i] = 0;
+		vpin_pwm[i] = 0;
+	}
 }
 
 
 // PORT GET/SET -----------------------------------------------------------------------------
 
+// 1 virtual port, bit n is pin n
 uint8_t port_read(uint8_t pin, uint8_t timeout) {
-	usleep(1);
-	return 0;
+	uint8_t value = 0;
+	for (uint8_t i = 0; i < PIN_TOTAL; i++)
+		value |= vpin_level[i] << i;
+	return value;
 }
 
 uint8_t port_write(uint8_t pin, uint8_t value) {
-	usleep(1);
+	for (uint8_t i = 0; i < PIN_TOTAL; i++)
+		vpin_set(i, (value >> i) & 1);
 	return 0;
 }
 
@@ -120,39 +149,45 @@ uint8_t port_write(uint8_t pin, uint8_t value) {
 // PIN GET/SET ------------------------------------------------------------------------------
 
 void pin_mode(uint8_t pin, uint8_t mode) {
-	usleep(1);
+	if (pin >= PIN_TOTAL) return;
+	vpin_mode[pin] = mode;
+	if (mode == PIN_MODE_PULLUP) vpin_set(pin, 1);
 }
 
 uint8_t pin_read(uint8_t pin, uint8_t timeout) {
-	return 0;
+	if (pin >= PIN_TOTAL) return 0;
+	return vpin_level[pin];
 }
 
 void pin_set_low(uint8_t pin) {
-	usleep(1);
+	vpin_set(pin, 0);
 }
 
 void pin_set_high(uint8_t pin) {
-	usleep(1);
+	vpin_set(pin, 1);
 }
 
 void pin_toggle(uint8_t pin) {
-	usleep(1);
+	if (pin >= PIN_TOTAL) return;
+	vpin_set(pin, !vpin_level[pin]);
 }
 
 void pin_write(uint8_t pin, uint8_t value) {
-	usleep(1);
+	vpin_set(pin, value);
 }
 
+// duty cycle is stored only, the waveform is not simulated
 void pin_write_pwm(uint8_t pin, uint16_t value) {
-	usleep(1);
+	if (pin >= PIN_TOTAL) return;
+	vpin_pwm[pin] = value;
 }
 
 void pin_pullup_enable(uint8_t pin) {
-	usleep(1);
+	pin_mode(pin, PIN_MODE_PULLUP);
 }
 
 void pin_open_drain(uint8_t pin) {
-	usleep(1);
+	pin_mode(pin, PIN_MODE_OUTPUT);
 }
 
 
@@ -177,40 +212,43 @@ uint16_t pin_read_adc(uint8_t pin, uint8_t timeout) {
 // PULSING ----------------------------------------------------------------------------------
 
 uint16_t pin_pulse_detect(uint8_t pin) {
-	uint16_t width = rand() % 1000;
-	usleep(width);
-	return width;
+	return rand() % 1000;
 }
 
 void pin_pulse_single(uint8_t pin, uint16_t width) {
-	usleep(width);
+	pulseSingle(pin, width);
+}
+
+uint8_t pin_pulse_setup(uint8_t bit, uint8_t pin) {
+	if (bit > 7) return 0;
+	pin_mode(pin, PIN_MODE_OUTPUT);
+	pin_pulsing.pin[bit] = pin;
+	pin_pulsing.enabled |= (1 << bit);
+	return 1;
+}
+
+uint16_t pin_pulse_now(void) {
+	return pulseNow();
 }
 
 volatile pin_frame_t* pin_pulse_multi(uint16_t milli) {
-	if (pin_pulsing.head) {
-		if (milli > pin_pulsing.tail->milli) {
-			pin_pulsing.tail->next = (volatile pin_frame_t*)calloc(1,sizeof(pin_frame_t));
-			pin_pulsing.tail->next->next = NULL;
-			pin_pulsing.tail = pin_pulsing.tail->next;
-			return pin_pulsing.tail->next;
-		} else {
-			// TODO: traverse all list from head to find the right timing spot
-			return pin_pulsing.tail->next;
-		}
-	} else {
-		pin_pulsing.head = (volatile pin_frame_t*)calloc(1,sizeof(pin_frame_t));
-		pin_pulsing.head->next = NULL;
-		pin_pulsing.tail = pin_pulsing.head;
-		return pin_pulsing.tail;
-	}
+	return pulseFrame(milli);
 }
 
 void _arch_init(void) {
 	// random init
 	srand(time(NULL));
-	// timer init
-	timer_init();
+	// publish time
+	timer_publish();
+	// pulse player
+	initPulseThread();
 	// pin init
+	vpin_reset();
+	if (vcd_filename) {
+		uint8_t levels[PIN_TOTAL] = {0};
+		if (vcd_open(vcd_filename, "simulinux", PIN_TOTAL, vpin_names, levels) < 0)
+			printf("Can't open VCD file \"%s\"\n", vcd_filename);
+	}
 	pin[0] = P1;
 	pin[1] = P2;
 	pin[2] = P3;
@@ -222,10 +260,16 @@ void _arch_init(void) {
 }
 
 void _arch_run(void) {
+	timer_publish();
 	pin_adc_run();
+	vcd_flush();
 }
 
 void _arch_reset(void) {
-	timer_clean();
+	closePulseThread();
+	if (vcd_is_open()) {
+		vcd_close();
+		printf("- VCD %s: %u changes, %u lost\n", vcd_filename, vcd_changes, vcd_lost);
+	}
 }
 
@@ -45,6 +45,8 @@ void vars_reset(void) {
 	for (uint8_t i = 0;i<8;i++) {
 		pin_pulsing.pin[i] = 0;
 	}
+	pin_pulsing.enabled = 0;
+	pin_pulsing.out = 0;
 	pin_pulsing.head = NULL;
 	pin_pulsing.tail = NULL;
 }
@@ -4,6 +4,7 @@
 #include "autoconf.avr.h" // CONFIG_MCU
 
 #include "irq.h" // irq_enable
+#include "sched.h" // DECL_INIT
 
 /****************************************************************
  * Misc functions
@@ -18,4 +19,5 @@ void task_init_prescaler(void) {
         irq_restore(flag);
     }
 }
+DECL_INIT(task_init_prescaler, INIT_CLOCK);
 
@@ -57,6 +57,7 @@ void task_init_serial(void) {
     UCSRxC = (1<<UCSZx1) | (1<<UCSZx0);
     UCSRxB = (1<<RXENx) | (1<<TXENx) | (1<<RXCIEx) | (1<<UDRIEx);
 }
+DECL_INIT(task_init_serial, INIT_DEVICE);
 
 // Rx interrupt - data available to be read.
 ISR(USARTx_RX_vect) {
@@ -49,6 +49,7 @@ static struct timer_s wrap_timer;
 void task_end_timer(void) {
     sched_add_timer(&wrap_timer);
 }
+DECL_END(task_end_timer);
 
 void task_init_timer(void) {
     irqstatus_t flag = irq_save();
@@ -66,6 +67,7 @@ void task_init_timer(void) {
     TIMSK1 = 1<<OCIE1A;
     irq_restore(flag);
 }
+DECL_INIT(task_init_timer, INIT_CORE);
 
 
 /****************************************************************
@@ -24,12 +24,14 @@ void task_watchdog(void) {
         watchdog_shutdown = 0;
     }
 }
+DECL_TASK(task_watchdog, NULL);
 
 void task_init_watchdog(void) {
     // 0.5s timeout, interrupt and system reset
     wdt_enable(WDTO_500MS);
     WDTCSR = 1<<WDIE;
 }
+DECL_INIT(task_init_watchdog, INIT_CORE);
 
 // Very early reset of the watchdog
 void __attribute__((naked)) __visible __section(".init3") watchdog_early_init(void) {
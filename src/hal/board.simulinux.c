@@ -10,21 +10,22 @@
 // FD
 uint8_t fd_begin(commport_t *cp, uint32_t baud) {
 	char *fname;
+	int fdid;
 	if (cp->id == 0) {
 		uint8_t len = strlen("/dev/stdin");
 		fname = calloc(len,sizeof(char));
 		strcpy(fname, "/dev/stdin");
-		cp->id = fdOpen(fname,FD_TYPE_FILE);
+		fdid = fdOpen(fname,FD_TYPE_FILE);
 	} else if (cp->id == 1) {
 		uint8_t len = strlen("/dev/stdout");
 		fname = calloc(len,sizeof(char));
 		strcpy(fname, "/dev/stdout");
-		cp->id = fdOpen(fname,FD_TYPE_FILE);
+		fdid = fdOpen(fname,FD_TYPE_FILE);
 	} else if (cp->id == 2) {
 		uint8_t len = strlen("/dev/stderr");
 		fname = calloc(len,sizeof(char));
 		strcpy(fname, "/dev/stderr");
-		cp->id = fdOpen(fname,FD_TYPE_FILE);
+		fdid = fdOpen(fname,FD_TYPE_FILE);
 	} else {
 		char fnid[10];
 		sprintf(fnid, "%d", fd_idx);
@@ -33,20 +34,24 @@ uint8_t fd_begin(commport_t *cp, uint32_t baud) {
 		fname = calloc(len,sizeof(char));
 		strcpy(fname, fd_pty_filename);
 		strcat(fname, fnid);
-		cp->id = fdOpen(fname,FD_TYPE_PTY);
+		fdid = fdOpen(fname,FD_TYPE_PTY);
 	}
 	//
 	free(fname);
+	if (fdid < 0) return 0;
+	cp->id = fdid;
 	cp->fd = fdGet(cp->id);
 	return cp->fd;
 }
 
 uint8_t fd_available(commport_t *cp) {
-	return fdAvailable(cp->id);
+	int len = fdAvailable(cp->id);
+	return len > 255 ? 255 : len;
 }
 
 uint8_t fd_read(commport_t *cp, uint8_t *data, uint8_t count, uint16_t timeout) {
-	return fdRead(cp->id,data);
+	int len = fdRead(cp->id,data,count);
+	return len < 0 ? 0 : len;
 }
 
 uint8_t fd_write(commport_t *cp, uint8_t *data, uint8_t count, uint16_t timeout) {
@@ -102,14 +107,21 @@ void _board_init(void) {
 	// init default ports
 	commport_register(COMMPORT_TYPE_TTY, 3);
 	port[0].begin(&port[0], DEFAULT_BAUD);
-	binConsole = &port[0];
 	commport_register(COMMPORT_TYPE_TTY, 1);
 	port[1].begin(&port[1], DEFAULT_BAUD);
-	txtConsole = &port[1];
 	commport_register(COMMPORT_TYPE_TTY, 2);
 	port[2].begin(&port[2], DEFAULT_BAUD);
+	// peering port (next pty), only if another MCU is chained
+	commport_register(COMMPORT_TYPE_TTY, 4);
+	// port array may have moved while registering
+	binConsole = &port[0];
+	txtConsole = &port[1];
 	errConsole = &port[2];
-	peering = NULL;
+	if (port[3].begin(&port[3], DEFAULT_BAUD)) {
+		peering = &port[3];
+	} else {
+		peering = NULL;
+	}
 }
 
 void _board_run(void) {
@@ -8,6 +8,7 @@
 
 #include "sched.h" // struct timer_s
 #include "cmds_base.h" // oid_alloc
+#include "messages.h" // send_adc_state
 
 struct analog_in {
     struct timer_s timer;
@@ -77,9 +78,10 @@ void task_analog_in(void) {
         uint32_t next_begin_time = a->next_begin_time;
         a->state++;
         irq_enable();
-        send_response(TYPE_ADC_STATE, oid, next_begin_time, value);
+        send_adc_state(oid, next_begin_time, value);
     }
 }
+DECL_TASK(task_analog_in, &analog_wake);
 
 void task_end_analog_in(void) {
     uint8_t i;
@@ -94,6 +96,7 @@ void task_end_analog_in(void) {
         }
     }
 }
+DECL_END(task_end_analog_in);
 
 void command_config_analog_in(uint32_t *args) {
     struct gpio_adc pin = gpio_adc_setup(args[1]);
@@ -110,6 +113,8 @@ void command_query_analog_in(uint32_t *args) {
     a->next_begin_time = args[1];
     a->timer.waketime = a->next_begin_time;
     a->sample_time = args[2];
+    // sampling tolerates a sample period of jitter
+    sched_timer_slack(&a->timer, a->sample_time);
     a->sample_count = args[3];
     a->state = a->sample_count + 1;
     a->rest_time = args[4];
@@ -9,6 +9,8 @@
 #include "cmds_base.h" // oid_lookup
 
 #include "sched.h" // sched_clear_shutdown
+#include "cmd.h" // DECL_COMMAND
+#include "messages.h" // send_base_stats
 
 
 /****************************************************************
@@ -16,6 +18,7 @@
  ****************************************************************/
 
 static void *alloc_end;
+static size_t alloc_largest;
 
 // Allocate an area of memory
 void *alloc_chunk(size_t size) {
@@ -23,6 +26,8 @@ void *alloc_chunk(size_t size) {
         sched_shutdown(ERROR_CHUNK_FAIL);
     void *data = alloc_end;
     alloc_end += ALIGN(size, __alignof__(void*));
+    if (size > alloc_largest)
+        alloc_largest = size;
     memset(data, 0, size);
     return data;
 }
@@ -45,55 +50,147 @@ static void *alloc_chunks(size_t size, size_t count, uint16_t *avail) {
  * Move queue
  ****************************************************************/
 
+// Runtime storage is carved at finalize_config into pools of fixed size
+// items: one for each oid that asked for it (move_request_pool()) and
+// the shared one of move_alloc(). The free memory is split by the pools'
+// shares, so a busy driver can't starve the others, and each pool keeps
+// its current and peak occupancy (see move_report()) for the host to
+// back off before ERROR_MOVE_Q_EMPTY.
+
+#define MOVE_POOL_MAX 1024      // items in a pool
+#define MOVE_SHARED_OID 0xff    // oid reported for the shared pool
+
 struct move_freed {
     struct move_freed *next;
 };
 
-static struct move_freed *move_free_list;
-static void *move_list;
-static uint16_t move_count;
-static uint8_t move_item_size;
+struct move_pool {
+    struct move_pool *next;
+    struct move_freed *free_list;
+    void *items;
+    uint16_t count, used, peak, item_size;
+    uint8_t share, oid;
+};
+
+static struct move_pool move_shared, *move_pools;
+static uint8_t move_finalized;
 
 // Is the config and move queue finalized?
 static int is_finalized(void) {
-    return !!move_count;
+    return move_finalized;
 }
 
-// Free previously allocated storage from move_alloc(). Caller must
-// disable irqs.
-void move_free(void *m) {
+// Free previously allocated storage from move_pool_alloc(). Caller
+// must disable irqs.
+void move_pool_free(struct move_pool *p, void *m) {
     struct move_freed *mf = m;
-    mf->next = move_free_list;
-    move_free_list = mf;
+    mf->next = p->free_list;
+    p->free_list = mf;
+    p->used--;
 }
 
-// Allocate runtime storage
-void *move_alloc(void) {
+// Allocate runtime storage from a pool
+void *move_pool_alloc(struct move_pool *p) {
     irqstatus_t flag = irq_save();
-    struct move_freed *mf = move_free_list;
+    struct move_freed *mf = p->free_list;
     if (!mf)
         sched_shutdown(ERROR_MOVE_Q_EMPTY);
-    move_free_list = mf->next;
+    p->free_list = mf->next;
+    if (++p->used > p->peak)
+        p->peak = p->used;
     irq_restore(flag);
     return mf;
 }
 
+// Free previously allocated storage from move_alloc(). Caller must
+// disable irqs.
+void move_free(void *m) {
+    move_pool_free(&move_shared, m);
+}
+
+// Allocate runtime storage from the shared pool
+void *move_alloc(void) {
+    return move_pool_alloc(&move_shared);
+}
+
 // Request minimum size of runtime allocations returned by move_alloc()
 void move_request_size(int size) {
     if (size > UINT8_MAX || is_finalized())
         sched_shutdown(ERROR_INVALID_MOVE_SIZE);
-    if (size > move_item_size)
-        move_item_size = size;
+    if (size > move_shared.item_size)
+        move_shared.item_size = size;
+}
+
+// Request a pool of 'size' bytes items for 'oid', getting 'share' parts
+// of the memory free at finalize_config (the shared pool gets one).
+// Unlike move_alloc() items, these can be larger than 255 bytes (a
+// queued transfer and its data, say).
+struct move_pool *move_request_pool(uint8_t oid, int size, uint8_t share) {
+    if (size <= 0 || size > UINT16_MAX - (int)sizeof(struct move_freed)
+        || is_finalized())
+        sched_shutdown(ERROR_INVALID_MOVE_SIZE);
+    struct move_pool *p = alloc_chunk(sizeof(*p));
+    if (size < (int)sizeof(struct move_freed))
+        size = sizeof(struct move_freed);
+    // the free list links live in the items
+    p->item_size = ALIGN(size, __alignof__(struct move_freed));
+    p->share = share ? share : 1;
+    p->oid = oid;
+    p->next = move_pools;
+    move_pools = p;
+    return p;
 }
 
 static void move_finalize(void) {
     if (is_finalized())
         sched_shutdown(ERROR_ALREADY_FINAL);
-    move_request_size(sizeof(*move_free_list));
-    move_list = alloc_chunks(move_item_size, 1024, &move_count);
+    move_request_size(sizeof(struct move_freed));
+    move_shared.share = 1;
+    move_shared.oid = MOVE_SHARED_OID;
+    move_shared.next = move_pools;
+    move_pools = &move_shared;
+    struct move_pool *p;
+    uint16_t shares = 0;
+    for (p = move_pools; p; p = p->next)
+        shares += p->share;
+    uint32_t avail = dynmem_end() - alloc_end;
+    for (p = move_pools; p; p = p->next) {
+        uint32_t count = avail * p->share / shares / p->item_size;
+        if (count > MOVE_POOL_MAX)
+            count = MOVE_POOL_MAX;
+        if (!count)
+            // a big item with a small share: one item anyway, the
+            // move_pool report tells the host how deep it can queue
+            count = 1;
+        p->items = alloc_chunks(p->item_size, count, &p->count);
+    }
+    move_finalized = 1;
     task_end_move();
 }
 
+// Total items of the pools
+static uint16_t move_count(void) {
+    uint16_t count = 0;
+    struct move_pool *p;
+    for (p = move_pools; p; p = p->next)
+        count += p->count;
+    return count;
+}
+
+// Send a TYPE_BASE_MOVE_POOL response for each pool, optionally
+// restarting their peaks from the current occupancy
+static void move_report(uint8_t reset) {
+    struct move_pool *p;
+    for (p = move_pools; p; p = p->next) {
+        irqstatus_t flag = irq_save();
+        uint16_t used = p->used, peak = p->peak;
+        if (reset)
+            p->peak = used;
+        irq_restore(flag);
+        send_base_move_pool(p->oid, p->count, used, peak);
+    }
+}
+
 
 /****************************************************************
  * Generic object ids (oid)
@@ -149,9 +246,10 @@ void config_reset(uint32_t *args) {
     config_crc = 0;
     oid_count = 0;
     oids = NULL;
-    move_free_list = NULL;
-    move_list = NULL;
-    move_count = move_item_size = 0;
+    memset(&move_shared, 0, sizeof(move_shared));
+    move_pools = NULL;
+    move_finalized = 0;
+    alloc_largest = 0;
     task_init_alloc();
     sched_timer_reset();
     sched_clear_shutdown();
@@ -184,10 +282,15 @@ void stats_update(uint32_t start, uint32_t cur) {
     if (nextsumsq < sumsq)
         nextsumsq = 0xffffffff;
     sumsq = nextsumsq;
+    if (CONFIG_SCHED_HIST)
+        hist_record(HIST_TASK_LOOP, diff);
 
     if (timer_is_before(cur, stats_send_time + timer_from_us(5000000)))
         return;
-    send_response(TYPE_BASE_STATS, count, sum, sumsq);
+    send_base_stats(count, sum, sumsq);
+    move_report(0);
+    stats_report_latency();
+    sched_report_profile();
     if (cur < stats_send_time)
         stats_send_time_high++;
     stats_send_time = cur;
@@ -195,6 +298,82 @@ void stats_update(uint32_t start, uint32_t cur) {
 }
 
 
+// Boards measuring their wakeup latency override this (see main.linux.c)
+void __weak stats_report_latency(void) {
+}
+
+
+/****************************************************************
+ * Timing histograms
+ ****************************************************************/
+
+// Timer dispatch lateness (see sched_timer_dispatch()) and task loop
+// duration, kept until reset with command_hist() - the tail (p99,
+// p99.9) the load stats sums hide
+struct hist_s {
+    hist_count_t counts[HIST_BUCKETS];
+    uint32_t max;
+};
+
+#if CONFIG_SCHED_HIST
+static struct hist_s hists[HIST_NO];
+
+// Bucket of a value: shifts only, no division
+static uint_fast16_t hist_bucket(uint32_t v) {
+    if (v < (1 << HIST_SUB_BITS))
+        return v;
+    if (v >= (1UL << HIST_MAX_BITS))
+        return HIST_BUCKETS - 1;
+    uint_fast8_t e = sizeof(long) * 8 - 1 - __builtin_clzl(v);
+    return ((uint_fast16_t)(e - HIST_SUB_BITS + 1) << HIST_SUB_BITS)
+           + ((v >> (e - HIST_SUB_BITS)) & ((1 << HIST_SUB_BITS) - 1));
+}
+#endif
+
+// Count a value (timer lateness is recorded from the timer irq)
+void hist_record(uint8_t id, uint32_t value) {
+#if CONFIG_SCHED_HIST
+    struct hist_s *h = &hists[id];
+    hist_count_t *c = &h->counts[hist_bucket(value)];
+    if (*c != (hist_count_t)~0)
+        (*c)++;
+    if (value > h->max)
+        h->max = value;
+#endif
+}
+
+#define HIST_CHUNK 32
+
+// Send the TYPE_BASE_HIST response of up to HIST_CHUNK buckets from
+// 'pos' (up to the last used one), optionally resetting them. One chunk
+// per command: a whole histogram doesn't fit the transmit buffer at
+// once, the host asks for the next 'pos' until it gets less than
+// HIST_CHUNK buckets. 'max' is reset with the last chunk.
+static void hist_send(uint8_t id, uint8_t reset, uint_fast16_t pos) {
+#if CONFIG_SCHED_HIST
+    struct hist_s *h = &hists[id];
+    uint_fast16_t used = HIST_BUCKETS;
+    while (used && !h->counts[used-1])
+        used--;
+    if (pos > used)
+        pos = used;
+    uint32_t counts[HIST_CHUNK];
+    uint_fast8_t n = used - pos > HIST_CHUNK ? HIST_CHUNK : used - pos;
+    irqstatus_t flag = irq_save();
+    for (uint_fast8_t i=0; i<n; i++) {
+        counts[i] = h->counts[pos + i];
+        if (reset)
+            h->counts[pos + i] = 0;
+    }
+    uint32_t max = h->max;
+    if (reset && pos + n >= used)
+        h->max = 0;
+    irq_restore(flag);
+    send_base_hist(id, HIST_SUB_BITS, max, pos, n, counts);
+#endif
+}
+
+
 /****************************************************************
  * tasks and commands
  ****************************************************************/
@@ -208,21 +387,27 @@ void task_noop(void) {
 void task_init_alloc(void) {
     alloc_end = (void*)ALIGN((size_t)dynmem_start(), __alignof__(void*));
 }
+DECL_INIT(task_init_alloc, INIT_CORE);
 
 // move reset
 void task_end_move(void) {
-    if (!move_count)
-        return;
-    // Add everything in move_list to the free list.
-    uint32_t i;
-    for (i=0; i<move_count-1; i++) {
-        struct move_freed *mf = move_list + i*move_item_size;
-        mf->next = move_list + (i + 1)*move_item_size;
+    // Add all the items of each pool to its free list.
+    struct move_pool *p;
+    for (p = move_pools; p; p = p->next) {
+        if (!p->count)
+            continue;
+        uint16_t i;
+        for (i=0; i<p->count-1; i++) {
+            struct move_freed *mf = p->items + i*p->item_size;
+            mf->next = p->items + (i + 1)*p->item_size;
+        }
+        struct move_freed *mf = p->items + (p->count - 1)*p->item_size;
+        mf->next = NULL;
+        p->free_list = p->items;
+        p->used = 0;
     }
-    struct move_freed *mf = move_list + (move_count - 1)*move_item_size;
-    mf->next = NULL;
-    move_free_list = move_list;
 }
+DECL_END(task_end_move);
 
 uint8_t *command_unknown(uint8_t *start, uint8_t *end) {
 	// TODO error
@@ -241,50 +426,90 @@ uint8_t *command_allocate_oids(uint8_t *start, uint8_t *end) {
     oid_count = count;
 	return start;
 }
+DECL_COMMAND(command_allocate_oids, TYPE_BASE_ALLOCATE_OIDS);
 
 uint8_t *command_get_config(uint8_t *start, uint8_t *end) {
-    send_response(TYPE_BASE_GET_CONFIG, is_finalized(), config_crc, move_count, sched_is_shutdown());
+    send_base_get_config(is_finalized(), config_crc, move_count(), sched_is_shutdown());
 	return ++start;
 }
+DECL_COMMAND(command_get_config, TYPE_BASE_GET_CONFIG);
+
+// Report the dynamic memory (oids, move pools): size, used and free
+// bytes and the largest allocation, so the host can size the move
+// queues of the board (see move_request_pool())
+uint8_t *command_get_dynmem(uint8_t *start, uint8_t *end) {
+    void *mstart = dynmem_start(), *mend = dynmem_end();
+    send_base_get_dynmem(mend - mstart, alloc_end - mstart, mend - alloc_end
+                         , alloc_largest);
+    return ++start;
+}
+DECL_COMMAND(command_get_dynmem, TYPE_BASE_GET_DYNMEM);
 
 uint8_t *command_finalize_config(uint8_t *start, uint8_t *end) {
     move_finalize();
     config_crc = *(++start);
 	return start;
 }
+DECL_COMMAND(command_finalize_config, TYPE_BASE_FINALIZE_CONFIG);
 
 uint8_t *command_get_clock(uint8_t *start, uint8_t *end) {
-    send_response(TYPE_BASE_GET_CLOCK, timer_read_time());
+    send_base_get_clock(timer_read_time());
 	return ++start;
 }
+DECL_COMMAND(command_get_clock, TYPE_BASE_GET_CLOCK);
 
 uint8_t *command_get_uptime(uint8_t *start, uint8_t *end) {
     uint32_t cur = timer_read_time();
     uint32_t high = stats_send_time_high + (cur < stats_send_time);
-    send_response(TYPE_BASE_GET_UPTIME, high, cur);
+    send_base_get_uptime(high, cur);
 	return ++start;
 }
+DECL_COMMAND(command_get_uptime, TYPE_BASE_GET_UPTIME);
 
 uint8_t *command_emergency_stop(uint8_t *start, uint8_t *end) {
     sched_shutdown(ERROR_CMD_REQ);
 	return ++start;
 }
+DECL_COMMAND(command_emergency_stop, TYPE_BASE_EMERGENCY_STOP);
 
 uint8_t *command_clear_shutdown(uint8_t *start, uint8_t *end) {
     sched_clear_shutdown();
 	return ++start;
 }
+DECL_COMMAND(command_clear_shutdown, TYPE_BASE_CLEAR_SHUTDOWN);
+
+// Dump (and optionally reset) a chunk of a timing histogram: id, reset,
+// pos (first bucket, vlq)
+uint8_t *command_hist(uint8_t *start, uint8_t *end) {
+    uint8_t id = *(++start);
+    uint8_t reset = *(++start);
+    start++;
+    uint32_t pos = vlq_decode(&start);
+    if (id < HIST_NO)
+        hist_send(id, reset, pos > HIST_BUCKETS ? HIST_BUCKETS : pos);
+    return start;
+}
+DECL_COMMAND(command_hist, TYPE_BASE_HIST);
+
+// Report the move pools occupancy now: reset (of the peaks)
+uint8_t *command_move_pool(uint8_t *start, uint8_t *end) {
+    uint8_t reset = *(++start);
+    move_report(reset);
+    return ++start;
+}
+DECL_COMMAND(command_move_pool, TYPE_BASE_MOVE_POOL);
 
 uint8_t *command_identify(uint8_t *start, uint8_t *end) {
 	start++;
     uint32_t offset = vlq_decode(&start);
     uint8_t count = *start++;
-    uint32_t isize = TYPE_NO;
+    uint32_t isize = command_identify_size;
     if (offset >= isize)
         count = 0;
     else if (offset + count > isize)
         count = isize - offset;
-    // TODO send_response(TYPE_BASE_IDENTIFY, offset, count, &command_identify_data[offset]);
+    send_base_identify(offset, count, &command_identify_data[offset]);
 	return start;
 }
+DECL_COMMAND(command_identify, TYPE_BASE_IDENTIFY);
 
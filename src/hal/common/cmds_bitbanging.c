@@ -8,59 +8,102 @@
 #include "cmds_bitbanging.h"
 
 #include "cmds_base.h" // alloc_chunk
+#include "sched.h" // DECL_END
 
 
 /****************************************************************
  * Soft PWM output pins
  ****************************************************************/
 
+// The channels with the same cycle time share a group and its timer:
+// every cycle starts with the toggling channels turned on, then the
+// timer walks the channels, sorted by on duration, turning them off.
+// The edges due within 1/SOFT_PWM_WINDOW of a cycle are written in one
+// event, so n channels cost at most n + 1 wake ups per cycle (one when
+// their duties are close). New settings are loaded at the start of the
+// first cycle at or after their time.
+
+#define SOFT_PWM_WINDOW 128
+
 enum {
     SPF_ON=1<<0, SPF_TOGGLING=1<<1, SPF_CHECK_END=1<<2, SPF_HAVE_NEXT=1<<3,
     SPF_NEXT_ON=1<<4, SPF_NEXT_TOGGLING=1<<5, SPF_NEXT_CHECK_END=1<<6,
 };
 
-static uint_fast8_t soft_pwm_load_event(struct timer_s *timer);
-
-// Normal pulse change event
-static uint_fast8_t soft_pwm_toggle_event(struct timer_s *timer) {
-    struct pwm_software_s *s = container_of(timer, struct pwm_software_s, timer);
-    gpio_out_toggle_noirq(s->pin);
-    s->flags ^= SPF_ON;
-    uint32_t waketime = s->timer.waketime;
-    if (s->flags & SPF_ON)
-        waketime += s->on_duration;
-    else
-        waketime += s->off_duration;
-    if (s->flags & SPF_CHECK_END && !timer_is_before(waketime, s->end_time)) {
-        // End of normal pulsing - next event loads new pwm settings
-        s->timer.func = soft_pwm_load_event;
-        waketime = s->end_time;
+// Sort the channels by on duration (insertion, there are a few)
+static void soft_pwm_sort(struct soft_pwm_group *g) {
+    struct pwm_software_s *sorted = NULL, *s = g->chans;
+    while (s) {
+        struct pwm_software_s *next = s->next, **pp = &sorted;
+        while (*pp && (*pp)->on_duration <= s->on_duration)
+            pp = &(*pp)->next;
+        s->next = *pp;
+        *pp = s;
+        s = next;
     }
-    s->timer.waketime = waketime;
-    return SF_RESCHEDULE;
+    g->chans = sorted;
 }
 
 // Load next pwm settings
-static uint_fast8_t soft_pwm_load_event(struct timer_s *timer) {
-    struct pwm_software_s *s = container_of(timer, struct pwm_software_s, timer);
-    if (!(s->flags & SPF_HAVE_NEXT))
-        sched_shutdown(ERROR_MISSED_PWM_EVENT);
+static void soft_pwm_load(struct pwm_software_s *s) {
     uint8_t flags = s->flags >> 4;
     s->flags = flags;
     gpio_out_write(s->pin, flags & SPF_ON);
-    if (!(flags & SPF_TOGGLING)) {
-        // Pin is in an always on (value=256) or always off (value=0) state
-        if (!(flags & SPF_CHECK_END))
-            return SF_DONE;
-        s->timer.waketime = s->end_time = s->end_time + s->max_duration;
-        return SF_RESCHEDULE;
-    }
-    // Schedule normal pin toggle timer events
-    s->timer.func = soft_pwm_toggle_event;
-    s->off_duration = s->next_off_duration;
-    s->on_duration = s->next_on_duration;
-    s->timer.waketime = s->end_time + s->on_duration;
+    s->on_duration = flags & SPF_TOGGLING ? s->next_on_duration : 0;
     s->end_time += s->max_duration;
+}
+
+// Start of a cycle: load the due settings, turn the toggling channels on
+static uint_fast8_t soft_pwm_cycle(struct soft_pwm_group *g, uint32_t now) {
+    struct pwm_software_s *s;
+    uint8_t resort = 0, active = 0;
+    for (s = g->chans; s; s = s->next) {
+        if (!(s->flags & SPF_CHECK_END) || timer_is_before(now, s->end_time))
+            continue;
+        if (!(s->flags & SPF_HAVE_NEXT))
+            sched_shutdown(ERROR_MISSED_PWM_EVENT);
+        soft_pwm_load(s);
+        resort = 1;
+    }
+    if (resort)
+        soft_pwm_sort(g);
+    g->cycle_start = now;
+    g->edge = NULL;
+    for (s = g->chans; s; s = s->next) {
+        if (s->flags & (SPF_TOGGLING | SPF_CHECK_END))
+            active = 1;
+        if (!(s->flags & SPF_TOGGLING))
+            continue;
+        if (!(s->flags & SPF_ON))
+            // (just loaded ones are on already)
+            gpio_out_toggle_noirq(s->pin);
+        s->flags |= SPF_ON;
+        if (!g->edge)
+            g->edge = s;
+    }
+    if (!active) {
+        g->running = 0;
+        return SF_DONE;
+    }
+    g->timer.waketime = now + (g->edge ? g->edge->on_duration : g->cycle_time);
+    return SF_RESCHEDULE;
+}
+
+// Group timer: a cycle start, or the channels to turn off
+static uint_fast8_t soft_pwm_event(struct timer_s *timer) {
+    struct soft_pwm_group *g = container_of(timer, struct soft_pwm_group, timer);
+    struct pwm_software_s *s = g->edge;
+    if (!s)
+        return soft_pwm_cycle(g, timer->waketime);
+    uint32_t until = timer->waketime - g->cycle_start
+                     + g->cycle_time / SOFT_PWM_WINDOW;
+    do {
+        gpio_out_toggle_noirq(s->pin);
+        s->flags &= ~SPF_ON;
+        s = s->next;
+    } while (s && s->on_duration <= until);
+    g->edge = s;
+    timer->waketime = g->cycle_start + (s ? s->on_duration : g->cycle_time);
     return SF_RESCHEDULE;
 }
 
@@ -69,38 +112,98 @@ static uint_fast8_t soft_pwm_load_event(struct timer_s *timer) {
  * Soft SPI
  ****************************************************************/
 
+// One transfer routine per clock phase and bit order, picked by
+// spi_sw_setup(), with the 8 bits of a byte unrolled. The clock is
+// toggled, so its polarity (the idle level) only matters to
+// spi_sw_prepare(). On AVR the pins are accessed through their ports
+// with the irqs off for a byte: sclk toggles with a write to its PIN
+// register, mosi is a read-modify-write of its PORT.
+
+#if CONFIG_MACH_AVR
+static inline void spi_sw_clk(struct gpio_out g) {
+    g.regs->in = g.bit;
+}
+
+static inline void spi_sw_out(struct gpio_out g, uint8_t val) {
+    if (val)
+        g.regs->out |= g.bit;
+    else
+        g.regs->out &= ~g.bit;
+}
+
+static inline uint8_t spi_sw_in(struct gpio_in g) {
+    return g.regs->in & g.bit;
+}
+#else
+static inline void spi_sw_clk(struct gpio_out g) {
+    gpio_out_toggle_noirq(g);
+}
+
+static inline void spi_sw_out(struct gpio_out g, uint8_t val) {
+    gpio_out_write(g, val);
+}
+
+static inline uint8_t spi_sw_in(struct gpio_in g) {
+    return gpio_in_read(g);
+}
+#endif
+
+// Bit 'i' of the byte (in the bit order): mosi is set before the leading
+// edge with cpha 0, after it with cpha 1, miso is sampled on the other
+#define SPI_SW_BIT(cpha, lsb, i) do {                   \
+        uint8_t m = (lsb) ? 0x01 << (i) : 0x80 >> (i);  \
+        if (cpha)                                       \
+            spi_sw_clk(sclk);                           \
+        spi_sw_out(mosi, out & m);                      \
+        spi_sw_clk(sclk);                               \
+        if (spi_sw_in(miso))                            \
+            in |= m;                                    \
+        if (!cpha)                                      \
+            spi_sw_clk(sclk);                           \
+    } while (0)
+
+#define DECL_SPI_SW_TRANSFER(name, cpha, lsb)                           \
+static void name(struct spi_software_s *ss, uint8_t receive_data,      \
+                 uint8_t len, uint8_t *data) {                          \
+    struct gpio_out sclk = ss->sclk, mosi = ss->mosi;                   \
+    struct gpio_in miso = ss->miso;                                     \
+    while (len--) {                                                     \
+        uint8_t out = *data, in = 0;                                    \
+        irqstatus_t flag = irq_save();                                  \
+        SPI_SW_BIT(cpha, lsb, 0); SPI_SW_BIT(cpha, lsb, 1);             \
+        SPI_SW_BIT(cpha, lsb, 2); SPI_SW_BIT(cpha, lsb, 3);             \
+        SPI_SW_BIT(cpha, lsb, 4); SPI_SW_BIT(cpha, lsb, 5);             \
+        SPI_SW_BIT(cpha, lsb, 6); SPI_SW_BIT(cpha, lsb, 7);             \
+        irq_restore(flag);                                              \
+        if (receive_data)                                               \
+            *data = in;                                                 \
+        data++;                                                         \
+    }                                                                   \
+}
+
+DECL_SPI_SW_TRANSFER(spi_sw_transfer_msb0, 0, 0)
+DECL_SPI_SW_TRANSFER(spi_sw_transfer_msb1, 1, 0)
+DECL_SPI_SW_TRANSFER(spi_sw_transfer_lsb0, 0, 1)
+DECL_SPI_SW_TRANSFER(spi_sw_transfer_lsb1, 1, 1)
+
+void spi_sw_setup(struct spi_software_s *ss, uint8_t mode) {
+    if (mode & ~(SPI_SW_CPHA|SPI_SW_CPOL|SPI_SW_LSB_FIRST))
+        sched_shutdown(ERROR_SPI_CONFIG_INVALID);
+    ss->mode = mode;
+    if (mode & SPI_SW_LSB_FIRST)
+        ss->transfer = mode & SPI_SW_CPHA
+            ? spi_sw_transfer_lsb1 : spi_sw_transfer_lsb0;
+    else
+        ss->transfer = mode & SPI_SW_CPHA
+            ? spi_sw_transfer_msb1 : spi_sw_transfer_msb0;
+}
+
 void spi_sw_prepare(struct spi_software_s *ss) {
-    gpio_out_write(ss->sclk, ss->mode & 0x02);
+    gpio_out_write(ss->sclk, ss->mode & SPI_SW_CPOL);
 }
 
 void spi_sw_transfer(struct spi_software_s *ss, uint8_t receive_data, uint8_t len, uint8_t *data) {
-    while (len--) {
-        uint8_t outbuf = *data;
-        uint8_t inbuf = 0;
-        for (uint_fast8_t i = 0; i < 8; i++) {
-            if (ss->mode & 0x01) {
-                // MODE 1 & 3
-                gpio_out_toggle(ss->sclk);
-                gpio_out_write(ss->mosi, outbuf & 0x80);
-                outbuf <<= 1;
-                gpio_out_toggle(ss->sclk);
-                inbuf <<= 1;
-                inbuf |= gpio_in_read(ss->miso);
-            } else {
-                // MODE 0 & 2
-                gpio_out_write(ss->mosi, outbuf & 0x80);
-                outbuf <<= 1;
-                gpio_out_toggle(ss->sclk);
-                inbuf <<= 1;
-                inbuf |= gpio_in_read(ss->miso);
-                gpio_out_toggle(ss->sclk);
-            }
-        }
-
-        if (receive_data)
-            *data = inbuf;
-        data++;
-    }
+    ss->transfer(ss, receive_data, len, data);
 }
 
 
@@ -114,30 +217,52 @@ void task_end_soft_pwm(void) {
     foreach_oid(i, s, command_config_soft_pwm_out) {
         gpio_out_write(s->pin, s->default_value);
         s->flags = s->default_value ? SPF_ON : 0;
+        s->on_duration = 0;
+        s->group->running = 0;
+        s->group->edge = NULL;
     }
 }
+DECL_END(task_end_soft_pwm);
 
 void command_config_soft_pwm_out(uint32_t *args) {
     struct gpio_out pin = gpio_out_setup(args[1], !!args[3]);
+    uint32_t cycle_time = args[2];
+    // join the group of the channels with the same cycle time
+    struct soft_pwm_group *g = NULL;
+    uint8_t i;
+    struct pwm_software_s *c;
+    foreach_oid(i, c, command_config_soft_pwm_out) {
+        if (c->group->cycle_time == cycle_time)
+            g = c->group;
+    }
+    if (!g) {
+        g = alloc_chunk(sizeof(*g));
+        g->timer.func = soft_pwm_event;
+        g->cycle_time = cycle_time;
+        // edges may be ~1.5% of a cycle late (waketimes don't drift)
+        sched_timer_slack(&g->timer, cycle_time / 64);
+    }
     struct pwm_software_s *s = oid_alloc(args[0], command_config_soft_pwm_out, sizeof(*s));
     s->pin = pin;
-    s->cycle_time = args[2];
+    s->group = g;
     s->default_value = !!args[4];
     s->max_duration = args[5];
     s->flags = s->default_value ? SPF_ON : 0;
+    s->next = g->chans;     // on duration 0, first
+    g->chans = s;
 }
 
 void command_schedule_soft_pwm_out(uint32_t *args) {
     struct pwm_software_s *s = oid_lookup(args[0], command_config_soft_pwm_out);
-    uint32_t time = args[1], next_on_duration = args[2], next_off_duration;
+    struct soft_pwm_group *g = s->group;
+    uint32_t time = args[1], next_on_duration = args[2];
     uint8_t next_flags = SPF_CHECK_END | SPF_HAVE_NEXT;
-    if (next_on_duration == 0 || next_on_duration >= s->cycle_time) {
+    if (next_on_duration == 0 || next_on_duration >= g->cycle_time) {
         next_flags |= next_on_duration ? SPF_NEXT_ON : 0;
         if (!!next_on_duration != s->default_value && s->max_duration)
             next_flags |= SPF_NEXT_CHECK_END;
-        next_on_duration = next_off_duration = 0;
+        next_on_duration = 0;
     } else {
-        next_off_duration = s->cycle_time - next_on_duration;
         next_flags |= SPF_NEXT_ON | SPF_NEXT_TOGGLING;
         if (s->max_duration)
             next_flags |= SPF_NEXT_CHECK_END;
@@ -147,17 +272,13 @@ void command_schedule_soft_pwm_out(uint32_t *args) {
         sched_shutdown(ERROR_NEXT_PWM_EXTENDS);
     s->end_time = time;
     s->next_on_duration = next_on_duration;
-    s->next_off_duration = next_off_duration;
     s->flags = (s->flags & 0xf) | next_flags;
-    if (s->flags & SPF_TOGGLING && timer_is_before(s->timer.waketime, time)) {
-        // soft_pwm_toggle_event() will schedule a load event when ready
-    } else {
-        // Schedule the loading of the pwm parameters at the requested time
-        sched_del_timer(&s->timer);
-        s->timer.waketime = time;
-        s->timer.func = soft_pwm_load_event;
-        sched_add_timer(&s->timer);
+    if (!g->running) {
+        // Start the group's cycles at the requested time
+        g->running = 1;
+        g->edge = NULL;
+        g->timer.waketime = time;
+        sched_add_timer(&g->timer);
     }
     irq_enable();
 }
-
@@ -10,6 +10,7 @@
 
 #include "sched.h" // sched_shutdown
 #include "generic_io.h" // readl
+#include "messages.h" // send_debug_read
 
 
 /****************************************************************
@@ -53,15 +54,17 @@ uint8_t *command_debug_read(uint8_t *start, uint8_t *end) {
     case 2:          v = readl(ptr); break;
     }
     irq_restore(flag);
-    send_response(TYPE_DEBUG_READ, v);
+    send_debug_read(v);
 	return start;
 }
 
 uint8_t *command_debug_write(uint8_t *start, uint8_t *end) {
 	start++;
     uint8_t order = *start++;
-    void *ptr = (void*)(size_t)vlq_decode(&start);
-    uint32_t v = vlq_decode(&start);
+    uint32_t args[2]; // address, value
+    vlq_decode_n(&start, args, 2);
+    void *ptr = (void*)(size_t)args[0];
+    uint32_t v = args[1];
     irqstatus_t flag = irq_save();
     switch (order) {
     default: case 0: writeb(ptr, v); break;
@@ -76,7 +79,7 @@ uint8_t *command_debug_ping(uint8_t *start, uint8_t *end) {
 	start++;
     uint8_t len = *start++;
     void *data = (void*)(size_t)vlq_decode(&start);
-    send_response(TYPE_DEBUG_PING, len, data);
+    send_debug_ping(len, data);
 	return start;
 }
 
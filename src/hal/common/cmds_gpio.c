@@ -47,6 +47,7 @@ void task_end_digital_out(void) {
         gpio_out_write(d->pin, d->default_value);
     }
 }
+DECL_END(task_end_digital_out);
 
 void command_config_digital_out(uint32_t *args) {
     struct gpio_out pin = gpio_out_setup(args[1], args[2]);
@@ -6,7 +6,8 @@
 
 #include "cmds_i2c.h" //
 
-#include "sched.h" // send_response, sched_shutdown
+#include "sched.h" // sched_shutdown
+#include "messages.h" // send_i2c_read
 #include "cmds_base.h" // oid_alloc
 
 struct i2cdev_s {
@@ -41,7 +42,7 @@ void command_i2c_read(uint32_t * args) {
     uint8_t receive_array[data_len];
     uint8_t *data = (void*)(size_t)receive_array;
     i2c_read(i2c->i2c_config, reg_len, reg, data_len, data);
-    send_response(TYPE_I2C_READ, oid, data_len, data);
+    send_i2c_read(oid, data_len, data);
 }
 
 void command_i2c_modify_bits(uint32_t *args) {
@@ -42,6 +42,7 @@ void task_end_pwm(void) {
         gpio_pwm_write(p->pin, p->default_value);
     }
 }
+DECL_END(task_end_pwm);
 
 void command_config_pwm_out(uint32_t *args) {
     struct gpio_pwm pin = gpio_pwm_setup(args[1], args[2], args[3]);
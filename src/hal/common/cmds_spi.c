@@ -9,6 +9,8 @@
 #include "cmds_spi.h" //
 
 #include "cmds_base.h" // oid_alloc
+#include "sched.h" // DECL_END
+#include "messages.h" // send_spi_transfer
 
 
 /****************************************************************
@@ -25,6 +27,30 @@ struct spidev_shutdown_s {
     uint8_t shutdown_msg[];
 };
 
+// Transfers queued by the host, run by task_spi_queue(): the queued
+// transfers of all the devices go out in one task pass, and their
+// responses in one transmit block. Each queue oid has its own move pool
+// (see move_request_pool()), so its depth is reported to the host and a
+// busy device can't take the items of the others.
+struct spi_queued_s {
+    struct spi_queued_s *next;
+    uint8_t flags, len;
+    uint8_t data[];
+};
+
+struct spidev_queue_s {
+    struct spidev_s *spi;
+    struct move_pool *pool;
+    struct spi_queued_s *first, *last;
+    uint8_t spi_oid, max_len;
+};
+
+enum {
+    SQF_RECEIVE = 1,
+};
+
+static struct task_wake spi_queue_wake;
+
 struct spidev_s * spidev_oid_lookup(uint8_t oid) {
     return oid_lookup(oid, command_config_spi);
 }
@@ -58,6 +84,20 @@ void spi_transfer(struct spidev_s *spi, uint8_t receive_data, uint8_t data_len,
         gpio_out_write(spi->pin, 1);
 }
 
+// run the transfers queued on 'q', in order
+static void spi_queue_run(struct spidev_queue_s *q) {
+    struct spi_queued_s *t;
+    while ((t = q->first)) {
+        spi_transfer(q->spi, t->flags & SQF_RECEIVE, t->len, t->data);
+        if (t->flags & SQF_RECEIVE)
+            send_spi_transfer(q->spi_oid, t->len, t->data);
+        irqstatus_t flag = irq_save();
+        q->first = t->next;
+        move_pool_free(q->pool, t);
+        irq_restore(flag);
+    }
+}
+
 
 /****************************************************************
  * tasks and commands
@@ -72,12 +112,30 @@ void task_end_spidev(void) {
             gpio_out_write(spi->pin, 1);
     }
 
+    // Drop the queued transfers (task_end_move() refills the pools)
+    struct spidev_queue_s *q;
+    foreach_oid(oid, q, command_config_spi_queue) {
+        q->first = q->last = NULL;
+    }
+
     // Send shutdown messages
     struct spidev_shutdown_s *sd;
     foreach_oid(oid, sd, command_config_spi_shutdown) {
         spi_transfer(sd->spi, 0, sd->shutdown_msg_len, sd->shutdown_msg);
     }
 }
+DECL_END(task_end_spidev);
+
+void task_spi_queue(void) {
+    if (!sched_check_wake(&spi_queue_wake))
+        return;
+    uint8_t oid;
+    struct spidev_queue_s *q;
+    foreach_oid(oid, q, command_config_spi_queue) {
+        spi_queue_run(q);
+    }
+}
+DECL_TASK(task_spi_queue, &spi_queue_wake);
 
 void command_config_spi(uint32_t *args) {
     struct spidev_s *spi = oid_alloc(args[0], command_config_spi, sizeof(*spi));
@@ -99,15 +157,12 @@ void command_spi_set_bus(uint32_t *args) {
 }
 
 void command_spi_set_software_bus(uint32_t *args) {
-    uint8_t mode = args[4];
-    if (mode > 3) sched_shutdown(ERROR_SPI_CONFIG_INVALID);
-
     struct spidev_s *spi = spidev_oid_lookup(args[0]);
     struct spi_software_s *ss = alloc_chunk(sizeof(*ss));
+    spi_sw_setup(ss, args[4]);
     ss->miso = gpio_in_setup(args[1], 1);
     ss->mosi = gpio_out_setup(args[2], 0);
     ss->sclk = gpio_out_setup(args[3], 0);
-    ss->mode = mode;
     spi_set_software_bus(spi, ss);
 }
 
@@ -117,7 +172,7 @@ void command_spi_transfer(uint32_t *args) {
     uint8_t data_len = args[1];
     uint8_t *data = (void*)(size_t)args[2];
     spi_transfer(spi, 1, data_len, data);
-    send_response(TYPE_SPI_TRANSFER, oid, data_len, data);
+    send_spi_transfer(oid, data_len, data);
 }
 
 void command_spi_send(uint32_t *args) {
@@ -138,3 +193,32 @@ void command_config_spi_shutdown(uint32_t *args) {
     memcpy(sd->shutdown_msg, shutdown_msg, shutdown_msg_len);
 }
 
+void command_config_spi_queue(uint32_t *args) {
+    struct spidev_s *spi = spidev_oid_lookup(args[1]);
+    uint8_t max_len = args[2];
+    struct spidev_queue_s *q = oid_alloc(
+        args[0], command_config_spi_queue, sizeof(*q));
+    q->spi = spi;
+    q->pool = move_request_pool(args[0], sizeof(struct spi_queued_s) + max_len, 1);
+    q->spi_oid = args[1];
+    q->max_len = max_len;
+}
+
+void command_spi_queue_transfer(uint32_t *args) {
+    struct spidev_queue_s *q = oid_lookup(args[0], command_config_spi_queue);
+    uint8_t data_len = args[2];
+    if (data_len > q->max_len)
+        sched_shutdown(ERROR_SPI_CONFIG_INVALID);
+    // ERROR_MOVE_Q_EMPTY if the host queued more than the pool holds
+    struct spi_queued_s *t = move_pool_alloc(q->pool);
+    memcpy(t->data, (void*)(size_t)args[3], data_len);
+    t->len = data_len;
+    t->flags = args[1] ? SQF_RECEIVE : 0;
+    t->next = NULL;
+    if (q->first)
+        q->last->next = t;
+    else
+        q->first = t;
+    q->last = t;
+    sched_wake_task(&spi_queue_wake);
+}
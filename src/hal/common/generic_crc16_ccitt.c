@@ -6,16 +6,16 @@
 
 #include "generic_crc16_ccitt.h"
 
-// Implement the standard crc "ccitt" algorithm on the given buffer
+#include "platform.h" // CONFIG_CRC16_TABLE, PROGMEM
+
+#define CRC16_PROGMEM PROGMEM
+#define CRC16_READP(VAR) READP(VAR)
+#include "crc16.h" // crc16_ccitt_fast
+
+// Implement the standard crc "ccitt" algorithm on the given buffer, by
+// table (and clmul) if the board has the flash for it (see crc16.h)
 uint16_t crc16_ccitt(uint8_t *buf, uint_fast8_t len) {
-    uint16_t crc = 0xffff;
-    while (len--) {
-        uint8_t data = *buf++;
-        data ^= crc & 0xff;
-        data ^= data << 4;
-        crc = ((((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4)
-               ^ ((uint16_t)data << 3));
-    }
-    return crc;
+    if (CONFIG_CRC16_TABLE)
+        return crc16_ccitt_fast(buf, len);
+    return crc16_ccitt_shift(buf, len);
 }
-
@@ -4,17 +4,37 @@
 //
 // This file may be distributed under the terms of the GNU GPLv3 license.
 
+#include <stdlib.h> // calloc
+
 #include "generic_dynpool.h"
 
-static char dynmem_pool[20 * 1024];
+#include "platform.h" // CONFIG_DYNMEM_SIZE
+
+static char *dynmem_pool;
+static size_t dynmem_size;
+
+// Allocate the memory available for dynamic allocations: 'size' bytes,
+// CONFIG_DYNMEM_SIZE if 0 (see the -m option of main.linux.c)
+int dynmem_setup(size_t size) {
+    if (!size)
+        size = CONFIG_DYNMEM_SIZE;
+    char *pool = calloc(1, size);
+    if (!pool)
+        return -1;
+    free(dynmem_pool);
+    dynmem_pool = pool;
+    dynmem_size = size;
+    return 0;
+}
 
 // Return the start of memory available for dynamic allocations
 void *dynmem_start(void) {
+    if (!dynmem_pool)
+        dynmem_setup(0);
     return dynmem_pool;
 }
 
 // Return the end of memory available for dynamic allocations
 void *dynmem_end(void) {
-    return &dynmem_pool[sizeof(dynmem_pool)];
+    return dynmem_start() + dynmem_size;
 }
-
@@ -20,4 +20,5 @@ void task_init_initial_pins(void) {
         gpio_out_setup(READP(ip->pin), READP(ip->flags) & IP_OUT_HIGH);
     }
 }
+DECL_INIT(task_init_initial_pins, INIT_DEVICE);
 
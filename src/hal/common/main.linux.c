@@ -4,9 +4,15 @@
 //
 // This file may be distributed under the terms of the GNU GPLv3 license.
 
+#define _GNU_SOURCE
 #include </usr/include/sched.h> // sched_setscheduler
+#include <errno.h> // EPERM
+#include <pthread.h> // pthread_create
 #include <stdio.h> // fprintf
+#include <stdlib.h> // atoi
 #include <string.h> // memset
+#include <sys/mman.h> // mlockall
+#include <time.h> // clock_nanosleep
 #include <unistd.h> // getopt
 
 #include "initial_pins.h"
@@ -14,6 +20,7 @@
 #include "sched.h"
 #include "cmd.h"
 #include "cmds_base.h"
+#include "messages.h"
 #include "cmds_debug.h"
 #include "cmds_gpio.h"
 #include "cmds_pwm.h"
@@ -24,81 +31,44 @@
 
 
 /****************************************************************
- * function pointer arrays
+ * Real-time setup
  ****************************************************************/
 
-void funcs_init(void) {
-	// init functions
-	initFunc[0] = task_init_alloc;
-	initFunc[1] = task_init_timer;
-
-	// task functions
-	taskFunc[0] = task_analog_in;
-#ifdef CONFIG_ASDASDDASDASDA
-	taskFunc[1] = task_thermocouple;
-#else
-	taskFunc[1] = task_noop;
-#endif
-	taskFunc[2] = timespec_update;
-	taskFunc[3] = task_console_rx;
-	taskFunc[4] = task_watchdog;
-
-	// end functions
-	endFunc[0] = task_end_tx;
-	endFunc[1] = task_end_move;
-	endFunc[2] = task_end_analog_in;
-	endFunc[3] = task_end_spidev;
-	endFunc[4] = task_end_pwm;
-
-	// command functions TODO
-	cmdFunc[TYPE_BASE_IDENTIFY] = command_identify;
-	cmdFunc[TYPE_BASE_ALLOCATE_OIDS] = command_allocate_oids;
-	cmdFunc[TYPE_BASE_GET_CONFIG] = command_get_config;
-	cmdFunc[TYPE_BASE_FINALIZE_CONFIG] = command_finalize_config;
-	cmdFunc[TYPE_BASE_GET_CLOCK] = command_get_clock;
-	cmdFunc[TYPE_BASE_GET_UPTIME] = command_get_uptime;
-	cmdFunc[TYPE_BASE_EMERGENCY_STOP] = command_emergency_stop;
-	cmdFunc[TYPE_BASE_CLEAR_SHUTDOWN] = command_clear_shutdown;
-	cmdFunc[TYPE_BASE_RESET] = command_unknown;
-	cmdFunc[TYPE_DEBUG_START_GROUP] = command_unknown;
-	cmdFunc[TYPE_DEBUG_END_GROUP] = command_unknown;
-	cmdFunc[TYPE_DEBUG_NOP] = command_unknown;
-	cmdFunc[TYPE_DEBUG_PING] = command_unknown;
-	cmdFunc[TYPE_DEBUG_READ] = command_unknown;
-	cmdFunc[TYPE_DEBUG_WRITE] = command_unknown;
-	cmdFunc[TYPE_GPIO_CONFIG] = command_unknown;
-	cmdFunc[TYPE_GPIO_SCHEDULE] = command_unknown;
-	cmdFunc[TYPE_GPIO_UPDATE] = command_unknown;
-	cmdFunc[TYPE_GPIO_SET] = command_unknown;
-	cmdFunc[TYPE_GPIO_SOFTPWM_CONFIG] = command_unknown;
-	cmdFunc[TYPE_GPIO_SOFTPWM_SCHEDULE] = command_unknown;
-	cmdFunc[TYPE_PWM_CONFIG] = command_unknown;
-	cmdFunc[TYPE_PWM_SCHEDULE] = command_unknown;
-	cmdFunc[TYPE_PWM_SET] = command_unknown;
-	cmdFunc[TYPE_ADC_CONFIG] = command_unknown;
-	cmdFunc[TYPE_ADC_QUERY] = command_unknown;
-	cmdFunc[TYPE_I2C_CONFIG] = command_unknown;
-	cmdFunc[TYPE_I2C_MODBITS] = command_unknown;
-	cmdFunc[TYPE_I2C_READ] = command_unknown;
-	cmdFunc[TYPE_I2C_WRITE] = command_unknown;
-	cmdFunc[TYPE_SPI_CONFIG] = command_unknown;
-	cmdFunc[TYPE_SPI_CONFIG_NOCS] = command_unknown;
-	cmdFunc[TYPE_SPI_SET] = command_unknown;
-	cmdFunc[TYPE_SPI_TRANSFER] = command_unknown;
-	cmdFunc[TYPE_SPI_SEND] = command_unknown;
-	cmdFunc[TYPE_SPI_SHUTDOWN] = command_unknown;
-}
+#define RT_STACK_PREFAULT (512*1024)
 
+struct realtime_cfg {
+    int prio;      // SCHED_FIFO priority
+    int cpu;       // cpu to pin to (-1: any), ideally isolated (isolcpus=)
+    int latency;   // self-measurement period in us (0: off)
+};
 
-/****************************************************************
- * Real-time setup
- ****************************************************************/
+// Touch the stack once so later page faults don't hit the main loop
+static void noinline realtime_prefault_stack(void) {
+    volatile uint8_t dummy[RT_STACK_PREFAULT];
+    memset((void*)dummy, 0, sizeof(dummy));
+}
 
-static int realtime_setup(void) {
+static int realtime_setup(struct realtime_cfg *cfg) {
+    if (cfg->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cfg->cpu, &set);
+        int ret = sched_setaffinity(0, sizeof(set), &set);
+        if (ret < 0) {
+            report_errno("sched_setaffinity", ret);
+            return -1;
+        }
+    }
+    int ret = mlockall(MCL_CURRENT | MCL_FUTURE);
+    if (ret < 0) {
+        report_errno("mlockall", ret);
+        return -1;
+    }
+    realtime_prefault_stack();
     struct sched_param sp;
     memset(&sp, 0, sizeof(sp));
-    sp.sched_priority = 1;
-    int ret = sched_setscheduler(0, SCHED_FIFO, &sp);
+    sp.sched_priority = cfg->prio;
+    ret = sched_setscheduler(0, SCHED_FIFO, &sp);
     if (ret < 0) {
         report_errno("sched_setscheduler", ret);
         return -1;
@@ -107,6 +77,92 @@ static int realtime_setup(void) {
 }
 
 
+/****************************************************************
+ * Wakeup latency self-measurement (cyclictest style)
+ ****************************************************************/
+
+// 1us buckets, the last one collects everything above
+#define LATENCY_BUCKETS 1024
+
+static uint32_t latency_hist[LATENCY_BUCKETS];
+static uint32_t latency_max;
+
+// Sleep until an absolute deadline every 'period' us, record how late we woke up
+static void *latency_thread(void *data) {
+    struct realtime_cfg *cfg = data;
+    struct timespec next, now;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    for (;;) {
+        next.tv_nsec += cfg->latency * 1000;
+        while (next.tv_nsec >= 1000000000) {
+            next.tv_nsec -= 1000000000;
+            next.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t lat = ((int64_t)(now.tv_sec - next.tv_sec) * 1000000000
+                       + (now.tv_nsec - next.tv_nsec)) / 1000;
+        if (lat < 0)
+            lat = 0;
+        uint32_t bucket = lat < LATENCY_BUCKETS ? lat : LATENCY_BUCKETS - 1;
+        __atomic_add_fetch(&latency_hist[bucket], 1, __ATOMIC_RELAXED);
+        uint32_t max = __atomic_load_n(&latency_max, __ATOMIC_RELAXED);
+        while (lat > max && !__atomic_compare_exchange_n(
+                   &latency_max, &max, lat, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            ;
+    }
+    return NULL;
+}
+
+static int latency_setup(struct realtime_cfg *cfg) {
+    pthread_attr_t attr;
+    struct sched_param sp = { .sched_priority = cfg->prio };
+    pthread_attr_init(&attr);
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+    pthread_attr_setschedparam(&attr, &sp);
+    if (cfg->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cfg->cpu, &set);
+        pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+    }
+    pthread_t th;
+    int ret = pthread_create(&th, &attr, latency_thread, cfg);
+    pthread_attr_destroy(&attr);
+    if (ret == EPERM)
+        // not allowed to run realtime, measure anyway
+        ret = pthread_create(&th, NULL, latency_thread, cfg);
+    if (ret) {
+        report_errno("pthread_create", -ret);
+        return -1;
+    }
+    return 0;
+}
+
+// Report percentiles since last report (called from stats_update())
+void stats_report_latency(void) {
+    static uint32_t hist[LATENCY_BUCKETS];
+    uint32_t count = 0, i;
+    for (i=0; i<LATENCY_BUCKETS; i++) {
+        hist[i] = __atomic_exchange_n(&latency_hist[i], 0, __ATOMIC_RELAXED);
+        count += hist[i];
+    }
+    uint32_t max = __atomic_exchange_n(&latency_max, 0, __ATOMIC_RELAXED);
+    if (!count)
+        return;
+    // thresholds in per mille: p50, p90, p99, p99.9
+    static const uint16_t pm[] = { 500, 900, 990, 999 };
+    uint32_t pct[ARRAY_SIZE(pm)], seen = 0, j = 0;
+    for (i=0; i<LATENCY_BUCKETS && j<ARRAY_SIZE(pm); i++) {
+        seen += hist[i];
+        while (j < ARRAY_SIZE(pm) && (uint64_t)seen * 1000 >= (uint64_t)count * pm[j])
+            pct[j++] = i;
+    }
+    send_base_latency(count, pct[0], pct[1], pct[2], pct[3], max);
+}
+
+
 /****************************************************************
  * Restart
  ****************************************************************/
@@ -121,6 +177,50 @@ void command_config_reset(uint32_t *args) {
 }
 
 
+/****************************************************************
+ * Timer queue benchmark
+ ****************************************************************/
+
+// Dispatch cost against the number of active timers: each timer
+// reschedules itself at a pseudo random interval (like steppers, soft
+// pwm and adc sampling running at different rates).  Time isn't
+// waited for, timers are dispatched back to back.
+#define TIMER_BENCH_MAX 4096
+#define TIMER_BENCH_DISPATCHES 500000
+
+static struct timer_s bench_timers[TIMER_BENCH_MAX];
+static uint32_t bench_seed = 1;
+
+static uint_fast8_t bench_event(struct timer_s *t) {
+    bench_seed = bench_seed * 1103515245 + 12345;
+    t->waketime += timer_from_us(20 + (bench_seed >> 16) % 2000);
+    return SF_RESCHEDULE;
+}
+
+static void timer_bench(void) {
+    printf("%8s %12s\n", "timers", "ns/dispatch");
+    for (int n = 1; n <= TIMER_BENCH_MAX; n *= 4) {
+        irqstatus_t flag = irq_save();
+        uint32_t start = timer_read_time() + timer_from_us(1000000);
+        for (int i = 0; i < n; i++) {
+            bench_timers[i].func = bench_event;
+            bench_timers[i].waketime = start + timer_from_us(i % 2000);
+            sched_add_timer(&bench_timers[i]);
+        }
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int i = 0; i < TIMER_BENCH_DISPATCHES; i++)
+            sched_timer_dispatch();
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        for (int i = 0; i < n; i++)
+            sched_del_timer(&bench_timers[i]);
+        irq_restore(flag);
+        double ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+        printf("%8d %12.1f\n", n, ns / TIMER_BENCH_DISPATCHES);
+    }
+}
+
+
 /****************************************************************
  * Startup
  ****************************************************************/
@@ -128,8 +228,9 @@ void command_config_reset(uint32_t *args) {
 int main(int argc, char **argv) {
     // Parse program args
     orig_argv = argv;
-    int opt, watchdog = 0, realtime = 0;
-    while ((opt = getopt(argc, argv, "wr")) != -1) {
+    int opt, watchdog = 0, realtime = 0, bench = 0, dynmem = 0;
+    static struct realtime_cfg rt = { .prio = 1, .cpu = -1, .latency = 0 };
+    while ((opt = getopt(argc, argv, "wrp:c:l:bm:")) != -1) {
         switch (opt) {
         case 'w':
             watchdog = 1;
@@ -137,18 +238,60 @@ int main(int argc, char **argv) {
         case 'r':
             realtime = 1;
             break;
+        case 'p':
+            rt.prio = atoi(optarg);
+            break;
+        case 'c':
+            rt.cpu = atoi(optarg);
+            break;
+        case 'l':
+            rt.latency = atoi(optarg);
+            break;
+        case 'b':
+            bench = 1;
+            break;
+        case 'm':
+            dynmem = atoi(optarg) * 1024;
+            break;
         default:
-            fprintf(stderr, "Usage: %s [-w] [-r]\n", argv[0]);
+            fprintf(stderr, "Usage: %s [-w] [-r [-p prio] [-c cpu] [-l period_us]] [-b]"
+                    " [-m kbytes]\n"
+                    "  -r  realtime: mlockall, prefaulted stack, SCHED_FIFO\n"
+                    "  -p  SCHED_FIFO priority (default 1)\n"
+                    "  -c  pin to cpu (use an isolated one)\n"
+                    "  -l  measure wakeup latency every period_us, percentiles\n"
+                    "      are reported along with the stats\n"
+                    "  -b  timer queue benchmark, then exit\n"
+                    "  -m  dynamic memory (oids, move queues) in kbytes\n"
+                    "      (default %d)\n", argv[0], CONFIG_DYNMEM_SIZE / 1024);
             return -1;
         }
     }
+    if (rt.prio < sched_get_priority_min(SCHED_FIFO)
+        || rt.prio > sched_get_priority_max(SCHED_FIFO)) {
+        fprintf(stderr, "Invalid realtime priority %d\n", rt.prio);
+        return -1;
+    }
+    if (dynmem < 0 || dynmem_setup(dynmem)) {
+        fprintf(stderr, "Can't allocate %d bytes of dynamic memory\n", dynmem);
+        return -1;
+    }
 
     // Initial setup
     if (realtime) {
-        int ret = realtime_setup();
+        int ret = realtime_setup(&rt);
         if (ret)
             return ret;
     }
+    if (rt.latency > 0) {
+        int ret = latency_setup(&rt);
+        if (ret)
+            return ret;
+    }
+    if (bench) {
+        timer_bench();
+        return 0;
+    }
     int ret = console_setup("/tmp/klipper_host_mcu");
     if (ret)
         return -1;
@@ -0,0 +1,315 @@
+// Generated by misc/messages.py from src/hal/common/messages.txt - do not edit
+
+#include <string.h> // memcpy
+
+#include "messages.h"
+
+#include "sched.h" // vlq_encode
+#include "rxtx_irq.h" // tx_buffer_alloc
+
+// ack
+void send_ack(void) {
+    uint8_t *buf = tx_buffer_alloc(0);
+    if (buf)
+        tx_buffer_trigger(buf, 0);
+}
+
+// nak
+void send_nack(void) {
+    uint8_t *buf = tx_buffer_alloc(0);
+    if (buf)
+        tx_buffer_trigger(buf, 0);
+}
+
+// starting
+void send_start(void) {
+    uint8_t *buf = tx_buffer_alloc(1);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_START;
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// shutdown clock=%u static_string_id=%hu
+void send_shutdown_now(uint32_t clock, uint16_t static_string_id) {
+    uint8_t *buf = tx_buffer_alloc(9);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_SHUTDOWN_NOW;
+    p = vlq_encode(p, clock);
+    p = vlq_encode(p, static_string_id);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// is_shutdown static_string_id=%hu
+void send_shutdown_last(uint16_t static_string_id) {
+    uint8_t *buf = tx_buffer_alloc(4);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_SHUTDOWN_LAST;
+    p = vlq_encode(p, static_string_id);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// identify_response offset=%u data=%.*s
+void send_base_identify(uint32_t offset, uint8_t data_len, const uint8_t *data) {
+    uint_fast16_t len = 6 + 1 + data_len;
+    if (len > MSG_PAYLOAD_MAX_SIZE)
+        return;
+    uint8_t *buf = tx_buffer_alloc(len);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_IDENTIFY;
+    p = vlq_encode(p, offset);
+    *p++ = data_len;
+    for (uint_fast8_t i=0; i<data_len; i++)
+        *p++ = READP(data[i]);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// config is_config=%c crc=%u move_count=%hu is_shutdown=%c
+void send_base_get_config(uint8_t is_config, uint32_t crc, uint16_t move_count, uint8_t is_shutdown) {
+    uint8_t *buf = tx_buffer_alloc(13);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_GET_CONFIG;
+    p = vlq_encode(p, is_config);
+    p = vlq_encode(p, crc);
+    p = vlq_encode(p, move_count);
+    p = vlq_encode(p, is_shutdown);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// dynmem size=%u used=%u free=%u largest=%u
+void send_base_get_dynmem(uint32_t size, uint32_t used, uint32_t free, uint32_t largest) {
+    uint8_t *buf = tx_buffer_alloc(21);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_GET_DYNMEM;
+    p = vlq_encode(p, size);
+    p = vlq_encode(p, used);
+    p = vlq_encode(p, free);
+    p = vlq_encode(p, largest);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// clock clock=%u
+void send_base_get_clock(uint32_t clock) {
+    uint8_t *buf = tx_buffer_alloc(6);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_GET_CLOCK;
+    p = vlq_encode(p, clock);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// uptime high=%u clock=%u
+void send_base_get_uptime(uint32_t high, uint32_t clock) {
+    uint8_t *buf = tx_buffer_alloc(11);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_GET_UPTIME;
+    p = vlq_encode(p, high);
+    p = vlq_encode(p, clock);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// stats count=%u sum=%u sumsq=%u
+void send_base_stats(uint32_t count, uint32_t sum, uint32_t sumsq) {
+    uint8_t *buf = tx_buffer_alloc(16);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_STATS;
+    p = vlq_encode(p, count);
+    p = vlq_encode(p, sum);
+    p = vlq_encode(p, sumsq);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// latency count=%u p50=%u p90=%u p99=%u p999=%u max=%u
+void send_base_latency(uint32_t count, uint32_t p50, uint32_t p90, uint32_t p99, uint32_t p999, uint32_t max) {
+    uint8_t *buf = tx_buffer_alloc(31);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_LATENCY;
+    p = vlq_encode(p, count);
+    p = vlq_encode(p, p50);
+    p = vlq_encode(p, p90);
+    p = vlq_encode(p, p99);
+    p = vlq_encode(p, p999);
+    p = vlq_encode(p, max);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// profile kind=%c idx=%c func=%u count=%u sum=%u max=%u late=%u
+void send_base_profile(uint8_t kind, uint8_t idx, uint32_t func, uint32_t count, uint32_t sum, uint32_t max, uint32_t late) {
+    uint8_t *buf = tx_buffer_alloc(30);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_PROFILE;
+    p = vlq_encode(p, kind);
+    p = vlq_encode(p, idx);
+    p = vlq_encode(p, func);
+    p = vlq_encode(p, count);
+    p = vlq_encode(p, sum);
+    p = vlq_encode(p, max);
+    p = vlq_encode(p, late);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// hist id=%c sub_bits=%c max=%u pos=%hu counts=%*u
+void send_base_hist(uint8_t id, uint8_t sub_bits, uint32_t max, uint16_t pos, uint8_t counts_len, const uint32_t *counts) {
+    uint_fast16_t len = 13 + 1 + 5*counts_len;
+    if (len > MSG_PAYLOAD_MAX_SIZE)
+        return;
+    uint8_t *buf = tx_buffer_alloc(len);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_HIST;
+    p = vlq_encode(p, id);
+    p = vlq_encode(p, sub_bits);
+    p = vlq_encode(p, max);
+    p = vlq_encode(p, pos);
+    *p++ = counts_len;
+    p = vlq_encode_n(p, counts, counts_len);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// move_pool oid=%c count=%hu used=%hu peak=%hu
+void send_base_move_pool(uint8_t oid, uint16_t count, uint16_t used, uint16_t peak) {
+    uint8_t *buf = tx_buffer_alloc(12);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_BASE_MOVE_POOL;
+    p = vlq_encode(p, oid);
+    p = vlq_encode(p, count);
+    p = vlq_encode(p, used);
+    p = vlq_encode(p, peak);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// debug_result val=%u
+void send_debug_read(uint32_t val) {
+    uint8_t *buf = tx_buffer_alloc(6);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_DEBUG_READ;
+    p = vlq_encode(p, val);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// pong data=%*s
+void send_debug_ping(uint8_t data_len, const uint8_t *data) {
+    uint_fast16_t len = 1 + 1 + data_len;
+    if (len > MSG_PAYLOAD_MAX_SIZE)
+        return;
+    uint8_t *buf = tx_buffer_alloc(len);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_DEBUG_PING;
+    *p++ = data_len;
+    memcpy(p, data, data_len);
+    p += data_len;
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// analog_in_state oid=%c next_clock=%u value=%hu
+void send_adc_state(uint8_t oid, uint32_t next_clock, uint16_t value) {
+    uint8_t *buf = tx_buffer_alloc(11);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_ADC_STATE;
+    p = vlq_encode(p, oid);
+    p = vlq_encode(p, next_clock);
+    p = vlq_encode(p, value);
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// i2c_read_response oid=%c response=%*s
+void send_i2c_read(uint8_t oid, uint8_t response_len, const uint8_t *response) {
+    uint_fast16_t len = 3 + 1 + response_len;
+    if (len > MSG_PAYLOAD_MAX_SIZE)
+        return;
+    uint8_t *buf = tx_buffer_alloc(len);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_I2C_READ;
+    p = vlq_encode(p, oid);
+    *p++ = response_len;
+    memcpy(p, response, response_len);
+    p += response_len;
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+// spi_transfer_response oid=%c response=%*s
+void send_spi_transfer(uint8_t oid, uint8_t response_len, const uint8_t *response) {
+    uint_fast16_t len = 3 + 1 + response_len;
+    if (len > MSG_PAYLOAD_MAX_SIZE)
+        return;
+    uint8_t *buf = tx_buffer_alloc(len);
+    if (!buf)
+        return;
+    uint8_t *p = &buf[MSG_POS_PAYLOAD];
+    *p++ = TYPE_SPI_TRANSFER;
+    p = vlq_encode(p, oid);
+    *p++ = response_len;
+    memcpy(p, response, response_len);
+    p += response_len;
+    tx_buffer_trigger(buf, p - &buf[MSG_POS_PAYLOAD]);
+}
+
+const uint8_t command_identify_data[] PROGMEM = {
+    0x78, 0xda, 0x85, 0x92, 0xeb, 0x4e, 0xc3, 0x30, 0x0c, 0x85, 0x5f, 0x25,
+    0x8a, 0xb4, 0x3f, 0xa8, 0x42, 0xac, 0x94, 0xcb, 0x26, 0xed, 0x59, 0xaa,
+    0x2c, 0x71, 0xdb, 0x68, 0x6d, 0x52, 0xe2, 0x04, 0x36, 0xd0, 0xde, 0x1d,
+    0x3b, 0x59, 0x37, 0x24, 0x90, 0xf8, 0xe5, 0x5c, 0x4e, 0x8f, 0x3f, 0x9f,
+    0xe6, 0x4b, 0xee, 0x47, 0xaf, 0x0f, 0x28, 0xb7, 0x5f, 0x52, 0xe9, 0x83,
+    0xdc, 0x3e, 0x56, 0xd2, 0x29, 0xaa, 0xcd, 0xb9, 0x92, 0x01, 0x70, 0xf6,
+    0x0e, 0xa1, 0xdc, 0x3a, 0x35, 0xfa, 0xbe, 0xb5, 0xae, 0xc5, 0xa8, 0x22,
+    0x08, 0x6f, 0xcd, 0x6e, 0xa5, 0x85, 0x83, 0x63, 0x6c, 0x35, 0x7b, 0xec,
+    0x56, 0x49, 0xbc, 0xab, 0x31, 0xc1, 0x6e, 0x35, 0x24, 0x32, 0x6a, 0x2a,
+    0x99, 0xcf, 0xc5, 0x72, 0x2b, 0xb7, 0xeb, 0x35, 0x9d, 0x79, 0xd7, 0xd9,
+    0x5e, 0x58, 0x6c, 0xcb, 0x8a, 0x4d, 0x74, 0xd0, 0xfc, 0xf5, 0xe4, 0xdf,
+    0x81, 0x4e, 0x93, 0x8b, 0x6c, 0xc1, 0x12, 0x1c, 0x52, 0x34, 0xfe, 0xc3,
+    0x91, 0x48, 0x6e, 0x37, 0x95, 0x34, 0xb0, 0x4f, 0x7d, 0x4b, 0x5c, 0x69,
+    0x8c, 0xdc, 0x2c, 0xbb, 0xd6, 0xe4, 0x6a, 0x4e, 0x6e, 0x82, 0x49, 0xa0,
+    0xfd, 0x04, 0x76, 0x4a, 0x08, 0x86, 0x6b, 0x17, 0x20, 0xef, 0x47, 0x15,
+    0x7a, 0xc0, 0x98, 0xe5, 0x0d, 0xf9, 0x0c, 0x16, 0xa3, 0x28, 0x03, 0x60,
+    0xda, 0xb7, 0x7b, 0x1b, 0x91, 0xd7, 0x93, 0x3a, 0xb2, 0x7a, 0xf6, 0x98,
+    0x01, 0x32, 0x0a, 0x2d, 0xef, 0xf8, 0xab, 0x97, 0x4a, 0xda, 0x5a, 0x53,
+    0x6f, 0x65, 0xda, 0x25, 0x98, 0x25, 0x84, 0x65, 0x4f, 0x52, 0xca, 0xea,
+    0x91, 0xa5, 0x06, 0x5c, 0xb4, 0xdd, 0xe9, 0x87, 0xb4, 0xeb, 0x10, 0x98,
+    0x40, 0x18, 0x15, 0xd5, 0x6e, 0x75, 0xcf, 0x52, 0x56, 0xde, 0xa6, 0x14,
+    0x9c, 0xac, 0xd5, 0x14, 0x70, 0xb0, 0x8e, 0xa2, 0x36, 0x25, 0xc9, 0xe7,
+    0x4a, 0x8e, 0x94, 0xb8, 0xd3, 0x27, 0x71, 0x09, 0x87, 0x10, 0x9f, 0x1e,
+    0x72, 0xd9, 0x5c, 0xca, 0xe6, 0x52, 0x72, 0x2d, 0x63, 0x10, 0xf3, 0x53,
+    0x25, 0x73, 0xa6, 0xb3, 0xf7, 0xe3, 0xc2, 0x7a, 0xcb, 0xb7, 0x84, 0x44,
+    0x8b, 0x19, 0xd4, 0xa1, 0xb4, 0x6a, 0x5e, 0x2b, 0x49, 0xb8, 0xfd, 0x85,
+    0x91, 0x11, 0xeb, 0x07, 0x3a, 0x0a, 0xbe, 0xb3, 0x23, 0x88, 0x83, 0x75,
+    0xd9, 0xc3, 0x9a, 0x23, 0x97, 0x2e, 0xb9, 0xfc, 0xdf, 0xae, 0x54, 0x98,
+    0xa6, 0x5b, 0x7f, 0xc1, 0xd0, 0x85, 0x83, 0x26, 0xb8, 0xce, 0x78, 0x7d,
+    0x2b, 0x7f, 0x0f, 0x4b, 0xc8, 0x38, 0xdb, 0x36, 0x06, 0xe5, 0xb0, 0x83,
+    0xf0, 0x4f, 0xd4, 0x4d, 0x4d, 0xf2, 0xa8, 0x42, 0x24, 0x0b, 0x42, 0xcd,
+    0x9b, 0x88, 0xbf, 0x80, 0xa8, 0xe0, 0x5b, 0x79, 0x81, 0xe4, 0x9f, 0xe6,
+    0x68, 0x27, 0x10, 0x83, 0xed, 0x87, 0x4c, 0x7f, 0x7b, 0x9e, 0xf5, 0xf9,
+    0xfc, 0x0d, 0xd7, 0x8d, 0x05, 0x87,
+};
+
+const uint32_t command_identify_size = sizeof(command_identify_data);
@@ -4,17 +4,35 @@
 //
 // This file may be distributed under the terms of the GNU GPLv3 license.
 
-#include <string.h> // memmove
+#include <string.h> // memcpy
 
 #include "rxtx_irq.h"
 
 #include "cmd.h" // misc defines
 #include "sched.h" // sched_wake_tasks
 #include "generic_io.h" // readb/writeb
+#include "generic_irq.h" // irq_save
+#include "messages.h" // send_ack
+#include "cobs.h" // cobs_encode
 
 
-uint8_t receive_buf[MSG_RX_BUFFER_SIZE], receive_pos;
-uint8_t transmit_buf[MSG_TX_BUFFER_SIZE], transmit_pos, transmit_max;
+// Receive ring: the irq handler (or the board's read()) appends at
+// receive_head, rx_buffer_run() parses blocks from receive_tail and
+// nothing is moved. The ring holds MSG_RX_RING_SIZE-1 bytes, room for a
+// MSG_MAX block and the start of the next one. Its indices are 16 bit:
+// each side writes its own and reads the other one with the irqs off
+// (rx_index()), so an AVR irq never sees half of an update. A block
+// wrapping around the end of the ring gets its head part copied after
+// the ring (receive_buf is MSG_MAX bytes longer) and is then decoded in
+// place like the others.
+#define RX_MASK (MSG_RX_RING_SIZE - 1)
+static uint8_t receive_buf[MSG_RX_BUFFER_SIZE];
+static uint16_t receive_head, receive_tail;
+static uint16_t receive_scan;   // parse cursor: no MSG_SYNC in [tail, scan)
+// The transmit buffer is longer than 256 bytes: the main code updates
+// its 16 bit indices with the irqs off.
+uint8_t transmit_buf[MSG_TX_BUFFER_SIZE];
+uint16_t transmit_pos, transmit_max;
 
 static uint8_t next_sequence = MSG_DEST;
 
@@ -22,132 +40,96 @@ static uint8_t next_sequence = MSG_DEST;
  * Incoming message decoding and routing
  ****************************************************************/
 
-// store incoming data in receive buffer (called from irq)
+// read the index the other side updates
+static uint16_t rx_index(uint16_t *idx) {
+    irqstatus_t flag = irq_save();
+    uint16_t val = readw(idx);
+    irq_restore(flag);
+    return val;
+}
+
+// update an index the other side reads
+static void rx_index_set(uint16_t *idx, uint16_t val) {
+    irqstatus_t flag = irq_save();
+    writew(idx, val);
+    irq_restore(flag);
+}
+
+// store incoming data in receive buffer (called from irq, the main code
+// can't change receive_tail meanwhile)
 void rx_buffer_add(uint_fast8_t data) {
-    if (data == MSG_SYNC)
-        sched_wake_tasks();
-    if (receive_pos >= sizeof(receive_buf))
+    uint16_t head = receive_head;
+    uint16_t next = (head + 1) & RX_MASK;
+    if (next == readw(&receive_tail))
         // Serial overflow - ignore it as crc error will force retransmit
         return;
-    receive_buf[receive_pos++] = data;
+    receive_buf[head] = data;
+    writew(&receive_head, next);
+    if (data == MSG_SYNC)
+        sched_wake_tasks();
 }
 
-// remove from the beginning of receive buffer the given number of bytes
-void rx_buffer_clean(uint_fast8_t len) {
-    uint_fast8_t copied = 0;
-    for (;;) {
-        uint_fast8_t rpos = readb(&receive_pos);
-        uint_fast8_t needcopy = rpos - len;
-        if (needcopy) {
-            memmove(&receive_buf[copied], &receive_buf[copied + len], needcopy - copied);
-            copied = needcopy;
-            sched_wake_tasks();
-        }
-        irqstatus_t flag = irq_save();
-        if (rpos != readb(&receive_pos)) {
-            // Raced with irq handler - retry
-            irq_restore(flag);
-            continue;
-        }
-        receive_pos = needcopy;
-        irq_restore(flag);
-        break;
-    }
+// Contiguous free space at the head of the receive ring, for boards
+// reading their input in bulk (see rx_buffer_commit())
+uint_fast16_t rx_buffer_space(uint8_t **data) {
+    uint16_t head = receive_head;
+    uint_fast16_t space = (rx_index(&receive_tail) - head - 1) & RX_MASK;
+    if (space > MSG_RX_RING_SIZE - head)
+        space = MSG_RX_RING_SIZE - head;
+    *data = &receive_buf[head];
+    return space;
 }
 
-enum { CF_NEED_SYNC=1<<0, CF_NEED_VALID=1<<1 };
+// Append 'len' bytes written in the rx_buffer_space() area
+void rx_buffer_commit(uint_fast16_t len) {
+    rx_index_set(&receive_head, (receive_head + len) & RX_MASK);
+}
 
-// Find a block and decode (COBS)
-int_fast8_t rx_find_block(uint8_t *buf, uint_fast8_t buf_len, uint_fast8_t *pop_count) {
-    static uint8_t sync_state;
-    if (buf_len && sync_state & CF_NEED_SYNC) 
-		goto need_sync;
-    if (buf_len < MSG_MIN) 
-		goto need_more_data;
-	// find msg len
-	uint_fast8_t msglen = 0;
-	for(int i = 0;i<=buf_len;i++) {
-  		if(buf[i] == MSG_SYNC) {
-  			msglen = i+1;
-			break;
- 		}
-	}
-	if (msglen == 0) // no MSG_SYNC found
-		goto need_more_data;
-	if (msglen < MSG_MIN || msglen > MSG_MAX) // MSG_SYNC out of bounduaries
-		goto error;
-	// decode cobs in place
-	size_t read_index  = 0;
-	size_t write_index = 0;
-	uint8_t code       = 0;
-	uint8_t i          = 0;
-	while (read_index < msglen) {
-		code = buf[read_index];
-		if (read_index + code > msglen && code != 1) {
-			goto error;
-		}
-		read_index++;
-		for (i = 1; i < code; i++) {
-			read_index++;
-			write_index++;
-		}
-		//
-		if (code != 0xFF && read_index != msglen) {
-			buf[write_index++] = MSG_SYNC;
-		}
-	}
-	buf[0] = 0; // reset COBS code (to allow CRC check)
-	// check dest
-	uint_fast8_t msgseq = buf[MSG_POS_SEQ];
-	if ((msgseq & ~MSG_SEQ_MASK) != MSG_DEST)
-		goto error;
-	// check crc
-	uint16_t msgcrc = ((buf[msglen-MSG_TRAILER_CRC] << 8) | buf[msglen-MSG_TRAILER_CRC+1]); // crc byte
-	uint16_t crc = crc16_ccitt(buf, msglen-MSG_TRAILER_SIZE);
-	if (crc != msgcrc)
-		goto error;
-	sync_state &= ~CF_NEED_VALID;
-	*pop_count = msglen;
-	// check sequence number
-	if (msgseq != next_sequence) {
-		// lost message - discard messages until it is retransmitted
-		goto nak;
-	}
-	next_sequence = ((msgseq + 1) & MSG_SEQ_MASK) | MSG_DEST;
-	return 1;
-need_more_data:
-	*pop_count = 0;
-	return 0;
+// Check and decode (COBS, in place) a block ending with its sync byte
+static int_fast8_t rx_check_block(uint8_t *buf, uint_fast16_t msglen) {
+    static uint8_t need_valid;
+    if (msglen == 1)
+        // Ignore (do not nak) leading SYNC bytes
+        return 0;
+    if (msglen < MSG_MIN || msglen > MSG_MAX)
+        goto error;
+    // decode cobs in place
+    if (cobs_decode(buf, msglen))
+        goto error;
+    buf[0] = 0; // reset COBS code (to allow CRC check)
+    // check dest
+    uint_fast8_t msgseq = buf[MSG_POS_SEQ];
+    if ((msgseq & ~MSG_SEQ_MASK) != MSG_DEST)
+        goto error;
+    // check crc
+    uint16_t msgcrc = ((buf[msglen-MSG_TRAILER_CRC] << 8) | buf[msglen-MSG_TRAILER_CRC+1]); // crc byte
+    uint16_t crc = crc16_ccitt(buf, msglen-MSG_TRAILER_SIZE);
+    if (crc != msgcrc)
+        goto error;
+    need_valid = 0;
+    // check sequence number
+    if (msgseq != next_sequence) {
+        // lost message - discard messages until it is retransmitted
+        goto nak;
+    }
+    next_sequence = ((msgseq + 1) & MSG_SEQ_MASK) | MSG_DEST;
+    return 1;
 error:
-	if (buf[0] == MSG_SYNC) {
-		// Ignore (do not nak) leading SYNC bytes
-		*pop_count = 1;
-		return -1;
-	}
-	sync_state |= CF_NEED_SYNC;
-need_sync: ;
-		   // Discard bytes until next SYNC found
-		   uint8_t *next_sync = memchr(buf, MSG_SYNC, buf_len);
-		   if (next_sync) {
-			   sync_state &= ~CF_NEED_SYNC;
-			   *pop_count = next_sync - buf + 1;
-		   } else {
-			   *pop_count = buf_len;
-		   }
-		   if (sync_state & CF_NEED_VALID)
-			   return -1;
-		   sync_state |= CF_NEED_VALID;
+    // nak only the first invalid block until a valid one is seen
+    if (need_valid)
+        return -1;
+    need_valid = 1;
 nak:
-		   send_response(TYPE_NACK);
-		   return -1;
+    send_nack();
+    return -1;
 }
 
 // run all the commands found in a message block
-void rx_run_cmds(uint8_t *buf, uint_fast8_t msglen) {
+void rx_run_cmds(uint8_t *buf, uint_fast16_t msglen) {
 	uint8_t *start = &buf[MSG_HEADER_SIZE];
 	uint8_t *end = &buf[msglen-MSG_TRAILER_SIZE];
 	while (start < end) {
-		start = cmdFunc[*start](start, end);
+		start = command_lookup(*start)(start, end);
 		//TODO add flag check: if (sched_is_shutdown() && !(READP(cp->flags) & HF_IN_SHUTDOWN)) {
 		if (sched_is_shutdown()) {
 			sched_report_shutdown();
@@ -157,23 +139,88 @@ void rx_run_cmds(uint8_t *buf, uint_fast8_t msglen) {
 	}
 }
 
-// find a message block, decode (COBS), and then run all the commands in it
-int_fast8_t rx_find_and_run(uint8_t *buf, uint_fast8_t buf_len, uint_fast8_t *pop_count) {
-	int_fast8_t ret = rx_find_block(buf, buf_len, pop_count);
-	if (ret > 0) {
-		rx_run_cmds(buf, *pop_count);
-		send_response(TYPE_ACK);
-	}
-	return ret;
+// find the message blocks received, decode (COBS) and run the commands
+// in each one - the sync bytes are only searched from the parse cursor
+void rx_buffer_run(void) {
+    for (;;) {
+        uint16_t head = rx_index(&receive_head), tail = receive_tail;
+        uint16_t scan = receive_scan;
+        while (scan != head) {
+            // search up to head or to the end of the ring
+            uint8_t *p = &receive_buf[scan];
+            uint8_t *end = &receive_buf[head > scan ? head : MSG_RX_RING_SIZE];
+            uint8_t *s = cobs_find_sync(p, end);
+            scan = (scan + (s - p)) & RX_MASK;
+            if (s != end)
+                break;
+        }
+        if (scan == head) {
+            if (((head - tail) & RX_MASK) == MSG_RX_RING_SIZE - 1)
+                // Full without a sync byte - drop it, the crc error
+                // of the rest will force a retransmit
+                tail = head;
+            rx_index_set(&receive_tail, tail);
+            receive_scan = scan;
+            return;
+        }
+        uint_fast16_t msglen = ((scan - tail) & RX_MASK) + 1;
+        uint8_t *buf = &receive_buf[tail];
+        if (msglen > MSG_MAX) {
+            // too long (lost sync bytes), no room to unwrap it
+            rx_check_block(buf, msglen);
+        } else {
+            if (tail + msglen > MSG_RX_RING_SIZE)
+                memcpy(&receive_buf[MSG_RX_RING_SIZE], receive_buf
+                       , tail + msglen - MSG_RX_RING_SIZE);
+            if (rx_check_block(buf, msglen) > 0) {
+                rx_run_cmds(buf, msglen);
+                send_ack(); // joins the block of the commands' responses
+            }
+        }
+        scan = (scan + 1) & RX_MASK;
+        receive_scan = scan;
+        rx_index_set(&receive_tail, scan);
+    }
 }
 
 /****************************************************************
  * Outgoing message encoding
  ****************************************************************/
 
-static uint8_t in_tx;
+// Responses are appended to an open block at transmit_max, after the
+// bytes being sent: it gets its sequence, crc, COBS code and sync byte
+// once per task loop pass (task_tx_flush) or when a response doesn't
+// fit. The acks are empty appends, so they ride along on the responses
+// of the same pass and cost a block of their own only when alone.
+static uint8_t in_tx, tx_open, tx_open_len;
+static struct task_wake tx_wake;
 
-// allocate len bytes in tx buffer
+// crc, COBS encode and start the transmit of the open block
+static void tx_block_seal(void) {
+    uint8_t *buf = &transmit_buf[transmit_max];
+    uint_fast16_t msglen = tx_open_len + MSG_MIN;
+
+    // write header's sequence, the acknowledgement of the last command
+    buf[MSG_POS_SEQ] = next_sequence;
+
+    // write trailer's crc bytes
+    uint16_t crc = crc16_ccitt(buf, msglen - MSG_TRAILER_SIZE);
+    buf[msglen - MSG_TRAILER_CRC + 0] = crc >> 8;
+    buf[msglen - MSG_TRAILER_CRC + 1] = crc;
+
+    // COBS encode in place, add trailer's sync byte
+    cobs_encode(buf, msglen);
+
+    // start message transmit
+    tx_open = tx_open_len = 0;
+    irqstatus_t flag = irq_save();
+    transmit_max += msglen;
+    irq_restore(flag);
+    tx_buffer_enable_irq();
+}
+
+// allocate len bytes in the open tx block, the returned buf has them
+// at &buf[MSG_POS_PAYLOAD] (NULL: no space, the response is dropped)
 uint8_t *tx_buffer_alloc(uint_fast8_t len) {
     if (readb(&in_tx))
         // This sendf call was made from an irq handler while the main
@@ -181,82 +228,68 @@ uint8_t *tx_buffer_alloc(uint_fast8_t len) {
         return NULL;
     writeb(&in_tx, 1); // guard on
 
-	if (len > MSG_PAYLOAD_MAX_SIZE) {
-		// message too long
-		return NULL;
-	}
-    uint_fast8_t msglen = len + MSG_MIN;
+    if (len > MSG_PAYLOAD_MAX_SIZE)
+        // message too long
+        goto fail;
+    if (tx_open && tx_open_len + len > MSG_PAYLOAD_MAX_SIZE)
+        // block full
+        tx_block_seal();
+    uint_fast16_t blocklen = tx_open_len + len + MSG_MIN;
 
-    // Verify space for message
-    uint_fast8_t tpos = readb(&transmit_pos), tmax = readb(&transmit_max);
-    if (tpos >= tmax) {
-        tpos = tmax = 0;
-        writeb(&transmit_max, 0);
-        writeb(&transmit_pos, 0);
-    }
-    if (tmax + msglen > sizeof(transmit_buf)) {
-        if (tmax + msglen - tpos > sizeof(transmit_buf))
+    // Verify space for the block
+    irqstatus_t flag = irq_save();
+    uint_fast16_t tpos = transmit_pos, tmax = transmit_max;
+    uint8_t move = tmax + blocklen > sizeof(transmit_buf) || (tmax && tpos >= tmax);
+    if (move) {
+        if (tmax + blocklen - tpos > sizeof(transmit_buf)) {
             // Not enough space for message
-            return NULL;
-        // Disable TX irq and move buffer
-        writeb(&transmit_max, 0);
-        tpos = readb(&transmit_pos);
+            irq_restore(flag);
+            goto fail;
+        }
+        // Disable TX irq (transmit_pos stays put) and move the unsent
+        // bytes and the open block
+        transmit_max = 0;
+    }
+    irq_restore(flag);
+    if (move) {
+        uint_fast16_t openlen = tx_open ? MSG_HEADER_SIZE + tx_open_len : 0;
+        memmove(&transmit_buf[0], &transmit_buf[tpos], tmax - tpos + openlen);
         tmax -= tpos;
-        memmove(&transmit_buf[0], &transmit_buf[tpos], tmax);
-        writeb(&transmit_pos, 0);
-        writeb(&transmit_max, tmax);
+        flag = irq_save();
+        transmit_pos = 0;
+        transmit_max = tmax;
+        irq_restore(flag);
         tx_buffer_enable_irq();
     }
-	// write header
-    transmit_buf[tmax] = 0; // COBS code will be set after CRC
-    transmit_buf[tmax+1] = next_sequence;
-	// return buf address
-    return &transmit_buf[tmax];
+    if (!tx_open) {
+        // open a block, the sequence is set when sealed
+        transmit_buf[tmax] = 0; // COBS code will be set after CRC
+        tx_open = 1;
+        sched_wake_task(&tx_wake);
+    }
+    return &transmit_buf[tmax + tx_open_len];
+fail:
+    writeb(&in_tx, 0); // guard off
+    return NULL;
 }
 
-// encode (COBS) and transmit a "response" message
+// append the len bytes written at &buf[MSG_POS_PAYLOAD] to the open block
 void tx_buffer_trigger(uint8_t *buf, uint8_t len) {
-    uint_fast8_t msglen = len + MSG_MIN;
-
-	// write trailer's crc bytes
-    uint16_t crc = crc16_ccitt(buf, msglen - MSG_TRAILER_SIZE);
-    buf[msglen - MSG_TRAILER_CRC + 0] = crc >> 8;
-    buf[msglen - MSG_TRAILER_CRC + 1] = crc;
-
-	// COBS encode in place
-	size_t read_index  = 0;
-	size_t write_index = 1;
-	size_t code_index  = 0;
-	uint8_t code       = 1;
-	while (read_index < msglen) {
-		if (buf[read_index] == MSG_SYNC) {
-			buf[code_index] = code;
-			code = 1;
-			code_index = write_index++;
-			read_index++;
-		} else {
-			write_index++;
-			read_index++;
-			code++;
-			if (code == 0xFF) {
-				buf[code_index] = code;
-				code = 1;
-				code_index = write_index++;
-			}
-		}
-	}
-	buf[code_index] = code;
-
-	// add trailer's sync byte
-	buf[msglen - MSG_TRAILER_SYNC] = MSG_SYNC;
-
-	// start message transmit
-	writeb(&transmit_max, readb(&transmit_max) + msglen);
-	tx_buffer_enable_irq();
+    tx_open_len += len;
+    writeb(&in_tx, 0); // guard off
+}
 
-	// guard off
-    writeb(&in_tx, 0);
+// Seal the block the responses of this task loop pass went into
+void task_tx_flush(void) {
+    if (!sched_check_wake(&tx_wake))
+        return;
+    if (!tx_open)
+        return;
+    writeb(&in_tx, 1); // guard on, irq responses wait for the next block
+    tx_block_seal();
+    writeb(&in_tx, 0); // guard off
 }
+DECL_TASK(task_tx_flush, &tx_wake);
 
 // get next byte to transmit
 int tx_buffer_next(uint8_t *pdata) {
@@ -269,4 +302,5 @@ int tx_buffer_next(uint8_t *pdata) {
 void task_end_tx(void) {
     writeb(&in_tx, 0); // guard off
 }
+DECL_END(task_end_tx);
 
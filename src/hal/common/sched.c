@@ -5,7 +5,6 @@
 // This file may be distributed under the terms of the GNU GPLv3 license.
 
 #include <setjmp.h> // setjmp
-#include <stdarg.h> // va_start
 
 #include "sched.h" // sched_check_periodic
 
@@ -13,11 +12,93 @@
 #include "cmd.h" // misc defines
 #include "cmds_base.h" // stats_update
 #include "rxtx_irq.h" //
+#include "messages.h" // send_start
+
+// DECL_* tables (bounds provided by the linker)
+extern const struct init_decl __start_decl_init[], __stop_decl_init[];
+extern const struct task_decl __start_decl_task[], __stop_decl_task[];
+extern voidPtr const __start_decl_end[], __stop_decl_end[];
+extern const struct command_decl __start_decl_command[], __stop_decl_command[];
+
+// At most TASKS_MAX tasks, one bit each in the 8 bit wake bitmaps
+#define TASKS_MAX 8
+
+/****************************************************************
+ * Profiling
+ ****************************************************************/
+
+// With CONFIG_SCHED_PROFILE every task call and every timer callback
+// is timed: count, clock ticks used, longest run, and for timers the
+// worst lateness against waketime.  Timers are accounted per callback
+// (a driver's timers share one entry), in a small table - callbacks
+// beyond it are summed in the last entry.  Reported and cleared with
+// the load stats (see stats_update()).
+#define PROFILE_TIMERS 8
+
+struct profile_s {
+    voidPtr func;
+    uint32_t count, sum, max, late;
+};
+
+#if CONFIG_SCHED_PROFILE
+static struct profile_s profile_task[TASKS_MAX];
+static struct profile_s profile_timer[PROFILE_TIMERS];
+
+static void __always_inline profile_add(struct profile_s *p, uint32_t start
+                                        , uint32_t end, uint32_t late) {
+    uint32_t diff = end - start;
+    p->count++;
+    p->sum += diff;
+    if (diff > p->max)
+        p->max = diff;
+    if (late > p->late)
+        p->late = late;
+}
+
+static void profile_send(uint8_t kind, uint8_t idx, struct profile_s *p) {
+    irqstatus_t flag = irq_save();
+    struct profile_s cur = *p;
+    p->count = p->sum = p->max = p->late = 0;
+    irq_restore(flag);
+    if (!cur.count)
+        return;
+    send_base_profile(kind, idx, (uint32_t)(uintptr_t)cur.func
+                      , cur.count, cur.sum, cur.max, cur.late);
+}
+#endif
+
+static void __always_inline profile_task_add(uint8_t i, uint32_t start
+                                             , uint32_t end) {
+#if CONFIG_SCHED_PROFILE
+    profile_task[i].func = READP(__start_decl_task[i].func);
+    profile_add(&profile_task[i], start, end, 0);
+#endif
+}
+
+// Called from the timer irq, 'waketime' as it was before the callback
+static void __always_inline profile_timer_add(struct timer_s *t, uint32_t waketime
+                                              , uint32_t start, uint32_t end) {
+#if CONFIG_SCHED_PROFILE
+    voidPtr func = (voidPtr)t->func;
+    struct profile_s *p = profile_timer;
+    while (p->func != func && p->func && p < &profile_timer[PROFILE_TIMERS-1])
+        p++;
+    p->func = func;
+    uint32_t late = timer_is_before(waketime, start) ? start - waketime : 0;
+    profile_add(p, start, end, late);
+#endif
+}
+
+// Report and clear the per-entry accounting (called from stats_update())
+void sched_report_profile(void) {
+#if CONFIG_SCHED_PROFILE
+    for (uint8_t i=0; i<TASKS_MAX; i++)
+        profile_send(0, i, &profile_task[i]);
+    for (uint8_t i=0; i<PROFILE_TIMERS; i++)
+        profile_send(1, i, &profile_timer[i]);
+#endif
+}
 
-extern voidPtr initFunc[FUNCS_INIT_NO];
-extern voidPtr taskFunc[FUNCS_TASK_NO];
-extern voidPtr endFunc[FUNCS_END_NO];
-extern cmdPtr cmdFunc[TYPE_NO];
 
 /****************************************************************
  * Timers
@@ -26,6 +107,95 @@ extern cmdPtr cmdFunc[TYPE_NO];
 static struct timer_s periodic_timer, *timer_list = &periodic_timer;
 static struct timer_s sentinel_timer, deleted_timer;
 
+// Active timers are kept in a pairing heap ordered by waketime:
+// timer_list is the root (the next timer to run), a node's children
+// hang from 'child' and are chained through 'next', 'prev' points to
+// the parent (first child) or the left sibling.  Insert is O(1),
+// removing the root or any other timer is O(log n) amortized, instead
+// of walking a sorted list inside the timer irq.  A timer not in the
+// heap has a NULL 'prev' and isn't the root.
+
+// Heap order - sentinel_timer is always last (its waketime is half
+// the clock range away, so a plain compare is ambiguous), and
+// deleted_timer goes first on a tie, it stands in for the timer the
+// hardware is already programmed for
+static uint8_t __always_inline heap_before(struct timer_s *a, struct timer_s *b) {
+    if (unlikely(a == &sentinel_timer || b == &sentinel_timer))
+        return b == &sentinel_timer;
+    if (a->waketime == b->waketime)
+        return a == &deleted_timer;
+    return timer_is_before(a->waketime, b->waketime);
+}
+
+// Link two heap roots, returns the new root
+static struct timer_s *heap_meld(struct timer_s *a, struct timer_s *b) {
+    if (heap_before(b, a)) {
+        struct timer_s *t = a;
+        a = b;
+        b = t;
+    }
+    b->next = a->child;
+    if (b->next)
+        b->next->prev = b;
+    b->prev = a;
+    a->child = b;
+    a->next = a->prev = NULL;
+    return a;
+}
+
+// Merge a list of siblings into one heap (two pass pairing, no recursion)
+static struct timer_s *heap_merge_pairs(struct timer_s *first) {
+    struct timer_s *pairs = NULL;
+    while (first) {
+        struct timer_s *a = first, *b = a->next;
+        if (b) {
+            first = b->next;
+            a = heap_meld(a, b);
+        } else {
+            first = NULL;
+            a->prev = NULL;
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+    if (!pairs)
+        return NULL;
+    struct timer_s *root = pairs;
+    pairs = pairs->next;
+    root->next = NULL;
+    while (pairs) {
+        struct timer_s *t = pairs;
+        pairs = pairs->next;
+        root = heap_meld(root, t);
+    }
+    return root;
+}
+
+static void heap_insert(struct timer_s *t) {
+    t->child = t->next = t->prev = NULL;
+    timer_list = heap_meld(timer_list, t);
+}
+
+static void heap_remove(struct timer_s *t) {
+    if (t != timer_list && !t->prev)
+        // not scheduled
+        return;
+    struct timer_s *children = heap_merge_pairs(t->child);
+    if (t == timer_list) {
+        timer_list = children;
+    } else {
+        if (t->prev->child == t)
+            t->prev->child = t->next;
+        else
+            t->prev->next = t->next;
+        if (t->next)
+            t->next->prev = t->prev;
+        if (children)
+            timer_list = heap_meld(timer_list, children);
+    }
+    t->child = t->next = t->prev = NULL;
+}
+
 // The periodic_timer simplifies the timer code by ensuring there is
 // always a timer on the timer list and that there is always a timer
 // not far in the future.
@@ -34,20 +204,25 @@ static uint_fast8_t periodic_event(struct timer_s *t) {
     sched_wake_tasks();
     // Reschedule timer
     periodic_timer.waketime += timer_from_us(100000);
+    heap_remove(&sentinel_timer);
     sentinel_timer.waketime = periodic_timer.waketime + 0x80000000;
+    heap_insert(&sentinel_timer);
     return SF_RESCHEDULE;
 }
 
 static struct timer_s periodic_timer = {
     .func = periodic_event,
-    .next = &sentinel_timer,
+    .child = &sentinel_timer,
+#if CONFIG_TIMER_SLACK
+    .slack = CONFIG_CLOCK_FREQ / 100,
+#endif
 };
 
-// The sentinel timer is always the last timer on timer_list - its
-// presence allows the code to avoid checking for NULL while
-// traversing timer_list.  Since sentinel_timer.waketime is always
-// equal to (periodic_timer.waketime + 0x80000000) any added timer
-// must always have a waketime less than one of these two timers.
+// The sentinel timer is always the last timer to run - it can't be
+// reached as long as the periodic timer is scheduled.  Since
+// sentinel_timer.waketime is always equal to (periodic_timer.waketime
+// + 0x80000000) any added timer must always have a waketime less than
+// one of these two timers.
 static uint_fast8_t sentinel_event(struct timer_s *t) {
     sched_shutdown(ERROR_SENTINEL_TIMER);
 }
@@ -55,43 +230,30 @@ static uint_fast8_t sentinel_event(struct timer_s *t) {
 static struct timer_s sentinel_timer = {
     .func = sentinel_event,
     .waketime = 0x80000000,
+    .prev = &periodic_timer,
 };
 
-// Find position for a timer in timer_list and insert it
-static void __always_inline insert_timer(struct timer_s *t, uint32_t waketime) {
-    struct timer_s *prev, *pos = timer_list;
-    for (;;) {
-        prev = pos;
-        if (CONFIG_MACH_AVR)
-            // micro optimization for AVR - reduces register pressure
-            asm("" : "+r"(prev));
-        pos = pos->next;
-        if (timer_is_before(waketime, pos->waketime))
-            break;
-    }
-    t->next = pos;
-    prev->next = t;
-}
-
 // Schedule a function call at a supplied time.
 void sched_add_timer(struct timer_s *add) {
     uint32_t waketime = add->waketime;
     irqstatus_t flag = irq_save();
     if (unlikely(timer_is_before(waketime, timer_list->waketime))) {
-        // This timer is before all other scheduled timers
-        struct timer_s *tl = timer_list;
+        // This timer is before all other scheduled timers: the hardware
+        // timer is kicked and deleted_timer runs first, returning the
+        // new waketime to program
         if (timer_is_before(waketime, timer_read_time()))
             sched_try_shutdown(ERROR_CLOSE_TIMER);
-        if (tl == &deleted_timer)
-            add->next = deleted_timer.next;
-        else
-            add->next = tl;
+        heap_remove(&deleted_timer);
+        heap_insert(add);
         deleted_timer.waketime = waketime;
-        deleted_timer.next = add;
-        timer_list = &deleted_timer;
+        heap_insert(&deleted_timer);
         timer_kick();
     } else {
-        insert_timer(add, waketime);
+        heap_insert(add);
+#if CONFIG_TIMER_SLACK
+        // The wake up may be set past this timer's window
+        timer_kick_before(waketime + add->slack);
+#endif
     }
     irq_restore(flag);
 }
@@ -110,18 +272,13 @@ void sched_del_timer(struct timer_s *del) {
     irqstatus_t flag = irq_save();
     if (timer_list == del) {
         // Deleting the next active timer - replace with deleted_timer
+        heap_remove(del);
+        heap_remove(&deleted_timer);
         deleted_timer.waketime = del->waketime;
-        deleted_timer.next = del->next;
-        timer_list = &deleted_timer;
+        heap_insert(&deleted_timer);
     } else {
-        // Find and remove from timer list (if present)
-        struct timer_s *pos;
-        for (pos = timer_list; pos->next; pos = pos->next) {
-            if (pos->next == del) {
-                pos->next = del->next;
-                break;
-            }
-        }
+        // Remove from timer heap (if present)
+        heap_remove(del);
     }
     irq_restore(flag);
 }
@@ -131,35 +288,74 @@ unsigned int sched_timer_dispatch(void) {
     // Invoke timer callback
     struct timer_s *t = timer_list;
     uint_fast8_t res;
-    uint32_t updated_waketime;
+    uint32_t waketime = t->waketime;
+    uint32_t start = 0;
+    if (CONFIG_SCHED_PROFILE || CONFIG_SCHED_HIST) {
+        start = timer_read_time();
+        if (CONFIG_SCHED_HIST)
+            hist_record(HIST_TIMER_LATE, timer_is_before(waketime, start)
+                        ? start - waketime : 0);
+    }
     if (CONFIG_INLINE_STEPPER_HACK && likely(!t->func)) {
         // TODO res = stepper_event(t);
 		res = 0;
     } else {
         res = t->func(t);
-    }
-    updated_waketime = t->waketime;
-
-    // Update timer_list (rescheduling current timer if necessary)
-    unsigned int next_waketime = updated_waketime;
-    if (unlikely(res == SF_DONE)) {
-        next_waketime = t->next->waketime;
-        timer_list = t->next;
-    } else if (!timer_is_before(updated_waketime, t->next->waketime)) {
-        next_waketime = t->next->waketime;
-        timer_list = t->next;
-        insert_timer(t, updated_waketime);
+        if (CONFIG_SCHED_PROFILE)
+            profile_timer_add(t, waketime, start, timer_read_time());
     }
 
-    return next_waketime;
+    // Update timer heap (rescheduling current timer if necessary), the
+    // callback may have added timers so 't' isn't always the root
+    heap_remove(t);
+    if (res != SF_DONE)
+        heap_insert(t);
+
+    return timer_list->waketime;
 }
 
+#if CONFIG_TIMER_SLACK
+// Latest wake up that still runs every timer within its slack: the
+// earliest waketime+slack of the timers due before it.  Children never
+// wake before their parent, so the heap walk skips the subtrees past
+// the current bound (and needs no stack: 'prev' leads back up).
+uint32_t sched_timer_wake(void) {
+    struct timer_s *t = timer_list;
+    uint32_t wake = t->waketime + t->slack;
+    for (;;) {
+        if (t != &sentinel_timer && timer_is_before(t->waketime, wake)) {
+            if (timer_is_before(t->waketime + t->slack, wake))
+                wake = t->waketime + t->slack;
+            if (t->child) {
+                t = t->child;
+                continue;
+            }
+        }
+        // Next sibling, or the next sibling of the closest ancestor
+        for (;;) {
+            if (t == timer_list)
+                return wake;
+            if (t->next) {
+                t = t->next;
+                break;
+            }
+            while (t->prev->child != t)
+                t = t->prev;
+            t = t->prev;
+        }
+    }
+}
+#endif
+
 // Remove all user timers
 void sched_timer_reset(void) {
-    timer_list = &deleted_timer;
+    // unlink every timer, so deleting a dropped one later is harmless
+    while (timer_list)
+        heap_remove(timer_list);
+    timer_list = &periodic_timer;
+    heap_insert(&sentinel_timer);
     deleted_timer.waketime = periodic_timer.waketime;
-    deleted_timer.next = &periodic_timer;
-    periodic_timer.next = &sentinel_timer;
+    heap_insert(&deleted_timer);
     timer_kick();
 }
 
@@ -174,8 +370,35 @@ static int_fast8_t tasks_status;
 #define TS_REQUESTED 0
 #define TS_RUNNING   1
 
-// Note that at least one task is ready to run
+// Each DECL_TASK gets a bit in the wake bitmaps: the task loop visits
+// the woken tasks and the ones without a task_wake (run on every pass),
+// skipping the others without a call. Tasks sharing a task_wake get all
+// their bits in its mask, so a wake visits each of them (and each one
+// still checks the wake itself).
+static uint8_t tasks_count, tasks_always, tasks_wake = 0xff;
+
+// Hand out the task bits (once, at startup)
+static void tasks_init(void) {
+    if (tasks_count)
+        return;
+    const struct task_decl *d;
+    for (d = __start_decl_task; d < __stop_decl_task; d++) {
+        if (tasks_count >= TASKS_MAX) {
+            sched_try_shutdown(ERROR_GENERIC);
+            break;
+        }
+        struct task_wake *w = READP(d->wake);
+        uint8_t bit = 1 << tasks_count++;
+        if (w)
+            w->mask |= bit;
+        else
+            tasks_always |= bit;
+    }
+}
+
+// Note that at least one task is ready to run (all of them are run)
 void sched_wake_tasks(void) {
+    tasks_wake = 0xff;
     tasks_status = TS_REQUESTED;
 }
 
@@ -186,7 +409,10 @@ uint8_t sched_tasks_busy(void) {
 
 // Note that a task is ready to run
 void sched_wake_task(struct task_wake *w) {
-    sched_wake_tasks();
+    irqstatus_t flag = irq_save();
+    tasks_wake |= w->mask;
+    irq_restore(flag);
+    tasks_status = TS_REQUESTED;
     writeb(&w->wake, 1);
 }
 
@@ -218,10 +444,23 @@ static void run_tasks(void) {
         }
         tasks_status = TS_RUNNING;
 
-        // Run all tasks
-		for (uint8_t i=0;i<FUNCS_TASK_NO;i++) {
+        // Run the woken tasks
+		irq_disable();
+		uint8_t pending = (tasks_wake | tasks_always) & ((1 << tasks_count) - 1);
+		tasks_wake = 0;
+		irq_enable();
+		while (pending) {
+			uint8_t i = __builtin_ctz(pending);
+			pending &= pending - 1;
 			irq_poll();
-			taskFunc[i]();
+			voidPtr func = READP(__start_decl_task[i].func);
+			if (CONFIG_SCHED_PROFILE) {
+				uint32_t task_start = timer_read_time();
+				func();
+				profile_task_add(i, task_start, timer_read_time());
+			} else {
+				func();
+			}
 		}
 
 		// Update statistics
@@ -232,6 +471,21 @@ static void run_tasks(void) {
 }
 
 
+/****************************************************************
+ * Command dispatch
+ ****************************************************************/
+
+// Find the handler of a TYPE_* command - the table only holds the
+// commands built in, a short scan (of flash on AVR)
+cmdPtr command_lookup(uint8_t type) {
+	const struct command_decl *d;
+	for (d = __start_decl_command; d < __stop_decl_command; d++)
+		if (READP(d->type) == type)
+			return READP(d->func);
+	return command_unknown;
+}
+
+
 /****************************************************************
  * Shutdown processing
  ****************************************************************/
@@ -263,19 +517,21 @@ static void run_shutdown(int reason) {
 	sched_timer_reset();
 
 	// run all shutdown functions
-	for (uint8_t i=0;i<FUNCS_END_NO;i++) {
-		endFunc[i]();
+	const voidPtr *f;
+	for (f = __start_decl_end; f < __stop_decl_end; f++) {
+		voidPtr func = READP(*f);
+		func();
 	}
 
 	shutdown_status = 1;
 	irq_enable();
 
-	send_command(TYPE_SHUTDOWN_NOW, cur, shutdown_reason);
+	send_shutdown_now(cur, shutdown_reason);
 }
 
 // Report the last shutdown reason code
 void sched_report_shutdown(void) {
-	send_command(TYPE_SHUTDOWN_LAST, shutdown_reason);
+	send_shutdown_last(shutdown_reason);
 }
 
 // Shutdown the machine if not already in the process of shutting down
@@ -299,15 +555,19 @@ void sched_shutdown(uint_fast8_t reason) {
 
 // Main loop of program
 void sched_main(void) {
-	// configure all functions
-	funcs_init();
-
-	// run init functions
-	for (uint8_t i=0;i<FUNCS_INIT_NO;i++) {
-		initFunc[i]();
+	// run init functions, by priority (see DECL_INIT)
+	const struct init_decl *d;
+	uint8_t prio;
+	for (prio = 0; prio <= INIT_LAST; prio++) {
+		for (d = __start_decl_init; d < __stop_decl_init; d++) {
+			if (READP(d->prio) != prio)
+				continue;
+			voidPtr func = READP(d->func);
+			func();
+		}
 	}
 
-	send_command(TYPE_START);
+	send_start();
 
 	irq_disable();
 	int ret = setjmp(shutdown_jmp);
@@ -315,6 +575,7 @@ void sched_main(void) {
 		run_shutdown(ret);
 	irq_enable();
 
+	tasks_init();
 	run_tasks();
 }
 
@@ -353,231 +614,42 @@ uint32_t vlq_decode(uint8_t **pp) {
 }
 
 
-/****************************************************************
- * send command/response
- ****************************************************************/
-
-// encode and transmit a "command" message
-void send_command(uint8_t typ, ...) {
-	if (typ >= TYPE_NO); // TODO error
-
-	uint8_t len = 0;
-	uint8_t *buf_start = NULL;
-	va_list args;
-	va_start(args, typ);
-	switch (typ) {
-		case TYPE_UNKNOWN:
-			// TODO
-			len = len;
-			buf_start = buf_start;
-			break;
-		case TYPE_NOOP:
-			break;
-		case TYPE_START:
-			break;
-		case TYPE_ACK:
-			break;
-		case TYPE_NACK:
-			break;
-		case TYPE_SHUTDOWN_NOW:
-			break;
-		case TYPE_SHUTDOWN_LAST:
-			break;
-		case TYPE_BASE_IDENTIFY:
-			break;
-		case TYPE_BASE_ALLOCATE_OIDS:
-			break;
-		case TYPE_BASE_GET_CONFIG:
-			break;
-		case TYPE_BASE_FINALIZE_CONFIG:
-			break;
-		case TYPE_BASE_GET_CLOCK:
-			break;
-		case TYPE_BASE_GET_UPTIME:
-			break;
-		case TYPE_BASE_EMERGENCY_STOP:
-			break;
-		case TYPE_BASE_CLEAR_SHUTDOWN:
-			break;
-		case TYPE_BASE_STATS:
-			break;
-		case TYPE_BASE_RESET:
-			break;
-		case TYPE_DEBUG_START_GROUP:
-			break;
-		case TYPE_DEBUG_END_GROUP:
-			break;
-		case TYPE_DEBUG_NOP:
-			break;
-		case TYPE_DEBUG_PING:
-			break;
-		case TYPE_DEBUG_READ:
-			break;
-		case TYPE_DEBUG_WRITE:
-			break;
-		case TYPE_GPIO_CONFIG:
-			break;
-		case TYPE_GPIO_SCHEDULE:
-			break;
-		case TYPE_GPIO_UPDATE:
-			break;
-		case TYPE_GPIO_SET:
-			break;
-		case TYPE_GPIO_SOFTPWM_CONFIG:
-			break;
-		case TYPE_GPIO_SOFTPWM_SCHEDULE:
-			break;
-		case TYPE_PWM_CONFIG:
-			break;
-		case TYPE_PWM_SCHEDULE:
-			break;
-		case TYPE_PWM_SET:
-			break;
-		case TYPE_ADC_CONFIG:
-			break;
-		case TYPE_ADC_QUERY:
-			break;
-		case TYPE_ADC_STATE:
-			break;
-		case TYPE_I2C_CONFIG:
-			break;
-		case TYPE_I2C_MODBITS:
-			break;
-		case TYPE_I2C_READ:
-			break;
-		case TYPE_I2C_WRITE:
-			break;
-		case TYPE_SPI_CONFIG:
-			break;
-		case TYPE_SPI_CONFIG_NOCS:
-			break;
-		case TYPE_SPI_SET:
-			break;
-		case TYPE_SPI_TRANSFER:
-			break;
-		case TYPE_SPI_SEND:
-			break;
-		case TYPE_SPI_SHUTDOWN:
-			break;
-		default:
-			// TODO error, not implemented
-			break;
-	}
-	va_end(args);
-}
-
-// encode and transmit a "response" message
-void send_response(uint8_t typ, ...) {
-	if (typ >= TYPE_NO); // TODO error
-
-	uint8_t len = 0;
-	uint8_t *buf_start = NULL;
-	va_list args;
-	va_start(args, typ);
-	switch (typ) {
-		case TYPE_UNKNOWN:
-			break;
-		case TYPE_NOOP:
-			break;
-		case TYPE_START:
-			break;
-		case TYPE_ACK:
-		case TYPE_NACK:
-			// - An “ack” is a message block with empty content (ie, a 5 byte message block)
-			// and a sequence number greater than the last received host sequence number.
-			// - A “nak” is a message block with empty content and a sequence number less than the last received host sequence number.
-			tx_buffer_trigger(tx_buffer_alloc(len), len);
-			break;
-		case TYPE_SHUTDOWN_NOW:
-			break;
-		case TYPE_SHUTDOWN_LAST:
-			break;
-		case TYPE_BASE_IDENTIFY:
-			// TODO
-			len = 0;
-			buf_start = tx_buffer_alloc(1);
-			*(buf_start+MSG_POS_PAYLOAD) = 123;
-			len++;
-			tx_buffer_trigger(buf_start, len);
-			break;
-		case TYPE_BASE_ALLOCATE_OIDS:
-			break;
-		case TYPE_BASE_GET_CONFIG:
-			break;
-		case TYPE_BASE_FINALIZE_CONFIG:
-			break;
-		case TYPE_BASE_GET_CLOCK:
-			break;
-		case TYPE_BASE_GET_UPTIME:
-			break;
-		case TYPE_BASE_EMERGENCY_STOP:
-			break;
-		case TYPE_BASE_CLEAR_SHUTDOWN:
-			break;
-		case TYPE_BASE_STATS:
-			break;
-		case TYPE_BASE_RESET:
-			break;
-		case TYPE_DEBUG_START_GROUP:
-			break;
-		case TYPE_DEBUG_END_GROUP:
-			break;
-		case TYPE_DEBUG_NOP:
-			break;
-		case TYPE_DEBUG_PING:
-			break;
-		case TYPE_DEBUG_READ:
-			break;
-		case TYPE_DEBUG_WRITE:
-			break;
-		case TYPE_GPIO_CONFIG:
-			break;
-		case TYPE_GPIO_SCHEDULE:
-			break;
-		case TYPE_GPIO_UPDATE:
-			break;
-		case TYPE_GPIO_SET:
-			break;
-		case TYPE_GPIO_SOFTPWM_CONFIG:
-			break;
-		case TYPE_GPIO_SOFTPWM_SCHEDULE:
-			break;
-		case TYPE_PWM_CONFIG:
-			break;
-		case TYPE_PWM_SCHEDULE:
-			break;
-		case TYPE_PWM_SET:
-			break;
-		case TYPE_ADC_CONFIG:
-			break;
-		case TYPE_ADC_QUERY:
-			break;
-		case TYPE_ADC_STATE:
-			break;
-		case TYPE_I2C_CONFIG:
-			break;
-		case TYPE_I2C_MODBITS:
-			break;
-		case TYPE_I2C_READ:
-			break;
-		case TYPE_I2C_WRITE:
-			break;
-		case TYPE_SPI_CONFIG:
-			break;
-		case TYPE_SPI_CONFIG_NOCS:
-			break;
-		case TYPE_SPI_SET:
-			break;
-		case TYPE_SPI_TRANSFER:
-			break;
-		case TYPE_SPI_SEND:
-			break;
-		case TYPE_SPI_SHUTDOWN:
-			break;
-		default:
-			// TODO error, not implemented
-			break;
+// Encode 'n' integers: the 1 and 2 byte ones (-32..95, -4096..12287),
+// most of the traffic, with a single unsigned compare each instead of
+// the range cascade (32 bit wrap around: negative values land at the
+// bottom of the range, whatever the size of long)
+uint8_t *vlq_encode_n(uint8_t *p, const uint32_t *v, uint_fast8_t n) {
+	while (n--) {
+		uint32_t x = *v++;
+		if ((uint32_t)(x + (1U<<5)) < (4U<<5)) {
+			*p++ = x & 0x7f;
+		} else if ((uint32_t)(x + (1U<<12)) < (4U<<12)) {
+			*p++ = ((x>>7) & 0x7f) | 0x80;
+			*p++ = x & 0x7f;
+		} else {
+			p = vlq_encode(p, x);
+		}
 	}
-	va_end(args);
+	return p;
 }
 
+// Parse 'n' integers, the 1 and 2 byte ones without looping
+void vlq_decode_n(uint8_t **pp, uint32_t *v, uint_fast8_t n) {
+	uint8_t *p = *pp;
+	while (n--) {
+		uint8_t c = *p++;
+		uint32_t x = c & 0x7f;
+		if ((c & 0x60) == 0x60)
+			x |= -0x20;
+		if (c & 0x80) {
+			c = *p++;
+			x = (x<<7) | (c & 0x7f);
+			while (c & 0x80) {
+				c = *p++;
+				x = (x<<7) | (c & 0x7f);
+			}
+		}
+		*v++ = x;
+	}
+	*pp = p;
+}
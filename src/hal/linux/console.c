@@ -122,8 +122,6 @@ int console_setup(char *name) {
  ****************************************************************/
 
 static struct task_wake console_wake;
-static uint8_t receive_buf[4096];
-static int receive_pos;
 
 void tx_buffer_enable_irq(void) {
 }
@@ -133,9 +131,10 @@ void task_console_rx(void) {
     if (!sched_check_wake(&console_wake))
         return;
 
-    // Read data
-    int ret = read(main_pfd[MP_TTY_IDX].fd, &receive_buf[receive_pos]
-                   , sizeof(receive_buf) - receive_pos);
+    // Read data straight into the receive ring
+    uint8_t *data;
+    uint_fast16_t space = rx_buffer_space(&data);
+    int ret = read(main_pfd[MP_TTY_IDX].fd, data, space);
     if (ret < 0) {
         if (errno == EWOULDBLOCK) {
             ret = 0;
@@ -144,23 +143,18 @@ void task_console_rx(void) {
             return;
         }
     }
-    if (ret == 15 && receive_buf[receive_pos+14] == '\n'
-        && memcmp(&receive_buf[receive_pos], "FORCE_SHUTDOWN\n", 15) == 0)
+    if (ret == 15 && data[14] == '\n'
+        && memcmp(data, "FORCE_SHUTDOWN\n", 15) == 0)
         sched_shutdown(ERROR_FORCE_SHUTDOWN);
+    rx_buffer_commit(ret);
+    if (ret == space)
+        // ring end or ring full, there may be more to read
+        sched_wake_task(&console_wake);
 
     // Find and dispatch message blocks in the input
-    int len = receive_pos + ret;
-    uint_fast8_t pop_count, msglen = len > MSG_MAX ? MSG_MAX : len;
-    ret = rx_find_and_run(receive_buf, msglen, &pop_count);
-    if (ret) {
-        len -= pop_count;
-        if (len) {
-            memmove(receive_buf, &receive_buf[pop_count], len);
-            sched_wake_task(&console_wake);
-        }
-    }
-    receive_pos = len;
+    rx_buffer_run();
 }
+DECL_TASK(task_console_rx, &console_wake);
 /*
 // Encode and transmit a "response" message
 void console_sendf(const struct command_encoder *ce, va_list args) {
@@ -72,6 +72,7 @@ void timespec_update(void) {
     last_read_time = timespec_read();
     last_read_time_counter = timespec_to_time(last_read_time);
 }
+DECL_TASK(timespec_update, NULL);
 
 // Check if a given time has past
 int timer_check_periodic(struct timespec *ts) {
@@ -109,6 +110,14 @@ void timer_kick(void) {
     next_wake_time = last_read_time;
 }
 
+// Make sure timer dispatch runs no later than 'time' (a timer with
+// slack was added behind the next one)
+void timer_kick_before(uint32_t time) {
+    struct timespec ts = timespec_from_time(time);
+    if (timespec_is_before(ts, next_wake_time))
+        next_wake_time = ts;
+}
+
 static struct timespec timer_repeat_until;
 #define TIMER_IDLE_REPEAT_NS 500000
 #define TIMER_REPEAT_NS 100000
@@ -126,8 +135,9 @@ void timer_dispatch(void) {
 
         struct timespec now = timespec_read();
         if (!timespec_is_before(nt, timespec_add(now, TIMER_MIN_TRY_NS))) {
-            // Schedule next timer normally.
-            next_wake_time = nt;
+            // Schedule next timer normally - as late as the timers' slack
+            // allows, the timers due by then all run in this loop
+            next_wake_time = timespec_from_time(sched_timer_wake());
             return;
         }
 
@@ -155,4 +165,5 @@ void task_init_timer(void) {
     timespec_update();
     timer_kick();
 }
+DECL_INIT(task_init_timer, INIT_CORE);
 
@@ -30,4 +30,5 @@ void task_watchdog(void) {
     if (ret <= 0)
         report_errno("watchdog write", ret);
 }
+DECL_TASK(task_watchdog, NULL);
 
@@ -26,7 +26,7 @@ SOURCE_FILES = [
 DEST_LIB = "c_helper.so"
 OTHER_FILES = [
     'list.h', 'serialqueue.h', 'stepcompress.h', 'itersolve.h', 'pyhelper.h',
-    'trapq.h',
+    'trapq.h', 'vlq.h', '../../../include/hal/common/crc16.h',
 ]
 
 defs_stepcompress = """
@@ -136,6 +136,7 @@ defs_serialqueue = """
     void serialqueue_get_stats(struct serialqueue *sq, char *buf, int len);
     int serialqueue_extract_old(struct serialqueue *sq, int sentq
         , struct pull_queue_message *q, int max);
+    int serialqueue_decode(uint8_t *data, int len, uint32_t *ints, int max);
 """
 
 defs_pyhelper = """
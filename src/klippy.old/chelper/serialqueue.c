@@ -27,6 +27,8 @@
 #include "list.h" // list_add_tail
 #include "pyhelper.h" // get_monotonic
 #include "serialqueue.h" // struct queue_message
+#include "vlq.h" // encode_ints
+#include "../../../include/hal/common/crc16.h" // crc16_ccitt_fast
 
 
 /****************************************************************
@@ -200,21 +202,6 @@ set_non_blocking(int fd)
  * Serial protocol helpers
  ****************************************************************/
 
-// Implement the standard crc "ccitt" algorithm on the given buffer
-static uint16_t
-crc16_ccitt(uint8_t *buf, uint8_t len)
-{
-    uint16_t crc = 0xffff;
-    while (len--) {
-        uint8_t data = *buf++;
-        data ^= crc & 0xff;
-        data ^= data << 4;
-        crc = ((((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4)
-               ^ ((uint16_t)data << 3));
-    }
-    return crc;
-}
-
 // Verify a buffer starts with a valid mcu message
 static int
 check_message(uint8_t *need_sync, uint8_t *buf, int buf_len)
@@ -237,7 +224,7 @@ check_message(uint8_t *need_sync, uint8_t *buf, int buf_len)
         goto error;
     uint16_t msgcrc = ((buf[msglen-MESSAGE_TRAILER_CRC] << 8)
                        | (uint8_t)buf[msglen-MESSAGE_TRAILER_CRC+1]);
-    uint16_t crc = crc16_ccitt(buf, msglen-MESSAGE_TRAILER_SIZE);
+    uint16_t crc = crc16_ccitt_fast(buf, msglen-MESSAGE_TRAILER_SIZE);
     if (crc != msgcrc)
         goto error;
     return msglen;
@@ -253,21 +240,11 @@ error: ;
     return -buf_len;
 }
 
-// Encode an integer as a variable length quantity (vlq)
-static uint8_t *
-encode_int(uint8_t *p, uint32_t v)
+// Parse the vlq integers of a message payload (see decode_ints())
+int __visible
+serialqueue_decode(uint8_t *data, int len, uint32_t *ints, int max)
 {
-    int32_t sv = v;
-    if (sv < (3L<<5)  && sv >= -(1L<<5))  goto f4;
-    if (sv < (3L<<12) && sv >= -(1L<<12)) goto f3;
-    if (sv < (3L<<19) && sv >= -(1L<<19)) goto f2;
-    if (sv < (3L<<26) && sv >= -(1L<<26)) goto f1;
-    *p++ = (v>>28) | 0x80;
-f1: *p++ = ((v>>21) & 0x7f) | 0x80;
-f2: *p++ = ((v>>14) & 0x7f) | 0x80;
-f3: *p++ = ((v>>7) & 0x7f) | 0x80;
-f4: *p++ = v & 0x7f;
-    return p;
+    return decode_ints(data, len, ints, max);
 }
 
 
@@ -304,9 +281,10 @@ struct queue_message *
 message_alloc_and_encode(uint32_t *data, int len)
 {
     struct queue_message *qm = message_alloc();
-    int i;
-    uint8_t *p = qm->msg;
-    for (i=0; i<len; i++) {
+    // the first ones can't overflow the payload, encode them in a batch
+    int i = len < MESSAGE_PAYLOAD_MAX / 5 ? len : MESSAGE_PAYLOAD_MAX / 5;
+    uint8_t *p = encode_ints(qm->msg, data, i);
+    for (; i<len; i++) {
         p = encode_int(p, data[i]);
         if (p > &qm->msg[MESSAGE_PAYLOAD_MAX])
             goto fail;
@@ -696,7 +674,7 @@ build_and_send_command(struct serialqueue *sq, double eventtime)
     out->msg[MESSAGE_POS_LEN] = out->len;
     out->msg[MESSAGE_POS_SEQ] = (MESSAGE_DEST
                                  | (sq->send_seq & MESSAGE_SEQ_MASK));
-    uint16_t crc = crc16_ccitt(out->msg, out->len - MESSAGE_TRAILER_SIZE);
+    uint16_t crc = crc16_ccitt_fast(out->msg, out->len - MESSAGE_TRAILER_SIZE);
     out->msg[out->len - MESSAGE_TRAILER_CRC] = crc >> 8;
     out->msg[out->len - MESSAGE_TRAILER_CRC+1] = crc & 0xff;
     out->msg[out->len - MESSAGE_TRAILER_SYNC] = MESSAGE_SYNC;
@@ -0,0 +1,139 @@
+#ifndef __VLQ_H
+#define __VLQ_H
+// Variable length quantity (vlq) integer encoding, as in the mcu
+// protocol: 7 bits per byte, most significant first, bit 7 set on all
+// but the last byte, and a first byte 0x60-0x7f meaning negative.
+
+#include <stdint.h> // uint32_t
+#if defined(__SSE2__)
+#include <emmintrin.h> // _mm_movemask_epi8
+#endif
+
+// Encode an integer as a variable length quantity (vlq)
+static inline uint8_t *
+encode_int(uint8_t *p, uint32_t v)
+{
+    int32_t sv = v;
+    if (sv < (3L<<5)  && sv >= -(1L<<5))  goto f4;
+    if (sv < (3L<<12) && sv >= -(1L<<12)) goto f3;
+    if (sv < (3L<<19) && sv >= -(1L<<19)) goto f2;
+    if (sv < (3L<<26) && sv >= -(1L<<26)) goto f1;
+    *p++ = (v>>28) | 0x80;
+f1: *p++ = ((v>>21) & 0x7f) | 0x80;
+f2: *p++ = ((v>>14) & 0x7f) | 0x80;
+f3: *p++ = ((v>>7) & 0x7f) | 0x80;
+f4: *p++ = v & 0x7f;
+    return p;
+}
+
+// Encode 'count' integers, the 1 and 2 byte ones (-32..95 and
+// -4096..12287, most of the traffic) with one unsigned compare each
+// (32 bit wrap around: negative values land at the bottom of the range)
+static inline uint8_t *
+encode_ints(uint8_t *p, const uint32_t *v, int count)
+{
+    while (count--) {
+        uint32_t x = *v++;
+        if ((uint32_t)(x + (1U<<5)) < (4U<<5)) {
+            *p++ = x & 0x7f;
+        } else if ((uint32_t)(x + (1U<<12)) < (4U<<12)) {
+            *p++ = ((x>>7) & 0x7f) | 0x80;
+            *p++ = x & 0x7f;
+        } else {
+            p = encode_int(p, x);
+        }
+    }
+    return p;
+}
+
+// Longest encoding of a 32 bit integer
+#define VLQ_MAX_BYTES 5
+
+// Parse an integer, -1 if it runs past 'end' or is longer than
+// VLQ_MAX_BYTES
+static inline int
+decode_int(const uint8_t **pp, const uint8_t *end, uint32_t *pv)
+{
+    const uint8_t *p = *pp;
+    if (p >= end)
+        return -1;
+    const uint8_t *vend = p + VLQ_MAX_BYTES;
+    uint8_t c = *p++;
+    uint32_t v = c & 0x7f;
+    if ((c & 0x60) == 0x60)
+        v |= -0x20;
+    while (c & 0x80) {
+        if (p >= end || p >= vend)
+            return -1;
+        c = *p++;
+        v = (v<<7) | (c & 0x7f);
+    }
+    *pp = p;
+    *pv = v;
+    return 0;
+}
+
+#if defined(__SSE2__)
+// Sign extend 16 single byte values (0x60-0x7f: -32..-1) to 32 bits
+static inline void
+decode_16x1(__m128i b, uint32_t *v)
+{
+    __m128i neg = _mm_cmpgt_epi8(b, _mm_set1_epi8(0x5f));
+    b = _mm_sub_epi8(b, _mm_and_si128(neg, _mm_set1_epi8(0x80)));
+    __m128i s8 = _mm_cmpgt_epi8(_mm_setzero_si128(), b);
+    __m128i lo = _mm_unpacklo_epi8(b, s8), hi = _mm_unpackhi_epi8(b, s8);
+    __m128i slo = _mm_srai_epi16(lo, 15), shi = _mm_srai_epi16(hi, 15);
+    _mm_storeu_si128((__m128i*)&v[0], _mm_unpacklo_epi16(lo, slo));
+    _mm_storeu_si128((__m128i*)&v[4], _mm_unpackhi_epi16(lo, slo));
+    _mm_storeu_si128((__m128i*)&v[8], _mm_unpacklo_epi16(hi, shi));
+    _mm_storeu_si128((__m128i*)&v[12], _mm_unpackhi_epi16(hi, shi));
+}
+#endif
+
+// Parse up to 'max' integers from 'len' bytes, returns the number of
+// integers parsed or -1 if the last one is truncated or too long (see
+// decode_int()). With SSE2 the
+// continuation bits of 16 bytes are tested at once and 16 single byte
+// values (oids, flags, small values) sign extended in registers. Mixed
+// lengths are data dependent and parsed one at a time, for up to 64
+// bytes before testing again so mixed streams don't pay for the tests.
+static inline int
+decode_ints(const uint8_t *p, int len, uint32_t *v, int max)
+{
+    const uint8_t *end = p + len;
+    uint32_t *o = v, *oend = v + max;
+#if defined(__SSE2__)
+    // a value started before 'wend' ends at most VLQ_MAX_BYTES - 1
+    // bytes after it, longer ones are rejected
+    while (end - p >= 16 + 4 && oend - o >= 64) {
+        __m128i b = _mm_loadu_si128((const __m128i*)p);
+        if (!_mm_movemask_epi8(b)) {
+            decode_16x1(b, o);
+            p += 16;
+            o += 16;
+            continue;
+        }
+        const uint8_t *wend = end - p >= 64 + 4 ? p + 64 : end - 4;
+        do {
+            const uint8_t *vend = p + VLQ_MAX_BYTES;
+            uint8_t c = *p++;
+            uint32_t x = c & 0x7f;
+            if ((c & 0x60) == 0x60)
+                x |= -0x20;
+            while (c & 0x80) {
+                if (p >= vend)
+                    return -1;
+                c = *p++;
+                x = (x<<7) | (c & 0x7f);
+            }
+            *o++ = x;
+        } while (p < wend);
+    }
+#endif
+    while (p < end && o < oend)
+        if (decode_int(&p, end, o++))
+            return -1;
+    return o - v;
+}
+
+#endif // vlq.h
@@ -10,11 +10,9 @@ char fwname[] = "klipper-ng";
 char fwver[] = "0000000";
 
 // time and performance handling
-uint16_t sstart = 0;
-uint16_t mstart = 0;
-uint16_t ustart = 0;
-uint16_t deltaTime = 0;
-uint16_t jitter = 0;
+ticks_t tstart = 0;
+uint32_t deltaTime = 0;
+uint32_t jitter = 0;
 
 // data
 uint8_t txtData, binData, peerData;
@@ -25,6 +23,12 @@ uint8_t encodedSize = 0;
 task_t *tasks = NULL;
 task_t *sched_running = NULL;
 
+// multi-MCU relay
+uint8_t nodeId = RELAY_NODE_HOST;
+route_t routes[RELAY_ROUTES_MAX];
+uint8_t routesNo = 0;
+commport_t *eventPort = NULL; // port the current event is coming from
+
 void init(char *name, char *ver) {
 	if (name) strcpy(fwname, name);
 	if (ver) strcpy(fwver, ver);
@@ -52,12 +56,24 @@ void remoteLog(const char *format, ...) {
 	va_end (args);
 }
 
-void getEvent(void) {
-	while(binConsole->available(binConsole)) {
-		binConsole->read(binConsole, &binData, 1, 1);
-		printf("%x\n", binData);
-		if (decodeEvent(&binData, 0, NULL)) break;
+uint8_t getEvent(void) {
+	commport_t *ports[2] = {binConsole, peering};
+	uint8_t *data[2] = {&binData, &peerData};
+	for (uint8_t i=0;i<2;i++) {
+		commport_t *cp = ports[i];
+		if (!cp) continue;
+		// don't switch input stream in the middle of an event
+		if (decodePending() && (cp != eventPort)) continue;
+		eventPort = cp;
+		while(cp->available(cp)) {
+			cp->read(cp, data[i], 1, 1);
+			if (decodeEvent(data[i], 0, NULL)) {
+				runEvent(eventSize, eventBuffer);
+				return 1;
+			}
+		}
 	}
+	return 0;
 }
 
 void runEvent(uint8_t size, uint8_t *event) {
@@ -114,6 +130,11 @@ void runEvent(uint8_t size, uint8_t *event) {
 			eventSystemReset(event[3]);
 			break;
 		case STATUS_SYSEX_START:
+			// skip the async/sync modifier, the command follows it
+			if ((size > 2) && ((event[1] == SYSEX_MOD_ASYNC) || (event[1] == SYSEX_MOD_SYNC))) {
+				event++;
+				size--;
+			}
 			switch (event[1]) { // first byte is sysex start, second byte is command
 				case SYSEX_MOD_EXTEND:
 					switch(event[2]+event[3]) { // second byte is SYSEX_EXTEND, third&forth bytes are the extended commands
@@ -169,6 +190,9 @@ void runEvent(uint8_t size, uint8_t *event) {
 						}
 					}
 					break;
+				case SYSEX_RELAY_DATA:
+					if (size > 2) eventSysexRelay(size - 2, event + 2);
+					break;
 				case SYSEX_ONEWIRE_DATA:
 					eventSysexOneWire();
 					break;
@@ -289,13 +313,18 @@ void runEvent(uint8_t size, uint8_t *event) {
 	}
 }
 
-void runEventSched(uint16_t now) {
+// task time 0 means "not scheduled"
+static ticks_t taskTime(ticks_t t) {
+	return t ? t : 1;
+}
+
+void runEventSched(ticks_t now) {
 	if (tasks) {
 		task_t *current = tasks;
 		task_t *previous = NULL;
 		while (current) {
-			if (current->ms > 0 && current->ms < now) { // TODO handle overflow
-				uint16_t start = current->ms;
+			if (current->time && ticks_is_before(current->time, now)) {
+				ticks_t start = current->time;
 				uint8_t pos = current->pos;
 				uint8_t len = current->len;
 				uint8_t *messages = current->messages;
@@ -304,7 +333,7 @@ void runEventSched(uint16_t now) {
 				while (pos < len) {
 					if (decodeEvent(&messages[pos++], 0, NULL))
 						runEvent(eventSize, eventBuffer);
-					if (start != current->ms) { // return true if task got rescheduled during run.
+					if (start != current->time) { // return true if task got rescheduled during run.
 						current->pos = ( pos == len ? 0 : pos ); // last message executed? -> start over next time
 						reschedule = 1;
 						break;
@@ -397,50 +426,37 @@ void printEvent(uint8_t size, uint8_t *event, char *output) {
 
 uint8_t run(void) {
 	// --- start
-	ustart = micros();
-	mstart = millis();
+	tstart = ticks_now();
+	ticks_t tend = tstart + ticks_from_us(TICKTIME);
 	int reset = 0;
 
 	// --- evaluate performance and signal lag
 	if (jitter>=TICKTIME) {
-		uint16_t jms = jitter/1000;
+		uint32_t jms = jitter/1000;
 		cmdSendSignal(SIG_JITTER, jms>126?127:jms);
 		jitter = jitter%1000;
 	}
-	if(sstart!=seconds()) {
-		//printf("%4d:%4d:%4d - delta %4d (+%4d)\n",sstart,mstart,ustart,deltaTime,jitter);
-		sstart = seconds();
-	}
 
 	// 1. run hardware tasks
 	halRun();
 
-	// 2. get new event
+	// 2. get new event (and run it)
 	getEvent();
 
-	// 3. run new event
-	//runEvent(0, NULL);
-
-	// 4. run scheduled events
-	runEventSched(mstart);
-
-	// --- evaluate spare time
-	deltaTime = uelapsed(mstart, ustart, micros(), millis());
-	if (deltaTime >= TICKTIME) {
-		jitter = jitter+(deltaTime-TICKTIME);
-		return reset;
-	}
+	// 3. run scheduled events
+	runEventSched(tstart);
 
 	// --- spend spare time waiting for new events
-	while(deltaTime<TICKTIME) {
-		// wait for new incoming event
-		getEvent();
-		//runEvent(0, NULL);
-		// evaluate elapsed time
-		usleep(1); // in case cpu is too fast, mutex in micros/millis can't recover in time
-		deltaTime = uelapsed(mstart, ustart, micros(), millis());
+	ticks_t now = ticks_now();
+	while(ticks_is_before(now, tend)) {
+		// wait for new incoming event, once the input is drained sleep until
+		// tend instead of spinning (what comes in meanwhile waits for the next tick)
+		if (!getEvent())
+			ticks_sleep_until(tend);
+		now = ticks_now();
 	}
-	// evaluate jitter
+	// evaluate elapsed time and jitter
+	deltaTime = ticks_to_us(now - tstart);
 	jitter = jitter+(deltaTime-TICKTIME);
 	return reset;
 }
@@ -604,6 +620,58 @@ void cmdSysexSchedReset(void) {
 	stderrPrint("Not Implemented: \n");
 }
 
+// ROUTING ------------------------------------------------------------------------------------------------------------
+
+static route_t *routeFind(uint8_t node) {
+	for (uint8_t i=0;i<routesNo;i++)
+		if (routes[i].node == node) return &routes[i];
+	return NULL;
+}
+
+// add or refresh a route, shorter (or equal) paths win
+static void routeAdd(uint8_t node, commport_t *port, uint8_t hops) {
+	if ((!port) || (node == nodeId)) return;
+	route_t *r = routeFind(node);
+	if (!r) {
+		if (routesNo >= RELAY_ROUTES_MAX) return;
+		r = &routes[routesNo++];
+	} else if ((r->port != port) && (r->hops < hops)) {
+		return;
+	}
+	r->node = node;
+	r->hops = hops;
+	r->port = port;
+}
+
+static void routeDel(uint8_t node) {
+	route_t *r = routeFind(node);
+	if (r) *r = routes[--routesNo];
+}
+
+static void routeReset(void) {
+	routesNo = 0;
+}
+
+// next hop toward node: known route, else away from the port the event came from (ie: a chain needs no setup)
+static commport_t *routeNext(uint8_t node, commport_t *from) {
+	route_t *r = routeFind(node);
+	if (r) return r->port;
+	if ((node != RELAY_NODE_HOST) && (from == binConsole)) return peering;
+	return binConsole;
+}
+
+void cmdSysexRelay(uint8_t node, uint8_t size, uint8_t *event) {
+	commport_t *cp = routeNext(node, NULL);
+	if (!cp) return;
+	encodedSize = encodeSysexRelay(encodedEvent, node, nodeId, RELAY_HOPS_MAX, size, event);
+	if (encodedSize) cp->write(cp, encodedEvent, encodedSize, 0);
+}
+
+void cmdSysexRoute(uint8_t cmd, uint8_t node, uint8_t port, uint8_t hops) {
+	encodedSize = encodeSysexRoute(encodedEvent, cmd, node, port, hops);
+	binConsole->write(binConsole, encodedEvent, encodedSize, 0);
+}
+
 void cmdSysexVersion(uint8_t item) {
 	stderrPrint("Not Implemented: \n");
 }
@@ -816,7 +884,7 @@ void eventSysexSchedCreate(uint8_t id, uint8_t len) {
 	} else {
 		task_t *newTask = (task_t*)malloc(sizeof(task_t) + len);
 		newTask->id = id;
-		newTask->ms = 0;
+		newTask->time = 0;
 		newTask->len = len;
 		newTask->next = tasks;
 		newTask->pos = 0;
@@ -862,7 +930,7 @@ void eventSysexSchedSchedule(uint8_t id, uint16_t delay) {
 	task_t *existing = findTask(id);
 	if (existing) {
 		existing->pos = 0;
-		existing->ms = millis() + delay;
+		existing->time = taskTime(ticks_now() + ticks_from_us((uint32_t)delay * 1000));
 	} else {
 		reportTask(NULL, true);
 	}
@@ -870,11 +938,12 @@ void eventSysexSchedSchedule(uint8_t id, uint16_t delay) {
 
 void eventSysexSchedDelay(uint16_t delay_ms) {
 	if (sched_running) {
-		long now = millis();
-		sched_running->ms += delay_ms;
-		if (sched_running->ms < now) { // if delay time allready passed by schedule to 'now'.
-			sched_running->ms = now;
+		ticks_t now = ticks_now();
+		sched_running->time += ticks_from_us((uint32_t)delay_ms * 1000);
+		if (ticks_is_before(sched_running->time, now)) { // if delay time allready passed by schedule to 'now'.
+			sched_running->time = now;
 		}
+		sched_running->time = taskTime(sched_running->time);
 	}
 }
 
@@ -907,6 +976,46 @@ void eventSysexSchedReset(void) {
 	}
 }
 
+static void relayForward(uint8_t dst, uint8_t src, uint8_t hops, uint8_t size, uint8_t *event) {
+	commport_t *from = eventPort;
+	// learn the way back to the source
+	routeAdd(src, from, RELAY_HOPS_MAX - hops + 1);
+	if (dst == nodeId) {
+		// local delivery: the inner event is a complete encoded event
+		uint8_t inner[PROTOCOL_MAX_EVENT_BYTES];
+		memcpy(inner, event, size);
+		for (uint8_t i=0;i<size;i++)
+			if (decodeEvent(&inner[i], 0, NULL))
+				runEvent(eventSize, eventBuffer);
+		eventPort = from;
+		return;
+	}
+	commport_t *cp = routeNext(dst, from);
+	if ((hops == 0) || (!cp) || (cp == from)) {
+		cmdSendSignal(SIG_DISCARD, dst);
+		return;
+	}
+	encodedSize = encodeSysexRelay(encodedEvent, dst, src, hops - 1, size, event);
+	if (encodedSize) cp->write(cp, encodedEvent, encodedSize, 0);
+}
+
+void eventSysexRelay(uint8_t size, uint8_t *data) {
+	switch (data[0]) {
+		case SYSEX_SUB_RELAY_FORWARD:
+			if (size > 4) relayForward(data[1], data[2], data[3], size - 4, data + 4);
+			break;
+		case SYSEX_SUB_RELAY_ROUTE_ADD:
+			if (size == 4) routeAdd(data[1], (data[2] == RELAY_PORT_PEERING ? peering : binConsole), data[3]);
+			break;
+		case SYSEX_SUB_RELAY_ROUTE_DEL:
+			if (size > 1) routeDel(data[1]);
+			break;
+		case SYSEX_SUB_RELAY_ROUTE_RESET:
+			routeReset();
+			break;
+	}
+}
+
 void eventSysexVersion(uint8_t item, char *ver) {
 	encodedSize = encodeSysex(encodedEvent, strlen(ver), (uint8_t *)ver);
 	binConsole->write(binConsole, encodedEvent, encodedSize, 0);
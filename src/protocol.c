@@ -6,6 +6,7 @@
 // message handling
 static uint8_t waitForData = 0;
 static uint8_t waitForCRC = 0;
+static uint8_t eventComplete = 0;
 uint8_t eventBuffer[PROTOCOL_MAX_EVENT_BYTES];
 uint8_t eventSize = 0;
 uint8_t sequenceId = 0;
@@ -121,6 +122,7 @@ static void decode7bitCompat(uint8_t *input, uint8_t count, uint8_t *output) {
 void bufferReset(void) {
 	waitForData = 0;
 	waitForCRC = 0;
+	eventComplete = 0;
 	eventBuffer[0] = 0;
 	eventSize = 0;
 }
@@ -178,150 +180,121 @@ void decodeErr(uint8_t code) {
 	}
 }
 
-uint8_t decodeEvent(uint8_t *byte, uint8_t size, uint8_t *event) {
-	if (event == NULL) {
-		size = eventSize;
-		event = eventBuffer;
+uint8_t decodePending(void) {
+	return (waitForData || waitForCRC);
+}
+
+// decode one byte of the event in event[0..*size): the header is checked byte by byte, data is
+// stored until the event is complete and its CRC matches, then the event is moved in place to
+// [status][data] (sysex: [STATUS_SYSEX_START][decoded data]) and its new size returned
+static uint8_t decodeByte(uint8_t byte, uint8_t *size, uint8_t *event) {
+	if (eventComplete) { // previous event already delivered, start over
+		eventComplete = 0;
+		*size = 0;
 	}
-	if(waitForCRC) { // event complete but CRC byte missing
-		if (size<6) { // size must be bigger than minimum event size
-			decodeErr(PROTOCOL_ERR_SIZE);
-			return 0;
-		}
+	if (waitForCRC) { // event complete but CRC byte missing
 		waitForCRC = 0;
-		if (*byte==CRC8(size, event)) {
-			if (event[3] == STATUS_SYSEX_START) {
-				cbDecoder(&event[3], size-2, event); // decode data bytes in place
-			}
-			// completed event goes live!
-			return size;
-		} else {
+		if (byte != CRC8(*size, event)) {
 			decodeErr(PROTOCOL_ERR_CRC);
 			return 0;
 		}
-	} else if(waitForData) { // need more data to complete the current event
-		switch (event[2]) {
-			case STATUS_SYSEX_START:
-				if (size>3) { // size must be bigger than sequenceId header size
-					decodeErr(PROTOCOL_ERR_SIZE);
-					return 0;
-				}
-				if (*byte == STATUS_SYSEX_END) {
-					waitForData = 0;
-					waitForCRC = 1;
-					event[size] = *byte;
-					size++;
-					return 0;
-				} else {
-					// MSb must be 0 because those must be data bytes (ie: byte value <= 127)
-					if (*byte>0x80) {
-						decodeErr(PROTOCOL_ERR_NEED_DATA);
-						return 0;
-					}
-					// normal data byte -> add to buffer
-					event[size] = *byte;
-					size++;
-					return 0;
-				}
-				break;
-			case STATUS_PIN_MODE:
-			case STATUS_DIGITAL_PORT_REPORT:
-			case STATUS_DIGITAL_PORT_SET:
-			case STATUS_DIGITAL_PIN_REPORT:
-			case STATUS_DIGITAL_PIN_SET:
-			case STATUS_ANALOG_PIN_REPORT:
-			case STATUS_ANALOG_PIN_SET:
-			case STATUS_PROTOCOL_VERSION:
-			case STATUS_PROTOCOL_ENCODING:
-			case STATUS_INFO:
-			case STATUS_SIGNAL:
-			case STATUS_INTERRUPT:
-			case STATUS_EMERGENCY_STOP:
-			case STATUS_SYSTEM_PAUSE:
-			case STATUS_SYSTEM_RESUME:
-			case STATUS_SYSTEM_RESET:
-				// MSb must be 0 because those events have data (ie: byte value <= 127)
-				if (*byte>0x80) {
-					decodeErr(PROTOCOL_ERR_NEED_DATA);
-					return 0;
-				}
-				break;
-			case STATUS_CUSTOM_F5:
-			case STATUS_CUSTOM_F6:
-			case STATUS_CUSTOM_F7:
-			case STATUS_CUSTOM_F8:
-				if (customHandler) customHandler(size, event);
-				break;
-			default:
-				break;
-		}
-		// add current byte to buffer
-		waitForData--;
-		event[size] = *byte;
-		size++;
-		if (waitForData == 0) { // got the whole event, need CRC
-			waitForCRC = 1;
+		if (event[2] == STATUS_SYSEX_START) {
+			// [begin][seq][sysex start][encoded data][sysex end]: decode data bytes in place
+			uint8_t count = cbEvalDec(*size - 4);
+			cbDecoder(&event[2], *size - 3, &event[1]);
+			event[0] = STATUS_SYSEX_START;
+			*size = 1 + count;
+		} else {
+			for (uint8_t i=0;i<*size-2;i++) {
+				event[i] = event[i+2];
+			}
+			*size -= 2;
 		}
-	} else if (size==2) { // status byte
-		if (*byte<0x80) { // third byte must be control
-			decodeErr(PROTOCOL_ERR_NEED_CTRL);
+		// completed event goes live!
+		eventComplete = 1;
+		return *size;
+	}
+	if (waitForData) { // need more data to complete the current event
+		if (*size >= PROTOCOL_MAX_EVENT_BYTES) {
+			decodeErr(PROTOCOL_ERR_SIZE);
 			return 0;
 		}
-		switch (event[2]) {
-			case STATUS_PIN_MODE:
-			case STATUS_DIGITAL_PORT_REPORT:
-			case STATUS_DIGITAL_PORT_SET:
-			case STATUS_DIGITAL_PIN_REPORT:
-			case STATUS_DIGITAL_PIN_SET:
-			case STATUS_ANALOG_PIN_REPORT:
-			case STATUS_ANALOG_PIN_SET:
-			case STATUS_PROTOCOL_VERSION:
-			case STATUS_PROTOCOL_ENCODING:
-			case STATUS_INFO:
-			case STATUS_SIGNAL:
-			case STATUS_INTERRUPT:
-			case STATUS_EMERGENCY_STOP:
-			case STATUS_SYSTEM_PAUSE:
-			case STATUS_SYSTEM_RESUME:
-			case STATUS_SYSTEM_RESET:
-				waitForData = 2; // two more bytes needed
-				break;
-			case STATUS_SYSEX_START:
-				waitForData = 1; // more data needed
-				break;
-			case STATUS_CUSTOM_F5:
-			case STATUS_CUSTOM_F6:
-			case STATUS_CUSTOM_F7:
-			case STATUS_CUSTOM_F8:
-				if (customHandler) customHandler(size, event);
-				break;
-			default:
-				decodeErr(PROTOCOL_ERR_EVENT_UNKNOWN);
-				return 0;
-				break;
-		}
-		event[0] = *byte;
-		size = 1;
-	} else if (size==1) {  // sequence id
-		if (*byte>0x80) { // second byte must be data
+		if ((event[2] == STATUS_SYSEX_START) && (byte == STATUS_SYSEX_END)) {
+			waitForData = 0;
+			waitForCRC = 1;
+		} else if (byte & 0x80) { // MSb must be 0 because those must be data bytes (ie: byte value <= 127)
 			decodeErr(PROTOCOL_ERR_NEED_DATA);
 			return 0;
+		} else if ((event[2] != STATUS_SYSEX_START) && (--waitForData == 0)) { // got the whole event, need CRC
+			waitForCRC = 1;
 		}
-		event[size]=*byte;
-		size++;
-	} else { // new event start
-		if (*byte == STATUS_EVENT_BEGIN) { // first byte must be 0xFF
-			size = 0;
-			event[size] = *byte;
-			size++;
-		} else {
-			decodeErr(PROTOCOL_ERR_START);
-			return 0;
-		}
+		event[(*size)++] = byte;
+		return 0;
 	}
+	switch (*size) {
+		case 1: // sequence id
+			if (byte & 0x80) { // second byte must be data
+				decodeErr(PROTOCOL_ERR_NEED_DATA);
+				return 0;
+			}
+			break;
+		case 2: // status byte
+			if (!(byte & 0x80)) { // third byte must be control
+				decodeErr(PROTOCOL_ERR_NEED_CTRL);
+				return 0;
+			}
+			switch ((byte < STATUS_PROTOCOL_VERSION) ? (byte & 0xF0) : byte) { // 0x80-0xE0 carry the pin or port
+				case STATUS_PIN_MODE:
+				case STATUS_DIGITAL_PORT_REPORT:
+				case STATUS_DIGITAL_PORT_SET:
+				case STATUS_DIGITAL_PIN_REPORT:
+				case STATUS_DIGITAL_PIN_SET:
+				case STATUS_ANALOG_PIN_REPORT:
+				case STATUS_ANALOG_PIN_SET:
+				case STATUS_PROTOCOL_VERSION:
+				case STATUS_PROTOCOL_ENCODING:
+				case STATUS_INFO:
+				case STATUS_SIGNAL:
+				case STATUS_INTERRUPT:
+				case STATUS_EMERGENCY_STOP:
+				case STATUS_SYSTEM_PAUSE:
+				case STATUS_SYSTEM_RESUME:
+				case STATUS_SYSTEM_RESET:
+					waitForData = 2; // two more bytes needed
+					break;
+				case STATUS_SYSEX_START:
+					waitForData = 1; // more data needed, up to STATUS_SYSEX_END
+					break;
+				case STATUS_CUSTOM_F5:
+				case STATUS_CUSTOM_F6:
+				case STATUS_CUSTOM_F7:
+				case STATUS_CUSTOM_F8:
+					if (customHandler) customHandler(*size, event);
+					break;
+				default:
+					decodeErr(PROTOCOL_ERR_EVENT_UNKNOWN);
+					return 0;
+			}
+			break;
+		default: // new event start
+			if (byte != STATUS_EVENT_BEGIN) { // first byte must be STATUS_EVENT_BEGIN
+				decodeErr(PROTOCOL_ERR_START);
+				return 0;
+			}
+			*size = 0;
+			break;
+	}
+	event[(*size)++] = byte;
 	return 0;
 }
 
+uint8_t decodeEvent(uint8_t *byte, uint8_t size, uint8_t *event) {
+	if (event == NULL) { // decode into eventBuffer, keeping the state in eventSize
+		return decodeByte(*byte, &eventSize, eventBuffer);
+	}
+	return decodeByte(*byte, &size, event);
+}
+
 uint8_t encodeEvent(uint8_t cmd, uint8_t argc, uint8_t *argv, uint8_t *event) {
 	uint8_t count = 2; // sequence id size
 	uint8_t datastart = count;
@@ -333,7 +306,7 @@ uint8_t encodeEvent(uint8_t cmd, uint8_t argc, uint8_t *argv, uint8_t *event) {
 		case STATUS_DIGITAL_PIN_REPORT:
 		case STATUS_DIGITAL_PIN_SET:
 			count += 4;
-			event[0] = 255;
+			event[0] = STATUS_EVENT_BEGIN;
 			event[1] = sequenceId;
 			event[datastart] = (cmd & 0xF0) + (argc & 0x0F); // MSB=status + LSB=pin or port, bits are zeroed to prevent wrong input value
 			if (argv) event[datastart+1] = BIT_CLEAR(argv[0], BIT(7));
@@ -342,7 +315,7 @@ uint8_t encodeEvent(uint8_t cmd, uint8_t argc, uint8_t *argv, uint8_t *event) {
 		case STATUS_ANALOG_PIN_REPORT: // events with channel id and 2 bytes of data
 		case STATUS_ANALOG_PIN_SET:
 			count += 4;
-			event[0] = 255;
+			event[0] = STATUS_EVENT_BEGIN;
 			event[1] = sequenceId;
 			event[datastart] = (cmd & 0xF0) + (argc & 0x0F); // MSB=status + LSB=pin or port, bits are zeroed to prevent wrong input value
 			if (argv) event[datastart+1] = BIT_CLEAR(argv[0], BIT(7));
@@ -352,7 +325,7 @@ uint8_t encodeEvent(uint8_t cmd, uint8_t argc, uint8_t *argv, uint8_t *event) {
 		case STATUS_EMERGENCY_STOP:
 		case STATUS_SYSTEM_RESET:
 			count += 4;
-			event[0] = 255;
+			event[0] = STATUS_EVENT_BEGIN;
 			event[1] = sequenceId;
 			event[datastart] = cmd;
 			event[datastart+1] = BIT_CLEAR(argc, BIT(7));
@@ -365,19 +338,21 @@ uint8_t encodeEvent(uint8_t cmd, uint8_t argc, uint8_t *argv, uint8_t *event) {
 		case STATUS_SYSTEM_PAUSE:
 		case STATUS_SYSTEM_RESUME:
 			count += 4;
-			event[0] = 255;
+			event[0] = STATUS_EVENT_BEGIN;
 			event[1] = sequenceId;
 			event[datastart] = cmd;
 			if (argv) event[datastart+1] = BIT_CLEAR(*argv, BIT(7)); else event[datastart+2] = cmd;
 			if (argv) event[datastart+2] = BIT_CLEAR(*argv, BIT(7)); else event[datastart+2] = cmd;
 			break;
 		case STATUS_SYSEX_START: // sysex events 1+ bytes of data, realtime events, extended sysex, ...
-			datasize += cbEvalEnc(argc-2);
+			if ((argc > PROTOCOL_MAX_EVENT_BYTES) || (PROTOCOL_SYSEX_FRAMING + cbEvalEnc(argc) > PROTOCOL_MAX_EVENT_BYTES))
+				return 0;
+			datasize = cbEvalEnc(argc);
 			count += 1+datasize+2;
-			event[0] = 255;
+			event[0] = STATUS_EVENT_BEGIN;
 			event[1] = sequenceId;
 			event[datastart] = cmd; // sysex start
-			cbEncoder(argv, datasize, &event[datastart+1]);
+			cbEncoder(argv, argc, &event[datastart+1]);
 			event[count-2] = STATUS_SYSEX_END;
 			break;
 		default:
@@ -385,7 +360,7 @@ uint8_t encodeEvent(uint8_t cmd, uint8_t argc, uint8_t *argv, uint8_t *event) {
 			return 0;
 			break;
 	}
-	event[count-1] = CRC8(count,event);
+	event[count-1] = CRC8(count-1,event);
 	sequenceId++;
 	return count;
 }
@@ -535,3 +510,28 @@ uint8_t encodeSysexFeatures(uint8_t *result, uint8_t feature, uint8_t *data) {
 	return encodeSysex(result, 0, NULL);
 }
 
+uint8_t encodeSysexRelay(uint8_t *result, uint8_t dst, uint8_t src, uint8_t hops, uint8_t size, uint8_t *event) {
+	uint8_t data[6+RELAY_EVENT_MAX];
+	if (size > RELAY_EVENT_MAX) return 0;
+	data[0] = SYSEX_MOD_ASYNC;
+	data[1] = SYSEX_RELAY_DATA;
+	data[2] = SYSEX_SUB_RELAY_FORWARD;
+	data[3] = BIT_CLEAR(dst, BIT(7));
+	data[4] = BIT_CLEAR(src, BIT(7));
+	data[5] = BIT_CLEAR(hops, BIT(7));
+	for (uint8_t i=0;i<size;i++) {
+		data[6+i] = event[i];
+	}
+	return encodeSysex(result, 6+size, data);
+}
+
+uint8_t encodeSysexRoute(uint8_t *result, uint8_t cmd, uint8_t node, uint8_t port, uint8_t hops) {
+	uint8_t data[6];
+	data[0] = SYSEX_MOD_ASYNC;
+	data[1] = SYSEX_RELAY_DATA;
+	data[2] = cmd;
+	data[3] = BIT_CLEAR(node, BIT(7));
+	data[4] = BIT_CLEAR(port, BIT(7));
+	data[5] = BIT_CLEAR(hops, BIT(7));
+	return encodeSysex(result, 6, data);
+}
@@ -3,6 +3,7 @@
 #include <unistd.h>
 #include <string.h>
 #include <signal.h>
+#include <time.h>
 #include <utility/fdthread.linux.h>
 
 volatile sig_atomic_t running = 1;
@@ -20,7 +21,12 @@ int main(int argc, char *argv[]) {
 	printf("\n");
 	signal(SIGINT, sigint);
 
-	char fname[] = "/tmp/klipper-ng-pty3";
+	const char *fname = "/tmp/klipper-ng-pty3";
+	uint8_t quiet = 0;
+	for (int i=1;i<argc;i++) {
+		if (!strcmp(argv[i], "-q")) quiet = 1; // throughput only
+		else fname = argv[i];
+	}
 	uint8_t rx_data[BLOCK_SIZE];
 
 	int ret = initFdThread();
@@ -29,34 +35,36 @@ int main(int argc, char *argv[]) {
 		exit(1);
 	}
 
-    int fdin = fdOpen(fname, FD_TYPE_FILE);
-	int fdstdin = fdOpen("/dev/stdin", FD_TYPE_FILE);
-	int fdstdout = fdOpen("/dev/stdout", FD_TYPE_FILE);
-	int fdstderr = fdOpen("/dev/stderr", FD_TYPE_FILE);
-    if (fdin < 0) {
+	int fdin = fdOpen(fname, FD_TYPE_FILE);
+	if (fdin < 0) {
 		printf("fdOpen %s failed. (%d)\n", fname, fdin);
 		exit(1);
-    }
+	}
 
-	while(1) {
-		int len = fdRead(fdin, (uint8_t*)rx_data);
+	uint64_t total = 0, second = 0;
+	time_t last = time(NULL);
+	while(running) {
+		fdWait(fdin, 100);
+		int len = fdRead(fdin, rx_data, BLOCK_SIZE);
 		if (len < 0) {
 			printf("fdRead %s failed. (%d)\n", fname, len);
 			exit(1);
 		}
-		rx_data[len] = atoi("\0");
-		printf("r %d\n", len);
-		if (len>0) {
+		second += len;
+		if (len>0 && !quiet) {
+			printf("r %d\n", len);
 			for(int i=0;i<len;i++) {
 				printf("%x ", rx_data[i]);
 			}
+			printf("\n");
 		}
-		printf("\n");
-		for(int i=0;i<BLOCK_SIZE;i++) {
-			rx_data[i] = 0;
+		if (time(NULL) != last) {
+			total += second;
+			printf("- %lu bytes/s (%lu total)\n", (unsigned long)second, (unsigned long)total);
+			second = 0;
+			last = time(NULL);
 		}
-		usleep(500000);
 	}
 	closeFdThread();
+	exit(0);
 }
-
@@ -1,57 +1,155 @@
 
 #include <utility/cbuffer.h>
 #include <stdlib.h>
-#include <stdio.h>
+#include <string.h>
 
-void cbuf_reset(volatile cbuffer_t *buf) {
-	buf->head = 0;
-	buf->tail = 0;
+#ifdef __FIRMWARE_ARCH_AVR__
+#include <util/atomic.h>
+
+// 16 bit index access must not be split by the uart isr
+static inline cbuf_idx_t cbuf_load(cbuf_idx_t *idx) {
+	cbuf_idx_t v;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		v = *(volatile cbuf_idx_t *)idx;
+	}
+	return v;
 }
 
-uint8_t cbuf_init(volatile cbuffer_t *buf, uint16_t len) {
-	buf = (cbuffer_t*)malloc(sizeof(cbuffer_t));
-	buf->data = (uint8_t *)malloc(len);
-	buf->len = len;
-	cbuf_reset(buf);
-	return 0;
+static inline void cbuf_store(cbuf_idx_t *idx, cbuf_idx_t v) {
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		*(volatile cbuf_idx_t *)idx = v;
+	}
+}
+#else
+// acquire: data written before the index is published is visible once the index is read
+static inline cbuf_idx_t cbuf_load(cbuf_idx_t *idx) {
+	return __atomic_load_n(idx, __ATOMIC_ACQUIRE);
 }
 
-bool cbuf_is_empty(volatile cbuffer_t *buf) {
-	if (buf->head == buf->tail) return true;
-	return false;
+static inline void cbuf_store(cbuf_idx_t *idx, cbuf_idx_t v) {
+	__atomic_store_n(idx, v, __ATOMIC_RELEASE);
 }
+#endif
 
-bool cbuf_is_full(volatile cbuffer_t *buf) {
-	if (buf->head+1 == buf->tail) return true;
-	return false;
+// own index, only this side writes it
+static inline cbuf_idx_t cbuf_own(cbuf_idx_t *idx) {
+	return *(volatile cbuf_idx_t *)idx;
 }
 
-uint8_t cbuf_push(volatile cbuffer_t *buf, uint8_t *data, uint8_t len) {
-	for(uint8_t i=0;i<len;i++) {
-		int next;
-		next = buf->head + 1;  // next is where head will point to after this write.
-		if (next >= buf->len)
-			next = 0;
-		if (next == buf->tail)  // if the head + 1 == tail, circular buffer is full
-			return 1;
-		buf->data[buf->head] = data[i];  // Load data and then move
-		buf->head = next;             // head to next data offset.
-		return 0;  // return success to indicate successful push.
-	}
+uint8_t cbuf_init(cbuffer_t *buf, uint32_t len) {
+	// free running indices tell full from empty up to half their range
+	if (len > ((cbuf_idx_t)~0 >> 1) + 1UL) return 1;
+	uint32_t size = 1;
+	while (size < len) size <<= 1;
+	buf->data = (uint8_t *)malloc(size);
+	if (!buf->data) return 1;
+	buf->mask = size - 1;
+	cbuf_reset(buf);
 	return 0;
 }
 
-uint8_t cbuf_pop(volatile cbuffer_t *buf, uint8_t *data, uint8_t len) {
-	for(uint8_t i=0;i<len;i++) {
-		int next;
-		if (buf->head == buf->tail)  // if the head == tail, we don't have any data
-			return 1;
-		next = buf->tail + 1;  // next is where tail will point to after this read.
-		if(next >= buf->len)
-			next = 0;
-		data[i] = buf->data[buf->tail];  // Read data and then
-		buf->tail = next;              // move tail to next offset.
-		return 0;  // return success to indicate successful push.
-	}
+// use caller owned storage, len must be a power of two (don't cbuf_release it)
+uint8_t cbuf_attach(cbuffer_t *buf, uint8_t *data, uint32_t len) {
+	if ((len == 0) || (len & (len - 1))) return 1;
+	if (len > ((cbuf_idx_t)~0 >> 1) + 1UL) return 1;
+	buf->data = data;
+	buf->mask = len - 1;
+	cbuf_reset(buf);
 	return 0;
 }
+
+void cbuf_release(cbuffer_t *buf) {
+	free(buf->data);
+	buf->data = NULL;
+	buf->mask = 0;
+	cbuf_reset(buf);
+}
+
+// not safe while the other side is running
+void cbuf_reset(cbuffer_t *buf) {
+	cbuf_store(&buf->head, 0);
+	cbuf_store(&buf->tail, 0);
+}
+
+cbuf_idx_t cbuf_size(cbuffer_t *buf) {
+	return buf->data ? buf->mask + 1 : 0;
+}
+
+cbuf_idx_t cbuf_used(cbuffer_t *buf) {
+	return cbuf_load(&buf->head) - cbuf_load(&buf->tail);
+}
+
+cbuf_idx_t cbuf_free(cbuffer_t *buf) {
+	return cbuf_size(buf) - cbuf_used(buf);
+}
+
+bool cbuf_is_empty(cbuffer_t *buf) {
+	return cbuf_used(buf) == 0;
+}
+
+bool cbuf_is_full(cbuffer_t *buf) {
+	return cbuf_free(buf) == 0;
+}
+
+// PRODUCER ---------------------------------------------------------------------------------
+
+// copy up to len bytes, returns the number of bytes pushed
+cbuf_idx_t cbuf_push(cbuffer_t *buf, const uint8_t *data, cbuf_idx_t len) {
+	cbuf_idx_t head = cbuf_own(&buf->head);
+	cbuf_idx_t room = cbuf_size(buf) - (cbuf_idx_t)(head - cbuf_load(&buf->tail));
+	if (len > room) len = room;
+	if (len == 0) return 0;
+	cbuf_idx_t start = head & buf->mask;
+	cbuf_idx_t first = buf->mask + 1 - start;
+	if (first > len) first = len;
+	memcpy(buf->data + start, data, first);
+	if (len > first) memcpy(buf->data, data + first, len - first); // wrapped
+	cbuf_store(&buf->head, head + len);
+	return len;
+}
+
+// contiguous free space at *data, fill it then cbuf_publish() what was written
+cbuf_idx_t cbuf_reserve(cbuffer_t *buf, uint8_t **data) {
+	cbuf_idx_t head = cbuf_own(&buf->head);
+	cbuf_idx_t room = cbuf_size(buf) - (cbuf_idx_t)(head - cbuf_load(&buf->tail));
+	cbuf_idx_t start = head & buf->mask;
+	cbuf_idx_t first = buf->mask + 1 - start;
+	*data = buf->data + start;
+	return room < first ? room : first;
+}
+
+void cbuf_publish(cbuffer_t *buf, cbuf_idx_t len) {
+	cbuf_store(&buf->head, cbuf_own(&buf->head) + len);
+}
+
+// CONSUMER ---------------------------------------------------------------------------------
+
+// copy up to len bytes, returns the number of bytes popped
+cbuf_idx_t cbuf_pop(cbuffer_t *buf, uint8_t *data, cbuf_idx_t len) {
+	cbuf_idx_t tail = cbuf_own(&buf->tail);
+	cbuf_idx_t avail = cbuf_load(&buf->head) - tail;
+	if (len > avail) len = avail;
+	if (len == 0) return 0;
+	cbuf_idx_t start = tail & buf->mask;
+	cbuf_idx_t first = buf->mask + 1 - start;
+	if (first > len) first = len;
+	memcpy(data, buf->data + start, first);
+	if (len > first) memcpy(data + first, buf->data, len - first); // wrapped
+	cbuf_store(&buf->tail, tail + len);
+	return len;
+}
+
+// contiguous readable bytes at *data, parse them in place then cbuf_commit() what was used
+cbuf_idx_t cbuf_peek(cbuffer_t *buf, uint8_t **data) {
+	cbuf_idx_t tail = cbuf_own(&buf->tail);
+	cbuf_idx_t avail = cbuf_load(&buf->head) - tail;
+	cbuf_idx_t start = tail & buf->mask;
+	cbuf_idx_t first = buf->mask + 1 - start;
+	*data = buf->data + start;
+	return avail < first ? avail : first;
+}
+
+void cbuf_commit(cbuffer_t *buf, cbuf_idx_t len) {
+	cbuf_store(&buf->tail, cbuf_own(&buf->tail) + len);
+}
+
@@ -2,101 +2,555 @@
 #include <utility/fdthread.linux.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdlib.h>
 #include <pthread.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <time.h>
 #include <errno.h>
 #include <string.h>
 #include <termios.h>	// termios
 #include <pty.h>		// openpty
 
+#if defined(__NR_io_uring_setup) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define FD_URING 1
+#endif
+
 #define MAX_EVENTS 64
 
 const char *fd_pty_filename = "/tmp/klipper-ng-pty";
 int fd_idx = 3;
-static fd_t *fds;
-static int epoll_fd, running = 1, fdn = 0;
-static pthread_mutex_t fds_lock, rx_lock, tx_lock;
+int fd_backend = FD_BACKEND_EPOLL;
+volatile fd_stats_t fd_stats;
+static fd_t *fds[FD_MAX];
+static uint8_t *fd_arena; // rings storage, fd id * 2 is rx, fd id * 2 + 1 is tx
+static int epoll_fd = -1, wake_fd = -1, fdn = 0;
+static volatile int running = 0;
+static pthread_mutex_t fds_lock, rx_lock;
+static pthread_cond_t rx_cond, close_cond;
 static pthread_t epoll_th;
 
 fptr_alarm_t rBufferFullHandler;
 fptr_alarm_t wBufferFullHandler;
 
+static fd_t *fd_get(int fdid) {
+	if ((fdid < 0) || (fdid >= FD_MAX)) return NULL;
+	return fds[fdid];
+}
+
+// wake up the I/O thread (eventfd counter, many calls are a single wake up)
+static void fd_wakeup(void) {
+	uint64_t one = 1;
+	if (write(wake_fd, &one, sizeof(one)) < 0) return; // counter saturated, wake up pending anyway
+}
+
+// wake up fdWait callers
+static void fd_rx_notify(void) {
+	pthread_mutex_lock(&rx_lock);
+	pthread_cond_broadcast(&rx_cond);
+	pthread_mutex_unlock(&rx_lock);
+}
+
+// thread done with tx, returns 1 if fdWrite queued more meanwhile (it saw tx_busy and didn't wake us)
+static uint8_t fd_tx_idle(fd_t *f) {
+	__atomic_store_n(&f->tx_busy, 0, __ATOMIC_SEQ_CST);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	return !cbuf_is_empty(&f->tx);
+}
+
+
+// EPOLL ------------------------------------------------------------------------------------
+
+// update the epoll interest list of a fd
+static void fd_events(fd_t *f) {
+	if (!f->pollable || f->eof) return;
+	f->event.events = (f->rx_paused ? 0 : EPOLLIN) | (f->tx_busy ? EPOLLOUT : 0);
+	epoll_ctl(epoll_fd, EPOLL_CTL_MOD, f->fd, &f->event);
+	fd_stats.syscalls++;
+}
+
+// peer is back (or never left): register the fd again
+static void fd_rearm(fd_t *f) {
+	f->eof = 0;
+	f->event.events = (f->rx_paused ? 0 : EPOLLIN) | (f->tx_busy ? EPOLLOUT : 0);
+	epoll_ctl(epoll_fd, EPOLL_CTL_ADD, f->fd, &f->event);
+	fd_stats.syscalls++;
+}
+
+static uint64_t fd_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// read until EAGAIN or the rx ring is full, returns 1 if something was read
+static uint8_t fd_rx(fd_t *f) {
+	uint8_t got = 0;
+	uint8_t *p;
+	while (1) {
+		cbuf_idx_t room = cbuf_reserve(&f->rx, &p);
+		if (room == 0) { // stop polling it until fdRead makes room
+			if (f->pollable && !f->rx_paused) {
+				f->rx_paused = 1;
+				fd_events(f);
+			}
+			if (rBufferFullHandler != NULL) rBufferFullHandler(f->id);
+			break;
+		}
+		ssize_t n = read(f->fd, p, room);
+		fd_stats.syscalls++;
+		if (n > 0) {
+			if (f->eof) fd_rearm(f);
+			cbuf_publish(&f->rx, n);
+			fd_stats.events++;
+			fd_stats.rx_bytes += n;
+			got = 1;
+			continue;
+		}
+		if ((n < 0) && (errno == EINTR)) continue;
+		if (!f->pollable) break; // regular files may grow, keep reading them
+		if ((n < 0) && (errno == EAGAIN)) {
+			if (f->eof) fd_rearm(f); // pty slave opened again, nothing sent yet
+		} else if (!f->eof) {
+			// end of file or hang up: a level triggered EPOLLHUP would wake us up forever, so
+			// stop polling it and probe it every FD_POLL_MS until the peer comes back
+			epoll_ctl(epoll_fd, EPOLL_CTL_DEL, f->fd, &f->event);
+			f->eof = 1;
+		}
+		break;
+	}
+	return got;
+}
+
+// write as much as the fd takes, wait for EPOLLOUT if something is left
+static void fd_tx(fd_t *f) {
+	uint8_t *p;
+	cbuf_idx_t len;
+	while (1) {
+		while ((len = cbuf_peek(&f->tx, &p)) > 0) {
+			ssize_t n = write(f->fd, p, len);
+			fd_stats.syscalls++;
+			if (n > 0) {
+				cbuf_commit(&f->tx, n);
+				fd_stats.events++;
+				fd_stats.tx_bytes += n;
+				continue;
+			}
+			if ((n < 0) && (errno == EINTR)) continue;
+			if ((n < 0) && (errno != EAGAIN)) { // can't be sent, drop it
+				printf("Can't write fdid %d (%s)\n", f->id, strerror(errno));
+				cbuf_commit(&f->tx, cbuf_used(&f->tx));
+			}
+			break;
+		}
+		if (!cbuf_is_empty(&f->tx) && f->pollable) {
+			if (!f->tx_busy) {
+				f->tx_busy = 1;
+				fd_events(f); // EPOLLOUT on
+			}
+			return;
+		}
+		uint8_t was_busy = f->tx_busy;
+		uint8_t more = fd_tx_idle(f);
+		if (was_busy) fd_events(f); // EPOLLOUT off
+		if (!more || !f->pollable) return; // regular files: retried next loop
+	}
+}
+
 static void *_epoll_th(void *data) {
-	int event_count, i;
-	size_t bytes_read;
 	struct epoll_event events[MAX_EVENTS];
-	while(running) {
-		//printf("epoll start\n");
-		// read polled fds
-		event_count = epoll_wait(epoll_fd, events, MAX_EVENTS, 0);
+	uint64_t probe_ms = fd_ms();
+	while (running) {
+		int event_count = epoll_wait(epoll_fd, events, MAX_EVENTS, FD_POLL_MS);
+		uint8_t got = 0;
+		fd_stats.loops++;
+		fd_stats.syscalls++;
 		pthread_mutex_lock(&fds_lock);
-		pthread_mutex_lock(&rx_lock);
-		for(i = 0; i < event_count; i++) {
-			int idx;
-			for(idx=0;idx<fdn;idx++) if(fds[fdn].event.data.fd==events[i].data.fd) break;
-			if (fds[idx].rx_buffer_len<BLOCK_SIZE) {
-				bytes_read = read(events[i].data.fd, (&fds[idx].rx_buffer)+fds[idx].rx_buffer_len, BLOCK_SIZE-fds[idx].rx_buffer_len);
-				fds[idx].rx_buffer_len += bytes_read;
-			} else {
-				if ((fds[idx].rx_buffer_len >= BLOCK_SIZE)&&(rBufferFullHandler!=NULL)) rBufferFullHandler(idx);
+		for (int i = 0; i < event_count; i++) {
+			fd_t *f = (fd_t *)events[i].data.ptr;
+			if (f == NULL) { // wake up, the fds scan below does the job
+				uint64_t count;
+				fd_stats.syscalls++;
+				if (read(wake_fd, &count, sizeof(count)) < 0) continue;
+				continue;
+			}
+			if (f->closing) continue; // dropped below
+			if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) got |= fd_rx(f);
+			if (events[i].events & EPOLLOUT) fd_tx(f);
+		}
+		// data queued by fdWrite, room made by fdRead, regular files, hung up fds
+		uint8_t probe = 0;
+		if (fd_ms() - probe_ms >= FD_POLL_MS) {
+			probe_ms = fd_ms();
+			probe = 1;
+		}
+		for (int i = 0; i < fdn; i++) {
+			fd_t *f = fds[i];
+			if (f == NULL) continue;
+			if (f->closing) {
+				// out of the interest list before fdClose frees it: the events of the next
+				// epoll_wait can't point to it anymore
+				if (f->pollable && !f->eof) epoll_ctl(epoll_fd, EPOLL_CTL_DEL, f->fd, &f->event);
+				fds[i] = NULL;
+				f->closing = 3;
+				pthread_cond_broadcast(&close_cond);
+				continue;
+			}
+			if (f->rx_paused && !cbuf_is_full(&f->rx)) {
+				f->rx_paused = 0;
+				fd_events(f);
+				got |= fd_rx(f);
+			}
+			if (!f->pollable || (f->eof && probe)) got |= fd_rx(f);
+			if (!f->tx_busy && !cbuf_is_empty(&f->tx)) fd_tx(f);
+		}
+		pthread_mutex_unlock(&fds_lock);
+		if (got) fd_rx_notify();
+	}
+	// flush what is left
+	pthread_mutex_lock(&fds_lock);
+	for (int i = 0; i < fdn; i++) {
+		if (fds[i]) fd_tx(fds[i]);
+	}
+	pthread_mutex_unlock(&fds_lock);
+	data = data; // unused parameter
+	return NULL;
+}
+
+
+// IO_URING ---------------------------------------------------------------------------------
+//
+// No liburing: the rings are mapped and driven with the raw syscalls.
+// Every request carries its fd id and operation in user_data, the eventfd read and the
+// FD_POLL_MS timeout (reading regular files, bounding shutdown) have their own tags.
+
+#ifdef FD_URING
+
+#define URING_ENTRIES	64	// sq size: a read and a write per fd, cancels, wake up and tick
+#define URING_RX		0
+#define URING_TX		1
+#define URING_CANCEL	2
+#define URING_WAKE		0xFFFFFFFFULL
+#define URING_TICK		0xFFFFFFFEULL
+#define URING_DATA(id, op)	(((uint64_t)(id) << 8) | (op))
+
+static struct {
+	int fd;
+	unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned *cq_head, *cq_tail, *cq_mask;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	void *sq_ptr, *cq_ptr;
+	size_t sq_len, cq_len, sqes_len;
+	unsigned to_submit;
+} uring = { .fd = -1 };
+
+static int uring_enter(unsigned min_complete) {
+	int ret;
+	do {
+		ret = syscall(__NR_io_uring_enter, uring.fd, uring.to_submit, min_complete,
+			min_complete ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+		fd_stats.syscalls++;
+	} while ((ret < 0) && (errno == EINTR));
+	if (ret > 0) uring.to_submit -= ret;
+	return ret;
+}
+
+// next free sqe, submits the queued ones if the sq is full
+static struct io_uring_sqe *uring_sqe(uint8_t opcode, int fd, void *addr, uint32_t len, uint64_t data) {
+	unsigned tail = *uring.sq_tail;
+	if (tail - __atomic_load_n(uring.sq_head, __ATOMIC_ACQUIRE) > *uring.sq_mask) {
+		uring_enter(0);
+		if (tail - __atomic_load_n(uring.sq_head, __ATOMIC_ACQUIRE) > *uring.sq_mask) return NULL;
+	}
+	unsigned idx = tail & *uring.sq_mask;
+	struct io_uring_sqe *sqe = &uring.sqes[idx];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = opcode;
+	sqe->fd = fd;
+	sqe->addr = (uint64_t)(uintptr_t)addr;
+	sqe->len = len;
+	sqe->user_data = data;
+	uring.sq_array[idx] = idx;
+	__atomic_store_n(uring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+	uring.to_submit++;
+	return sqe;
+}
+
+static void uring_close(void) {
+	if (uring.sqes) munmap(uring.sqes, uring.sqes_len);
+	if (uring.cq_ptr && (uring.cq_ptr != uring.sq_ptr)) munmap(uring.cq_ptr, uring.cq_len);
+	if (uring.sq_ptr) munmap(uring.sq_ptr, uring.sq_len);
+	if (uring.fd >= 0) close(uring.fd); // cancels the requests still in flight
+	memset(&uring, 0, sizeof(uring));
+	uring.fd = -1;
+}
+
+static uint8_t uring_supported(struct io_uring_probe *probe, uint8_t op) {
+	return (op < probe->ops_len) && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+}
+
+// probe the kernel and set the ring up, -1 if io_uring (or something we need) is missing
+static int uring_setup(void) {
+	struct io_uring_params p;
+	memset(&p, 0, sizeof(p));
+	uring.fd = syscall(__NR_io_uring_setup, URING_ENTRIES, &p);
+	if (uring.fd < 0) return -1;
+	// read/write at the current file position (regular files), needed ops
+	size_t probe_len = sizeof(struct io_uring_probe) + IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+	struct io_uring_probe *probe = calloc(1, probe_len);
+	int ret = -1;
+	if (probe && (p.features & IORING_FEAT_RW_CUR_POS) &&
+		(syscall(__NR_io_uring_register, uring.fd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) == 0) &&
+		uring_supported(probe, IORING_OP_READ_FIXED) && uring_supported(probe, IORING_OP_WRITE_FIXED) &&
+		uring_supported(probe, IORING_OP_READ) && uring_supported(probe, IORING_OP_TIMEOUT) &&
+		uring_supported(probe, IORING_OP_ASYNC_CANCEL)) ret = 0;
+	free(probe);
+	if (ret) {
+		uring_close();
+		return ret;
+	}
+	// map sq, cq and sqes
+	uring.sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	uring.cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (uring.cq_len > uring.sq_len) uring.sq_len = uring.cq_len;
+		uring.cq_len = uring.sq_len;
+	}
+	uring.sq_ptr = mmap(NULL, uring.sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring.fd, IORING_OFF_SQ_RING);
+	if (uring.sq_ptr == MAP_FAILED) {
+		uring.sq_ptr = NULL;
+		uring_close();
+		return -1;
+	}
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		uring.cq_ptr = uring.sq_ptr;
+	} else {
+		uring.cq_ptr = mmap(NULL, uring.cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring.fd, IORING_OFF_CQ_RING);
+		if (uring.cq_ptr == MAP_FAILED) {
+			uring.cq_ptr = NULL;
+			uring_close();
+			return -1;
+		}
+	}
+	uring.sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	uring.sqes = mmap(NULL, uring.sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring.fd, IORING_OFF_SQES);
+	if (uring.sqes == MAP_FAILED) {
+		uring.sqes = NULL;
+		uring_close();
+		return -1;
+	}
+	uint8_t *sq = (uint8_t *)uring.sq_ptr, *cq = (uint8_t *)uring.cq_ptr;
+	uring.sq_head = (unsigned *)(sq + p.sq_off.head);
+	uring.sq_tail = (unsigned *)(sq + p.sq_off.tail);
+	uring.sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+	uring.sq_array = (unsigned *)(sq + p.sq_off.array);
+	uring.cq_head = (unsigned *)(cq + p.cq_off.head);
+	uring.cq_tail = (unsigned *)(cq + p.cq_off.tail);
+	uring.cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+	uring.cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+	// register the rings storage, buffer index is the fd_arena slot
+	struct iovec iov[FD_MAX * 2];
+	for (int i = 0; i < FD_MAX * 2; i++) {
+		iov[i].iov_base = fd_arena + i * FD_RING_SIZE;
+		iov[i].iov_len = FD_RING_SIZE;
+	}
+	if (syscall(__NR_io_uring_register, uring.fd, IORING_REGISTER_BUFFERS, iov, FD_MAX * 2) < 0) {
+		uring_close(); // RLIMIT_MEMLOCK too low, most likely
+		return -1;
+	}
+	return 0;
+}
+
+// queue the reads and writes a fd needs, returns 1 if it has tx data in flight
+static uint8_t uring_fd_submit(fd_t *f, uint8_t reading, uint8_t tick) {
+	uint8_t *p;
+	// hung up fds are probed every tick like regular files, a completed read clears eof
+	if (reading && !f->rx_busy && ((f->pollable && !f->eof) || tick)) {
+		cbuf_idx_t room = cbuf_reserve(&f->rx, &p);
+		if (room) {
+			struct io_uring_sqe *sqe = uring_sqe(IORING_OP_READ_FIXED, f->fd, p, room, URING_DATA(f->id, URING_RX));
+			if (sqe) {
+				sqe->off = (uint64_t)-1; // current position
+				sqe->buf_index = f->id * 2;
+				f->rx_busy = 1;
+				f->rx_paused = 0;
 			}
+		} else if (!f->rx_paused) {
+			f->rx_paused = 1;
+			if (rBufferFullHandler != NULL) rBufferFullHandler(f->id);
 		}
-		pthread_mutex_unlock(&rx_lock);
-		int n = fdn, i = 0;
-		while (i<n) {
-			//printf("%d FDs, FD %d\n", n, i);
-			// read file fds
-			//printf("fds[%d].rx_buffer_len %d\n", i, fds[i].rx_buffer_len);
-			pthread_mutex_lock(&rx_lock);
-			if(fds[i].type == FD_TYPE_FILE||FD_TYPE_PTY) {
-				if (fds[i].rx_buffer_len<BLOCK_SIZE) {
-					printf("read %d, len %d\n", i, fds[i].rx_buffer_len);
-					int res = read(events[i].data.fd, (&fds[i].rx_buffer)+fds[i].rx_buffer_len, BLOCK_SIZE-fds[i].rx_buffer_len);
-					//printf("done %d\n", i);
-					if(res < 0) {
-						printf("Can't read fdid %d (%s)\n", i, strerror(errno));
-					} else {
-						fds[i].rx_buffer_len += bytes_read;
-					}
+	}
+	if (!f->tx_busy) {
+		cbuf_idx_t len = cbuf_peek(&f->tx, &p);
+		if (len) {
+			struct io_uring_sqe *sqe = uring_sqe(IORING_OP_WRITE_FIXED, f->fd, p, len, URING_DATA(f->id, URING_TX));
+			if (sqe) {
+				sqe->off = (uint64_t)-1;
+				sqe->buf_index = f->id * 2 + 1;
+				f->tx_busy = 1;
+			}
+		}
+	}
+	return f->tx_busy;
+}
+
+// completion of a fd request, returns 1 if rx data arrived
+static uint8_t uring_fd_complete(fd_t *f, uint8_t op, int res) {
+	if (op == URING_RX) {
+		f->rx_busy = 0;
+		if (res > 0) {
+			f->eof = 0;
+			cbuf_publish(&f->rx, res);
+			fd_stats.events++;
+			fd_stats.rx_bytes += res;
+			return 1;
+		}
+		// end of file or hang up (regular files may grow, read again next tick)
+		if ((res == 0) && f->pollable) f->eof = 1;
+		if ((res < 0) && (res != -EAGAIN) && (res != -EINTR) && (res != -ECANCELED)) f->eof = 1;
+	} else if (op == URING_TX) {
+		if (res > 0) {
+			cbuf_commit(&f->tx, res);
+			fd_stats.events++;
+			fd_stats.tx_bytes += res;
+		} else if ((res < 0) && (res != -EAGAIN) && (res != -EINTR) && (res != -ECANCELED)) {
+			printf("Can't write fdid %d (%s)\n", f->id, strerror(-res));
+			cbuf_commit(&f->tx, cbuf_used(&f->tx));
+		}
+		fd_tx_idle(f); // next write is queued at the top of the loop
+	}
+	return 0;
+}
+
+static void *_uring_th(void *data) {
+	uint64_t wake_count;
+	struct __kernel_timespec tick = { .tv_sec = FD_POLL_MS / 1000, .tv_nsec = (FD_POLL_MS % 1000) * 1000000L };
+	uint8_t wake_armed = 0, tick_armed = 0, tick_due = 1, drain_ticks = 0;
+	while (1) {
+		uint8_t got = 0, pending = 0;
+		fd_stats.loops++;
+		// queue the requests missing
+		if (!wake_armed && uring_sqe(IORING_OP_READ, wake_fd, &wake_count, sizeof(wake_count), URING_WAKE)) wake_armed = 1;
+		if (!tick_armed && uring_sqe(IORING_OP_TIMEOUT, -1, &tick, 1, URING_TICK)) tick_armed = 1;
+		pthread_mutex_lock(&fds_lock);
+		for (int i = 0; i < fdn; i++) {
+			fd_t *f = fds[i];
+			if (f == NULL) continue;
+			if (f->closing) { // cancel what is in flight, let fdClose free it once done
+				if (f->closing == 1) { // retried next loop if the sq is full
+					uint8_t queued = 1;
+					if (f->rx_busy) queued &= uring_sqe(IORING_OP_ASYNC_CANCEL, -1, (void *)(uintptr_t)URING_DATA(i, URING_RX), 0, URING_DATA(i, URING_CANCEL)) != NULL;
+					if (f->tx_busy) queued &= uring_sqe(IORING_OP_ASYNC_CANCEL, -1, (void *)(uintptr_t)URING_DATA(i, URING_TX), 0, URING_DATA(i, URING_CANCEL)) != NULL;
+					if (queued) f->closing = 2;
+				}
+				if (!f->rx_busy && !f->tx_busy) { // all completed (canceled or not)
+					fds[i] = NULL;
+					f->closing = 3;
+					pthread_cond_broadcast(&close_cond);
 				}
+				continue;
 			}
-			pthread_mutex_unlock(&rx_lock);
-			// write fds
-			//printf("fds[%d].tx_buffer_len %d\n", i, fds[i].tx_buffer_len);
-			pthread_mutex_lock(&tx_lock);
-			if (fds[i].tx_buffer_len>0) {
-				write(fds[i].event.data.fd, fds[i].tx_buffer, fds[i].tx_buffer_len);
-				fds[i].tx_buffer_len = 0;
+			pending |= uring_fd_submit(f, running, tick_due);
+		}
+		pthread_mutex_unlock(&fds_lock);
+		tick_due = 0;
+		// shutting down: leave once tx is flushed (or after a couple of ticks)
+		if (!running && (!pending || (drain_ticks > 1))) break;
+		// submit all and wait for a completion: one syscall per loop
+		if (uring_enter(1) < 0) {
+			printf("io_uring_enter failed (%s)\n", strerror(errno));
+			break;
+		}
+		pthread_mutex_lock(&fds_lock);
+		unsigned head = *uring.cq_head;
+		unsigned tail = __atomic_load_n(uring.cq_tail, __ATOMIC_ACQUIRE);
+		for (; head != tail; head++) {
+			struct io_uring_cqe *cqe = &uring.cqes[head & *uring.cq_mask];
+			uint64_t tag = cqe->user_data;
+			if (tag == URING_WAKE) {
+				wake_armed = 0;
+			} else if (tag == URING_TICK) {
+				tick_armed = 0;
+				tick_due = 1;
+				if (!running) drain_ticks++;
+			} else {
+				fd_t *f = fd_get(tag >> 8);
+				if (f) got |= uring_fd_complete(f, tag & 0xFF, cqe->res);
 			}
-			pthread_mutex_unlock(&tx_lock);
-			i++;
 		}
+		__atomic_store_n(uring.cq_head, head, __ATOMIC_RELEASE);
 		pthread_mutex_unlock(&fds_lock);
-		usleep(1);
-		//printf("epoll stop\n");
+		if (got) fd_rx_notify();
 	}
+	data = data; // unused parameter
 	return NULL;
 }
 
+#endif
+
+
+// API --------------------------------------------------------------------------------------
+
 int initFdThread(void) {
-	// init data store
-	fds = calloc(1, sizeof(fd_t));
-	// init epoll
-	epoll_fd = epoll_create1(0);
-	if(epoll_fd < 0) {
-		return epoll_fd;
+	if (running) return 0;
+	memset((void *)&fd_stats, 0, sizeof(fd_stats));
+	// rings storage, page aligned for buffer registration
+	if (posix_memalign((void **)&fd_arena, 4096, FD_MAX * 2 * FD_RING_SIZE)) {
+		fd_arena = NULL;
+		return -ENOMEM;
+	}
+	// blocking: io_uring would complete a read on a non-blocking one with EAGAIN right away
+	wake_fd = eventfd(0, EFD_CLOEXEC);
+	if (wake_fd < 0) {
+		free(fd_arena);
+		return wake_fd;
+	}
+	void *(*loop)(void *) = _epoll_th;
+#ifdef FD_URING
+	if ((fd_backend == FD_BACKEND_URING) && (uring_setup() == 0)) {
+		loop = _uring_th;
+	} else {
+		if (fd_backend == FD_BACKEND_URING) printf("io_uring not available, using epoll\n");
+		fd_backend = FD_BACKEND_EPOLL;
+	}
+#else
+	fd_backend = FD_BACKEND_EPOLL;
+#endif
+	// init epoll (used for regular files detection with io_uring), wake up eventfd has no fd_t
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	struct epoll_event event = { .events = EPOLLIN, .data.ptr = NULL };
+	if ((epoll_fd < 0) || (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_fd, &event) < 0)) {
+#ifdef FD_URING
+		uring_close();
+#endif
+		if (epoll_fd >= 0) close(epoll_fd);
+		close(wake_fd);
+		free(fd_arena);
+		return -1;
 	}
 	// init thread
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&rx_cond, &attr);
+	pthread_condattr_destroy(&attr);
+	pthread_cond_init(&close_cond, NULL);
 	pthread_mutex_init(&fds_lock, NULL);
 	pthread_mutex_init(&rx_lock, NULL);
-	pthread_mutex_init(&tx_lock, NULL);
-	int ret = pthread_create(&epoll_th, NULL, _epoll_th, NULL);
-	if(ret < 0) return ret;
+	running = 1;
+	int ret = pthread_create(&epoll_th, NULL, loop, NULL);
+	if (ret) {
+		running = 0;
+		return -ret;
+	}
 	return 0;
 }
 
@@ -137,117 +591,171 @@ int fdCreateSocket(const char *fname) {
 }
 
 int fdOpen(const char *fname, uint8_t type) {
-	int newfd = 0;
 	// create
 	if (access(fname, F_OK) < 0) {
 		return -1;
 	}
 	// open
-	pthread_mutex_lock(&fds_lock);
-	fds = realloc(fds, (fdn+1)*sizeof(fd_t));
-	pthread_mutex_unlock(&fds_lock);
-	fds[fdn].type = type;
-	fds[fdn].event.events = EPOLLIN;
-	if (newfd) fds[fdn].event.data.fd = newfd;
-	else fds[fdn].event.data.fd = open(fname, O_RDWR|O_NONBLOCK);
-	printf("- open %s (fd %d)\n", fname, fds[fdn].event.data.fd);
-	if(fds[fdn].event.data.fd < 0) {
+	int newfd = open(fname, O_RDWR|O_NONBLOCK);
+	printf("- open %s (fd %d)\n", fname, newfd);
+	if (newfd < 0) {
 		printf("Can't open file \"%s\" (%s)\n", fname, strerror(errno));
-		return fds[fdn].event.data.fd;
+		return newfd;
 	}
-	pthread_mutex_lock(&rx_lock);
-	fds[fdn].rx_buffer = calloc(BLOCK_SIZE, sizeof(uint8_t *));
-	fds[fdn].rx_buffer_len = 0;
-	pthread_mutex_unlock(&rx_lock);
-	pthread_mutex_lock(&tx_lock);
-	fds[fdn].tx_buffer = calloc(BLOCK_SIZE, sizeof(uint8_t));
-	fds[fdn].tx_buffer_len = 0;
-	pthread_mutex_unlock(&tx_lock);
-	if(type>1) {
-		int ret = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fds[fdn].event.data.fd, &fds[fdn].event);
-		if(ret) {
-			printf("Can't add \"%s\" to poll queue. (%s)\n", fname, strerror(errno));
-			return ret;
-		}
+	fd_t *f = calloc(1, sizeof(fd_t));
+	if (f == NULL) {
+		close(newfd);
+		return -1;
 	}
+	f->type = type;
+	f->fd = newfd;
+	f->event.events = EPOLLIN;
+	f->event.data.ptr = f;
 	pthread_mutex_lock(&fds_lock);
-	fdn++;
+	int fdid = 0;
+	while ((fdid < FD_MAX) && fds[fdid]) fdid++;
+	if (fdid == FD_MAX) {
+		pthread_mutex_unlock(&fds_lock);
+		printf("Can't open \"%s\", too many files\n", fname);
+		free(f);
+		close(newfd);
+		return -1;
+	}
+	f->id = fdid;
+	cbuf_attach(&f->rx, fd_arena + fdid * 2 * FD_RING_SIZE, FD_RING_SIZE);
+	cbuf_attach(&f->tx, fd_arena + (fdid * 2 + 1) * FD_RING_SIZE, FD_RING_SIZE);
+	// regular files can't be polled (EPERM), the thread reads them at every loop
+	if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, newfd, &f->event) == 0) {
+		f->pollable = 1;
+	} else if (errno != EPERM) {
+		pthread_mutex_unlock(&fds_lock);
+		printf("Can't add \"%s\" to poll queue. (%s)\n", fname, strerror(errno));
+		free(f);
+		close(newfd);
+		return -1;
+	}
+	if ((fd_backend == FD_BACKEND_URING) && f->pollable) {
+		// io_uring waits for blocking fds itself, it would hand EAGAIN back on non-blocking ones
+		epoll_ctl(epoll_fd, EPOLL_CTL_DEL, newfd, &f->event);
+		fcntl(newfd, F_SETFL, fcntl(newfd, F_GETFL) & ~O_NONBLOCK);
+	}
+	fds[fdid] = f;
+	if (fdid >= fdn) fdn = fdid + 1;
 	pthread_mutex_unlock(&fds_lock);
-	return fdn-1;
+	if (fd_backend == FD_BACKEND_URING) fd_wakeup(); // queue its first read
+	return fdid;
 }
 
 int fdGet(int fdid) {
-	return fds[fdid].event.data.fd;
+	fd_t *f = fd_get(fdid);
+	if (!f) return -1;
+	return f->fd;
 }
 
 int fdAvailable(int fdid) {
-	return fds[fdid].rx_buffer_len;
+	fd_t *f = fd_get(fdid);
+	if (!f) return 0;
+	return cbuf_used(&f->rx);
 }
 
-int fdRead(int fdid, uint8_t *data) {
-	int i = 0;
-	if(fds[fdid].type>0) {
-		pthread_mutex_lock(&rx_lock);
-		while (i<fds[fdid].rx_buffer_len) {
-			//printf("fdid %d -> (%d) %d\n",fdid,i,data[i]);
-			data[i] = fds[fdid].rx_buffer[i];
-			i++;
-		}
-		fds[fdid].rx_buffer_len = 0;
-		pthread_mutex_unlock(&rx_lock);
-	} else {
-		i = read(fds[fdid].event.data.fd,data,BLOCK_SIZE);
+// wait up to timeout_ms for data to read, returns the bytes available
+int fdWait(int fdid, int timeout_ms) {
+	fd_t *f = fd_get(fdid);
+	if (!f) return -1;
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ts.tv_sec += timeout_ms / 1000;
+	ts.tv_nsec += (timeout_ms % 1000) * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
 	}
-	return i;
+	pthread_mutex_lock(&rx_lock);
+	while (cbuf_is_empty(&f->rx) && running) {
+		if (pthread_cond_timedwait(&rx_cond, &rx_lock, &ts)) break;
+	}
+	pthread_mutex_unlock(&rx_lock);
+	return cbuf_used(&f->rx);
+}
+
+// read up to len bytes, returns the bytes read
+int fdRead(int fdid, uint8_t *data, int len) {
+	fd_t *f = fd_get(fdid);
+	if (!f) return -1;
+	if (len <= 0) return 0;
+	int n = cbuf_pop(&f->rx, data, len);
+	if (n && f->rx_paused) fd_wakeup(); // room again, read it
+	return n;
 }
 
+// queue len bytes, returns the bytes queued (less than len if the tx ring is full)
 int fdWrite(int fdid, uint8_t *data, int len) {
-	pthread_mutex_lock(&tx_lock);
-	if (fds[fdid].tx_buffer_len+len>BLOCK_SIZE) {
+	fd_t *f = fd_get(fdid);
+	if (!f) return -1;
+	if (len <= 0) return 0;
+	int n = cbuf_push(&f->tx, data, len);
+	if (n < len) {
 		if (wBufferFullHandler!=NULL) wBufferFullHandler(fdid);
 		else printf("TX Buffer full.\n");
-		pthread_mutex_unlock(&tx_lock);
-		return 0;
-	}
-	int i = 0;
-	while (i<len) {
-		fds[fdid].tx_buffer[i] = data[i];
-		i++;
 	}
-	fds[fdid].tx_buffer_len += len;
-	pthread_mutex_unlock(&tx_lock);
-	return len;
+	// no wake up if the thread comes back to this fd anyway (see fd_tx_idle)
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (n && !__atomic_load_n(&f->tx_busy, __ATOMIC_SEQ_CST)) fd_wakeup();
+	return n;
 }
 
 int fdClose(int fdid) {
-	int ret = epoll_ctl(epoll_fd, EPOLL_CTL_DEL, 0, &fds[fdid].event);
-	if(ret<0) {
-		return ret;
+	pthread_mutex_lock(&fds_lock);
+	fd_t *f = fd_get(fdid);
+	if (!f || f->closing) {
+		pthread_mutex_unlock(&fds_lock);
+		return -1;
 	}
-	ret = close(fds[fdid-1].event.data.fd);
-	if (ret<0) return ret;
-	fdn--;
-	return 0;
+	// the I/O thread may be using it (epoll events already returned, io_uring requests in
+	// flight, cancelled first): it drops the fd and tells us once done
+	f->closing = 1;
+	fd_wakeup();
+	while (running && (f->closing != 3)) pthread_cond_wait(&close_cond, &fds_lock);
+	if ((f->closing != 3) && (fd_backend == FD_BACKEND_EPOLL) && f->pollable && !f->eof)
+		epoll_ctl(epoll_fd, EPOLL_CTL_DEL, f->fd, &f->event); // no thread anymore
+	fds[fdid] = NULL;
+	pthread_mutex_unlock(&fds_lock);
+	int ret = close(f->fd);
+	free(f);
+	return ret;
 }
 
 int closeFdThread(void) {
-	// flush buffer
-	// TODO
-	// terminate thread
-	pthread_cancel(epoll_th);
+	if (!running) return 0;
+	// terminate thread (it flushes tx buffers before leaving)
+	running = 0;
+	fd_wakeup();
 	int ret = pthread_join(epoll_th, NULL);
-	pthread_mutex_destroy(&fds_lock);
-	pthread_mutex_destroy(&rx_lock);
-	pthread_mutex_destroy(&tx_lock);
+	// release waiting readers and closers
+	fd_rx_notify();
+	pthread_mutex_lock(&fds_lock);
+	pthread_cond_broadcast(&close_cond);
+	pthread_mutex_unlock(&fds_lock);
+#ifdef FD_URING
+	if (fd_backend == FD_BACKEND_URING) uring_close();
+#endif
 	// close all FDs
-	close(epoll_fd);
-	while (fdn>0) {
-		close(fds[fdn-1].event.data.fd);
-		free(fds[fdn-1].rx_buffer);
-		free(fds[fdn-1].tx_buffer);
-		fdn--;
+	for (int i = 0; i < fdn; i++) {
+		if (fds[i] == NULL) continue;
+		close(fds[i]->fd);
+		free(fds[i]);
+		fds[i] = NULL;
 	}
-	free(fds);
+	fdn = 0;
+	close(wake_fd);
+	close(epoll_fd);
+	wake_fd = -1;
+	epoll_fd = -1;
+	free(fd_arena);
+	fd_arena = NULL;
+	pthread_mutex_destroy(&fds_lock);
+	pthread_mutex_destroy(&rx_lock);
+	pthread_cond_destroy(&rx_cond);
+	pthread_cond_destroy(&close_cond);
 	return ret;
 }
-
@@ -0,0 +1 @@
+pulsethread.linux.c
\ No newline at end of file
@@ -0,0 +1,254 @@
+
+#include <utility/pulsethread.linux.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/timerfd.h>
+
+volatile pulse_stats_t pulse_stats;
+
+static pthread_t pulse_th;
+static pthread_mutex_t pulse_lock;
+static pthread_cond_t pulse_cond; // signaled when the head frame changes or on close
+static int pulse_tfd = -1;
+static volatile int pulse_running = 0;
+
+// pulsing timebase, same clock as the arch time getters
+static uint64_t pulse_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// sleep (timerfd if given, else nanosleep) until close to 'when', then spin
+static void pulse_wait(uint64_t when, int tfd) {
+	uint64_t now = pulse_ns();
+	if ((int64_t)(when - now) > PULSE_SPIN_US * 1000) {
+		uint64_t ns = when - now - PULSE_SPIN_US * 1000;
+		struct timespec ts = { .tv_sec = ns / 1000000000ULL, .tv_nsec = ns % 1000000000ULL };
+		if (tfd >= 0) {
+			struct itimerspec its = { .it_interval = {0, 0}, .it_value = ts };
+			uint64_t expirations;
+			timerfd_settime(tfd, 0, &its, NULL);
+			if (read(tfd, &expirations, sizeof(expirations)) < 0) return;
+		} else {
+			nanosleep(&ts, NULL);
+		}
+	}
+	while (((int64_t)(when - pulse_ns()) > 0) && (pulse_running || (tfd < 0)));
+}
+
+// write changed bits only
+static void pulse_out(uint8_t mask) {
+	uint8_t changed = (mask ^ pin_pulsing.out) & pin_pulsing.enabled;
+	for (uint8_t i = 0; changed; i++, changed >>= 1) {
+		if (changed & 1) pin_write(pin_pulsing.pin[i], (mask >> i) & 1);
+	}
+	pin_pulsing.out = mask;
+}
+
+// frame 'milli' to absolute ns, nearest to now
+static uint64_t pulse_frame_start(uint16_t milli) {
+	uint64_t now_ms = pulse_ns() / 1000000ULL;
+	int16_t diff = (int16_t)(milli - (uint16_t)now_ms);
+	return (now_ms + diff) * 1000000ULL;
+}
+
+static void pulse_free(volatile pin_frame_t *f) {
+	free((void *)f->pulse);
+	free((void *)f);
+}
+
+// remove a played frame (new frames may have been queued in front of it meanwhile)
+static void pulse_unlink(volatile pin_frame_t *f) {
+	pthread_mutex_lock(&pulse_lock);
+	volatile pin_frame_t *prev = NULL, *cur = pin_pulsing.head;
+	while (cur && (cur != f)) {
+		prev = cur;
+		cur = cur->next;
+	}
+	if (cur) {
+		if (prev) prev->next = f->next;
+		else pin_pulsing.head = f->next;
+		if (pin_pulsing.tail == f) pin_pulsing.tail = prev;
+	}
+	pthread_mutex_unlock(&pulse_lock);
+	pulse_free(f);
+}
+
+// Wait for the head frame to be due (pulse_lock held): block on pulse_cond while nothing is
+// queued, then sleep on it until PULSE_SPIN_US before the start, so that a frame queued in
+// front wakes the player up. Returns the frame and its start, NULL on close.
+static volatile pin_frame_t *pulse_next(uint64_t *start) {
+	while (pulse_running) {
+		volatile pin_frame_t *f = pin_pulsing.head;
+		if (!f) {
+			pthread_cond_wait(&pulse_cond, &pulse_lock);
+			continue;
+		}
+		*start = pulse_frame_start(f->milli);
+		int64_t ns = (int64_t)(*start - pulse_ns()) - PULSE_SPIN_US * 1000;
+		if (ns <= 0) return f;
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		ns += ts.tv_nsec;
+		ts.tv_sec += ns / 1000000000LL;
+		ts.tv_nsec = ns % 1000000000LL;
+		pthread_cond_timedwait(&pulse_cond, &pulse_lock, &ts);
+	}
+	return NULL;
+}
+
+static void *_pulse_th(void *data) {
+	volatile pin_frame_t *f;
+	uint64_t start;
+	pthread_mutex_lock(&pulse_lock);
+	while ((f = pulse_next(&start))) {
+		pthread_mutex_unlock(&pulse_lock);
+		pulse_wait(start, -1); // spin the last PULSE_SPIN_US
+		if (pulse_ns() - start > PULSE_SLOT_US * 1000) pulse_stats.late++;
+		uint8_t last = pin_pulsing.out;
+		for (f->pulse_counter = 0; (f->pulse_counter < PULSE_SLOTS) && pulse_running; f->pulse_counter++) {
+			uint8_t mask = f->pulse[f->pulse_counter];
+			if (mask == last) continue; // no edge, no need to wake up for this slot
+			uint64_t when = start + (uint64_t)f->pulse_counter * PULSE_SLOT_US * 1000;
+			pulse_wait(when, pulse_tfd);
+			uint64_t lag = pulse_ns() - when;
+			pulse_out(mask);
+			last = mask;
+			pulse_stats.edges++;
+			pulse_stats.total_lag += lag;
+			if (lag > pulse_stats.max_lag) pulse_stats.max_lag = lag;
+		}
+		pulse_stats.frames++;
+		pulse_unlink(f);
+		pthread_mutex_lock(&pulse_lock);
+	}
+	pthread_mutex_unlock(&pulse_lock);
+	data = data; // unused parameter
+	return NULL;
+}
+
+int initPulseThread(void) {
+	if (pulse_running) return 0;
+	pulse_tfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (pulse_tfd < 0) return pulse_tfd;
+	pthread_mutex_init(&pulse_lock, NULL);
+	pthread_condattr_t cattr;
+	pthread_condattr_init(&cattr);
+	pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+	pthread_cond_init(&pulse_cond, &cattr);
+	pthread_condattr_destroy(&cattr);
+	pulseStatsReset();
+	pulse_running = 1;
+	// realtime player if allowed, normal thread otherwise
+	pthread_attr_t attr;
+	struct sched_param param = { .sched_priority = PULSE_RT_PRIO };
+	pthread_attr_init(&attr);
+	pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+	pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+	pthread_attr_setschedparam(&attr, &param);
+	int ret = pthread_create(&pulse_th, &attr, _pulse_th, NULL);
+	pthread_attr_destroy(&attr);
+	if (ret) ret = pthread_create(&pulse_th, NULL, _pulse_th, NULL);
+	if (ret) {
+		pulse_running = 0;
+		pthread_cond_destroy(&pulse_cond);
+		pthread_mutex_destroy(&pulse_lock);
+		close(pulse_tfd);
+		pulse_tfd = -1;
+		return -ret;
+	}
+	return 0;
+}
+
+uint16_t pulseNow(void) {
+	return (uint16_t)(pulse_ns() / 1000000ULL);
+}
+
+volatile pin_frame_t *pulseFrame(uint16_t milli) {
+	pin_frame_t *f = calloc(1, sizeof(pin_frame_t));
+	if (!f) return NULL;
+	f->pulse = calloc(PULSE_SLOTS, sizeof(uint8_t));
+	if (!f->pulse) {
+		free(f);
+		return NULL;
+	}
+	f->milli = milli;
+	f->next = NULL;
+	// keep the queue sorted by start time, appending is the common case
+	pthread_mutex_lock(&pulse_lock);
+	volatile pin_frame_t *tail = pin_pulsing.tail;
+	if (!pin_pulsing.head) {
+		pin_pulsing.head = f;
+		pin_pulsing.tail = f;
+	} else if ((int16_t)(milli - tail->milli) >= 0) {
+		tail->next = f;
+		pin_pulsing.tail = f;
+	} else {
+		volatile pin_frame_t *prev = NULL, *cur = pin_pulsing.head;
+		while (cur && ((int16_t)(milli - cur->milli) >= 0)) {
+			prev = cur;
+			cur = cur->next;
+		}
+		f->next = cur;
+		if (prev) prev->next = f;
+		else pin_pulsing.head = f;
+	}
+	// new head: wake the player up, it is waiting for nothing or for a later frame
+	if (pin_pulsing.head == f) pthread_cond_signal(&pulse_cond);
+	pthread_mutex_unlock(&pulse_lock);
+	return f;
+}
+
+uint32_t pulseQueued(void) {
+	uint32_t n = 0;
+	pthread_mutex_lock(&pulse_lock);
+	for (volatile pin_frame_t *f = pin_pulsing.head; f; f = f->next) n++;
+	pthread_mutex_unlock(&pulse_lock);
+	return n;
+}
+
+void pulseSingle(uint8_t pin, uint16_t width) {
+	if (width == 0) return;
+	uint64_t end = pulse_ns() + (uint64_t)width * 1000;
+	pin_write(pin, 1);
+	pulse_wait(end, -1);
+	pin_write(pin, 0);
+}
+
+void pulseStatsReset(void) {
+	pulse_stats.frames = 0;
+	pulse_stats.edges = 0;
+	pulse_stats.late = 0;
+	pulse_stats.max_lag = 0;
+	pulse_stats.total_lag = 0;
+}
+
+int closePulseThread(void) {
+	if (!pulse_running) return 0;
+	pthread_mutex_lock(&pulse_lock);
+	pulse_running = 0;
+	pthread_cond_signal(&pulse_cond);
+	pthread_mutex_unlock(&pulse_lock);
+	// wake up the player now
+	struct itimerspec its = { .it_interval = {0, 0}, .it_value = {0, 1} };
+	timerfd_settime(pulse_tfd, 0, &its, NULL);
+	pthread_join(pulse_th, NULL);
+	close(pulse_tfd);
+	pulse_tfd = -1;
+	// drop frames not played
+	while (pin_pulsing.head) {
+		volatile pin_frame_t *next = pin_pulsing.head->next;
+		pulse_free(pin_pulsing.head);
+		pin_pulsing.head = next;
+	}
+	pin_pulsing.tail = NULL;
+	pthread_cond_destroy(&pulse_cond);
+	pthread_mutex_destroy(&pulse_lock);
+	return 0;
+}
+
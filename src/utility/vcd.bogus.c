@@ -0,0 +1,117 @@
+
+#include <utility/vcd.bogus.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+const char *vcd_filename = NULL;
+volatile uint32_t vcd_changes = 0;
+volatile uint32_t vcd_lost = 0;
+
+static FILE *vcd_fp = NULL;
+static uint64_t vcd_start = 0;
+static uint64_t vcd_last = 0;
+static uint32_t vcd_head = 0; // next sequence number to claim (producers)
+static uint32_t vcd_tail = 0; // next sequence number to write (vcd_flush)
+static vcd_change_t vcd_ring[VCD_RING_SIZE];
+
+static uint64_t vcd_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// short printable identifier for signal 'n'
+static char vcd_id(uint8_t n) {
+	return '!' + n;
+}
+
+int vcd_open(const char *fname, const char *scope, uint8_t signals, const char **names, const uint8_t *values) {
+	if (vcd_fp) vcd_close();
+	if (signals > VCD_SIGNALS_MAX) return -1;
+	vcd_fp = fopen(fname, "w");
+	if (!vcd_fp) return -1;
+	memset(vcd_ring, 0, sizeof(vcd_ring));
+	vcd_head = 0;
+	vcd_tail = 0;
+	vcd_changes = 0;
+	vcd_lost = 0;
+	vcd_last = 0;
+	// header
+	time_t now = time(NULL);
+	fprintf(vcd_fp, "$date %s$end\n", ctime(&now));
+	fprintf(vcd_fp, "$version klipper-ng $end\n");
+	fprintf(vcd_fp, "$timescale 1ns $end\n");
+	fprintf(vcd_fp, "$scope module %s $end\n", scope);
+	for (uint8_t i = 0; i < signals; i++)
+		fprintf(vcd_fp, "$var wire 1 %c %s $end\n", vcd_id(i), names[i]);
+	fprintf(vcd_fp, "$upscope $end\n$enddefinitions $end\n");
+	// initial values
+	fprintf(vcd_fp, "#0\n$dumpvars\n");
+	for (uint8_t i = 0; i < signals; i++)
+		fprintf(vcd_fp, "%c%c\n", values[i] ? '1' : '0', vcd_id(i));
+	fprintf(vcd_fp, "$end\n");
+	vcd_start = vcd_ns();
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	return 0;
+}
+
+uint8_t vcd_is_open(void) {
+	return vcd_fp != NULL;
+}
+
+void vcd_record(uint8_t signal, uint8_t value) {
+	if (!vcd_fp) return;
+	uint64_t t = vcd_ns() - vcd_start;
+	uint32_t seq = __atomic_fetch_add(&vcd_head, 1, __ATOMIC_RELAXED);
+	vcd_change_t *c = &vcd_ring[seq & (VCD_RING_SIZE - 1)];
+	c->time = t;
+	c->signal = signal;
+	c->value = value;
+	__atomic_store_n(&c->seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t vcd_flush(void) {
+	uint32_t n = 0;
+	if (!vcd_fp) return 0;
+	uint32_t head = __atomic_load_n(&vcd_head, __ATOMIC_ACQUIRE);
+	// overrun: the oldest changes got overwritten
+	if (head - vcd_tail > VCD_RING_SIZE) {
+		vcd_lost += head - vcd_tail - VCD_RING_SIZE;
+		vcd_tail = head - VCD_RING_SIZE;
+	}
+	while (vcd_tail != head) {
+		vcd_change_t *c = &vcd_ring[vcd_tail & (VCD_RING_SIZE - 1)];
+		uint32_t seq = __atomic_load_n(&c->seq, __ATOMIC_ACQUIRE);
+		if (seq != vcd_tail + 1) {
+			if ((int32_t)(seq - (vcd_tail + 1)) > 0) { // overwritten meanwhile
+				vcd_lost++;
+				vcd_tail++;
+				continue;
+			}
+			break; // claimed but not written yet
+		}
+		vcd_change_t copy = *c;
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&c->seq, __ATOMIC_RELAXED) != seq) continue; // overwritten while copying
+		// concurrent producers may claim slots slightly out of time order: VCD time must not go back
+		if (copy.time < vcd_last) copy.time = vcd_last;
+		if (copy.time != vcd_last) fprintf(vcd_fp, "#%llu\n", (unsigned long long)copy.time);
+		fprintf(vcd_fp, "%c%c\n", copy.value ? '1' : '0', vcd_id(copy.signal));
+		vcd_last = copy.time;
+		vcd_changes++;
+		vcd_tail++;
+		n++;
+	}
+	return n;
+}
+
+void vcd_close(void) {
+	if (!vcd_fp) return;
+	vcd_flush();
+	fprintf(vcd_fp, "#%llu\n", (unsigned long long)(vcd_ns() - vcd_start));
+	FILE *fp = vcd_fp;
+	vcd_fp = NULL;
+	fclose(fp);
+}
+
@@ -3,6 +3,7 @@
 #include <unistd.h>
 #include <string.h>
 #include <signal.h>
+#include <time.h>
 #include <utility/fdthread.linux.h>
 
 volatile sig_atomic_t running = 1;
@@ -12,6 +13,10 @@ void sigint(int sig){
 	running = 0;
 }
 
+void tx_full(int fdid) {
+	(void)fdid;
+}
+
 int main(int argc, const char *argv[]) {
 	printf("(exec) %s ", argv[0]);
 	for (int i=1;i<argc;i++) {
@@ -20,11 +25,41 @@ int main(int argc, const char *argv[]) {
 	printf("\n");
 	signal(SIGINT, sigint);
 
-	initFdThread();
+	const char *fname = "/tmp/klipper-ng-pty3";
+	if (argc > 1) fname = argv[1];
+	uint8_t tx_data[BLOCK_SIZE];
+	for (int i=0;i<BLOCK_SIZE;i++) tx_data[i] = i;
+
+	int ret = initFdThread();
+	if (ret < 0) {
+		printf("Can't init fdthread. (%d)\n", ret);
+		exit(1);
+	}
+	wBufferFullHandler = tx_full; // full ring is normal here, just retry
+	int fdout = fdOpen(fname, FD_TYPE_FILE);
+	if (fdout < 0) {
+		printf("fdOpen %s failed. (%d)\n", fname, fdout);
+		exit(1);
+	}
+
+	// write as fast as the fd takes it
+	uint64_t total = 0, second = 0;
+	time_t last = time(NULL);
 	while(running) {
-		sleep(1);
+		int len = fdWrite(fdout, tx_data, BLOCK_SIZE);
+		if (len < 0) {
+			printf("fdWrite %s failed. (%d)\n", fname, len);
+			exit(1);
+		}
+		if (len < BLOCK_SIZE) usleep(100);
+		second += len;
+		if (time(NULL) != last) {
+			total += second;
+			printf("- %lu bytes/s (%lu total)\n", (unsigned long)second, (unsigned long)total);
+			second = 0;
+			last = time(NULL);
+		}
 	}
 	closeFdThread();
 	exit(0);
 }
-